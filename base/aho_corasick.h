@@ -0,0 +1,141 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <queue>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// An Aho-Corasick automaton which finds all the occurrences of a set of patterns in one scan of the text.
+// The patterns are added first, then Build() must be called before any search and after adding more patterns.
+template <typename CharT>
+class AhoCorasick {
+ public:
+  using string_view = std::basic_string_view<CharT>;
+
+  AhoCorasick() { Clear(); }
+
+  void Clear() {
+    nodes_.assign(1, Node{});
+    root_next_.fill(kNone);
+    pattern_lengths_.clear();
+  }
+
+  // Returns the index of the pattern, which is reported by the searches.
+  size_t AddPattern(string_view pattern) {
+    int state = 0;
+    for (CharT ch : pattern) {
+      int next = EdgeChild(state, ch);
+      if (next == kNone) {
+        next = static_cast<int>(nodes_.size());
+        nodes_.emplace_back();
+        auto& edges = nodes_[state].edges;
+        edges.insert(std::lower_bound(edges.begin(), edges.end(), std::make_pair(ch, 0)), std::make_pair(ch, next));
+      }
+      state = next;
+    }
+
+    nodes_[state].patterns.push_back(pattern_lengths_.size());
+    pattern_lengths_.push_back(pattern.size());
+    return pattern_lengths_.size() - 1;
+  }
+
+  // Computes the failure and output links with a breadth-first traversal.
+  void Build() {
+    root_next_.fill(kNone);
+    for (auto& edge : nodes_[0].edges) {
+      if (IsDense(edge.first)) {
+        root_next_[static_cast<size_t>(edge.first)] = edge.second;
+      }
+    }
+
+    std::queue<int> queue;
+    for (auto& edge : nodes_[0].edges) {
+      nodes_[edge.second].fail = 0;
+      nodes_[edge.second].output = kNone;
+      queue.push(edge.second);
+    }
+
+    while (!queue.empty()) {
+      int state = queue.front();
+      queue.pop();
+      for (auto& edge : nodes_[state].edges) {
+        int fail = nodes_[state].fail;
+        int next = Child(fail, edge.first);
+        while (next == kNone && fail != 0) {
+          fail = nodes_[fail].fail;
+          next = Child(fail, edge.first);
+        }
+
+        Node& child = nodes_[edge.second];
+        child.fail = next == kNone ? 0 : next;
+        child.output = nodes_[child.fail].patterns.empty() ? nodes_[child.fail].output : child.fail;
+        queue.push(edge.second);
+      }
+    }
+  }
+
+  size_t PatternCount() const { return pattern_lengths_.size(); }
+  size_t PatternLength(size_t pattern) const { return pattern_lengths_[pattern]; }
+
+  // Calls on_match(pattern, begin, end) for every occurrence, ordered by the end position,
+  // in which [begin, end) is the range of the occurrence in the text.
+  template <typename Fn>
+  void FindAll(string_view text, Fn&& on_match) const {
+    int state = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+      CharT ch = text[i];
+      int next = Child(state, ch);
+      while (next == kNone && state != 0) {
+        state = nodes_[state].fail;
+        next = Child(state, ch);
+      }
+      state = next == kNone ? 0 : next;
+
+      for (int out = nodes_[state].patterns.empty() ? nodes_[state].output : state; out != kNone;
+           out = nodes_[out].output) {
+        for (size_t pattern : nodes_[out].patterns) {
+          on_match(pattern, i + 1 - pattern_lengths_[pattern], i + 1);
+        }
+      }
+    }
+  }
+
+ private:
+  static constexpr int kNone = -1;
+  static constexpr size_t kDenseSize = 128;
+
+  struct Node {
+    std::vector<std::pair<CharT, int>> edges;  // sorted by the character
+    std::vector<size_t> patterns;              // the patterns ending at this node
+    int fail = 0;
+    int output = kNone;  // the nearest node on the failure chain where a pattern ends
+  };
+
+  static bool IsDense(CharT ch) {
+    return static_cast<std::make_unsigned_t<CharT>>(ch) < kDenseSize;
+  }
+
+  int Child(int state, CharT ch) const {
+    // most of the characters don't start any pattern, so the root has a direct table for ASCII.
+    if (state == 0 && IsDense(ch)) {
+      return root_next_[static_cast<size_t>(ch)];
+    }
+    return EdgeChild(state, ch);
+  }
+
+  int EdgeChild(int state, CharT ch) const {
+    const auto& edges = nodes_[state].edges;
+    auto it = std::lower_bound(edges.begin(), edges.end(), std::make_pair(ch, 0),
+                               [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    return (it != edges.end() && it->first == ch) ? it->second : kNone;
+  }
+
+  std::vector<Node> nodes_;
+  std::array<int, kDenseSize> root_next_;
+  std::vector<size_t> pattern_lengths_;
+};
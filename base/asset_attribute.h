@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "ocos.h"
+#include "asset_compression.h"
+#include "mapped_file.h"
+#include "string_utils.h"
+
+namespace ort_extensions {
+
+// The bytes of an asset of a kernel, like a vocabulary or a model, which are either the string attribute of
+// its name, or the file of the attribute of its name with the "_path" suffix, like "vocab_path" for "vocab".
+// The file is mapped read-only instead of being copied into the model and every kernel, so the kernels of all
+// the processes on a host read the same pages of the page cache. The copies are cheap, they share the mapping.
+class AssetBytes {
+ public:
+  AssetBytes() = default;
+  explicit AssetBytes(std::string bytes) : bytes_(std::move(bytes)) {}
+
+  // Maps the file of the path, which is relative to the ORTX_ASSET_DIR environment variable if it's set, or to
+  // the working directory, since ORT doesn't tell the kernels the path of their model.
+  static AssetBytes FromFile(const std::string& path) {
+    auto file = std::make_shared<MappedFile>();
+    const std::string resolved = ResolvePath(path);
+    if (!file->Open(resolved)) {
+      ORTX_CXX_API_THROW(MakeString("Failed to map the asset file ", resolved, "."), ORT_INVALID_ARGUMENT);
+    }
+
+    AssetBytes asset;
+    asset.file_ = std::move(file);
+    return asset;
+  }
+
+  static std::string ResolvePath(const std::string& path) { return ResolvePath(path, std::getenv("ORTX_ASSET_DIR")); }
+
+  // The path of a model isn't trusted once the directory of the assets is set: it must be relative and stay in
+  // the directory after its "..", and the symbolic links of its existing part, are resolved.
+  static std::string ResolvePath(const std::string& path, const char* dir) {
+    if (dir == nullptr || *dir == '\0') {
+      return path;
+    }
+
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    fs::path root = fs::weakly_canonical(fs::u8path(dir), ec);
+    if (!root.has_filename()) {
+      root = root.parent_path();
+    }
+    const fs::path relative = fs::u8path(path);
+    if (!ec && !path.empty() && !relative.has_root_path()) {
+      const fs::path resolved = fs::weakly_canonical(root / relative, ec);
+      if (!ec && std::mismatch(root.begin(), root.end(), resolved.begin(), resolved.end()).first == root.end()) {
+        return resolved.string();
+      }
+    }
+    ORTX_CXX_API_THROW(MakeString("The asset file ", path, " isn't in the directory ", dir, " of ORTX_ASSET_DIR."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  bool IsFile() const { return file_ != nullptr; }
+
+  std::string_view View() const {
+    if (file_ != nullptr) {
+      return std::string_view(reinterpret_cast<const char*>(file_->Data()), file_->Size());
+    }
+    return bytes_;
+  }
+
+  operator std::string_view() const { return View(); }
+  bool empty() const { return View().empty(); }
+
+ private:
+  std::string bytes_;
+  std::shared_ptr<const MappedFile> file_;
+};
+
+// Decompresses the asset of the name if the node has its "_compression" attribute, like "vocab_compression" of
+// "zstd", so the assets are stored compressed in the model or their files, and decompressed once into the asset.
+// The "_max_size" attribute, like "vocab_max_size", bounds the decompressed bytes, 1 GB by default.
+inline AssetBytes DecompressAssetAttribute(const BaseKernel& kernel, const std::string& name, AssetBytes asset) {
+  std::string compression;
+  if (!kernel.TryToGetAttribute((name + "_compression").c_str(), compression) || compression.empty()) {
+    return asset;
+  }
+
+  const int64_t max_size = kernel.TryToGetAttributeWithDefault<int64_t>(
+      (name + "_max_size").c_str(), static_cast<int64_t>(kDefaultMaxAssetSize));
+  if (max_size <= 0) {
+    ORTX_CXX_API_THROW(MakeString("The attribute ", name, "_max_size should be positive."), ORT_INVALID_ARGUMENT);
+  }
+  std::string raw;
+  std::string error;
+  if (!DecompressAsset(compression, asset.View(), raw, error, static_cast<size_t>(max_size))) {
+    ORTX_CXX_API_THROW(MakeString("Failed to decompress the asset ", name, ": ", error), ORT_INVALID_ARGUMENT);
+  }
+  return AssetBytes(std::move(raw));
+}
+
+// Reads the asset of the name from the string attribute of the name, or maps the file of the "_path" attribute.
+// If the node has neither of them, it's an error unless the asset is optional, which is empty then.
+inline AssetBytes GetAssetAttribute(const BaseKernel& kernel, const std::string& name, bool optional = false) {
+  std::string value;
+  if (kernel.TryToGetAttribute((name + "_path").c_str(), value) && !value.empty()) {
+    return DecompressAssetAttribute(kernel, name, AssetBytes::FromFile(value));
+  }
+  if (!kernel.TryToGetAttribute(name.c_str(), value) && !optional) {
+    ORTX_CXX_API_THROW(MakeString("The node has neither the attribute ", name, " nor ", name, "_path."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  return DecompressAssetAttribute(kernel, name, AssetBytes(std::move(value)));
+}
+
+}  // namespace ort_extensions
@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "asset_compression.h"
+
+#include <string>
+
+#ifdef ENABLE_ZSTD
+#include "zstd.h"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#endif
+
+namespace ort_extensions {
+
+#ifdef ENABLE_ZSTD
+namespace {
+std::string TooLargeError(size_t max_size) {
+  return "The decompressed asset is larger than its maximum size of " + std::to_string(max_size) + " bytes.";
+}
+
+bool DecompressZstd(std::string_view compressed, std::string& raw, std::string& error, size_t max_size) {
+  std::unique_ptr<ZSTD_DStream, decltype(&ZSTD_freeDStream)> stream(ZSTD_createDStream(), ZSTD_freeDStream);
+  if (stream == nullptr) {
+    error = "Failed to create the zstd stream.";
+    return false;
+  }
+  max_size = std::min(max_size, std::numeric_limits<size_t>::max() - 1);
+
+  // the output is reserved for the content size of the first frame, which the compressors write by default
+  const unsigned long long content_size = ZSTD_getFrameContentSize(compressed.data(), compressed.size());
+  if (content_size == ZSTD_CONTENTSIZE_ERROR) {
+    error = "The data isn't a zstd frame.";
+    return false;
+  }
+  if (content_size != ZSTD_CONTENTSIZE_UNKNOWN && content_size > max_size) {
+    error = TooLargeError(max_size);
+    return false;
+  }
+  raw.clear();
+  if (content_size != ZSTD_CONTENTSIZE_UNKNOWN) {
+    raw.reserve(static_cast<size_t>(content_size));
+  }
+
+  // the output grows by the chunks of the stream beyond the reserved size, and the stream is called again while it
+  // fills the output, since it may have buffered more. A frame is done when the stream returns 0. The output stops
+  // one byte over max_size, which tells an asset of max_size from a larger one.
+  const size_t chunk = ZSTD_DStreamOutSize();
+  ZSTD_inBuffer input{compressed.data(), compressed.size(), 0};
+  size_t remaining = 0;
+  bool full = false;
+  do {
+    const size_t size = raw.size();
+    raw.resize(size + std::min(std::max(chunk, raw.capacity() - size), max_size + 1 - size));
+    ZSTD_outBuffer output{&raw[0], raw.size(), size};
+    remaining = ZSTD_decompressStream(stream.get(), &output, &input);
+    full = output.pos == output.size;
+    raw.resize(output.pos);
+    if (ZSTD_isError(remaining)) {
+      error = ZSTD_getErrorName(remaining);
+      return false;
+    }
+    if (raw.size() > max_size) {
+      error = TooLargeError(max_size);
+      return false;
+    }
+  } while (input.pos < input.size || (remaining != 0 && full));
+
+  // a frame which stops before its end
+  if (remaining != 0) {
+    error = "The zstd frame is truncated.";
+    return false;
+  }
+  return true;
+}
+}  // namespace
+#endif
+
+bool DecompressAsset(std::string_view compression, std::string_view compressed, std::string& raw,
+                     std::string& error, size_t max_size) {
+  if (compression == "zstd") {
+#ifdef ENABLE_ZSTD
+    return DecompressZstd(compressed, raw, error, max_size);
+#else
+    error = "The library is built without zstd, which OCOS_ENABLE_ZSTD=ON adds.";
+    return false;
+#endif
+  }
+
+  error = "Unknown compression " + std::string(compression) + ", which should be zstd.";
+  return false;
+}
+
+}  // namespace ort_extensions
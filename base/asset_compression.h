@@ -0,0 +1,20 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace ort_extensions {
+
+// Decompresses an asset of the compression of its "_compression" attribute, like "zstd", into raw. It returns false
+// with the reason in error if the compression isn't known, isn't built, or the data is corrupted.
+// The frames are decompressed by the chunks of the stream, one after another, so an asset without its content size
+// in the frame header is decompressed too, without a copy of the whole output.
+// An output over max_size fails before it's allocated, so a small asset of a model can't expand into all the memory.
+constexpr size_t kDefaultMaxAssetSize = size_t{1} << 30;
+bool DecompressAsset(std::string_view compression, std::string_view compressed, std::string& raw,
+                     std::string& error, size_t max_size = kDefaultMaxAssetSize);
+
+}  // namespace ort_extensions
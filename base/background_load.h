@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "numa.h"
+
+// The threads which run the background loads of the kernels, up to one per core and started as the loads are
+// queued, so a session of many nodes parses as many of them at once as the cores allow.
+// It's never destroyed, like the idle threads, which wait for the loads of the next sessions until the exit.
+class BackgroundLoader {
+ public:
+  static BackgroundLoader& Instance() {
+    static BackgroundLoader* loader = new BackgroundLoader();
+    return *loader;
+  }
+
+  void Submit(std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+    if (idle_ < tasks_.size() && threads_ < max_threads_) {
+      ++threads_;
+      std::thread([this]() { Work(); }).detach();
+    } else {
+      ready_.notify_one();
+    }
+  }
+
+ private:
+  BackgroundLoader() : max_threads_(std::max(1u, std::thread::hardware_concurrency())) {}
+
+  void Work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      ++idle_;
+      ready_.wait(lock, [this]() { return !tasks_.empty(); });
+      --idle_;
+      std::function<void()> task = std::move(tasks_.front());
+      tasks_.pop_front();
+      lock.unlock();
+      task();
+      lock.lock();
+    }
+  }
+
+  const size_t max_threads_;
+  size_t threads_{};
+  size_t idle_{};
+  std::deque<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable ready_;
+};
+
+// The state which a kernel loads from its attributes, like the vocabulary of a tokenizer, and which is loaded
+// in its constructor, or by the BackgroundLoader while the session is created if the ORTX_BACKGROUND_INIT
+// environment variable is set to 1. Then the nodes of a session are loaded in parallel, and the first Compute
+// of a kernel only waits for its own state. The load must own everything it reads, since it can outlive the
+// constructor, and an error of a background load is thrown by the first Compute instead of the constructor.
+// The state of a type of ort_extensions::IsNumaReplicable is read from its copy on the NUMA node of the thread with
+// ORTX_NUMA_REPLICAS=1.
+template <typename T>
+class BackgroundLoad {
+ public:
+  BackgroundLoad() = default;
+
+  ~BackgroundLoad() {
+    if (future_.valid()) {
+      future_.wait();
+    }
+  }
+
+  BackgroundLoad(const BackgroundLoad&) = delete;
+  BackgroundLoad& operator=(const BackgroundLoad&) = delete;
+
+  static bool IsEnabled() {
+    static const bool enabled = [] {
+      const char* value = std::getenv("ORTX_BACKGROUND_INIT");
+      return value != nullptr && std::string_view(value) == "1";
+    }();
+    return enabled;
+  }
+
+  // Loads the state by load(), which returns a std::shared_ptr<const T>, now or in the background.
+  template <typename Load>
+  void Start(Load&& load, bool background = IsEnabled()) {
+    if (background) {
+      auto task = std::make_shared<std::packaged_task<std::shared_ptr<const T>()>>(std::forward<Load>(load));
+      future_ = task->get_future().share();
+      BackgroundLoader::Instance().Submit([task]() { (*task)(); });
+    } else {
+      instance_ = load();
+      ready_.store(instance_.get(), std::memory_order_release);
+    }
+  }
+
+  // Waits for the state, or throws the error of its load.
+  const T* Get() const {
+    const T* instance = Primary();
+    if constexpr (ort_extensions::IsNumaReplicable<T>::value) {
+      if (ort_extensions::NumaTopology::ReplicasEnabled()) {
+        return replicas_.Get(instance_);
+      }
+    }
+    return instance;
+  }
+
+  const T* operator->() const { return Get(); }
+  const T& operator*() const { return *Get(); }
+
+ private:
+  const T* Primary() const {
+    const T* instance = ready_.load(std::memory_order_acquire);
+    if (instance != nullptr) {
+      return instance;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (instance_ == nullptr) {
+      instance_ = future_.get();
+      ready_.store(instance_.get(), std::memory_order_release);
+    }
+    return instance_.get();
+  }
+
+  std::shared_future<std::shared_ptr<const T>> future_;
+  mutable std::shared_ptr<const T> instance_;
+  mutable std::atomic<const T*> ready_{nullptr};
+  mutable std::mutex mutex_;
+  ort_extensions::NumaReplicas<T> replicas_;
+};
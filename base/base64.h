@@ -3,7 +3,8 @@
 // Freely inspired from https://en.wikibooks.org/wiki/Algorithm_Implementation/Miscellaneous/Base64
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 
 bool base64_encode(const std::vector<uint8_t>& input, std::string& encoded);
-bool base64_decode(const std::string& encoded, std::vector<uint8_t>& raw);
+bool base64_decode(std::string_view encoded, std::vector<uint8_t>& raw);
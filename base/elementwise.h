@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "parallel_for.h"
+
+namespace ort_extensions {
+
+// The elements of a chunk of an elementwise loop, a multiple of the cache lines, which is small enough to balance
+// the threads and big enough for the vectorized loop to hide the tail of each chunk.
+constexpr size_t kElementwiseChunk = 16384;
+
+// Calls op(input[i], outputs[i]...) for every i in [0, size), in which op writes the outputs through references, as
+// [](float x, float& y) { y = x * 2; }. The loop over a chunk is a plain one over the pointers, which the compiler
+// vectorizes when op is branchless, and the chunks run in parallel once the loop is worth more than one thread.
+// cost is the rough number of the CPU cycles of op.
+template <typename In, typename Op, typename... Out>
+void TransformElements(size_t size, double cost, Op&& op, const In* input, Out*... outputs) {
+  auto run = [&](size_t begin, size_t end) {
+    const In* in = input + begin;
+    const size_t count = end - begin;
+    auto loop = [&](auto*... out) {
+      for (size_t i = 0; i < count; ++i) {
+        op(in[i], out[i]...);
+      }
+    };
+    loop((outputs + begin)...);
+  };
+
+  const size_t num_chunks = (size + kElementwiseChunk - 1) / kElementwiseChunk;
+  ParallelFor(Ort::Custom::ComputeContext::Current(), num_chunks, cost * static_cast<double>(kElementwiseChunk),
+              [&](size_t begin, size_t end) {
+                run(begin * kElementwiseChunk, std::min(end * kElementwiseChunk, size));
+              });
+}
+
+}  // namespace ort_extensions
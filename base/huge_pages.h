@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "runtime_stats.h"
+
+namespace ort_extensions {
+
+// The huge pages of the big read-only tables of the tokenizers, like the tokens of a vocabulary and the merges of
+// BPE, whose random lookups miss the TLB over their many pages of 4 KB. The environment variable ORTX_HUGE_PAGES
+// of 1 backs the allocations of 2 MB or more of these tables by the transparent huge pages of madvise, and the one
+// of hugetlb by the pages reserved in /proc/sys/vm/nr_hugepages, or the transparent ones if there are none left.
+// It's Linux only, and elsewhere, or without the variable, the tables are of operator new. The bytes of the tables
+// backed this way are counted in huge_page_bytes of the runtime statistics.
+class HugePages {
+ public:
+  enum class Mode { kOff, kTransparent, kHugetlb };
+
+  static constexpr size_t kPageSize = size_t{2} << 20;
+
+  static Mode CurrentMode() {
+    static const Mode mode = [] {
+#if defined(__linux__)
+      const char* value = std::getenv("ORTX_HUGE_PAGES");
+      if (value != nullptr && std::string_view(value) == "1") {
+        return Mode::kTransparent;
+      }
+      if (value != nullptr && std::string_view(value) == "hugetlb") {
+        return Mode::kHugetlb;
+      }
+#endif
+      return Mode::kOff;
+    }();
+    return mode;
+  }
+
+  // Whether an allocation of the bytes is of the huge pages, which depends on its size only, so its deallocation
+  // of the same size knows how to free it.
+  static bool Backs(size_t bytes) { return bytes >= kPageSize && CurrentMode() != Mode::kOff; }
+
+  static void* Allocate(size_t bytes) {
+    if (!Backs(bytes)) {
+      return ::operator new(bytes);
+    }
+
+    void* data = nullptr;
+#if defined(__linux__)
+    const size_t length = RoundUp(bytes);
+#if defined(MAP_HUGETLB)
+    if (CurrentMode() == Mode::kHugetlb) {
+      data = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+    if (data == nullptr || data == MAP_FAILED) {
+      data = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (data == MAP_FAILED) {
+        throw std::bad_alloc();
+      }
+#if defined(MADV_HUGEPAGE)
+      madvise(data, length, MADV_HUGEPAGE);
+#endif
+    }
+    Stat().Add(static_cast<int64_t>(length));
+#endif
+    return data;
+  }
+
+  static void Deallocate(void* data, size_t bytes) noexcept {
+    if (!Backs(bytes)) {
+      ::operator delete(data);
+      return;
+    }
+
+#if defined(__linux__)
+    const size_t length = RoundUp(bytes);
+    munmap(data, length);
+    Stat().Add(-static_cast<int64_t>(length));
+#endif
+  }
+
+ private:
+  // the length of a mapping of MAP_HUGETLB is of whole huge pages, for its munmap too
+  static size_t RoundUp(size_t bytes) { return (bytes + kPageSize - 1) / kPageSize * kPageSize; }
+
+  static StatCounter& Stat() {
+    static auto& bytes = RuntimeStats::Instance().Counter("huge_page_bytes");
+    return bytes;
+  }
+};
+
+// The allocator of the containers of the big read-only tables, of HugePages for their allocations of 2 MB or more.
+template <typename T>
+class HugePageAllocator {
+ public:
+  using value_type = T;
+
+  HugePageAllocator() = default;
+  template <typename U>
+  HugePageAllocator(const HugePageAllocator<U>&) noexcept {}
+
+  T* allocate(size_t n) { return static_cast<T*>(HugePages::Allocate(n * sizeof(T))); }
+  void deallocate(T* data, size_t n) noexcept { HugePages::Deallocate(data, n * sizeof(T)); }
+
+  template <typename U>
+  bool operator==(const HugePageAllocator<U>&) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const HugePageAllocator<U>&) const noexcept {
+    return false;
+  }
+};
+
+template <typename T>
+using HugePageVector = std::vector<T, HugePageAllocator<T>>;
+using HugePageString = std::basic_string<char, std::char_traits<char>, HugePageAllocator<char>>;
+
+}  // namespace ort_extensions
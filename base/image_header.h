@@ -0,0 +1,229 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace ort_extensions {
+
+// The size of an image from the header of its JPEG, PNG or WebP stream, which is read before the image is decoded,
+// so the decoder may write the pixels into a buffer of the size directly. The size is the one of the decoded image,
+// in which the EXIF orientation of a JPEG image which rotates it by 90 degrees swaps the height and the width.
+struct ImageHeader {
+  enum class Format {
+    kUnknown,
+    kJpeg,
+    kPng,
+    kWebp
+  };
+
+  Format format{};
+  int64_t height{};
+  int64_t width{};
+  uint32_t orientation{1};  // the EXIF orientation of a JPEG image, 1 if it isn't transformed
+};
+
+namespace detail {
+
+inline uint32_t ReadBigEndian(const uint8_t* p, size_t bytes) {
+  uint32_t value = 0;
+  for (size_t i = 0; i < bytes; ++i) {
+    value = (value << 8) | p[i];
+  }
+  return value;
+}
+
+// The orientation of the TIFF structure of an EXIF segment, or 1 (no transform) if it isn't there.
+inline uint32_t ReadExifOrientation(const uint8_t* tiff, size_t size) {
+  if (size < 8 || !((tiff[0] == 'I' && tiff[1] == 'I') || (tiff[0] == 'M' && tiff[1] == 'M'))) {
+    return 1;
+  }
+  const bool little = tiff[0] == 'I';
+  auto read = [tiff, little](size_t offset, size_t bytes) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+      value |= static_cast<uint32_t>(tiff[offset + (little ? i : bytes - 1 - i)]) << (8 * i);
+    }
+    return value;
+  };
+
+  const size_t ifd = read(4, 4);
+  if (ifd + 2 > size) {
+    return 1;
+  }
+  const size_t entries = read(ifd, 2);
+  for (size_t i = 0; i < entries && ifd + 2 + (i + 1) * 12 <= size; ++i) {
+    const size_t entry = ifd + 2 + i * 12;
+    if (read(entry, 2) == 0x0112) {
+      return read(entry + 8, 2);
+    }
+  }
+  return 1;
+}
+
+inline bool ReadJpegHeader(const uint8_t* data, size_t size, ImageHeader& header) {
+  uint32_t orientation = 1;
+  size_t pos = 2;
+  while (pos + 4 <= size) {
+    if (data[pos] != 0xFF) {
+      return false;
+    }
+    const uint8_t marker = data[pos + 1];
+    if (marker == 0xFF) {  // a fill byte
+      ++pos;
+      continue;
+    }
+    if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8)) {  // the markers without a segment
+      pos += 2;
+      continue;
+    }
+    const size_t length = ReadBigEndian(data + pos + 2, 2);
+    const uint8_t* segment = data + pos + 4;
+    if (length < 2 || pos + 2 + length > size) {
+      return false;
+    }
+
+    if (marker == 0xE1 && orientation == 1 && length >= 8 && std::memcmp(segment, "Exif\0\0", 6) == 0) {
+      orientation = ReadExifOrientation(segment + 6, length - 8);
+    } else if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+      // a start of frame, with the precision, the height and the width
+      if (length < 7) {
+        return false;
+      }
+      header.format = ImageHeader::Format::kJpeg;
+      header.height = ReadBigEndian(segment + 1, 2);
+      header.width = ReadBigEndian(segment + 3, 2);
+      header.orientation = orientation;
+      if (orientation >= 5 && orientation <= 8) {
+        std::swap(header.height, header.width);
+      }
+      // a height of 0 is defined by a DNL marker after the first scan
+      return header.height > 0 && header.width > 0;
+    } else if (marker == 0xDA || marker == 0xD9) {
+      return false;
+    }
+    pos += 2 + length;
+  }
+  return false;
+}
+
+inline bool ReadPngHeader(const uint8_t* data, size_t size, ImageHeader& header) {
+  // the signature, and the IHDR chunk which is the first one
+  if (size < 33 || std::memcmp(data + 12, "IHDR", 4) != 0) {
+    return false;
+  }
+  header.format = ImageHeader::Format::kPng;
+  header.width = ReadBigEndian(data + 16, 4);
+  header.height = ReadBigEndian(data + 20, 4);
+  if (header.height <= 0 || header.width <= 0) {
+    return false;
+  }
+
+  // An eXIf chunk may orient the image, which isn't read here.
+  size_t pos = 8;
+  while (pos + 8 <= size) {
+    const size_t length = ReadBigEndian(data + pos, 4);
+    const uint8_t* type = data + pos + 4;
+    if (std::memcmp(type, "eXIf", 4) == 0) {
+      return false;
+    }
+    if (std::memcmp(type, "IDAT", 4) == 0) {
+      return true;
+    }
+    if (pos + 12 > size || length > size - pos - 12) {
+      return false;
+    }
+    pos += 12 + length;
+  }
+  return false;
+}
+
+inline uint32_t ReadLittleEndian(const uint8_t* p, size_t bytes) {
+  uint32_t value = 0;
+  for (size_t i = 0; i < bytes; ++i) {
+    value |= static_cast<uint32_t>(p[i]) << (8 * i);
+  }
+  return value;
+}
+
+// The size of the first chunk of a WebP stream after the RIFF header, the lossy VP8 frame, the lossless VP8L one, or
+// the canvas of the extended VP8X format, which isn't read if it's animated.
+inline bool ReadWebpHeader(const uint8_t* data, size_t size, ImageHeader& header) {
+  if (size < 30) {
+    return false;
+  }
+  const uint8_t* chunk = data + 12;
+  const uint8_t* payload = data + 20;
+  if (std::memcmp(chunk, "VP8 ", 4) == 0) {
+    if (payload[3] != 0x9D || payload[4] != 0x01 || payload[5] != 0x2A) {
+      return false;
+    }
+    header.width = ReadLittleEndian(payload + 6, 2) & 0x3FFF;
+    header.height = ReadLittleEndian(payload + 8, 2) & 0x3FFF;
+  } else if (std::memcmp(chunk, "VP8L", 4) == 0) {
+    if (payload[0] != 0x2F) {
+      return false;
+    }
+    const uint32_t bits = ReadLittleEndian(payload + 1, 4);
+    header.width = (bits & 0x3FFF) + 1;
+    header.height = ((bits >> 14) & 0x3FFF) + 1;
+  } else if (std::memcmp(chunk, "VP8X", 4) == 0) {
+    if (payload[0] & 0x02) {  // the animation
+      return false;
+    }
+    header.width = ReadLittleEndian(payload + 4, 3) + 1;
+    header.height = ReadLittleEndian(payload + 7, 3) + 1;
+  } else {
+    return false;
+  }
+  header.format = ImageHeader::Format::kWebp;
+  return header.height > 0 && header.width > 0;
+}
+
+}  // namespace detail
+
+// Reads the size of the image from the header of a JPEG, PNG or WebP stream. Returns false if the stream is of another
+// format, or its header isn't complete, or the decoder may change the size by the metadata which isn't read here.
+inline bool ReadImageHeader(const uint8_t* data, size_t size, ImageHeader& header) {
+  static const uint8_t kPngSignature[] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+  if (size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF) {
+    return detail::ReadJpegHeader(data, size, header);
+  }
+  if (size >= sizeof(kPngSignature) && std::memcmp(data, kPngSignature, sizeof(kPngSignature)) == 0) {
+    return detail::ReadPngHeader(data, size, header);
+  }
+  if (size >= 12 && std::memcmp(data, "RIFF", 4) == 0 && std::memcmp(data + 8, "WEBP", 4) == 0) {
+    return detail::ReadWebpHeader(data, size, header);
+  }
+  return false;
+}
+
+// The largest denominator of 2, 4 or 8 of the scaled IDCT of a JPEG image, which decodes the image at the size of
+// ReducedImageHeader() without the full size, and keeps it at least min_height x min_width. Returns 1 if no
+// reduction does, or the image isn't a JPEG one.
+inline int64_t JpegScaleDenominator(const ImageHeader& header, int64_t min_height, int64_t min_width) {
+  if (header.format != ImageHeader::Format::kJpeg) {
+    return 1;
+  }
+  for (int64_t denominator : {8, 4, 2}) {
+    if ((header.height + denominator - 1) / denominator >= min_height &&
+        (header.width + denominator - 1) / denominator >= min_width) {
+      return denominator;
+    }
+  }
+  return 1;
+}
+
+// The size of the image which is decoded with the scaled IDCT of the denominator, rounded up like libjpeg does.
+inline ImageHeader ReducedImageHeader(const ImageHeader& header, int64_t denominator) {
+  ImageHeader reduced = header;
+  reduced.height = (header.height + denominator - 1) / denominator;
+  reduced.width = (header.width + denominator - 1) / denominator;
+  return reduced;
+}
+
+}  // namespace ort_extensions
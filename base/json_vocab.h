@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "ocos.h"
+#include "nlohmann/json.hpp"
+
+// The number of the entries of a JSON vocabulary, {"token": id, ...}, by a scan of its colons out of the strings,
+// so its containers are reserved once before it's parsed.
+inline size_t CountJsonVocabEntries(std::string_view json) {
+  size_t count = 0;
+  bool in_string = false;
+  for (size_t i = 0; i < json.size(); ++i) {
+    const char c = json[i];
+    if (in_string) {
+      if (c == '\\') {
+        ++i;
+      } else if (c == '"') {
+        in_string = false;
+      }
+    } else if (c == '"') {
+      in_string = true;
+    } else if (c == ':') {
+      ++count;
+    }
+  }
+  return count;
+}
+
+// Parses a JSON vocabulary, {"token": id, ...}, by the SAX interface of nlohmann, which calls add(token, id) for
+// every entry in their order, so the tokens go directly into the vocabulary of the kernel without the DOM or an
+// intermediate map. The token is only valid in the call.
+template <typename Add>
+void ParseJsonVocab(std::string_view json, Add&& add) {
+  using Json = nlohmann::json;
+
+  class Handler : public nlohmann::json_sax<Json> {
+   public:
+    explicit Handler(Add& add) : add_(add) {}
+
+    bool null() override { return Fail("null"); }
+    bool boolean(bool) override { return Fail("a boolean"); }
+    bool number_integer(number_integer_t value) override { return Value(value); }
+    bool number_unsigned(number_unsigned_t value) override {
+      return value > static_cast<number_unsigned_t>(INT32_MAX) ? Fail("an id out of int32")
+                                                               : Value(static_cast<number_integer_t>(value));
+    }
+    bool number_float(number_float_t, const string_t&) override { return Fail("a float"); }
+    bool string(string_t&) override { return Fail("a string"); }
+    bool binary(binary_t&) override { return Fail("a binary"); }
+    bool start_object(std::size_t) override { return ++depth_ == 1 ? true : Fail("an object"); }
+    bool key(string_t& token) override {
+      key_.swap(token);
+      return true;
+    }
+    bool end_object() override {
+      --depth_;
+      return true;
+    }
+    bool start_array(std::size_t) override { return Fail("an array"); }
+    bool end_array() override { return true; }
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+      ORTX_CXX_API_THROW(std::string("[JsonVocab] ") + ex.what(), ORT_INVALID_ARGUMENT);
+    }
+
+   private:
+    bool Value(number_integer_t value) {
+      if (depth_ != 1) {
+        return Fail("an id");
+      }
+      if (value < INT32_MIN || value > INT32_MAX) {
+        return Fail("an id out of int32");
+      }
+      add_(std::string_view(key_), static_cast<int32_t>(value));
+      return true;
+    }
+
+    bool Fail(const char* what) {
+      ORTX_CXX_API_THROW(std::string("[JsonVocab] the vocabulary should map the tokens to their ids, but has ") +
+                             what + (depth_ == 0 ? " instead of the object." : " for the token " + key_ + "."),
+                         ORT_INVALID_ARGUMENT);
+    }
+
+    Add& add_;
+    std::string key_;
+    int depth_{};
+  };
+
+  Handler handler(add);
+  Json::sax_parse(json.begin(), json.end(), &handler);
+}
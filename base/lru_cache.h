@@ -0,0 +1,191 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "memory_budget.h"
+#include "runtime_stats.h"
+
+// A bounded, thread-safe least-recently-used cache.
+// A capacity of 0 disables the cache, and every lookup is counted as a miss.
+// The caches of a kind can add their hits, misses and entries to the runtime statistics of the process with
+// SetStatsName. The bytes of the entries are charged to the MemoryBudget of the process, which evicts the least
+// recently used entries of the least recently used caches when they're over its limit.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache : public ort_extensions::MemoryBudget::Consumer {
+ public:
+  explicit LruCache(size_t capacity = 0) : capacity_(capacity) {}
+
+  LruCache(const LruCache&) = delete;
+  LruCache& operator=(const LruCache&) = delete;
+
+  ~LruCache() override {
+    const size_t bytes = Unregister();
+    if (entries_stat_ != nullptr) {
+      entries_stat_->Add(-static_cast<int64_t>(entries_.size()));
+      bytes_stat_->Add(-static_cast<int64_t>(bytes));
+    }
+  }
+
+  // Counts the lookups, the entries and the bytes of the cache into the counters <name>.hits, <name>.misses,
+  // <name>.entries and <name>.bytes, which the caches of the same name share.
+  void SetStatsName(std::string_view name) {
+    auto& stats = ort_extensions::RuntimeStats::Instance();
+    std::string prefix(name);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_stat_ != nullptr) {
+      entries_stat_->Add(-static_cast<int64_t>(entries_.size()));
+      bytes_stat_->Add(-static_cast<int64_t>(Bytes()));
+    }
+    hits_stat_ = &stats.Counter(prefix + ".hits");
+    misses_stat_ = &stats.Counter(prefix + ".misses");
+    entries_stat_ = &stats.Counter(prefix + ".entries");
+    bytes_stat_ = &stats.Counter(prefix + ".bytes");
+    entries_stat_->Add(static_cast<int64_t>(entries_.size()));
+    bytes_stat_->Add(static_cast<int64_t>(Bytes()));
+  }
+
+  void SetCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = capacity;
+    Shrink();
+  }
+
+  size_t Capacity() const { return capacity_; }
+
+  // Copies the cached value into `value` and marks the entry as the most recently used.
+  bool Lookup(const Key& key, Value& value) {
+    if (capacity_ == 0) {
+      CountMiss();
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      CountMiss();
+      return false;
+    }
+
+    entries_.splice(entries_.begin(), entries_, it->second);
+    value = it->second->second;
+    Touch();
+    ++hits_;
+    if (hits_stat_ != nullptr) {
+      hits_stat_->Add();
+    }
+    return true;
+  }
+
+  void Insert(const Key& key, const Value& value) {
+    if (capacity_ == 0) {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = index_.find(key);
+      if (it != index_.end()) {
+        const int64_t previous = static_cast<int64_t>(EntryBytes(*it->second));
+        it->second->second = value;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        ChargeBytes(static_cast<int64_t>(EntryBytes(entries_.front())) - previous);
+        return;
+      }
+
+      entries_.emplace_front(key, value);
+      index_.emplace(entries_.front().first, entries_.begin());
+      if (entries_stat_ != nullptr) {
+        entries_stat_->Add();
+      }
+      ChargeBytes(static_cast<int64_t>(EntryBytes(entries_.front())));
+      Shrink();
+    }
+
+    // without the lock, which the release of this cache takes
+    ort_extensions::MemoryBudget::Instance().Reclaim();
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_stat_ != nullptr) {
+      entries_stat_->Add(-static_cast<int64_t>(entries_.size()));
+    }
+    ChargeBytes(-static_cast<int64_t>(Bytes()));
+    index_.clear();
+    entries_.clear();
+  }
+
+  // Evicts the least recently used entries until `bytes` of them are released, for the budget.
+  void Release(size_t bytes) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const size_t target = Bytes() > bytes ? Bytes() - bytes : 0;
+    while (!entries_.empty() && Bytes() > target) {
+      EvictLast();
+    }
+  }
+
+  size_t Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+  uint64_t Hits() const { return hits_; }
+  uint64_t Misses() const { return misses_; }
+
+ private:
+  void Shrink() {
+    while (entries_.size() > capacity_) {
+      EvictLast();
+    }
+  }
+
+  void EvictLast() {
+    ChargeBytes(-static_cast<int64_t>(EntryBytes(entries_.back())));
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+    if (entries_stat_ != nullptr) {
+      entries_stat_->Add(-1);
+    }
+  }
+
+  // the key and the value are in the list, and a copy of the key in the node of the index with the iterator
+  static size_t EntryBytes(const std::pair<Key, Value>& entry) {
+    return 2 * ort_extensions::ApproximateBytes(entry.first) + ort_extensions::ApproximateBytes(entry.second) +
+           5 * sizeof(void*);
+  }
+
+  void ChargeBytes(int64_t delta) {
+    Charge(delta);
+    if (bytes_stat_ != nullptr) {
+      bytes_stat_->Add(delta);
+    }
+  }
+
+  void CountMiss() {
+    ++misses_;
+    if (misses_stat_ != nullptr) {
+      misses_stat_->Add();
+    }
+  }
+
+  using Entries = std::list<std::pair<Key, Value>>;
+
+  std::atomic<size_t> capacity_;
+  Entries entries_;
+  std::unordered_map<Key, typename Entries::iterator, Hash> index_;
+  mutable std::mutex mutex_;
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+  ort_extensions::StatCounter* hits_stat_{};
+  ort_extensions::StatCounter* misses_stat_{};
+  ort_extensions::StatCounter* entries_stat_{};
+  ort_extensions::StatCounter* bytes_stat_{};
+};
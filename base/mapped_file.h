@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ort_extensions {
+
+// A read-only memory mapping of a whole file, so its bytes are read by the page faults of their first use
+// instead of being copied into a buffer first. An empty file has no mapping and its data is nullptr.
+class MappedFile {
+ public:
+  MappedFile() = default;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile() { Close(); }
+
+  // Maps the file, and returns false if it can't be opened or mapped.
+  bool Open(const std::string& path) {
+    Close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      return false;
+    }
+    LARGE_INTEGER file_size;
+    bool ok = GetFileSizeEx(file, &file_size) != 0;
+    if (ok && file_size.QuadPart > 0) {
+      HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      ok = mapping != nullptr;
+      if (ok) {
+        data_ = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        ok = data_ != nullptr;
+        CloseHandle(mapping);  // the view keeps the mapping
+      }
+      size_ = ok ? static_cast<size_t>(file_size.QuadPart) : 0;
+    }
+    CloseHandle(file);
+    return ok;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat st;
+    bool ok = fstat(fd, &st) == 0;
+    if (ok && st.st_size > 0) {
+      void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      ok = data != MAP_FAILED;
+      if (ok) {
+        data_ = static_cast<const uint8_t*>(data);
+        size_ = static_cast<size_t>(st.st_size);
+      }
+    }
+    close(fd);  // the mapping keeps the file
+    return ok;
+#endif
+  }
+
+  // Asks the OS to read the file ahead in the background, so its reading overlaps the work before its use.
+  void Prefetch() const {
+    if (data_ == nullptr) {
+      return;
+    }
+#ifdef _WIN32
+#if _WIN32_WINNT >= 0x0602  // Windows 8
+    WIN32_MEMORY_RANGE_ENTRY range{const_cast<uint8_t*>(data_), size_};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#endif
+#else
+    posix_madvise(const_cast<uint8_t*>(data_), size_, POSIX_MADV_WILLNEED);
+#endif
+  }
+
+  void Close() {
+    if (data_ != nullptr) {
+#ifdef _WIN32
+      UnmapViewOfFile(data_);
+#else
+      munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+    }
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  const uint8_t* Data() const { return data_; }
+  size_t Size() const { return size_; }
+
+ private:
+  const uint8_t* data_{};
+  size_t size_{};
+};
+
+}  // namespace ort_extensions
@@ -0,0 +1,218 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "runtime_stats.h"
+
+namespace ort_extensions {
+
+// The one bound of the memory of the caches and the scratch arenas of the process, whose kernels of all the sessions
+// share them. Every cache and arena is a Consumer of the budget, which it charges the bytes it holds, and when they
+// are over the limit the consumers are asked to release their memory, the least recently used consumer first, and
+// each of them its least recently used entries first. A limit of 0 is no bound, the default.
+// The bytes are counted in memory_budget.limit, memory_budget.bytes and memory_budget.released of the runtime
+// statistics.
+class MemoryBudget {
+ public:
+  class Consumer {
+   public:
+    Consumer() { Instance().Register(this); }
+    virtual ~Consumer() { Unregister(); }
+
+    Consumer(const Consumer&) = delete;
+    Consumer& operator=(const Consumer&) = delete;
+
+    // Releases at least `bytes` of the memory of the consumer if it has them, and charges the budget what it
+    // released. It's called by the budget without a lock the consumer takes, and the consumer must not reclaim the
+    // budget while it holds one of its own.
+    virtual void Release(size_t bytes) = 0;
+
+    size_t Bytes() const { return static_cast<size_t>(bytes_.load(std::memory_order_relaxed)); }
+
+   protected:
+    // Leaves the budget, after a reclaim which is releasing the consumer, and returns the bytes it held. The
+    // destructor of a consumer calls it before it destroys what Release reads.
+    size_t Unregister() {
+      if (!registered_) {
+        return 0;
+      }
+
+      registered_ = false;
+      return Instance().Unregister(this);
+    }
+
+    // Adds the change of the bytes of the consumer to the budget, and marks it as recently used.
+    void Charge(int64_t delta) {
+      bytes_.fetch_add(delta, std::memory_order_relaxed);
+      Instance().Add(delta);
+      last_use_.store(Instance().Tick(), std::memory_order_relaxed);
+    }
+
+    // Marks the consumer as recently used, like by a lookup of a cache.
+    void Touch() { last_use_.store(Instance().tick_.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+
+   private:
+    friend class MemoryBudget;
+
+    std::atomic<int64_t> bytes_{0};
+    std::atomic<uint64_t> last_use_{0};
+    bool registered_{true};
+  };
+
+  // The budget is never destroyed, so the arenas released at the exit of the threads can still update it.
+  static MemoryBudget& Instance() {
+    static MemoryBudget* budget = new MemoryBudget();
+    return *budget;
+  }
+
+  size_t Limit() const { return limit_.load(std::memory_order_relaxed); }
+  size_t Used() const { return static_cast<size_t>(std::max<int64_t>(used_.load(std::memory_order_relaxed), 0)); }
+
+  void SetLimit(size_t bytes) {
+    const int64_t previous = static_cast<int64_t>(limit_.exchange(bytes, std::memory_order_relaxed));
+    limit_stat_.Add(static_cast<int64_t>(bytes) - previous);
+    Reclaim();
+  }
+
+  // Makes the consumers release the memory over the limit, the least recently used first. A reclaim which is already
+  // running on another thread is left to finish it.
+  void Reclaim() {
+    const size_t limit = Limit();
+    if (limit == 0 || Used() <= limit) {
+      return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+      return;
+    }
+
+    std::vector<std::pair<uint64_t, Consumer*>> order;
+    order.reserve(consumers_.size());
+    for (Consumer* consumer : consumers_) {
+      if (consumer->Bytes() > 0) {
+        order.emplace_back(consumer->last_use_.load(std::memory_order_relaxed), consumer);
+      }
+    }
+
+    std::sort(order.begin(), order.end());
+    for (const auto& [last_use, consumer] : order) {
+      const size_t used = Used();
+      if (used <= limit) {
+        break;
+      }
+
+      const size_t before = consumer->Bytes();
+      consumer->Release(std::min(used - limit, before));
+      released_stat_.Add(static_cast<int64_t>(before) - static_cast<int64_t>(std::min(before, consumer->Bytes())));
+    }
+  }
+
+ private:
+  MemoryBudget()
+      : used_stat_(RuntimeStats::Instance().Counter("memory_budget.bytes")),
+        limit_stat_(RuntimeStats::Instance().Counter("memory_budget.limit")),
+        released_stat_(RuntimeStats::Instance().Counter("memory_budget.released")) {}
+
+  void Register(Consumer* consumer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    consumers_.push_back(consumer);
+  }
+
+  // waits for a reclaim which is running, so the consumer isn't released while it's destroyed
+  size_t Unregister(Consumer* consumer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    consumers_.erase(std::find(consumers_.begin(), consumers_.end(), consumer));
+    const int64_t bytes = consumer->bytes_.exchange(0, std::memory_order_relaxed);
+    Add(-bytes);
+    return static_cast<size_t>(bytes);
+  }
+
+  void Add(int64_t delta) {
+    used_.fetch_add(delta, std::memory_order_relaxed);
+    used_stat_.Add(delta);
+  }
+
+  // the inserts of the caches advance the tick, which the lookups only read
+  uint64_t Tick() { return tick_.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+  std::atomic<size_t> limit_{0};
+  std::atomic<int64_t> used_{0};
+  std::atomic<uint64_t> tick_{1};
+  StatCounter& used_stat_;
+  StatCounter& limit_stat_;
+  StatCounter& released_stat_;
+  std::mutex mutex_;
+  std::vector<Consumer*> consumers_;
+};
+
+// The approximate bytes a value holds, of itself and of its heap memory, which the caches charge the budget. A
+// type of other heap memory has a MemoryBytes() of it.
+template <typename T, typename = void>
+struct HasMemoryBytes : std::false_type {};
+
+template <typename T>
+struct HasMemoryBytes<T, std::void_t<decltype(std::declval<const T&>().MemoryBytes())>> : std::true_type {};
+
+template <typename T>
+size_t ApproximateBytes(const T& value);
+template <typename T, typename Traits, typename Allocator>
+size_t ApproximateBytes(const std::basic_string<T, Traits, Allocator>& value);
+template <typename T, typename Allocator>
+size_t ApproximateBytes(const std::vector<T, Allocator>& value);
+template <typename T>
+size_t ApproximateBytes(const std::shared_ptr<T>& value);
+template <typename First, typename Second>
+size_t ApproximateBytes(const std::pair<First, Second>& value);
+
+template <typename T, typename Traits, typename Allocator>
+size_t ApproximateBytes(const std::basic_string<T, Traits, Allocator>& value) {
+  // a short string is within the object
+  const size_t heap = (value.capacity() + 1) * sizeof(T);
+  return sizeof(value) + (heap > sizeof(value) ? heap : 0);
+}
+
+template <typename T, typename Allocator>
+size_t ApproximateBytes(const std::vector<T, Allocator>& value) {
+  size_t bytes = sizeof(value) + value.capacity() * sizeof(T);
+  if constexpr (!std::is_trivially_copyable_v<T>) {
+    for (const auto& item : value) {
+      bytes += ApproximateBytes(item) - sizeof(T);
+    }
+  }
+  return bytes;
+}
+
+template <typename T>
+size_t ApproximateBytes(const std::shared_ptr<T>& value) {
+  // with the control block of make_shared
+  return sizeof(value) + (value ? 2 * sizeof(void*) + ApproximateBytes(*value) : 0);
+}
+
+template <typename First, typename Second>
+size_t ApproximateBytes(const std::pair<First, Second>& value) {
+  return ApproximateBytes(value.first) + ApproximateBytes(value.second) + sizeof(value) - sizeof(First) -
+         sizeof(Second);
+}
+
+template <typename T>
+size_t ApproximateBytes(const T& value) {
+  if constexpr (HasMemoryBytes<T>::value) {
+    return value.MemoryBytes();
+  } else {
+    return sizeof(value);
+  }
+}
+
+}  // namespace ort_extensions
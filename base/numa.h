@@ -0,0 +1,195 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "runtime_stats.h"
+
+namespace ort_extensions {
+
+// The NUMA nodes of the machine and the node of each CPU, read from /sys/devices/system/node on Linux without
+// libnuma. Elsewhere, and on a machine of one node, every CPU is of node 0.
+class NumaTopology {
+ public:
+  static const NumaTopology& Instance() {
+    static const NumaTopology topology;
+    return topology;
+  }
+
+  size_t NodeCount() const { return node_count_; }
+
+  // The node of the CPU the calling thread runs on, an index in [0, NodeCount()).
+  size_t CurrentNode() const {
+#if defined(__linux__)
+    if (node_count_ > 1) {
+      const int cpu = sched_getcpu();
+      if (cpu >= 0 && static_cast<size_t>(cpu) < cpu_nodes_.size()) {
+        return cpu_nodes_[cpu];
+      }
+    }
+#endif
+    return 0;
+  }
+
+  // The copies of the read-only tables of the kernels on each node, which the ORTX_NUMA_REPLICAS environment
+  // variable of 1 enables on a machine of more than one node.
+  static bool ReplicasEnabled() {
+    static const bool enabled = [] {
+      const char* value = std::getenv("ORTX_NUMA_REPLICAS");
+      return value != nullptr && std::string_view(value) == "1" && Instance().NodeCount() > 1;
+    }();
+    return enabled;
+  }
+
+  // The numbers of a list of the sysfs like "0-3,8,10-11".
+  static std::vector<size_t> ParseList(std::string_view list) {
+    std::vector<size_t> numbers;
+    size_t pos = 0;
+    while (pos < list.size()) {
+      size_t end = list.find(',', pos);
+      if (end == std::string_view::npos) {
+        end = list.size();
+      }
+      const std::string range(list.substr(pos, end - pos));
+      pos = end + 1;
+      char* dash = nullptr;
+      const unsigned long first = std::strtoul(range.c_str(), &dash, 10);
+      if (dash == range.c_str()) {
+        continue;
+      }
+      const unsigned long last = *dash == '-' ? std::strtoul(dash + 1, nullptr, 10) : first;
+      for (unsigned long n = first; n <= last; ++n) {
+        numbers.push_back(n);
+      }
+    }
+    return numbers;
+  }
+
+ private:
+  NumaTopology() {
+#if defined(__linux__)
+    const std::string root = "/sys/devices/system/node/";
+    std::vector<size_t> nodes = ParseList(ReadLine(root + "online"));
+    for (size_t node : nodes) {
+      for (size_t cpu : ParseList(ReadLine(root + "node" + std::to_string(node) + "/cpulist"))) {
+        if (cpu >= cpu_nodes_.size()) {
+          cpu_nodes_.resize(cpu + 1, 0);
+        }
+        cpu_nodes_[cpu] = node_count_;
+      }
+      ++node_count_;
+    }
+#endif
+    if (node_count_ == 0) {
+      node_count_ = 1;
+    }
+  }
+
+  static std::string ReadLine(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+  }
+
+  size_t node_count_{};
+  std::vector<size_t> cpu_nodes_;  // the index of the node of each CPU
+};
+
+// The types whose copies are deep and read-only, which NumaReplicas copies onto the nodes.
+template <typename T>
+struct IsNumaReplicable : std::false_type {};
+
+// The copies on the NUMA nodes of a read-only object which many threads read, like the vocabulary of a tokenizer,
+// so the threads of a socket don't read the memory of another one. The copy of a node is made by the first thread
+// of the node which reads it, so the pages of the copy are first touched and placed on its node, and is shared by
+// all the holders of the same object, like the kernels of the sessions sharing a vocabulary by the SharedRegistry.
+// The copies are counted in numa_replicas of the runtime statistics.
+template <typename T>
+class NumaReplicas {
+ public:
+  NumaReplicas() : slots_(new std::atomic<const T*>[NumaTopology::Instance().NodeCount()]()) {}
+
+  NumaReplicas(const NumaReplicas&) = delete;
+  NumaReplicas& operator=(const NumaReplicas&) = delete;
+
+  // The copy of the primary on the node of the calling thread. The primary outlives the replicas object.
+  const T* Get(const std::shared_ptr<const T>& primary) const {
+    const size_t node = NumaTopology::Instance().CurrentNode();
+    const T* replica = slots_[node].load(std::memory_order_acquire);
+    if (replica != nullptr) {
+      return replica;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    replica = slots_[node].load(std::memory_order_relaxed);
+    if (replica == nullptr) {
+      held_.push_back(Registry::Instance().GetOrCopy(primary, node));
+      replica = held_.back().get();
+      slots_[node].store(replica, std::memory_order_release);
+    }
+    return replica;
+  }
+
+ private:
+  // the copies by their primaries, which live as long as their holders
+  class Registry {
+   public:
+    static Registry& Instance() {
+      static Registry* registry = new Registry();
+      return *registry;
+    }
+
+    std::shared_ptr<const T> GetOrCopy(const std::shared_ptr<const T>& primary, size_t node) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      Entry& entry = entries_[primary.get()];
+      // an entry of a primary which is freed is of the one allocated at its address since
+      if (entry.primary.lock() != primary) {
+        entry.primary = primary;
+        entry.replicas.assign(NumaTopology::Instance().NodeCount(), {});
+      }
+
+      std::shared_ptr<const T> replica = entry.replicas[node].lock();
+      if (replica == nullptr) {
+        replica = std::make_shared<const T>(*primary);
+        entry.replicas[node] = replica;
+        static auto& copies = RuntimeStats::Instance().Counter("numa_replicas");
+        copies.Add();
+      }
+
+      for (auto it = entries_.begin(); it != entries_.end();) {
+        it = it->second.primary.expired() ? entries_.erase(it) : std::next(it);
+      }
+      return replica;
+    }
+
+   private:
+    struct Entry {
+      std::weak_ptr<const T> primary;
+      std::vector<std::weak_ptr<const T>> replicas;
+    };
+
+    std::mutex mutex_;
+    std::unordered_map<const T*, Entry> entries_;
+  };
+
+  std::unique_ptr<std::atomic<const T*>[]> slots_;
+  mutable std::vector<std::shared_ptr<const T>> held_;
+  mutable std::mutex mutex_;
+};
+
+}  // namespace ort_extensions
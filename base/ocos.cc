@@ -3,6 +3,9 @@
 #include <sstream>
 #include "ocos.h"
 #include "narrow.h"
+#include "shared_kernels.h"
+
+using ort_extensions::KernelAttributes;
 
 OrtErrorCode BaseKernel::GetErrorCodeAndRelease(OrtStatusPtr status) const noexcept {
   if (status == nullptr) {
@@ -30,33 +33,78 @@ bool BaseKernel::TryToGetAttribute(const char* name, std::string& value) const n
   // The status should be a nullptr when querying for the size.
   if (status != nullptr) {
     api_.ReleaseStatus(status);
+    KernelAttributes::Record(name, KernelAttributes::Kind::kString, false, nullptr, 0);
     return false;
   }
 
   value.resize(size);
   status = api_.KernelInfoGetAttribute_string(&info_, name, &value[0], &size);
   if (GetErrorCodeAndRelease(status) != ORT_OK) {
+    KernelAttributes::Record(name, KernelAttributes::Kind::kString, false, nullptr, 0);
     return false;
   }
   value.resize(size - 1);
 
+  KernelAttributes::Record(name, KernelAttributes::Kind::kString, true, value.data(), value.size());
   return true;
 }
 
 template <>
 bool BaseKernel::TryToGetAttribute(const char* name, int64_t& value) const noexcept {
-  return GetErrorCodeAndRelease(api_.KernelInfoGetAttribute_int64(&info_, name, &value)) == ORT_OK;
+  const bool found = GetErrorCodeAndRelease(api_.KernelInfoGetAttribute_int64(&info_, name, &value)) == ORT_OK;
+  KernelAttributes::Record(name, KernelAttributes::Kind::kInt64, found, &value, sizeof(value));
+  return found;
 }
 
 template <>
 bool BaseKernel::TryToGetAttribute(const char* name, float& value) const noexcept {
-  return GetErrorCodeAndRelease(api_.KernelInfoGetAttribute_float(&info_, name, &value)) == ORT_OK;
+  const bool found = GetErrorCodeAndRelease(api_.KernelInfoGetAttribute_float(&info_, name, &value)) == ORT_OK;
+  KernelAttributes::Record(name, KernelAttributes::Kind::kFloat, found, &value, sizeof(value));
+  return found;
+}
+
+template <>
+bool BaseKernel::TryToGetAttribute(const char* name, std::vector<float>& value) const noexcept {
+  size_t size = 0;
+  OrtStatus* status = api_.KernelInfoGetAttributeArray_float(&info_, name, nullptr, &size);
+
+  // The status should be a nullptr when querying for the size.
+  if (status != nullptr) {
+    api_.ReleaseStatus(status);
+    KernelAttributes::Record(name, KernelAttributes::Kind::kFloats, false, nullptr, 0);
+    return false;
+  }
+
+  value.resize(size);
+  status = api_.KernelInfoGetAttributeArray_float(&info_, name, value.data(), &size);
+  const bool found = GetErrorCodeAndRelease(status) == ORT_OK;
+  KernelAttributes::Record(name, KernelAttributes::Kind::kFloats, found, value.data(), value.size() * sizeof(float));
+  return found;
+}
+
+template <>
+bool BaseKernel::TryToGetAttribute(const char* name, std::vector<int64_t>& value) const noexcept {
+  size_t size = 0;
+  OrtStatus* status = api_.KernelInfoGetAttributeArray_int64(&info_, name, nullptr, &size);
+
+  // The status should be a nullptr when querying for the size.
+  if (status != nullptr) {
+    api_.ReleaseStatus(status);
+    KernelAttributes::Record(name, KernelAttributes::Kind::kInt64s, false, nullptr, 0);
+    return false;
+  }
+
+  value.resize(size);
+  status = api_.KernelInfoGetAttributeArray_int64(&info_, name, value.data(), &size);
+  const bool found = GetErrorCodeAndRelease(status) == ORT_OK;
+  KernelAttributes::Record(name, KernelAttributes::Kind::kInt64s, found, value.data(), value.size() * sizeof(int64_t));
+  return found;
 }
 
 template <>
 bool BaseKernel::TryToGetAttribute(const char* name, int& value) const noexcept {
   int64_t origin_value = 0;
-  if (GetErrorCodeAndRelease(api_.KernelInfoGetAttribute_int64(&info_, name, &origin_value)) != ORT_OK) {
+  if (!TryToGetAttribute(name, origin_value)) {
     return false;
   }
 
@@ -67,10 +115,40 @@ bool BaseKernel::TryToGetAttribute(const char* name, int& value) const noexcept
 template <>
 bool BaseKernel::TryToGetAttribute(const char* name, bool& value) const noexcept {
   int64_t origin_value = 0;
-  if (GetErrorCodeAndRelease(api_.KernelInfoGetAttribute_int64(&info_, name, &origin_value)) != ORT_OK) {
+  if (!TryToGetAttribute(name, origin_value)) {
     return false;
   }
 
   value = origin_value == 1;
   return true;
 }
+
+bool ort_extensions::KernelAttributes::Matches(const OrtApi& api, const OrtKernelInfo& info) const {
+  // the attributes are read again by their kinds, as the kernel read them, and recorded into the replay
+  const BaseKernel reader(api, info);
+  KernelAttributes replay;
+  {
+    RecordScope scope(replay);
+    for (const Attribute& attribute : attributes_) {
+      const char* name = attribute.name.c_str();
+      if (attribute.kind == Kind::kString) {
+        std::string value;
+        reader.TryToGetAttribute(name, value);
+      } else if (attribute.kind == Kind::kInt64) {
+        int64_t value = 0;
+        reader.TryToGetAttribute(name, value);
+      } else if (attribute.kind == Kind::kFloat) {
+        float value = 0;
+        reader.TryToGetAttribute(name, value);
+      } else if (attribute.kind == Kind::kFloats) {
+        std::vector<float> value;
+        reader.TryToGetAttribute(name, value);
+      } else {
+        std::vector<int64_t> value;
+        reader.TryToGetAttribute(name, value);
+      }
+    }
+  }
+  return replay == *this;
+}
+
@@ -0,0 +1,229 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ocos.h"
+#include "run_cancellation.h"
+
+// Returns the number of threads for a num_threads attribute, in which 0 means all the hardware threads.
+inline size_t ResolveNumThreads(int64_t num_threads) {
+  if (num_threads > 0) {
+    return static_cast<size_t>(num_threads);
+  }
+  return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+// Returns the number of threads of the num_threads attribute of a kernel, 1 by default.
+inline size_t ReadNumThreadsAttribute(const BaseKernel& kernel) {
+  int64_t num_threads = kernel.TryToGetAttributeWithDefault<int64_t>("num_threads", 1);
+  if (num_threads < 0) {
+    ORTX_CXX_API_THROW("num_threads shouldn't be negative", ORT_INVALID_ARGUMENT);
+  }
+  return ResolveNumThreads(num_threads);
+}
+
+// The worker threads of the extensions, which run the parallel loops when ORT doesn't provide its own pool to the
+// kernels. The threads are started on the first use, one fewer than the hardware threads, and are never stopped,
+// so that no thread is joined while the library is unloaded. A loop may be run from any thread, a worker too,
+// since the calling thread always runs it and only waits for the workers which have joined it.
+class ExtensionThreadPool {
+ public:
+  static ExtensionThreadPool& Instance() {
+    static ExtensionThreadPool* pool = new ExtensionThreadPool(ResolveNumThreads(0) - 1);
+    return *pool;
+  }
+
+  size_t WorkerCount() const { return worker_count_; }
+
+  // Calls call(data) on the calling thread and on up to helpers idle workers, and returns after all of them.
+  // call mustn't throw.
+  void Run(size_t helpers, void (*call)(void*), void* data) {
+    Job job{call, data, std::min(helpers, worker_count_), 0};
+    if (job.slots > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      jobs_.push_back(&job);
+      job.slots == 1 ? work_cv_.notify_one() : work_cv_.notify_all();
+    }
+
+    call(data);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (job.slots > 0) {
+      jobs_.erase(std::find(jobs_.begin(), jobs_.end(), &job));  // no worker joins after the caller is done
+      job.slots = 0;
+    }
+    done_cv_.wait(lock, [&job]() { return job.active == 0; });
+  }
+
+ private:
+  struct Job {
+    void (*call)(void*);
+    void* data;
+    size_t slots;   // the number of the workers which may still join
+    size_t active;  // the number of the workers running it
+  };
+
+  explicit ExtensionThreadPool(size_t worker_count) : worker_count_(worker_count) {
+    for (size_t i = 0; i < worker_count_; ++i) {
+      std::thread([this]() { WorkerLoop(); }).detach();
+    }
+  }
+
+  void WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      work_cv_.wait(lock, [this]() { return !jobs_.empty(); });
+      Job* job = jobs_.front();
+      if (--job->slots == 0) {
+        jobs_.pop_front();
+      }
+      ++job->active;
+      lock.unlock();
+      job->call(job->data);
+      lock.lock();
+      if (--job->active == 0) {
+        done_cv_.notify_all();
+      }
+    }
+  }
+
+  const size_t worker_count_;
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  std::deque<Job*> jobs_;
+};
+
+namespace parallel_for_detail {
+
+// The blocks of a loop, which the threads claim one after another, so the long rows of a batch don't stall
+// the other threads. The first exception of fn stops the loop and is kept for the calling thread. The threads run
+// the blocks with the cancellation token of the calling thread, and a cancelled loop stops before its next block.
+template <typename Fn>
+class BlockLoop {
+ public:
+  BlockLoop(size_t num_tasks, size_t block_size, Fn& fn) : num_tasks_(num_tasks), block_size_(block_size), fn_(fn) {}
+
+  size_t BlockCount() const { return (num_tasks_ + block_size_ - 1) / block_size_; }
+
+  void RunBlock(size_t block) {
+    size_t begin = block * block_size_;
+    ort_extensions::RunCancellation::Scope cancellation(cancellation_);
+    Guard([&]() {
+      ort_extensions::RunCancellation::ThrowIfCancelled("ParallelFor");
+      fn_(begin, std::min(num_tasks_, begin + block_size_));
+    });
+  }
+
+  void RunAll() {
+    ort_extensions::RunCancellation::Scope cancellation(cancellation_);
+    Guard([&]() {
+      for (;;) {
+        size_t begin = next_.fetch_add(block_size_);
+        if (begin >= num_tasks_) {
+          break;
+        }
+        ort_extensions::RunCancellation::ThrowIfCancelled("ParallelFor");
+        fn_(begin, std::min(num_tasks_, begin + block_size_));
+      }
+    });
+  }
+
+  static void Call(void* loop) { static_cast<BlockLoop*>(loop)->RunAll(); }
+
+  void Rethrow() {
+#ifndef OCOS_NO_EXCEPTIONS
+    if (error_) {
+      std::rethrow_exception(error_);
+    }
+#endif
+  }
+
+ private:
+  template <typename Body>
+  void Guard(Body&& body) {
+    OCOS_TRY {
+      if (next_ < num_tasks_) {
+        body();
+      }
+    }
+    OCOS_CATCH(...) {
+      OCOS_HANDLE_EXCEPTION([&]() {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        if (!error_) {
+          error_ = std::current_exception();
+        }
+        next_ = num_tasks_;  // stop the other threads early
+      });
+    }
+  }
+
+  const size_t num_tasks_;
+  const size_t block_size_;
+  Fn& fn_;
+  const ort_extensions::RunCancellation::Token cancellation_{ort_extensions::RunCancellation::Current()};
+  std::atomic<size_t> next_{0};
+  std::exception_ptr error_;
+  std::mutex error_mutex_;
+};
+
+// Runs the blocks on the intra-op pool of ORT for the context, or on up to num_threads threads of the extensions.
+template <typename Fn>
+void RunBlocks(const Ort::Custom::ComputeContext& context, size_t num_tasks, size_t num_blocks, size_t num_threads,
+               Fn& fn) {
+  BlockLoop<Fn> loop(num_tasks, (num_tasks + num_blocks - 1) / num_blocks, fn);
+  auto run_block = [&loop](size_t block) { loop.RunBlock(block); };
+  if (!context.OrtParallelFor(loop.BlockCount(), run_block)) {
+    ExtensionThreadPool::Instance().Run(num_threads - 1, &BlockLoop<Fn>::Call, &loop);
+  }
+  loop.Rethrow();
+}
+
+}  // namespace parallel_for_detail
+
+// Calls fn(begin, end) on the blocks of [0, num_tasks), on up to num_threads threads including the calling one.
+// The loop runs on the intra-op thread pool of ORT when the kernel computing on this thread has one for the
+// custom ops, and on the threads of ExtensionThreadPool otherwise. fn must be safe to run concurrently on the
+// disjoint blocks, and the first exception it throws is rethrown here.
+template <typename Fn>
+void ParallelFor(size_t num_tasks, size_t num_threads, Fn&& fn) {
+  num_threads = std::min(num_threads, num_tasks);
+  if (num_threads <= 1) {
+    if (num_tasks > 0) {
+      fn(size_t{0}, num_tasks);
+    }
+    return;
+  }
+
+  // a few blocks per thread balance the load without much contention on the counter
+  parallel_for_detail::RunBlocks(Ort::Custom::ComputeContext::Current(), num_tasks,
+                                 std::min(num_tasks, num_threads * 4), num_threads, fn);
+}
+
+// The same as above on all the threads of the pool, in which cost is the rough number of the CPU cycles of one
+// task. The loop is split into the blocks which are worth a thread, so a cheap loop runs on the calling thread.
+template <typename Fn>
+void ParallelFor(const Ort::Custom::ComputeContext& context, size_t num_tasks, double cost, Fn&& fn) {
+  constexpr double kBlockCost = 50000;  // the cycles of a block, which is much more than the cost to hand it over
+  const size_t num_threads = ExtensionThreadPool::Instance().WorkerCount() + 1;
+  const double total_cost = std::max(cost, 0.0) * static_cast<double>(num_tasks);
+  const size_t num_blocks = std::min<double>({static_cast<double>(num_tasks), total_cost / kBlockCost,
+                                              static_cast<double>(num_threads * 4)});
+  if (num_blocks <= 1) {
+    if (num_tasks > 0) {
+      fn(size_t{0}, num_tasks);
+    }
+    return;
+  }
+
+  parallel_for_detail::RunBlocks(context, num_tasks, num_blocks, num_threads, fn);
+}
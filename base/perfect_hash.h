@@ -0,0 +1,205 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ocos.h"
+
+// A minimal perfect hash of a set of distinct strings, which maps each of them to its own index in [0, size()).
+// It's built the way of PTHash: the keys are hashed into the buckets of about 3 keys, and the buckets, the largest
+// first, look for a pilot which moves all their keys into the free slots. A lookup costs a hash, the pilot of its
+// bucket and one comparison, against the key of the slot, which is kept with all the others in one buffer in the
+// order of the indices, so a string which isn't a key is found to be so.
+class StringPerfectHash {
+ public:
+  static constexpr size_t kNotFound = static_cast<size_t>(-1);
+
+  // Builds the hash of the keys, which must be distinct, and returns the index of each of them.
+  std::vector<size_t> Build(const std::vector<std::string_view>& keys) {
+    std::vector<size_t> indices;
+    // a seed fails if two keys collide in the 64 bits of their hash, or a bucket has no pilot in the bound
+    for (uint64_t seed = 0; seed < kMaxSeeds; ++seed) {
+      if (TryBuild(keys, seed, indices)) {
+        size_t byte_count = 0;
+        for (const auto& key : keys) {
+          byte_count += key.size();
+        }
+
+        std::vector<size_t> key_of_index(keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+          key_of_index[indices[i]] = i;
+        }
+
+        keys_.clear();
+        keys_.reserve(byte_count);
+        offsets_.assign(1, 0);
+        offsets_.reserve(keys.size() + 1);
+        for (size_t key : key_of_index) {
+          keys_.append(keys[key]);
+          offsets_.push_back(keys_.size());
+        }
+        return indices;
+      }
+    }
+
+    ORTX_CXX_API_THROW("The keys of a perfect hash must be distinct.", ORT_INVALID_ARGUMENT);
+  }
+
+  // Returns the index of the key, or kNotFound if it isn't one of the keys.
+  size_t Find(std::string_view key) const {
+    if (pilots_.empty()) {
+      return kNotFound;
+    }
+
+    const uint64_t hash = Hash(key, seed_);
+    const size_t index = Slot(hash, pilots_[Bucket(hash)]);
+    return Key(index) == key ? index : kNotFound;
+  }
+
+  std::string_view Key(size_t index) const {
+    return std::string_view(keys_.data() + offsets_[index], offsets_[index + 1] - offsets_[index]);
+  }
+
+  size_t size() const { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+  bool empty() const { return size() == 0; }
+
+ private:
+  static constexpr uint64_t kMaxSeeds = 16;
+
+  // MurmurHash64A
+  static uint64_t Hash(std::string_view key, uint64_t seed) {
+    constexpr uint64_t m = 0xc6a4a7935bd1e995ULL;
+    constexpr int r = 47;
+    uint64_t h = seed ^ (key.size() * m);
+    const char* data = key.data();
+    const char* end = data + (key.size() & ~size_t{7});
+    for (; data != end; data += 8) {
+      uint64_t k;
+      std::memcpy(&k, data, sizeof(k));
+      k *= m;
+      k ^= k >> r;
+      k *= m;
+      h ^= k;
+      h *= m;
+    }
+
+    const size_t tail = key.size() & 7;
+    if (tail > 0) {
+      uint64_t k = 0;
+      for (size_t i = 0; i < tail; ++i) {
+        k |= static_cast<uint64_t>(static_cast<unsigned char>(data[i])) << (8 * i);
+      }
+      h ^= k;
+      h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+  }
+
+  // the finalizer of splitmix64
+  static uint64_t Mix(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+  }
+
+  size_t Bucket(uint64_t hash) const { return static_cast<size_t>((hash >> 32) % pilots_.size()); }
+
+  size_t Slot(uint64_t hash, uint32_t pilot) const {
+    return static_cast<size_t>(Mix(hash ^ Mix(pilot)) % (offsets_.size() - 1));
+  }
+
+  bool TryBuild(const std::vector<std::string_view>& keys, uint64_t seed, std::vector<size_t>& indices) {
+    const size_t key_count = keys.size();
+    seed_ = seed;
+    pilots_.assign(key_count == 0 ? 0 : key_count / 3 + 1, 0);
+    offsets_.assign(key_count + 1, 0);  // for size() in Slot, until the keys are set
+    indices.assign(key_count, 0);
+    if (key_count == 0) {
+      return true;
+    }
+
+    std::vector<uint64_t> hashes(key_count);
+    std::vector<size_t> bucket_begins(pilots_.size() + 1, 0);
+    for (size_t i = 0; i < key_count; ++i) {
+      hashes[i] = Hash(keys[i], seed);
+      ++bucket_begins[Bucket(hashes[i]) + 1];
+    }
+
+    size_t max_bucket_size = 0;
+    for (size_t b = 0; b < pilots_.size(); ++b) {
+      max_bucket_size = std::max(max_bucket_size, bucket_begins[b + 1]);
+      bucket_begins[b + 1] += bucket_begins[b];
+    }
+
+    std::vector<size_t> bucket_keys(key_count);
+    {
+      std::vector<size_t> next(bucket_begins.begin(), bucket_begins.end() - 1);
+      for (size_t i = 0; i < key_count; ++i) {
+        bucket_keys[next[Bucket(hashes[i])]++] = i;
+      }
+    }
+
+    // the buckets by their size, the largest first, as they're the hardest to place
+    std::vector<std::vector<size_t>> buckets_of_size(max_bucket_size + 1);
+    for (size_t b = 0; b < pilots_.size(); ++b) {
+      buckets_of_size[bucket_begins[b + 1] - bucket_begins[b]].push_back(b);
+    }
+
+    std::vector<bool> taken(key_count, false);
+    std::vector<size_t> slots(max_bucket_size);
+    const uint64_t max_pilot = std::min<uint64_t>(64 * static_cast<uint64_t>(key_count) + 1024, UINT32_MAX);
+    for (size_t size = max_bucket_size; size > 0; --size) {
+      for (size_t b : buckets_of_size[size]) {
+        const size_t* bucket = bucket_keys.data() + bucket_begins[b];
+        for (size_t i = 1; i < size; ++i) {
+          for (size_t j = 0; j < i; ++j) {
+            if (hashes[bucket[i]] == hashes[bucket[j]]) {
+              return false;
+            }
+          }
+        }
+
+        bool placed = false;
+        for (uint64_t pilot = 0; pilot < max_pilot && !placed; ++pilot) {
+          placed = true;
+          for (size_t i = 0; i < size && placed; ++i) {
+            slots[i] = Slot(hashes[bucket[i]], static_cast<uint32_t>(pilot));
+            placed = !taken[slots[i]] && std::find(slots.begin(), slots.begin() + i, slots[i]) == slots.begin() + i;
+          }
+
+          if (placed) {
+            pilots_[b] = static_cast<uint32_t>(pilot);
+            for (size_t i = 0; i < size; ++i) {
+              taken[slots[i]] = true;
+              indices[bucket[i]] = slots[i];
+            }
+          }
+        }
+
+        if (!placed) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  uint64_t seed_{};
+  std::vector<uint32_t> pilots_;  // one per bucket
+  std::string keys_;              // the bytes of the keys in the order of their indices
+  std::vector<size_t> offsets_;   // the offsets of the keys in keys_, and its size
+};
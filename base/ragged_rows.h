@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "exceptions.h"
+#include "string_utils.h"
+
+namespace ort_extensions {
+
+// The rows of a ragged tensor, which the kernels take and give as two tensors: the 1D values of all the rows one
+// after another, and the int64 row_splits of rows + 1, which go from 0 to the count of the values without
+// decreasing, so row i is the values in [row_splits[i], row_splits[i + 1]). It's the convention of the row_splits of
+// TensorFlow Text. An element-wise op, like StringLower or StringToVector, maps the values of a ragged tensor as any
+// 1D tensor, and its row_splits pass through unchanged to the next op, so only the last op of a graph, like
+// StringRaggedTensorToDense, pads the rows. The ops which split the rows give the row_splits of their values, like
+// the row_offsets of StringECMARegexSplitWithOffsets.
+class RowSplits {
+ public:
+  // The row splits of kExact cover all the values, and the ones of kWithin, of the RaggedTensorToDense ops, only a
+  // range of them, and they may be empty for no rows.
+  enum class Check { kExact, kWithin };
+
+  // Checks the row splits of the values of the op.
+  RowSplits(const char* op, const int64_t* splits, size_t count, size_t value_count, Check check = Check::kExact)
+      : splits_(splits), rows_(count > 0 ? count - 1 : 0) {
+    if (count == 0) {
+      if (check == Check::kExact) {
+        ORTX_CXX_API_THROW(MakeString("[", op, "]: row_splits must not be empty."), ORT_INVALID_ARGUMENT);
+      }
+      return;
+    }
+
+    for (size_t row = 0; row < rows_; ++row) {
+      if (splits[row] > splits[row + 1]) {
+        ORTX_CXX_API_THROW(MakeString("[", op, "]: row_splits must be non-decreasing, but ", splits[row],
+                                      " is followed by ", splits[row + 1], "."),
+                           ORT_INVALID_ARGUMENT);
+      }
+    }
+    if (check == Check::kExact && (splits[0] != 0 || splits[rows_] != static_cast<int64_t>(value_count))) {
+      ORTX_CXX_API_THROW(MakeString("[", op, "]: row_splits must go from 0 to the ", value_count,
+                                    " values, but go from ", splits[0], " to ", splits[rows_], "."),
+                         ORT_INVALID_ARGUMENT);
+    }
+    if (splits[0] < 0 || splits[rows_] > static_cast<int64_t>(value_count)) {
+      ORTX_CXX_API_THROW(MakeString("[", op, "]: row_splits must be in [0, ", value_count, "], but go from ",
+                                    splits[0], " to ", splits[rows_], "."),
+                         ORT_INVALID_ARGUMENT);
+    }
+  }
+
+  size_t Rows() const { return rows_; }
+  size_t Begin(size_t row) const { return static_cast<size_t>(splits_[row]); }
+  size_t End(size_t row) const { return static_cast<size_t>(splits_[row + 1]); }
+  size_t Length(size_t row) const { return End(row) - Begin(row); }
+
+  // The length of the longest row, the columns of the dense tensor of the rows.
+  size_t MaxLength() const {
+    size_t longest = 0;
+    for (size_t row = 0; row < rows_; ++row) {
+      longest = std::max(longest, Length(row));
+    }
+    return longest;
+  }
+
+ private:
+  const int64_t* splits_{};
+  size_t rows_{};
+};
+
+}  // namespace ort_extensions
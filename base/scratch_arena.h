@@ -0,0 +1,214 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "memory_budget.h"
+#include "numa.h"
+#include "runtime_stats.h"
+
+// A bump allocator of each thread for the temporaries of one piece of work, like tokenizing a row.
+// A ScratchScope marks the start of the work, and all the memory allocated from the arena within it is
+// given back at once when the scope ends, so the containers of ScratchAllocator cost no malloc and no free
+// after the first rows, and the threads of the kernels don't contend on the heap.
+// The containers must not outlive the scope which was active when they were created.
+// The blocks the arenas allocate are counted in scratch_arena.blocks of the runtime statistics, and the bytes they
+// hold in scratch_arena.bytes. The bytes are charged to the MemoryBudget of the process too, and an arena released by
+// the budget gives back all its blocks after the outermost scope of its thread instead of keeping kRetainedSize.
+class ScratchArena : public ort_extensions::MemoryBudget::Consumer {
+ public:
+  // The arena of this thread, or nullptr if no scope is active on it.
+  static ScratchArena* Current() {
+    ScratchArena& arena = ThreadLocal();
+    return arena.depth_ > 0 ? &arena : nullptr;
+  }
+
+  void* Allocate(size_t bytes, size_t alignment) {
+    uintptr_t top = (reinterpret_cast<uintptr_t>(top_) + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    if (top_ == nullptr || top + bytes > reinterpret_cast<uintptr_t>(end_)) {
+      top = reinterpret_cast<uintptr_t>(NewBlock(bytes + alignment));
+      top = (top + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    }
+    top_ = reinterpret_cast<char*>(top + bytes);
+    return reinterpret_cast<void*>(top);
+  }
+
+  // The most memory which the arena of a thread keeps after its outermost scope.
+  static constexpr size_t kRetainedSize = size_t(1) << 20;
+
+ private:
+  friend class ScratchScope;
+
+  struct Block {
+    std::unique_ptr<char[]> data;
+    size_t size;
+  };
+
+  static ScratchArena& ThreadLocal() {
+    thread_local ScratchArena arena;
+    return arena;
+  }
+
+  ScratchArena() = default;
+
+  ~ScratchArena() override {
+    Unregister();
+    for (const auto& b : blocks_) {
+      CountStats(-static_cast<int64_t>(b.size), 0);
+    }
+  }
+
+  // the blocks are only freed by the thread of the arena, at the end of its work
+  void Release(size_t /*bytes*/) override { released_.store(true, std::memory_order_relaxed); }
+
+  // adds the bytes and the blocks of an allocation of an arena to the statistics
+  static void CountStats(int64_t bytes, int64_t blocks) {
+    auto& stats = ort_extensions::RuntimeStats::Instance();
+    static ort_extensions::StatCounter& total_bytes = stats.Counter("scratch_arena.bytes");
+    static ort_extensions::StatCounter& total_blocks = stats.Counter("scratch_arena.blocks");
+    total_bytes.Add(bytes);
+    total_blocks.Add(blocks);
+  }
+
+  void CountBlock(int64_t bytes, int64_t blocks) {
+    CountStats(bytes, blocks);
+    Charge(bytes);
+  }
+
+  char* NewBlock(size_t min_size) {
+    if (blocks_.empty()) {
+      node_ = ort_extensions::NumaTopology::Instance().CurrentNode();
+    }
+    // the blocks double in size, so a thread only allocates a few of them for its largest work.
+    size_t size = std::max(min_size, blocks_.empty() ? kFirstBlockSize : blocks_[block_].size * 2);
+    block_ = blocks_.empty() ? 0 : block_ + 1;
+    if (block_ == blocks_.size() || blocks_[block_].size < min_size) {
+      blocks_.insert(blocks_.begin() + block_, Block{std::unique_ptr<char[]>(new char[size]), size});
+      CountBlock(static_cast<int64_t>(size), 1);
+    }
+    top_ = blocks_[block_].data.get();
+    end_ = top_ + blocks_[block_].size;
+    return top_;
+  }
+
+  // Restores the allocation position of a scope. After the outermost one, the blocks are replaced by one block
+  // of their total size up to kRetainedSize, so the next work of the same size fits in it, or are all freed if the
+  // budget released the arena or the thread moved to another NUMA node.
+  void Rewind(size_t block, char* top) {
+    if (depth_ == 0 && (released_.exchange(false, std::memory_order_relaxed) || MovedNode())) {
+      for (const auto& b : blocks_) {
+        CountBlock(-static_cast<int64_t>(b.size), 0);
+      }
+      blocks_.clear();
+      block = 0;
+      top = nullptr;
+    } else if (depth_ == 0 && (blocks_.size() > 1 || (!blocks_.empty() && blocks_[0].size > kRetainedSize))) {
+      size_t total = 0;
+      for (const auto& b : blocks_) {
+        total += b.size;
+      }
+      blocks_.clear();
+      const size_t retained = std::min(total, kRetainedSize);
+      CountBlock(static_cast<int64_t>(retained) - static_cast<int64_t>(total), 1);
+      total = retained;
+      blocks_.push_back(Block{std::unique_ptr<char[]>(new char[total]), total});
+      node_ = ort_extensions::NumaTopology::Instance().CurrentNode();
+      block = 0;
+      top = nullptr;
+    }
+
+    block_ = block;
+    top_ = top;
+    end_ = nullptr;
+    if (!blocks_.empty()) {
+      top_ = top != nullptr ? top : blocks_[block_].data.get();
+      end_ = blocks_[block_].data.get() + blocks_[block_].size;
+    }
+  }
+
+  // whether the thread runs on another NUMA node than the one of its blocks, with ORTX_NUMA_REPLICAS=1, whose
+  // blocks are then freed so the next ones are allocated on its node
+  bool MovedNode() const {
+    return ort_extensions::NumaTopology::ReplicasEnabled() && !blocks_.empty() &&
+           ort_extensions::NumaTopology::Instance().CurrentNode() != node_;
+  }
+
+  static constexpr size_t kFirstBlockSize = 64 * 1024;
+
+  std::vector<Block> blocks_;
+  size_t block_ = 0;  // the block being allocated from
+  char* top_ = nullptr;
+  char* end_ = nullptr;
+  int depth_ = 0;  // the number of the active scopes
+  std::atomic<bool> released_{false};
+  size_t node_ = 0;  // the NUMA node of the thread when it allocated the blocks
+};
+
+// Makes the arena of this thread active until the end of its life, and gives back what it allocated.
+// The scopes may be nested.
+class ScratchScope {
+ public:
+  ScratchScope() : arena_(ScratchArena::ThreadLocal()), block_(arena_.block_), top_(arena_.top_) {
+    ++arena_.depth_;
+  }
+
+  ~ScratchScope() {
+    --arena_.depth_;
+    arena_.Rewind(block_, top_);
+  }
+
+  ScratchScope(const ScratchScope&) = delete;
+  ScratchScope& operator=(const ScratchScope&) = delete;
+
+ private:
+  ScratchArena& arena_;
+  size_t block_;
+  char* top_;
+};
+
+// The allocator of the arena which is active when the allocator is created, or of the heap without one.
+// The memory from the arena is only freed by its scope.
+template <typename T>
+class ScratchAllocator {
+ public:
+  using value_type = T;
+
+  ScratchAllocator() noexcept : arena_(ScratchArena::Current()) {}
+
+  template <typename U>
+  ScratchAllocator(const ScratchAllocator<U>& other) noexcept : arena_(other.arena_) {}
+
+  T* allocate(size_t n) {
+    if (arena_ == nullptr) {
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* p, size_t) noexcept {
+    if (arena_ == nullptr) {
+      ::operator delete(p);
+    }
+  }
+
+  template <typename U>
+  bool operator==(const ScratchAllocator<U>& rhs) const noexcept { return arena_ == rhs.arena_; }
+  template <typename U>
+  bool operator!=(const ScratchAllocator<U>& rhs) const noexcept { return arena_ != rhs.arena_; }
+
+ private:
+  template <typename U>
+  friend class ScratchAllocator;
+
+  ScratchArena* arena_;
+};
+
+template <typename T>
+using ScratchVector = std::vector<T, ScratchAllocator<T>>;
@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "shared_kernels.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "asset_attribute.h"
+#include "mapped_file.h"
+
+namespace ort_extensions {
+
+std::shared_ptr<const MappedFile> KernelAttributes::MapAssetFile(const std::string& path) noexcept {
+  OCOS_TRY {
+    auto file = std::make_shared<MappedFile>();
+    if (file->Open(AssetBytes::ResolvePath(path))) {
+      return file;
+    }
+  }
+  OCOS_CATCH(...) {
+  }
+  return nullptr;
+}
+
+bool KernelAttributes::operator==(const KernelAttributes& rhs) const {
+  const auto same_file = [](const MappedFile* lhs, const MappedFile* rhs) {
+    if (lhs == nullptr || rhs == nullptr) {
+      return lhs == rhs;
+    }
+    return lhs->Size() == rhs->Size() &&
+           (lhs->Size() == 0 || std::memcmp(lhs->Data(), rhs->Data(), lhs->Size()) == 0);
+  };
+  return std::equal(attributes_.begin(), attributes_.end(), rhs.attributes_.begin(), rhs.attributes_.end(),
+                    [&](const Attribute& lhs, const Attribute& rhs) {
+                      return lhs.kind == rhs.kind && lhs.found == rhs.found && lhs.name == rhs.name &&
+                             lhs.value == rhs.value && same_file(lhs.file.get(), rhs.file.get());
+                    });
+}
+
+}  // namespace ort_extensions
@@ -0,0 +1,160 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "onnxruntime_c_api.h"
+#include "runtime_stats.h"
+
+namespace ort_extensions {
+
+class MappedFile;
+
+// The attributes which a kernel read from its OrtKernelInfo while it was constructed, each by its name, its type,
+// whether the node has it, and its value, which is compared byte for byte, as a hash of a vocab would let another
+// model share the kernel of a colliding one. ORT doesn't list the attributes of a node, so these are recorded by
+// the reads of BaseKernel, which are all the attributes the kernel depends on. The file of an attribute of a path,
+// like vocab_path, is mapped too, and its content compared, so a file which changed between two sessions isn't
+// read from the kernel of the old one.
+class KernelAttributes {
+ public:
+  enum class Kind : uint8_t { kString, kInt64, kFloat, kFloats, kInt64s };
+
+  // Records the attributes which are read on this thread while it's alive.
+  class RecordScope {
+   public:
+    explicit RecordScope(KernelAttributes& attributes) : previous_(Current()) { Current() = &attributes; }
+    ~RecordScope() { Current() = previous_; }
+
+    RecordScope(const RecordScope&) = delete;
+    RecordScope& operator=(const RecordScope&) = delete;
+
+   private:
+    KernelAttributes* previous_;
+  };
+
+  // Called by the reads of BaseKernel, in which data is the bytes of the value of an attribute it has.
+  static void Record(const char* name, Kind kind, bool found, const void* data, size_t bytes) {
+    KernelAttributes* attributes = Current();
+    if (attributes != nullptr) {
+      std::string value(static_cast<const char*>(data), found ? bytes : 0);
+      const std::string_view key(name);
+      constexpr std::string_view kPathSuffix = "_path";
+      std::shared_ptr<const MappedFile> file;
+      if (found && kind == Kind::kString && key.size() > kPathSuffix.size() &&
+          key.substr(key.size() - kPathSuffix.size()) == kPathSuffix) {
+        file = MapAssetFile(value);
+      }
+      attributes->attributes_.push_back({name, kind, found, std::move(value), std::move(file)});
+    }
+  }
+
+  // Whether the node of the info has the same values of the same attributes, which are read from it again.
+  bool Matches(const OrtApi& api, const OrtKernelInfo& info) const;
+
+  bool operator==(const KernelAttributes& rhs) const;
+
+ private:
+  struct Attribute {
+    std::string name;
+    Kind kind;
+    bool found;
+    std::string value;
+    std::shared_ptr<const MappedFile> file;  // of a path attribute, or null if it isn't one or can't be mapped
+  };
+
+  // Maps the asset file of the path as AssetBytes does, or returns null if it can't.
+  static std::shared_ptr<const MappedFile> MapAssetFile(const std::string& path) noexcept;
+
+  static KernelAttributes*& Current() {
+    thread_local KernelAttributes* attributes = nullptr;
+    return attributes;
+  }
+
+  std::vector<Attribute> attributes_;
+};
+
+// The kernels of the ops of CustomOp which the sessions share when the environment variable ORTX_SHARE_KERNELS is
+// 1, for the hosts which load the same model into many sessions: a kernel of the same op, execution provider and
+// attributes as a kernel which is alive is that kernel, so the sessions after the first one construct nothing,
+// and share the caches, the regexes and the tables of the kernel too. Only the kernels of the ops of
+// kShareableAcrossSessions are shared, which read their node only by the attributes of BaseKernel in their
+// constructors, and whose Compute is safe in the concurrent calls of any sessions, as it is in the concurrent Run
+// calls of one session. A kernel is freed with the last session which holds it. The kernels which are shared and
+// those which are constructed are counted in shared_kernels.hits and shared_kernels.misses of the runtime
+// statistics.
+template <typename CustomOp>
+class SharedKernels {
+ public:
+  static bool IsEnabled() {
+    static const bool enabled = [] {
+      const char* value = std::getenv("ORTX_SHARE_KERNELS");
+      return value != nullptr && std::string_view(value) == "1";
+    }();
+    return enabled;
+  }
+
+  static SharedKernels& Instance() {
+    static SharedKernels* kernels = new SharedKernels();
+    return *kernels;
+  }
+
+  // Returns the kernel of the node of the info, which is made by make() if no session holds one of the same
+  // attributes now.
+  template <typename Make>
+  std::shared_ptr<const CustomOp> GetOrCreate(std::string_view op_name, std::string_view ep, const OrtApi& api,
+                                              const OrtKernelInfo& info, Make&& make) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const Entry& entry : entries_) {
+        if (entry.op_name != op_name || entry.ep != ep) {
+          continue;
+        }
+        auto kernel = entry.kernel.lock();
+        if (kernel != nullptr && entry.attributes.Matches(api, info)) {
+          static auto& hits = RuntimeStats::Instance().Counter("shared_kernels.hits");
+          hits.Add();
+          return kernel;
+        }
+      }
+    }
+
+    // the kernel is constructed out of the lock, as the kernels of the other nodes of the sessions are
+    Entry entry{std::string(op_name), std::string(ep), {}, {}};
+    std::shared_ptr<const CustomOp> kernel;
+    {
+      KernelAttributes::RecordScope scope(entry.attributes);
+      kernel = make();
+    }
+    entry.kernel = kernel;
+    static auto& misses = RuntimeStats::Instance().Counter("shared_kernels.misses");
+    misses.Add();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      it = it->kernel.expired() ? entries_.erase(it) : std::next(it);
+    }
+    entries_.push_back(std::move(entry));
+    return kernel;
+  }
+
+ private:
+  struct Entry {
+    std::string op_name;
+    std::string ep;
+    KernelAttributes attributes;
+    std::weak_ptr<const CustomOp> kernel;
+  };
+
+  std::mutex mutex_;
+  std::vector<Entry> entries_;
+};
+
+}  // namespace ort_extensions
@@ -0,0 +1,148 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "runtime_stats.h"
+
+#ifdef ENABLE_TF_STRING
+#include "string_utils.h"
+#endif
+
+// A process-wide registry of the immutable objects which the kernels load from their attributes,
+// like the vocabularies of the tokenizers. The kernels of all the sessions which load the same payload
+// share one instance, which is freed with the last kernel holding it, so the memory and the loading time
+// scale with the number of the distinct models instead of the number of the sessions.
+// The payload is kept with the instance, until another one is loaded after the instance is freed, and compared
+// byte for byte, so two payloads of the same fingerprint never share an instance. The kernels which ask for a payload while another one loads it,
+// like the nodes of a session loaded in the background, wait for it.
+// The instances which are shared and those which are loaded are counted in shared_registry.hits and
+// shared_registry.misses of the runtime statistics.
+template <typename T>
+class SharedRegistry {
+ public:
+  static SharedRegistry& Instance() {
+    static SharedRegistry registry;
+    return registry;
+  }
+
+  // Returns the instance of the payload, which is made by load() if no kernel holds it now.
+  // The payload is all the attributes which the instance is loaded from.
+  template <typename Load>
+  std::shared_ptr<const T> GetOrLoad(std::initializer_list<std::string_view> payload, Load&& load) {
+    const Key key = MakeKey(payload);
+    std::promise<std::shared_ptr<const T>> loaded;
+    std::shared_future<std::shared_ptr<const T>> pending;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = instances_.find(key);
+      if (it != instances_.end()) {
+        if (auto instance = it->second.lock()) {
+          CountHit();
+          return instance;
+        }
+      }
+
+      // a payload which another kernel is loading now is waited for instead of loaded twice
+      auto loading = loading_.find(key);
+      if (loading != loading_.end()) {
+        pending = loading->second;
+      } else {
+        loading_.emplace(key, loaded.get_future().share());
+      }
+    }
+
+    if (pending.valid()) {
+      CountHit();
+      return pending.get();
+    }
+
+    // the loading is out of the lock, so the sessions of the different models are created in parallel.
+    std::shared_ptr<const T> instance;
+    try {
+      instance = load();
+    } catch (...) {
+      loaded.set_exception(std::current_exception());
+      std::lock_guard<std::mutex> lock(mutex_);
+      loading_.erase(key);
+      throw;
+    }
+    static auto& misses = ort_extensions::RuntimeStats::Instance().Counter("shared_registry.misses");
+    misses.Add();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      instances_[key] = instance;
+      loading_.erase(key);
+      RemoveExpired();
+    }
+    loaded.set_value(instance);
+    return instance;
+  }
+
+  // The number of the loaded instances which are still held by some kernels.
+  size_t Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (const auto& [key, instance] : instances_) {
+      count += instance.expired() ? 0 : 1;
+    }
+    return count;
+  }
+
+ private:
+  // the parts of the payload, each after its size, so the parts can't be shifted from one to another.
+  using Key = std::string;
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const { return static_cast<size_t>(Fingerprint(key)); }
+  };
+
+  static void CountHit() {
+    static auto& hits = ort_extensions::RuntimeStats::Instance().Counter("shared_registry.hits");
+    hits.Add();
+  }
+
+  static uint64_t Fingerprint(std::string_view data) {
+#ifdef ENABLE_TF_STRING
+    return Hash64Fast(data.data(), data.size());
+#else
+    return std::hash<std::string_view>{}(data);
+#endif
+  }
+
+  static Key MakeKey(std::initializer_list<std::string_view> payload) {
+    size_t size = 0;
+    for (std::string_view part : payload) {
+      size += sizeof(uint64_t) + part.size();
+    }
+
+    Key key;
+    key.reserve(size);
+    for (std::string_view part : payload) {
+      const uint64_t part_size = part.size();
+      key.append(reinterpret_cast<const char*>(&part_size), sizeof(part_size));
+      key.append(part.data(), part.size());
+    }
+    return key;
+  }
+
+  void RemoveExpired() {
+    for (auto it = instances_.begin(); it != instances_.end();) {
+      it = it->second.expired() ? instances_.erase(it) : std::next(it);
+    }
+  }
+
+  mutable std::mutex mutex_;
+  std::unordered_map<Key, std::weak_ptr<const T>, KeyHash> instances_;
+  std::unordered_map<Key, std::shared_future<std::shared_ptr<const T>>, KeyHash> loading_;
+};
@@ -54,15 +54,35 @@ std::string MakeString(const Args&... args) {
 
 std::vector<std::string_view> SplitString(const std::string_view& str, const std::string_view& seps, bool remove_empty_entries = false);
 
-bool IsCJK(char32_t c);
+// The categories of a character for the tokenizers, which are the bits of GetCharCategory.
+enum CharCategory : uint8_t {
+  kCharSpace = 1,
+  kCharPunct = 2,
+  kCharControl = 4,
+  kCharCJK = 8,
+  kCharAccent = 16,
+  kCharCategoryCount = 32,  // the number of the combinations of the bits
+};
+
+// Generated by tools/generate_unicode_category_table.py
+extern const uint8_t kCharCategoryBlockIndex[];
+extern const uint8_t kCharCategoryBlocks[];
+
+// Returns all the categories of the character with two lookups.
+inline uint8_t GetCharCategory(char32_t c) {
+  constexpr char32_t kTableLimit = 0x30000;  // the code points above it have no category
+  return c < kTableLimit ? kCharCategoryBlocks[(kCharCategoryBlockIndex[c >> 8] << 8) | (c & 0xFF)] : 0;
+}
+
+inline bool IsCJK(char32_t c) { return (GetCharCategory(c) & kCharCJK) != 0; }
 
-bool IsAccent(char32_t c);
+inline bool IsAccent(char32_t c) { return (GetCharCategory(c) & kCharAccent) != 0; }
 
-bool IsSpace(char32_t c);
+inline bool IsSpace(char32_t c) { return (GetCharCategory(c) & kCharSpace) != 0; }
 
-bool IsPunct(char32_t c);
+inline bool IsPunct(char32_t c) { return (GetCharCategory(c) & kCharPunct) != 0; }
 
-bool IsControl(char32_t c);
+inline bool IsControl(char32_t c) { return (GetCharCategory(c) & kCharControl) != 0; }
 
 char32_t ToLower(char32_t c);
 
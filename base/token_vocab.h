@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "huge_pages.h"
+
+// The vocabulary of a tokenizer, which keeps all the tokens in one contiguous buffer.
+// The ids index an array of the token entries, and the tokens are looked up in an open-addressing
+// table of the entry indices, so a vocabulary costs a few allocations instead of one per token.
+// The tokens are added while the vocabulary is loaded, and it is only read after that. The buffers of a big vocabulary
+// are of the huge pages of ORTX_HUGE_PAGES, see base/huge_pages.h.
+class TokenVocab {
+ public:
+  static constexpr int32_t kInvalidId = -1;
+
+  void Reserve(size_t token_count, size_t byte_count) {
+    entries_.reserve(token_count);
+    tokens_.reserve(byte_count);
+  }
+
+  // Maps the token to the id and the id to the token like a map assignment, so the last one wins for both.
+  void Add(std::string_view token, int32_t id) {
+    if (id < 0) {
+      return;
+    }
+
+    if ((entries_.size() + 1) * 2 > slots_.size()) {
+      Rehash(slots_.empty() ? 1024 : slots_.size() * 2);
+    }
+
+    int32_t& slot = slots_[Probe(token)];
+    if (slot == kInvalidId) {
+      slot = static_cast<int32_t>(entries_.size());
+      entries_.push_back(Entry{static_cast<uint32_t>(tokens_.size()), static_cast<uint32_t>(token.size()), id});
+      tokens_.append(token);
+    } else {
+      entries_[slot].id = id;
+    }
+
+    if (static_cast<size_t>(id) >= id_entries_.size()) {
+      id_entries_.resize(static_cast<size_t>(id) + 1, kInvalidId);
+    }
+    id_entries_[id] = slot;
+  }
+
+  // Returns the id of the token, or kInvalidId if it isn't in the vocabulary.
+  int32_t Find(std::string_view token) const {
+    if (slots_.empty()) {
+      return kInvalidId;
+    }
+    int32_t slot = slots_[Probe(token)];
+    return slot == kInvalidId ? kInvalidId : entries_[slot].id;
+  }
+
+  bool Contains(std::string_view token) const { return Find(token) != kInvalidId; }
+
+  bool HasId(int64_t id) const {
+    return id >= 0 && static_cast<size_t>(id) < id_entries_.size() && id_entries_[id] != kInvalidId;
+  }
+
+  // Returns the token of the id, which is empty if no token has the id.
+  std::string_view Token(int64_t id) const { return HasId(id) ? TokenOf(entries_[id_entries_[id]]) : std::string_view(); }
+
+  // The number of the distinct tokens.
+  size_t size() const { return entries_.size(); }
+  bool empty() const { return entries_.empty(); }
+
+  // One past the largest id.
+  size_t IdLimit() const { return id_entries_.size(); }
+
+  void ShrinkToFit() {
+    entries_.shrink_to_fit();
+    tokens_.shrink_to_fit();
+    id_entries_.shrink_to_fit();
+  }
+
+  // Iterates over the (token, id) pairs in the order the tokens were added.
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::pair<std::string_view, int32_t>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = value_type;
+
+    const_iterator(const TokenVocab* vocab, size_t index) : vocab_(vocab), index_(index) {}
+
+    value_type operator*() const {
+      const Entry& entry = vocab_->entries_[index_];
+      return {vocab_->TokenOf(entry), entry.id};
+    }
+    const_iterator& operator++() {
+      ++index_;
+      return *this;
+    }
+    bool operator==(const const_iterator& rhs) const { return index_ == rhs.index_; }
+    bool operator!=(const const_iterator& rhs) const { return index_ != rhs.index_; }
+
+   private:
+    const TokenVocab* vocab_;
+    size_t index_;
+  };
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, entries_.size()); }
+
+ private:
+  struct Entry {
+    uint32_t offset;  // the token in tokens_
+    uint32_t length;
+    int32_t id;
+  };
+
+  std::string_view TokenOf(const Entry& entry) const {
+    return std::string_view(tokens_.data() + entry.offset, entry.length);
+  }
+
+  // returns the slot of the token, or the empty slot where it should be inserted.
+  size_t Probe(std::string_view token) const {
+    size_t mask = slots_.size() - 1;
+    size_t i = std::hash<std::string_view>{}(token) & mask;
+    while (slots_[i] != kInvalidId && TokenOf(entries_[slots_[i]]) != token) {
+      i = (i + 1) & mask;
+    }
+    return i;
+  }
+
+  void Rehash(size_t capacity) {
+    slots_.assign(capacity, kInvalidId);
+    for (size_t entry = 0; entry < entries_.size(); ++entry) {
+      slots_[Probe(TokenOf(entries_[entry]))] = static_cast<int32_t>(entry);
+    }
+  }
+
+  ort_extensions::HugePageString tokens_;               // the bytes of all the tokens
+  ort_extensions::HugePageVector<Entry> entries_;       // one per distinct token
+  ort_extensions::HugePageVector<int32_t> id_entries_;  // the entry of every id, or kInvalidId
+  ort_extensions::HugePageVector<int32_t> slots_;       // the entries in the hash order, a power of 2 in size
+};
@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+// ORTX_TRACE_SCOPE("GPT2Tokenizer.bpe") times the rest of the block it's in, as an event of the Chrome trace file
+// of the ORTX_TRACE_FILE environment variable, which chrome://tracing and Perfetto open. The scopes are compiled
+// out unless the build defines ENABLE_TRACING, by the OCOS_ENABLE_TRACING option, and they only read the clock
+// when the file is open. The name must be a string literal.
+#ifdef ENABLE_TRACING
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+
+namespace ort_extensions {
+
+class TraceWriter {
+ public:
+  static TraceWriter& Instance() {
+    static TraceWriter writer;
+    return writer;
+  }
+
+  bool IsEnabled() const { return file_ != nullptr; }
+
+  // The microseconds since the writer was created.
+  int64_t Now() const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_).count();
+  }
+
+  // Writes a complete event of the name, which began at begin and lasted duration microseconds on this thread.
+  void Write(const char* name, int64_t begin, int64_t duration) {
+    static std::atomic<int> next_thread_id{0};
+    thread_local const int thread_id = next_thread_id++;
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::fprintf(file_, "%s{\"name\":\"%s\",\"cat\":\"ortx\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":0,\"tid\":%d}",
+                 first_ ? "" : ",\n", name, static_cast<long long>(begin), static_cast<long long>(duration),
+                 thread_id);
+    first_ = false;
+  }
+
+  TraceWriter(const TraceWriter&) = delete;
+  TraceWriter& operator=(const TraceWriter&) = delete;
+
+ private:
+  TraceWriter() : start_(std::chrono::steady_clock::now()) {
+    const char* path = std::getenv("ORTX_TRACE_FILE");
+    if (path != nullptr && *path != '\0') {
+      file_ = std::fopen(path, "w");
+    }
+    if (file_ != nullptr) {
+      std::fputs("[\n", file_);
+    }
+  }
+
+  ~TraceWriter() {
+    if (file_ != nullptr) {
+      std::fputs("\n]\n", file_);
+      std::fclose(file_);
+    }
+  }
+
+  std::FILE* file_{};
+  std::chrono::steady_clock::time_point start_;
+  std::mutex mutex_;
+  bool first_{true};
+};
+
+class TraceScope {
+ public:
+  explicit TraceScope(const char* name) {
+    TraceWriter& writer = TraceWriter::Instance();
+    if (writer.IsEnabled()) {
+      name_ = name;
+      begin_ = writer.Now();
+    }
+  }
+
+  ~TraceScope() {
+    if (name_ != nullptr) {
+      TraceWriter& writer = TraceWriter::Instance();
+      writer.Write(name_, begin_, writer.Now() - begin_);
+    }
+  }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+ private:
+  const char* name_{};
+  int64_t begin_{};
+};
+
+}  // namespace ort_extensions
+
+#define ORTX_TRACE_CONCAT_IMPL(a, b) a##b
+#define ORTX_TRACE_CONCAT(a, b) ORTX_TRACE_CONCAT_IMPL(a, b)
+#define ORTX_TRACE_SCOPE(name) ::ort_extensions::TraceScope ORTX_TRACE_CONCAT(ortx_trace_scope_, __LINE__)(name)
+
+#else
+
+#define ORTX_TRACE_SCOPE(name) ((void)0)
+
+#endif  // ENABLE_TRACING
@@ -0,0 +1,196 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "unicode_normalization.h"
+#include "ustring.h"
+
+#include <algorithm>
+
+namespace {
+
+// the algorithmic decomposition and composition of the Hangul syllables of the standard
+constexpr char32_t kHangulSBase = 0xAC00;
+constexpr char32_t kHangulLBase = 0x1100;
+constexpr char32_t kHangulVBase = 0x1161;
+constexpr char32_t kHangulTBase = 0x11A7;
+constexpr char32_t kHangulLCount = 19;
+constexpr char32_t kHangulVCount = 21;
+constexpr char32_t kHangulTCount = 28;
+constexpr char32_t kHangulNCount = kHangulVCount * kHangulTCount;
+constexpr char32_t kHangulSCount = kHangulLCount * kHangulNCount;
+
+bool IsCompatibility(NormalizationForm form) {
+  return form == NormalizationForm::kNFKC || form == NormalizationForm::kNFKD;
+}
+
+bool IsComposed(NormalizationForm form) {
+  return form == NormalizationForm::kNFC || form == NormalizationForm::kNFKC;
+}
+
+// the bits of the info of a code point for which the quick check of the form isn't "Yes"
+uint16_t QuickCheckMask(NormalizationForm form) {
+  switch (form) {
+    case NormalizationForm::kNFC:
+      return kNfcNo | kNfcMaybe;
+    case NormalizationForm::kNFD:
+      return kNfdNo;
+    case NormalizationForm::kNFKC:
+      return kNfkcNo | kNfkcMaybe;
+    default:
+      return kNfkdNo;
+  }
+}
+
+uint8_t CombiningClass(char32_t c) { return static_cast<uint8_t>(GetNormalizationInfo(c) & kCombiningClassMask); }
+
+void Decompose(char32_t c, bool compatibility, std::u32string& output) {
+  const uint16_t info = GetNormalizationInfo(c);
+  if ((info & (compatibility ? kNfkdNo : kNfdNo)) == 0) {
+    output.push_back(c);
+    return;
+  }
+
+  if (c >= kHangulSBase && c < kHangulSBase + kHangulSCount) {
+    const char32_t index = c - kHangulSBase;
+    output.push_back(kHangulLBase + index / kHangulNCount);
+    output.push_back(kHangulVBase + (index % kHangulNCount) / kHangulTCount);
+    if (index % kHangulTCount != 0) {
+      output.push_back(kHangulTBase + index % kHangulTCount);
+    }
+    return;
+  }
+
+  const char32_t* end = kDecompositionCodePoints + kDecompositionCount;
+  const char32_t* it = std::lower_bound(kDecompositionCodePoints, end, c);
+  const size_t entry = static_cast<size_t>(it - kDecompositionCodePoints);
+  uint32_t slice = compatibility ? kCompatibilityDecompositions[entry] : kCanonicalDecompositions[entry];
+  output.append(kDecompositionPool + (slice >> 8), slice & 0xFF);
+}
+
+// Sorts each run of the non-starters by their combining classes, which keeps the order of the ones of a class.
+void ReorderCombiningMarks(std::u32string& chars) {
+  for (size_t i = 1; i < chars.size(); ++i) {
+    const char32_t c = chars[i];
+    const uint8_t ccc = CombiningClass(c);
+    if (ccc == 0) {
+      continue;
+    }
+    size_t j = i;
+    for (; j > 0 && CombiningClass(chars[j - 1]) > ccc; --j) {
+      chars[j] = chars[j - 1];
+    }
+    chars[j] = c;
+  }
+}
+
+// Returns the primary composite of the pair, or 0 if it has none.
+char32_t Compose(char32_t first, char32_t second) {
+  if (first >= kHangulLBase && first < kHangulLBase + kHangulLCount && second >= kHangulVBase &&
+      second < kHangulVBase + kHangulVCount) {
+    return kHangulSBase + ((first - kHangulLBase) * kHangulVCount + (second - kHangulVBase)) * kHangulTCount;
+  }
+  if (first >= kHangulSBase && first < kHangulSBase + kHangulSCount && (first - kHangulSBase) % kHangulTCount == 0 &&
+      second > kHangulTBase && second < kHangulTBase + kHangulTCount) {
+    return first + (second - kHangulTBase);
+  }
+
+  const uint64_t key = (static_cast<uint64_t>(first) << 21) | second;
+  const uint64_t* end = kCompositionPairs + kCompositionCount;
+  const uint64_t* it = std::lower_bound(kCompositionPairs, end, key);
+  return it != end && *it == key ? kCompositions[it - kCompositionPairs] : 0;
+}
+
+// Composes the canonically ordered characters in place: a character is composed with the last starter before it
+// unless a character between them has the class 0 or one not less than its own.
+void ComposeInPlace(std::u32string& chars) {
+  constexpr size_t kNoStarter = static_cast<size_t>(-1);
+  size_t starter = kNoStarter;
+  uint8_t last_ccc = 0;
+  size_t length = 0;
+  for (char32_t c : chars) {
+    const uint8_t ccc = CombiningClass(c);
+    if (starter != kNoStarter && (length == starter + 1 || (last_ccc != 0 && last_ccc < ccc))) {
+      const char32_t composite = Compose(chars[starter], c);
+      if (composite != 0) {
+        chars[starter] = composite;
+        continue;
+      }
+    }
+    if (ccc == 0) {
+      starter = length;
+    }
+    last_ccc = ccc;
+    chars[length++] = c;
+  }
+  chars.resize(length);
+}
+
+}  // namespace
+
+bool ParseNormalizationForm(std::string_view name, NormalizationForm& form) {
+  if (name == "NFC") {
+    form = NormalizationForm::kNFC;
+  } else if (name == "NFD") {
+    form = NormalizationForm::kNFD;
+  } else if (name == "NFKC") {
+    form = NormalizationForm::kNFKC;
+  } else if (name == "NFKD") {
+    form = NormalizationForm::kNFKD;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+size_t NormalizedPrefixLength(std::string_view text, NormalizationForm form) {
+  const uint16_t mask = QuickCheckMask(form);
+  size_t last_starter = 0;  // of the characters of "Yes", from which the text is normalized if the check fails
+  uint8_t last_ccc = 0;
+  for (size_t pos = 0; pos < text.size();) {
+    if (static_cast<unsigned char>(text[pos]) < 0x80) {
+      // the ASCII characters are starters of "Yes" in all the forms
+      pos += ustring::CountAsciiPrefix(text.data() + pos, text.size() - pos);
+      last_starter = pos - 1;
+      last_ccc = 0;
+      continue;
+    }
+
+    size_t len = 0;
+    const char32_t c = ustring::DecodeUTF8Char(text, pos, len);
+    const uint16_t info = GetNormalizationInfo(c);
+    const uint8_t ccc = static_cast<uint8_t>(info & kCombiningClassMask);
+    if ((info & mask) != 0 || (ccc != 0 && last_ccc > ccc)) {
+      return last_starter;
+    }
+    if (ccc == 0) {
+      last_starter = pos;
+    }
+    last_ccc = ccc;
+    pos += len;
+  }
+  return text.size();
+}
+
+bool NormalizeUtf8(std::string_view text, NormalizationForm form, std::string& output) {
+  const size_t prefix = NormalizedPrefixLength(text, form);
+  output.append(text.data(), prefix);
+  if (prefix == text.size()) {
+    return false;
+  }
+
+  const ustring chars(text.substr(prefix));
+  std::u32string normalized;
+  normalized.reserve(chars.size() + chars.size() / 2);
+  for (char32_t c : chars) {
+    Decompose(c, IsCompatibility(form), normalized);
+  }
+  ReorderCombiningMarks(normalized);
+  if (IsComposed(form)) {
+    ComposeInPlace(normalized);
+  }
+
+  const size_t begin = output.size();
+  output.resize(begin + ustring::UTF8Length(normalized));
+  ustring::EncodeUTF8(normalized, &output[begin]);
+  return true;
+}
@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// The Unicode normalization forms of UAX #15.
+enum class NormalizationForm { kNFC, kNFD, kNFKC, kNFKD };
+
+// Parses "NFC", "NFD", "NFKC" or "NFKD", and returns false for any other name.
+bool ParseNormalizationForm(std::string_view name, NormalizationForm& form);
+
+// The info of a code point: its canonical combining class in the low byte, and the bits of the quick check of the
+// forms, which are set for "No" and "Maybe", in the high byte.
+enum NormalizationInfo : uint16_t {
+  kCombiningClassMask = 0xFF,
+  kNfdNo = 1 << 8,
+  kNfkdNo = 1 << 9,
+  kNfcNo = 1 << 10,
+  kNfcMaybe = 1 << 11,
+  kNfkcNo = 1 << 12,
+  kNfkcMaybe = 1 << 13,
+};
+
+// Generated by tools/generate_unicode_normalization_table.py
+extern const uint8_t kNormalizationInfoBlockIndex[];
+extern const uint16_t kNormalizationInfoBlocks[];
+extern const size_t kDecompositionCount;
+extern const char32_t kDecompositionCodePoints[];
+extern const uint32_t kCanonicalDecompositions[];
+extern const uint32_t kCompatibilityDecompositions[];
+extern const char32_t kDecompositionPool[];
+extern const size_t kCompositionCount;
+extern const uint64_t kCompositionPairs[];
+extern const char32_t kCompositions[];
+
+inline uint16_t GetNormalizationInfo(char32_t c) {
+  constexpr char32_t kCodePointLimit = 0x110000;
+  return c < kCodePointLimit ? kNormalizationInfoBlocks[(kNormalizationInfoBlockIndex[c >> 7] << 7) | (c & 0x7F)]
+                             : 0;
+}
+
+// Returns the length of the prefix of the UTF-8 text which is already in the form by the quick check of UAX #15,
+// which is the whole text for the most of the texts: the ASCII characters are skipped 16 bytes at a time, and any
+// other one is checked with one lookup. The text is only normalized after the last starter of the prefix.
+size_t NormalizedPrefixLength(std::string_view text, NormalizationForm form);
+
+// Appends the text in the form to output, and returns false if the text is already in it, which is appended as it
+// is, without decoding it. The ill-formed sequences of the part which is normalized are replaced by U+FFFD.
+bool NormalizeUtf8(std::string_view text, NormalizationForm form, std::string& output);
+
+inline std::string NormalizeUtf8(std::string_view text, NormalizationForm form) {
+  std::string output;
+  NormalizeUtf8(text, form, output);
+  return output;
+}
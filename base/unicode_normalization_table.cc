@@ -0,0 +1,4238 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Generated by tools/generate_unicode_normalization_table.py with Unicode 14.0.0, don't edit it.
+
+#include "unicode_normalization.h"
+
+// the block of every 128 code points in kNormalizationInfoBlocks
+const uint8_t kNormalizationInfoBlockIndex[8704] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 36, 37,
+    0, 38, 39, 0, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 0, 59, 60, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 61, 62, 0, 0, 63, 64, 65, 66, 0, 67, 68, 69,
+    70, 71, 72, 73, 74, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 76, 77, 78,
+    79, 80, 81, 82, 0, 83, 84, 85, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 86,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 87, 87, 88, 89, 90, 91, 68, 68, 92, 93, 94, 95, 96, 97,
+    0, 0, 0, 98, 0, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 101,
+    0, 0, 0, 0, 102, 103, 0, 0, 0, 0, 104, 0, 0, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 0, 115, 116, 0, 117, 118, 119, 120, 0,
+    121, 0, 122, 123, 124, 125, 0, 0, 118, 0, 126, 127, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 128, 129, 0, 0, 0, 0, 0, 0, 0, 0, 130,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 132, 133, 134, 0, 0, 0, 135, 136, 137, 68, 68, 138, 68, 139,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    140, 0, 129, 0, 0, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 142, 143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 145, 0, 0,
+    0, 0, 146, 147, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 149, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    87, 87, 87, 87, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+// the NormalizationInfo of the code points of every distinct block
+const uint16_t kNormalizationInfoBlocks[19328] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 4608, 0, 0, 0, 0, 4608,
+    0, 0, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608, 0, 4608, 4608, 4608, 0,
+    768, 768, 768, 768, 768, 768, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    0, 768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 0, 0,
+    768, 768, 768, 768, 768, 768, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    0, 768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 0, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 0, 4608, 4608, 768, 768, 768, 768, 0, 768, 768, 768, 768, 768, 768, 4608,
+    4608, 0, 0, 768, 768, 768, 768, 768, 768, 4608, 0, 0, 768, 768, 768, 768,
+    768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 4608,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768,
+    768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 768, 768,
+    768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 4608, 4608, 4608, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 768, 768,
+    0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10470, 10470, 10470, 10470, 10470, 230, 10470, 10470, 10470, 10470, 10470, 10470, 10470, 230, 230, 10470,
+    230, 10470, 230, 10470, 10470, 232, 220, 220, 220, 220, 232, 10456, 220, 220, 220, 220,
+    220, 202, 202, 10460, 10460, 10460, 10460, 10442, 10442, 220, 220, 220, 220, 10460, 10460, 220,
+    10460, 10460, 220, 220, 1, 1, 1, 1, 10241, 220, 220, 220, 220, 230, 230, 230,
+    6118, 6118, 10470, 6118, 6118, 10480, 230, 220, 220, 220, 230, 230, 230, 220, 220, 0,
+    230, 230, 230, 220, 220, 220, 220, 230, 232, 220, 220, 230, 233, 234, 234, 233,
+    234, 234, 233, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 5888, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 5888, 0,
+    0, 0, 0, 0, 4608, 4864, 768, 5888, 768, 768, 768, 0, 768, 0, 768, 768,
+    768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768,
+    768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 0,
+    4608, 4608, 4608, 4864, 4864, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 0, 4608, 4608, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0,
+    768, 768, 0, 768, 0, 0, 0, 768, 0, 0, 0, 0, 768, 768, 768, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    768, 768, 0, 768, 0, 0, 0, 768, 0, 0, 0, 0, 768, 768, 768, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    768, 768, 768, 768, 0, 0, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768,
+    0, 0, 768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 230, 230, 230, 230, 220, 230, 230, 230, 222, 220, 230, 230, 230, 230,
+    230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 230, 230, 222, 228, 230,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 0, 23,
+    0, 24, 25, 0, 230, 220, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230, 30, 31, 32, 0, 0, 0, 0, 0,
+    0, 0, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31,
+    32, 33, 34, 10470, 10470, 10460, 220, 230, 230, 230, 230, 230, 220, 230, 230, 220,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    35, 0, 0, 0, 0, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    768, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 768, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230,
+    230, 230, 230, 220, 230, 0, 0, 230, 230, 0, 220, 230, 230, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 220, 230, 230, 220, 230, 230, 220, 220, 220, 230, 220, 220, 230, 220, 230,
+    230, 230, 220, 230, 220, 230, 220, 230, 220, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230,
+    230, 230, 220, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 0, 230, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 220, 220, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220,
+    220, 220, 220, 220, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 0, 220, 230, 230, 220, 230, 230, 220, 230, 230, 230, 220, 220, 220,
+    27, 28, 29, 230, 230, 230, 220, 230, 230, 220, 220, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0,
+    0, 768, 0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 10247, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 230, 220, 230, 230, 0, 0, 0, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 10240, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 5888, 5888, 0, 5888,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5888, 0, 0, 5888, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 5888, 5888, 0, 0, 5888, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 10240, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 768, 768, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 10240, 10240, 0, 0, 0, 0, 5888, 5888, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 84, 10331, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    768, 0, 10240, 0, 0, 0, 0, 768, 768, 0, 768, 768, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 10240, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10249, 0, 0, 0, 0, 10240,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 768, 768, 768, 10240,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4608, 0, 0, 0, 0, 103, 103, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4608, 0, 0, 0, 0, 118, 118, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 122, 122, 122, 122, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 0, 220, 0, 216, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0,
+    0, 0, 5888, 0, 0, 0, 0, 5888, 0, 0, 0, 0, 5888, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0, 0, 0, 0, 0,
+    0, 129, 130, 5888, 132, 5888, 5888, 4608, 5888, 4608, 130, 130, 130, 130, 0, 0,
+    130, 5888, 230, 230, 9, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0,
+    0, 0, 5888, 0, 0, 0, 0, 5888, 0, 0, 0, 0, 5888, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 10240, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 230, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 220,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 0, 220,
+    220, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 230, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0,
+    0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 10240, 0, 0, 0, 0, 0, 768, 0, 768, 0, 0,
+    768, 768, 0, 768, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 230, 230,
+    230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 0, 1, 220, 220, 220, 220, 220, 230, 230, 220, 220, 220, 220,
+    230, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 230, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    230, 230, 220, 230, 230, 230, 230, 230, 230, 230, 220, 230, 230, 234, 214, 220,
+    202, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 232, 228, 228, 220, 218, 230, 233, 220, 230, 220,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 4608, 4864, 0, 0, 0, 0,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 0, 0,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 0, 0,
+    768, 768, 768, 768, 768, 768, 768, 768, 0, 768, 0, 768, 0, 768, 0, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 5888, 768, 5888, 768, 5888, 768, 5888, 768, 5888, 768, 5888, 768, 5888, 0, 0,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 0, 768, 768, 768, 768, 768, 5888, 768, 4608, 5888, 4608,
+    4608, 4864, 768, 768, 768, 0, 768, 768, 768, 5888, 768, 5888, 768, 4864, 4864, 4864,
+    768, 768, 768, 5888, 0, 0, 768, 768, 768, 768, 768, 5888, 0, 4864, 4864, 4864,
+    768, 768, 768, 5888, 768, 768, 768, 768, 768, 768, 768, 5888, 768, 4864, 5888, 5888,
+    0, 0, 768, 768, 768, 0, 768, 768, 768, 5888, 768, 5888, 768, 5888, 4608, 0,
+    5888, 5888, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+    0, 4608, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 4608,
+    0, 0, 0, 4608, 4608, 0, 4608, 4608, 0, 0, 0, 0, 4608, 0, 4608, 0,
+    0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0, 4608,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 1, 1, 230, 230, 230, 230, 1, 1, 1, 230, 230, 0, 0, 0,
+    0, 230, 0, 0, 0, 1, 1, 230, 220, 230, 1, 1, 220, 220, 220, 220,
+    230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 0, 4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 4608, 0, 0,
+    4608, 4608, 4608, 0, 4608, 0, 5888, 0, 4608, 0, 5888, 5888, 4608, 4608, 0, 4608,
+    4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608,
+    4608, 0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 768, 0, 0, 0, 0, 768, 0, 0, 768, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 768, 0, 768, 0, 0, 0, 0, 0, 4608, 4608, 0, 4608,
+    4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 768, 0, 0, 768, 0, 0, 768, 0, 768, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    768, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768,
+    768, 768, 0, 0, 768, 768, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0,
+    768, 768, 0, 0, 768, 768, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 5888, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 228, 232, 222, 224, 224,
+    0, 0, 0, 0, 0, 0, 4608, 0, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 768, 0,
+    768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0,
+    768, 0, 768, 0, 0, 768, 0, 768, 0, 768, 0, 0, 0, 0, 0, 0,
+    768, 768, 0, 768, 768, 0, 768, 768, 0, 768, 768, 0, 768, 768, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 768, 0, 0, 0, 0, 10248, 10248, 4608, 4608, 0, 768, 4608,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 768, 0,
+    768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0,
+    768, 0, 768, 0, 0, 768, 0, 768, 0, 768, 0, 0, 0, 0, 0, 0,
+    768, 768, 0, 768, 768, 0, 768, 768, 0, 768, 768, 0, 768, 768, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 768, 0, 0, 768, 768, 768, 768, 0, 0, 0, 768, 4608,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+    0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+    0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4608, 4608, 4608, 0, 0, 0, 4608, 4608, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 0, 230, 230, 220, 0, 0, 230, 230, 0, 0, 0, 0, 0, 230, 230,
+    0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 0, 0,
+    5888, 0, 5888, 0, 0, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 0,
+    5888, 0, 5888, 0, 0, 5888, 5888, 0, 0, 0, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 0, 0,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 5888, 26, 5888,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 0, 5888, 5888, 5888, 5888, 5888, 0, 5888, 0,
+    5888, 5888, 0, 5888, 5888, 0, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 220, 230, 230,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0, 0, 0, 0,
+    4608, 4608, 4608, 0, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0,
+    0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+    0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608,
+    0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+    0, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 1, 220, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 220, 220, 230, 230, 230, 220, 230, 220, 220, 220,
+    220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 230, 220, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 768, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 10247, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 768, 768,
+    0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 10240, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0,
+    230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 768, 768, 10240, 768, 0,
+    0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 0, 0, 0, 9,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10240, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 9, 9, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 216, 216, 1, 1, 1, 0, 0, 0, 226, 216, 216,
+    216, 216, 216, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 220, 220,
+    220, 220, 220, 0, 0, 230, 230, 230, 230, 230, 220, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 5888, 5888, 5888, 5888,
+    5888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608,
+    0, 0, 4608, 0, 0, 4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 0, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 0, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0,
+    4608, 4608, 4608, 4608, 4608, 0, 4608, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 230,
+    230, 230, 0, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    220, 220, 220, 220, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    0, 4608, 4608, 0, 4608, 0, 0, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0, 4608, 0, 4608, 0, 0, 0, 0,
+    0, 0, 4608, 0, 0, 0, 0, 4608, 0, 4608, 0, 4608, 0, 4608, 4608, 4608,
+    0, 4608, 4608, 0, 4608, 0, 0, 4608, 0, 4608, 0, 4608, 0, 4608, 0, 4608,
+    0, 4608, 4608, 0, 4608, 0, 0, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0, 4608, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0,
+    0, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+    5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const size_t kDecompositionCount = 5795;
+
+// the code points which are decomposed by NFD or NFKD, in their order
+const char32_t kDecompositionCodePoints[5795] = {
+    160, 168, 170, 175, 178, 179, 180, 181, 184, 185, 186, 188, 189, 190, 192, 193,
+    194, 195, 196, 197, 199, 200, 201, 202, 203, 204, 205, 206, 207, 209, 210, 211,
+    212, 213, 214, 217, 218, 219, 220, 221, 224, 225, 226, 227, 228, 229, 231, 232,
+    233, 234, 235, 236, 237, 238, 239, 241, 242, 243, 244, 245, 246, 249, 250, 251,
+    252, 253, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268,
+    269, 270, 271, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286,
+    287, 288, 289, 290, 291, 292, 293, 296, 297, 298, 299, 300, 301, 302, 303, 304,
+    306, 307, 308, 309, 310, 311, 313, 314, 315, 316, 317, 318, 319, 320, 323, 324,
+    325, 326, 327, 328, 329, 332, 333, 334, 335, 336, 337, 340, 341, 342, 343, 344,
+    345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 360, 361, 362,
+    363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378,
+    379, 380, 381, 382, 383, 416, 417, 431, 432, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    475, 476, 478, 479, 480, 481, 482, 483, 486, 487, 488, 489, 490, 491, 492, 493,
+    494, 495, 496, 497, 498, 499, 500, 501, 504, 505, 506, 507, 508, 509, 510, 511,
+    512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+    528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 542, 543, 550, 551,
+    552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 688, 689, 690, 691,
+    692, 693, 694, 695, 696, 728, 729, 730, 731, 732, 733, 736, 737, 738, 739, 740,
+    832, 833, 835, 836, 884, 890, 894, 900, 901, 902, 903, 904, 905, 906, 908, 910,
+    911, 912, 938, 939, 940, 941, 942, 943, 944, 970, 971, 972, 973, 974, 976, 977,
+    978, 979, 980, 981, 982, 1008, 1009, 1010, 1012, 1013, 1017, 1024, 1025, 1027, 1031, 1036,
+    1037, 1038, 1049, 1081, 1104, 1105, 1107, 1111, 1116, 1117, 1118, 1142, 1143, 1217, 1218, 1232,
+    1233, 1234, 1235, 1238, 1239, 1242, 1243, 1244, 1245, 1246, 1247, 1250, 1251, 1252, 1253, 1254,
+    1255, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1272, 1273, 1415,
+    1570, 1571, 1572, 1573, 1574, 1653, 1654, 1655, 1656, 1728, 1730, 1747, 2345, 2353, 2356, 2392,
+    2393, 2394, 2395, 2396, 2397, 2398, 2399, 2507, 2508, 2524, 2525, 2527, 2611, 2614, 2649, 2650,
+    2651, 2654, 2888, 2891, 2892, 2908, 2909, 2964, 3018, 3019, 3020, 3144, 3264, 3271, 3272, 3274,
+    3275, 3402, 3403, 3404, 3546, 3548, 3549, 3550, 3635, 3763, 3804, 3805, 3852, 3907, 3917, 3922,
+    3927, 3932, 3945, 3955, 3957, 3958, 3959, 3960, 3961, 3969, 3987, 3997, 4002, 4007, 4012, 4025,
+    4134, 4348, 6918, 6920, 6922, 6924, 6926, 6930, 6971, 6973, 6976, 6977, 6979, 7468, 7469, 7470,
+    7472, 7473, 7474, 7475, 7476, 7477, 7478, 7479, 7480, 7481, 7482, 7484, 7485, 7486, 7487, 7488,
+    7489, 7490, 7491, 7492, 7493, 7494, 7495, 7496, 7497, 7498, 7499, 7500, 7501, 7503, 7504, 7505,
+    7506, 7507, 7508, 7509, 7510, 7511, 7512, 7513, 7514, 7515, 7516, 7517, 7518, 7519, 7520, 7521,
+    7522, 7523, 7524, 7525, 7526, 7527, 7528, 7529, 7530, 7544, 7579, 7580, 7581, 7582, 7583, 7584,
+    7585, 7586, 7587, 7588, 7589, 7590, 7591, 7592, 7593, 7594, 7595, 7596, 7597, 7598, 7599, 7600,
+    7601, 7602, 7603, 7604, 7605, 7606, 7607, 7608, 7609, 7610, 7611, 7612, 7613, 7614, 7615, 7680,
+    7681, 7682, 7683, 7684, 7685, 7686, 7687, 7688, 7689, 7690, 7691, 7692, 7693, 7694, 7695, 7696,
+    7697, 7698, 7699, 7700, 7701, 7702, 7703, 7704, 7705, 7706, 7707, 7708, 7709, 7710, 7711, 7712,
+    7713, 7714, 7715, 7716, 7717, 7718, 7719, 7720, 7721, 7722, 7723, 7724, 7725, 7726, 7727, 7728,
+    7729, 7730, 7731, 7732, 7733, 7734, 7735, 7736, 7737, 7738, 7739, 7740, 7741, 7742, 7743, 7744,
+    7745, 7746, 7747, 7748, 7749, 7750, 7751, 7752, 7753, 7754, 7755, 7756, 7757, 7758, 7759, 7760,
+    7761, 7762, 7763, 7764, 7765, 7766, 7767, 7768, 7769, 7770, 7771, 7772, 7773, 7774, 7775, 7776,
+    7777, 7778, 7779, 7780, 7781, 7782, 7783, 7784, 7785, 7786, 7787, 7788, 7789, 7790, 7791, 7792,
+    7793, 7794, 7795, 7796, 7797, 7798, 7799, 7800, 7801, 7802, 7803, 7804, 7805, 7806, 7807, 7808,
+    7809, 7810, 7811, 7812, 7813, 7814, 7815, 7816, 7817, 7818, 7819, 7820, 7821, 7822, 7823, 7824,
+    7825, 7826, 7827, 7828, 7829, 7830, 7831, 7832, 7833, 7834, 7835, 7840, 7841, 7842, 7843, 7844,
+    7845, 7846, 7847, 7848, 7849, 7850, 7851, 7852, 7853, 7854, 7855, 7856, 7857, 7858, 7859, 7860,
+    7861, 7862, 7863, 7864, 7865, 7866, 7867, 7868, 7869, 7870, 7871, 7872, 7873, 7874, 7875, 7876,
+    7877, 7878, 7879, 7880, 7881, 7882, 7883, 7884, 7885, 7886, 7887, 7888, 7889, 7890, 7891, 7892,
+    7893, 7894, 7895, 7896, 7897, 7898, 7899, 7900, 7901, 7902, 7903, 7904, 7905, 7906, 7907, 7908,
+    7909, 7910, 7911, 7912, 7913, 7914, 7915, 7916, 7917, 7918, 7919, 7920, 7921, 7922, 7923, 7924,
+    7925, 7926, 7927, 7928, 7929, 7936, 7937, 7938, 7939, 7940, 7941, 7942, 7943, 7944, 7945, 7946,
+    7947, 7948, 7949, 7950, 7951, 7952, 7953, 7954, 7955, 7956, 7957, 7960, 7961, 7962, 7963, 7964,
+    7965, 7968, 7969, 7970, 7971, 7972, 7973, 7974, 7975, 7976, 7977, 7978, 7979, 7980, 7981, 7982,
+    7983, 7984, 7985, 7986, 7987, 7988, 7989, 7990, 7991, 7992, 7993, 7994, 7995, 7996, 7997, 7998,
+    7999, 8000, 8001, 8002, 8003, 8004, 8005, 8008, 8009, 8010, 8011, 8012, 8013, 8016, 8017, 8018,
+    8019, 8020, 8021, 8022, 8023, 8025, 8027, 8029, 8031, 8032, 8033, 8034, 8035, 8036, 8037, 8038,
+    8039, 8040, 8041, 8042, 8043, 8044, 8045, 8046, 8047, 8048, 8049, 8050, 8051, 8052, 8053, 8054,
+    8055, 8056, 8057, 8058, 8059, 8060, 8061, 8064, 8065, 8066, 8067, 8068, 8069, 8070, 8071, 8072,
+    8073, 8074, 8075, 8076, 8077, 8078, 8079, 8080, 8081, 8082, 8083, 8084, 8085, 8086, 8087, 8088,
+    8089, 8090, 8091, 8092, 8093, 8094, 8095, 8096, 8097, 8098, 8099, 8100, 8101, 8102, 8103, 8104,
+    8105, 8106, 8107, 8108, 8109, 8110, 8111, 8112, 8113, 8114, 8115, 8116, 8118, 8119, 8120, 8121,
+    8122, 8123, 8124, 8125, 8126, 8127, 8128, 8129, 8130, 8131, 8132, 8134, 8135, 8136, 8137, 8138,
+    8139, 8140, 8141, 8142, 8143, 8144, 8145, 8146, 8147, 8150, 8151, 8152, 8153, 8154, 8155, 8157,
+    8158, 8159, 8160, 8161, 8162, 8163, 8164, 8165, 8166, 8167, 8168, 8169, 8170, 8171, 8172, 8173,
+    8174, 8175, 8178, 8179, 8180, 8182, 8183, 8184, 8185, 8186, 8187, 8188, 8189, 8190, 8192, 8193,
+    8194, 8195, 8196, 8197, 8198, 8199, 8200, 8201, 8202, 8209, 8215, 8228, 8229, 8230, 8239, 8243,
+    8244, 8246, 8247, 8252, 8254, 8263, 8264, 8265, 8279, 8287, 8304, 8305, 8308, 8309, 8310, 8311,
+    8312, 8313, 8314, 8315, 8316, 8317, 8318, 8319, 8320, 8321, 8322, 8323, 8324, 8325, 8326, 8327,
+    8328, 8329, 8330, 8331, 8332, 8333, 8334, 8336, 8337, 8338, 8339, 8340, 8341, 8342, 8343, 8344,
+    8345, 8346, 8347, 8348, 8360, 8448, 8449, 8450, 8451, 8453, 8454, 8455, 8457, 8458, 8459, 8460,
+    8461, 8462, 8463, 8464, 8465, 8466, 8467, 8469, 8470, 8473, 8474, 8475, 8476, 8477, 8480, 8481,
+    8482, 8484, 8486, 8488, 8490, 8491, 8492, 8493, 8495, 8496, 8497, 8499, 8500, 8501, 8502, 8503,
+    8504, 8505, 8507, 8508, 8509, 8510, 8511, 8512, 8517, 8518, 8519, 8520, 8521, 8528, 8529, 8530,
+    8531, 8532, 8533, 8534, 8535, 8536, 8537, 8538, 8539, 8540, 8541, 8542, 8543, 8544, 8545, 8546,
+    8547, 8548, 8549, 8550, 8551, 8552, 8553, 8554, 8555, 8556, 8557, 8558, 8559, 8560, 8561, 8562,
+    8563, 8564, 8565, 8566, 8567, 8568, 8569, 8570, 8571, 8572, 8573, 8574, 8575, 8585, 8602, 8603,
+    8622, 8653, 8654, 8655, 8708, 8713, 8716, 8740, 8742, 8748, 8749, 8751, 8752, 8769, 8772, 8775,
+    8777, 8800, 8802, 8813, 8814, 8815, 8816, 8817, 8820, 8821, 8824, 8825, 8832, 8833, 8836, 8837,
+    8840, 8841, 8876, 8877, 8878, 8879, 8928, 8929, 8930, 8931, 8938, 8939, 8940, 8941, 9001, 9002,
+    9312, 9313, 9314, 9315, 9316, 9317, 9318, 9319, 9320, 9321, 9322, 9323, 9324, 9325, 9326, 9327,
+    9328, 9329, 9330, 9331, 9332, 9333, 9334, 9335, 9336, 9337, 9338, 9339, 9340, 9341, 9342, 9343,
+    9344, 9345, 9346, 9347, 9348, 9349, 9350, 9351, 9352, 9353, 9354, 9355, 9356, 9357, 9358, 9359,
+    9360, 9361, 9362, 9363, 9364, 9365, 9366, 9367, 9368, 9369, 9370, 9371, 9372, 9373, 9374, 9375,
+    9376, 9377, 9378, 9379, 9380, 9381, 9382, 9383, 9384, 9385, 9386, 9387, 9388, 9389, 9390, 9391,
+    9392, 9393, 9394, 9395, 9396, 9397, 9398, 9399, 9400, 9401, 9402, 9403, 9404, 9405, 9406, 9407,
+    9408, 9409, 9410, 9411, 9412, 9413, 9414, 9415, 9416, 9417, 9418, 9419, 9420, 9421, 9422, 9423,
+    9424, 9425, 9426, 9427, 9428, 9429, 9430, 9431, 9432, 9433, 9434, 9435, 9436, 9437, 9438, 9439,
+    9440, 9441, 9442, 9443, 9444, 9445, 9446, 9447, 9448, 9449, 9450, 10764, 10868, 10869, 10870, 10972,
+    11388, 11389, 11631, 11935, 12019, 12032, 12033, 12034, 12035, 12036, 12037, 12038, 12039, 12040, 12041, 12042,
+    12043, 12044, 12045, 12046, 12047, 12048, 12049, 12050, 12051, 12052, 12053, 12054, 12055, 12056, 12057, 12058,
+    12059, 12060, 12061, 12062, 12063, 12064, 12065, 12066, 12067, 12068, 12069, 12070, 12071, 12072, 12073, 12074,
+    12075, 12076, 12077, 12078, 12079, 12080, 12081, 12082, 12083, 12084, 12085, 12086, 12087, 12088, 12089, 12090,
+    12091, 12092, 12093, 12094, 12095, 12096, 12097, 12098, 12099, 12100, 12101, 12102, 12103, 12104, 12105, 12106,
+    12107, 12108, 12109, 12110, 12111, 12112, 12113, 12114, 12115, 12116, 12117, 12118, 12119, 12120, 12121, 12122,
+    12123, 12124, 12125, 12126, 12127, 12128, 12129, 12130, 12131, 12132, 12133, 12134, 12135, 12136, 12137, 12138,
+    12139, 12140, 12141, 12142, 12143, 12144, 12145, 12146, 12147, 12148, 12149, 12150, 12151, 12152, 12153, 12154,
+    12155, 12156, 12157, 12158, 12159, 12160, 12161, 12162, 12163, 12164, 12165, 12166, 12167, 12168, 12169, 12170,
+    12171, 12172, 12173, 12174, 12175, 12176, 12177, 12178, 12179, 12180, 12181, 12182, 12183, 12184, 12185, 12186,
+    12187, 12188, 12189, 12190, 12191, 12192, 12193, 12194, 12195, 12196, 12197, 12198, 12199, 12200, 12201, 12202,
+    12203, 12204, 12205, 12206, 12207, 12208, 12209, 12210, 12211, 12212, 12213, 12214, 12215, 12216, 12217, 12218,
+    12219, 12220, 12221, 12222, 12223, 12224, 12225, 12226, 12227, 12228, 12229, 12230, 12231, 12232, 12233, 12234,
+    12235, 12236, 12237, 12238, 12239, 12240, 12241, 12242, 12243, 12244, 12245, 12288, 12342, 12344, 12345, 12346,
+    12364, 12366, 12368, 12370, 12372, 12374, 12376, 12378, 12380, 12382, 12384, 12386, 12389, 12391, 12393, 12400,
+    12401, 12403, 12404, 12406, 12407, 12409, 12410, 12412, 12413, 12436, 12443, 12444, 12446, 12447, 12460, 12462,
+    12464, 12466, 12468, 12470, 12472, 12474, 12476, 12478, 12480, 12482, 12485, 12487, 12489, 12496, 12497, 12499,
+    12500, 12502, 12503, 12505, 12506, 12508, 12509, 12532, 12535, 12536, 12537, 12538, 12542, 12543, 12593, 12594,
+    12595, 12596, 12597, 12598, 12599, 12600, 12601, 12602, 12603, 12604, 12605, 12606, 12607, 12608, 12609, 12610,
+    12611, 12612, 12613, 12614, 12615, 12616, 12617, 12618, 12619, 12620, 12621, 12622, 12623, 12624, 12625, 12626,
+    12627, 12628, 12629, 12630, 12631, 12632, 12633, 12634, 12635, 12636, 12637, 12638, 12639, 12640, 12641, 12642,
+    12643, 12644, 12645, 12646, 12647, 12648, 12649, 12650, 12651, 12652, 12653, 12654, 12655, 12656, 12657, 12658,
+    12659, 12660, 12661, 12662, 12663, 12664, 12665, 12666, 12667, 12668, 12669, 12670, 12671, 12672, 12673, 12674,
+    12675, 12676, 12677, 12678, 12679, 12680, 12681, 12682, 12683, 12684, 12685, 12686, 12690, 12691, 12692, 12693,
+    12694, 12695, 12696, 12697, 12698, 12699, 12700, 12701, 12702, 12703, 12800, 12801, 12802, 12803, 12804, 12805,
+    12806, 12807, 12808, 12809, 12810, 12811, 12812, 12813, 12814, 12815, 12816, 12817, 12818, 12819, 12820, 12821,
+    12822, 12823, 12824, 12825, 12826, 12827, 12828, 12829, 12830, 12832, 12833, 12834, 12835, 12836, 12837, 12838,
+    12839, 12840, 12841, 12842, 12843, 12844, 12845, 12846, 12847, 12848, 12849, 12850, 12851, 12852, 12853, 12854,
+    12855, 12856, 12857, 12858, 12859, 12860, 12861, 12862, 12863, 12864, 12865, 12866, 12867, 12868, 12869, 12870,
+    12871, 12880, 12881, 12882, 12883, 12884, 12885, 12886, 12887, 12888, 12889, 12890, 12891, 12892, 12893, 12894,
+    12895, 12896, 12897, 12898, 12899, 12900, 12901, 12902, 12903, 12904, 12905, 12906, 12907, 12908, 12909, 12910,
+    12911, 12912, 12913, 12914, 12915, 12916, 12917, 12918, 12919, 12920, 12921, 12922, 12923, 12924, 12925, 12926,
+    12928, 12929, 12930, 12931, 12932, 12933, 12934, 12935, 12936, 12937, 12938, 12939, 12940, 12941, 12942, 12943,
+    12944, 12945, 12946, 12947, 12948, 12949, 12950, 12951, 12952, 12953, 12954, 12955, 12956, 12957, 12958, 12959,
+    12960, 12961, 12962, 12963, 12964, 12965, 12966, 12967, 12968, 12969, 12970, 12971, 12972, 12973, 12974, 12975,
+    12976, 12977, 12978, 12979, 12980, 12981, 12982, 12983, 12984, 12985, 12986, 12987, 12988, 12989, 12990, 12991,
+    12992, 12993, 12994, 12995, 12996, 12997, 12998, 12999, 13000, 13001, 13002, 13003, 13004, 13005, 13006, 13007,
+    13008, 13009, 13010, 13011, 13012, 13013, 13014, 13015, 13016, 13017, 13018, 13019, 13020, 13021, 13022, 13023,
+    13024, 13025, 13026, 13027, 13028, 13029, 13030, 13031, 13032, 13033, 13034, 13035, 13036, 13037, 13038, 13039,
+    13040, 13041, 13042, 13043, 13044, 13045, 13046, 13047, 13048, 13049, 13050, 13051, 13052, 13053, 13054, 13055,
+    13056, 13057, 13058, 13059, 13060, 13061, 13062, 13063, 13064, 13065, 13066, 13067, 13068, 13069, 13070, 13071,
+    13072, 13073, 13074, 13075, 13076, 13077, 13078, 13079, 13080, 13081, 13082, 13083, 13084, 13085, 13086, 13087,
+    13088, 13089, 13090, 13091, 13092, 13093, 13094, 13095, 13096, 13097, 13098, 13099, 13100, 13101, 13102, 13103,
+    13104, 13105, 13106, 13107, 13108, 13109, 13110, 13111, 13112, 13113, 13114, 13115, 13116, 13117, 13118, 13119,
+    13120, 13121, 13122, 13123, 13124, 13125, 13126, 13127, 13128, 13129, 13130, 13131, 13132, 13133, 13134, 13135,
+    13136, 13137, 13138, 13139, 13140, 13141, 13142, 13143, 13144, 13145, 13146, 13147, 13148, 13149, 13150, 13151,
+    13152, 13153, 13154, 13155, 13156, 13157, 13158, 13159, 13160, 13161, 13162, 13163, 13164, 13165, 13166, 13167,
+    13168, 13169, 13170, 13171, 13172, 13173, 13174, 13175, 13176, 13177, 13178, 13179, 13180, 13181, 13182, 13183,
+    13184, 13185, 13186, 13187, 13188, 13189, 13190, 13191, 13192, 13193, 13194, 13195, 13196, 13197, 13198, 13199,
+    13200, 13201, 13202, 13203, 13204, 13205, 13206, 13207, 13208, 13209, 13210, 13211, 13212, 13213, 13214, 13215,
+    13216, 13217, 13218, 13219, 13220, 13221, 13222, 13223, 13224, 13225, 13226, 13227, 13228, 13229, 13230, 13231,
+    13232, 13233, 13234, 13235, 13236, 13237, 13238, 13239, 13240, 13241, 13242, 13243, 13244, 13245, 13246, 13247,
+    13248, 13249, 13250, 13251, 13252, 13253, 13254, 13255, 13256, 13257, 13258, 13259, 13260, 13261, 13262, 13263,
+    13264, 13265, 13266, 13267, 13268, 13269, 13270, 13271, 13272, 13273, 13274, 13275, 13276, 13277, 13278, 13279,
+    13280, 13281, 13282, 13283, 13284, 13285, 13286, 13287, 13288, 13289, 13290, 13291, 13292, 13293, 13294, 13295,
+    13296, 13297, 13298, 13299, 13300, 13301, 13302, 13303, 13304, 13305, 13306, 13307, 13308, 13309, 13310, 13311,
+    42652, 42653, 42864, 42994, 42995, 42996, 43000, 43001, 43868, 43869, 43870, 43871, 43881, 63744, 63745, 63746,
+    63747, 63748, 63749, 63750, 63751, 63752, 63753, 63754, 63755, 63756, 63757, 63758, 63759, 63760, 63761, 63762,
+    63763, 63764, 63765, 63766, 63767, 63768, 63769, 63770, 63771, 63772, 63773, 63774, 63775, 63776, 63777, 63778,
+    63779, 63780, 63781, 63782, 63783, 63784, 63785, 63786, 63787, 63788, 63789, 63790, 63791, 63792, 63793, 63794,
+    63795, 63796, 63797, 63798, 63799, 63800, 63801, 63802, 63803, 63804, 63805, 63806, 63807, 63808, 63809, 63810,
+    63811, 63812, 63813, 63814, 63815, 63816, 63817, 63818, 63819, 63820, 63821, 63822, 63823, 63824, 63825, 63826,
+    63827, 63828, 63829, 63830, 63831, 63832, 63833, 63834, 63835, 63836, 63837, 63838, 63839, 63840, 63841, 63842,
+    63843, 63844, 63845, 63846, 63847, 63848, 63849, 63850, 63851, 63852, 63853, 63854, 63855, 63856, 63857, 63858,
+    63859, 63860, 63861, 63862, 63863, 63864, 63865, 63866, 63867, 63868, 63869, 63870, 63871, 63872, 63873, 63874,
+    63875, 63876, 63877, 63878, 63879, 63880, 63881, 63882, 63883, 63884, 63885, 63886, 63887, 63888, 63889, 63890,
+    63891, 63892, 63893, 63894, 63895, 63896, 63897, 63898, 63899, 63900, 63901, 63902, 63903, 63904, 63905, 63906,
+    63907, 63908, 63909, 63910, 63911, 63912, 63913, 63914, 63915, 63916, 63917, 63918, 63919, 63920, 63921, 63922,
+    63923, 63924, 63925, 63926, 63927, 63928, 63929, 63930, 63931, 63932, 63933, 63934, 63935, 63936, 63937, 63938,
+    63939, 63940, 63941, 63942, 63943, 63944, 63945, 63946, 63947, 63948, 63949, 63950, 63951, 63952, 63953, 63954,
+    63955, 63956, 63957, 63958, 63959, 63960, 63961, 63962, 63963, 63964, 63965, 63966, 63967, 63968, 63969, 63970,
+    63971, 63972, 63973, 63974, 63975, 63976, 63977, 63978, 63979, 63980, 63981, 63982, 63983, 63984, 63985, 63986,
+    63987, 63988, 63989, 63990, 63991, 63992, 63993, 63994, 63995, 63996, 63997, 63998, 63999, 64000, 64001, 64002,
+    64003, 64004, 64005, 64006, 64007, 64008, 64009, 64010, 64011, 64012, 64013, 64016, 64018, 64021, 64022, 64023,
+    64024, 64025, 64026, 64027, 64028, 64029, 64030, 64032, 64034, 64037, 64038, 64042, 64043, 64044, 64045, 64046,
+    64047, 64048, 64049, 64050, 64051, 64052, 64053, 64054, 64055, 64056, 64057, 64058, 64059, 64060, 64061, 64062,
+    64063, 64064, 64065, 64066, 64067, 64068, 64069, 64070, 64071, 64072, 64073, 64074, 64075, 64076, 64077, 64078,
+    64079, 64080, 64081, 64082, 64083, 64084, 64085, 64086, 64087, 64088, 64089, 64090, 64091, 64092, 64093, 64094,
+    64095, 64096, 64097, 64098, 64099, 64100, 64101, 64102, 64103, 64104, 64105, 64106, 64107, 64108, 64109, 64112,
+    64113, 64114, 64115, 64116, 64117, 64118, 64119, 64120, 64121, 64122, 64123, 64124, 64125, 64126, 64127, 64128,
+    64129, 64130, 64131, 64132, 64133, 64134, 64135, 64136, 64137, 64138, 64139, 64140, 64141, 64142, 64143, 64144,
+    64145, 64146, 64147, 64148, 64149, 64150, 64151, 64152, 64153, 64154, 64155, 64156, 64157, 64158, 64159, 64160,
+    64161, 64162, 64163, 64164, 64165, 64166, 64167, 64168, 64169, 64170, 64171, 64172, 64173, 64174, 64175, 64176,
+    64177, 64178, 64179, 64180, 64181, 64182, 64183, 64184, 64185, 64186, 64187, 64188, 64189, 64190, 64191, 64192,
+    64193, 64194, 64195, 64196, 64197, 64198, 64199, 64200, 64201, 64202, 64203, 64204, 64205, 64206, 64207, 64208,
+    64209, 64210, 64211, 64212, 64213, 64214, 64215, 64216, 64217, 64256, 64257, 64258, 64259, 64260, 64261, 64262,
+    64275, 64276, 64277, 64278, 64279, 64285, 64287, 64288, 64289, 64290, 64291, 64292, 64293, 64294, 64295, 64296,
+    64297, 64298, 64299, 64300, 64301, 64302, 64303, 64304, 64305, 64306, 64307, 64308, 64309, 64310, 64312, 64313,
+    64314, 64315, 64316, 64318, 64320, 64321, 64323, 64324, 64326, 64327, 64328, 64329, 64330, 64331, 64332, 64333,
+    64334, 64335, 64336, 64337, 64338, 64339, 64340, 64341, 64342, 64343, 64344, 64345, 64346, 64347, 64348, 64349,
+    64350, 64351, 64352, 64353, 64354, 64355, 64356, 64357, 64358, 64359, 64360, 64361, 64362, 64363, 64364, 64365,
+    64366, 64367, 64368, 64369, 64370, 64371, 64372, 64373, 64374, 64375, 64376, 64377, 64378, 64379, 64380, 64381,
+    64382, 64383, 64384, 64385, 64386, 64387, 64388, 64389, 64390, 64391, 64392, 64393, 64394, 64395, 64396, 64397,
+    64398, 64399, 64400, 64401, 64402, 64403, 64404, 64405, 64406, 64407, 64408, 64409, 64410, 64411, 64412, 64413,
+    64414, 64415, 64416, 64417, 64418, 64419, 64420, 64421, 64422, 64423, 64424, 64425, 64426, 64427, 64428, 64429,
+    64430, 64431, 64432, 64433, 64467, 64468, 64469, 64470, 64471, 64472, 64473, 64474, 64475, 64476, 64477, 64478,
+    64479, 64480, 64481, 64482, 64483, 64484, 64485, 64486, 64487, 64488, 64489, 64490, 64491, 64492, 64493, 64494,
+    64495, 64496, 64497, 64498, 64499, 64500, 64501, 64502, 64503, 64504, 64505, 64506, 64507, 64508, 64509, 64510,
+    64511, 64512, 64513, 64514, 64515, 64516, 64517, 64518, 64519, 64520, 64521, 64522, 64523, 64524, 64525, 64526,
+    64527, 64528, 64529, 64530, 64531, 64532, 64533, 64534, 64535, 64536, 64537, 64538, 64539, 64540, 64541, 64542,
+    64543, 64544, 64545, 64546, 64547, 64548, 64549, 64550, 64551, 64552, 64553, 64554, 64555, 64556, 64557, 64558,
+    64559, 64560, 64561, 64562, 64563, 64564, 64565, 64566, 64567, 64568, 64569, 64570, 64571, 64572, 64573, 64574,
+    64575, 64576, 64577, 64578, 64579, 64580, 64581, 64582, 64583, 64584, 64585, 64586, 64587, 64588, 64589, 64590,
+    64591, 64592, 64593, 64594, 64595, 64596, 64597, 64598, 64599, 64600, 64601, 64602, 64603, 64604, 64605, 64606,
+    64607, 64608, 64609, 64610, 64611, 64612, 64613, 64614, 64615, 64616, 64617, 64618, 64619, 64620, 64621, 64622,
+    64623, 64624, 64625, 64626, 64627, 64628, 64629, 64630, 64631, 64632, 64633, 64634, 64635, 64636, 64637, 64638,
+    64639, 64640, 64641, 64642, 64643, 64644, 64645, 64646, 64647, 64648, 64649, 64650, 64651, 64652, 64653, 64654,
+    64655, 64656, 64657, 64658, 64659, 64660, 64661, 64662, 64663, 64664, 64665, 64666, 64667, 64668, 64669, 64670,
+    64671, 64672, 64673, 64674, 64675, 64676, 64677, 64678, 64679, 64680, 64681, 64682, 64683, 64684, 64685, 64686,
+    64687, 64688, 64689, 64690, 64691, 64692, 64693, 64694, 64695, 64696, 64697, 64698, 64699, 64700, 64701, 64702,
+    64703, 64704, 64705, 64706, 64707, 64708, 64709, 64710, 64711, 64712, 64713, 64714, 64715, 64716, 64717, 64718,
+    64719, 64720, 64721, 64722, 64723, 64724, 64725, 64726, 64727, 64728, 64729, 64730, 64731, 64732, 64733, 64734,
+    64735, 64736, 64737, 64738, 64739, 64740, 64741, 64742, 64743, 64744, 64745, 64746, 64747, 64748, 64749, 64750,
+    64751, 64752, 64753, 64754, 64755, 64756, 64757, 64758, 64759, 64760, 64761, 64762, 64763, 64764, 64765, 64766,
+    64767, 64768, 64769, 64770, 64771, 64772, 64773, 64774, 64775, 64776, 64777, 64778, 64779, 64780, 64781, 64782,
+    64783, 64784, 64785, 64786, 64787, 64788, 64789, 64790, 64791, 64792, 64793, 64794, 64795, 64796, 64797, 64798,
+    64799, 64800, 64801, 64802, 64803, 64804, 64805, 64806, 64807, 64808, 64809, 64810, 64811, 64812, 64813, 64814,
+    64815, 64816, 64817, 64818, 64819, 64820, 64821, 64822, 64823, 64824, 64825, 64826, 64827, 64828, 64829, 64848,
+    64849, 64850, 64851, 64852, 64853, 64854, 64855, 64856, 64857, 64858, 64859, 64860, 64861, 64862, 64863, 64864,
+    64865, 64866, 64867, 64868, 64869, 64870, 64871, 64872, 64873, 64874, 64875, 64876, 64877, 64878, 64879, 64880,
+    64881, 64882, 64883, 64884, 64885, 64886, 64887, 64888, 64889, 64890, 64891, 64892, 64893, 64894, 64895, 64896,
+    64897, 64898, 64899, 64900, 64901, 64902, 64903, 64904, 64905, 64906, 64907, 64908, 64909, 64910, 64911, 64914,
+    64915, 64916, 64917, 64918, 64919, 64920, 64921, 64922, 64923, 64924, 64925, 64926, 64927, 64928, 64929, 64930,
+    64931, 64932, 64933, 64934, 64935, 64936, 64937, 64938, 64939, 64940, 64941, 64942, 64943, 64944, 64945, 64946,
+    64947, 64948, 64949, 64950, 64951, 64952, 64953, 64954, 64955, 64956, 64957, 64958, 64959, 64960, 64961, 64962,
+    64963, 64964, 64965, 64966, 64967, 65008, 65009, 65010, 65011, 65012, 65013, 65014, 65015, 65016, 65017, 65018,
+    65019, 65020, 65040, 65041, 65042, 65043, 65044, 65045, 65046, 65047, 65048, 65049, 65072, 65073, 65074, 65075,
+    65076, 65077, 65078, 65079, 65080, 65081, 65082, 65083, 65084, 65085, 65086, 65087, 65088, 65089, 65090, 65091,
+    65092, 65095, 65096, 65097, 65098, 65099, 65100, 65101, 65102, 65103, 65104, 65105, 65106, 65108, 65109, 65110,
+    65111, 65112, 65113, 65114, 65115, 65116, 65117, 65118, 65119, 65120, 65121, 65122, 65123, 65124, 65125, 65126,
+    65128, 65129, 65130, 65131, 65136, 65137, 65138, 65140, 65142, 65143, 65144, 65145, 65146, 65147, 65148, 65149,
+    65150, 65151, 65152, 65153, 65154, 65155, 65156, 65157, 65158, 65159, 65160, 65161, 65162, 65163, 65164, 65165,
+    65166, 65167, 65168, 65169, 65170, 65171, 65172, 65173, 65174, 65175, 65176, 65177, 65178, 65179, 65180, 65181,
+    65182, 65183, 65184, 65185, 65186, 65187, 65188, 65189, 65190, 65191, 65192, 65193, 65194, 65195, 65196, 65197,
+    65198, 65199, 65200, 65201, 65202, 65203, 65204, 65205, 65206, 65207, 65208, 65209, 65210, 65211, 65212, 65213,
+    65214, 65215, 65216, 65217, 65218, 65219, 65220, 65221, 65222, 65223, 65224, 65225, 65226, 65227, 65228, 65229,
+    65230, 65231, 65232, 65233, 65234, 65235, 65236, 65237, 65238, 65239, 65240, 65241, 65242, 65243, 65244, 65245,
+    65246, 65247, 65248, 65249, 65250, 65251, 65252, 65253, 65254, 65255, 65256, 65257, 65258, 65259, 65260, 65261,
+    65262, 65263, 65264, 65265, 65266, 65267, 65268, 65269, 65270, 65271, 65272, 65273, 65274, 65275, 65276, 65281,
+    65282, 65283, 65284, 65285, 65286, 65287, 65288, 65289, 65290, 65291, 65292, 65293, 65294, 65295, 65296, 65297,
+    65298, 65299, 65300, 65301, 65302, 65303, 65304, 65305, 65306, 65307, 65308, 65309, 65310, 65311, 65312, 65313,
+    65314, 65315, 65316, 65317, 65318, 65319, 65320, 65321, 65322, 65323, 65324, 65325, 65326, 65327, 65328, 65329,
+    65330, 65331, 65332, 65333, 65334, 65335, 65336, 65337, 65338, 65339, 65340, 65341, 65342, 65343, 65344, 65345,
+    65346, 65347, 65348, 65349, 65350, 65351, 65352, 65353, 65354, 65355, 65356, 65357, 65358, 65359, 65360, 65361,
+    65362, 65363, 65364, 65365, 65366, 65367, 65368, 65369, 65370, 65371, 65372, 65373, 65374, 65375, 65376, 65377,
+    65378, 65379, 65380, 65381, 65382, 65383, 65384, 65385, 65386, 65387, 65388, 65389, 65390, 65391, 65392, 65393,
+    65394, 65395, 65396, 65397, 65398, 65399, 65400, 65401, 65402, 65403, 65404, 65405, 65406, 65407, 65408, 65409,
+    65410, 65411, 65412, 65413, 65414, 65415, 65416, 65417, 65418, 65419, 65420, 65421, 65422, 65423, 65424, 65425,
+    65426, 65427, 65428, 65429, 65430, 65431, 65432, 65433, 65434, 65435, 65436, 65437, 65438, 65439, 65440, 65441,
+    65442, 65443, 65444, 65445, 65446, 65447, 65448, 65449, 65450, 65451, 65452, 65453, 65454, 65455, 65456, 65457,
+    65458, 65459, 65460, 65461, 65462, 65463, 65464, 65465, 65466, 65467, 65468, 65469, 65470, 65474, 65475, 65476,
+    65477, 65478, 65479, 65482, 65483, 65484, 65485, 65486, 65487, 65490, 65491, 65492, 65493, 65494, 65495, 65498,
+    65499, 65500, 65504, 65505, 65506, 65507, 65508, 65509, 65510, 65512, 65513, 65514, 65515, 65516, 65517, 65518,
+    67457, 67458, 67459, 67460, 67461, 67463, 67464, 67465, 67466, 67467, 67468, 67469, 67470, 67471, 67472, 67473,
+    67474, 67475, 67476, 67477, 67478, 67479, 67480, 67481, 67482, 67483, 67484, 67485, 67486, 67487, 67488, 67489,
+    67490, 67491, 67492, 67493, 67494, 67495, 67496, 67497, 67498, 67499, 67500, 67501, 67502, 67503, 67504, 67506,
+    67507, 67508, 67509, 67510, 67511, 67512, 67513, 67514, 69786, 69788, 69803, 69934, 69935, 70475, 70476, 70843,
+    70844, 70846, 71098, 71099, 71992, 119134, 119135, 119136, 119137, 119138, 119139, 119140, 119227, 119228, 119229, 119230,
+    119231, 119232, 119808, 119809, 119810, 119811, 119812, 119813, 119814, 119815, 119816, 119817, 119818, 119819, 119820, 119821,
+    119822, 119823, 119824, 119825, 119826, 119827, 119828, 119829, 119830, 119831, 119832, 119833, 119834, 119835, 119836, 119837,
+    119838, 119839, 119840, 119841, 119842, 119843, 119844, 119845, 119846, 119847, 119848, 119849, 119850, 119851, 119852, 119853,
+    119854, 119855, 119856, 119857, 119858, 119859, 119860, 119861, 119862, 119863, 119864, 119865, 119866, 119867, 119868, 119869,
+    119870, 119871, 119872, 119873, 119874, 119875, 119876, 119877, 119878, 119879, 119880, 119881, 119882, 119883, 119884, 119885,
+    119886, 119887, 119888, 119889, 119890, 119891, 119892, 119894, 119895, 119896, 119897, 119898, 119899, 119900, 119901, 119902,
+    119903, 119904, 119905, 119906, 119907, 119908, 119909, 119910, 119911, 119912, 119913, 119914, 119915, 119916, 119917, 119918,
+    119919, 119920, 119921, 119922, 119923, 119924, 119925, 119926, 119927, 119928, 119929, 119930, 119931, 119932, 119933, 119934,
+    119935, 119936, 119937, 119938, 119939, 119940, 119941, 119942, 119943, 119944, 119945, 119946, 119947, 119948, 119949, 119950,
+    119951, 119952, 119953, 119954, 119955, 119956, 119957, 119958, 119959, 119960, 119961, 119962, 119963, 119964, 119966, 119967,
+    119970, 119973, 119974, 119977, 119978, 119979, 119980, 119982, 119983, 119984, 119985, 119986, 119987, 119988, 119989, 119990,
+    119991, 119992, 119993, 119995, 119997, 119998, 119999, 120000, 120001, 120002, 120003, 120005, 120006, 120007, 120008, 120009,
+    120010, 120011, 120012, 120013, 120014, 120015, 120016, 120017, 120018, 120019, 120020, 120021, 120022, 120023, 120024, 120025,
+    120026, 120027, 120028, 120029, 120030, 120031, 120032, 120033, 120034, 120035, 120036, 120037, 120038, 120039, 120040, 120041,
+    120042, 120043, 120044, 120045, 120046, 120047, 120048, 120049, 120050, 120051, 120052, 120053, 120054, 120055, 120056, 120057,
+    120058, 120059, 120060, 120061, 120062, 120063, 120064, 120065, 120066, 120067, 120068, 120069, 120071, 120072, 120073, 120074,
+    120077, 120078, 120079, 120080, 120081, 120082, 120083, 120084, 120086, 120087, 120088, 120089, 120090, 120091, 120092, 120094,
+    120095, 120096, 120097, 120098, 120099, 120100, 120101, 120102, 120103, 120104, 120105, 120106, 120107, 120108, 120109, 120110,
+    120111, 120112, 120113, 120114, 120115, 120116, 120117, 120118, 120119, 120120, 120121, 120123, 120124, 120125, 120126, 120128,
+    120129, 120130, 120131, 120132, 120134, 120138, 120139, 120140, 120141, 120142, 120143, 120144, 120146, 120147, 120148, 120149,
+    120150, 120151, 120152, 120153, 120154, 120155, 120156, 120157, 120158, 120159, 120160, 120161, 120162, 120163, 120164, 120165,
+    120166, 120167, 120168, 120169, 120170, 120171, 120172, 120173, 120174, 120175, 120176, 120177, 120178, 120179, 120180, 120181,
+    120182, 120183, 120184, 120185, 120186, 120187, 120188, 120189, 120190, 120191, 120192, 120193, 120194, 120195, 120196, 120197,
+    120198, 120199, 120200, 120201, 120202, 120203, 120204, 120205, 120206, 120207, 120208, 120209, 120210, 120211, 120212, 120213,
+    120214, 120215, 120216, 120217, 120218, 120219, 120220, 120221, 120222, 120223, 120224, 120225, 120226, 120227, 120228, 120229,
+    120230, 120231, 120232, 120233, 120234, 120235, 120236, 120237, 120238, 120239, 120240, 120241, 120242, 120243, 120244, 120245,
+    120246, 120247, 120248, 120249, 120250, 120251, 120252, 120253, 120254, 120255, 120256, 120257, 120258, 120259, 120260, 120261,
+    120262, 120263, 120264, 120265, 120266, 120267, 120268, 120269, 120270, 120271, 120272, 120273, 120274, 120275, 120276, 120277,
+    120278, 120279, 120280, 120281, 120282, 120283, 120284, 120285, 120286, 120287, 120288, 120289, 120290, 120291, 120292, 120293,
+    120294, 120295, 120296, 120297, 120298, 120299, 120300, 120301, 120302, 120303, 120304, 120305, 120306, 120307, 120308, 120309,
+    120310, 120311, 120312, 120313, 120314, 120315, 120316, 120317, 120318, 120319, 120320, 120321, 120322, 120323, 120324, 120325,
+    120326, 120327, 120328, 120329, 120330, 120331, 120332, 120333, 120334, 120335, 120336, 120337, 120338, 120339, 120340, 120341,
+    120342, 120343, 120344, 120345, 120346, 120347, 120348, 120349, 120350, 120351, 120352, 120353, 120354, 120355, 120356, 120357,
+    120358, 120359, 120360, 120361, 120362, 120363, 120364, 120365, 120366, 120367, 120368, 120369, 120370, 120371, 120372, 120373,
+    120374, 120375, 120376, 120377, 120378, 120379, 120380, 120381, 120382, 120383, 120384, 120385, 120386, 120387, 120388, 120389,
+    120390, 120391, 120392, 120393, 120394, 120395, 120396, 120397, 120398, 120399, 120400, 120401, 120402, 120403, 120404, 120405,
+    120406, 120407, 120408, 120409, 120410, 120411, 120412, 120413, 120414, 120415, 120416, 120417, 120418, 120419, 120420, 120421,
+    120422, 120423, 120424, 120425, 120426, 120427, 120428, 120429, 120430, 120431, 120432, 120433, 120434, 120435, 120436, 120437,
+    120438, 120439, 120440, 120441, 120442, 120443, 120444, 120445, 120446, 120447, 120448, 120449, 120450, 120451, 120452, 120453,
+    120454, 120455, 120456, 120457, 120458, 120459, 120460, 120461, 120462, 120463, 120464, 120465, 120466, 120467, 120468, 120469,
+    120470, 120471, 120472, 120473, 120474, 120475, 120476, 120477, 120478, 120479, 120480, 120481, 120482, 120483, 120484, 120485,
+    120488, 120489, 120490, 120491, 120492, 120493, 120494, 120495, 120496, 120497, 120498, 120499, 120500, 120501, 120502, 120503,
+    120504, 120505, 120506, 120507, 120508, 120509, 120510, 120511, 120512, 120513, 120514, 120515, 120516, 120517, 120518, 120519,
+    120520, 120521, 120522, 120523, 120524, 120525, 120526, 120527, 120528, 120529, 120530, 120531, 120532, 120533, 120534, 120535,
+    120536, 120537, 120538, 120539, 120540, 120541, 120542, 120543, 120544, 120545, 120546, 120547, 120548, 120549, 120550, 120551,
+    120552, 120553, 120554, 120555, 120556, 120557, 120558, 120559, 120560, 120561, 120562, 120563, 120564, 120565, 120566, 120567,
+    120568, 120569, 120570, 120571, 120572, 120573, 120574, 120575, 120576, 120577, 120578, 120579, 120580, 120581, 120582, 120583,
+    120584, 120585, 120586, 120587, 120588, 120589, 120590, 120591, 120592, 120593, 120594, 120595, 120596, 120597, 120598, 120599,
+    120600, 120601, 120602, 120603, 120604, 120605, 120606, 120607, 120608, 120609, 120610, 120611, 120612, 120613, 120614, 120615,
+    120616, 120617, 120618, 120619, 120620, 120621, 120622, 120623, 120624, 120625, 120626, 120627, 120628, 120629, 120630, 120631,
+    120632, 120633, 120634, 120635, 120636, 120637, 120638, 120639, 120640, 120641, 120642, 120643, 120644, 120645, 120646, 120647,
+    120648, 120649, 120650, 120651, 120652, 120653, 120654, 120655, 120656, 120657, 120658, 120659, 120660, 120661, 120662, 120663,
+    120664, 120665, 120666, 120667, 120668, 120669, 120670, 120671, 120672, 120673, 120674, 120675, 120676, 120677, 120678, 120679,
+    120680, 120681, 120682, 120683, 120684, 120685, 120686, 120687, 120688, 120689, 120690, 120691, 120692, 120693, 120694, 120695,
+    120696, 120697, 120698, 120699, 120700, 120701, 120702, 120703, 120704, 120705, 120706, 120707, 120708, 120709, 120710, 120711,
+    120712, 120713, 120714, 120715, 120716, 120717, 120718, 120719, 120720, 120721, 120722, 120723, 120724, 120725, 120726, 120727,
+    120728, 120729, 120730, 120731, 120732, 120733, 120734, 120735, 120736, 120737, 120738, 120739, 120740, 120741, 120742, 120743,
+    120744, 120745, 120746, 120747, 120748, 120749, 120750, 120751, 120752, 120753, 120754, 120755, 120756, 120757, 120758, 120759,
+    120760, 120761, 120762, 120763, 120764, 120765, 120766, 120767, 120768, 120769, 120770, 120771, 120772, 120773, 120774, 120775,
+    120776, 120777, 120778, 120779, 120782, 120783, 120784, 120785, 120786, 120787, 120788, 120789, 120790, 120791, 120792, 120793,
+    120794, 120795, 120796, 120797, 120798, 120799, 120800, 120801, 120802, 120803, 120804, 120805, 120806, 120807, 120808, 120809,
+    120810, 120811, 120812, 120813, 120814, 120815, 120816, 120817, 120818, 120819, 120820, 120821, 120822, 120823, 120824, 120825,
+    120826, 120827, 120828, 120829, 120830, 120831, 126464, 126465, 126466, 126467, 126469, 126470, 126471, 126472, 126473, 126474,
+    126475, 126476, 126477, 126478, 126479, 126480, 126481, 126482, 126483, 126484, 126485, 126486, 126487, 126488, 126489, 126490,
+    126491, 126492, 126493, 126494, 126495, 126497, 126498, 126500, 126503, 126505, 126506, 126507, 126508, 126509, 126510, 126511,
+    126512, 126513, 126514, 126516, 126517, 126518, 126519, 126521, 126523, 126530, 126535, 126537, 126539, 126541, 126542, 126543,
+    126545, 126546, 126548, 126551, 126553, 126555, 126557, 126559, 126561, 126562, 126564, 126567, 126568, 126569, 126570, 126572,
+    126573, 126574, 126575, 126576, 126577, 126578, 126580, 126581, 126582, 126583, 126585, 126586, 126587, 126588, 126590, 126592,
+    126593, 126594, 126595, 126596, 126597, 126598, 126599, 126600, 126601, 126603, 126604, 126605, 126606, 126607, 126608, 126609,
+    126610, 126611, 126612, 126613, 126614, 126615, 126616, 126617, 126618, 126619, 126625, 126626, 126627, 126629, 126630, 126631,
+    126632, 126633, 126635, 126636, 126637, 126638, 126639, 126640, 126641, 126642, 126643, 126644, 126645, 126646, 126647, 126648,
+    126649, 126650, 126651, 127232, 127233, 127234, 127235, 127236, 127237, 127238, 127239, 127240, 127241, 127242, 127248, 127249,
+    127250, 127251, 127252, 127253, 127254, 127255, 127256, 127257, 127258, 127259, 127260, 127261, 127262, 127263, 127264, 127265,
+    127266, 127267, 127268, 127269, 127270, 127271, 127272, 127273, 127274, 127275, 127276, 127277, 127278, 127280, 127281, 127282,
+    127283, 127284, 127285, 127286, 127287, 127288, 127289, 127290, 127291, 127292, 127293, 127294, 127295, 127296, 127297, 127298,
+    127299, 127300, 127301, 127302, 127303, 127304, 127305, 127306, 127307, 127308, 127309, 127310, 127311, 127338, 127339, 127340,
+    127376, 127488, 127489, 127490, 127504, 127505, 127506, 127507, 127508, 127509, 127510, 127511, 127512, 127513, 127514, 127515,
+    127516, 127517, 127518, 127519, 127520, 127521, 127522, 127523, 127524, 127525, 127526, 127527, 127528, 127529, 127530, 127531,
+    127532, 127533, 127534, 127535, 127536, 127537, 127538, 127539, 127540, 127541, 127542, 127543, 127544, 127545, 127546, 127547,
+    127552, 127553, 127554, 127555, 127556, 127557, 127558, 127559, 127560, 127568, 127569, 130032, 130033, 130034, 130035, 130036,
+    130037, 130038, 130039, 130040, 130041, 194560, 194561, 194562, 194563, 194564, 194565, 194566, 194567, 194568, 194569, 194570,
+    194571, 194572, 194573, 194574, 194575, 194576, 194577, 194578, 194579, 194580, 194581, 194582, 194583, 194584, 194585, 194586,
+    194587, 194588, 194589, 194590, 194591, 194592, 194593, 194594, 194595, 194596, 194597, 194598, 194599, 194600, 194601, 194602,
+    194603, 194604, 194605, 194606, 194607, 194608, 194609, 194610, 194611, 194612, 194613, 194614, 194615, 194616, 194617, 194618,
+    194619, 194620, 194621, 194622, 194623, 194624, 194625, 194626, 194627, 194628, 194629, 194630, 194631, 194632, 194633, 194634,
+    194635, 194636, 194637, 194638, 194639, 194640, 194641, 194642, 194643, 194644, 194645, 194646, 194647, 194648, 194649, 194650,
+    194651, 194652, 194653, 194654, 194655, 194656, 194657, 194658, 194659, 194660, 194661, 194662, 194663, 194664, 194665, 194666,
+    194667, 194668, 194669, 194670, 194671, 194672, 194673, 194674, 194675, 194676, 194677, 194678, 194679, 194680, 194681, 194682,
+    194683, 194684, 194685, 194686, 194687, 194688, 194689, 194690, 194691, 194692, 194693, 194694, 194695, 194696, 194697, 194698,
+    194699, 194700, 194701, 194702, 194703, 194704, 194705, 194706, 194707, 194708, 194709, 194710, 194711, 194712, 194713, 194714,
+    194715, 194716, 194717, 194718, 194719, 194720, 194721, 194722, 194723, 194724, 194725, 194726, 194727, 194728, 194729, 194730,
+    194731, 194732, 194733, 194734, 194735, 194736, 194737, 194738, 194739, 194740, 194741, 194742, 194743, 194744, 194745, 194746,
+    194747, 194748, 194749, 194750, 194751, 194752, 194753, 194754, 194755, 194756, 194757, 194758, 194759, 194760, 194761, 194762,
+    194763, 194764, 194765, 194766, 194767, 194768, 194769, 194770, 194771, 194772, 194773, 194774, 194775, 194776, 194777, 194778,
+    194779, 194780, 194781, 194782, 194783, 194784, 194785, 194786, 194787, 194788, 194789, 194790, 194791, 194792, 194793, 194794,
+    194795, 194796, 194797, 194798, 194799, 194800, 194801, 194802, 194803, 194804, 194805, 194806, 194807, 194808, 194809, 194810,
+    194811, 194812, 194813, 194814, 194815, 194816, 194817, 194818, 194819, 194820, 194821, 194822, 194823, 194824, 194825, 194826,
+    194827, 194828, 194829, 194830, 194831, 194832, 194833, 194834, 194835, 194836, 194837, 194838, 194839, 194840, 194841, 194842,
+    194843, 194844, 194845, 194846, 194847, 194848, 194849, 194850, 194851, 194852, 194853, 194854, 194855, 194856, 194857, 194858,
+    194859, 194860, 194861, 194862, 194863, 194864, 194865, 194866, 194867, 194868, 194869, 194870, 194871, 194872, 194873, 194874,
+    194875, 194876, 194877, 194878, 194879, 194880, 194881, 194882, 194883, 194884, 194885, 194886, 194887, 194888, 194889, 194890,
+    194891, 194892, 194893, 194894, 194895, 194896, 194897, 194898, 194899, 194900, 194901, 194902, 194903, 194904, 194905, 194906,
+    194907, 194908, 194909, 194910, 194911, 194912, 194913, 194914, 194915, 194916, 194917, 194918, 194919, 194920, 194921, 194922,
+    194923, 194924, 194925, 194926, 194927, 194928, 194929, 194930, 194931, 194932, 194933, 194934, 194935, 194936, 194937, 194938,
+    194939, 194940, 194941, 194942, 194943, 194944, 194945, 194946, 194947, 194948, 194949, 194950, 194951, 194952, 194953, 194954,
+    194955, 194956, 194957, 194958, 194959, 194960, 194961, 194962, 194963, 194964, 194965, 194966, 194967, 194968, 194969, 194970,
+    194971, 194972, 194973, 194974, 194975, 194976, 194977, 194978, 194979, 194980, 194981, 194982, 194983, 194984, 194985, 194986,
+    194987, 194988, 194989, 194990, 194991, 194992, 194993, 194994, 194995, 194996, 194997, 194998, 194999, 195000, 195001, 195002,
+    195003, 195004, 195005, 195006, 195007, 195008, 195009, 195010, 195011, 195012, 195013, 195014, 195015, 195016, 195017, 195018,
+    195019, 195020, 195021, 195022, 195023, 195024, 195025, 195026, 195027, 195028, 195029, 195030, 195031, 195032, 195033, 195034,
+    195035, 195036, 195037, 195038, 195039, 195040, 195041, 195042, 195043, 195044, 195045, 195046, 195047, 195048, 195049, 195050,
+    195051, 195052, 195053, 195054, 195055, 195056, 195057, 195058, 195059, 195060, 195061, 195062, 195063, 195064, 195065, 195066,
+    195067, 195068, 195069, 195070, 195071, 195072, 195073, 195074, 195075, 195076, 195077, 195078, 195079, 195080, 195081, 195082,
+    195083, 195084, 195085, 195086, 195087, 195088, 195089, 195090, 195091, 195092, 195093, 195094, 195095, 195096, 195097, 195098,
+    195099, 195100, 195101,
+};
+
+// the (offset << 8 | length) of the NFD and the NFKD of each of them in kDecompositionPool, 0 for itself
+const uint32_t kCanonicalDecompositions[5795] = {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6146, 6658,
+    7170, 7682, 8194, 8706, 9218, 9730, 10242, 10754,
+    11266, 11778, 12290, 12802, 13314, 13826, 14338, 14850,
+    15362, 15874, 16386, 16898, 17410, 17922, 18434, 18946,
+    19458, 19970, 20482, 20994, 21506, 22018, 22530, 23042,
+    23554, 24066, 24578, 25090, 25602, 26114, 26626, 27138,
+    27650, 28162, 28674, 29186, 29698, 30210, 30722, 31234,
+    31746, 32258, 32770, 33282, 33794, 34306, 34818, 35330,
+    35842, 36354, 36866, 37378, 37890, 38402, 38914, 39426,
+    39938, 40450, 40962, 41474, 41986, 42498, 43010, 43522,
+    44034, 44546, 45058, 45570, 46082, 46594, 47106, 47618,
+    48130, 48642, 49154, 49666, 50178, 50690, 51202, 51714,
+    52226, 52738, 53250, 53762, 54274, 54786, 55298, 55810,
+    0, 0, 57346, 57858, 58370, 58882, 59394, 59906,
+    60418, 60930, 61442, 61954, 0, 0, 63490, 64002,
+    64514, 65026, 65538, 66050, 0, 67074, 67586, 68098,
+    68610, 69122, 69634, 70146, 70658, 71170, 71682, 72194,
+    72706, 73218, 73730, 74242, 74754, 75266, 75778, 76290,
+    76802, 77314, 77826, 78338, 78850, 79362, 79874, 80386,
+    80898, 81410, 81922, 82434, 82946, 83458, 83970, 84482,
+    84994, 85506, 86018, 86530, 87042, 87554, 88066, 88578,
+    89090, 89602, 90114, 90626, 0, 91394, 91906, 92418,
+    92930, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 98818, 99330, 99842, 100354, 100866, 101378,
+    101890, 102402, 102915, 103683, 104451, 105219, 105987, 106755,
+    107523, 108291, 109059, 109827, 110595, 111363, 112130, 112642,
+    113154, 113666, 114178, 114690, 115202, 115714, 116227, 116995,
+    117762, 118274, 118786, 0, 0, 0, 120834, 121346,
+    121858, 122370, 122883, 123651, 124418, 124930, 125442, 125954,
+    126466, 126978, 127490, 128002, 128514, 129026, 129538, 130050,
+    130562, 131074, 131586, 132098, 132610, 133122, 133634, 134146,
+    134658, 135170, 135682, 136194, 136706, 137218, 137730, 138242,
+    138754, 139266, 139778, 140290, 140802, 141314, 141826, 142338,
+    142850, 143362, 143875, 144643, 145411, 146179, 146946, 147458,
+    147971, 148739, 149506, 150018, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    156929, 157185, 157441, 157698, 158209, 0, 158977, 0,
+    159234, 160514, 161025, 161282, 161794, 162306, 162818, 163330,
+    163842, 164355, 165122, 165634, 166146, 166658, 167170, 167682,
+    168195, 168962, 169474, 169986, 170498, 171010, 0, 0,
+    0, 172290, 172802, 0, 0, 0, 0, 0,
+    0, 0, 0, 175362, 175874, 176386, 176898, 177410,
+    177922, 178434, 178946, 179458, 179970, 180482, 180994, 181506,
+    182018, 182530, 183042, 183554, 184066, 184578, 185090, 185602,
+    186114, 186626, 187138, 187650, 188162, 188674, 189186, 189698,
+    190210, 190722, 191234, 191746, 192258, 192770, 193282, 193794,
+    194306, 194818, 195330, 195842, 196354, 196866, 197378, 197890,
+    198402, 198914, 199426, 199938, 200450, 200962, 201474, 0,
+    202498, 203010, 203522, 204034, 204546, 0, 0, 0,
+    0, 207106, 207618, 208130, 208642, 209154, 209666, 210178,
+    210690, 211202, 211714, 212226, 212738, 213250, 213762, 214274,
+    214786, 215298, 215810, 216322, 216834, 217346, 217858, 218370,
+    218882, 219394, 219906, 220418, 220930, 221442, 221954, 222466,
+    222978, 223490, 224002, 224514, 225026, 225538, 226050, 226562,
+    227075, 227842, 228354, 228866, 229378, 229890, 230403, 231170,
+    0, 0, 0, 0, 0, 233986, 234498, 235010,
+    235522, 236034, 236546, 237058, 237570, 238082, 0, 239362,
+    0, 240642, 241154, 241666, 242178, 242690, 243202, 243714,
+    244226, 0, 244994, 245506, 246018, 246530, 247042, 247554,
+    248066, 248578, 249090, 249602, 250114, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 272130,
+    272642, 273154, 273666, 274178, 274690, 275202, 275714, 276227,
+    276995, 277762, 278274, 278786, 279298, 279810, 280322, 280834,
+    281346, 281858, 282370, 282883, 283651, 284419, 285187, 285954,
+    286466, 286978, 287490, 288003, 288771, 289538, 290050, 290562,
+    291074, 291586, 292098, 292610, 293122, 293634, 294146, 294658,
+    295170, 295682, 296194, 296706, 297218, 297731, 298499, 299266,
+    299778, 300290, 300802, 301314, 301826, 302338, 302850, 303363,
+    304131, 304898, 305410, 305922, 306434, 306946, 307458, 307970,
+    308482, 308994, 309506, 310018, 310530, 311042, 311554, 312066,
+    312578, 313090, 313602, 314115, 314883, 315651, 316419, 317187,
+    317955, 318723, 319491, 320258, 320770, 321282, 321794, 322306,
+    322818, 323330, 323842, 324355, 325123, 325890, 326402, 326914,
+    327426, 327938, 328450, 328963, 329731, 330499, 331267, 332035,
+    332803, 333570, 334082, 334594, 335106, 335618, 336130, 336642,
+    337154, 337666, 338178, 338690, 339202, 339714, 340226, 340739,
+    341507, 342275, 343043, 343810, 344322, 344834, 345346, 345858,
+    346370, 346882, 347394, 347906, 348418, 348930, 349442, 349954,
+    350466, 350978, 351490, 352002, 352514, 353026, 353538, 354050,
+    354562, 355074, 355586, 356098, 356610, 357122, 357634, 358146,
+    358658, 0, 359682, 360194, 360706, 361218, 361730, 362243,
+    363011, 363779, 364547, 365315, 366083, 366851, 367619, 368387,
+    369155, 369923, 370691, 371459, 372227, 372995, 373763, 374531,
+    375299, 376067, 376835, 377602, 378114, 378626, 379138, 379650,
+    380162, 380675, 381443, 382211, 382979, 383747, 384515, 385283,
+    386051, 386819, 387587, 388354, 388866, 389378, 389890, 390402,
+    390914, 391426, 391938, 392451, 393219, 393987, 394755, 395523,
+    396291, 397059, 397827, 398595, 399363, 400131, 400899, 401667,
+    402435, 403203, 403971, 404739, 405507, 406275, 407043, 407810,
+    408322, 408834, 409346, 409859, 410627, 411395, 412163, 412931,
+    413699, 414467, 415235, 416003, 416771, 417538, 418050, 418562,
+    419074, 419586, 420098, 420610, 421122, 421634, 422146, 422659,
+    423427, 424195, 424963, 425731, 426499, 427266, 427778, 428291,
+    429059, 429827, 430595, 431363, 432131, 432898, 433410, 433923,
+    434691, 435459, 436227, 436994, 437506, 438019, 438787, 439555,
+    440323, 441090, 441602, 442115, 442883, 443651, 444419, 445187,
+    445955, 446722, 447234, 447747, 448515, 449283, 450051, 450819,
+    451587, 452354, 452866, 453379, 454147, 454915, 455683, 456451,
+    457219, 457986, 458498, 459011, 459779, 460547, 461315, 462083,
+    462851, 463618, 464130, 464643, 465411, 466179, 466947, 467714,
+    468226, 468739, 469507, 470275, 471043, 471810, 472322, 472835,
+    473603, 474371, 475139, 475907, 476675, 477442, 477955, 478723,
+    479491, 480258, 480770, 481283, 482051, 482819, 483587, 484355,
+    485123, 485890, 486402, 486915, 487683, 488451, 489219, 489987,
+    490755, 491522, 166146, 492034, 166658, 492546, 167170, 493058,
+    167682, 493570, 169986, 494082, 170498, 494594, 171010, 495107,
+    495875, 496644, 497668, 498692, 499716, 500740, 501764, 502787,
+    503555, 504324, 505348, 506372, 507396, 508420, 509444, 510467,
+    511235, 512004, 513028, 514052, 515076, 516100, 517124, 518147,
+    518915, 519684, 520708, 521732, 522756, 523780, 524804, 525827,
+    526595, 527364, 528388, 529412, 530436, 531460, 532484, 533507,
+    534275, 535044, 536068, 537092, 538116, 539140, 540164, 541186,
+    541698, 542211, 542978, 543491, 544258, 544771, 545538, 546050,
+    546562, 160514, 547074, 0, 548097, 0, 0, 548866,
+    550147, 550914, 551427, 552194, 552707, 553474, 161282, 553986,
+    161794, 554498, 555010, 556290, 557570, 558850, 559362, 559875,
+    164355, 560642, 561155, 561922, 562434, 562946, 162306, 563458,
+    564738, 566018, 567298, 567810, 568323, 168195, 569090, 569602,
+    570114, 570627, 571394, 571906, 572418, 163330, 572930, 573442,
+    159234, 574721, 574979, 575746, 576259, 577026, 577539, 578306,
+    162818, 578818, 163842, 579330, 579841, 0, 580609, 580865,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 601089, 0, 253185, 8706, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 629506, 630018,
+    630530, 631042, 631554, 632066, 632578, 633090, 633602, 634114,
+    634626, 0, 0, 0, 0, 637698, 638210, 638722,
+    639234, 639746, 640258, 640770, 641282, 641794, 642306, 642818,
+    643330, 643842, 644354, 644866, 645378, 645890, 646402, 646914,
+    647426, 647938, 648450, 648962, 649474, 649986, 650498, 651010,
+    651522, 652034, 652546, 653058, 653570, 654082, 654593, 654849,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 715778,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    772610, 773122, 773634, 774146, 774658, 775170, 775682, 776194,
+    776706, 777218, 777730, 778242, 778754, 779266, 779778, 780290,
+    780802, 781314, 781826, 782338, 782850, 783362, 783874, 784386,
+    784898, 785410, 0, 0, 786946, 0, 787970, 788482,
+    788994, 789506, 790018, 790530, 791042, 791554, 792066, 792578,
+    793090, 793602, 794114, 794626, 795138, 795650, 796162, 796674,
+    797186, 797698, 798210, 798722, 799234, 799746, 800258, 800770,
+    801282, 801794, 802306, 802818, 803330, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1144321, 1144577, 757505,
+    1144833, 1145089, 1145345, 1145601, 771329, 771329, 1145857, 759553,
+    1146113, 1146369, 1146625, 1146881, 1147137, 1147393, 1147649, 1147905,
+    1148161, 1148417, 1148673, 1148929, 1149185, 1149441, 1149697, 1149953,
+    1150209, 1150465, 1150721, 1150977, 1151233, 1151489, 1151745, 1152001,
+    1152257, 1152513, 1152769, 1153025, 1153281, 1153537, 1153793, 1154049,
+    1154305, 1154561, 1154817, 1155073, 1155329, 1155585, 1155841, 1156097,
+    1156353, 748801, 1156609, 1156865, 1157121, 1157377, 1157633, 1157889,
+    1158145, 1158401, 1158657, 1158913, 1159169, 767489, 1159425, 1159681,
+    1159937, 1160193, 1160449, 1160705, 1160961, 1161217, 1161473, 1161729,
+    1161985, 1162241, 1162497, 1162753, 1163009, 1163265, 1163521, 1163777,
+    1164033, 1164289, 1164545, 1164801, 1165057, 1165313, 1165569, 1165825,
+    1166081, 1148417, 1166337, 1166593, 1166849, 1167105, 1167361, 1167617,
+    1167873, 1168129, 1168385, 1168641, 1168897, 1169153, 1169409, 1169665,
+    1169921, 1170177, 1170433, 1170689, 1170945, 1171201, 758017, 1171457,
+    1171713, 1171969, 1172225, 1172481, 1172737, 1172993, 1173249, 1173505,
+    1173761, 1174017, 1174273, 1174529, 1174785, 1175041, 726529, 1175297,
+    1175553, 1175809, 1176065, 1176321, 1176577, 1176833, 1177089, 721665,
+    1177345, 1177601, 1177857, 1178113, 1178369, 1178625, 1178881, 1179137,
+    1179393, 1179649, 1179905, 1180161, 1180417, 1180673, 1180929, 1181185,
+    1181441, 1181697, 1181953, 1182209, 1182465, 1182721, 1170945, 1182977,
+    1183233, 1183489, 1183745, 1184001, 1184257, 1184513, 1184769, 1166849,
+    1185025, 1185281, 1185537, 1185793, 1186049, 1186305, 1186561, 1186817,
+    1187073, 1187329, 1187585, 1187841, 1188097, 1188353, 1188609, 1188865,
+    1189121, 1189377, 1189633, 1189889, 1148417, 1190145, 1190401, 1190657,
+    1190913, 771073, 1191169, 1191425, 1191681, 1191937, 1192193, 1192449,
+    1192705, 1192961, 1193217, 1193473, 1193729, 1193985, 907521, 1194241,
+    1194497, 1194753, 1195009, 1195265, 1195521, 1195777, 1196033, 1196289,
+    1167361, 1196545, 1196801, 1197057, 1197313, 1197569, 1197825, 1198081,
+    1198337, 1198593, 1198849, 1199105, 1199361, 1199617, 759297, 1199873,
+    1200129, 1200385, 1200641, 1200897, 1201153, 1201409, 1201665, 1201921,
+    1202177, 1202433, 1202689, 1202945, 746753, 1203201, 1203457, 1203713,
+    1203969, 1204225, 1204481, 1204737, 1204993, 1205249, 1205505, 1205761,
+    1206017, 1206273, 1206529, 1206785, 1207041, 753665, 1207297, 754433,
+    1207553, 1207809, 1208065, 1208321, 1208577, 1208833, 1209089, 1209345,
+    1209601, 1209857, 1210113, 1210369, 1210625, 1210881, 748545, 1211137,
+    1211393, 1211649, 1211905, 1212161, 1212417, 1212673, 1212929, 1213185,
+    1213441, 1213697, 1213953, 1214209, 1214465, 1214721, 1214977, 1215233,
+    1215489, 1215745, 1216001, 1216257, 1216513, 728321, 1216769, 1217025,
+    1217281, 1217537, 1217793, 1218049, 1218305, 1218561, 1218817, 1219073,
+    1219329, 1219585, 1219841, 1220097, 1220353, 908801, 1220609, 1220865,
+    1221121, 1221377, 909825, 1221633, 1221889, 1222145, 1222401, 1222657,
+    1180161, 1222913, 1223169, 1223425, 1223681, 1223937, 1224193, 1224193,
+    1224449, 1224705, 1224961, 1225217, 1225473, 1225729, 1225985, 1226241,
+    1211649, 1226497, 1226753, 1227009, 1227265, 1227521, 1227777, 1228033,
+    1228289, 1228545, 1228801, 1229057, 1229313, 1229569, 1229825, 1215233,
+    1230081, 1230337, 1230593, 1208321, 1230849, 1231105, 1231361, 1231617,
+    1231873, 1232129, 1232385, 1232641, 1232897, 1233153, 1233409, 1233665,
+    1217281, 1233921, 1217537, 1234177, 1234433, 1234689, 1234945, 1235201,
+    1208577, 1153793, 1235457, 1235713, 736769, 1171201, 1192449, 1235969,
+    1236225, 1219329, 1236481, 1219585, 1236737, 1236993, 1237249, 1209089,
+    1237505, 1237761, 1238017, 1238273, 1238529, 1209345, 1238785, 1239041,
+    1239297, 1239553, 1239809, 1240065, 1222657, 1240321, 1240577, 1180161,
+    1240833, 1223681, 1241089, 1241345, 1241601, 1241857, 1242113, 1224961,
+    1242369, 1211393, 1242625, 1225217, 1166337, 1242881, 1225473, 1243137,
+    1225985, 1243393, 1243649, 1243905, 1244161, 1244417, 1226497, 1210625,
+    1244673, 1226753, 1244929, 1227009, 1245185, 771329, 1245441, 1245697,
+    1245953, 1246209, 1246465, 1246721, 1246977, 1247233, 1247489, 1247745,
+    1248001, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1254402, 1254914, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1257218, 1257730, 1258243, 1259011, 1259778, 1260290, 1260802,
+    1261314, 1261826, 1262338, 1262850, 1263362, 1263874, 1264386, 1264898,
+    1265410, 1265922, 1266434, 1266946, 1267458, 1267970, 1268482, 1268994,
+    1269506, 1270018, 1270530, 1271042, 1271554, 1272066, 1272578, 1273090,
+    1273602, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1516802, 1517314, 1517826, 1518338, 1518850, 1519362, 1519874, 1520386,
+    1520898, 1521410, 1521922, 1522434, 1522946, 1523458, 1523970, 1524483,
+    1525251, 1526019, 1526787, 1527555, 1528322, 1528834, 1529347, 1530115,
+    1530883, 1531651, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1590785, 1591041, 1591297,
+    1591553, 1591809, 1213697, 1592065, 1592321, 1592577, 1592833, 1213953,
+    1593089, 1593345, 1593601, 1214209, 1593857, 1594113, 1594369, 1594625,
+    1594881, 1595137, 1577985, 1595393, 1595649, 1595905, 1596161, 1596417,
+    1228289, 1596673, 721153, 1596929, 1597185, 1597441, 1597697, 1582593,
+    1597953, 1598209, 1229569, 1214465, 1214721, 1229825, 1598465, 1598721,
+    1167873, 1598977, 1214977, 1599233, 1599489, 1599745, 1600001, 1600001,
+    1600001, 1600257, 1600513, 1600769, 1601025, 1601281, 1601537, 1601793,
+    1602049, 1602305, 1602561, 1602817, 1603073, 1603329, 1603585, 1603841,
+    1604097, 1604353, 1604609, 1604609, 1230337, 1604865, 1605121, 1605377,
+    1605633, 1215489, 1605889, 1606145, 1606401, 1205249, 1606657, 1606913,
+    1607169, 1607425, 1607681, 1607937, 1608193, 1608449, 1608705, 1608961,
+    1609217, 1609473, 1576193, 1609729, 1609985, 1610241, 1610497, 1610753,
+    1611009, 1611265, 1611521, 1611777, 1612033, 1612289, 1612545, 1612801,
+    1612801, 1613057, 1613313, 1613569, 1166849, 1613825, 1614081, 1614337,
+    1614593, 1614849, 727809, 1615105, 1615361, 728321, 1615617, 1615873,
+    1616129, 1616385, 1616641, 1616897, 1617153, 1617409, 1617665, 1617921,
+    1618177, 1618433, 1618689, 1618945, 1619201, 1619457, 1619713, 1619969,
+    1620225, 1620481, 1620737, 1153537, 1620993, 730881, 1621249, 1621249,
+    1621505, 1621761, 1621761, 1622017, 1622273, 1622529, 1622785, 1623041,
+    1623297, 1623553, 1623809, 1624065, 1624321, 1624577, 1624833, 1625089,
+    1216769, 1625345, 1625601, 1625857, 1626113, 1233409, 1626113, 1626369,
+    1217281, 1626625, 1626881, 1627137, 1627393, 1217537, 1146625, 1627649,
+    1627905, 1628161, 1628417, 1628673, 1628929, 1629185, 1629441, 1629697,
+    1629953, 1630209, 1630465, 1630721, 1630977, 1631233, 1631489, 1631745,
+    1632001, 1632257, 1632513, 1632769, 1633025, 1217793, 1633281, 1633537,
+    1633793, 1634049, 1634305, 1634561, 1218305, 1634817, 1635073, 1635329,
+    1635585, 1635841, 1636097, 1636353, 1636609, 1153793, 1235457, 1636865,
+    1637121, 1637377, 1637633, 1637889, 1638145, 1638401, 1638657, 1218561,
+    1638913, 1639169, 1639425, 1639681, 1246209, 1639937, 1640193, 1640449,
+    1640705, 1640961, 1641217, 1641473, 1641729, 1641985, 1642241, 1642497,
+    1642753, 1643009, 1171201, 1643265, 1643521, 1643777, 1644033, 1644289,
+    1644545, 1644801, 1645057, 1645313, 1645569, 1645825, 1218817, 1192449,
+    1646081, 1646337, 1646593, 1646849, 1647105, 1647361, 1647617, 1647873,
+    1236225, 1648129, 1648385, 1648641, 1648897, 1649153, 1649409, 1649665,
+    1649921, 1236481, 1650177, 1650433, 1650689, 1650945, 1651201, 1651457,
+    1651713, 1651969, 1652225, 1652481, 1652737, 1652993, 1236993, 1653249,
+    1653505, 1653761, 1654017, 1654273, 1654529, 1654785, 1655041, 1655297,
+    1655553, 1655809, 1655809, 1656065, 1656321, 1237505, 1656577, 1656833,
+    1657089, 1657345, 1657601, 1657857, 1658113, 1167617, 1658369, 1658625,
+    1658881, 1659137, 1659393, 1659649, 1659905, 1239041, 1660161, 1660417,
+    1660673, 1660929, 1661185, 1661441, 1661441, 1239297, 1246721, 1661697,
+    1661953, 1662209, 1662465, 1662721, 1158145, 1239809, 1662977, 1663233,
+    1221377, 1663489, 1663745, 1210369, 1664001, 1664257, 1222145, 1664513,
+    1664769, 1665025, 1665281, 1665281, 1665537, 1665793, 1666049, 1666305,
+    1666561, 1666817, 1667073, 1667329, 1667585, 1667841, 1668097, 1668353,
+    1668609, 1668865, 1669121, 1669377, 1669633, 1669889, 1670145, 1670401,
+    1670657, 1670913, 1671169, 1671425, 1671681, 1671937, 1672193, 1223681,
+    1672449, 1672705, 1672961, 1673217, 1673473, 1673729, 1673985, 1674241,
+    1674497, 1674753, 1675009, 1675265, 1675521, 1675777, 1676033, 1676289,
+    1621505, 1676545, 1676801, 1677057, 1677313, 1677569, 1677825, 1678081,
+    1678337, 1678593, 1678849, 1679105, 1679361, 1171969, 1679617, 1679873,
+    1680129, 1680385, 1680641, 1680897, 1224449, 1681153, 1681409, 1681665,
+    1681921, 1682177, 1682433, 1682689, 1682945, 1683201, 1683457, 1683713,
+    1683969, 1684225, 1684481, 1684737, 1684993, 1685249, 1685505, 1685761,
+    1686017, 1156865, 1686273, 1686529, 1686785, 1687041, 1687297, 1687553,
+    1241601, 1687809, 1688065, 1688321, 1688577, 1688833, 1689089, 1689345,
+    1689601, 753921, 1689857, 1690113, 1690369, 1690625, 1690881, 1691137,
+    1691393, 1691649, 1691905, 1692161, 1692417, 1242881, 1243137, 755713,
+    1692673, 1692929, 1693185, 1693441, 1693697, 1693953, 1694209, 1694465,
+    1694721, 1694977, 1695233, 1695489, 1243393, 1695745, 1696001, 1696257,
+    1696513, 1696769, 1697025, 1697281, 1697537, 1697793, 1698049, 1698305,
+    1698561, 1698817, 1699073, 1699329, 1699585, 1699841, 1700097, 1700353,
+    1700609, 1700865, 1701121, 1701377, 1701633, 1701889, 1702145, 1702401,
+    1702657, 1702913, 1703169, 1244929, 1244929, 1703425, 1703681, 1703937,
+    1704193, 1704449, 1704705, 1704961, 1705217, 1705473, 1705729, 1245185,
+    1705985, 1706241, 1706497, 1706753, 1707009, 1707265, 1707521, 1707777,
+    1708033, 1708289, 768001, 1708545, 769025, 1708801, 1709057, 1709313,
+    1709569, 770305, 1709825,
+};
+
+const uint32_t kCompatibilityDecompositions[5795] = {
+    1, 258, 769, 1026, 1537, 1793, 2050, 2561,
+    2818, 3329, 3585, 3843, 4611, 5379, 6146, 6658,
+    7170, 7682, 8194, 8706, 9218, 9730, 10242, 10754,
+    11266, 11778, 12290, 12802, 13314, 13826, 14338, 14850,
+    15362, 15874, 16386, 16898, 17410, 17922, 18434, 18946,
+    19458, 19970, 20482, 20994, 21506, 22018, 22530, 23042,
+    23554, 24066, 24578, 25090, 25602, 26114, 26626, 27138,
+    27650, 28162, 28674, 29186, 29698, 30210, 30722, 31234,
+    31746, 32258, 32770, 33282, 33794, 34306, 34818, 35330,
+    35842, 36354, 36866, 37378, 37890, 38402, 38914, 39426,
+    39938, 40450, 40962, 41474, 41986, 42498, 43010, 43522,
+    44034, 44546, 45058, 45570, 46082, 46594, 47106, 47618,
+    48130, 48642, 49154, 49666, 50178, 50690, 51202, 51714,
+    52226, 52738, 53250, 53762, 54274, 54786, 55298, 55810,
+    56322, 56834, 57346, 57858, 58370, 58882, 59394, 59906,
+    60418, 60930, 61442, 61954, 62466, 62978, 63490, 64002,
+    64514, 65026, 65538, 66050, 66562, 67074, 67586, 68098,
+    68610, 69122, 69634, 70146, 70658, 71170, 71682, 72194,
+    72706, 73218, 73730, 74242, 74754, 75266, 75778, 76290,
+    76802, 77314, 77826, 78338, 78850, 79362, 79874, 80386,
+    80898, 81410, 81922, 82434, 82946, 83458, 83970, 84482,
+    84994, 85506, 86018, 86530, 87042, 87554, 88066, 88578,
+    89090, 89602, 90114, 90626, 91137, 91394, 91906, 92418,
+    92930, 93443, 94211, 94979, 95746, 96258, 96770, 97282,
+    97794, 98306, 98818, 99330, 99842, 100354, 100866, 101378,
+    101890, 102402, 102915, 103683, 104451, 105219, 105987, 106755,
+    107523, 108291, 109059, 109827, 110595, 111363, 112130, 112642,
+    113154, 113666, 114178, 114690, 115202, 115714, 116227, 116995,
+    117762, 118274, 118786, 119298, 119810, 120322, 120834, 121346,
+    121858, 122370, 122883, 123651, 124418, 124930, 125442, 125954,
+    126466, 126978, 127490, 128002, 128514, 129026, 129538, 130050,
+    130562, 131074, 131586, 132098, 132610, 133122, 133634, 134146,
+    134658, 135170, 135682, 136194, 136706, 137218, 137730, 138242,
+    138754, 139266, 139778, 140290, 140802, 141314, 141826, 142338,
+    142850, 143362, 143875, 144643, 145411, 146179, 146946, 147458,
+    147971, 148739, 149506, 150018, 150529, 150785, 151041, 151297,
+    151553, 151809, 152065, 152321, 152577, 152834, 153346, 153858,
+    154370, 154882, 155394, 155905, 156161, 91137, 156417, 156673,
+    156929, 157185, 157441, 157698, 158209, 158466, 158977, 2050,
+    159747, 160514, 161025, 161282, 161794, 162306, 162818, 163330,
+    163842, 164355, 165122, 165634, 166146, 166658, 167170, 167682,
+    168195, 168962, 169474, 169986, 170498, 171010, 171521, 171777,
+    172033, 163330, 165634, 173313, 173569, 173825, 174081, 174337,
+    174593, 174849, 175105, 175362, 175874, 176386, 176898, 177410,
+    177922, 178434, 178946, 179458, 179970, 180482, 180994, 181506,
+    182018, 182530, 183042, 183554, 184066, 184578, 185090, 185602,
+    186114, 186626, 187138, 187650, 188162, 188674, 189186, 189698,
+    190210, 190722, 191234, 191746, 192258, 192770, 193282, 193794,
+    194306, 194818, 195330, 195842, 196354, 196866, 197378, 197890,
+    198402, 198914, 199426, 199938, 200450, 200962, 201474, 201986,
+    202498, 203010, 203522, 204034, 204546, 205058, 205570, 206082,
+    206594, 207106, 207618, 208130, 208642, 209154, 209666, 210178,
+    210690, 211202, 211714, 212226, 212738, 213250, 213762, 214274,
+    214786, 215298, 215810, 216322, 216834, 217346, 217858, 218370,
+    218882, 219394, 219906, 220418, 220930, 221442, 221954, 222466,
+    222978, 223490, 224002, 224514, 225026, 225538, 226050, 226562,
+    227075, 227842, 228354, 228866, 229378, 229890, 230403, 231170,
+    231682, 232194, 232706, 233218, 233729, 233986, 234498, 235010,
+    235522, 236034, 236546, 237058, 237570, 238082, 238595, 239362,
+    239875, 240642, 241154, 241666, 242178, 242690, 243202, 243714,
+    244226, 244737, 244994, 245506, 246018, 246530, 247042, 247554,
+    248066, 248578, 249090, 249602, 250114, 250625, 250881, 251137,
+    251393, 251649, 251905, 252161, 252417, 252673, 252929, 253185,
+    253441, 253697, 253953, 254209, 254465, 254721, 254977, 255233,
+    255489, 255745, 769, 256001, 256257, 256513, 256769, 257025,
+    257281, 257537, 257793, 258049, 258305, 258561, 258817, 259073,
+    3585, 259329, 259585, 259841, 260097, 260353, 260609, 260865,
+    261121, 261377, 261633, 171521, 261889, 262145, 173313, 262401,
+    262657, 151297, 260609, 261377, 171521, 261889, 174081, 173313,
+    262401, 262913, 263169, 263425, 263681, 263937, 258049, 264193,
+    264449, 264705, 264961, 265217, 265473, 265729, 265985, 266241,
+    266497, 266753, 267009, 267265, 267521, 267777, 268033, 268289,
+    268545, 268801, 269057, 269313, 269569, 269825, 270081, 270337,
+    270593, 270849, 271105, 271361, 271617, 271873, 171777, 272130,
+    272642, 273154, 273666, 274178, 274690, 275202, 275714, 276227,
+    276995, 277762, 278274, 278786, 279298, 279810, 280322, 280834,
+    281346, 281858, 282370, 282883, 283651, 284419, 285187, 285954,
+    286466, 286978, 287490, 288003, 288771, 289538, 290050, 290562,
+    291074, 291586, 292098, 292610, 293122, 293634, 294146, 294658,
+    295170, 295682, 296194, 296706, 297218, 297731, 298499, 299266,
+    299778, 300290, 300802, 301314, 301826, 302338, 302850, 303363,
+    304131, 304898, 305410, 305922, 306434, 306946, 307458, 307970,
+    308482, 308994, 309506, 310018, 310530, 311042, 311554, 312066,
+    312578, 313090, 313602, 314115, 314883, 315651, 316419, 317187,
+    317955, 318723, 319491, 320258, 320770, 321282, 321794, 322306,
+    322818, 323330, 323842, 324355, 325123, 325890, 326402, 326914,
+    327426, 327938, 328450, 328963, 329731, 330499, 331267, 332035,
+    332803, 333570, 334082, 334594, 335106, 335618, 336130, 336642,
+    337154, 337666, 338178, 338690, 339202, 339714, 340226, 340739,
+    341507, 342275, 343043, 343810, 344322, 344834, 345346, 345858,
+    346370, 346882, 347394, 347906, 348418, 348930, 349442, 349954,
+    350466, 350978, 351490, 352002, 352514, 353026, 353538, 354050,
+    354562, 355074, 355586, 356098, 356610, 357122, 357634, 358146,
+    358658, 359170, 327426, 360194, 360706, 361218, 361730, 362243,
+    363011, 363779, 364547, 365315, 366083, 366851, 367619, 368387,
+    369155, 369923, 370691, 371459, 372227, 372995, 373763, 374531,
+    375299, 376067, 376835, 377602, 378114, 378626, 379138, 379650,
+    380162, 380675, 381443, 382211, 382979, 383747, 384515, 385283,
+    386051, 386819, 387587, 388354, 388866, 389378, 389890, 390402,
+    390914, 391426, 391938, 392451, 393219, 393987, 394755, 395523,
+    396291, 397059, 397827, 398595, 399363, 400131, 400899, 401667,
+    402435, 403203, 403971, 404739, 405507, 406275, 407043, 407810,
+    408322, 408834, 409346, 409859, 410627, 411395, 412163, 412931,
+    413699, 414467, 415235, 416003, 416771, 417538, 418050, 418562,
+    419074, 419586, 420098, 420610, 421122, 421634, 422146, 422659,
+    423427, 424195, 424963, 425731, 426499, 427266, 427778, 428291,
+    429059, 429827, 430595, 431363, 432131, 432898, 433410, 433923,
+    434691, 435459, 436227, 436994, 437506, 438019, 438787, 439555,
+    440323, 441090, 441602, 442115, 442883, 443651, 444419, 445187,
+    445955, 446722, 447234, 447747, 448515, 449283, 450051, 450819,
+    451587, 452354, 452866, 453379, 454147, 454915, 455683, 456451,
+    457219, 457986, 458498, 459011, 459779, 460547, 461315, 462083,
+    462851, 463618, 464130, 464643, 465411, 466179, 466947, 467714,
+    468226, 468739, 469507, 470275, 471043, 471810, 472322, 472835,
+    473603, 474371, 475139, 475907, 476675, 477442, 477955, 478723,
+    479491, 480258, 480770, 481283, 482051, 482819, 483587, 484355,
+    485123, 485890, 486402, 486915, 487683, 488451, 489219, 489987,
+    490755, 491522, 166146, 492034, 166658, 492546, 167170, 493058,
+    167682, 493570, 169986, 494082, 170498, 494594, 171010, 495107,
+    495875, 496644, 497668, 498692, 499716, 500740, 501764, 502787,
+    503555, 504324, 505348, 506372, 507396, 508420, 509444, 510467,
+    511235, 512004, 513028, 514052, 515076, 516100, 517124, 518147,
+    518915, 519684, 520708, 521732, 522756, 523780, 524804, 525827,
+    526595, 527364, 528388, 529412, 530436, 531460, 532484, 533507,
+    534275, 535044, 536068, 537092, 538116, 539140, 540164, 541186,
+    541698, 542211, 542978, 543491, 544258, 544771, 545538, 546050,
+    546562, 160514, 547074, 547586, 548097, 547586, 548354, 549379,
+    550147, 550914, 551427, 552194, 552707, 553474, 161282, 553986,
+    161794, 554498, 555523, 556803, 558083, 558850, 559362, 559875,
+    164355, 560642, 561155, 561922, 562434, 562946, 162306, 563971,
+    565251, 566531, 567298, 567810, 568323, 168195, 569090, 569602,
+    570114, 570627, 571394, 571906, 572418, 163330, 572930, 573955,
+    159747, 574721, 574979, 575746, 576259, 577026, 577539, 578306,
+    162818, 578818, 163842, 579330, 2050, 580098, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 581121, 581378, 581889, 582146, 582659, 1, 583426,
+    583939, 584706, 585219, 585986, 586498, 587010, 587522, 588034,
+    588548, 1, 589569, 262657, 589825, 590081, 590337, 590593,
+    590849, 591105, 591361, 591617, 591873, 592129, 592385, 592641,
+    589569, 3329, 1537, 1793, 589825, 590081, 590337, 590593,
+    590849, 591105, 591361, 591617, 591873, 592129, 592385, 769,
+    257281, 3585, 156417, 257537, 150529, 258561, 156161, 258817,
+    592641, 260097, 91137, 260353, 592898, 593411, 594179, 594945,
+    595202, 595715, 596483, 597249, 597506, 258305, 252417, 252417,
+    252417, 150529, 598017, 252673, 252673, 253441, 156161, 253953,
+    598274, 254721, 598785, 254977, 254977, 254977, 599042, 599555,
+    600322, 600833, 601089, 600833, 253185, 8706, 251137, 594945,
+    257281, 251649, 601345, 253697, 3585, 601601, 601857, 602113,
+    602369, 262657, 602627, 173569, 261889, 603393, 603649, 603905,
+    251393, 257025, 257281, 262657, 151041, 604163, 604931, 605700,
+    606723, 607491, 608259, 609027, 609795, 610563, 611331, 612099,
+    612867, 613635, 614403, 615171, 615938, 252673, 616450, 616963,
+    617730, 618241, 618498, 619011, 619780, 620802, 621313, 621570,
+    622083, 253441, 594945, 251393, 253697, 262657, 622850, 623363,
+    624130, 261377, 624642, 625155, 625924, 626946, 156417, 627458,
+    627971, 156161, 263425, 257025, 258817, 628739, 629506, 630018,
+    630530, 631042, 631554, 632066, 632578, 633090, 633602, 634114,
+    634626, 635138, 635651, 636418, 636931, 637698, 638210, 638722,
+    639234, 639746, 640258, 640770, 641282, 641794, 642306, 642818,
+    643330, 643842, 644354, 644866, 645378, 645890, 646402, 646914,
+    647426, 647938, 648450, 648962, 649474, 649986, 650498, 651010,
+    651522, 652034, 652546, 653058, 653570, 654082, 654593, 654849,
+    3329, 1537, 1793, 589825, 590081, 590337, 590593, 590849,
+    591105, 655106, 655618, 656130, 656642, 657154, 657666, 658178,
+    658690, 659202, 659714, 660226, 660739, 661507, 662275, 663043,
+    663811, 664579, 665347, 666115, 666883, 667652, 668676, 669700,
+    670724, 671748, 672772, 673796, 674820, 675844, 676868, 677892,
+    678914, 679426, 679938, 680450, 680962, 681474, 681986, 682498,
+    683010, 683523, 684291, 685059, 685827, 686595, 687363, 688131,
+    688899, 689667, 690435, 691203, 691971, 692739, 693507, 694275,
+    695043, 695811, 696579, 697347, 698115, 698883, 699651, 700419,
+    701187, 701955, 702723, 703491, 704259, 705027, 705795, 706563,
+    707331, 708099, 708867, 709635, 710403, 711171, 250625, 251137,
+    594945, 251393, 251649, 601345, 252161, 252417, 252673, 252929,
+    253185, 253441, 253697, 253953, 254209, 254721, 598785, 254977,
+    711937, 255233, 255489, 618241, 255745, 621313, 712193, 600833,
+    769, 256769, 263425, 257025, 257281, 264193, 258305, 150529,
+    262657, 151041, 258561, 156161, 258817, 592641, 3585, 260097,
+    712449, 151297, 91137, 260353, 260609, 261377, 152321, 156417,
+    152577, 271105, 589569, 712708, 713731, 714498, 715011, 715778,
+    151041, 618241, 716289, 716545, 716801, 717057, 717313, 717569,
+    717825, 718081, 718337, 718593, 718849, 719105, 719361, 719617,
+    719873, 720129, 720385, 720641, 720897, 721153, 721409, 721665,
+    721921, 722177, 722433, 722689, 722945, 723201, 723457, 723713,
+    723969, 724225, 724481, 724737, 724993, 725249, 725505, 725761,
+    726017, 726273, 726529, 726785, 727041, 727297, 727553, 727809,
+    728065, 728321, 728577, 728833, 729089, 729345, 729601, 729857,
+    730113, 730369, 730625, 730881, 731137, 731393, 731649, 731905,
+    732161, 732417, 732673, 732929, 733185, 733441, 733697, 733953,
+    734209, 734465, 734721, 734977, 735233, 735489, 735745, 736001,
+    736257, 736513, 736769, 737025, 737281, 737537, 737793, 738049,
+    738305, 738561, 738817, 739073, 739329, 739585, 739841, 740097,
+    740353, 740609, 740865, 741121, 741377, 741633, 741889, 742145,
+    742401, 742657, 742913, 743169, 743425, 743681, 743937, 744193,
+    744449, 744705, 744961, 745217, 745473, 745729, 745985, 746241,
+    746497, 746753, 747009, 747265, 747521, 747777, 748033, 748289,
+    748545, 748801, 749057, 749313, 749569, 749825, 750081, 750337,
+    750593, 750849, 751105, 751361, 751617, 751873, 752129, 752385,
+    752641, 752897, 753153, 753409, 753665, 753921, 754177, 754433,
+    754689, 754945, 755201, 755457, 755713, 755969, 756225, 756481,
+    756737, 756993, 757249, 757505, 757761, 758017, 758273, 758529,
+    758785, 759041, 759297, 759553, 759809, 760065, 760321, 760577,
+    760833, 761089, 761345, 761601, 761857, 762113, 762369, 762625,
+    762881, 763137, 763393, 763649, 763905, 764161, 764417, 764673,
+    764929, 765185, 765441, 765697, 765953, 766209, 766465, 766721,
+    766977, 767233, 767489, 767745, 768001, 768257, 768513, 768769,
+    769025, 769281, 769537, 769793, 770049, 770305, 770561, 770817,
+    771073, 771329, 771585, 1, 771841, 722945, 772097, 772353,
+    772610, 773122, 773634, 774146, 774658, 775170, 775682, 776194,
+    776706, 777218, 777730, 778242, 778754, 779266, 779778, 780290,
+    780802, 781314, 781826, 782338, 782850, 783362, 783874, 784386,
+    784898, 785410, 785922, 786434, 786946, 787458, 787970, 788482,
+    788994, 789506, 790018, 790530, 791042, 791554, 792066, 792578,
+    793090, 793602, 794114, 794626, 795138, 795650, 796162, 796674,
+    797186, 797698, 798210, 798722, 799234, 799746, 800258, 800770,
+    801282, 801794, 802306, 802818, 803330, 803842, 804353, 804609,
+    804865, 805121, 805377, 805633, 805889, 806145, 806401, 806657,
+    806913, 807169, 807425, 807681, 807937, 808193, 808449, 808705,
+    808961, 809217, 809473, 809729, 809985, 810241, 810497, 810753,
+    811009, 811265, 811521, 811777, 812033, 812289, 812545, 812801,
+    813057, 813313, 813569, 813825, 814081, 814337, 814593, 814849,
+    815105, 815361, 815617, 815873, 816129, 816385, 816641, 816897,
+    817153, 817409, 817665, 817921, 818177, 818433, 818689, 818945,
+    819201, 819457, 819713, 819969, 820225, 820481, 820737, 820993,
+    821249, 821505, 821761, 822017, 822273, 822529, 822785, 823041,
+    823297, 823553, 823809, 824065, 824321, 824577, 824833, 825089,
+    825345, 825601, 825857, 826113, 826369, 826625, 826881, 827137,
+    827393, 827649, 827905, 828161, 717057, 718593, 828417, 828673,
+    828929, 829185, 829441, 829697, 718081, 829953, 830209, 830465,
+    830721, 719105, 830979, 831747, 832515, 833283, 834051, 834819,
+    835587, 836355, 837123, 837891, 838659, 839427, 840195, 840963,
+    841732, 842756, 843780, 844804, 845828, 846852, 847876, 848900,
+    849924, 850948, 851972, 852996, 854020, 855044, 856068, 857095,
+    858886, 860419, 861187, 861955, 862723, 863491, 864259, 865027,
+    865795, 866563, 867331, 868099, 868867, 869635, 870403, 871171,
+    871939, 872707, 873475, 874243, 875011, 875779, 876547, 877315,
+    878083, 878851, 879619, 880387, 881155, 881923, 882691, 883459,
+    884227, 884995, 885763, 886531, 887299, 888065, 888321, 733953,
+    888577, 888835, 889602, 890114, 890626, 891138, 891650, 892162,
+    892674, 893186, 893698, 894210, 894722, 895234, 895746, 896258,
+    896770, 804353, 805121, 805889, 806401, 808449, 808705, 809473,
+    809985, 810241, 810753, 811009, 811265, 811521, 811777, 897282,
+    897794, 898306, 898818, 899330, 899842, 900354, 900866, 901378,
+    901890, 902402, 902914, 903426, 903938, 904453, 905732, 906754,
+    717057, 718593, 828417, 828673, 907265, 907521, 907777, 719873,
+    908033, 722945, 735745, 738817, 738561, 736001, 759553, 724993,
+    735233, 908289, 908545, 908801, 909057, 909313, 909569, 909825,
+    910081, 910337, 910593, 726529, 910849, 911105, 911361, 911617,
+    911873, 912129, 912385, 912641, 828929, 829185, 829441, 912897,
+    913153, 913409, 913665, 913921, 914177, 914433, 914689, 914945,
+    915201, 915458, 915970, 916482, 916994, 917506, 918018, 918530,
+    919042, 919554, 920066, 920578, 921090, 921602, 922114, 922626,
+    923138, 923650, 924162, 924674, 925186, 925698, 926210, 926722,
+    927234, 927747, 928515, 929283, 930050, 930563, 931330, 931843,
+    932609, 932865, 933121, 933377, 933633, 933889, 934145, 934401,
+    934657, 934913, 935169, 935425, 935681, 935937, 936193, 936449,
+    936705, 936961, 937217, 937473, 937729, 937985, 938241, 938497,
+    938753, 939009, 939265, 939521, 939777, 940033, 940289, 940545,
+    940801, 941057, 941313, 941569, 941825, 942081, 942337, 942593,
+    942849, 943105, 943361, 943617, 943873, 944129, 944385, 944642,
+    945157, 946436, 947461, 948739, 949509, 950787, 951555, 952326,
+    953860, 954883, 955651, 956419, 957188, 958212, 959236, 960260,
+    961284, 962308, 963332, 964358, 965890, 966406, 967942, 969477,
+    970756, 971782, 973318, 974852, 975875, 976643, 977412, 978436,
+    979461, 980741, 982019, 982787, 983556, 984579, 985347, 986114,
+    986626, 987139, 987907, 988678, 990212, 991237, 992518, 994052,
+    995075, 995843, 996614, 998148, 999174, 1000707, 1001477, 1002755,
+    1003524, 1004547, 1005316, 1006341, 1007620, 1008645, 1009924, 1010946,
+    1011461, 1012739, 1013507, 1014276, 1015299, 1016067, 1016835, 1017605,
+    1018884, 1019906, 1020422, 1021955, 1022725, 1024004, 1025028, 1026051,
+    1026819, 1027588, 1028610, 1029124, 1030149, 1031426, 1031942, 1033475,
+    1034242, 1034754, 1035266, 1035778, 1036290, 1036802, 1037314, 1037826,
+    1038338, 1038850, 1039363, 1040131, 1040899, 1041667, 1042435, 1043203,
+    1043971, 1044739, 1045507, 1046275, 1047043, 1047811, 1048579, 1049347,
+    1050115, 1050883, 1051650, 1052162, 1052675, 1053442, 1053954, 1054466,
+    1054979, 1055747, 1056514, 1057026, 1057538, 1058050, 1058562, 1059076,
+    1060098, 1060610, 1061122, 1061634, 1062146, 1062658, 1063170, 1063682,
+    1064195, 1064964, 1065986, 1066498, 1067010, 1067522, 1068034, 1068546,
+    1069058, 1069571, 1070339, 1071107, 1071875, 1072642, 1073154, 1073666,
+    1074178, 1074690, 1075202, 1075714, 1076226, 1076738, 1077250, 1077763,
+    1078531, 1079298, 1079811, 1080579, 1081347, 1082114, 1082627, 1083395,
+    1084164, 1085186, 1085699, 1086467, 1087235, 1088003, 1088773, 1090054,
+    1091586, 1092098, 1092610, 1093122, 1093634, 1094146, 1094658, 1095170,
+    1095682, 1096194, 1096706, 1097218, 1097730, 1098242, 1098754, 1099266,
+    1099778, 1100290, 1100804, 1101826, 1102338, 1102850, 1103364, 1104387,
+    1105154, 1105666, 1106178, 1106690, 1107202, 1107714, 1108226, 1108738,
+    1109250, 1109762, 1110275, 1111042, 1111554, 1112067, 1112835, 1113602,
+    1114116, 1115139, 1115906, 1116418, 1116930, 1117442, 1117955, 1118723,
+    1119490, 1120002, 1120514, 1121026, 1121538, 1122050, 1122562, 1123074,
+    1123586, 1124099, 1124867, 1125635, 1126403, 1127171, 1127939, 1128707,
+    1129475, 1130243, 1131011, 1131779, 1132547, 1133315, 1134083, 1134851,
+    1135619, 1136387, 1137155, 1137923, 1138691, 1139459, 1140227, 1140995,
+    1141761, 1142017, 1142273, 594945, 601345, 598785, 1142529, 1142785,
+    1143041, 1143297, 1143553, 1143809, 1144065, 1144321, 1144577, 757505,
+    1144833, 1145089, 1145345, 1145601, 771329, 771329, 1145857, 759553,
+    1146113, 1146369, 1146625, 1146881, 1147137, 1147393, 1147649, 1147905,
+    1148161, 1148417, 1148673, 1148929, 1149185, 1149441, 1149697, 1149953,
+    1150209, 1150465, 1150721, 1150977, 1151233, 1151489, 1151745, 1152001,
+    1152257, 1152513, 1152769, 1153025, 1153281, 1153537, 1153793, 1154049,
+    1154305, 1154561, 1154817, 1155073, 1155329, 1155585, 1155841, 1156097,
+    1156353, 748801, 1156609, 1156865, 1157121, 1157377, 1157633, 1157889,
+    1158145, 1158401, 1158657, 1158913, 1159169, 767489, 1159425, 1159681,
+    1159937, 1160193, 1160449, 1160705, 1160961, 1161217, 1161473, 1161729,
+    1161985, 1162241, 1162497, 1162753, 1163009, 1163265, 1163521, 1163777,
+    1164033, 1164289, 1164545, 1164801, 1165057, 1165313, 1165569, 1165825,
+    1166081, 1148417, 1166337, 1166593, 1166849, 1167105, 1167361, 1167617,
+    1167873, 1168129, 1168385, 1168641, 1168897, 1169153, 1169409, 1169665,
+    1169921, 1170177, 1170433, 1170689, 1170945, 1171201, 758017, 1171457,
+    1171713, 1171969, 1172225, 1172481, 1172737, 1172993, 1173249, 1173505,
+    1173761, 1174017, 1174273, 1174529, 1174785, 1175041, 726529, 1175297,
+    1175553, 1175809, 1176065, 1176321, 1176577, 1176833, 1177089, 721665,
+    1177345, 1177601, 1177857, 1178113, 1178369, 1178625, 1178881, 1179137,
+    1179393, 1179649, 1179905, 1180161, 1180417, 1180673, 1180929, 1181185,
+    1181441, 1181697, 1181953, 1182209, 1182465, 1182721, 1170945, 1182977,
+    1183233, 1183489, 1183745, 1184001, 1184257, 1184513, 1184769, 1166849,
+    1185025, 1185281, 1185537, 1185793, 1186049, 1186305, 1186561, 1186817,
+    1187073, 1187329, 1187585, 1187841, 1188097, 1188353, 1188609, 1188865,
+    1189121, 1189377, 1189633, 1189889, 1148417, 1190145, 1190401, 1190657,
+    1190913, 771073, 1191169, 1191425, 1191681, 1191937, 1192193, 1192449,
+    1192705, 1192961, 1193217, 1193473, 1193729, 1193985, 907521, 1194241,
+    1194497, 1194753, 1195009, 1195265, 1195521, 1195777, 1196033, 1196289,
+    1167361, 1196545, 1196801, 1197057, 1197313, 1197569, 1197825, 1198081,
+    1198337, 1198593, 1198849, 1199105, 1199361, 1199617, 759297, 1199873,
+    1200129, 1200385, 1200641, 1200897, 1201153, 1201409, 1201665, 1201921,
+    1202177, 1202433, 1202689, 1202945, 746753, 1203201, 1203457, 1203713,
+    1203969, 1204225, 1204481, 1204737, 1204993, 1205249, 1205505, 1205761,
+    1206017, 1206273, 1206529, 1206785, 1207041, 753665, 1207297, 754433,
+    1207553, 1207809, 1208065, 1208321, 1208577, 1208833, 1209089, 1209345,
+    1209601, 1209857, 1210113, 1210369, 1210625, 1210881, 748545, 1211137,
+    1211393, 1211649, 1211905, 1212161, 1212417, 1212673, 1212929, 1213185,
+    1213441, 1213697, 1213953, 1214209, 1214465, 1214721, 1214977, 1215233,
+    1215489, 1215745, 1216001, 1216257, 1216513, 728321, 1216769, 1217025,
+    1217281, 1217537, 1217793, 1218049, 1218305, 1218561, 1218817, 1219073,
+    1219329, 1219585, 1219841, 1220097, 1220353, 908801, 1220609, 1220865,
+    1221121, 1221377, 909825, 1221633, 1221889, 1222145, 1222401, 1222657,
+    1180161, 1222913, 1223169, 1223425, 1223681, 1223937, 1224193, 1224193,
+    1224449, 1224705, 1224961, 1225217, 1225473, 1225729, 1225985, 1226241,
+    1211649, 1226497, 1226753, 1227009, 1227265, 1227521, 1227777, 1228033,
+    1228289, 1228545, 1228801, 1229057, 1229313, 1229569, 1229825, 1215233,
+    1230081, 1230337, 1230593, 1208321, 1230849, 1231105, 1231361, 1231617,
+    1231873, 1232129, 1232385, 1232641, 1232897, 1233153, 1233409, 1233665,
+    1217281, 1233921, 1217537, 1234177, 1234433, 1234689, 1234945, 1235201,
+    1208577, 1153793, 1235457, 1235713, 736769, 1171201, 1192449, 1235969,
+    1236225, 1219329, 1236481, 1219585, 1236737, 1236993, 1237249, 1209089,
+    1237505, 1237761, 1238017, 1238273, 1238529, 1209345, 1238785, 1239041,
+    1239297, 1239553, 1239809, 1240065, 1222657, 1240321, 1240577, 1180161,
+    1240833, 1223681, 1241089, 1241345, 1241601, 1241857, 1242113, 1224961,
+    1242369, 1211393, 1242625, 1225217, 1166337, 1242881, 1225473, 1243137,
+    1225985, 1243393, 1243649, 1243905, 1244161, 1244417, 1226497, 1210625,
+    1244673, 1226753, 1244929, 1227009, 1245185, 771329, 1245441, 1245697,
+    1245953, 1246209, 1246465, 1246721, 1246977, 1247233, 1247489, 1247745,
+    1248001, 1248258, 1248770, 1249282, 1249795, 1250563, 1251330, 1251330,
+    1251842, 1252354, 1252866, 1253378, 1253890, 1254402, 1254914, 1255425,
+    601601, 602369, 1255681, 1255937, 1256193, 1256449, 1256705, 1256961,
+    591361, 1257218, 1257730, 1258243, 1259011, 1259778, 1260290, 1260802,
+    1261314, 1261826, 1262338, 1262850, 1263362, 1263874, 1264386, 1264898,
+    1265410, 1265922, 1266434, 1266946, 1267458, 1267970, 1268482, 1268994,
+    1269506, 1270018, 1270530, 1271042, 1271554, 1272066, 1272578, 1273090,
+    1273602, 1274114, 1274625, 1274625, 1274881, 1274881, 1274881, 1274881,
+    1275137, 1275137, 1275137, 1275137, 1275393, 1275393, 1275393, 1275393,
+    1275649, 1275649, 1275649, 1275649, 1275905, 1275905, 1275905, 1275905,
+    1276161, 1276161, 1276161, 1276161, 1276417, 1276417, 1276417, 1276417,
+    1276673, 1276673, 1276673, 1276673, 1276929, 1276929, 1276929, 1276929,
+    1277185, 1277185, 1277185, 1277185, 1277441, 1277441, 1277441, 1277441,
+    1277697, 1277697, 1277697, 1277697, 1277953, 1277953, 1278209, 1278209,
+    1278465, 1278465, 1278721, 1278721, 1278977, 1278977, 1279233, 1279233,
+    1279489, 1279489, 1279489, 1279489, 1279745, 1279745, 1279745, 1279745,
+    1280001, 1280001, 1280001, 1280001, 1280257, 1280257, 1280257, 1280257,
+    1280513, 1280513, 1280769, 1280769, 1280769, 1280769, 207106, 207106,
+    1281025, 1281025, 1281025, 1281025, 1281281, 1281281, 1281281, 1281281,
+    1281537, 1281537, 208130, 208130, 1281793, 1281793, 1281793, 1281793,
+    1282049, 1282049, 1282305, 1282305, 1282561, 1282561, 206082, 1282817,
+    1282817, 1283073, 1283073, 1283329, 1283329, 1283585, 1283585, 1283585,
+    1283585, 1283841, 1283841, 1284099, 1284099, 1284867, 1284867, 1285635,
+    1285635, 1286403, 1286403, 1287171, 1287171, 1287939, 1287939, 1288707,
+    1288707, 1288707, 1289475, 1289475, 1289475, 1290241, 1290241, 1290241,
+    1290241, 1290499, 1291267, 1292035, 1289475, 1292803, 1293570, 1294082,
+    1294594, 1295106, 1295618, 1296130, 1296642, 1297154, 1297666, 1298178,
+    1298690, 1299202, 1299714, 1300226, 1300738, 1301250, 1301762, 1302274,
+    1302786, 1303298, 1303810, 1304322, 1304834, 1305346, 1305858, 1306370,
+    1306882, 1307394, 1307906, 1308418, 1308930, 1309442, 1309954, 1310466,
+    1310978, 1311490, 1312002, 1312514, 1313026, 1313538, 1314050, 1314562,
+    1315074, 1315586, 1316098, 1316610, 1317122, 1317634, 1318146, 1318658,
+    1319170, 1319682, 1320194, 1320706, 1321218, 1321730, 1322242, 1322754,
+    1323266, 1323778, 1324290, 1324802, 1325314, 1325826, 1326338, 1326850,
+    1327362, 1327874, 1328386, 1328898, 1329410, 1329922, 1330434, 1330946,
+    1331458, 1331970, 1332482, 1332994, 1333506, 1334018, 1334530, 1335042,
+    1335554, 1336066, 1336578, 1337090, 1337602, 1338114, 1338626, 1339139,
+    1339907, 1340675, 1341443, 1342211, 1342979, 1343747, 1344515, 1292035,
+    1345283, 1289475, 1292803, 1346050, 1346562, 1295106, 1347074, 1295618,
+    1296130, 1347586, 1348098, 1298178, 1348610, 1298690, 1299202, 1349122,
+    1349634, 1300226, 1350146, 1300738, 1301250, 1316098, 1316610, 1318146,
+    1318658, 1319170, 1321218, 1321730, 1322242, 1322754, 1324802, 1325314,
+    1325826, 1350658, 1327874, 1351170, 1351682, 1330946, 1352194, 1331458,
+    1331970, 1338626, 1352706, 1353218, 1336066, 1353730, 1336578, 1337090,
+    1290499, 1291267, 1354243, 1292035, 1355011, 1293570, 1294082, 1294594,
+    1295106, 1355778, 1296642, 1297154, 1297666, 1298178, 1356290, 1300226,
+    1301762, 1302274, 1302786, 1303298, 1303810, 1304834, 1305346, 1305858,
+    1306370, 1306882, 1307394, 1356802, 1307906, 1308418, 1308930, 1309442,
+    1309954, 1310466, 1311490, 1312002, 1312514, 1313026, 1313538, 1314050,
+    1314562, 1315074, 1315586, 1317122, 1317634, 1319682, 1320194, 1320706,
+    1321218, 1321730, 1323266, 1323778, 1324290, 1324802, 1357314, 1326338,
+    1326850, 1327362, 1327874, 1329410, 1329922, 1330434, 1330946, 1357826,
+    1332482, 1332994, 1358338, 1334530, 1335042, 1335554, 1336066, 1358850,
+    1292035, 1355011, 1295106, 1355778, 1298178, 1356290, 1300226, 1359362,
+    1306882, 1359874, 1360386, 1360898, 1321218, 1321730, 1324802, 1330946,
+    1357826, 1336066, 1358850, 1361411, 1362179, 1362947, 1363714, 1364226,
+    1364738, 1365250, 1365762, 1366274, 1366786, 1367298, 1367810, 1368322,
+    1368834, 1369346, 1369858, 1370370, 1370882, 1371394, 1371906, 1372418,
+    1372930, 1373442, 1373954, 1374466, 1374978, 1360386, 1375490, 1376002,
+    1376514, 1377026, 1363714, 1364226, 1364738, 1365250, 1365762, 1366274,
+    1366786, 1367298, 1367810, 1368322, 1368834, 1369346, 1369858, 1370370,
+    1370882, 1371394, 1371906, 1372418, 1372930, 1373442, 1373954, 1374466,
+    1374978, 1360386, 1375490, 1376002, 1376514, 1377026, 1373954, 1374466,
+    1374978, 1360386, 1359874, 1360898, 1310978, 1305346, 1305858, 1306370,
+    1373954, 1374466, 1374978, 1310978, 1311490, 1377538, 1377538, 1378051,
+    1378819, 1378819, 1379587, 1380355, 1381123, 1381891, 1382659, 1383427,
+    1383427, 1384195, 1384963, 1385731, 1386499, 1387267, 1388035, 1388035,
+    1388803, 1389571, 1389571, 1390339, 1390339, 1391107, 1391875, 1391875,
+    1392643, 1393411, 1393411, 1394179, 1394179, 1394947, 1395715, 1395715,
+    1396483, 1396483, 1397251, 1398019, 1398787, 1399555, 1399555, 1400323,
+    1401091, 1401859, 1402627, 1403395, 1403395, 1404163, 1404931, 1405699,
+    1406467, 1407235, 1408003, 1408003, 1408771, 1408771, 1409539, 1409539,
+    1410307, 1411075, 1411843, 1412611, 1413379, 1414147, 1414915, 1415683,
+    1416451, 1417219, 1417987, 1418755, 1419523, 1419523, 1420291, 1421059,
+    1421827, 1422595, 1422595, 1423363, 1424131, 1424899, 1425667, 1426435,
+    1427203, 1427971, 1428739, 1429507, 1430275, 1431043, 1431811, 1432579,
+    1433347, 1434115, 1434883, 1435651, 1436419, 1437187, 1437955, 1438723,
+    1439491, 1404163, 1405699, 1440259, 1441027, 1441795, 1442563, 1443331,
+    1444099, 1443331, 1441795, 1444867, 1445635, 1446403, 1447171, 1447939,
+    1444099, 1398787, 1391107, 1448707, 1449475, 1450243, 1451011, 1451780,
+    1452804, 1453828, 1454852, 1455876, 1456900, 1457924, 1458947, 1459730,
+    1464328, 1466372, 1467393, 1467649, 1467905, 1468161, 158977, 1468417,
+    1468673, 1468929, 1469185, 582659, 582146, 1469441, 1469697, 1469953,
+    1469953, 592129, 592385, 1470209, 1470465, 1470721, 1470977, 1471233,
+    1471489, 1471745, 1472001, 654593, 654849, 1472257, 1472513, 1472769,
+    1473025, 1473281, 1473537, 586498, 586498, 586498, 586498, 1469953,
+    1469953, 1469953, 1467393, 1467649, 581889, 158977, 1468161, 1468673,
+    1468417, 1469441, 592129, 592385, 1470209, 1470465, 1470721, 1470977,
+    1473793, 1474049, 1474305, 591361, 1474561, 1474817, 1475073, 591873,
+    1475329, 1475585, 1475841, 1476097, 1476354, 1476866, 1477378, 1477890,
+    1478402, 1478914, 1479426, 1479938, 1480450, 1480962, 1481474, 1481986,
+    1482498, 1483010, 1483521, 202498, 202498, 203010, 203010, 203522,
+    203522, 204034, 204034, 204546, 204546, 204546, 204546, 1483777,
+    1483777, 1484033, 1484033, 1484033, 1484033, 1484289, 1484289, 1484545,
+    1484545, 1484545, 1484545, 1484801, 1484801, 1484801, 1484801, 1485057,
+    1485057, 1485057, 1485057, 1485313, 1485313, 1485313, 1485313, 1485569,
+    1485569, 1485569, 1485569, 1485825, 1485825, 1486081, 1486081, 1486337,
+    1486337, 1486593, 1486593, 1486849, 1486849, 1486849, 1486849, 1487105,
+    1487105, 1487105, 1487105, 1487361, 1487361, 1487361, 1487361, 1487617,
+    1487617, 1487617, 1487617, 1487873, 1487873, 1487873, 1487873, 1488129,
+    1488129, 1488129, 1488129, 1488385, 1488385, 1488385, 1488385, 1488641,
+    1488641, 1488641, 1488641, 1488897, 1488897, 1488897, 1488897, 1489153,
+    1489153, 1489153, 1489153, 1489409, 1489409, 1489409, 1489409, 1489665,
+    1489665, 1489665, 1489665, 1489921, 1489921, 1489921, 1489921, 1490177,
+    1490177, 1490177, 1490177, 1490433, 1490433, 1490433, 1490433, 1490689,
+    1490689, 1283841, 1283841, 1490945, 1490945, 1490945, 1490945, 1491203,
+    1491203, 1491971, 1491971, 1492739, 1492739, 1493506, 1493506, 1468417,
+    1494017, 1473793, 1475585, 1475841, 1474049, 1494273, 592129, 592385,
+    1474305, 591361, 1467393, 1474561, 581889, 1494529, 589569, 3329,
+    1537, 1793, 589825, 590081, 590337, 590593, 590849, 591105,
+    1468161, 158977, 1474817, 591873, 1475073, 1468673, 1476097, 250625,
+    251137, 594945, 251393, 251649, 601345, 252161, 252417, 252673,
+    252929, 253185, 253441, 253697, 253953, 254209, 254721, 598785,
+    254977, 711937, 255233, 255489, 618241, 255745, 621313, 712193,
+    600833, 1473281, 1475329, 1473537, 1494785, 1469953, 574721, 769,
+    256769, 263425, 257025, 257281, 264193, 258305, 150529, 262657,
+    151041, 258561, 156161, 258817, 592641, 3585, 260097, 712449,
+    151297, 91137, 260353, 260609, 261377, 152321, 156417, 152577,
+    271105, 1470209, 1495041, 1470465, 1495297, 1495553, 1495809, 1467905,
+    1472257, 1472513, 1467649, 1496065, 944385, 1496321, 1496577, 1496833,
+    1497089, 1497345, 1497601, 1497857, 1498113, 1498369, 1498625, 932609,
+    932865, 933121, 933377, 933633, 933889, 934145, 934401, 934657,
+    934913, 935169, 935425, 935681, 935937, 936193, 936449, 936705,
+    936961, 937217, 937473, 937729, 937985, 938241, 938497, 938753,
+    939009, 939265, 939521, 939777, 940033, 940289, 940545, 940801,
+    941057, 941313, 941569, 941825, 942081, 942337, 942593, 942849,
+    943105, 943361, 943617, 1498881, 1499137, 1499393, 817409, 804353,
+    804609, 804865, 805121, 805377, 805633, 805889, 806145, 806401,
+    806657, 806913, 807169, 807425, 807681, 807937, 808193, 808449,
+    808705, 808961, 809217, 809473, 809729, 809985, 810241, 810497,
+    810753, 811009, 811265, 811521, 811777, 812033, 812289, 812545,
+    812801, 813057, 813313, 813569, 813825, 814081, 814337, 814593,
+    814849, 815105, 815361, 815617, 815873, 816129, 816385, 816641,
+    816897, 817153, 1499649, 1499905, 1500161, 1026, 1500417, 1500673,
+    1500929, 1501185, 1501441, 1501697, 1501953, 1502209, 1502465, 1502721,
+    1502977, 1503233, 1503489, 1503745, 1504001, 1504257, 1504513, 1504769,
+    1505025, 1505281, 1505537, 1505793, 1506049, 1506305, 1506561, 1506817,
+    1507073, 1507329, 1507585, 598017, 1507841, 1508097, 1508353, 1508609,
+    1508865, 1509121, 1509377, 1509633, 1509889, 1510145, 1510401, 1510657,
+    1510913, 1511169, 1511425, 712449, 1511681, 1511937, 1512193, 1512449,
+    1512705, 1512961, 1513217, 1513473, 1513729, 1513985, 1514241, 1514497,
+    1514753, 1515009, 1515265, 1515521, 1515777, 1516033, 1516289, 1516545,
+    1516802, 1517314, 1517826, 1518338, 1518850, 1519362, 1519874, 1520386,
+    1520898, 1521410, 1521922, 1522434, 1522946, 1523458, 1523970, 1524483,
+    1525251, 1526019, 1526787, 1527555, 1528322, 1528834, 1529347, 1530115,
+    1530883, 1531651, 250625, 251137, 594945, 251393, 251649, 601345,
+    252161, 252417, 252673, 252929, 253185, 253441, 253697, 253953,
+    254209, 254721, 598785, 254977, 711937, 255233, 255489, 618241,
+    255745, 621313, 712193, 600833, 769, 256769, 263425, 257025,
+    257281, 264193, 258305, 150529, 262657, 151041, 258561, 156161,
+    258817, 592641, 3585, 260097, 712449, 151297, 91137, 260353,
+    260609, 261377, 152321, 156417, 152577, 271105, 250625, 251137,
+    594945, 251393, 251649, 601345, 252161, 252417, 252673, 252929,
+    253185, 253441, 253697, 253953, 254209, 254721, 598785, 254977,
+    711937, 255233, 255489, 618241, 255745, 621313, 712193, 600833,
+    769, 256769, 263425, 257025, 257281, 264193, 258305, 262657,
+    151041, 258561, 156161, 258817, 592641, 3585, 260097, 712449,
+    151297, 91137, 260353, 260609, 261377, 152321, 156417, 152577,
+    271105, 250625, 251137, 594945, 251393, 251649, 601345, 252161,
+    252417, 252673, 252929, 253185, 253441, 253697, 253953, 254209,
+    254721, 598785, 254977, 711937, 255233, 255489, 618241, 255745,
+    621313, 712193, 600833, 769, 256769, 263425, 257025, 257281,
+    264193, 258305, 150529, 262657, 151041, 258561, 156161, 258817,
+    592641, 3585, 260097, 712449, 151297, 91137, 260353, 260609,
+    261377, 152321, 156417, 152577, 271105, 250625, 594945, 251393,
+    252161, 252929, 253185, 253953, 254209, 254721, 598785, 711937,
+    255233, 255489, 618241, 255745, 621313, 712193, 600833, 769,
+    256769, 263425, 257025, 264193, 150529, 262657, 151041, 258561,
+    156161, 258817, 592641, 260097, 712449, 151297, 91137, 260353,
+    260609, 261377, 152321, 156417, 152577, 271105, 250625, 251137,
+    594945, 251393, 251649, 601345, 252161, 252417, 252673, 252929,
+    253185, 253441, 253697, 253953, 254209, 254721, 598785, 254977,
+    711937, 255233, 255489, 618241, 255745, 621313, 712193, 600833,
+    769, 256769, 263425, 257025, 257281, 264193, 258305, 150529,
+    262657, 151041, 258561, 156161, 258817, 592641, 3585, 260097,
+    712449, 151297, 91137, 260353, 260609, 261377, 152321, 156417,
+    152577, 271105, 250625, 251137, 251393, 251649, 601345, 252161,
+    252929, 253185, 253441, 253697, 253953, 254209, 254721, 598785,
+    711937, 255233, 255489, 618241, 255745, 621313, 712193, 769,
+    256769, 263425, 257025, 257281, 264193, 258305, 150529, 262657,
+    151041, 258561, 156161, 258817, 592641, 3585, 260097, 712449,
+    151297, 91137, 260353, 260609, 261377, 152321, 156417, 152577,
+    271105, 250625, 251137, 251393, 251649, 601345, 252161, 252673,
+    252929, 253185, 253441, 253697, 254209, 711937, 255233, 255489,
+    618241, 255745, 621313, 712193, 769, 256769, 263425, 257025,
+    257281, 264193, 258305, 150529, 262657, 151041, 258561, 156161,
+    258817, 592641, 3585, 260097, 712449, 151297, 91137, 260353,
+    260609, 261377, 152321, 156417, 152577, 271105, 250625, 251137,
+    594945, 251393, 251649, 601345, 252161, 252417, 252673, 252929,
+    253185, 253441, 253697, 253953, 254209, 254721, 598785, 254977,
+    711937, 255233, 255489, 618241, 255745, 621313, 712193, 600833,
+    769, 256769, 263425, 257025, 257281, 264193, 258305, 150529,
+    262657, 151041, 258561, 156161, 258817, 592641, 3585, 260097,
+    712449, 151297, 91137, 260353, 260609, 261377, 152321, 156417,
+    152577, 271105, 250625, 251137, 594945, 251393, 251649, 601345,
+    252161, 252417, 252673, 252929, 253185, 253441, 253697, 253953,
+    254209, 254721, 598785, 254977, 711937, 255233, 255489, 618241,
+    255745, 621313, 712193, 600833, 769, 256769, 263425, 257025,
+    257281, 264193, 258305, 150529, 262657, 151041, 258561, 156161,
+    258817, 592641, 3585, 260097, 712449, 151297, 91137, 260353,
+    260609, 261377, 152321, 156417, 152577, 271105, 250625, 251137,
+    594945, 251393, 251649, 601345, 252161, 252417, 252673, 252929,
+    253185, 253441, 253697, 253953, 254209, 254721, 598785, 254977,
+    711937, 255233, 255489, 618241, 255745, 621313, 712193, 600833,
+    769, 256769, 263425, 257025, 257281, 264193, 258305, 150529,
+    262657, 151041, 258561, 156161, 258817, 592641, 3585, 260097,
+    712449, 151297, 91137, 260353, 260609, 261377, 152321, 156417,
+    152577, 271105, 250625, 251137, 594945, 251393, 251649, 601345,
+    252161, 252417, 252673, 252929, 253185, 253441, 253697, 253953,
+    254209, 254721, 598785, 254977, 711937, 255233, 255489, 618241,
+    255745, 621313, 712193, 600833, 769, 256769, 263425, 257025,
+    257281, 264193, 258305, 150529, 262657, 151041, 258561, 156161,
+    258817, 592641, 3585, 260097, 712449, 151297, 91137, 260353,
+    260609, 261377, 152321, 156417, 152577, 271105, 250625, 251137,
+    594945, 251393, 251649, 601345, 252161, 252417, 252673, 252929,
+    253185, 253441, 253697, 253953, 254209, 254721, 598785, 254977,
+    711937, 255233, 255489, 618241, 255745, 621313, 712193, 600833,
+    769, 256769, 263425, 257025, 257281, 264193, 258305, 150529,
+    262657, 151041, 258561, 156161, 258817, 592641, 3585, 260097,
+    712449, 151297, 91137, 260353, 260609, 261377, 152321, 156417,
+    152577, 271105, 250625, 251137, 594945, 251393, 251649, 601345,
+    252161, 252417, 252673, 252929, 253185, 253441, 253697, 253953,
+    254209, 254721, 598785, 254977, 711937, 255233, 255489, 618241,
+    255745, 621313, 712193, 600833, 769, 256769, 263425, 257025,
+    257281, 264193, 258305, 150529, 262657, 151041, 258561, 156161,
+    258817, 592641, 3585, 260097, 712449, 151297, 91137, 260353,
+    260609, 261377, 152321, 156417, 152577, 271105, 1532417, 1532673,
+    1532929, 1533185, 603393, 1533441, 1533697, 1533953, 1534209, 174593,
+    1534465, 1534721, 1534977, 1535233, 1535489, 1535745, 1536001, 603649,
+    1536257, 174593, 175105, 1536513, 172033, 1536769, 1537025, 1537281,
+    601089, 1537537, 1537793, 171521, 261889, 262145, 174849, 1538049,
+    1538305, 171777, 548097, 173825, 1538561, 2561, 1538817, 1539073,
+    1539329, 173569, 174081, 174337, 1539585, 1539841, 1540097, 173313,
+    262401, 1540353, 1540609, 1540865, 174849, 171777, 173825, 173313,
+    174081, 173569, 1532929, 1533185, 603393, 1533441, 1533697, 1533953,
+    1534209, 174593, 1534465, 1534721, 1534977, 1535233, 1535489, 1535745,
+    1536001, 603649, 1536257, 174593, 175105, 1536513, 172033, 1536769,
+    1537025, 1537281, 601089, 1537537, 1537793, 171521, 261889, 262145,
+    174849, 1538049, 1538305, 171777, 548097, 173825, 1538561, 2561,
+    1538817, 1539073, 1539329, 173569, 174081, 174337, 1539585, 1539841,
+    1540097, 173313, 262401, 1540353, 1540609, 1540865, 174849, 171777,
+    173825, 173313, 174081, 173569, 1532929, 1533185, 603393, 1533441,
+    1533697, 1533953, 1534209, 174593, 1534465, 1534721, 1534977, 1535233,
+    1535489, 1535745, 1536001, 603649, 1536257, 174593, 175105, 1536513,
+    172033, 1536769, 1537025, 1537281, 601089, 1537537, 1537793, 171521,
+    261889, 262145, 174849, 1538049, 1538305, 171777, 548097, 173825,
+    1538561, 2561, 1538817, 1539073, 1539329, 173569, 174081, 174337,
+    1539585, 1539841, 1540097, 173313, 262401, 1540353, 1540609, 1540865,
+    174849, 171777, 173825, 173313, 174081, 173569, 1532929, 1533185,
+    603393, 1533441, 1533697, 1533953, 1534209, 174593, 1534465, 1534721,
+    1534977, 1535233, 1535489, 1535745, 1536001, 603649, 1536257, 174593,
+    175105, 1536513, 172033, 1536769, 1537025, 1537281, 601089, 1537537,
+    1537793, 171521, 261889, 262145, 174849, 1538049, 1538305, 171777,
+    548097, 173825, 1538561, 2561, 1538817, 1539073, 1539329, 173569,
+    174081, 174337, 1539585, 1539841, 1540097, 173313, 262401, 1540353,
+    1540609, 1540865, 174849, 171777, 173825, 173313, 174081, 173569,
+    1532929, 1533185, 603393, 1533441, 1533697, 1533953, 1534209, 174593,
+    1534465, 1534721, 1534977, 1535233, 1535489, 1535745, 1536001, 603649,
+    1536257, 174593, 175105, 1536513, 172033, 1536769, 1537025, 1537281,
+    601089, 1537537, 1537793, 171521, 261889, 262145, 174849, 1538049,
+    1538305, 171777, 548097, 173825, 1538561, 2561, 1538817, 1539073,
+    1539329, 173569, 174081, 174337, 1539585, 1539841, 1540097, 173313,
+    262401, 1540353, 1540609, 1540865, 174849, 171777, 173825, 173313,
+    174081, 173569, 1541121, 1541377, 589569, 3329, 1537, 1793,
+    589825, 590081, 590337, 590593, 590849, 591105, 589569, 3329,
+    1537, 1793, 589825, 590081, 590337, 590593, 590849, 591105,
+    589569, 3329, 1537, 1793, 589825, 590081, 590337, 590593,
+    590849, 591105, 589569, 3329, 1537, 1793, 589825, 590081,
+    590337, 590593, 590849, 591105, 589569, 3329, 1537, 1793,
+    589825, 590081, 590337, 590593, 590849, 591105, 1483777, 1484033,
+    1485057, 1485825, 1490689, 1486593, 1485313, 1487873, 1490945, 1489409,
+    1489665, 1489921, 1490177, 1486849, 1488385, 1488897, 1487361, 1489153,
+    1486337, 1487105, 1484545, 1484801, 1485569, 1486081, 1487617, 1488129,
+    1488641, 1541633, 1280513, 1541889, 1542145, 1484033, 1485057, 1490433,
+    1485313, 1490945, 1489409, 1489665, 1489921, 1490177, 1486849, 1488385,
+    1488897, 1487361, 1489153, 1487105, 1484545, 1484801, 1485569, 1487617,
+    1488641, 1485057, 1485313, 1490945, 1489665, 1490177, 1486849, 1488385,
+    1487361, 1489153, 1487105, 1485569, 1487617, 1488641, 1280513, 1542145,
+    1484033, 1485057, 1490433, 1485313, 1487873, 1490945, 1489409, 1489921,
+    1490177, 1486849, 1488385, 1488897, 1487361, 1489153, 1487105, 1484545,
+    1484801, 1485569, 1487617, 1488129, 1488641, 1541633, 1541889, 1483777,
+    1484033, 1485057, 1485825, 1490433, 1490689, 1486593, 1485313, 1487873,
+    1490945, 1489665, 1489921, 1490177, 1486849, 1488385, 1488897, 1487361,
+    1489153, 1486337, 1487105, 1484545, 1484801, 1485569, 1486081, 1487617,
+    1488129, 1488641, 1484033, 1485057, 1485825, 1490689, 1486593, 1485313,
+    1487873, 1490945, 1489665, 1489921, 1490177, 1486849, 1488385, 1488897,
+    1487361, 1489153, 1486337, 1487105, 1484545, 1484801, 1485569, 1486081,
+    1487617, 1488129, 1488641, 1542402, 1542914, 1543426, 1543938, 1544450,
+    1544962, 1545474, 1545986, 1546498, 1547010, 1547522, 1548035, 1548803,
+    1549571, 1550339, 1551107, 1551875, 1552643, 1553411, 1554179, 1554947,
+    1555715, 1556483, 1557251, 1558019, 1558787, 1559555, 1560323, 1561091,
+    1561859, 1562627, 1563395, 1564163, 1564931, 1565699, 1566467, 1567235,
+    1568003, 594945, 254977, 1568770, 1569282, 250625, 251137, 594945,
+    251393, 251649, 601345, 252161, 252417, 252673, 252929, 253185,
+    253441, 253697, 253953, 254209, 254721, 598785, 254977, 711937,
+    255233, 255489, 618241, 255745, 621313, 712193, 600833, 1569794,
+    1096194, 1570306, 1570818, 1571331, 1572098, 1572610, 1573122, 1573634,
+    1574146, 1574658, 1575170, 935169, 733185, 1575681, 1575937, 794626,
+    718593, 1576193, 1576449, 830465, 1576705, 1576961, 1577217, 1189889,
+    1577473, 1577729, 1577985, 1578241, 1578497, 1578753, 742401, 1579009,
+    1579265, 1579521, 1579777, 1580033, 1580289, 717057, 828417, 1580545,
+    912897, 829185, 913153, 1580801, 756737, 1581057, 1581313, 1581569,
+    1581825, 1582081, 908545, 735745, 1582337, 1582593, 1582849, 1583105,
+    1583363, 1584131, 1584899, 1585667, 1586435, 1587203, 1587971, 1588739,
+    1589507, 1590273, 1590529, 589569, 3329, 1537, 1793, 589825,
+    590081, 590337, 590593, 590849, 591105, 1590785, 1591041, 1591297,
+    1591553, 1591809, 1213697, 1592065, 1592321, 1592577, 1592833, 1213953,
+    1593089, 1593345, 1593601, 1214209, 1593857, 1594113, 1594369, 1594625,
+    1594881, 1595137, 1577985, 1595393, 1595649, 1595905, 1596161, 1596417,
+    1228289, 1596673, 721153, 1596929, 1597185, 1597441, 1597697, 1582593,
+    1597953, 1598209, 1229569, 1214465, 1214721, 1229825, 1598465, 1598721,
+    1167873, 1598977, 1214977, 1599233, 1599489, 1599745, 1600001, 1600001,
+    1600001, 1600257, 1600513, 1600769, 1601025, 1601281, 1601537, 1601793,
+    1602049, 1602305, 1602561, 1602817, 1603073, 1603329, 1603585, 1603841,
+    1604097, 1604353, 1604609, 1604609, 1230337, 1604865, 1605121, 1605377,
+    1605633, 1215489, 1605889, 1606145, 1606401, 1205249, 1606657, 1606913,
+    1607169, 1607425, 1607681, 1607937, 1608193, 1608449, 1608705, 1608961,
+    1609217, 1609473, 1576193, 1609729, 1609985, 1610241, 1610497, 1610753,
+    1611009, 1611265, 1611521, 1611777, 1612033, 1612289, 1612545, 1612801,
+    1612801, 1613057, 1613313, 1613569, 1166849, 1613825, 1614081, 1614337,
+    1614593, 1614849, 727809, 1615105, 1615361, 728321, 1615617, 1615873,
+    1616129, 1616385, 1616641, 1616897, 1617153, 1617409, 1617665, 1617921,
+    1618177, 1618433, 1618689, 1618945, 1619201, 1619457, 1619713, 1619969,
+    1620225, 1620481, 1620737, 1153537, 1620993, 730881, 1621249, 1621249,
+    1621505, 1621761, 1621761, 1622017, 1622273, 1622529, 1622785, 1623041,
+    1623297, 1623553, 1623809, 1624065, 1624321, 1624577, 1624833, 1625089,
+    1216769, 1625345, 1625601, 1625857, 1626113, 1233409, 1626113, 1626369,
+    1217281, 1626625, 1626881, 1627137, 1627393, 1217537, 1146625, 1627649,
+    1627905, 1628161, 1628417, 1628673, 1628929, 1629185, 1629441, 1629697,
+    1629953, 1630209, 1630465, 1630721, 1630977, 1631233, 1631489, 1631745,
+    1632001, 1632257, 1632513, 1632769, 1633025, 1217793, 1633281, 1633537,
+    1633793, 1634049, 1634305, 1634561, 1218305, 1634817, 1635073, 1635329,
+    1635585, 1635841, 1636097, 1636353, 1636609, 1153793, 1235457, 1636865,
+    1637121, 1637377, 1637633, 1637889, 1638145, 1638401, 1638657, 1218561,
+    1638913, 1639169, 1639425, 1639681, 1246209, 1639937, 1640193, 1640449,
+    1640705, 1640961, 1641217, 1641473, 1641729, 1641985, 1642241, 1642497,
+    1642753, 1643009, 1171201, 1643265, 1643521, 1643777, 1644033, 1644289,
+    1644545, 1644801, 1645057, 1645313, 1645569, 1645825, 1218817, 1192449,
+    1646081, 1646337, 1646593, 1646849, 1647105, 1647361, 1647617, 1647873,
+    1236225, 1648129, 1648385, 1648641, 1648897, 1649153, 1649409, 1649665,
+    1649921, 1236481, 1650177, 1650433, 1650689, 1650945, 1651201, 1651457,
+    1651713, 1651969, 1652225, 1652481, 1652737, 1652993, 1236993, 1653249,
+    1653505, 1653761, 1654017, 1654273, 1654529, 1654785, 1655041, 1655297,
+    1655553, 1655809, 1655809, 1656065, 1656321, 1237505, 1656577, 1656833,
+    1657089, 1657345, 1657601, 1657857, 1658113, 1167617, 1658369, 1658625,
+    1658881, 1659137, 1659393, 1659649, 1659905, 1239041, 1660161, 1660417,
+    1660673, 1660929, 1661185, 1661441, 1661441, 1239297, 1246721, 1661697,
+    1661953, 1662209, 1662465, 1662721, 1158145, 1239809, 1662977, 1663233,
+    1221377, 1663489, 1663745, 1210369, 1664001, 1664257, 1222145, 1664513,
+    1664769, 1665025, 1665281, 1665281, 1665537, 1665793, 1666049, 1666305,
+    1666561, 1666817, 1667073, 1667329, 1667585, 1667841, 1668097, 1668353,
+    1668609, 1668865, 1669121, 1669377, 1669633, 1669889, 1670145, 1670401,
+    1670657, 1670913, 1671169, 1671425, 1671681, 1671937, 1672193, 1223681,
+    1672449, 1672705, 1672961, 1673217, 1673473, 1673729, 1673985, 1674241,
+    1674497, 1674753, 1675009, 1675265, 1675521, 1675777, 1676033, 1676289,
+    1621505, 1676545, 1676801, 1677057, 1677313, 1677569, 1677825, 1678081,
+    1678337, 1678593, 1678849, 1679105, 1679361, 1171969, 1679617, 1679873,
+    1680129, 1680385, 1680641, 1680897, 1224449, 1681153, 1681409, 1681665,
+    1681921, 1682177, 1682433, 1682689, 1682945, 1683201, 1683457, 1683713,
+    1683969, 1684225, 1684481, 1684737, 1684993, 1685249, 1685505, 1685761,
+    1686017, 1156865, 1686273, 1686529, 1686785, 1687041, 1687297, 1687553,
+    1241601, 1687809, 1688065, 1688321, 1688577, 1688833, 1689089, 1689345,
+    1689601, 753921, 1689857, 1690113, 1690369, 1690625, 1690881, 1691137,
+    1691393, 1691649, 1691905, 1692161, 1692417, 1242881, 1243137, 755713,
+    1692673, 1692929, 1693185, 1693441, 1693697, 1693953, 1694209, 1694465,
+    1694721, 1694977, 1695233, 1695489, 1243393, 1695745, 1696001, 1696257,
+    1696513, 1696769, 1697025, 1697281, 1697537, 1697793, 1698049, 1698305,
+    1698561, 1698817, 1699073, 1699329, 1699585, 1699841, 1700097, 1700353,
+    1700609, 1700865, 1701121, 1701377, 1701633, 1701889, 1702145, 1702401,
+    1702657, 1702913, 1703169, 1244929, 1244929, 1703425, 1703681, 1703937,
+    1704193, 1704449, 1704705, 1704961, 1705217, 1705473, 1705729, 1245185,
+    1705985, 1706241, 1706497, 1706753, 1707009, 1707265, 1707521, 1707777,
+    1708033, 1708289, 768001, 1708545, 769025, 1708801, 1709057, 1709313,
+    1709569, 770305, 1709825,
+};
+
+const char32_t kDecompositionPool[6680] = {
+    32, 32, 776, 97, 32, 772, 50, 51, 32, 769, 956, 32, 807, 49, 111, 49,
+    8260, 52, 49, 8260, 50, 51, 8260, 52, 65, 768, 65, 769, 65, 770, 65, 771,
+    65, 776, 65, 778, 67, 807, 69, 768, 69, 769, 69, 770, 69, 776, 73, 768,
+    73, 769, 73, 770, 73, 776, 78, 771, 79, 768, 79, 769, 79, 770, 79, 771,
+    79, 776, 85, 768, 85, 769, 85, 770, 85, 776, 89, 769, 97, 768, 97, 769,
+    97, 770, 97, 771, 97, 776, 97, 778, 99, 807, 101, 768, 101, 769, 101, 770,
+    101, 776, 105, 768, 105, 769, 105, 770, 105, 776, 110, 771, 111, 768, 111, 769,
+    111, 770, 111, 771, 111, 776, 117, 768, 117, 769, 117, 770, 117, 776, 121, 769,
+    121, 776, 65, 772, 97, 772, 65, 774, 97, 774, 65, 808, 97, 808, 67, 769,
+    99, 769, 67, 770, 99, 770, 67, 775, 99, 775, 67, 780, 99, 780, 68, 780,
+    100, 780, 69, 772, 101, 772, 69, 774, 101, 774, 69, 775, 101, 775, 69, 808,
+    101, 808, 69, 780, 101, 780, 71, 770, 103, 770, 71, 774, 103, 774, 71, 775,
+    103, 775, 71, 807, 103, 807, 72, 770, 104, 770, 73, 771, 105, 771, 73, 772,
+    105, 772, 73, 774, 105, 774, 73, 808, 105, 808, 73, 775, 73, 74, 105, 106,
+    74, 770, 106, 770, 75, 807, 107, 807, 76, 769, 108, 769, 76, 807, 108, 807,
+    76, 780, 108, 780, 76, 183, 108, 183, 78, 769, 110, 769, 78, 807, 110, 807,
+    78, 780, 110, 780, 700, 110, 79, 772, 111, 772, 79, 774, 111, 774, 79, 779,
+    111, 779, 82, 769, 114, 769, 82, 807, 114, 807, 82, 780, 114, 780, 83, 769,
+    115, 769, 83, 770, 115, 770, 83, 807, 115, 807, 83, 780, 115, 780, 84, 807,
+    116, 807, 84, 780, 116, 780, 85, 771, 117, 771, 85, 772, 117, 772, 85, 774,
+    117, 774, 85, 778, 117, 778, 85, 779, 117, 779, 85, 808, 117, 808, 87, 770,
+    119, 770, 89, 770, 121, 770, 89, 776, 90, 769, 122, 769, 90, 775, 122, 775,
+    90, 780, 122, 780, 115, 79, 795, 111, 795, 85, 795, 117, 795, 68, 90, 780,
+    68, 122, 780, 100, 122, 780, 76, 74, 76, 106, 108, 106, 78, 74, 78, 106,
+    110, 106, 65, 780, 97, 780, 73, 780, 105, 780, 79, 780, 111, 780, 85, 780,
+    117, 780, 85, 776, 772, 117, 776, 772, 85, 776, 769, 117, 776, 769, 85, 776,
+    780, 117, 776, 780, 85, 776, 768, 117, 776, 768, 65, 776, 772, 97, 776, 772,
+    65, 775, 772, 97, 775, 772, 198, 772, 230, 772, 71, 780, 103, 780, 75, 780,
+    107, 780, 79, 808, 111, 808, 79, 808, 772, 111, 808, 772, 439, 780, 658, 780,
+    106, 780, 68, 90, 68, 122, 100, 122, 71, 769, 103, 769, 78, 768, 110, 768,
+    65, 778, 769, 97, 778, 769, 198, 769, 230, 769, 216, 769, 248, 769, 65, 783,
+    97, 783, 65, 785, 97, 785, 69, 783, 101, 783, 69, 785, 101, 785, 73, 783,
+    105, 783, 73, 785, 105, 785, 79, 783, 111, 783, 79, 785, 111, 785, 82, 783,
+    114, 783, 82, 785, 114, 785, 85, 783, 117, 783, 85, 785, 117, 785, 83, 806,
+    115, 806, 84, 806, 116, 806, 72, 780, 104, 780, 65, 775, 97, 775, 69, 807,
+    101, 807, 79, 776, 772, 111, 776, 772, 79, 771, 772, 111, 771, 772, 79, 775,
+    111, 775, 79, 775, 772, 111, 775, 772, 89, 772, 121, 772, 104, 614, 106, 114,
+    633, 635, 641, 119, 121, 32, 774, 32, 775, 32, 778, 32, 808, 32, 771, 32,
+    779, 611, 108, 120, 661, 768, 769, 787, 776, 769, 697, 32, 837, 59, 168, 769,
+    32, 776, 769, 913, 769, 183, 917, 769, 919, 769, 921, 769, 927, 769, 933, 769,
+    937, 769, 953, 776, 769, 921, 776, 933, 776, 945, 769, 949, 769, 951, 769, 953,
+    769, 965, 776, 769, 953, 776, 965, 776, 959, 769, 965, 769, 969, 769, 946, 952,
+    933, 978, 769, 978, 776, 966, 960, 954, 961, 962, 920, 949, 931, 1045, 768, 1045,
+    776, 1043, 769, 1030, 776, 1050, 769, 1048, 768, 1059, 774, 1048, 774, 1080, 774, 1077,
+    768, 1077, 776, 1075, 769, 1110, 776, 1082, 769, 1080, 768, 1091, 774, 1140, 783, 1141,
+    783, 1046, 774, 1078, 774, 1040, 774, 1072, 774, 1040, 776, 1072, 776, 1045, 774, 1077,
+    774, 1240, 776, 1241, 776, 1046, 776, 1078, 776, 1047, 776, 1079, 776, 1048, 772, 1080,
+    772, 1048, 776, 1080, 776, 1054, 776, 1086, 776, 1256, 776, 1257, 776, 1069, 776, 1101,
+    776, 1059, 772, 1091, 772, 1059, 776, 1091, 776, 1059, 779, 1091, 779, 1063, 776, 1095,
+    776, 1067, 776, 1099, 776, 1381, 1410, 1575, 1619, 1575, 1620, 1608, 1620, 1575, 1621, 1610,
+    1620, 1575, 1652, 1608, 1652, 1735, 1652, 1610, 1652, 1749, 1620, 1729, 1620, 1746, 1620, 2344,
+    2364, 2352, 2364, 2355, 2364, 2325, 2364, 2326, 2364, 2327, 2364, 2332, 2364, 2337, 2364, 2338,
+    2364, 2347, 2364, 2351, 2364, 2503, 2494, 2503, 2519, 2465, 2492, 2466, 2492, 2479, 2492, 2610,
+    2620, 2616, 2620, 2582, 2620, 2583, 2620, 2588, 2620, 2603, 2620, 2887, 2902, 2887, 2878, 2887,
+    2903, 2849, 2876, 2850, 2876, 2962, 3031, 3014, 3006, 3015, 3006, 3014, 3031, 3142, 3158, 3263,
+    3285, 3270, 3285, 3270, 3286, 3270, 3266, 3270, 3266, 3285, 3398, 3390, 3399, 3390, 3398, 3415,
+    3545, 3530, 3545, 3535, 3545, 3535, 3530, 3545, 3551, 3661, 3634, 3789, 3762, 3755, 3737, 3755,
+    3745, 3851, 3906, 4023, 3916, 4023, 3921, 4023, 3926, 4023, 3931, 4023, 3904, 4021, 3953, 3954,
+    3953, 3956, 4018, 3968, 4018, 3953, 3968, 4019, 3968, 4019, 3953, 3968, 3953, 3968, 3986, 4023,
+    3996, 4023, 4001, 4023, 4006, 4023, 4011, 4023, 3984, 4021, 4133, 4142, 4316, 6917, 6965, 6919,
+    6965, 6921, 6965, 6923, 6965, 6925, 6965, 6929, 6965, 6970, 6965, 6972, 6965, 6974, 6965, 6975,
+    6965, 6978, 6965, 65, 198, 66, 68, 69, 398, 71, 72, 73, 74, 75, 76, 77,
+    78, 79, 546, 80, 82, 84, 85, 87, 592, 593, 7426, 98, 100, 101, 601, 603,
+    604, 103, 107, 109, 331, 596, 7446, 7447, 112, 116, 117, 7453, 623, 118, 7461, 947,
+    948, 967, 105, 1085, 594, 99, 597, 240, 102, 607, 609, 613, 616, 617, 618, 7547,
+    669, 621, 7557, 671, 625, 624, 626, 627, 628, 629, 632, 642, 643, 427, 649, 650,
+    7452, 651, 652, 122, 656, 657, 658, 65, 805, 97, 805, 66, 775, 98, 775, 66,
+    803, 98, 803, 66, 817, 98, 817, 67, 807, 769, 99, 807, 769, 68, 775, 100,
+    775, 68, 803, 100, 803, 68, 817, 100, 817, 68, 807, 100, 807, 68, 813, 100,
+    813, 69, 772, 768, 101, 772, 768, 69, 772, 769, 101, 772, 769, 69, 813, 101,
+    813, 69, 816, 101, 816, 69, 807, 774, 101, 807, 774, 70, 775, 102, 775, 71,
+    772, 103, 772, 72, 775, 104, 775, 72, 803, 104, 803, 72, 776, 104, 776, 72,
+    807, 104, 807, 72, 814, 104, 814, 73, 816, 105, 816, 73, 776, 769, 105, 776,
+    769, 75, 769, 107, 769, 75, 803, 107, 803, 75, 817, 107, 817, 76, 803, 108,
+    803, 76, 803, 772, 108, 803, 772, 76, 817, 108, 817, 76, 813, 108, 813, 77,
+    769, 109, 769, 77, 775, 109, 775, 77, 803, 109, 803, 78, 775, 110, 775, 78,
+    803, 110, 803, 78, 817, 110, 817, 78, 813, 110, 813, 79, 771, 769, 111, 771,
+    769, 79, 771, 776, 111, 771, 776, 79, 772, 768, 111, 772, 768, 79, 772, 769,
+    111, 772, 769, 80, 769, 112, 769, 80, 775, 112, 775, 82, 775, 114, 775, 82,
+    803, 114, 803, 82, 803, 772, 114, 803, 772, 82, 817, 114, 817, 83, 775, 115,
+    775, 83, 803, 115, 803, 83, 769, 775, 115, 769, 775, 83, 780, 775, 115, 780,
+    775, 83, 803, 775, 115, 803, 775, 84, 775, 116, 775, 84, 803, 116, 803, 84,
+    817, 116, 817, 84, 813, 116, 813, 85, 804, 117, 804, 85, 816, 117, 816, 85,
+    813, 117, 813, 85, 771, 769, 117, 771, 769, 85, 772, 776, 117, 772, 776, 86,
+    771, 118, 771, 86, 803, 118, 803, 87, 768, 119, 768, 87, 769, 119, 769, 87,
+    776, 119, 776, 87, 775, 119, 775, 87, 803, 119, 803, 88, 775, 120, 775, 88,
+    776, 120, 776, 89, 775, 121, 775, 90, 770, 122, 770, 90, 803, 122, 803, 90,
+    817, 122, 817, 104, 817, 116, 776, 119, 778, 121, 778, 97, 702, 383, 775, 65,
+    803, 97, 803, 65, 777, 97, 777, 65, 770, 769, 97, 770, 769, 65, 770, 768,
+    97, 770, 768, 65, 770, 777, 97, 770, 777, 65, 770, 771, 97, 770, 771, 65,
+    803, 770, 97, 803, 770, 65, 774, 769, 97, 774, 769, 65, 774, 768, 97, 774,
+    768, 65, 774, 777, 97, 774, 777, 65, 774, 771, 97, 774, 771, 65, 803, 774,
+    97, 803, 774, 69, 803, 101, 803, 69, 777, 101, 777, 69, 771, 101, 771, 69,
+    770, 769, 101, 770, 769, 69, 770, 768, 101, 770, 768, 69, 770, 777, 101, 770,
+    777, 69, 770, 771, 101, 770, 771, 69, 803, 770, 101, 803, 770, 73, 777, 105,
+    777, 73, 803, 105, 803, 79, 803, 111, 803, 79, 777, 111, 777, 79, 770, 769,
+    111, 770, 769, 79, 770, 768, 111, 770, 768, 79, 770, 777, 111, 770, 777, 79,
+    770, 771, 111, 770, 771, 79, 803, 770, 111, 803, 770, 79, 795, 769, 111, 795,
+    769, 79, 795, 768, 111, 795, 768, 79, 795, 777, 111, 795, 777, 79, 795, 771,
+    111, 795, 771, 79, 795, 803, 111, 795, 803, 85, 803, 117, 803, 85, 777, 117,
+    777, 85, 795, 769, 117, 795, 769, 85, 795, 768, 117, 795, 768, 85, 795, 777,
+    117, 795, 777, 85, 795, 771, 117, 795, 771, 85, 795, 803, 117, 795, 803, 89,
+    768, 121, 768, 89, 803, 121, 803, 89, 777, 121, 777, 89, 771, 121, 771, 945,
+    787, 945, 788, 945, 787, 768, 945, 788, 768, 945, 787, 769, 945, 788, 769, 945,
+    787, 834, 945, 788, 834, 913, 787, 913, 788, 913, 787, 768, 913, 788, 768, 913,
+    787, 769, 913, 788, 769, 913, 787, 834, 913, 788, 834, 949, 787, 949, 788, 949,
+    787, 768, 949, 788, 768, 949, 787, 769, 949, 788, 769, 917, 787, 917, 788, 917,
+    787, 768, 917, 788, 768, 917, 787, 769, 917, 788, 769, 951, 787, 951, 788, 951,
+    787, 768, 951, 788, 768, 951, 787, 769, 951, 788, 769, 951, 787, 834, 951, 788,
+    834, 919, 787, 919, 788, 919, 787, 768, 919, 788, 768, 919, 787, 769, 919, 788,
+    769, 919, 787, 834, 919, 788, 834, 953, 787, 953, 788, 953, 787, 768, 953, 788,
+    768, 953, 787, 769, 953, 788, 769, 953, 787, 834, 953, 788, 834, 921, 787, 921,
+    788, 921, 787, 768, 921, 788, 768, 921, 787, 769, 921, 788, 769, 921, 787, 834,
+    921, 788, 834, 959, 787, 959, 788, 959, 787, 768, 959, 788, 768, 959, 787, 769,
+    959, 788, 769, 927, 787, 927, 788, 927, 787, 768, 927, 788, 768, 927, 787, 769,
+    927, 788, 769, 965, 787, 965, 788, 965, 787, 768, 965, 788, 768, 965, 787, 769,
+    965, 788, 769, 965, 787, 834, 965, 788, 834, 933, 788, 933, 788, 768, 933, 788,
+    769, 933, 788, 834, 969, 787, 969, 788, 969, 787, 768, 969, 788, 768, 969, 787,
+    769, 969, 788, 769, 969, 787, 834, 969, 788, 834, 937, 787, 937, 788, 937, 787,
+    768, 937, 788, 768, 937, 787, 769, 937, 788, 769, 937, 787, 834, 937, 788, 834,
+    945, 768, 949, 768, 951, 768, 953, 768, 959, 768, 965, 768, 969, 768, 945, 787,
+    837, 945, 788, 837, 945, 787, 768, 837, 945, 788, 768, 837, 945, 787, 769, 837,
+    945, 788, 769, 837, 945, 787, 834, 837, 945, 788, 834, 837, 913, 787, 837, 913,
+    788, 837, 913, 787, 768, 837, 913, 788, 768, 837, 913, 787, 769, 837, 913, 788,
+    769, 837, 913, 787, 834, 837, 913, 788, 834, 837, 951, 787, 837, 951, 788, 837,
+    951, 787, 768, 837, 951, 788, 768, 837, 951, 787, 769, 837, 951, 788, 769, 837,
+    951, 787, 834, 837, 951, 788, 834, 837, 919, 787, 837, 919, 788, 837, 919, 787,
+    768, 837, 919, 788, 768, 837, 919, 787, 769, 837, 919, 788, 769, 837, 919, 787,
+    834, 837, 919, 788, 834, 837, 969, 787, 837, 969, 788, 837, 969, 787, 768, 837,
+    969, 788, 768, 837, 969, 787, 769, 837, 969, 788, 769, 837, 969, 787, 834, 837,
+    969, 788, 834, 837, 937, 787, 837, 937, 788, 837, 937, 787, 768, 837, 937, 788,
+    768, 837, 937, 787, 769, 837, 937, 788, 769, 837, 937, 787, 834, 837, 937, 788,
+    834, 837, 945, 774, 945, 772, 945, 768, 837, 945, 837, 945, 769, 837, 945, 834,
+    945, 834, 837, 913, 774, 913, 772, 913, 768, 913, 837, 32, 787, 953, 32, 834,
+    168, 834, 32, 776, 834, 951, 768, 837, 951, 837, 951, 769, 837, 951, 834, 951,
+    834, 837, 917, 768, 919, 768, 919, 837, 8127, 768, 32, 787, 768, 8127, 769, 32,
+    787, 769, 8127, 834, 32, 787, 834, 953, 774, 953, 772, 953, 776, 768, 953, 834,
+    953, 776, 834, 921, 774, 921, 772, 921, 768, 8190, 768, 32, 788, 768, 8190, 769,
+    32, 788, 769, 8190, 834, 32, 788, 834, 965, 774, 965, 772, 965, 776, 768, 961,
+    787, 961, 788, 965, 834, 965, 776, 834, 933, 774, 933, 772, 933, 768, 929, 788,
+    168, 768, 32, 776, 768, 96, 969, 768, 837, 969, 837, 969, 769, 837, 969, 834,
+    969, 834, 837, 927, 768, 937, 768, 937, 837, 180, 32, 788, 8194, 8195, 8208, 32,
+    819, 46, 46, 46, 46, 46, 46, 8242, 8242, 8242, 8242, 8242, 8245, 8245, 8245, 8245,
+    8245, 33, 33, 32, 773, 63, 63, 63, 33, 33, 63, 8242, 8242, 8242, 8242, 48,
+    52, 53, 54, 55, 56, 57, 43, 8722, 61, 40, 41, 110, 82, 115, 97, 47,
+    99, 97, 47, 115, 67, 176, 67, 99, 47, 111, 99, 47, 117, 400, 176, 70,
+    295, 78, 111, 81, 83, 77, 84, 69, 76, 84, 77, 90, 937, 70, 1488, 1489,
+    1490, 1491, 70, 65, 88, 915, 928, 8721, 49, 8260, 55, 49, 8260, 57, 49, 8260,
+    49, 48, 49, 8260, 51, 50, 8260, 51, 49, 8260, 53, 50, 8260, 53, 51, 8260,
+    53, 52, 8260, 53, 49, 8260, 54, 53, 8260, 54, 49, 8260, 56, 51, 8260, 56,
+    53, 8260, 56, 55, 8260, 56, 49, 8260, 73, 73, 73, 73, 73, 73, 86, 86,
+    86, 73, 86, 73, 73, 86, 73, 73, 73, 73, 88, 88, 88, 73, 88, 73,
+    73, 105, 105, 105, 105, 105, 105, 118, 118, 105, 118, 105, 105, 118, 105, 105,
+    105, 105, 120, 120, 105, 120, 105, 105, 48, 8260, 51, 8592, 824, 8594, 824, 8596,
+    824, 8656, 824, 8660, 824, 8658, 824, 8707, 824, 8712, 824, 8715, 824, 8739, 824, 8741,
+    824, 8747, 8747, 8747, 8747, 8747, 8750, 8750, 8750, 8750, 8750, 8764, 824, 8771, 824, 8773,
+    824, 8776, 824, 61, 824, 8801, 824, 8781, 824, 60, 824, 62, 824, 8804, 824, 8805,
+    824, 8818, 824, 8819, 824, 8822, 824, 8823, 824, 8826, 824, 8827, 824, 8834, 824, 8835,
+    824, 8838, 824, 8839, 824, 8866, 824, 8872, 824, 8873, 824, 8875, 824, 8828, 824, 8829,
+    824, 8849, 824, 8850, 824, 8882, 824, 8883, 824, 8884, 824, 8885, 824, 12296, 12297, 49,
+    48, 49, 49, 49, 50, 49, 51, 49, 52, 49, 53, 49, 54, 49, 55, 49,
+    56, 49, 57, 50, 48, 40, 49, 41, 40, 50, 41, 40, 51, 41, 40, 52,
+    41, 40, 53, 41, 40, 54, 41, 40, 55, 41, 40, 56, 41, 40, 57, 41,
+    40, 49, 48, 41, 40, 49, 49, 41, 40, 49, 50, 41, 40, 49, 51, 41,
+    40, 49, 52, 41, 40, 49, 53, 41, 40, 49, 54, 41, 40, 49, 55, 41,
+    40, 49, 56, 41, 40, 49, 57, 41, 40, 50, 48, 41, 49, 46, 50, 46,
+    51, 46, 52, 46, 53, 46, 54, 46, 55, 46, 56, 46, 57, 46, 49, 48,
+    46, 49, 49, 46, 49, 50, 46, 49, 51, 46, 49, 52, 46, 49, 53, 46,
+    49, 54, 46, 49, 55, 46, 49, 56, 46, 49, 57, 46, 50, 48, 46, 40,
+    97, 41, 40, 98, 41, 40, 99, 41, 40, 100, 41, 40, 101, 41, 40, 102,
+    41, 40, 103, 41, 40, 104, 41, 40, 105, 41, 40, 106, 41, 40, 107, 41,
+    40, 108, 41, 40, 109, 41, 40, 110, 41, 40, 111, 41, 40, 112, 41, 40,
+    113, 41, 40, 114, 41, 40, 115, 41, 40, 116, 41, 40, 117, 41, 40, 118,
+    41, 40, 119, 41, 40, 120, 41, 40, 121, 41, 40, 122, 41, 83, 89, 113,
+    8747, 8747, 8747, 8747, 58, 58, 61, 61, 61, 61, 61, 61, 10973, 824, 11617, 27597,
+    40863, 19968, 20008, 20022, 20031, 20057, 20101, 20108, 20128, 20154, 20799, 20837, 20843, 20866, 20886, 20907,
+    20960, 20981, 20992, 21147, 21241, 21269, 21274, 21304, 21313, 21340, 21353, 21378, 21430, 21448, 21475, 22231,
+    22303, 22763, 22786, 22794, 22805, 22823, 22899, 23376, 23424, 23544, 23567, 23586, 23608, 23662, 23665, 24027,
+    24037, 24049, 24062, 24178, 24186, 24191, 24308, 24318, 24331, 24339, 24400, 24417, 24435, 24515, 25096, 25142,
+    25163, 25903, 25908, 25991, 26007, 26020, 26041, 26080, 26085, 26352, 26376, 26408, 27424, 27490, 27513, 27571,
+    27595, 27604, 27611, 27663, 27668, 27700, 28779, 29226, 29238, 29243, 29247, 29255, 29273, 29275, 29356, 29572,
+    29577, 29916, 29926, 29976, 29983, 29992, 30000, 30091, 30098, 30326, 30333, 30382, 30399, 30446, 30683, 30690,
+    30707, 31034, 31160, 31166, 31348, 31435, 31481, 31859, 31992, 32566, 32593, 32650, 32701, 32769, 32780, 32786,
+    32819, 32895, 32905, 33251, 33258, 33267, 33276, 33292, 33307, 33311, 33390, 33394, 33400, 34381, 34411, 34880,
+    34892, 34915, 35198, 35211, 35282, 35328, 35895, 35910, 35925, 35960, 35997, 36196, 36208, 36275, 36523, 36554,
+    36763, 36784, 36789, 37009, 37193, 37318, 37324, 37329, 38263, 38272, 38428, 38582, 38585, 38632, 38737, 38750,
+    38754, 38761, 38859, 38893, 38899, 38913, 39080, 39131, 39135, 39318, 39321, 39340, 39592, 39640, 39647, 39717,
+    39727, 39730, 39740, 39770, 40165, 40565, 40575, 40613, 40635, 40643, 40653, 40657, 40697, 40701, 40718, 40723,
+    40736, 40763, 40778, 40786, 40845, 40860, 40864, 12306, 21316, 21317, 12363, 12441, 12365, 12441, 12367, 12441,
+    12369, 12441, 12371, 12441, 12373, 12441, 12375, 12441, 12377, 12441, 12379, 12441, 12381, 12441, 12383, 12441,
+    12385, 12441, 12388, 12441, 12390, 12441, 12392, 12441, 12399, 12441, 12399, 12442, 12402, 12441, 12402, 12442,
+    12405, 12441, 12405, 12442, 12408, 12441, 12408, 12442, 12411, 12441, 12411, 12442, 12358, 12441, 32, 12441,
+    32, 12442, 12445, 12441, 12424, 12426, 12459, 12441, 12461, 12441, 12463, 12441, 12465, 12441, 12467, 12441,
+    12469, 12441, 12471, 12441, 12473, 12441, 12475, 12441, 12477, 12441, 12479, 12441, 12481, 12441, 12484, 12441,
+    12486, 12441, 12488, 12441, 12495, 12441, 12495, 12442, 12498, 12441, 12498, 12442, 12501, 12441, 12501, 12442,
+    12504, 12441, 12504, 12442, 12507, 12441, 12507, 12442, 12454, 12441, 12527, 12441, 12528, 12441, 12529, 12441,
+    12530, 12441, 12541, 12441, 12467, 12488, 4352, 4353, 4522, 4354, 4524, 4525, 4355, 4356, 4357, 4528,
+    4529, 4530, 4531, 4532, 4533, 4378, 4358, 4359, 4360, 4385, 4361, 4362, 4363, 4364, 4365, 4366,
+    4367, 4368, 4369, 4370, 4449, 4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460,
+    4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469, 4448, 4372, 4373, 4551, 4552, 4556, 4558,
+    4563, 4567, 4569, 4380, 4573, 4575, 4381, 4382, 4384, 4386, 4387, 4391, 4393, 4395, 4396, 4397,
+    4398, 4399, 4402, 4406, 4416, 4423, 4428, 4593, 4594, 4439, 4440, 4441, 4484, 4485, 4488, 4497,
+    4498, 4500, 4510, 4513, 19977, 22235, 19978, 20013, 19979, 30002, 19993, 19969, 22825, 22320, 40, 4352,
+    41, 40, 4354, 41, 40, 4355, 41, 40, 4357, 41, 40, 4358, 41, 40, 4359, 41,
+    40, 4361, 41, 40, 4363, 41, 40, 4364, 41, 40, 4366, 41, 40, 4367, 41, 40,
+    4368, 41, 40, 4369, 41, 40, 4370, 41, 40, 4352, 4449, 41, 40, 4354, 4449, 41,
+    40, 4355, 4449, 41, 40, 4357, 4449, 41, 40, 4358, 4449, 41, 40, 4359, 4449, 41,
+    40, 4361, 4449, 41, 40, 4363, 4449, 41, 40, 4364, 4449, 41, 40, 4366, 4449, 41,
+    40, 4367, 4449, 41, 40, 4368, 4449, 41, 40, 4369, 4449, 41, 40, 4370, 4449, 41,
+    40, 4364, 4462, 41, 40, 4363, 4457, 4364, 4453, 4523, 41, 40, 4363, 4457, 4370, 4462,
+    41, 40, 19968, 41, 40, 20108, 41, 40, 19977, 41, 40, 22235, 41, 40, 20116, 41,
+    40, 20845, 41, 40, 19971, 41, 40, 20843, 41, 40, 20061, 41, 40, 21313, 41, 40,
+    26376, 41, 40, 28779, 41, 40, 27700, 41, 40, 26408, 41, 40, 37329, 41, 40, 22303,
+    41, 40, 26085, 41, 40, 26666, 41, 40, 26377, 41, 40, 31038, 41, 40, 21517, 41,
+    40, 29305, 41, 40, 36001, 41, 40, 31069, 41, 40, 21172, 41, 40, 20195, 41, 40,
+    21628, 41, 40, 23398, 41, 40, 30435, 41, 40, 20225, 41, 40, 36039, 41, 40, 21332,
+    41, 40, 31085, 41, 40, 20241, 41, 40, 33258, 41, 40, 33267, 41, 21839, 24188, 31631,
+    80, 84, 69, 50, 49, 50, 50, 50, 51, 50, 52, 50, 53, 50, 54, 50,
+    55, 50, 56, 50, 57, 51, 48, 51, 49, 51, 50, 51, 51, 51, 52, 51,
+    53, 4352, 4449, 4354, 4449, 4355, 4449, 4357, 4449, 4358, 4449, 4359, 4449, 4361, 4449, 4363,
+    4449, 4364, 4449, 4366, 4449, 4367, 4449, 4368, 4449, 4369, 4449, 4370, 4449, 4366, 4449, 4535,
+    4352, 4457, 4364, 4462, 4363, 4468, 4363, 4462, 20116, 20845, 19971, 20061, 26666, 26377, 31038, 21517,
+    29305, 36001, 31069, 21172, 31192, 30007, 36969, 20778, 21360, 27880, 38917, 20241, 20889, 27491, 24038, 21491,
+    21307, 23447, 23398, 30435, 20225, 36039, 21332, 22812, 51, 54, 51, 55, 51, 56, 51, 57,
+    52, 48, 52, 49, 52, 50, 52, 51, 52, 52, 52, 53, 52, 54, 52, 55,
+    52, 56, 52, 57, 53, 48, 49, 26376, 50, 26376, 51, 26376, 52, 26376, 53, 26376,
+    54, 26376, 55, 26376, 56, 26376, 57, 26376, 49, 48, 26376, 49, 49, 26376, 49, 50,
+    26376, 72, 103, 101, 114, 103, 101, 86, 76, 84, 68, 12450, 12452, 12454, 12456, 12458,
+    12459, 12461, 12463, 12465, 12467, 12469, 12471, 12473, 12475, 12477, 12479, 12481, 12484, 12486, 12488, 12490,
+    12491, 12492, 12493, 12494, 12495, 12498, 12501, 12504, 12507, 12510, 12511, 12512, 12513, 12514, 12516, 12518,
+    12520, 12521, 12522, 12523, 12524, 12525, 12527, 12528, 12529, 12530, 20196, 21644, 12450, 12495, 12442, 12540,
+    12488, 12450, 12523, 12501, 12449, 12450, 12531, 12504, 12442, 12450, 12450, 12540, 12523, 12452, 12491, 12531,
+    12463, 12441, 12452, 12531, 12481, 12454, 12457, 12531, 12456, 12473, 12463, 12540, 12488, 12441, 12456, 12540,
+    12459, 12540, 12458, 12531, 12473, 12458, 12540, 12512, 12459, 12452, 12522, 12459, 12521, 12483, 12488, 12459,
+    12525, 12522, 12540, 12459, 12441, 12525, 12531, 12459, 12441, 12531, 12510, 12461, 12441, 12459, 12441, 12461,
+    12441, 12491, 12540, 12461, 12517, 12522, 12540, 12461, 12441, 12523, 12479, 12441, 12540, 12461, 12525, 12461,
+    12525, 12463, 12441, 12521, 12512, 12461, 12525, 12513, 12540, 12488, 12523, 12461, 12525, 12527, 12483, 12488,
+    12463, 12441, 12521, 12512, 12463, 12441, 12521, 12512, 12488, 12531, 12463, 12523, 12475, 12441, 12452, 12525,
+    12463, 12525, 12540, 12493, 12465, 12540, 12473, 12467, 12523, 12490, 12467, 12540, 12507, 12442, 12469, 12452,
+    12463, 12523, 12469, 12531, 12481, 12540, 12512, 12471, 12522, 12531, 12463, 12441, 12475, 12531, 12481, 12475,
+    12531, 12488, 12479, 12441, 12540, 12473, 12486, 12441, 12471, 12488, 12441, 12523, 12488, 12531, 12490, 12494,
+    12494, 12483, 12488, 12495, 12452, 12484, 12495, 12442, 12540, 12475, 12531, 12488, 12495, 12442, 12540, 12484,
+    12495, 12441, 12540, 12524, 12523, 12498, 12442, 12450, 12473, 12488, 12523, 12498, 12442, 12463, 12523, 12498,
+    12442, 12467, 12498, 12441, 12523, 12501, 12449, 12521, 12483, 12488, 12441, 12501, 12451, 12540, 12488, 12501,
+    12441, 12483, 12471, 12455, 12523, 12501, 12521, 12531, 12504, 12463, 12479, 12540, 12523, 12504, 12442, 12477,
+    12504, 12442, 12491, 12498, 12504, 12523, 12484, 12504, 12442, 12531, 12473, 12504, 12442, 12540, 12471, 12441,
+    12504, 12441, 12540, 12479, 12507, 12442, 12452, 12531, 12488, 12507, 12441, 12523, 12488, 12507, 12531, 12507,
+    12442, 12531, 12488, 12441, 12507, 12540, 12523, 12507, 12540, 12531, 12510, 12452, 12463, 12525, 12510, 12452,
+    12523, 12510, 12483, 12495, 12510, 12523, 12463, 12510, 12531, 12471, 12519, 12531, 12511, 12463, 12525, 12531,
+    12511, 12522, 12511, 12522, 12495, 12441, 12540, 12523, 12513, 12459, 12441, 12513, 12459, 12441, 12488, 12531,
+    12513, 12540, 12488, 12523, 12516, 12540, 12488, 12441, 12516, 12540, 12523, 12518, 12450, 12531, 12522, 12483,
+    12488, 12523, 12522, 12521, 12523, 12498, 12442, 12540, 12523, 12540, 12501, 12441, 12523, 12524, 12512, 12524,
+    12531, 12488, 12465, 12441, 12531, 12527, 12483, 12488, 48, 28857, 49, 28857, 50, 28857, 51, 28857,
+    52, 28857, 53, 28857, 54, 28857, 55, 28857, 56, 28857, 57, 28857, 49, 48, 28857, 49,
+    49, 28857, 49, 50, 28857, 49, 51, 28857, 49, 52, 28857, 49, 53, 28857, 49, 54,
+    28857, 49, 55, 28857, 49, 56, 28857, 49, 57, 28857, 50, 48, 28857, 50, 49, 28857,
+    50, 50, 28857, 50, 51, 28857, 50, 52, 28857, 104, 80, 97, 100, 97, 65, 85,
+    98, 97, 114, 111, 86, 112, 99, 100, 109, 100, 109, 50, 100, 109, 51, 73,
+    85, 24179, 25104, 26157, 21644, 22823, 27491, 26126, 27835, 26666, 24335, 20250, 31038, 112, 65, 110,
+    65, 956, 65, 109, 65, 107, 65, 75, 66, 77, 66, 71, 66, 99, 97, 108,
+    107, 99, 97, 108, 112, 70, 110, 70, 956, 70, 956, 103, 109, 103, 107, 103,
+    72, 122, 107, 72, 122, 77, 72, 122, 71, 72, 122, 84, 72, 122, 956, 108,
+    109, 108, 100, 108, 107, 108, 102, 109, 110, 109, 956, 109, 109, 109, 99, 109,
+    107, 109, 109, 109, 50, 99, 109, 50, 109, 50, 107, 109, 50, 109, 109, 51,
+    99, 109, 51, 109, 51, 107, 109, 51, 109, 8725, 115, 109, 8725, 115, 50, 80,
+    97, 107, 80, 97, 77, 80, 97, 71, 80, 97, 114, 97, 100, 114, 97, 100,
+    8725, 115, 114, 97, 100, 8725, 115, 50, 112, 115, 110, 115, 956, 115, 109, 115,
+    112, 86, 110, 86, 956, 86, 109, 86, 107, 86, 77, 86, 112, 87, 110, 87,
+    956, 87, 109, 87, 107, 87, 77, 87, 107, 937, 77, 937, 97, 46, 109, 46,
+    66, 113, 99, 99, 99, 100, 67, 8725, 107, 103, 67, 111, 46, 100, 66, 71,
+    121, 104, 97, 72, 80, 105, 110, 75, 75, 75, 77, 107, 116, 108, 109, 108,
+    110, 108, 111, 103, 108, 120, 109, 98, 109, 105, 108, 109, 111, 108, 80, 72,
+    112, 46, 109, 46, 80, 80, 77, 80, 82, 115, 114, 83, 118, 87, 98, 86,
+    8725, 109, 65, 8725, 109, 49, 26085, 50, 26085, 51, 26085, 52, 26085, 53, 26085, 54,
+    26085, 55, 26085, 56, 26085, 57, 26085, 49, 48, 26085, 49, 49, 26085, 49, 50, 26085,
+    49, 51, 26085, 49, 52, 26085, 49, 53, 26085, 49, 54, 26085, 49, 55, 26085, 49,
+    56, 26085, 49, 57, 26085, 50, 48, 26085, 50, 49, 26085, 50, 50, 26085, 50, 51,
+    26085, 50, 52, 26085, 50, 53, 26085, 50, 54, 26085, 50, 55, 26085, 50, 56, 26085,
+    50, 57, 26085, 51, 48, 26085, 51, 49, 26085, 103, 97, 108, 1098, 1100, 42863, 294,
+    339, 42791, 43831, 619, 43858, 653, 35912, 26356, 36040, 28369, 20018, 21477, 22865, 21895, 22856, 25078,
+    30313, 32645, 34367, 34746, 35064, 37007, 27138, 27931, 28889, 29662, 33853, 37226, 39409, 20098, 21365, 27396,
+    29211, 34349, 40478, 23888, 28651, 34253, 35172, 25289, 33240, 34847, 24266, 26391, 28010, 29436, 37070, 20358,
+    20919, 21214, 25796, 27347, 29200, 30439, 34310, 34396, 36335, 38706, 39791, 40442, 30860, 31103, 32160, 33737,
+    37636, 35542, 22751, 24324, 31840, 32894, 29282, 30922, 36034, 38647, 22744, 23650, 27155, 28122, 28431, 32047,
+    32311, 38475, 21202, 32907, 20956, 20940, 31260, 32190, 33777, 38517, 35712, 25295, 35582, 20025, 23527, 24594,
+    29575, 30064, 21271, 30971, 20415, 24489, 19981, 27852, 25976, 32034, 21443, 22622, 30465, 33865, 35498, 27578,
+    27784, 25342, 33509, 25504, 30053, 20142, 20841, 20937, 26753, 31975, 33391, 35538, 37327, 21237, 21570, 24300,
+    26053, 28670, 31018, 38317, 39530, 40599, 40654, 26310, 27511, 36706, 24180, 24976, 25088, 25754, 28451, 29001,
+    29833, 31178, 32244, 32879, 36646, 34030, 36899, 37706, 21015, 21155, 21693, 28872, 35010, 24265, 24565, 25467,
+    27566, 31806, 29557, 20196, 22265, 23994, 24604, 29618, 29801, 32666, 32838, 37428, 38646, 38728, 38936, 20363,
+    31150, 37300, 38584, 24801, 20102, 20698, 23534, 23615, 26009, 29134, 30274, 34044, 36988, 26248, 38446, 21129,
+    26491, 26611, 27969, 28316, 29705, 30041, 30827, 32016, 39006, 25134, 38520, 20523, 23833, 28138, 36650, 24459,
+    24900, 26647, 38534, 21033, 21519, 23653, 26131, 26446, 26792, 27877, 29702, 30178, 32633, 35023, 35041, 38626,
+    21311, 28346, 21533, 29136, 29848, 34298, 38563, 40023, 40607, 26519, 28107, 33256, 31520, 31890, 29376, 28825,
+    35672, 20160, 33590, 21050, 20999, 24230, 25299, 31958, 23429, 27934, 26292, 36667, 38477, 24275, 20800, 21952,
+    22618, 26228, 20958, 29482, 30410, 31036, 31070, 31077, 31119, 38742, 31934, 34322, 35576, 36920, 37117, 39151,
+    39164, 39208, 40372, 37086, 38583, 20398, 20711, 20813, 21193, 21220, 21329, 21917, 22022, 22120, 22592, 22696,
+    23652, 24724, 24936, 24974, 25074, 25935, 26082, 26257, 26757, 28023, 28186, 28450, 29038, 29227, 29730, 30865,
+    31049, 31048, 31056, 31062, 31117, 31118, 31296, 31361, 31680, 32265, 32321, 32626, 32773, 33261, 33401, 33879,
+    35088, 35222, 35585, 35641, 36051, 36104, 36790, 38627, 38911, 38971, 24693, 148206, 33304, 20006, 20917, 20840,
+    20352, 20805, 20864, 21191, 21242, 21845, 21913, 21986, 22707, 22852, 22868, 23138, 23336, 24274, 24281, 24425,
+    24493, 24792, 24910, 24840, 24928, 25140, 25540, 25628, 25682, 25942, 26395, 26454, 28379, 28363, 28702, 30631,
+    29237, 29359, 29809, 29958, 30011, 30237, 30239, 30427, 30452, 30538, 30528, 30924, 31409, 31867, 32091, 32574,
+    33618, 33775, 34681, 35137, 35206, 35519, 35531, 35565, 35722, 36664, 36978, 37273, 37494, 38524, 38875, 38923,
+    39698, 141386, 141380, 144341, 15261, 16408, 16441, 152137, 154832, 163539, 40771, 40846, 102, 102, 102, 105,
+    102, 108, 102, 102, 105, 102, 102, 108, 115, 116, 1396, 1398, 1396, 1381, 1396, 1387,
+    1406, 1398, 1396, 1389, 1497, 1460, 1522, 1463, 1506, 1492, 1499, 1500, 1501, 1512, 1514, 1513,
+    1473, 1513, 1474, 1513, 1468, 1473, 1513, 1468, 1474, 1488, 1463, 1488, 1464, 1488, 1468, 1489,
+    1468, 1490, 1468, 1491, 1468, 1492, 1468, 1493, 1468, 1494, 1468, 1496, 1468, 1497, 1468, 1498,
+    1468, 1499, 1468, 1500, 1468, 1502, 1468, 1504, 1468, 1505, 1468, 1507, 1468, 1508, 1468, 1510,
+    1468, 1511, 1468, 1512, 1468, 1513, 1468, 1514, 1468, 1493, 1465, 1489, 1471, 1499, 1471, 1508,
+    1471, 1488, 1500, 1649, 1659, 1662, 1664, 1658, 1663, 1657, 1700, 1702, 1668, 1667, 1670, 1671,
+    1677, 1676, 1678, 1672, 1688, 1681, 1705, 1711, 1715, 1713, 1722, 1723, 1729, 1726, 1746, 1709,
+    1735, 1734, 1736, 1739, 1733, 1737, 1744, 1609, 1610, 1620, 1575, 1610, 1620, 1749, 1610, 1620,
+    1608, 1610, 1620, 1735, 1610, 1620, 1734, 1610, 1620, 1736, 1610, 1620, 1744, 1610, 1620, 1609,
+    1740, 1610, 1620, 1580, 1610, 1620, 1581, 1610, 1620, 1605, 1610, 1620, 1610, 1576, 1580, 1576,
+    1581, 1576, 1582, 1576, 1605, 1576, 1609, 1576, 1610, 1578, 1580, 1578, 1581, 1578, 1582, 1578,
+    1605, 1578, 1609, 1578, 1610, 1579, 1580, 1579, 1605, 1579, 1609, 1579, 1610, 1580, 1581, 1580,
+    1605, 1581, 1580, 1581, 1605, 1582, 1580, 1582, 1581, 1582, 1605, 1587, 1580, 1587, 1581, 1587,
+    1582, 1587, 1605, 1589, 1581, 1589, 1605, 1590, 1580, 1590, 1581, 1590, 1582, 1590, 1605, 1591,
+    1581, 1591, 1605, 1592, 1605, 1593, 1580, 1593, 1605, 1594, 1580, 1594, 1605, 1601, 1580, 1601,
+    1581, 1601, 1582, 1601, 1605, 1601, 1609, 1601, 1610, 1602, 1581, 1602, 1605, 1602, 1609, 1602,
+    1610, 1603, 1575, 1603, 1580, 1603, 1581, 1603, 1582, 1603, 1604, 1603, 1605, 1603, 1609, 1603,
+    1610, 1604, 1580, 1604, 1581, 1604, 1582, 1604, 1605, 1604, 1609, 1604, 1610, 1605, 1580, 1605,
+    1581, 1605, 1582, 1605, 1605, 1605, 1609, 1605, 1610, 1606, 1580, 1606, 1581, 1606, 1582, 1606,
+    1605, 1606, 1609, 1606, 1610, 1607, 1580, 1607, 1605, 1607, 1609, 1607, 1610, 1610, 1580, 1610,
+    1581, 1610, 1582, 1610, 1605, 1610, 1609, 1610, 1610, 1584, 1648, 1585, 1648, 1609, 1648, 32,
+    1612, 1617, 32, 1613, 1617, 32, 1614, 1617, 32, 1615, 1617, 32, 1616, 1617, 32, 1617,
+    1648, 1610, 1620, 1585, 1610, 1620, 1586, 1610, 1620, 1606, 1576, 1585, 1576, 1586, 1576, 1606,
+    1578, 1585, 1578, 1586, 1578, 1606, 1579, 1585, 1579, 1586, 1579, 1606, 1605, 1575, 1606, 1585,
+    1606, 1586, 1606, 1606, 1610, 1585, 1610, 1586, 1610, 1606, 1610, 1620, 1582, 1610, 1620, 1607,
+    1576, 1607, 1578, 1607, 1589, 1582, 1604, 1607, 1606, 1607, 1607, 1648, 1610, 1607, 1579, 1607,
+    1587, 1607, 1588, 1605, 1588, 1607, 1600, 1614, 1617, 1600, 1615, 1617, 1600, 1616, 1617, 1591,
+    1609, 1591, 1610, 1593, 1609, 1593, 1610, 1594, 1609, 1594, 1610, 1587, 1609, 1587, 1610, 1588,
+    1609, 1588, 1610, 1581, 1609, 1581, 1610, 1580, 1609, 1580, 1610, 1582, 1609, 1582, 1610, 1589,
+    1609, 1589, 1610, 1590, 1609, 1590, 1610, 1588, 1580, 1588, 1581, 1588, 1582, 1588, 1585, 1587,
+    1585, 1589, 1585, 1590, 1585, 1575, 1611, 1578, 1580, 1605, 1578, 1581, 1580, 1578, 1581, 1605,
+    1578, 1582, 1605, 1578, 1605, 1580, 1578, 1605, 1581, 1578, 1605, 1582, 1580, 1605, 1581, 1581,
+    1605, 1610, 1581, 1605, 1609, 1587, 1581, 1580, 1587, 1580, 1581, 1587, 1580, 1609, 1587, 1605,
+    1581, 1587, 1605, 1580, 1587, 1605, 1605, 1589, 1581, 1581, 1589, 1605, 1605, 1588, 1581, 1605,
+    1588, 1580, 1610, 1588, 1605, 1582, 1588, 1605, 1605, 1590, 1581, 1609, 1590, 1582, 1605, 1591,
+    1605, 1581, 1591, 1605, 1605, 1591, 1605, 1610, 1593, 1580, 1605, 1593, 1605, 1605, 1593, 1605,
+    1609, 1594, 1605, 1605, 1594, 1605, 1610, 1594, 1605, 1609, 1601, 1582, 1605, 1602, 1605, 1581,
+    1602, 1605, 1605, 1604, 1581, 1605, 1604, 1581, 1610, 1604, 1581, 1609, 1604, 1580, 1580, 1604,
+    1582, 1605, 1604, 1605, 1581, 1605, 1581, 1580, 1605, 1581, 1605, 1605, 1581, 1610, 1605, 1580,
+    1581, 1605, 1580, 1605, 1605, 1582, 1580, 1605, 1582, 1605, 1605, 1580, 1582, 1607, 1605, 1580,
+    1607, 1605, 1605, 1606, 1581, 1605, 1606, 1581, 1609, 1606, 1580, 1605, 1606, 1580, 1609, 1606,
+    1605, 1610, 1606, 1605, 1609, 1610, 1605, 1605, 1576, 1582, 1610, 1578, 1580, 1610, 1578, 1580,
+    1609, 1578, 1582, 1610, 1578, 1582, 1609, 1578, 1605, 1610, 1578, 1605, 1609, 1580, 1605, 1610,
+    1580, 1581, 1609, 1580, 1605, 1609, 1587, 1582, 1609, 1589, 1581, 1610, 1588, 1581, 1610, 1590,
+    1581, 1610, 1604, 1580, 1610, 1604, 1605, 1610, 1610, 1581, 1610, 1610, 1580, 1610, 1610, 1605,
+    1610, 1605, 1605, 1610, 1602, 1605, 1610, 1606, 1581, 1610, 1593, 1605, 1610, 1603, 1605, 1610,
+    1606, 1580, 1581, 1605, 1582, 1610, 1604, 1580, 1605, 1603, 1605, 1605, 1580, 1581, 1610, 1581,
+    1580, 1610, 1605, 1580, 1610, 1601, 1605, 1610, 1576, 1581, 1610, 1587, 1582, 1610, 1606, 1580,
+    1610, 1589, 1604, 1746, 1602, 1604, 1746, 1575, 1604, 1604, 1607, 1575, 1603, 1576, 1585, 1605,
+    1581, 1605, 1583, 1589, 1604, 1593, 1605, 1585, 1587, 1608, 1604, 1593, 1604, 1610, 1607, 1608,
+    1587, 1604, 1605, 1589, 1604, 1609, 1589, 1604, 1609, 32, 1575, 1604, 1604, 1607, 32, 1593,
+    1604, 1610, 1607, 32, 1608, 1587, 1604, 1605, 1580, 1604, 32, 1580, 1604, 1575, 1604, 1607,
+    1585, 1740, 1575, 1604, 44, 12289, 12290, 58, 33, 63, 12310, 12311, 8212, 8211, 95, 123,
+    125, 12308, 12309, 12304, 12305, 12298, 12299, 12300, 12301, 12302, 12303, 91, 93, 35, 38, 42,
+    45, 60, 62, 92, 36, 37, 64, 32, 1611, 1600, 1611, 32, 1612, 32, 1613, 32,
+    1614, 1600, 1614, 32, 1615, 1600, 1615, 32, 1616, 1600, 1616, 32, 1617, 1600, 1617, 32,
+    1618, 1600, 1618, 1569, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586,
+    1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608,
+    1610, 1604, 1575, 1619, 1604, 1575, 1620, 1604, 1575, 1621, 1604, 1575, 34, 39, 47, 94,
+    124, 126, 10629, 10630, 12539, 12449, 12451, 12453, 12455, 12457, 12515, 12517, 12519, 12483, 12540, 12531,
+    12441, 12442, 162, 163, 172, 166, 165, 8361, 9474, 8592, 8593, 8594, 8595, 9632, 9675, 720,
+    721, 230, 665, 595, 675, 43878, 677, 676, 598, 599, 7569, 600, 606, 681, 612, 610,
+    608, 667, 668, 615, 644, 682, 683, 620, 122628, 42894, 622, 122629, 654, 122630, 248, 630,
+    631, 634, 122632, 637, 638, 640, 680, 678, 43879, 679, 648, 11377, 655, 673, 674, 664,
+    448, 449, 450, 122634, 122654, 69785, 69818, 69787, 69818, 69797, 69818, 69937, 69927, 69938, 69927, 70471,
+    70462, 70471, 70487, 70841, 70842, 70841, 70832, 70841, 70845, 71096, 71087, 71097, 71087, 71989, 71984, 119127,
+    119141, 119128, 119141, 119128, 119141, 119150, 119128, 119141, 119151, 119128, 119141, 119152, 119128, 119141, 119153, 119128,
+    119141, 119154, 119225, 119141, 119226, 119141, 119225, 119141, 119150, 119226, 119141, 119150, 119225, 119141, 119151, 119226,
+    119141, 119151, 305, 567, 913, 914, 916, 917, 918, 919, 921, 922, 923, 924, 925, 926,
+    927, 929, 932, 934, 935, 936, 8711, 945, 950, 951, 955, 957, 958, 959, 963, 964,
+    965, 968, 969, 8706, 988, 989, 1646, 1697, 1647, 48, 46, 48, 44, 49, 44, 50,
+    44, 51, 44, 52, 44, 53, 44, 54, 44, 55, 44, 56, 44, 57, 44, 40,
+    65, 41, 40, 66, 41, 40, 67, 41, 40, 68, 41, 40, 69, 41, 40, 70,
+    41, 40, 71, 41, 40, 72, 41, 40, 73, 41, 40, 74, 41, 40, 75, 41,
+    40, 76, 41, 40, 77, 41, 40, 78, 41, 40, 79, 41, 40, 80, 41, 40,
+    81, 41, 40, 82, 41, 40, 83, 41, 40, 84, 41, 40, 85, 41, 40, 86,
+    41, 40, 87, 41, 40, 88, 41, 40, 89, 41, 40, 90, 41, 12308, 83, 12309,
+    67, 68, 87, 90, 72, 86, 83, 68, 83, 83, 80, 80, 86, 87, 67, 77,
+    67, 77, 68, 77, 82, 68, 74, 12411, 12363, 12467, 12467, 23383, 21452, 22810, 35299, 20132,
+    26144, 28961, 21069, 24460, 20877, 26032, 21021, 32066, 36009, 22768, 21561, 28436, 25237, 25429, 36938, 25351,
+    25171, 31105, 31354, 21512, 28288, 30003, 21106, 21942, 37197, 12308, 26412, 12309, 12308, 19977, 12309, 12308,
+    20108, 12309, 12308, 23433, 12309, 12308, 28857, 12309, 12308, 25171, 12309, 12308, 30423, 12309, 12308, 21213,
+    12309, 12308, 25943, 12309, 24471, 21487, 20029, 20024, 20033, 131362, 20320, 20411, 20482, 20602, 20633, 20687,
+    13470, 132666, 20820, 20836, 20855, 132380, 13497, 20839, 132427, 20887, 20900, 20172, 20908, 168415, 20995, 13535,
+    21051, 21062, 21111, 13589, 21253, 21254, 21321, 21338, 21363, 21373, 21375, 133676, 28784, 21450, 21471, 133987,
+    21483, 21489, 21510, 21662, 21560, 21576, 21608, 21666, 21750, 21776, 21843, 21859, 21892, 21931, 21939, 21954,
+    22294, 22295, 22097, 22132, 22766, 22478, 22516, 22541, 22411, 22578, 22577, 22700, 136420, 22770, 22775, 22790,
+    22818, 22882, 136872, 136938, 23020, 23067, 23079, 23000, 23142, 14062, 14076, 23304, 23358, 137672, 23491, 23512,
+    23539, 138008, 23551, 23558, 24403, 14209, 23648, 23744, 23693, 138724, 23875, 138726, 23918, 23915, 23932, 24033,
+    24034, 14383, 24061, 24104, 24125, 24169, 14434, 139651, 14460, 24240, 24243, 24246, 172946, 140081, 33281, 24354,
+    14535, 144056, 156122, 24418, 24427, 14563, 24474, 24525, 24535, 24569, 24705, 14650, 14620, 141012, 24775, 24904,
+    24908, 24954, 25010, 24996, 25007, 25054, 25104, 25115, 25181, 25265, 25300, 25424, 142092, 25405, 25340, 25448,
+    25475, 25572, 142321, 25634, 25541, 25513, 14894, 25705, 25726, 25757, 25719, 14956, 25964, 143370, 26083, 26360,
+    26185, 15129, 15112, 15076, 20882, 20885, 26368, 26268, 32941, 17369, 26401, 26462, 26451, 144323, 15177, 26618,
+    26501, 26706, 144493, 26766, 26655, 26900, 26946, 27043, 27114, 27304, 145059, 27355, 15384, 27425, 145575, 27476,
+    15438, 27506, 27551, 27579, 146061, 138507, 146170, 27726, 146620, 27839, 27853, 27751, 27926, 27966, 28009, 28024,
+    28037, 146718, 27956, 28207, 28270, 15667, 28359, 147153, 28153, 28526, 147294, 147342, 28614, 28729, 28699, 15766,
+    28746, 28797, 28791, 28845, 132389, 28997, 148067, 29084, 148395, 29224, 29264, 149000, 29312, 29333, 149301, 149524,
+    29562, 29579, 16044, 29605, 16056, 29767, 29788, 29829, 29898, 16155, 29988, 150582, 30014, 150674, 139679, 30224,
+    151457, 151480, 151620, 16380, 16392, 151795, 151794, 151833, 151859, 30494, 30495, 30603, 16454, 16534, 152605, 30798,
+    16611, 153126, 153242, 153285, 31211, 16687, 31306, 31311, 153980, 154279, 31470, 16898, 154539, 31686, 31689, 16935,
+    154752, 31954, 17056, 31976, 31971, 32000, 155526, 32099, 17153, 32199, 32258, 32325, 17204, 156200, 156231, 17241,
+    156377, 32634, 156478, 32661, 32762, 156890, 156963, 32864, 157096, 32880, 144223, 17365, 32946, 33027, 17419, 33086,
+    23221, 157607, 157621, 144275, 144284, 33284, 36766, 17515, 33425, 33419, 33437, 21171, 33457, 33459, 33469, 33510,
+    158524, 33565, 33635, 33709, 33571, 33725, 33767, 33619, 33738, 33740, 33756, 158774, 159083, 158933, 17707, 34033,
+    34035, 34070, 160714, 34148, 159532, 17757, 17761, 159665, 159954, 17771, 34384, 34407, 34409, 34473, 34440, 34574,
+    34530, 34600, 34667, 34694, 17879, 34785, 34817, 17913, 34912, 161383, 35031, 35038, 17973, 35066, 13499, 161966,
+    162150, 18110, 18119, 35488, 162984, 36011, 36033, 36123, 36215, 163631, 133124, 36299, 36284, 36336, 133342, 36564,
+    165330, 165357, 37012, 37105, 37137, 165678, 37147, 37432, 37591, 37592, 37500, 37881, 37909, 166906, 38283, 18837,
+    38327, 167287, 18918, 38595, 23986, 38691, 168261, 168474, 19054, 19062, 38880, 168970, 19122, 169110, 38953, 169398,
+    39138, 19251, 39209, 39335, 39362, 39422, 19406, 170800, 40000, 40189, 19662, 19693, 40295, 172238, 19704, 172293,
+    172558, 172689, 19798, 40702, 40709, 40719, 40726, 173568,
+};
+
+const size_t kCompositionCount = 941;
+
+// the (first << 21 | second) of the pairs which are composed, in their order, and the composite of each
+const uint64_t kCompositionPairs[941] = {
+    125829944, 127927096, 130024248, 136315648, 136315649, 136315650,
+    136315651, 136315652, 136315654, 136315655, 136315656, 136315657,
+    136315658, 136315660, 136315663, 136315665, 136315683, 136315685,
+    136315688, 138412807, 138412835, 138412849, 140509953, 140509954,
+    140509959, 140509964, 140509991, 142607111, 142607116, 142607139,
+    142607143, 142607149, 142607153, 144704256, 144704257, 144704258,
+    144704259, 144704260, 144704262, 144704263, 144704264, 144704265,
+    144704268, 144704271, 144704273, 144704291, 144704295, 144704296,
+    144704301, 144704304, 146801415, 148898561, 148898562, 148898564,
+    148898566, 148898567, 148898572, 148898599, 150995714, 150995719,
+    150995720, 150995724, 150995747, 150995751, 150995758, 153092864,
+    153092865, 153092866, 153092867, 153092868, 153092870, 153092871,
+    153092872, 153092873, 153092876, 153092879, 153092881, 153092899,
+    153092904, 153092912, 155190018, 157287169, 157287180, 157287203,
+    157287207, 157287217, 159384321, 159384332, 159384355, 159384359,
+    159384365, 159384369, 161481473, 161481479, 161481507, 163578624,
+    163578625, 163578627, 163578631, 163578636, 163578659, 163578663,
+    163578669, 163578673, 165675776, 165675777, 165675778, 165675779,
+    165675780, 165675782, 165675783, 165675784, 165675785, 165675787,
+    165675788, 165675791, 165675793, 165675803, 165675811, 165675816,
+    167772929, 167772935, 171967233, 171967239, 171967244, 171967247,
+    171967249, 171967267, 171967271, 171967281, 174064385, 174064386,
+    174064391, 174064396, 174064419, 174064422, 174064423, 176161543,
+    176161548, 176161571, 176161574, 176161575, 176161581, 176161585,
+    178258688, 178258689, 178258690, 178258691, 178258692, 178258694,
+    178258696, 178258697, 178258698, 178258699, 178258700, 178258703,
+    178258705, 178258715, 178258723, 178258724, 178258728, 178258733,
+    178258736, 180355843, 180355875, 182452992, 182452993, 182452994,
+    182452999, 182453000, 182453027, 184550151, 184550152, 186647296,
+    186647297, 186647298, 186647299, 186647300, 186647303, 186647304,
+    186647305, 186647331, 188744449, 188744450, 188744455, 188744460,
+    188744483, 188744497, 203424512, 203424513, 203424514, 203424515,
+    203424516, 203424518, 203424519, 203424520, 203424521, 203424522,
+    203424524, 203424527, 203424529, 203424547, 203424549, 203424552,
+    205521671, 205521699, 205521713, 207618817, 207618818, 207618823,
+    207618828, 207618855, 209715975, 209715980, 209716003, 209716007,
+    209716013, 209716017, 211813120, 211813121, 211813122, 211813123,
+    211813124, 211813126, 211813127, 211813128, 211813129, 211813132,
+    211813135, 211813137, 211813155, 211813159, 211813160, 211813165,
+    211813168, 213910279, 216007425, 216007426, 216007428, 216007430,
+    216007431, 216007436, 216007463, 218104578, 218104583, 218104584,
+    218104588, 218104611, 218104615, 218104622, 218104625, 220201728,
+    220201729, 220201730, 220201731, 220201732, 220201734, 220201736,
+    220201737, 220201740, 220201743, 220201745, 220201763, 220201768,
+    220201776, 222298882, 222298892, 224396033, 224396044, 224396067,
+    224396071, 224396081, 226493185, 226493196, 226493219, 226493223,
+    226493229, 226493233, 228590337, 228590343, 228590371, 230687488,
+    230687489, 230687491, 230687495, 230687500, 230687523, 230687527,
+    230687533, 230687537, 232784640, 232784641, 232784642, 232784643,
+    232784644, 232784646, 232784647, 232784648, 232784649, 232784651,
+    232784652, 232784655, 232784657, 232784667, 232784675, 232784680,
+    234881793, 234881799, 239076097, 239076103, 239076108, 239076111,
+    239076113, 239076131, 239076135, 239076145, 241173249, 241173250,
+    241173255, 241173260, 241173283, 241173286, 241173287, 243270407,
+    243270408, 243270412, 243270435, 243270438, 243270439, 243270445,
+    243270449, 245367552, 245367553, 245367554, 245367555, 245367556,
+    245367558, 245367560, 245367561, 245367562, 245367563, 245367564,
+    245367567, 245367569, 245367579, 245367587, 245367588, 245367592,
+    245367597, 245367600, 247464707, 247464739, 249561856, 249561857,
+    249561858, 249561863, 249561864, 249561866, 249561891, 251659015,
+    251659016, 253756160, 253756161, 253756162, 253756163, 253756164,
+    253756167, 253756168, 253756169, 253756170, 253756195, 255853313,
+    255853314, 255853319, 255853324, 255853347, 255853361, 352322304,
+    352322305, 352322370, 406848256, 406848257, 406848259, 406848265,
+    411042564, 413139713, 415236865, 415236868, 417334017, 423625472,
+    423625473, 423625475, 423625481, 434111233, 444596992, 444596993,
+    444596995, 444597001, 446694145, 446694148, 446694152, 448791300,
+    452985601, 461374208, 461374209, 461374212, 461374220, 473957120,
+    473957121, 473957123, 473957129, 478151428, 480248577, 482345729,
+    482345732, 484442881, 490734336, 490734337, 490734339, 490734345,
+    501220097, 511705856, 511705857, 511705859, 511705865, 513803009,
+    513803012, 513803016, 515900164, 520094465, 528483072, 528483073,
+    528483076, 528483084, 541065984, 541065985, 541065987, 541065993,
+    543163136, 543163137, 543163139, 543163145, 574620416, 574620417,
+    576717568, 576717569, 696255232, 696255233, 698352384, 698352385,
+    725615367, 727712519, 738198279, 740295431, 754975489, 757072641,
+    759169800, 761266952, 803209991, 872416000, 872416001, 872416003,
+    872416009, 872416035, 874513152, 874513153, 874513155, 874513161,
+    874513187, 903873280, 903873281, 903873283, 903873289, 903873315,
+    905970432, 905970433, 905970435, 905970441, 905970467, 920650508,
+    1027605252, 1029702404, 1153434372, 1155531524, 1157628678, 1159725830,
+    1170211588, 1172308740, 1379926796, 1914700544, 1914700545, 1914700548,
+    1914700550, 1914700563, 1914700564, 1914700613, 1923089152, 1923089153,
+    1923089171, 1923089172, 1927283456, 1927283457, 1927283475, 1927283476,
+    1927283525, 1931477760, 1931477761, 1931477764, 1931477766, 1931477768,
+    1931477779, 1931477780, 1944060672, 1944060673, 1944060691, 1944060692,
+    1948254996, 1956643584, 1956643585, 1956643588, 1956643590, 1956643592,
+    1956643604, 1965032192, 1965032193, 1965032211, 1965032212, 1965032261,
+    1971323717, 1975518021, 1981809408, 1981809409, 1981809412, 1981809414,
+    1981809427, 1981809428, 1981809474, 1981809477, 1990198016, 1990198017,
+    1990198035, 1990198036, 1994392320, 1994392321, 1994392339, 1994392340,
+    1994392386, 1994392389, 1998586624, 1998586625, 1998586628, 1998586630,
+    1998586632, 1998586643, 1998586644, 1998586690, 2011169536, 2011169537,
+    2011169555, 2011169556, 2015363859, 2015363860, 2023752448, 2023752449,
+    2023752452, 2023752454, 2023752456, 2023752467, 2023752468, 2023752514,
+    2032141056, 2032141057, 2032141075, 2032141076, 2032141122, 2032141125,
+    2034238208, 2034238209, 2034238274, 2036335360, 2036335361, 2036335426,
+    2042626885, 2051015425, 2051015432, 2160067336, 2181038854, 2181038856,
+    2187330305, 2191524608, 2191524614, 2191524616, 2193621766, 2193621768,
+    2195718920, 2197816064, 2197816068, 2197816070, 2197816072, 2202010369,
+    2210398984, 2220884740, 2220884742, 2220884744, 2220884747, 2229273352,
+    2237661960, 2241856264, 2248147718, 2248147720, 2254439169, 2258633472,
+    2258633478, 2258633480, 2260730630, 2260730632, 2262827784, 2264924928,
+    2264924932, 2264924934, 2264924936, 2269119233, 2277507848, 2287993604,
+    2287993606, 2287993608, 2287993611, 2296382216, 2304770824, 2308965128,
+    2327839496, 2390754063, 2392851215, 2600469256, 2602566408, 2634023688,
+    2636120840, 3303016019, 3303016020, 3303016021, 3372222036, 3376416340,
+    3625977428, 3661629012, 3667920468, 4915726652, 4932503868, 4938795324,
+    5249173950, 5249173975, 6054480702, 6054480726, 6054480727, 6211767255,
+    6320819134, 6320819159, 6322916286, 6589254742, 6843010261, 6857690306,
+    6857690325, 6857690326, 6866078933, 7126125886, 7126125911, 7128223038,
+    7434407370, 7434407375, 7434407391, 7440698826, 8667533358, 14506007349,
+    14510201653, 14514395957, 14518590261, 14522784565, 14531173173, 14617156405,
+    14621350709, 14625545013, 14627642165, 14633933621, 16219374340, 16221471492,
+    16294871812, 16296968964, 16311649031, 16313746183, 16441672450, 16441672454,
+    16443769602, 16443769606, 16492004098, 16494101250, 16533947138, 16536044290,
+    16642999040, 16642999041, 16642999106, 16642999109, 16645096192, 16645096193,
+    16645096258, 16645096261, 16647193413, 16649290565, 16651387717, 16653484869,
+    16655582021, 16657679173, 16659776256, 16659776257, 16659776322, 16659776325,
+    16661873408, 16661873409, 16661873474, 16661873477, 16663970629, 16666067781,
+    16668164933, 16670262085, 16672359237, 16674456389, 16676553472, 16676553473,
+    16678650624, 16678650625, 16693330688, 16693330689, 16695427840, 16695427841,
+    16710107904, 16710107905, 16710107970, 16710107973, 16712205056, 16712205057,
+    16712205122, 16712205125, 16714302277, 16716399429, 16718496581, 16720593733,
+    16722690885, 16724788037, 16726885120, 16726885121, 16726885186, 16726885189,
+    16728982272, 16728982273, 16728982338, 16728982341, 16731079493, 16733176645,
+    16735273797, 16737370949, 16739468101, 16741565253, 16743662336, 16743662337,
+    16743662402, 16745759488, 16745759489, 16745759554, 16760439552, 16760439553,
+    16760439618, 16762536704, 16762536705, 16762536770, 16777216768, 16777216769,
+    16779313920, 16779313921, 16793993984, 16793993985, 16796091136, 16796091137,
+    16810771200, 16810771201, 16810771266, 16812868352, 16812868353, 16812868418,
+    16829645568, 16829645569, 16829645634, 16844325632, 16844325633, 16844325698,
+    16844325701, 16846422784, 16846422785, 16846422850, 16846422853, 16848520005,
+    16850617157, 16852714309, 16854811461, 16856908613, 16859005765, 16861102848,
+    16861102849, 16861102914, 16861102917, 16863200000, 16863200001, 16863200066,
+    16863200069, 16865297221, 16867394373, 16869491525, 16871588677, 16873685829,
+    16875782981, 16877880133, 16886268741, 16903045957, 17024680773, 17043555072,
+    17043555073, 17043555138, 17058235205, 17158898501, 17175675648, 17175675649,
+    17175675714, 18018730808, 18022925112, 18027119416, 18152948536, 18157142840,
+    18161337144, 18259903288, 18270389048, 18276680504, 18327012152, 18331206456,
+    18379440952, 18394121016, 18398315320, 18404606776, 18415092536, 18457035576,
+    18463327032, 18465424184, 18492687160, 18494784312, 18501075768, 18503172920,
+    18509464376, 18511561528, 18513658680, 18515755832, 18526241592, 18528338744,
+    18534630200, 18536727352, 18557698872, 18559796024, 18593350456, 18605933368,
+    18608030520, 18612224824, 18626904888, 18629002040, 18631099192, 18633196344,
+    25916616857, 25927102617, 25931296921, 25935491225, 25939685529, 25943879833,
+    25948074137, 25952268441, 25956462745, 25960657049, 25964851353, 25969045657,
+    25973239961, 25979531417, 25983725721, 25987920025, 26002600089, 26002600090,
+    26008891545, 26008891546, 26015183001, 26015183002, 26021474457, 26021474458,
+    26027765913, 26027765914, 26099069081, 26117943449, 26128429209, 26132623513,
+    26136817817, 26141012121, 26145206425, 26149400729, 26153595033, 26157789337,
+    26161983641, 26166177945, 26170372249, 26174566553, 26180858009, 26185052313,
+    26189246617, 26203926681, 26203926682, 26210218137, 26210218138, 26216509593,
+    26216509594, 26222801049, 26222801050, 26229092505, 26229092506, 26271035545,
+    26273132697, 26275229849, 26277327001, 26300395673, 146349822138, 146354016442,
+    146374987962, 146668589351, 146670686503, 147788469054, 147788469079, 148564415664,
+    148564415674, 148564415677, 149099189679, 149101286831, 150971947312,
+};
+
+const char32_t kCompositions[941] = {
+    8814, 8800, 8815, 192, 193, 194, 195, 256, 258, 550, 196, 7842, 197, 461, 512, 514,
+    7840, 7680, 260, 7682, 7684, 7686, 262, 264, 266, 268, 199, 7690, 270, 7692, 7696, 7698,
+    7694, 200, 201, 202, 7868, 274, 276, 278, 203, 7866, 282, 516, 518, 7864, 552, 280,
+    7704, 7706, 7710, 500, 284, 7712, 286, 288, 486, 290, 292, 7714, 7718, 542, 7716, 7720,
+    7722, 204, 205, 206, 296, 298, 300, 304, 207, 7880, 463, 520, 522, 7882, 302, 7724,
+    308, 7728, 488, 7730, 310, 7732, 313, 317, 7734, 315, 7740, 7738, 7742, 7744, 7746, 504,
+    323, 209, 7748, 327, 7750, 325, 7754, 7752, 210, 211, 212, 213, 332, 334, 558, 214,
+    7886, 336, 465, 524, 526, 416, 7884, 490, 7764, 7766, 340, 7768, 344, 528, 530, 7770,
+    342, 7774, 346, 348, 7776, 352, 7778, 536, 350, 7786, 356, 7788, 538, 354, 7792, 7790,
+    217, 218, 219, 360, 362, 364, 220, 7910, 366, 368, 467, 532, 534, 431, 7908, 7794,
+    370, 7798, 7796, 7804, 7806, 7808, 7810, 372, 7814, 7812, 7816, 7818, 7820, 7922, 221, 374,
+    7928, 562, 7822, 376, 7926, 7924, 377, 7824, 379, 381, 7826, 7828, 224, 225, 226, 227,
+    257, 259, 551, 228, 7843, 229, 462, 513, 515, 7841, 7681, 261, 7683, 7685, 7687, 263,
+    265, 267, 269, 231, 7691, 271, 7693, 7697, 7699, 7695, 232, 233, 234, 7869, 275, 277,
+    279, 235, 7867, 283, 517, 519, 7865, 553, 281, 7705, 7707, 7711, 501, 285, 7713, 287,
+    289, 487, 291, 293, 7715, 7719, 543, 7717, 7721, 7723, 7830, 236, 237, 238, 297, 299,
+    301, 239, 7881, 464, 521, 523, 7883, 303, 7725, 309, 496, 7729, 489, 7731, 311, 7733,
+    314, 318, 7735, 316, 7741, 7739, 7743, 7745, 7747, 505, 324, 241, 7749, 328, 7751, 326,
+    7755, 7753, 242, 243, 244, 245, 333, 335, 559, 246, 7887, 337, 466, 525, 527, 417,
+    7885, 491, 7765, 7767, 341, 7769, 345, 529, 531, 7771, 343, 7775, 347, 349, 7777, 353,
+    7779, 537, 351, 7787, 7831, 357, 7789, 539, 355, 7793, 7791, 249, 250, 251, 361, 363,
+    365, 252, 7911, 367, 369, 468, 533, 535, 432, 7909, 7795, 371, 7799, 7797, 7805, 7807,
+    7809, 7811, 373, 7815, 7813, 7832, 7817, 7819, 7821, 7923, 253, 375, 7929, 563, 7823, 255,
+    7927, 7833, 7925, 378, 7825, 380, 382, 7827, 7829, 8173, 901, 8129, 7846, 7844, 7850, 7848,
+    478, 506, 508, 482, 7688, 7872, 7870, 7876, 7874, 7726, 7890, 7888, 7894, 7892, 7756, 556,
+    7758, 554, 510, 475, 471, 469, 473, 7847, 7845, 7851, 7849, 479, 507, 509, 483, 7689,
+    7873, 7871, 7877, 7875, 7727, 7891, 7889, 7895, 7893, 7757, 557, 7759, 555, 511, 476, 472,
+    470, 474, 7856, 7854, 7860, 7858, 7857, 7855, 7861, 7859, 7700, 7702, 7701, 7703, 7760, 7762,
+    7761, 7763, 7780, 7781, 7782, 7783, 7800, 7801, 7802, 7803, 7835, 7900, 7898, 7904, 7902, 7906,
+    7901, 7899, 7905, 7903, 7907, 7914, 7912, 7918, 7916, 7920, 7915, 7913, 7919, 7917, 7921, 494,
+    492, 493, 480, 481, 7708, 7709, 560, 561, 495, 8122, 902, 8121, 8120, 7944, 7945, 8124,
+    8136, 904, 7960, 7961, 8138, 905, 7976, 7977, 8140, 8154, 906, 8153, 8152, 938, 7992, 7993,
+    8184, 908, 8008, 8009, 8172, 8170, 910, 8169, 8168, 939, 8025, 8186, 911, 8040, 8041, 8188,
+    8116, 8132, 8048, 940, 8113, 8112, 7936, 7937, 8118, 8115, 8050, 941, 7952, 7953, 8052, 942,
+    7968, 7969, 8134, 8131, 8054, 943, 8145, 8144, 970, 7984, 7985, 8150, 8056, 972, 8000, 8001,
+    8164, 8165, 8058, 973, 8161, 8160, 971, 8016, 8017, 8166, 8060, 974, 8032, 8033, 8182, 8179,
+    8146, 912, 8151, 8162, 944, 8167, 8180, 979, 980, 1031, 1232, 1234, 1027, 1024, 1238, 1025,
+    1217, 1244, 1246, 1037, 1250, 1049, 1252, 1036, 1254, 1262, 1038, 1264, 1266, 1268, 1272, 1260,
+    1233, 1235, 1107, 1104, 1239, 1105, 1218, 1245, 1247, 1117, 1251, 1081, 1253, 1116, 1255, 1263,
+    1118, 1265, 1267, 1269, 1273, 1261, 1111, 1142, 1143, 1242, 1243, 1258, 1259, 1570, 1571, 1573,
+    1572, 1574, 1730, 1747, 1728, 2345, 2353, 2356, 2507, 2508, 2891, 2888, 2892, 2964, 3018, 3020,
+    3019, 3144, 3264, 3274, 3271, 3272, 3275, 3402, 3404, 3403, 3546, 3548, 3550, 3549, 4134, 6918,
+    6920, 6922, 6924, 6926, 6930, 6971, 6973, 6976, 6977, 6979, 7736, 7737, 7772, 7773, 7784, 7785,
+    7852, 7862, 7853, 7863, 7878, 7879, 7896, 7897, 7938, 7940, 7942, 8064, 7939, 7941, 7943, 8065,
+    8066, 8067, 8068, 8069, 8070, 8071, 7946, 7948, 7950, 8072, 7947, 7949, 7951, 8073, 8074, 8075,
+    8076, 8077, 8078, 8079, 7954, 7956, 7955, 7957, 7962, 7964, 7963, 7965, 7970, 7972, 7974, 8080,
+    7971, 7973, 7975, 8081, 8082, 8083, 8084, 8085, 8086, 8087, 7978, 7980, 7982, 8088, 7979, 7981,
+    7983, 8089, 8090, 8091, 8092, 8093, 8094, 8095, 7986, 7988, 7990, 7987, 7989, 7991, 7994, 7996,
+    7998, 7995, 7997, 7999, 8002, 8004, 8003, 8005, 8010, 8012, 8011, 8013, 8018, 8020, 8022, 8019,
+    8021, 8023, 8027, 8029, 8031, 8034, 8036, 8038, 8096, 8035, 8037, 8039, 8097, 8098, 8099, 8100,
+    8101, 8102, 8103, 8042, 8044, 8046, 8104, 8043, 8045, 8047, 8105, 8106, 8107, 8108, 8109, 8110,
+    8111, 8114, 8130, 8178, 8119, 8141, 8142, 8143, 8135, 8183, 8157, 8158, 8159, 8602, 8603, 8622,
+    8653, 8655, 8654, 8708, 8713, 8716, 8740, 8742, 8769, 8772, 8775, 8777, 8813, 8802, 8816, 8817,
+    8820, 8821, 8824, 8825, 8832, 8833, 8928, 8929, 8836, 8837, 8840, 8841, 8930, 8931, 8876, 8877,
+    8878, 8879, 8938, 8939, 8940, 8941, 12436, 12364, 12366, 12368, 12370, 12372, 12374, 12376, 12378, 12380,
+    12382, 12384, 12386, 12389, 12391, 12393, 12400, 12401, 12403, 12404, 12406, 12407, 12409, 12410, 12412, 12413,
+    12446, 12532, 12460, 12462, 12464, 12466, 12468, 12470, 12472, 12474, 12476, 12478, 12480, 12482, 12485, 12487,
+    12489, 12496, 12497, 12499, 12500, 12502, 12503, 12505, 12506, 12508, 12509, 12535, 12536, 12537, 12538, 12542,
+    69786, 69788, 69803, 69934, 69935, 70475, 70476, 70844, 70843, 70846, 71098, 71099, 71992,
+};
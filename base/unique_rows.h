@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <functional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "parallel_for.h"
+
+namespace ort_extensions {
+
+// The distinct strings of a batch, in the order of their first rows, the index of the distinct string of each row,
+// and the rows of each distinct string, so a kernel computes each string once and scatters its result into the rows
+// of the same string. The strings are views of the rows, which are hashed into an open-addressing table with linear
+// probing, so no string is copied.
+class UniqueRows {
+ public:
+  explicit UniqueRows(const std::vector<std::string_view>& rows) : indices_(rows.size()) {
+    // the table is at most half full, so the probes are short
+    size_t capacity = 16;
+    while (capacity < 2 * rows.size()) {
+      capacity <<= 1;
+    }
+    const size_t mask = capacity - 1;
+    std::vector<Slot> slots(capacity);
+    const std::hash<std::string_view> hasher;
+    for (size_t row = 0; row < rows.size(); ++row) {
+      const size_t hash = hasher(rows[row]);
+      size_t pos = hash & mask;
+      while (slots[pos].index != 0 &&
+             (slots[pos].hash != hash || values_[slots[pos].index - 1] != rows[row])) {
+        pos = (pos + 1) & mask;
+      }
+
+      Slot& slot = slots[pos];
+      if (slot.index == 0) {
+        slot = {hash, values_.size() + 1};
+        values_.push_back(rows[row]);
+        first_rows_.push_back(row);
+        counts_.push_back(0);
+      }
+      indices_[row] = slot.index - 1;
+      ++counts_[slot.index - 1];
+    }
+  }
+
+  // The number of the distinct strings.
+  size_t size() const { return values_.size(); }
+  std::string_view operator[](size_t index) const { return values_[index]; }
+  size_t Index(size_t row) const { return indices_[row]; }
+  // the first row and the number of the rows of the distinct string of the index
+  size_t FirstRow(size_t index) const { return first_rows_[index]; }
+  size_t Count(size_t index) const { return counts_[index]; }
+
+ private:
+  struct Slot {
+    size_t hash{};
+    size_t index{};  // the distinct string + 1, 0 for an empty slot
+  };
+
+  std::vector<std::string_view> values_;
+  std::vector<size_t> first_rows_;
+  std::vector<size_t> counts_;
+  std::vector<size_t> indices_;
+};
+
+// Calls set_row(row, compute(rows[row])) for each row, on up to num_threads threads. With dedup, compute is only
+// called once for each distinct string, and each row of the string is set with its own copy of the result, which is
+// much cheaper than computing it again for the batches of the repeated queries, the empty strings or the labels.
+template <typename Compute, typename SetRow>
+void ComputeRows(const std::vector<std::string_view>& rows, bool dedup, size_t num_threads, Compute&& compute,
+                 SetRow&& set_row) {
+  if (!dedup) {
+    ParallelFor(rows.size(), num_threads, [&](size_t begin, size_t end) {
+      for (size_t row = begin; row < end; ++row) {
+        set_row(row, compute(rows[row]));
+      }
+    });
+    return;
+  }
+
+  const UniqueRows unique(rows);
+  std::vector<decltype(compute(std::string_view()))> results(unique.size());
+  ParallelFor(unique.size(), num_threads, [&](size_t begin, size_t end) {
+    for (size_t index = begin; index < end; ++index) {
+      results[index] = compute(unique[index]);
+    }
+  });
+  ParallelFor(rows.size(), num_threads, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      auto result = results[unique.Index(row)];
+      set_row(row, std::move(result));
+    }
+  });
+}
+
+}  // namespace ort_extensions
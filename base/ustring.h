@@ -3,26 +3,48 @@
 #pragma once
 
 #include "ocos.h"
+#include <algorithm>
+#include <cstring>
 #include <vector>
 #include <string_view>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USTRING_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define USTRING_USE_NEON
+#include <arm_neon.h>
+#elif defined(__wasm_simd128__)
+#define USTRING_USE_WASM_SIMD
+#include <wasm_simd128.h>
+#endif
+
+#if defined(USTRING_USE_SSE2) || defined(USTRING_USE_NEON) || defined(USTRING_USE_WASM_SIMD)
+#define USTRING_HAS_SPACE_BLOCKS
+#endif
+
 // ustring needs a new implementation, due to the std::codecvt deprecation.
 // Wrap u32string with ustring, in case we will use other implementation in the future
+// The conversions from and to UTF-8 are validating, and every ill-formed sequence or invalid code point
+// becomes kReplacementChar. The ASCII runs are converted 16 characters at a time.
 class ustring : public std::u32string {
  public:
+  // U+FFFD, which replaces every maximal ill-formed subsequence of UTF-8 and every invalid code point.
+  static constexpr char32_t kReplacementChar = 0xFFFD;
+
   ustring() = default;
 
-  explicit ustring(const char* str) { assign(FromUTF8(str)); }
+  explicit ustring(const char* str) { DecodeUTF8(str, *this); }
 
-  explicit ustring(const std::string& str) { assign(FromUTF8(str)); }
+  explicit ustring(const std::string& str) { DecodeUTF8(str, *this); }
 
-  explicit ustring(const std::string_view& str) { assign(FromUTF8(str)); }
+  explicit ustring(const std::string_view& str) { DecodeUTF8(str, *this); }
 
   explicit ustring(const char32_t* str) : std::u32string(str) {}
 
   explicit ustring(const std::u32string_view& str) : std::u32string(str) {}
 
-  explicit operator std::string() const { return ToUTF8(*this); }
+  explicit operator std::string() const { return EncodeUTF8(*this); }
 
   static size_t EncodeUTF8Char(char* buffer, char32_t utf8_char) {
     if (utf8_char <= 0x7F) {
@@ -52,6 +74,158 @@ class ustring : public std::u32string {
     }
   }
 
+  // Decodes the character at pos of the UTF-8 string, and returns its length in bytes, which is
+  // clamped to the end of the string for a truncated sequence.
+  static char32_t DecodeUTF8Char(const std::string_view& utf8, size_t pos, size_t& len) {
+    auto lead = static_cast<unsigned char>(utf8[pos]);
+    if (lead < 0x80) {
+      len = 1;
+      return lead;
+    }
+
+    len = (lead & 0xE0) == 0xC0 ? 2 : (lead & 0xF0) == 0xE0 ? 3 : 4;
+    len = std::min(len, utf8.size() - pos);
+    char32_t codepoint = lead & (len == 2 ? 0x1F : len == 3 ? 0x0F : 0x07);
+    for (size_t k = 1; k < len; ++k) {
+      codepoint = (codepoint << 6) | (static_cast<unsigned char>(utf8[pos + k]) & 0x3F);
+    }
+    return codepoint;
+  }
+
+  // Checks whether the string is well-formed UTF-8, i.e. it round-trips through ustring unchanged.
+  static bool ValidateUTF8(const std::string_view& utf8) {
+    const auto* data = reinterpret_cast<const unsigned char*>(utf8.data());
+    const size_t size = utf8.size();
+    for (size_t i = 0; i < size;) {
+      if (data[i] < 0x80) {
+        i += CountAsciiPrefix(utf8.data() + i, size - i);
+        continue;
+      }
+
+      size_t len = 0;
+      if (DecodeMultiByteChar(data + i, size - i, len) == kInvalidCodepoint) {
+        return false;
+      }
+      i += len;
+    }
+    return true;
+  }
+
+  // Returns the number of the characters the UTF-8 string is decoded to, without decoding it. The ASCII runs are
+  // counted 16 bytes at a time, and every other character after its validation, so each maximal ill-formed
+  // subsequence is counted once like its replacement character, which a count of the bytes that aren't continuation
+  // bytes wouldn't do.
+  static size_t CountUTF8Chars(const std::string_view& utf8) {
+    const auto* data = reinterpret_cast<const unsigned char*>(utf8.data());
+    const size_t size = utf8.size();
+    size_t count = 0;
+    for (size_t i = 0; i < size;) {
+      if (data[i] < 0x80) {
+        size_t ascii = CountAsciiPrefix(utf8.data() + i, size - i);
+        i += ascii;
+        count += ascii;
+        continue;
+      }
+
+      size_t len = 0;
+      DecodeMultiByteChar(data + i, size - i, len);
+      i += len;
+      ++count;
+    }
+    return count;
+  }
+
+  // Returns the position of the UTF-8 string count characters after pos, or its end, with the characters of the
+  // lengths DecodeUTF8Char gives, as the offsets of the tokenizers count them.
+  static size_t AdvanceUTF8Chars(const std::string_view& utf8, size_t pos, size_t count) {
+    while (count > 0 && pos < utf8.size()) {
+      if (static_cast<unsigned char>(utf8[pos]) < 0x80) {
+        size_t ascii = CountAsciiPrefix(utf8.data() + pos, std::min(count, utf8.size() - pos));
+        pos += ascii;
+        count -= ascii;
+        continue;
+      }
+
+      size_t len = 0;
+      DecodeUTF8Char(utf8, pos, len);
+      pos += len;
+      --count;
+    }
+    return pos;
+  }
+
+  // Decodes the UTF-8 string into ucs32, and returns false if any ill-formed sequence was replaced.
+  static bool DecodeUTF8(const std::string_view& utf8, std::u32string& ucs32) {
+    const auto* data = reinterpret_cast<const unsigned char*>(utf8.data());
+    const size_t size = utf8.size();
+    // every character has one byte which isn't a continuation byte, so the size is exact for a well-formed
+    // string, and only the stray continuation bytes of an ill-formed one make it grow.
+    ucs32.resize(size - CountContinuationBytes(data, size));
+    size_t count = 0;
+    bool well_formed = true;
+    for (size_t i = 0; i < size;) {
+      if (data[i] < 0x80) {
+        size_t ascii = CountAsciiPrefix(utf8.data() + i, size - i);
+        if (count + ascii > ucs32.size()) {
+          ucs32.resize(count + size - i);
+        }
+        WidenAscii(data + i, ascii, &ucs32[count]);
+        i += ascii;
+        count += ascii;
+        continue;
+      }
+
+      size_t len = 0;
+      char32_t codepoint = DecodeMultiByteChar(data + i, size - i, len);
+      if (codepoint == kInvalidCodepoint) {
+        codepoint = kReplacementChar;
+        well_formed = false;
+      }
+      if (count == ucs32.size()) {
+        ucs32.resize(count + size - i);
+      }
+      ucs32[count++] = codepoint;
+      i += len;
+    }
+    ucs32.resize(count);
+    return well_formed;
+  }
+
+  // The length of the UTF-8 of the UTF-32 string, as it's encoded by EncodeUTF8.
+  static size_t UTF8Length(const std::u32string_view& ucs32) {
+    size_t length = 0;
+    for (char32_t codepoint : ucs32) {
+      length += codepoint < 0x80 ? 1 : codepoint < 0x800 ? 2 : (codepoint < 0x10000 || codepoint > 0x10FFFF) ? 3 : 4;
+    }
+    return length;
+  }
+
+  // Encodes the UTF-32 string to UTF-8, in which the surrogates and the code points above U+10FFFF are replaced.
+  static std::string EncodeUTF8(const std::u32string_view& ucs32) {
+    std::string utf8(UTF8Length(ucs32), '\0');
+    EncodeUTF8(ucs32, &utf8[0]);
+    return utf8;
+  }
+
+  // Encodes the UTF-32 string into the UTF8Length(ucs32) bytes of out.
+  static void EncodeUTF8(const std::u32string_view& ucs32, char* out) {
+    for (size_t i = 0; i < ucs32.size();) {
+      char32_t codepoint = ucs32[i];
+      if (codepoint < 0x80) {
+        size_t ascii = NarrowAscii(ucs32.data() + i, ucs32.size() - i, out);
+        i += ascii;
+        out += ascii;
+        continue;
+      }
+
+      if ((codepoint >= 0xD800 && codepoint <= 0xDFFF) || codepoint > 0x10FFFF) {
+        codepoint = kReplacementChar;
+      }
+      out += EncodeUTF8Char(out, codepoint);
+      ++i;
+    }
+  }
+
   static std::string EncodeUTF8Char(char32_t utf8_char) {
     char utf8_buf[5];  // one extra space for zero
     auto clen = EncodeUTF8Char(utf8_buf, utf8_char);
@@ -59,39 +233,340 @@ class ustring : public std::u32string {
     return std::string(utf8_buf);
   }
 
+  // Returns the number of the leading ASCII bytes of the data.
+  static size_t CountAsciiPrefix(const char* data, size_t size) {
+    size_t pos = 0;
+#if defined(USTRING_USE_SSE2)
+    // the mask has the high bits of the 16 bytes, which are only set for the non-ASCII bytes,
+    // and the bytes of the first block with one are counted one by one.
+    for (; pos + 16 <= size; pos += 16) {
+      if (_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos))) != 0) {
+        break;
+      }
+    }
+#elif defined(USTRING_USE_NEON)
+    for (; pos + 16 <= size; pos += 16) {
+      if (vmaxvq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos))) >= 0x80) {
+        break;
+      }
+    }
+#elif defined(USTRING_USE_WASM_SIMD)
+    for (; pos + 16 <= size; pos += 16) {
+      if (wasm_i8x16_bitmask(wasm_v128_load(data + pos)) != 0) {
+        break;
+      }
+    }
+#else
+    for (; pos + 8 <= size; pos += 8) {
+      uint64_t word;
+      std::memcpy(&word, data + pos, sizeof(word));
+      if ((word & 0x8080808080808080ULL) != 0) {
+        break;
+      }
+    }
+#endif
+    while (pos < size && static_cast<unsigned char>(data[pos]) < 0x80) {
+      ++pos;
+    }
+    return pos;
+  }
+
+  // The ASCII whitespace of isspace in the C locale, " \t\n\v\f\r".
+  static bool IsAsciiSpace(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+  // Returns the number of the leading ASCII whitespace bytes of the data, which are skipped 16 at a time.
+  static size_t CountLeadingAsciiSpaces(const char* data, size_t size) {
+    size_t pos = 0;
+    if (size > 0 && !IsAsciiSpace(data[0])) {
+      return 0;  // most strings have none
+    }
+#if defined(USTRING_HAS_SPACE_BLOCKS)
+    while (pos + 16 <= size && AllAsciiSpaces16(data + pos)) {
+      pos += 16;
+    }
+#endif
+    while (pos < size && IsAsciiSpace(data[pos])) {
+      ++pos;
+    }
+    return pos;
+  }
+
+  // Returns the number of the trailing ASCII whitespace bytes of the data, which are skipped 16 at a time.
+  static size_t CountTrailingAsciiSpaces(const char* data, size_t size) {
+    size_t end = size;
+    if (end > 0 && !IsAsciiSpace(data[end - 1])) {
+      return 0;
+    }
+#if defined(USTRING_HAS_SPACE_BLOCKS)
+    while (end >= 16 && AllAsciiSpaces16(data + end - 16)) {
+      end -= 16;
+    }
+#endif
+    while (end > 0 && IsAsciiSpace(data[end - 1])) {
+      --end;
+    }
+    return size - end;
+  }
+
+  // Writes the leading ASCII characters of the data to out in lower case, and returns the number of them.
+  static size_t LowerAsciiPrefix(const char* data, size_t size, char* out) {
+    return MapAsciiCase<false, true>(data, size, out);
+  }
+
+  // Writes the data to out with its ASCII letters in upper case, and the other bytes unchanged.
+  static void UpperAscii(const char* data, size_t size, char* out) {
+    MapAsciiCase<true, false>(data, size, out);
+  }
+
  private:
-  using u32string = std::u32string;
-  static u32string FromUTF8(const std::string_view& utf8) {
-    u32string ucs32;
-    ucs32.reserve(utf8.length() / 2);   // a rough estimation for less memory allocation.
-    for (size_t i = 0; i < utf8.size();) {
-      char32_t codepoint = 0;
-      if ((utf8[i] & 0x80) == 0) {
-        codepoint = utf8[i];
-        i++;
-      } else if ((utf8[i] & 0xE0) == 0xC0) {
-        codepoint = ((utf8[i] & 0x1F) << 6) | (utf8[i + 1] & 0x3F);
-        i += 2;
-      } else if ((utf8[i] & 0xF0) == 0xE0) {
-        codepoint = ((utf8[i] & 0x0F) << 12) | ((utf8[i + 1] & 0x3F) << 6) | (utf8[i + 2] & 0x3F);
-        i += 3;
-      } else {
-        codepoint = ((utf8[i] & 0x07) << 18) | ((utf8[i + 1] & 0x3F) << 12) | ((utf8[i + 2] & 0x3F) << 6) | (utf8[i + 3] & 0x3F);
-        i += 4;
-      }
-      ucs32.push_back(codepoint);
-    }
-    return ucs32;
-  }
-
-  static std::string ToUTF8(const u32string& ucs32) {
-    std::string utf8;
-    utf8.reserve(ucs32.length() * 4);
-    for (char32_t codepoint : ucs32) {
-      utf8 += EncodeUTF8Char(codepoint);
+  static constexpr char32_t kInvalidCodepoint = 0xFFFFFFFF;
+
+#if defined(USTRING_HAS_SPACE_BLOCKS)
+  // Whether the 16 bytes are all ASCII whitespace, the space or one of '\t' to '\r'.
+  static bool AllAsciiSpaces16(const char* data) {
+#if defined(USTRING_USE_SSE2)
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    const __m128i controls = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('\t' - 1)),
+                                           _mm_cmplt_epi8(bytes, _mm_set1_epi8('\r' + 1)));
+    const __m128i spaces = _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(' ')), controls);
+    return _mm_movemask_epi8(spaces) == 0xFFFF;
+#elif defined(USTRING_USE_NEON)
+    const uint8x16_t bytes = vld1q_u8(reinterpret_cast<const uint8_t*>(data));
+    const uint8x16_t controls = vandq_u8(vcgeq_u8(bytes, vdupq_n_u8('\t')), vcleq_u8(bytes, vdupq_n_u8('\r')));
+    return vminvq_u8(vorrq_u8(vceqq_u8(bytes, vdupq_n_u8(' ')), controls)) == 0xFF;
+#else
+    const v128_t bytes = wasm_v128_load(data);
+    const v128_t controls = wasm_v128_and(wasm_u8x16_ge(bytes, wasm_u8x16_splat('\t')),
+                                          wasm_u8x16_le(bytes, wasm_u8x16_splat('\r')));
+    return wasm_i8x16_all_true(wasm_v128_or(wasm_i8x16_eq(bytes, wasm_u8x16_splat(' ')), controls));
+#endif
+  }
+#endif
+
+  // Decodes the character of the non-ASCII lead byte. If it isn't well-formed, it returns kInvalidCodepoint,
+  // and len is the length of its maximal ill-formed subsequence, which is replaced by one kReplacementChar.
+  static char32_t DecodeMultiByteChar(const unsigned char* data, size_t size, size_t& len) {
+    const unsigned char lead = data[0];
+    size_t char_len = 0;
+    char32_t codepoint = 0;
+    // the range of the second byte rejects the overlong forms, the surrogates and the code points above U+10FFFF
+    unsigned char lower = 0x80;
+    unsigned char upper = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+      char_len = 2;
+      codepoint = lead & 0x1F;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+      char_len = 3;
+      codepoint = lead & 0x0F;
+      lower = lead == 0xE0 ? 0xA0 : lower;
+      upper = lead == 0xED ? 0x9F : upper;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+      char_len = 4;
+      codepoint = lead & 0x07;
+      lower = lead == 0xF0 ? 0x90 : lower;
+      upper = lead == 0xF4 ? 0x8F : upper;
+    } else {
+      len = 1;
+      return kInvalidCodepoint;
     }
 
-    return utf8;
+    for (len = 1; len < char_len; ++len) {
+      if (len == size || data[len] < lower || data[len] > upper) {
+        return kInvalidCodepoint;
+      }
+      codepoint = (codepoint << 6) | (data[len] & 0x3F);
+      lower = 0x80;
+      upper = 0xBF;
+    }
+    return codepoint;
+  }
+
+  static size_t CountContinuationBytes(const unsigned char* data, size_t size) {
+    size_t count = 0;
+    size_t pos = 0;
+#if defined(USTRING_USE_SSE2)
+    // the continuation bytes 0x80-0xBF are the signed bytes below -64
+    const __m128i threshold = _mm_set1_epi8(-64);
+    while (pos + 16 <= size) {
+      // the byte counters of the lanes are added up before they overflow
+      __m128i counters = _mm_setzero_si128();
+      for (size_t block = 0; block < 255 && pos + 16 <= size; ++block, pos += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        counters = _mm_sub_epi8(counters, _mm_cmplt_epi8(bytes, threshold));
+      }
+      __m128i sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+      count += static_cast<size_t>(_mm_cvtsi128_si32(sums)) + static_cast<size_t>(_mm_extract_epi16(sums, 4));
+    }
+#elif defined(USTRING_USE_NEON)
+    const int8x16_t threshold = vdupq_n_s8(-64);
+    for (; pos + 16 <= size; pos += 16) {
+      int8x16_t bytes = vreinterpretq_s8_u8(vld1q_u8(data + pos));
+      count += vaddvq_u8(vshrq_n_u8(vcltq_s8(bytes, threshold), 7));
+    }
+#elif defined(USTRING_USE_WASM_SIMD)
+    const v128_t threshold = wasm_i8x16_splat(-64);
+    for (; pos + 16 <= size; pos += 16) {
+      count += __builtin_popcount(wasm_i8x16_bitmask(wasm_i8x16_lt(wasm_v128_load(data + pos), threshold)));
+    }
+#endif
+    for (; pos < size; ++pos) {
+      count += (data[pos] & 0xC0) == 0x80 ? 1 : 0;
+    }
+    return count;
+  }
+
+  static void WidenAscii(const unsigned char* data, size_t size, char32_t* out) {
+    size_t pos = 0;
+#if defined(USTRING_USE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; pos + 16 <= size; pos += 16) {
+      __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+      __m128i low = _mm_unpacklo_epi8(bytes, zero);
+      __m128i high = _mm_unpackhi_epi8(bytes, zero);
+      auto* dst = reinterpret_cast<__m128i*>(out + pos);
+      _mm_storeu_si128(dst, _mm_unpacklo_epi16(low, zero));
+      _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(low, zero));
+      _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(high, zero));
+      _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(high, zero));
+    }
+#elif defined(USTRING_USE_NEON)
+    for (; pos + 16 <= size; pos += 16) {
+      uint8x16_t bytes = vld1q_u8(data + pos);
+      uint16x8_t low = vmovl_u8(vget_low_u8(bytes));
+      uint16x8_t high = vmovl_u8(vget_high_u8(bytes));
+      auto* dst = reinterpret_cast<uint32_t*>(out + pos);
+      vst1q_u32(dst, vmovl_u16(vget_low_u16(low)));
+      vst1q_u32(dst + 4, vmovl_u16(vget_high_u16(low)));
+      vst1q_u32(dst + 8, vmovl_u16(vget_low_u16(high)));
+      vst1q_u32(dst + 12, vmovl_u16(vget_high_u16(high)));
+    }
+#elif defined(USTRING_USE_WASM_SIMD)
+    for (; pos + 16 <= size; pos += 16) {
+      v128_t bytes = wasm_v128_load(data + pos);
+      v128_t low = wasm_u16x8_extend_low_u8x16(bytes);
+      v128_t high = wasm_u16x8_extend_high_u8x16(bytes);
+      char32_t* dst = out + pos;
+      wasm_v128_store(dst, wasm_u32x4_extend_low_u16x8(low));
+      wasm_v128_store(dst + 4, wasm_u32x4_extend_high_u16x8(low));
+      wasm_v128_store(dst + 8, wasm_u32x4_extend_low_u16x8(high));
+      wasm_v128_store(dst + 12, wasm_u32x4_extend_high_u16x8(high));
+    }
+#endif
+    for (; pos < size; ++pos) {
+      out[pos] = data[pos];
+    }
+  }
+
+  // Maps the case of the ASCII letters of the data to out, 16 bytes at a time, by flipping the 0x20 bit of the letters
+  // of the other case. If `ascii_only`, it stops at the first non-ASCII byte and returns the number of the bytes
+  // written before it.
+  template <bool upper, bool ascii_only>
+  static size_t MapAsciiCase(const char* data, size_t size, char* out) {
+    constexpr char first = upper ? 'a' : 'A';
+    constexpr char last = upper ? 'z' : 'Z';
+    size_t pos = 0;
+#if defined(USTRING_USE_SSE2)
+    // the non-ASCII bytes are the negative ones, which are never in the range of the letters
+    const __m128i below = _mm_set1_epi8(first - 1);
+    const __m128i above = _mm_set1_epi8(last + 1);
+    const __m128i flip = _mm_set1_epi8(0x20);
+    for (; pos + 16 <= size; pos += 16) {
+      __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+      if (ascii_only && _mm_movemask_epi8(bytes) != 0) {
+        break;
+      }
+      __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(bytes, below), _mm_cmplt_epi8(bytes, above));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos), _mm_xor_si128(bytes, _mm_and_si128(letters, flip)));
+    }
+#elif defined(USTRING_USE_NEON)
+    const uint8x16_t lower_bound = vdupq_n_u8(static_cast<uint8_t>(first));
+    const uint8x16_t upper_bound = vdupq_n_u8(static_cast<uint8_t>(last));
+    const uint8x16_t flip = vdupq_n_u8(0x20);
+    for (; pos + 16 <= size; pos += 16) {
+      uint8x16_t bytes = vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos));
+      if (ascii_only && vmaxvq_u8(bytes) >= 0x80) {
+        break;
+      }
+      uint8x16_t letters = vandq_u8(vcgeq_u8(bytes, lower_bound), vcleq_u8(bytes, upper_bound));
+      vst1q_u8(reinterpret_cast<uint8_t*>(out + pos), veorq_u8(bytes, vandq_u8(letters, flip)));
+    }
+#elif defined(USTRING_USE_WASM_SIMD)
+    const v128_t lower_bound = wasm_u8x16_splat(static_cast<uint8_t>(first));
+    const v128_t upper_bound = wasm_u8x16_splat(static_cast<uint8_t>(last));
+    const v128_t flip = wasm_u8x16_splat(0x20);
+    for (; pos + 16 <= size; pos += 16) {
+      v128_t bytes = wasm_v128_load(data + pos);
+      if (ascii_only && wasm_i8x16_bitmask(bytes) != 0) {
+        break;
+      }
+      v128_t letters = wasm_v128_and(wasm_u8x16_ge(bytes, lower_bound), wasm_u8x16_le(bytes, upper_bound));
+      wasm_v128_store(out + pos, wasm_v128_xor(bytes, wasm_v128_and(letters, flip)));
+    }
+#endif
+    for (; pos < size; ++pos) {
+      const char c = data[pos];
+      if (ascii_only && static_cast<unsigned char>(c) >= 0x80) {
+        break;
+      }
+      out[pos] = (c >= first && c <= last) ? static_cast<char>(c ^ 0x20) : c;
+    }
+    return pos;
+  }
+
+  // Writes the leading ASCII characters of the data to out, and returns the number of them.
+  static size_t NarrowAscii(const char32_t* data, size_t size, char* out) {
+    size_t pos = 0;
+#if defined(USTRING_USE_SSE2)
+    const __m128i non_ascii = _mm_set1_epi32(~0x7F);
+    for (; pos + 16 <= size; pos += 16) {
+      const auto* src = reinterpret_cast<const __m128i*>(data + pos);
+      __m128i a = _mm_loadu_si128(src);
+      __m128i b = _mm_loadu_si128(src + 1);
+      __m128i c = _mm_loadu_si128(src + 2);
+      __m128i d = _mm_loadu_si128(src + 3);
+      __m128i any = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), non_ascii);
+      if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, _mm_setzero_si128())) != 0xFFFF) {
+        break;
+      }
+      // the values are below 0x80, so the saturating packs keep them
+      __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos), bytes);
+    }
+#elif defined(USTRING_USE_NEON)
+    for (; pos + 16 <= size; pos += 16) {
+      const auto* src = reinterpret_cast<const uint32_t*>(data + pos);
+      uint32x4_t a = vld1q_u32(src);
+      uint32x4_t b = vld1q_u32(src + 4);
+      uint32x4_t c = vld1q_u32(src + 8);
+      uint32x4_t d = vld1q_u32(src + 12);
+      if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))) >= 0x80) {
+        break;
+      }
+      uint16x8_t low = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+      uint16x8_t high = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+      vst1q_u8(reinterpret_cast<uint8_t*>(out + pos), vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+    }
+#elif defined(USTRING_USE_WASM_SIMD)
+    const v128_t limit = wasm_u32x4_splat(0x80);
+    for (; pos + 16 <= size; pos += 16) {
+      const char32_t* src = data + pos;
+      v128_t a = wasm_v128_load(src);
+      v128_t b = wasm_v128_load(src + 4);
+      v128_t c = wasm_v128_load(src + 8);
+      v128_t d = wasm_v128_load(src + 12);
+      if (!wasm_i32x4_all_true(wasm_u32x4_lt(wasm_v128_or(wasm_v128_or(a, b), wasm_v128_or(c, d)), limit))) {
+        break;
+      }
+      // the values are below 0x80, so the saturating narrows keep them
+      v128_t low = wasm_u16x8_narrow_i32x4(a, b);
+      v128_t high = wasm_u16x8_narrow_i32x4(c, d);
+      wasm_v128_store(out + pos, wasm_u8x16_narrow_i16x8(low, high));
+    }
+#endif
+    for (; pos < size && data[pos] < 0x80; ++pos) {
+      out[pos] = static_cast<char>(data[pos]);
+    }
+    return pos;
   }
 };
 
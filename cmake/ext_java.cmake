@@ -56,6 +56,10 @@ file(GLOB onnxruntime_extensions4j_native_src
     "${JAVA_ROOT}/src/main/native/*.h"
     "${PROJECT_SOURCE_DIR}/include/*.h"
     )
+# the OrtxTokenizer class is only backed by the tokenizer API when some tokenizer is built
+if(NOT _HAS_TOKENIZER)
+  list(FILTER onnxruntime_extensions4j_native_src EXCLUDE REGEX ".*OrtxTokenizer\\.c$")
+endif()
 # Build the JNI library
 add_library(onnxruntime_extensions4j_jni SHARED ${onnxruntime_extensions4j_native_src})
 
@@ -93,8 +93,22 @@ set(WITH_WIN32UI                OFF CACHE INTERNAL "")
 if (OCOS_ENABLE_OPENCV_CODECS)
   set(BUILD_opencv_imgcodecs  ON CACHE INTERNAL "")
 
-  set(BUILD_JPEG              ON CACHE INTERNAL "")
-  set(BUILD_PNG               ON CACHE INTERNAL "")
+  # a codec of the system found for the native decoders is linked by OpenCV too, without its copy of the same
+  # symbols, and OpenCV builds its own copy of a codec which isn't found
+  if (OCOS_ENABLE_NATIVE_IMAGE_CODECS)
+    find_package(JPEG)
+    find_package(PNG)
+  endif()
+  if (JPEG_FOUND)
+    set(BUILD_JPEG            OFF CACHE INTERNAL "")
+  else()
+    set(BUILD_JPEG            ON CACHE INTERNAL "")
+  endif()
+  if (PNG_FOUND)
+    set(BUILD_PNG             OFF CACHE INTERNAL "")
+  else()
+    set(BUILD_PNG             ON CACHE INTERNAL "")
+  endif()
 
   set(WITH_JPEG               ON CACHE INTERNAL "")
   set(WITH_PNG                ON CACHE INTERNAL "")
@@ -136,6 +136,7 @@ ExternalProject_Add(triton
                                -DTRITON_THIRD_PARTY_REPO_TAG=${triton_VERSION_TAG}
                                -DTRITON_CORE_REPO_TAG=${triton_VERSION_TAG}
                                -DTRITON_ENABLE_CC_HTTP=ON
+                               -DTRITON_ENABLE_CC_GRPC=${OCOS_ENABLE_AZURE_TRITON_GRPC}
                                -DTRITON_ENABLE_ZLIB=OFF
                                ${triton_extra_cmake_args}
                     INSTALL_COMMAND ${CMAKE_COMMAND} -E echo "Skipping install step."
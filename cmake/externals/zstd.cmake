@@ -0,0 +1,16 @@
+FetchContent_Declare(zstd
+  GIT_REPOSITORY https://github.com/facebook/zstd.git
+  GIT_TAG v1.5.5
+  SOURCE_SUBDIR build/cmake)
+
+# only the static decompression library is needed
+set(ZSTD_BUILD_PROGRAMS OFF CACHE INTERNAL "")
+set(ZSTD_BUILD_TESTS OFF CACHE INTERNAL "")
+set(ZSTD_BUILD_SHARED OFF CACHE INTERNAL "")
+set(ZSTD_BUILD_STATIC ON CACHE INTERNAL "")
+set(ZSTD_LEGACY_SUPPORT OFF CACHE INTERNAL "")
+set(ZSTD_MULTITHREAD_SUPPORT OFF CACHE INTERNAL "")
+
+FetchContent_MakeAvailable(zstd)
+set_target_properties(libzstd_static PROPERTIES FOLDER "externals/zstd")
+set(zstd_INCLUDE_DIR ${zstd_SOURCE_DIR}/lib)
@@ -3,12 +3,245 @@
 
 #pragma once
 #include "onnxruntime_customop.hpp"
+#include "runtime_stats.h"
+#include "run_cancellation.h"
+#include "shared_kernels.h"
+#include <climits>
+#include <cstring>
+#include <algorithm>
 #include <optional>
+#include <mutex>
 #include <numeric>
+#include <string_view>
+
+#if ORT_API_VERSION < 17
+struct OrtShapeInferContext;  // of the shape inference of API 17, which the older ORT doesn't call
+#endif
 
 namespace Ort {
 namespace Custom {
 
+// A host buffer of an output, whose bytes are copied into the device data of the output after the Compute.
+struct StagedOutput {
+  void* host;
+  void* device;
+  size_t bytes;
+};
+
+// The host buffers of the outputs of a kernel which runs its CPU code for a device execution provider: its inputs
+// are in the CPU memory and its outputs in the memory of the device, so Allocate returns a buffer of Acquire,
+// pinned for a DMA, instead of the output, and Upload copies the buffers into the outputs on the stream of the
+// kernel when Compute returns. The next node on the device then reads the outputs with no copy of its own. It is
+// shared by the concurrent Compute calls of the kernel.
+class OutputStaging {
+ public:
+  virtual ~OutputStaging() = default;
+
+  virtual void* Acquire(size_t bytes) = 0;
+
+  // Copies the buffers into their outputs, and returns them to be reused once the copies are done.
+  virtual void Upload(OrtKernelContext* context, const std::vector<StagedOutput>& outputs) = 0;
+
+  // Returns the buffers of a Compute which failed, with no copy.
+  virtual void Release(const std::vector<StagedOutput>& outputs) noexcept = 0;
+};
+
+using OutputStagingFactory = std::unique_ptr<OutputStaging> (*)(const OrtApi& api, const OrtKernelInfo& info);
+
+// The outputs which one Compute stages.
+class StagedOutputs {
+ public:
+  explicit StagedOutputs(OutputStaging* staging) : staging_(staging) {}
+
+  ~StagedOutputs() {
+    if (!outputs_.empty()) {
+      staging_->Release(outputs_);
+    }
+  }
+
+  StagedOutputs(const StagedOutputs&) = delete;
+  StagedOutputs& operator=(const StagedOutputs&) = delete;
+
+  void* Stage(void* device, size_t bytes) {
+    void* host = staging_->Acquire(bytes);
+    outputs_.push_back({host, device, bytes});
+    return host;
+  }
+
+  void Upload(OrtKernelContext* context) {
+    if (!outputs_.empty()) {
+      std::vector<StagedOutput> outputs;
+      outputs.swap(outputs_);
+      staging_->Upload(context, outputs);
+    }
+  }
+
+ private:
+  OutputStaging* staging_;
+  std::vector<StagedOutput> outputs_;
+};
+
+// The kernel context of the Compute running on this thread, which the lite custom ops set for the helpers which
+// need the runtime, like ParallelFor, so that the kernels don't have to pass it down.
+struct ComputeContext {
+  const OrtW::CustomOpApi* api = nullptr;
+  OrtKernelContext* context = nullptr;
+  int api_version = 0;  // the version of the ORT API which the kernel runs with
+  StagedOutputs* staged = nullptr;  // of a kernel whose outputs are staged, see OutputStaging
+
+  static const ComputeContext& Current() {
+    return CurrentRef();
+  }
+
+  // Runs fn(i) for every i in [0, total) on the intra-op thread pool of the session, and returns false without
+  // running anything if there is no context, or the ORT in use doesn't have KernelContext_ParallelFor of API 16.
+  // fn mustn't throw.
+  template <typename Fn>
+  bool OrtParallelFor(size_t total, Fn& fn) const {
+#if ORT_API_VERSION >= 16
+    if (context == nullptr || api_version < 16) {
+      return false;
+    }
+    void (*call)(void*, size_t) = [](void* data, size_t i) { (*static_cast<Fn*>(data))(i); };
+    api->ThrowOnError(api->GetOrtApi().KernelContext_ParallelFor(context, call, total, 0, &fn));
+    return true;
+#else
+    (void)total;
+    (void)fn;
+    return false;
+#endif
+  }
+
+ private:
+  friend class ComputeContextScope;
+
+  static ComputeContext& CurrentRef() {
+    thread_local ComputeContext current;
+    return current;
+  }
+};
+
+// Makes the kernel context the current one of this thread until the end of its life.
+class ComputeContextScope {
+ public:
+  ComputeContextScope(const OrtW::CustomOpApi& api, OrtKernelContext* context, int api_version,
+                      StagedOutputs* staged = nullptr)
+      : previous_(ComputeContext::CurrentRef()) {
+    ComputeContext::CurrentRef() = ComputeContext{&api, context, api_version, staged};
+  }
+
+  ~ComputeContextScope() {
+    ComputeContext::CurrentRef() = previous_;
+  }
+
+  ComputeContextScope(const ComputeContextScope&) = delete;
+  ComputeContextScope& operator=(const ComputeContextScope&) = delete;
+
+ private:
+  ComputeContext previous_;
+};
+
+// The API of the ORT which registered the ops, which their shape inference of the graph time is called with.
+inline const OrtApi*& RegisteredOrtApi() {
+  static const OrtApi* api = nullptr;
+  return api;
+}
+
+// The types and the shapes of the inputs of a node, by which an op sets the ones of its outputs when ORT resolves
+// the graph, so that it plans their memory before they are computed. An unknown dim is -1. ORT only infers the
+// shapes of the custom ops from API 17.
+class ShapeInferContext {
+ public:
+  ShapeInferContext(const OrtApi& api, OrtShapeInferContext* context) : api_(api), context_(context) {}
+
+  size_t InputCount() const {
+    size_t count = 0;
+#if ORT_API_VERSION >= 17
+    OrtW::ThrowOnError(api_, api_.ShapeInferContext_GetInputCount(context_, &count));
+#endif
+    return count;
+  }
+
+  ONNXTensorElementDataType InputType(size_t i) const {
+    ONNXTensorElementDataType type = ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED;
+    ReadInput(i, &type, nullptr);
+    return type;
+  }
+
+  std::vector<int64_t> InputShape(size_t i) const {
+    std::vector<int64_t> shape;
+    ReadInput(i, nullptr, &shape);
+    return shape;
+  }
+
+  int64_t GetAttributeInt(const char* name, int64_t default_value) const {
+#if ORT_API_VERSION >= 17
+    const OrtOpAttr* attr = nullptr;
+    if (OrtStatus* status = api_.ShapeInferContext_GetAttribute(context_, name, &attr); status != nullptr) {
+      api_.ReleaseStatus(status);  // the attribute isn't set
+      return default_value;
+    }
+    if (attr != nullptr) {
+      size_t size = 0;
+      OrtW::ThrowOnError(api_, api_.ReadOpAttr(attr, ORT_OP_ATTR_INT, &default_value, sizeof(default_value), &size));
+    }
+#endif
+    return default_value;
+  }
+
+  void SetOutput(size_t i, ONNXTensorElementDataType type, const std::vector<int64_t>& shape) const {
+    OrtW::ThrowOnError(api_, WriteOutput(i, type, shape));
+  }
+
+  // The same as above for an optional output, which does nothing if the node doesn't have it.
+  void SetOptionalOutput(size_t i, ONNXTensorElementDataType type, const std::vector<int64_t>& shape) const {
+    if (OrtStatus* status = WriteOutput(i, type, shape); status != nullptr) {
+      api_.ReleaseStatus(status);
+    }
+  }
+
+ private:
+  OrtStatus* WriteOutput(size_t i, ONNXTensorElementDataType type, const std::vector<int64_t>& shape) const {
+    OrtStatus* status = nullptr;
+#if ORT_API_VERSION >= 17
+    OrtTensorTypeAndShapeInfo* info = nullptr;
+    if ((status = api_.CreateTensorTypeAndShapeInfo(&info)) != nullptr) {
+      return status;
+    }
+    status = api_.SetTensorElementType(info, type);
+    if (status == nullptr) {
+      status = api_.SetDimensions(info, shape.data(), shape.size());
+    }
+    if (status == nullptr) {
+      status = api_.ShapeInferContext_SetOutputTypeShape(context_, i, info);
+    }
+    api_.ReleaseTensorTypeAndShapeInfo(info);
+#endif
+    return status;
+  }
+
+  void ReadInput(size_t i, ONNXTensorElementDataType* type, std::vector<int64_t>* shape) const {
+#if ORT_API_VERSION >= 17
+    OrtTensorTypeAndShapeInfo* info = nullptr;
+    OrtW::ThrowOnError(api_, api_.ShapeInferContext_GetInputTypeShape(context_, i, &info));
+    OrtStatus* status = nullptr;
+    if (type != nullptr) {
+      status = api_.GetTensorElementType(info, type);
+    }
+    size_t rank = 0;
+    if (shape != nullptr && status == nullptr && (status = api_.GetDimensionsCount(info, &rank)) == nullptr) {
+      shape->resize(rank);
+      status = api_.GetDimensions(info, shape->data(), rank);
+    }
+    api_.ReleaseTensorTypeAndShapeInfo(info);
+    OrtW::ThrowOnError(api_, status);
+#endif
+  }
+
+  const OrtApi& api_;
+  OrtShapeInferContext* context_;
+};
+
 class TensorBase {
  public:
   TensorBase(const OrtW::CustomOpApi& api,
@@ -21,9 +254,10 @@ class TensorBase {
 
   virtual ~TensorBase() = default;
   operator bool() const {
-    return shape_.has_value();
+    return input_ != nullptr || shape_.has_value();
   }
   const std::vector<int64_t>& Shape() const {
+    LoadTypeAndShape();
     if (shape_.has_value()) {
       return *shape_;
     } else {
@@ -31,16 +265,15 @@ class TensorBase {
     }
   }
   ONNXTensorElementDataType Type() const {
+    LoadTypeAndShape();
     return type_;
   }
   int64_t NumberOfElement() const {
-    if (shape_.has_value()) {
-      return std::accumulate(shape_->begin(), shape_->end(), 1LL, std::multiplies<int64_t>());
-    } else {
-      ORTX_CXX_API_THROW("tensor shape is not yet initialized", ORT_RUNTIME_EXCEPTION);
-    }
+    Shape();
+    return num_elements_;
   }
   std::string Shape2Str() const {
+    LoadTypeAndShape();
     if (shape_.has_value()) {
       std::string shape_str;
       for (const auto& dim : *shape_) {
@@ -53,19 +286,71 @@ class TensorBase {
     }
   }
   bool IsCpuTensor() const {
+    if (input_ != nullptr) {
+      std::call_once(mem_type_once_, [this]() {
+        const OrtMemoryInfo* mem_info = {};
+        api_.ThrowOnError(api_.GetOrtApi().GetTensorMemoryInfo(input_, &mem_info));
+        if (mem_info) {
+          api_.ThrowOnError(api_.GetOrtApi().MemoryInfoGetName(mem_info, &mem_type_));
+        }
+      });
+    }
     return strcmp("Cpu", mem_type_) == 0;
   }
   virtual const void* DataRaw() const = 0;
   virtual size_t SizeInBytes() const = 0;
 
  protected:
+  // Gets the input value with no other query, the metadata of which is only fetched when it is used.
+  const OrtValue* GetInput() {
+    input_ = api_.KernelContext_GetInput(&ctx_, indice_);
+    if (input_ == nullptr) {
+      ORTX_CXX_API_THROW("invalid indice", ORT_RUNTIME_EXCEPTION);
+    }
+    return input_;
+  }
+
+  // Fetches the element type and the shape of the input together on the first use of either of them, only once
+  // even if the threads of a ParallelFor of the kernel query the same input.
+  void LoadTypeAndShape() const {
+    if (input_ == nullptr) {
+      return;
+    }
+    std::call_once(shape_once_, [this]() {
+      auto* info = api_.GetTensorTypeAndShape(input_);
+      if (type_ == ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED) {
+        type_ = api_.GetTensorElementType(info);
+      }
+      std::vector<int64_t> shape(api_.GetDimensionsCount(info));
+      api_.GetDimensions(info, shape.data(), shape.size());
+      api_.ReleaseTensorTypeAndShapeInfo(info);
+      num_elements_ = std::accumulate(shape.begin(), shape.end(), 1LL, std::multiplies<int64_t>());
+      shape_ = std::move(shape);
+    });
+  }
+
+  // Sets the shape of an output, which is only done by the thread of the Compute.
+  void SetShape(const std::vector<int64_t>& shape) {
+    num_elements_ = std::accumulate(shape.begin(), shape.end(), 1LL, std::multiplies<int64_t>());
+    shape_ = shape;
+  }
+
   const OrtW::CustomOpApi& api_;
   OrtKernelContext& ctx_;
   size_t indice_;
   bool is_input_;
-  std::optional<std::vector<int64_t>> shape_;
-  ONNXTensorElementDataType type_ = ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED;
-  const char* mem_type_ = "Cpu";
+  const OrtValue* input_{};
+  mutable std::optional<std::vector<int64_t>> shape_;
+  mutable ONNXTensorElementDataType type_ = ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED;
+  mutable int64_t num_elements_ = 0;
+  mutable const char* mem_type_ = "Cpu";  // of an input, queried on the first IsCpuTensor
+  mutable std::once_flag shape_once_;
+  mutable std::once_flag mem_type_once_;
+};
+
+// The element of the tensors of float16, whose bits the kernels convert themselves.
+struct MFloat16 {
+  uint16_t value;
 };
 
 template <typename T>
@@ -95,24 +380,11 @@ class Tensor : public TensorBase {
                                      indice,
                                      is_input) {
     if (is_input) {
-      auto input_count = api_.KernelContext_GetInputCount(&ctx_);
-      if (indice >= input_count) {
-        ORTX_CXX_API_THROW("invalid indice", ORT_RUNTIME_EXCEPTION);
-      }
-      const_value_ = api_.KernelContext_GetInput(&ctx_, indice);
-      auto* info = api_.GetTensorTypeAndShape(const_value_);
-      shape_ = api_.GetTensorShape(info);
-      type_ = api_.GetTensorElementType(info);
-      api_.ReleaseTensorTypeAndShapeInfo(info);
-      const OrtMemoryInfo* mem_info = {};
-      api_.ThrowOnError(api_.GetOrtApi().GetTensorMemoryInfo(const_value_, &mem_info));
-      if (mem_info) {
-        api_.ThrowOnError(api.GetOrtApi().MemoryInfoGetName(mem_info, &mem_type_));
-      }
+      GetInput();
     }
   }
   const TT* Data() const {
-    return api_.GetTensorData<TT>(const_value_);
+    return api_.GetTensorData<TT>(input_);
   }
 
   const void* DataRaw() const override {
@@ -126,12 +398,17 @@ class Tensor : public TensorBase {
   TT* Allocate(const std::vector<int64_t>& shape) {
     if (!data_) {
       OrtValue* out = api_.KernelContext_GetOutput(&ctx_, indice_, shape.data(), shape.size());
-      shape_ = shape;
+      SetShape(shape);
       data_ = api_.GetTensorMutableData<TT>(out);
+      StagedOutputs* staged = ComputeContext::Current().staged;
+      if (staged != nullptr && NumberOfElement() > 0) {
+        data_ = static_cast<TT*>(staged->Stage(data_, static_cast<size_t>(NumberOfElement()) * sizeof(TT)));
+      }
     }
     return data_;
   }
   const Span<T>& AsSpan() {
+    LoadTypeAndShape();
     if (!shape_.has_value() || shape_->size() != 1) {
       ORTX_CXX_API_THROW("to get a span, shape must be 1-D, actual shape: " + Shape2Str(), ORT_RUNTIME_EXCEPTION);
     }
@@ -139,6 +416,7 @@ class Tensor : public TensorBase {
     return span_;
   }
   const T& AsScalar() {
+    LoadTypeAndShape();
     if (!shape_.has_value() || (shape_->size() == 1 && (*shape_)[0] != 1) || shape_->size() > 1) {
       ORTX_CXX_API_THROW("to get a scalar, shape must be {1}, actual shape: " + Shape2Str(), ORT_RUNTIME_EXCEPTION);
     }
@@ -146,11 +424,64 @@ class Tensor : public TensorBase {
   }
 
  private:
-  const OrtValue* const_value_{};  // for input
-  TT* data_{};                     // for output
+  TT* data_{};  // for output
   Span<T> span_;
 };
 
+// Collects the strings of an output tensor in one contiguous buffer, each of them followed by a '\0',
+// so that FillStringTensor reads them in place rather than from a std::string per element.
+class StringTensorBuilder {
+ public:
+  void Reserve(size_t num_strings, size_t num_chars) {
+    offsets_.reserve(num_strings);
+    chars_.reserve(num_chars + num_strings);
+  }
+
+  void Append(std::string_view str) {
+    offsets_.push_back(chars_.size());
+    chars_.insert(chars_.end(), str.begin(), str.end());
+    chars_.push_back('\0');
+  }
+
+  // Appends the strings of the sizes at once, whose chars are then written through MutableData, which may be done
+  // in parallel for the different strings.
+  void AppendUninitialized(const std::vector<size_t>& sizes) {
+    size_t offset = chars_.size();
+    offsets_.reserve(offsets_.size() + sizes.size());
+    for (size_t size : sizes) {
+      offsets_.push_back(offset);
+      offset += size + 1;
+    }
+    chars_.resize(offset);  // zero filled, which terminates the strings
+  }
+
+  char* MutableData(size_t i) {
+    return chars_.data() + offsets_[i];
+  }
+
+  size_t Size() const {
+    return offsets_.size();
+  }
+
+  std::string_view Get(size_t i) const {
+    size_t end = i + 1 < offsets_.size() ? offsets_[i + 1] : chars_.size();
+    return std::string_view(chars_.data() + offsets_[i], end - offsets_[i] - 1);
+  }
+
+  // The pointers are only valid until the next Append, which may move the buffer.
+  std::vector<const char*> Pointers() const {
+    std::vector<const char*> raw(offsets_.size());
+    for (size_t i = 0; i < offsets_.size(); ++i) {
+      raw[i] = chars_.data() + offsets_[i];
+    }
+    return raw;
+  }
+
+ private:
+  std::vector<char> chars_;
+  std::vector<size_t> offsets_;
+};
+
 template <>
 class Tensor<std::string> : public TensorBase {
  public:
@@ -164,16 +495,8 @@ class Tensor<std::string> : public TensorBase {
                                      indice,
                                      is_input) {
     if (is_input) {
-      auto input_count = api_.KernelContext_GetInputCount(&ctx_);
-      if (indice >= input_count) {
-        ORTX_CXX_API_THROW("invalid indice", ORT_RUNTIME_EXCEPTION);
-      }
-
-      auto* const_value = api_.KernelContext_GetInput(&ctx_, indice);
-      auto* info = api_.GetTensorTypeAndShape(const_value);
-      shape_ = api_.GetTensorShape(info);
       type_ = ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
-      api_.ReleaseTensorTypeAndShapeInfo(info);
+      auto* const_value = GetInput();
 
       size_t num_chars;
       OrtW::ThrowOnError(api_.GetOrtApi(), api_.GetOrtApi().GetStringTensorDataLength(const_value, &num_chars));
@@ -211,17 +534,80 @@ class Tensor<std::string> : public TensorBase {
     return input_strings_[0].size();
   }
   void SetStringOutput(const strings& ss, const std::vector<int64_t>& dims) {
-    std::vector<const char*> raw;
-    for (const auto& s : ss) {
-      raw.push_back(s.data());
+    if (!HasStringElementBuffers()) {
+      std::vector<const char*> raw;
+      for (const auto& s : ss) {
+        raw.push_back(s.data());
+      }
+      SetStringOutput(raw, dims);
+      return;
+    }
+    std::vector<size_t> sizes(ss.size());
+    for (size_t i = 0; i < ss.size(); ++i) {
+      sizes[i] = ss[i].size();
     }
+    SetStringOutput(dims, sizes, [&ss](const std::vector<char*>& buffers) {
+      for (size_t i = 0; i < ss.size(); ++i) {
+        std::memcpy(buffers[i], ss[i].data(), ss[i].size());
+      }
+    });
+  }
+  // Whether the strings of an output are written in place by GetResizedStringTensorElementBuffer, and not copied
+  // from the C strings by FillStringTensor, which also stops at a '\0' in a string.
+  static bool HasStringElementBuffers() {
+#if ORT_API_VERSION >= 15
+    return GetActiveOrtAPIVersion() >= 15;
+#else
+    return false;
+#endif
+  }
+  // Allocates the output strings of the sizes and calls write(buffers), which fills the sizes[i] chars at buffers[i]
+  // of every string i, in parallel if it likes. The buffers are the strings of the output tensor itself with
+  // GetResizedStringTensorElementBuffer of ORT 1.15, so the chars are written once, and else they're staged in a
+  // StringTensorBuilder for FillStringTensor.
+  template <typename Write>
+  void SetStringOutput(const std::vector<int64_t>& dims, const std::vector<size_t>& sizes, Write&& write) {
     auto* output = api_.KernelContext_GetOutput(&ctx_, indice_, dims.data(), dims.size());
+    std::vector<char*> buffers(sizes.size());
+#if ORT_API_VERSION >= 15
+    if (HasStringElementBuffers()) {
+      for (size_t i = 0; i < sizes.size(); ++i) {
+        OrtW::ThrowOnError(api_.GetOrtApi(),
+                           api_.GetOrtApi().GetResizedStringTensorElementBuffer(output, i, sizes[i], &buffers[i]));
+      }
+      write(buffers);
+      return;
+    }
+#endif
+    StringTensorBuilder builder;
+    builder.AppendUninitialized(sizes);
+    for (size_t i = 0; i < sizes.size(); ++i) {
+      buffers[i] = builder.MutableData(i);
+    }
+    write(buffers);
+    auto raw = builder.Pointers();
     OrtW::ThrowOnError(api_.GetOrtApi(), api_.GetOrtApi().FillStringTensor(output, raw.data(), raw.size()));
   }
   void SetStringOutput(const std::vector<const char*>& ss, const std::vector<int64_t>& dims) {
     auto* output = api_.KernelContext_GetOutput(&ctx_, indice_, dims.data(), dims.size());
     OrtW::ThrowOnError(api_.GetOrtApi(), api_.GetOrtApi().FillStringTensor(output, ss.data(), ss.size()));
   }
+  void SetStringOutput(const StringTensorBuilder& builder, const std::vector<int64_t>& dims) {
+    if (!HasStringElementBuffers()) {
+      SetStringOutput(builder.Pointers(), dims);
+      return;
+    }
+    std::vector<size_t> sizes(builder.Size());
+    for (size_t i = 0; i < sizes.size(); ++i) {
+      sizes[i] = builder.Get(i).size();
+    }
+    SetStringOutput(dims, sizes, [&builder](const std::vector<char*>& buffers) {
+      for (size_t i = 0; i < buffers.size(); ++i) {
+        std::string_view str = builder.Get(i);
+        std::memcpy(buffers[i], str.data(), str.size());
+      }
+    });
+  }
   const Span<std::string>& AsSpan() {
     ORTX_CXX_API_THROW("span for TensorT of string not implemented", ORT_RUNTIME_EXCEPTION);
   }
@@ -250,15 +636,8 @@ class Tensor<std::string_view> : public TensorBase {
                                      indice,
                                      is_input) {
     if (is_input_) {
-      auto input_count = api_.KernelContext_GetInputCount(&ctx_);
-      if (indice >= input_count) {
-        ORTX_CXX_API_THROW("invalid indice", ORT_RUNTIME_EXCEPTION);
-      }
-      auto* const_value = api_.KernelContext_GetInput(&ctx_, indice);
-      auto* info = api_.GetTensorTypeAndShape(const_value);
-      shape_ = api_.GetTensorShape(info);
       type_ = ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
-      api_.ReleaseTensorTypeAndShapeInfo(info);
+      auto* const_value = GetInput();
 
       size_t num_chars;
       OrtW::ThrowOnError(api_.GetOrtApi(), api_.GetOrtApi().GetStringTensorDataLength(const_value, &num_chars));
@@ -273,6 +652,7 @@ class Tensor<std::string_view> : public TensorBase {
                                                                                      offsets.data(),
                                                                                      offsets.size()));
         offsets.push_back(num_chars);
+        input_string_views_.reserve(num_strings);
         for (size_t i = 0; i < num_strings; ++i) {
           input_string_views_.emplace_back(chars_.data() + offsets[i], offsets[i + 1] - offsets[i]);
         }
@@ -280,11 +660,7 @@ class Tensor<std::string_view> : public TensorBase {
     }
   }
   int64_t NumberOfElement() const {
-    if (shape_.has_value()) {
-      return std::accumulate(shape_->begin(), shape_->end(), 1ULL, std::multiplies<int64_t>());
-    } else {
-      return 0;
-    }
+    return *this ? TensorBase::NumberOfElement() : 0;
   }
   const string_views& Data() const {
     return input_string_views_;
@@ -316,6 +692,127 @@ class Tensor<std::string_view> : public TensorBase {
   std::vector<std::string_view> input_string_views_;  // for input
 };
 
+// A growable output, the shape of which is only known at the end of the compute. The kernel writes the values
+// in place, and Commit allocates the output of the final shape and copies them into it once.
+template <typename T>
+class OutputBuffer {
+ public:
+  explicit OutputBuffer(Tensor<T>& output) : output_(output) {}
+
+  void Reserve(size_t size) { values_.reserve(size); }
+
+  // Appends size values, which the caller writes, and returns the first of them.
+  T* Grow(size_t size) {
+    values_.resize(values_.size() + size);
+    return values_.data() + values_.size() - size;
+  }
+
+  void Resize(size_t size) { values_.resize(size); }
+  size_t Size() const { return values_.size(); }
+  T* Data() { return values_.data(); }
+  std::vector<T>& Values() { return values_; }
+
+  T* Commit(const std::vector<int64_t>& dims) {
+    int64_t size = std::accumulate(dims.begin(), dims.end(), 1LL, std::multiplies<int64_t>());
+    if (size != static_cast<int64_t>(values_.size())) {
+      ORTX_CXX_API_THROW("the output shape doesn't match the number of the values", ORT_RUNTIME_EXCEPTION);
+    }
+    T* data = output_.Allocate(dims);
+    std::copy(values_.begin(), values_.end(), data);
+    std::vector<T>().swap(values_);
+    return data;
+  }
+
+ private:
+  Tensor<T>& output_;
+  std::vector<T> values_;
+};
+
+// The rows of a padded output of the shape dims + [row_length], which is measured first and filled after that.
+// With a fixed row length the output is allocated at once and SetRow writes the rows into it, so no other
+// buffer of the output size is held. Otherwise the rows are kept until Allocate has measured the longest one,
+// and WriteRows moves them into the output. The rows may be set and written concurrently. The values of the rows
+// are of V, which are converted to T as they are written, e.g. the int64 ids into an int32 output.
+template <typename T, typename V = T>
+class PaddedOutput {
+ public:
+  // A negative row_length pads the rows to the longest one.
+  PaddedOutput(Tensor<T>& output, std::vector<int64_t> dims, int64_t row_length, T pad = T{})
+      : output_(output), dims_(std::move(dims)), pad_(pad) {
+    size_t row_count = std::accumulate(dims_.begin(), dims_.end(), size_t{1}, std::multiplies<size_t>());
+    lengths_.resize(row_count);
+    if (row_length >= 0) {
+      row_length_ = static_cast<size_t>(row_length);
+      fixed_ = true;
+      Allocate();
+    } else {
+      rows_.resize(row_count);
+    }
+  }
+
+  size_t RowCount() const { return lengths_.size(); }
+  bool IsFixed() const { return fixed_; }
+
+  // Sets the values of the row, which are truncated to the fixed row length.
+  void SetRow(size_t row, std::vector<V>&& values) {
+    if (fixed_) {
+      size_t length = std::min(values.size(), row_length_);
+      T* dst = data_ + row * row_length_;
+      std::copy(values.begin(), values.begin() + length, dst);
+      std::fill(dst + length, dst + row_length_, pad_);
+      lengths_[row] = length;
+    } else {
+      lengths_[row] = values.size();
+      rows_[row] = std::move(values);
+    }
+  }
+
+  // Allocates the output, with the longest row if the row length isn't fixed, and returns its data.
+  T* Allocate() {
+    return Allocate([](size_t length) { return length; });
+  }
+
+  // The same as above, and the length of the longest row is rounded by round_length(length) to the row length.
+  template <typename Fn>
+  T* Allocate(Fn&& round_length) {
+    if (data_ == nullptr) {
+      if (!fixed_) {
+        row_length_ = round_length(lengths_.empty() ? 0 : *std::max_element(lengths_.begin(), lengths_.end()));
+      }
+      std::vector<int64_t> output_dims = dims_;
+      output_dims.push_back(static_cast<int64_t>(row_length_));
+      data_ = output_.Allocate(output_dims);
+    }
+    return data_;
+  }
+
+  // Moves the rows [begin, end) into the allocated output and pads them.
+  void WriteRows(size_t begin, size_t end) {
+    if (fixed_) {
+      return;  // SetRow has written them
+    }
+    for (size_t row = begin; row < end; ++row) {
+      T* dst = data_ + row * row_length_;
+      std::copy(rows_[row].begin(), rows_[row].end(), dst);
+      std::fill(dst + rows_[row].size(), dst + row_length_, pad_);
+      std::vector<V>().swap(rows_[row]);
+    }
+  }
+
+  size_t Length(size_t row) const { return lengths_[row]; }
+  size_t RowLength() const { return row_length_; }
+
+ private:
+  Tensor<T>& output_;
+  std::vector<int64_t> dims_;
+  T pad_;
+  bool fixed_ = false;
+  size_t row_length_ = 0;
+  T* data_ = nullptr;
+  std::vector<size_t> lengths_;
+  std::vector<std::vector<V>> rows_;  // the rows before the output is measured
+};
+
 using TensorPtr = std::unique_ptr<Custom::TensorBase>;
 using TensorPtrs = std::vector<TensorPtr>;
 
@@ -333,6 +830,7 @@ struct Variadic : public TensorBase {
 #endif
     if (is_input) {
       auto input_count = api_.KernelContext_GetInputCount(&ctx_);
+      tensors_.reserve(input_count);
       for (size_t ith_input = 0; ith_input < input_count; ++ith_input) {
         auto* const_value = api_.KernelContext_GetInput(&ctx_, ith_input);
         auto* info = api_.GetTensorTypeAndShape(const_value);
@@ -358,6 +856,9 @@ struct Variadic : public TensorBase {
           case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16:
             tensor = std::make_unique<Custom::Tensor<uint16_t>>(api, ctx, ith_input, true);
             break;
+          case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
+            tensor = std::make_unique<Custom::Tensor<MFloat16>>(api, ctx, ith_input, true);
+            break;
           case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16:
             tensor = std::make_unique<Custom::Tensor<int16_t>>(api, ctx, ith_input, true);
             break;
@@ -418,188 +919,284 @@ struct Variadic : public TensorBase {
   TensorPtrs tensors_;
 };
 
+// The wrapper of the tensor which an argument of Compute is made of, or void for the kernel context.
+template <typename T>
+struct ArgTensor {
+  using type = Tensor<T>;  // of a scalar input
+};
+template <typename T>
+struct ArgTensor<const Tensor<T>*> {
+  using type = Tensor<T>;
+};
+template <typename T>
+struct ArgTensor<const Tensor<T>&> {
+  using type = Tensor<T>;
+};
+template <typename T>
+struct ArgTensor<Tensor<T>*> {
+  using type = Tensor<T>;
+};
+template <typename T>
+struct ArgTensor<Tensor<T>&> {
+  using type = Tensor<T>;
+};
+template <typename T>
+struct ArgTensor<const Span<T>*> {
+  using type = Tensor<T>;
+};
+template <typename T>
+struct ArgTensor<const Span<T>&> {
+  using type = Tensor<T>;
+};
+template <typename T>
+struct ArgTensor<std::optional<T>> : ArgTensor<T> {};
+template <>
+struct ArgTensor<const Variadic*> {
+  using type = Variadic;
+};
+template <>
+struct ArgTensor<const Variadic&> {
+  using type = Variadic;
+};
+template <>
+struct ArgTensor<Variadic*> {
+  using type = Variadic;
+};
+template <>
+struct ArgTensor<Variadic&> {
+  using type = Variadic;
+};
+template <>
+struct ArgTensor<OrtKernelContext*> {
+  using type = void;
+};
+
+template <typename T>
+struct ArgSlotOf {
+  using type = std::optional<T>;
+};
+template <>
+struct ArgSlotOf<void> {
+  using type = std::nullptr_t;
+};
+
+// The slots of the wrappers of the arguments of a Compute, which KernelCompute keeps in its own stack frame, so a
+// call neither allocates the wrappers nor reaches them through TensorBase. An optional input or output which isn't
+// given leaves its slot empty.
+template <typename... Args>
+using ArgSlots = std::tuple<typename ArgSlotOf<typename ArgTensor<Args>::type>::type...>;
+
+// Whether the kernel struct, or the traits of a function op, declare
+//   static void InferOutputShape(const ShapeInferContext&), which sets the outputs it knows from the inputs at the
+//     graph resolution, and
+//   static std::vector<std::pair<int, int>> MayInplace(), the pairs of an input and an output which may share one
+//     buffer, as each element of the input is read before that of the output is written.
+template <typename T, typename = void>
+struct HasInferOutputShape : std::false_type {};
+template <typename T>
+struct HasInferOutputShape<T, std::void_t<decltype(T::InferOutputShape(std::declval<const ShapeInferContext&>()))>>
+    : std::true_type {};
+
+template <typename T, typename = void>
+struct HasMayInplace : std::false_type {};
+template <typename T>
+struct HasMayInplace<T, std::void_t<decltype(T::MayInplace())>> : std::true_type {};
+
+// A kernel of a static constexpr bool kShareableAcrossSessions of true is shared by the sessions of the same
+// attributes with ORTX_SHARE_KERNELS=1, as ort_extensions::SharedKernels describes.
+template <typename T, typename = void>
+struct IsShareableKernel : std::false_type {};
+template <typename T>
+struct IsShareableKernel<T, std::enable_if_t<T::kShareableAcrossSessions>> : std::true_type {};
+
 struct OrtLiteCustomOp : public OrtCustomOp {
-  // CreateTuple
-  template <size_t ith_input, size_t ith_output, typename... Ts>
+  // The inputs of the kernels of the CPU execution provider are always in the CPU memory, so only the kernels of
+  // the other providers query the memory of a tensor.
+  static bool IsCpuInput(const TensorBase& tensor, const std::string& ep) {
+    return ep == "CPUExecutionProvider" || tensor.IsCpuTensor();
+  }
+
+  // CreateTuple makes the arguments of Compute, the ith_arg of which wraps its tensor in the ith_arg slot.
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename... Ts, typename Slots>
   static typename std::enable_if<sizeof...(Ts) == 0, std::tuple<>>::type
-  CreateTuple(const OrtW::CustomOpApi*, OrtKernelContext*, std::vector<TensorPtr>&, size_t, size_t, const std::string&) {
+  CreateTuple(Slots&, const OrtW::CustomOpApi*, OrtKernelContext*, size_t, size_t, const std::string&) {
     return std::make_tuple();
   }
 
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>
   static typename std::enable_if<std::is_same<T, OrtKernelContext*>::value, std::tuple<T, Ts...>>::type
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) {
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) {
     std::tuple<T> current = std::tuple<OrtKernelContext*>{context};
-    auto next = CreateTuple<ith_input, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);
+    auto next = CreateTuple<ith_arg + 1, ith_input, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);
     return std::tuple_cat(current, next);
   }
 
 #if ORT_API_VERSION >= 14
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>
   static typename std::enable_if<std::is_same<T, const Variadic*>::value, std::tuple<T, Ts...>>::type
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) {
-    tensors.push_back(std::make_unique<Variadic>(*api, *context, ith_input, true));
-    std::tuple<T> current = std::tuple<T>{reinterpret_cast<T>(tensors.back().get())};
-    auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) {
+    auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_input, true);
+    std::tuple<T> current = std::tuple<T>{&tensor};
+    auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);
     return std::tuple_cat(current, next);
   }
 
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>
   static typename std::enable_if<std::is_same<T, const Variadic&>::value, std::tuple<T, Ts...>>::type
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) {
-    tensors.push_back(std::make_unique<Variadic>(*api, *context, ith_input, true));
-    std::tuple<T> current = std::tuple<T>{reinterpret_cast<T>(*tensors.back().get())};
-    auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) {
+    auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_input, true);
+    std::tuple<T> current = std::tuple<T>{tensor};
+    auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);
     return std::tuple_cat(current, next);
   }
 
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>
   static typename std::enable_if<std::is_same<T, Variadic*>::value, std::tuple<T, Ts...>>::type
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) {
-    tensors.push_back(std::make_unique<Variadic>(*api, *context, ith_output, false));
-    std::tuple<T> current = std::tuple<T>{reinterpret_cast<T>(tensors.back().get())};
-    auto next = CreateTuple<ith_input, ith_output + 1, Ts...>(api, context, tensors, num_input, num_output, ep);
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) {
+    auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_output, false);
+    std::tuple<T> current = std::tuple<T>{&tensor};
+    auto next = CreateTuple<ith_arg + 1, ith_input, ith_output + 1, Ts...>(slots, api, context, num_input, num_output, ep);
     return std::tuple_cat(current, next);
   }
 
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>
   static typename std::enable_if<std::is_same<T, Variadic&>::value, std::tuple<T, Ts...>>::type
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) {
-    tensors.push_back(std::make_unique<Variadic>(*api, *context, ith_output, false));
-    std::tuple<T> current = std::tuple<T>{reinterpret_cast<T>(*tensors.back().get())};
-    auto next = CreateTuple<ith_input, ith_output + 1, Ts...>(api, context, tensors, num_input, num_output, ep);
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) {
+    auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_output, false);
+    std::tuple<T> current = std::tuple<T>{tensor};
+    auto next = CreateTuple<ith_arg + 1, ith_input, ith_output + 1, Ts...>(slots, api, context, num_input, num_output, ep);
     return std::tuple_cat(current, next);
   }
 #endif
 
-#define CREATE_TUPLE_INPUT(data_type)                                                                                                                                 \
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>                                                                                          \
-  static typename std::enable_if<std::is_same<T, const Custom::Tensor<data_type>*>::value, std::tuple<T, Ts...>>::type                                                \
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) { \
-    tensors.push_back(std::make_unique<Custom::Tensor<data_type>>(*api, *context, ith_input, true));                                                                  \
-    std::tuple<T> current = std::tuple<T>{reinterpret_cast<T>(tensors.back().get())};                                                                                 \
-    auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);                                                      \
-    return std::tuple_cat(current, next);                                                                                                                             \
-  }                                                                                                                                                                   \
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>                                                                                          \
-  static typename std::enable_if<std::is_same<T, const Custom::Tensor<data_type>&>::value, std::tuple<T, Ts...>>::type                                                \
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) { \
-    tensors.push_back(std::make_unique<Custom::Tensor<data_type>>(*api, *context, ith_input, true));                                                                  \
-    std::tuple<T> current = std::tuple<T>{reinterpret_cast<T>(*tensors.back().get())};                                                                                \
-    auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);                                                      \
-    return std::tuple_cat(current, next);                                                                                                                             \
-  }                                                                                                                                                                   \
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>                                                                                          \
-  static typename std::enable_if<std::is_same<T, std::optional<const Custom::Tensor<data_type>*>>::value, std::tuple<T, Ts...>>::type                                 \
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) { \
-    if (ith_input < num_input) {                                                                                                                                      \
-      tensors.push_back(std::make_unique<Custom::Tensor<data_type>>(*api, *context, ith_input, true));                                                                \
-      std::tuple<T> current = std::tuple<T>{reinterpret_cast<Custom::Tensor<data_type>*>(tensors.back().get())};                                                      \
-      auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);                                                    \
-      return std::tuple_cat(current, next);                                                                                                                           \
-    } else {                                                                                                                                                          \
-      std::tuple<T> current = std::tuple<T>{};                                                                                                                        \
-      auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);                                                    \
-      return std::tuple_cat(current, next);                                                                                                                           \
-    }                                                                                                                                                                 \
-  }                                                                                                                                                                   \
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>                                                                                          \
-  static typename std::enable_if<std::is_same<T, const Custom::Span<data_type>*>::value, std::tuple<T, Ts...>>::type                                                  \
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) { \
-    tensors.push_back(std::make_unique<Custom::Tensor<data_type>>(*api, *context, ith_input, true));                                                                  \
-    if (!tensors.back()->IsCpuTensor()) {                                                                                                                             \
-      ORTX_CXX_API_THROW("span input could only be applied to CPU tensor", ORT_FAIL);                                                                                 \
-    }                                                                                                                                                                 \
-    std::tuple<T> current = std::tuple<T>{&reinterpret_cast<Custom::Tensor<data_type>*>(tensors.back().get())->AsSpan()};                                             \
-    auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);                                                      \
-    return std::tuple_cat(current, next);                                                                                                                             \
-  }                                                                                                                                                                   \
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>                                                                                          \
-  static typename std::enable_if<std::is_same<T, const Custom::Span<data_type>&>::value, std::tuple<T, Ts...>>::type                                                  \
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) { \
-    tensors.push_back(std::make_unique<Custom::Tensor<data_type>>(*api, *context, ith_input, true));                                                                  \
-    if (!tensors.back()->IsCpuTensor()) {                                                                                                                             \
-      ORTX_CXX_API_THROW("span input could only be applied to CPU tensor", ORT_FAIL);                                                                                 \
-    }                                                                                                                                                                 \
-    std::tuple<T> current = std::tuple<T>{reinterpret_cast<Custom::Tensor<data_type>*>(tensors.back().get())->AsSpan()};                                              \
-    auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);                                                      \
-    return std::tuple_cat(current, next);                                                                                                                             \
-  }                                                                                                                                                                   \
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>                                                                                          \
-  static typename std::enable_if<std::is_same<T, std::optional<const Custom::Span<data_type>*>>::value, std::tuple<T, Ts...>>::type                                   \
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) { \
-    if (ith_input < num_input) {                                                                                                                                      \
-      tensors.push_back(std::make_unique<Custom::Tensor<data_type>>(*api, *context, ith_input, true));                                                                \
-      if (!tensors.back()->IsCpuTensor()) {                                                                                                                           \
-        ORTX_CXX_API_THROW("span input could only be applied to CPU tensor", ORT_FAIL);                                                                               \
-      }                                                                                                                                                               \
-      std::tuple<T> current = std::tuple<T>{&reinterpret_cast<Custom::Tensor<data_type>*>(tensors.back().get())->AsSpan()};                                           \
-      auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);                                                    \
-      return std::tuple_cat(current, next);                                                                                                                           \
-    } else {                                                                                                                                                          \
-      std::tuple<T> current = std::tuple<T>{};                                                                                                                        \
-      auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);                                                    \
-      return std::tuple_cat(current, next);                                                                                                                           \
-    }                                                                                                                                                                 \
-  }                                                                                                                                                                   \
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>                                                                                          \
-  static typename std::enable_if<std::is_same<T, data_type>::value, std::tuple<T, Ts...>>::type                                                                       \
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) { \
-    tensors.push_back(std::make_unique<Custom::Tensor<data_type>>(*api, *context, ith_input, true));                                                                  \
-    if (!tensors.back()->IsCpuTensor()) {                                                                                                                             \
-      ORTX_CXX_API_THROW("scalar input could only be applied to CPU tensor", ORT_FAIL);                                                                               \
-    }                                                                                                                                                                 \
-    std::tuple<T> current = std::tuple<T>{reinterpret_cast<Custom::Tensor<data_type>*>(tensors.back().get())->AsScalar()};                                            \
-    auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);                                                      \
-    return std::tuple_cat(current, next);                                                                                                                             \
-  }                                                                                                                                                                   \
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>                                                                                          \
-  static typename std::enable_if<std::is_same<T, std::optional<data_type>>::value, std::tuple<T, Ts...>>::type                                                        \
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) { \
-    if (ith_input < num_input) {                                                                                                                                      \
-      tensors.push_back(std::make_unique<Custom::Tensor<data_type>>(*api, *context, ith_input, true));                                                                \
-      if (!tensors.back()->IsCpuTensor()) {                                                                                                                           \
-        ORTX_CXX_API_THROW("scalar input could only be applied to CPU tensor", ORT_FAIL);                                                                             \
-      }                                                                                                                                                               \
-      std::tuple<T> current = std::tuple<T>{reinterpret_cast<Custom::Tensor<data_type>*>(tensors.back().get())->AsScalar()};                                          \
-      auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);                                                    \
-      return std::tuple_cat(current, next);                                                                                                                           \
-    } else {                                                                                                                                                          \
-      std::tuple<T> current = std::tuple<T>{};                                                                                                                        \
-      auto next = CreateTuple<ith_input + 1, ith_output, Ts...>(api, context, tensors, num_input, num_output, ep);                                                    \
-      return std::tuple_cat(current, next);                                                                                                                           \
-    }                                                                                                                                                                 \
-  }
-#define CREATE_TUPLE_OUTPUT(data_type)                                                                                                                                \
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>                                                                                          \
-  static typename std::enable_if<std::is_same<T, Custom::Tensor<data_type>*>::value, std::tuple<T, Ts...>>::type                                                      \
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) { \
-    tensors.push_back(std::make_unique<Custom::Tensor<data_type>>(*api, *context, ith_output, false));                                                                \
-    std::tuple<T> current = std::tuple<T>{reinterpret_cast<T>(tensors.back().get())};                                                                                 \
-    auto next = CreateTuple<ith_input, ith_output + 1, Ts...>(api, context, tensors, num_input, num_output, ep);                                                      \
-    return std::tuple_cat(current, next);                                                                                                                             \
-  }                                                                                                                                                                   \
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>                                                                                          \
-  static typename std::enable_if<std::is_same<T, Custom::Tensor<data_type>&>::value, std::tuple<T, Ts...>>::type                                                      \
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) { \
-    tensors.push_back(std::make_unique<Custom::Tensor<data_type>>(*api, *context, ith_output, false));                                                                \
-    std::tuple<T> current = std::tuple<T>{reinterpret_cast<T>(*tensors.back().get())};                                                                                \
-    auto next = CreateTuple<ith_input, ith_output + 1, Ts...>(api, context, tensors, num_input, num_output, ep);                                                      \
-    return std::tuple_cat(current, next);                                                                                                                             \
-  }                                                                                                                                                                   \
-  template <size_t ith_input, size_t ith_output, typename T, typename... Ts>                                                                                          \
-  static typename std::enable_if<std::is_same<T, std::optional<Custom::Tensor<data_type>*>>::value, std::tuple<T, Ts...>>::type                                       \
-  CreateTuple(const OrtW::CustomOpApi* api, OrtKernelContext* context, std::vector<TensorPtr>& tensors, size_t num_input, size_t num_output, const std::string& ep) { \
-    if (ith_output < num_output) {                                                                                                                                    \
-      tensors.push_back(std::make_unique<Custom::Tensor<data_type>>(*api, *context, ith_output, false));                                                              \
-      std::tuple<T> current = std::tuple<T>{reinterpret_cast<Custom::Tensor<data_type>*>(tensors.back().get())};                                                      \
-      auto next = CreateTuple<ith_input, ith_output + 1, Ts...>(api, context, tensors, num_input, num_output, ep);                                                    \
-      return std::tuple_cat(current, next);                                                                                                                           \
-    } else {                                                                                                                                                          \
-      std::tuple<T> current = std::tuple<T>{};                                                                                                                        \
-      auto next = CreateTuple<ith_input, ith_output + 1, Ts...>(api, context, tensors, num_input, num_output, ep);                                                    \
-      return std::tuple_cat(current, next);                                                                                                                           \
-    }                                                                                                                                                                 \
+#define CREATE_TUPLE_INPUT(data_type)                                                                                                              \
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>                                       \
+  static typename std::enable_if<std::is_same<T, const Custom::Tensor<data_type>*>::value, std::tuple<T, Ts...>>::type                             \
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) { \
+    auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_input, true);                                                              \
+    std::tuple<T> current = std::tuple<T>{&tensor};                                                                                                \
+    auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);                        \
+    return std::tuple_cat(current, next);                                                                                                          \
+  }                                                                                                                                                \
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>                                       \
+  static typename std::enable_if<std::is_same<T, const Custom::Tensor<data_type>&>::value, std::tuple<T, Ts...>>::type                             \
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) { \
+    auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_input, true);                                                              \
+    std::tuple<T> current = std::tuple<T>{tensor};                                                                                                 \
+    auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);                        \
+    return std::tuple_cat(current, next);                                                                                                          \
+  }                                                                                                                                                \
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>                                       \
+  static typename std::enable_if<std::is_same<T, std::optional<const Custom::Tensor<data_type>*>>::value, std::tuple<T, Ts...>>::type              \
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) { \
+    if (ith_input < num_input) {                                                                                                                   \
+      auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_input, true);                                                            \
+      std::tuple<T> current = std::tuple<T>{&tensor};                                                                                              \
+      auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);                      \
+      return std::tuple_cat(current, next);                                                                                                        \
+    } else {                                                                                                                                       \
+      std::tuple<T> current = std::tuple<T>{};                                                                                                     \
+      auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);                      \
+      return std::tuple_cat(current, next);                                                                                                        \
+    }                                                                                                                                              \
+  }                                                                                                                                                \
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>                                       \
+  static typename std::enable_if<std::is_same<T, const Custom::Span<data_type>*>::value, std::tuple<T, Ts...>>::type                               \
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) { \
+    auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_input, true);                                                              \
+    if (!IsCpuInput(tensor, ep)) {                                                                                                                 \
+      ORTX_CXX_API_THROW("span input could only be applied to CPU tensor", ORT_FAIL);                                                              \
+    }                                                                                                                                              \
+    std::tuple<T> current = std::tuple<T>{&tensor.AsSpan()};                                                                                       \
+    auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);                        \
+    return std::tuple_cat(current, next);                                                                                                          \
+  }                                                                                                                                                \
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>                                       \
+  static typename std::enable_if<std::is_same<T, const Custom::Span<data_type>&>::value, std::tuple<T, Ts...>>::type                               \
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) { \
+    auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_input, true);                                                              \
+    if (!IsCpuInput(tensor, ep)) {                                                                                                                 \
+      ORTX_CXX_API_THROW("span input could only be applied to CPU tensor", ORT_FAIL);                                                              \
+    }                                                                                                                                              \
+    std::tuple<T> current = std::tuple<T>{tensor.AsSpan()};                                                                                        \
+    auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);                        \
+    return std::tuple_cat(current, next);                                                                                                          \
+  }                                                                                                                                                \
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>                                       \
+  static typename std::enable_if<std::is_same<T, std::optional<const Custom::Span<data_type>*>>::value, std::tuple<T, Ts...>>::type                \
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) { \
+    if (ith_input < num_input) {                                                                                                                   \
+      auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_input, true);                                                            \
+      if (!IsCpuInput(tensor, ep)) {                                                                                                               \
+        ORTX_CXX_API_THROW("span input could only be applied to CPU tensor", ORT_FAIL);                                                            \
+      }                                                                                                                                            \
+      std::tuple<T> current = std::tuple<T>{&tensor.AsSpan()};                                                                                     \
+      auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);                      \
+      return std::tuple_cat(current, next);                                                                                                        \
+    } else {                                                                                                                                       \
+      std::tuple<T> current = std::tuple<T>{};                                                                                                     \
+      auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);                      \
+      return std::tuple_cat(current, next);                                                                                                        \
+    }                                                                                                                                              \
+  }                                                                                                                                                \
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>                                       \
+  static typename std::enable_if<std::is_same<T, data_type>::value, std::tuple<T, Ts...>>::type                                                    \
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) { \
+    auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_input, true);                                                              \
+    if (!IsCpuInput(tensor, ep)) {                                                                                                                 \
+      ORTX_CXX_API_THROW("scalar input could only be applied to CPU tensor", ORT_FAIL);                                                            \
+    }                                                                                                                                              \
+    std::tuple<T> current = std::tuple<T>{tensor.AsScalar()};                                                                                      \
+    auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);                        \
+    return std::tuple_cat(current, next);                                                                                                          \
+  }                                                                                                                                                \
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>                                       \
+  static typename std::enable_if<std::is_same<T, std::optional<data_type>>::value, std::tuple<T, Ts...>>::type                                     \
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) { \
+    if (ith_input < num_input) {                                                                                                                   \
+      auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_input, true);                                                            \
+      if (!IsCpuInput(tensor, ep)) {                                                                                                               \
+        ORTX_CXX_API_THROW("scalar input could only be applied to CPU tensor", ORT_FAIL);                                                          \
+      }                                                                                                                                            \
+      std::tuple<T> current = std::tuple<T>{tensor.AsScalar()};                                                                                    \
+      auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);                      \
+      return std::tuple_cat(current, next);                                                                                                        \
+    } else {                                                                                                                                       \
+      std::tuple<T> current = std::tuple<T>{};                                                                                                     \
+      auto next = CreateTuple<ith_arg + 1, ith_input + 1, ith_output, Ts...>(slots, api, context, num_input, num_output, ep);                      \
+      return std::tuple_cat(current, next);                                                                                                        \
+    }                                                                                                                                              \
+  }
+#define CREATE_TUPLE_OUTPUT(data_type)                                                                                                             \
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>                                       \
+  static typename std::enable_if<std::is_same<T, Custom::Tensor<data_type>*>::value, std::tuple<T, Ts...>>::type                                   \
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) { \
+    auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_output, false);                                                            \
+    std::tuple<T> current = std::tuple<T>{&tensor};                                                                                                \
+    auto next = CreateTuple<ith_arg + 1, ith_input, ith_output + 1, Ts...>(slots, api, context, num_input, num_output, ep);                        \
+    return std::tuple_cat(current, next);                                                                                                          \
+  }                                                                                                                                                \
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>                                       \
+  static typename std::enable_if<std::is_same<T, Custom::Tensor<data_type>&>::value, std::tuple<T, Ts...>>::type                                   \
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) { \
+    auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_output, false);                                                            \
+    std::tuple<T> current = std::tuple<T>{tensor};                                                                                                 \
+    auto next = CreateTuple<ith_arg + 1, ith_input, ith_output + 1, Ts...>(slots, api, context, num_input, num_output, ep);                        \
+    return std::tuple_cat(current, next);                                                                                                          \
+  }                                                                                                                                                \
+  template <size_t ith_arg, size_t ith_input, size_t ith_output, typename T, typename... Ts, typename Slots>                                       \
+  static typename std::enable_if<std::is_same<T, std::optional<Custom::Tensor<data_type>*>>::value, std::tuple<T, Ts...>>::type                    \
+  CreateTuple(Slots& slots, const OrtW::CustomOpApi* api, OrtKernelContext* context, size_t num_input, size_t num_output, const std::string& ep) { \
+    if (ith_output < num_output) {                                                                                                                 \
+      auto& tensor = std::get<ith_arg>(slots).emplace(*api, *context, ith_output, false);                                                          \
+      std::tuple<T> current = std::tuple<T>{&tensor};                                                                                              \
+      auto next = CreateTuple<ith_arg + 1, ith_input, ith_output + 1, Ts...>(slots, api, context, num_input, num_output, ep);                      \
+      return std::tuple_cat(current, next);                                                                                                        \
+    } else {                                                                                                                                       \
+      std::tuple<T> current = std::tuple<T>{};                                                                                                     \
+      auto next = CreateTuple<ith_arg + 1, ith_input, ith_output + 1, Ts...>(slots, api, context, num_input, num_output, ep);                      \
+      return std::tuple_cat(current, next);                                                                                                        \
+    }                                                                                                                                              \
   }
 #define CREATE_TUPLE(data_type) \
   CREATE_TUPLE_INPUT(data_type) \
@@ -616,6 +1213,7 @@ struct OrtLiteCustomOp : public OrtCustomOp {
   CREATE_TUPLE(uint16_t)
   CREATE_TUPLE(uint32_t)
   CREATE_TUPLE(uint64_t)
+  CREATE_TUPLE(MFloat16)
   CREATE_TUPLE(std::string)
   CREATE_TUPLE_INPUT(std::string_view)
 
@@ -729,11 +1327,14 @@ struct OrtLiteCustomOp : public OrtCustomOp {
   PARSE_ARGS(uint16_t, ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16)
   PARSE_ARGS(uint32_t, ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32)
   PARSE_ARGS(uint64_t, ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64)
+  PARSE_ARGS(MFloat16, ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16)
   PARSE_ARGS(std::string, ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING)
   PARSE_ARGS(std::string_view, ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING)  // todo - remove string_view output
 
+  // the fields of the newer API which aren't set are null
   OrtLiteCustomOp(const char* op_name,
-                  const char* execution_provider) : op_name_(op_name),
+                  const char* execution_provider) : OrtCustomOp{},
+                                                    op_name_(op_name),
                                                     execution_provider_(execution_provider) {
     int act_ver = GetActiveOrtAPIVersion();
     OrtCustomOp::version = act_ver < ORT_API_VERSION ? act_ver : ORT_API_VERSION;
@@ -800,10 +1401,76 @@ struct OrtLiteCustomOp : public OrtCustomOp {
       return INPUT_OUTPUT_OPTIONAL;
     };
 #endif
+
+#if ORT_API_VERSION >= 17
+    OrtCustomOp::GetStartVersion = [](const OrtCustomOp*) {
+      return 1;
+    };
+
+    OrtCustomOp::GetEndVersion = [](const OrtCustomOp*) {
+      return INT_MAX;
+    };
+#endif
+  }
+
+  // Sets the hooks of the op which Traits declares, see HasInferOutputShape. ORT of an older API than a hook
+  // doesn't read it, 17 for the shape inference and 18 for the in-place pairs.
+  template <typename Traits>
+  void SetOpTraits() {
+#if ORT_API_VERSION >= 17
+    if constexpr (HasInferOutputShape<Traits>::value) {
+      OrtCustomOp::InferOutputShapeFn = [](const OrtCustomOp*, OrtShapeInferContext* context) -> OrtStatusPtr {
+        const OrtApi* api = RegisteredOrtApi();
+        if (api == nullptr) {
+          return nullptr;  // the outputs are left to the compute
+        }
+        OrtStatusPtr status = nullptr;
+        OCOS_TRY {
+          Traits::InferOutputShape(ShapeInferContext(*api, context));
+        }
+        OCOS_CATCH(const OrtW::Exception& ex) {
+          OCOS_HANDLE_EXCEPTION([&]() { status = api->CreateStatus(ex.GetOrtErrorCode(), ex.what()); });
+        }
+        OCOS_CATCH(const std::exception& ex) {
+          OCOS_HANDLE_EXCEPTION([&]() { status = api->CreateStatus(ORT_INVALID_GRAPH, ex.what()); });
+        }
+        return status;
+      };
+    }
+#endif
+#if ORT_API_VERSION >= 18
+    if constexpr (HasMayInplace<Traits>::value) {
+      OrtCustomOp::GetMayInplace = [](int** input_index, int** output_index) -> size_t {
+        const std::vector<std::pair<int, int>> pairs = Traits::MayInplace();
+        *input_index = new int[pairs.size()];
+        *output_index = new int[pairs.size()];
+        for (size_t i = 0; i < pairs.size(); ++i) {
+          (*input_index)[i] = pairs[i].first;
+          (*output_index)[i] = pairs[i].second;
+        }
+        return pairs.size();
+      };
+
+      OrtCustomOp::ReleaseMayInplace = [](int* input_index, int* output_index) {
+        delete[] input_index;
+        delete[] output_index;
+      };
+    }
+#endif
+  }
+
+  // Runs the CPU code of the op for a device execution provider, with its inputs in the CPU memory, and its
+  // outputs staged by the OutputStaging which the factory makes for every kernel.
+  void StageOutputs(OutputStagingFactory factory) {
+    staging_factory_ = factory;
+    OrtCustomOp::GetInputMemoryType = [](const OrtCustomOp*, size_t) {
+      return OrtMemTypeCPUInput;
+    };
   }
 
   const std::string op_name_;
   const std::string execution_provider_;
+  OutputStagingFactory staging_factory_{};
 
   std::vector<ONNXTensorElementDataType> input_types_;
   std::vector<ONNXTensorElementDataType> output_types_;
@@ -817,7 +1484,10 @@ struct OrtLiteCustomFunc : public OrtLiteCustomOp {
   struct Kernel {
     ComputeFn compute_fn_{};
     std::string ep_{};
+    int api_version_{};
     std::unique_ptr<OrtW::CustomOpApi> api_;
+    ort_extensions::LatencyHistogram* latency_{};  // of the op name, which is shared by its kernels
+    std::unique_ptr<OutputStaging> staging_;      // of an op whose outputs are staged
   };
 
   OrtLiteCustomFunc(const char* op_name,
@@ -828,14 +1498,20 @@ struct OrtLiteCustomFunc : public OrtLiteCustomOp {
 
     OrtCustomOp::KernelCompute = [](void* op_kernel, OrtKernelContext* context) {
       auto kernel = reinterpret_cast<Kernel*>(op_kernel);
-      std::vector<TensorPtr> tensors;
-      auto t = CreateTuple<0, 0, Args...>(kernel->api_.get(),
-                                          context,
-                                          tensors,
-                                          kernel->api_->KernelContext_GetInputCount(context),
-                                          kernel->api_->KernelContext_GetOutputCount(context),
-                                          kernel->ep_);
+      ort_extensions::LatencyTimer timer(*kernel->latency_);
+      ort_extensions::RunCancellation::Scope cancellation;
+      ArgSlots<Args...> slots;
+      auto t = CreateTuple<0, 0, 0, Args...>(slots,
+                                             kernel->api_.get(),
+                                             context,
+                                             kernel->api_->KernelContext_GetInputCount(context),
+                                             kernel->api_->KernelContext_GetOutputCount(context),
+                                             kernel->ep_);
+      StagedOutputs staged(kernel->staging_.get());
+      ComputeContextScope compute_scope(*kernel->api_, context, kernel->api_version_,
+                                        kernel->staging_ ? &staged : nullptr);
       std::apply([kernel](Args const&... t_args) { kernel->compute_fn_(t_args...); }, t);
+      staged.Upload(context);
     };
 
     OrtCustomOp::CreateKernel = [](const OrtCustomOp* this_, const OrtApi* ort_api, const OrtKernelInfo* info) {
@@ -843,7 +1519,12 @@ struct OrtLiteCustomFunc : public OrtLiteCustomOp {
       auto self = static_cast<const OrtLiteCustomFunc*>(this_);
       kernel->compute_fn_ = self->compute_fn_;
       kernel->ep_ = self->execution_provider_;
+      kernel->api_version_ = static_cast<int>(self->version);
       kernel->api_ = std::make_unique<OrtW::CustomOpApi>(*ort_api);
+      kernel->latency_ = &ort_extensions::RuntimeStats::Instance().Latency(self->op_name_);
+      if (self->staging_factory_ != nullptr) {
+        kernel->staging_ = self->staging_factory_(*ort_api, *info);
+      }
       return reinterpret_cast<void*>(kernel.release());
     };
 
@@ -861,16 +1542,22 @@ struct OrtLiteCustomStruct : public OrtLiteCustomOp {
   using CustomComputeFn = void (CustomOp::*)(Args...) const;
   using MyType = OrtLiteCustomStruct<CustomOp>;
 
+  // ORT runs a kernel in the concurrent Run calls of its session, and in parallel with the other nodes, so Compute
+  // is const and called through a const kernel: the state it changes, like a cache, must be guarded or atomic.
   struct Kernel {
-    std::unique_ptr<CustomOp> custom_op_;
+    std::shared_ptr<const CustomOp> custom_op_;  // which other sessions hold too if it's shared
     std::string ep_{};
+    int api_version_{};
     std::unique_ptr<OrtW::CustomOpApi> api_;
+    ort_extensions::LatencyHistogram* latency_{};  // of the op name, which is shared by its kernels
+    std::unique_ptr<OutputStaging> staging_;      // of an op whose outputs are staged
   };
 
   OrtLiteCustomStruct(const char* op_name,
                       const char* execution_provider) : OrtLiteCustomOp(op_name,
                                                                         execution_provider) {
     init(&CustomOp::Compute);
+    SetOpTraits<CustomOp>();
   }
 
   template <typename... Args>
@@ -879,22 +1566,43 @@ struct OrtLiteCustomStruct : public OrtLiteCustomOp {
 
     OrtCustomOp::KernelCompute = [](void* op_kernel, OrtKernelContext* context) {
       auto kernel = reinterpret_cast<Kernel*>(op_kernel);
-      std::vector<TensorPtr> tensors;
-      auto t = CreateTuple<0, 0, Args...>(kernel->api_.get(),
-                                          context,
-                                          tensors,
-                                          kernel->api_->KernelContext_GetInputCount(context),
-                                          kernel->api_->KernelContext_GetOutputCount(context),
-                                          kernel->ep_);
+      ort_extensions::LatencyTimer timer(*kernel->latency_);
+      ort_extensions::RunCancellation::Scope cancellation;
+      ArgSlots<Args...> slots;
+      auto t = CreateTuple<0, 0, 0, Args...>(slots,
+                                             kernel->api_.get(),
+                                             context,
+                                             kernel->api_->KernelContext_GetInputCount(context),
+                                             kernel->api_->KernelContext_GetOutputCount(context),
+                                             kernel->ep_);
+      StagedOutputs staged(kernel->staging_.get());
+      ComputeContextScope compute_scope(*kernel->api_, context, kernel->api_version_,
+                                        kernel->staging_ ? &staged : nullptr);
       std::apply([kernel](Args const&... t_args) { kernel->custom_op_->Compute(t_args...); }, t);
+      staged.Upload(context);
     };
 
     OrtCustomOp::CreateKernel = [](const OrtCustomOp* this_, const OrtApi* ort_api, const OrtKernelInfo* info) {
       auto kernel = std::make_unique<Kernel>();
-      kernel->custom_op_ = std::make_unique<CustomOp>(*ort_api, *info);
       auto self = static_cast<const MyType*>(this_);
+      if constexpr (IsShareableKernel<CustomOp>::value) {
+        using Shared = ort_extensions::SharedKernels<CustomOp>;
+        if (Shared::IsEnabled()) {
+          kernel->custom_op_ = Shared::Instance().GetOrCreate(
+              self->op_name_, self->execution_provider_, *ort_api, *info,
+              [&]() { return std::make_shared<const CustomOp>(*ort_api, *info); });
+        }
+      }
+      if (kernel->custom_op_ == nullptr) {
+        kernel->custom_op_ = std::make_shared<const CustomOp>(*ort_api, *info);
+      }
       kernel->ep_ = self->execution_provider_;
+      kernel->api_version_ = static_cast<int>(self->version);
       kernel->api_ = std::make_unique<OrtW::CustomOpApi>(*ort_api);
+      kernel->latency_ = &ort_extensions::RuntimeStats::Instance().Latency(self->op_name_);
+      if (self->staging_factory_ != nullptr) {
+        kernel->staging_ = self->staging_factory_(*ort_api, *info);
+      }
       return reinterpret_cast<void*>(kernel.release());
     };
 
@@ -7,7 +7,9 @@
 #include <cassert>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "onnxruntime_customop.hpp"
@@ -87,9 +89,77 @@ class CuopContainer {
   std::vector<std::shared_ptr<OrtCustomOp>> op_instances_;  // use shared_ptr to capture type specific deleter
 };
 
-#define CustomCpuFunc(name, f) []() { return std::shared_ptr<ortc::OrtLiteCustomOp>(ortc::CreateLiteCustomOp(name, "CPUExecutionProvider", f)); }
-#define CustomCpuStruct(name, s) []() { return std::shared_ptr<ortc::OrtLiteCustomOp>(ortc::CreateLiteCustomOp<s>(name, "CPUExecutionProvider")); }
-#define CustomAzureStruct(name, s) []() { return std::shared_ptr<ortc::OrtLiteCustomOp>(ortc::CreateLiteCustomOp<s>(name, "AzureExecutionProvider")); }
+// A build of the selected ops defines OCOS_SELECTED_OPS as their names between '|', like "|GPT2Tokenizer|BpeDecoder|",
+// which tools/gen_selectedops.py generates from the op list of the models.
+constexpr bool IsSelectedOp(std::string_view name) {
+#ifdef OCOS_SELECTED_OPS
+  constexpr std::string_view selected_ops = OCOS_SELECTED_OPS;
+  for (size_t pos = selected_ops.find(name); pos != std::string_view::npos; pos = selected_ops.find(name, pos + 1)) {
+    if (pos > 0 && selected_ops[pos - 1] == '|' && pos + name.size() < selected_ops.size() &&
+        selected_ops[pos + name.size()] == '|') {
+      return true;
+    }
+  }
+  return false;
+#else
+  return true;
+#endif
+}
+
+// Creates the lite custom op only if it is selected. Otherwise its kernel isn't instantiated at all, so the
+// linker drops the kernel and the third-party code which only it uses.
+template <bool selected>
+struct SelectedOpFactory {
+  template <typename F>
+  static std::shared_ptr<ortc::OrtLiteCustomOp> Func(const char* name, const char* ep, F f) {
+    return std::shared_ptr<ortc::OrtLiteCustomOp>(ortc::CreateLiteCustomOp(name, ep, f));
+  }
+
+  // The function op of the shape inference and the in-place pairs which Traits declares, see HasInferOutputShape.
+  template <typename Traits, typename F>
+  static std::shared_ptr<ortc::OrtLiteCustomOp> FuncWithTraits(const char* name, const char* ep, F f) {
+    auto op = Func(name, ep, f);
+    op->template SetOpTraits<Traits>();
+    return op;
+  }
+
+  template <typename S>
+  static std::shared_ptr<ortc::OrtLiteCustomOp> Struct(const char* name, const char* ep) {
+    return std::shared_ptr<ortc::OrtLiteCustomOp>(ortc::CreateLiteCustomOp<S>(name, ep));
+  }
+
+  // The struct op of the CPU code for a device execution provider, whose outputs are staged, see OutputStaging.
+  template <typename S>
+  static std::shared_ptr<ortc::OrtLiteCustomOp> StagedStruct(const char* name, const char* ep,
+                                                             ortc::OutputStagingFactory factory) {
+    auto op = Struct<S>(name, ep);
+    op->StageOutputs(factory);
+    return op;
+  }
+};
+
+template <>
+struct SelectedOpFactory<false> {
+  template <typename F>
+  static std::shared_ptr<ortc::OrtLiteCustomOp> Func(const char*, const char*, F) { return nullptr; }
+
+  template <typename Traits, typename F>
+  static std::shared_ptr<ortc::OrtLiteCustomOp> FuncWithTraits(const char*, const char*, F) { return nullptr; }
+
+  template <typename S>
+  static std::shared_ptr<ortc::OrtLiteCustomOp> Struct(const char*, const char*) { return nullptr; }
+
+  template <typename S>
+  static std::shared_ptr<ortc::OrtLiteCustomOp> StagedStruct(const char*, const char*, ortc::OutputStagingFactory) {
+    return nullptr;
+  }
+};
+
+#define CustomCpuFunc(name, f) []() { return SelectedOpFactory<IsSelectedOp(name)>::Func(name, "CPUExecutionProvider", f); }
+#define CustomCpuFuncWithTraits(name, f, traits) []() { return SelectedOpFactory<IsSelectedOp(name)>::FuncWithTraits<traits>(name, "CPUExecutionProvider", f); }
+#define CustomCpuStruct(name, s) []() { return SelectedOpFactory<IsSelectedOp(name)>::Struct<s>(name, "CPUExecutionProvider"); }
+#define CustomAzureStruct(name, s) []() { return SelectedOpFactory<IsSelectedOp(name)>::Struct<s>(name, "AzureExecutionProvider"); }
+#define CustomCudaStruct(name, s) []() { return SelectedOpFactory<IsSelectedOp(name)>::Struct<s>(name, "CUDAExecutionProvider"); }
 
 template <typename F>
 void AppendCustomOp(std::vector<std::shared_ptr<OrtCustomOp>>& ops,
@@ -179,3 +249,12 @@ extern FxLoadCustomOpFactory LoadCustomOpClasses_Audio;
 #if ENABLE_AZURE
 extern FxLoadCustomOpFactory LoadCustomOpClasses_Azure;
 #endif
+
+#ifdef USE_CUDA
+// the kernels of the CUDA execution provider of the ops of the ai.onnx.contrib domain, and of the new domain
+extern FxLoadCustomOpFactory LoadCustomOpClasses_Cuda;
+extern FxLoadCustomOpFactory LoadCustomOpClasses_CudaExtensions;
+// the CPU kernels of the preprocessing for the CUDA execution provider, whose outputs are staged in the pinned memory
+extern FxLoadCustomOpFactory LoadCustomOpClasses_CudaStaged;
+extern FxLoadCustomOpFactory LoadCustomOpClasses_CudaStagedExtensions;
+#endif
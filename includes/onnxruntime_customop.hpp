@@ -101,7 +101,7 @@ struct CustomOpBase : OrtCustomOp {
 
     OrtCustomOp::KernelCompute = [](void* op_kernel, OrtKernelContext* context) {
       OCOS_API_IMPL_BEGIN
-      static_cast<TKernel*>(op_kernel)->Compute(context);
+      static_cast<const TKernel*>(op_kernel)->Compute(context);
       OCOS_API_IMPL_END
     };
 
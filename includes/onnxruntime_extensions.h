@@ -27,6 +27,28 @@ extern "C" {
 
 ORTX_EXPORT OrtStatus* ORT_API_CALL RegisterCustomOps(OrtSessionOptions* options, const OrtApiBase* api);
 
+// Writes the runtime statistics of the process into buffer as a null-terminated JSON object, if it fits in
+// buffer_size, and returns the size it needs, so a call with a null buffer gets the size of the next one.
+// The object has the "counters", like the hits, misses and entries of the caches and the bytes of the arenas, and
+// the "latencies" of each op, the "count" and "total_us" of its calls and the "buckets" of their microseconds by
+// powers of 2.
+ORTX_EXPORT size_t ORT_API_CALL GetRuntimeStatistics(char* buffer, size_t buffer_size);
+
+// Begins a run of the kernels of the extensions started on the calling thread until EndKernelRun, like the ones of the
+// runs of the sessions from this thread, which run on it with the sequential execution, and the threads of their
+// loops. It returns the handle of the run for CancelRunningKernels. The kernels fail their runs like the cancelled
+// ones once timeout_ms have passed, or never if timeout_ms is negative.
+ORTX_EXPORT uint64_t ORT_API_CALL BeginKernelRun(int64_t timeout_ms);
+
+// Ends the run of the handle, and clears it from the calling thread if it's its run.
+ORTX_EXPORT void ORT_API_CALL EndKernelRun(uint64_t run);
+
+// Cancels the kernels of the run of the handle, from any thread, which fail their runs at the next boundary of their
+// long loops, like the rows of a tokenizer, the blocks of an audio decoder or the progress of a transfer of a cloud
+// op. The kernels of the other runs and sessions aren't cancelled. The terminate flag of the RunOptions doesn't reach
+// the custom ops, so it's set along with this to stop the run of a session.
+ORTX_EXPORT void ORT_API_CALL CancelRunningKernels(uint64_t run);
+
 #ifdef __cplusplus
 }
 #endif
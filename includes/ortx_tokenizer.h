@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The tokenizers of the library without an ORT session, for the pipelines which tokenize many texts out of a
+// model. They are the same GPT2Tokenizer, BertTokenizer and TrieTokenizer as the ops, with their default
+// attributes, but encode a batch of UTF-8 spans of the caller straight into the arrays of the caller, without the
+// string tensors and the graph.
+//
+// The functions return 0 on success, or the OrtErrorCode of the failure, whose message OrtxGetLastErrorMessage
+// gives. A tokenizer is thread-safe: a batch can be encoded and decoded from many threads at once.
+
+// The library is built with ORTX_TOKENIZER_BUILD, which exports the functions, and its consumers import them.
+#ifdef _WIN32
+#ifdef ORTX_TOKENIZER_BUILD
+#define ORTX_TOKENIZER_EXPORT __declspec(dllexport)
+#else
+#define ORTX_TOKENIZER_EXPORT __declspec(dllimport)
+#endif
+#else
+#define ORTX_TOKENIZER_EXPORT
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct OrtxTokenizer OrtxTokenizer;
+
+// A view of the UTF-8 bytes of a text, which needn't be null-terminated.
+typedef struct OrtxStringSpan {
+  const char* data;
+  size_t size;
+} OrtxStringSpan;
+
+// Creates the tokenizer of the kind, "GPT2Tokenizer", "BertTokenizer" or "TrieTokenizer", from the bytes of its
+// assets as the attributes of the op have them: the vocab and the merges of GPT2, or the binary model of the
+// converter without merges, the vocab_file of BERT, and the vocab of Trie, which have no merges.
+// The bytes are copied by the tokenizer, so they can be released after the call.
+ORTX_TOKENIZER_EXPORT int OrtxCreateTokenizer(const char* kind, OrtxStringSpan vocab, OrtxStringSpan merges,
+                                              OrtxTokenizer** tokenizer);
+
+// The same as OrtxCreateTokenizer from the files of the assets, which are mapped instead of being read.
+// The merges_path is null for the kinds without merges.
+ORTX_TOKENIZER_EXPORT int OrtxCreateTokenizerFromFiles(const char* kind, const char* vocab_path,
+                                                       const char* merges_path, OrtxTokenizer** tokenizer);
+
+ORTX_TOKENIZER_EXPORT void OrtxReleaseTokenizer(OrtxTokenizer* tokenizer);
+
+// Encodes the texts into ids, the ids of text i at ids[row_offsets[i]] to ids[row_offsets[i + 1]], so
+// row_offsets has count + 1 entries. The ids of a row are only written while they fit in ids_capacity, and
+// row_offsets is always filled, so its last entry is the capacity all the ids need, e.g. after a call with no ids.
+// BERT adds [CLS] and [SEP] to each text as the op does.
+ORTX_TOKENIZER_EXPORT int OrtxEncodeBatch(const OrtxTokenizer* tokenizer, const OrtxStringSpan* texts, size_t count,
+                                          int64_t* ids, size_t ids_capacity, size_t* row_offsets);
+
+// Decodes the rows of ids, the ids of row i at ids[id_offsets[i]] to ids[id_offsets[i + 1]], into the UTF-8
+// bytes of its text at text[text_offsets[i]] to text[text_offsets[i + 1]]. The texts aren't null-terminated.
+// The bytes of a text are only written while they fit in text_capacity, and text_offsets is always filled, so
+// its last entry is the capacity all the texts need.
+ORTX_TOKENIZER_EXPORT int OrtxDecodeBatch(const OrtxTokenizer* tokenizer, const int64_t* ids,
+                                          const size_t* id_offsets, size_t count, char* text, size_t text_capacity,
+                                          size_t* text_offsets);
+
+// The message of the last error of the calls of this thread, which lives until its next call.
+ORTX_TOKENIZER_EXPORT const char* OrtxGetLastErrorMessage(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,164 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "exceptions.h"
+
+namespace ort_extensions {
+
+// The cancellation of the running kernels, which ORT doesn't tell the custom ops about: the terminate flag of the
+// RunOptions isn't visible to a kernel. A run is begun on the thread of the runs of a session, whose kernels run on
+// it with the sequential execution, and the Compute of every kernel takes the token of the run of its thread, with
+// which its long loops poll at their boundaries, like the rows of the tokenizers, the blocks of the decoded audio
+// and the progress of the transfers of the cloud ops. ParallelFor hands the token to the threads of a loop.
+// Cancel(handle) cancels the kernels of that run only, and they fail with the error of ThrowIfCancelled, as they
+// do once the deadline of the run passes. The kernels out of a run aren't cancelled.
+class RunCancellation {
+ public:
+  using Clock = std::chrono::steady_clock;
+  using Handle = uint64_t;
+
+  // The state of a run, which the tokens of its kernels share.
+  struct Run {
+    explicit Run(Handle run_handle, Clock::time_point run_deadline) : handle(run_handle), deadline(run_deadline) {}
+
+    const Handle handle;
+    const Clock::time_point deadline;
+    std::atomic<bool> cancelled{false};
+  };
+
+  struct Token {
+    std::shared_ptr<const Run> run;  // null out of a run
+  };
+
+  // Begins a run on the calling thread, whose kernels fail once the deadline passes, or never with
+  // time_point::max(). The run lasts until EndRun of its handle, which RunScope calls.
+  static Handle BeginRun(Clock::time_point deadline = Clock::time_point::max()) {
+    auto run = std::make_shared<Run>(NextHandle().fetch_add(1, std::memory_order_relaxed), deadline);
+    {
+      std::lock_guard<std::mutex> lock(RunsMutex());
+      Runs().emplace(run->handle, run);
+    }
+    ThreadRun() = run;
+    return run->handle;
+  }
+
+  // Ends the run, which can't be cancelled afterwards, and clears it from the calling thread if it's its run.
+  static void EndRun(Handle handle) {
+    {
+      std::lock_guard<std::mutex> lock(RunsMutex());
+      Runs().erase(handle);
+    }
+    if (ThreadRun() != nullptr && ThreadRun()->handle == handle) {
+      ThreadRun().reset();
+    }
+  }
+
+  // Cancels the kernels of the run which are running or started before it ends. It returns false if the run has
+  // ended or never began.
+  static bool Cancel(Handle handle) {
+    std::lock_guard<std::mutex> lock(RunsMutex());
+    auto found = Runs().find(handle);
+    if (found == Runs().end()) {
+      return false;
+    }
+    found->second->cancelled.store(true, std::memory_order_relaxed);
+    return true;
+  }
+
+  static const Token& Current() { return CurrentRef(); }
+
+  static bool Cancelled(const Token& token) {
+    if (token.run == nullptr) {
+      return false;
+    }
+
+    return token.run->cancelled.load(std::memory_order_relaxed) ||
+           (token.run->deadline != Clock::time_point::max() && Clock::now() >= token.run->deadline);
+  }
+
+  static bool Cancelled() { return Cancelled(Current()); }
+
+  // Throws the error of the cancellation of the kernel of the op if the token of this thread is cancelled.
+  static void ThrowIfCancelled(const char* op) {
+    const Token& token = Current();
+    if (Cancelled(token)) {
+      const bool expired = !token.run->cancelled.load(std::memory_order_relaxed);
+      ORTX_CXX_API_THROW(std::string("[") + op + "]: " +
+                             (expired ? "The deadline of the run has passed." : "The run was cancelled."),
+                         ORT_RUNTIME_EXCEPTION);
+    }
+  }
+
+  // Begins a run on this thread until the end of its life, and restores the run the thread had before.
+  class RunScope {
+   public:
+    explicit RunScope(Clock::time_point deadline = Clock::time_point::max())
+        : previous_(ThreadRun()), handle_(BeginRun(deadline)) {}
+    ~RunScope() {
+      EndRun(handle_);
+      ThreadRun() = std::move(previous_);
+    }
+
+    RunScope(const RunScope&) = delete;
+    RunScope& operator=(const RunScope&) = delete;
+
+    Handle handle() const { return handle_; }
+
+   private:
+    std::shared_ptr<const Run> previous_;
+    Handle handle_;
+  };
+
+  // Makes the token the one of this thread until the end of its life, by default the token of the run of the
+  // thread for a Compute.
+  class Scope {
+   public:
+    Scope() : Scope(Token{ThreadRun()}) {}
+    explicit Scope(const Token& token) : previous_(CurrentRef()) { CurrentRef() = token; }
+    ~Scope() { CurrentRef() = std::move(previous_); }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    Token previous_;
+  };
+
+ private:
+  static std::atomic<Handle>& NextHandle() {
+    static std::atomic<Handle> next{1};
+    return next;
+  }
+
+  static std::mutex& RunsMutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  static std::unordered_map<Handle, std::shared_ptr<Run>>& Runs() {
+    static std::unordered_map<Handle, std::shared_ptr<Run>> runs;
+    return runs;
+  }
+
+  static std::shared_ptr<const Run>& ThreadRun() {
+    thread_local std::shared_ptr<const Run> run;
+    return run;
+  }
+
+  static Token& CurrentRef() {
+    thread_local Token current;
+    return current;
+  }
+};
+
+}  // namespace ort_extensions
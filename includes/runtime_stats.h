@@ -0,0 +1,192 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace ort_extensions {
+
+// The statistics of the process, like the hits of the caches, the bytes they hold and the latencies of the ops,
+// which GetRuntimeStatistics reports. A counter or a histogram is registered once by its name, usually into a
+// static reference of its call site, and is then updated without a lock: each thread adds to one of kStatSlots
+// slots on their own cache lines, which are summed when they're read.
+constexpr size_t kStatSlots = 16;
+
+inline size_t StatSlot() {
+  static std::atomic<size_t> next_slot{0};
+  thread_local const size_t slot = next_slot.fetch_add(1, std::memory_order_relaxed) % kStatSlots;
+  return slot;
+}
+
+// A count of events, or a level like the bytes of a cache, to which the changes are added.
+class StatCounter {
+ public:
+  void Add(int64_t delta = 1) { slots_[StatSlot()].value.fetch_add(delta, std::memory_order_relaxed); }
+
+  int64_t Value() const {
+    int64_t sum = 0;
+    for (const auto& slot : slots_) {
+      sum += slot.value.load(std::memory_order_relaxed);
+    }
+    return sum;
+  }
+
+ private:
+  struct alignas(64) Slot {
+    std::atomic<int64_t> value{0};
+  };
+
+  std::array<Slot, kStatSlots> slots_;
+};
+
+// The latencies of the calls of an op, by the powers of 2 of their microseconds: bucket 0 counts the calls under
+// 1 us, bucket i those in [2^(i-1), 2^i) us, and the last one all the longer ones.
+class LatencyHistogram {
+ public:
+  static constexpr size_t kBuckets = 32;
+
+  struct Snapshot {
+    uint64_t count{};
+    uint64_t total_us{};
+    std::array<uint64_t, kBuckets> buckets{};
+  };
+
+  void Record(std::chrono::steady_clock::duration latency) {
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    const uint64_t value = us > 0 ? static_cast<uint64_t>(us) : 0;
+    size_t bucket = 0;
+    for (uint64_t v = value; v != 0 && bucket + 1 < kBuckets; v >>= 1) {
+      ++bucket;
+    }
+
+    Slot& slot = slots_[StatSlot()];
+    slot.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    slot.total_us.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  Snapshot Read() const {
+    Snapshot snapshot;
+    for (const auto& slot : slots_) {
+      for (size_t i = 0; i < kBuckets; ++i) {
+        const uint64_t n = slot.buckets[i].load(std::memory_order_relaxed);
+        snapshot.buckets[i] += n;
+        snapshot.count += n;
+      }
+      snapshot.total_us += slot.total_us.load(std::memory_order_relaxed);
+    }
+    return snapshot;
+  }
+
+ private:
+  struct alignas(64) Slot {
+    std::array<std::atomic<uint64_t>, kBuckets> buckets{};
+    std::atomic<uint64_t> total_us{0};
+  };
+
+  std::array<Slot, kStatSlots> slots_;
+};
+
+// Records the time from its creation to its destruction into a histogram.
+class LatencyTimer {
+ public:
+  explicit LatencyTimer(LatencyHistogram& histogram)
+      : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+
+  ~LatencyTimer() { histogram_.Record(std::chrono::steady_clock::now() - start_); }
+
+  LatencyTimer(const LatencyTimer&) = delete;
+  LatencyTimer& operator=(const LatencyTimer&) = delete;
+
+ private:
+  LatencyHistogram& histogram_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+class RuntimeStats {
+ public:
+  // The registry is never destroyed, so the kernels and the caches released at the exit can still update it.
+  static RuntimeStats& Instance() {
+    static RuntimeStats* stats = new RuntimeStats();
+    return *stats;
+  }
+
+  // The counter of the name, like "bpe_cache.hits", which lives as long as the process.
+  StatCounter& Counter(std::string_view name) { return Get(counters_, name); }
+
+  // The latencies of the calls of the op of the name.
+  LatencyHistogram& Latency(std::string_view op_name) { return Get(latencies_, op_name); }
+
+  // Writes all the statistics as a JSON object of "counters", the values by their names, and "latencies", the
+  // "count", "total_us" and "buckets" of the histogram of each op.
+  std::string ToJson() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string json = "{\"counters\":{";
+    const char* separator = "";
+    for (const auto& [name, counter] : counters_) {
+      json.append(separator).append(Quote(name)).append(":").append(std::to_string(counter->Value()));
+      separator = ",";
+    }
+
+    json.append("},\"latencies\":{");
+    separator = "";
+    for (const auto& [name, histogram] : latencies_) {
+      const LatencyHistogram::Snapshot snapshot = histogram->Read();
+      json.append(separator).append(Quote(name)).append(":{\"count\":").append(std::to_string(snapshot.count));
+      json.append(",\"total_us\":").append(std::to_string(snapshot.total_us)).append(",\"buckets\":[");
+      // the empty buckets after the longest call are left out
+      size_t used = LatencyHistogram::kBuckets;
+      while (used > 0 && snapshot.buckets[used - 1] == 0) {
+        --used;
+      }
+      for (size_t i = 0; i < used; ++i) {
+        json.append(i == 0 ? "" : ",").append(std::to_string(snapshot.buckets[i]));
+      }
+      json.append("]}");
+      separator = ",";
+    }
+
+    json.append("}}");
+    return json;
+  }
+
+ private:
+  RuntimeStats() = default;
+
+  template <typename T>
+  T& Get(std::map<std::string, std::unique_ptr<T>, std::less<>>& items, std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = items.find(name);
+    if (it == items.end()) {
+      it = items.emplace(std::string(name), std::make_unique<T>()).first;
+    }
+    return *it->second;
+  }
+
+  static std::string Quote(std::string_view name) {
+    std::string quoted = "\"";
+    for (char c : name) {
+      if (c == '"' || c == '\\') {
+        quoted.push_back('\\');
+      }
+      quoted.push_back(c);
+    }
+    quoted.push_back('"');
+    return quoted;
+  }
+
+  mutable std::mutex mutex_;
+  std::map<std::string, std::unique_ptr<StatCounter>, std::less<>> counters_;
+  std::map<std::string, std::unique_ptr<LatencyHistogram>, std::less<>> latencies_;
+};
+
+}  // namespace ort_extensions
@@ -0,0 +1,185 @@
+package ai.onnxruntime.extensions;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.IntBuffer;
+import java.nio.LongBuffer;
+
+/**
+ * A GPT2Tokenizer, BertTokenizer or TrieTokenizer of the library without an ORT session, over the C API of
+ * ortx_tokenizer.h.
+ *
+ * <p>The text and the ids are direct buffers, which the native code reads and writes in place, so a call copies
+ * neither Java strings nor arrays. The bytes of a text are the remaining bytes of its buffer, and the ids are
+ * written from the position of theirs. The positions of the buffers aren't changed. The int and long buffers are in
+ * the native byte order, like the views of {@code ByteBuffer.allocateDirect(n).order(ByteOrder.nativeOrder())}, since
+ * the native code reads their values as they are in memory.
+ *
+ * <p>A tokenizer can be used by many threads at once, but not after it's closed.
+ */
+public final class OrtxTokenizer implements AutoCloseable {
+
+    static {
+        // loads the JNI library
+        OrtxLibrary.getExtractedLibraryPath();
+    }
+
+    private long handle;
+
+    private OrtxTokenizer(long handle) {
+        this.handle = handle;
+    }
+
+    /**
+     * Creates the tokenizer of the kind from the files of its assets, which are mapped instead of being read.
+     *
+     * @param kind "GPT2Tokenizer", "BertTokenizer" or "TrieTokenizer".
+     * @param vocabPath the path of the vocab, or of the vocab_file of BERT.
+     * @param mergesPath the path of the merges of GPT2, or null.
+     * @return the tokenizer, which must be closed.
+     */
+    public static OrtxTokenizer fromFiles(String kind, String vocabPath, String mergesPath) {
+        return new OrtxTokenizer(createFromFiles(kind, vocabPath, mergesPath));
+    }
+
+    /**
+     * Creates the tokenizer of the kind from the remaining bytes of the direct buffers of its assets, which it copies.
+     *
+     * @param kind "GPT2Tokenizer", "BertTokenizer" or "TrieTokenizer".
+     * @param vocab the vocab, or the vocab_file of BERT.
+     * @param merges the merges of GPT2, or null.
+     * @return the tokenizer, which must be closed.
+     */
+    public static OrtxTokenizer fromBytes(String kind, ByteBuffer vocab, ByteBuffer merges) {
+        checkDirect(vocab);
+        if (merges != null) {
+            checkDirect(merges);
+        }
+        return new OrtxTokenizer(createFromBytes(kind, vocab, vocab.position(), vocab.remaining(), merges,
+                merges == null ? 0 : merges.position(), merges == null ? 0 : merges.remaining()));
+    }
+
+    /**
+     * Encodes the UTF-8 text into the ids.
+     *
+     * @param text the direct buffer of the text.
+     * @param ids the direct buffer of the ids.
+     * @return the number of the ids of the text. They are only written if they fit in the remaining ids, otherwise
+     *     the call can be repeated with a buffer of this many.
+     */
+    public int encode(ByteBuffer text, LongBuffer ids) {
+        checkDirect(text);
+        checkDirect(ids);
+        return encodeLong(checkHandle(), text, text.position(), text.remaining(), ids, ids.position(), ids.remaining());
+    }
+
+    /**
+     * Encodes the UTF-8 text into the ids as encode(ByteBuffer, LongBuffer), narrowed to 32 bits.
+     *
+     * @param text the direct buffer of the text.
+     * @param ids the direct buffer of the ids.
+     * @return the number of the ids of the text, which are only written if they fit in the remaining ids.
+     */
+    public int encode(ByteBuffer text, IntBuffer ids) {
+        checkDirect(text);
+        checkDirect(ids);
+        return encodeInt(checkHandle(), text, text.position(), text.remaining(), ids, ids.position(), ids.remaining());
+    }
+
+    /**
+     * Encodes a batch of the UTF-8 texts, the bytes of text i from textOffsets[i] to textOffsets[i + 1] of the text
+     * buffer, into the ids, those of text i from rowOffsets[i] to rowOffsets[i + 1] of the ids buffer.
+     *
+     * @param text the direct buffer of the texts, whose offsets are relative to its position.
+     * @param textOffsets the direct buffer of the count + 1 offsets of the texts.
+     * @param ids the direct buffer of the ids, whose offsets are relative to its position.
+     * @param rowOffsets the direct buffer of the count + 1 offsets of the ids of the texts, which is always filled.
+     * @return the number of all the ids. The ids of a text are only written while they fit in the remaining ids.
+     */
+    public long encodeBatch(ByteBuffer text, IntBuffer textOffsets, LongBuffer ids, LongBuffer rowOffsets) {
+        checkDirect(text);
+        checkDirect(textOffsets);
+        checkDirect(ids);
+        checkDirect(rowOffsets);
+        int count = textOffsets.remaining() - 1;
+        if (count < 0 || rowOffsets.remaining() < count + 1) {
+            throw new IllegalArgumentException("The offsets need count + 1 entries.");
+        }
+        return encodeBatch(checkHandle(), text, text.position(), text.remaining(), textOffsets,
+                textOffsets.position(), count, ids, ids.position(), ids.remaining(), rowOffsets,
+                rowOffsets.position());
+    }
+
+    /**
+     * Decodes the remaining ids into the UTF-8 text.
+     *
+     * @param ids the direct buffer of the ids.
+     * @param text the direct buffer of the text.
+     * @return the number of the bytes of the text. They are only written if they fit in the remaining text, otherwise
+     *     the call can be repeated with a buffer of this many.
+     */
+    public int decode(LongBuffer ids, ByteBuffer text) {
+        checkDirect(ids);
+        checkDirect(text);
+        return decodeLong(checkHandle(), ids, ids.position(), ids.remaining(), text, text.position(), text.remaining());
+    }
+
+    @Override
+    public synchronized void close() {
+        if (handle != 0) {
+            release(handle);
+            handle = 0;
+        }
+    }
+
+    private long checkHandle() {
+        long h = handle;
+        if (h == 0) {
+            throw new IllegalStateException("The tokenizer is closed.");
+        }
+        return h;
+    }
+
+    private static void checkDirect(java.nio.Buffer buffer) {
+        if (buffer == null || !buffer.isDirect()) {
+            throw new IllegalArgumentException("The buffer should be a direct buffer.");
+        }
+    }
+
+    private static void checkDirect(IntBuffer buffer) {
+        checkDirect((java.nio.Buffer) buffer);
+        checkNativeOrder(buffer.order());
+    }
+
+    private static void checkDirect(LongBuffer buffer) {
+        checkDirect((java.nio.Buffer) buffer);
+        checkNativeOrder(buffer.order());
+    }
+
+    // the views of a ByteBuffer are big-endian unless its order was set, which the native code would misread
+    private static void checkNativeOrder(ByteOrder order) {
+        if (order != ByteOrder.nativeOrder()) {
+            throw new IllegalArgumentException("The buffer should be in the native byte order.");
+        }
+    }
+
+    private static native long createFromFiles(String kind, String vocabPath, String mergesPath);
+
+    private static native long createFromBytes(String kind, ByteBuffer vocab, int vocabOffset, int vocabSize,
+            ByteBuffer merges, int mergesOffset, int mergesSize);
+
+    private static native void release(long handle);
+
+    private static native int encodeLong(long handle, ByteBuffer text, int textOffset, int textSize, LongBuffer ids,
+            int idsOffset, int idsCapacity);
+
+    private static native int encodeInt(long handle, ByteBuffer text, int textOffset, int textSize, IntBuffer ids,
+            int idsOffset, int idsCapacity);
+
+    private static native long encodeBatch(long handle, ByteBuffer text, int textOffset, int textSize,
+            IntBuffer textOffsets, int textOffsetsOffset, int count, LongBuffer ids, int idsOffset, int idsCapacity,
+            LongBuffer rowOffsets, int rowOffsetsOffset);
+
+    private static native int decodeLong(long handle, LongBuffer ids, int idsOffset, int idsCount, ByteBuffer text,
+            int textOffset, int textCapacity);
+}
@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ai_onnxruntime_extensions_OrtxTokenizer.h"
+#include "ortx_tokenizer.h"
+
+// The buffers are the direct buffers of Java, which are read and written in place, with the offsets and the
+// sizes of their elements checked by the Java side.
+
+static void ThrowError(JNIEnv* env, const char* message) {
+  jclass cls = (*env)->FindClass(env, "java/lang/RuntimeException");
+  if (cls != NULL) {
+    (*env)->ThrowNew(env, cls, message);
+  }
+}
+
+static int CheckStatus(JNIEnv* env, int status) {
+  if (status != 0) {
+    char message[1024];
+    snprintf(message, sizeof(message), "[OrtxTokenizer] error %d: %s", status, OrtxGetLastErrorMessage());
+    ThrowError(env, message);
+  }
+  return status == 0;
+}
+
+static void* BufferAt(JNIEnv* env, jobject buffer, jint offset, size_t element_size) {
+  char* address = (char*)(*env)->GetDirectBufferAddress(env, buffer);
+  if (address == NULL) {
+    ThrowError(env, "[OrtxTokenizer] the buffer isn't a direct buffer.");
+    return NULL;
+  }
+  return address + (size_t)offset * element_size;
+}
+
+static jlong CreateTokenizer(JNIEnv* env, jstring kind, const char* vocab_path, const char* merges_path,
+                             OrtxStringSpan vocab, OrtxStringSpan merges) {
+  const char* kind_chars = (*env)->GetStringUTFChars(env, kind, NULL);
+  if (kind_chars == NULL) {
+    return 0;
+  }
+
+  OrtxTokenizer* tokenizer = NULL;
+  int status = vocab_path != NULL ? OrtxCreateTokenizerFromFiles(kind_chars, vocab_path, merges_path, &tokenizer)
+                                  : OrtxCreateTokenizer(kind_chars, vocab, merges, &tokenizer);
+  (*env)->ReleaseStringUTFChars(env, kind, kind_chars);
+  return CheckStatus(env, status) ? (jlong)(intptr_t)tokenizer : 0;
+}
+
+JNIEXPORT jlong JNICALL Java_ai_onnxruntime_extensions_OrtxTokenizer_createFromFiles(JNIEnv* env, jclass cls,
+                                                                                     jstring kind, jstring vocab_path,
+                                                                                     jstring merges_path) {
+  OrtxStringSpan empty = {NULL, 0};
+  jlong handle = 0;
+  const char* vocab_chars = (*env)->GetStringUTFChars(env, vocab_path, NULL);
+  const char* merges_chars = merges_path != NULL ? (*env)->GetStringUTFChars(env, merges_path, NULL) : NULL;
+  if (vocab_chars != NULL && (merges_path == NULL || merges_chars != NULL)) {
+    handle = CreateTokenizer(env, kind, vocab_chars, merges_chars, empty, empty);
+  }
+  if (vocab_chars != NULL) {
+    (*env)->ReleaseStringUTFChars(env, vocab_path, vocab_chars);
+  }
+  if (merges_chars != NULL) {
+    (*env)->ReleaseStringUTFChars(env, merges_path, merges_chars);
+  }
+  return handle;
+}
+
+JNIEXPORT jlong JNICALL Java_ai_onnxruntime_extensions_OrtxTokenizer_createFromBytes(
+    JNIEnv* env, jclass cls, jstring kind, jobject vocab, jint vocab_offset, jint vocab_size, jobject merges,
+    jint merges_offset, jint merges_size) {
+  OrtxStringSpan vocab_span = {(const char*)BufferAt(env, vocab, vocab_offset, 1), (size_t)vocab_size};
+  OrtxStringSpan merges_span = {NULL, 0};
+  if (vocab_span.data == NULL) {
+    return 0;
+  }
+  if (merges != NULL) {
+    merges_span.data = (const char*)BufferAt(env, merges, merges_offset, 1);
+    merges_span.size = (size_t)merges_size;
+    if (merges_span.data == NULL) {
+      return 0;
+    }
+  }
+  return CreateTokenizer(env, kind, NULL, NULL, vocab_span, merges_span);
+}
+
+JNIEXPORT void JNICALL Java_ai_onnxruntime_extensions_OrtxTokenizer_release(JNIEnv* env, jclass cls, jlong handle) {
+  OrtxReleaseTokenizer((OrtxTokenizer*)(intptr_t)handle);
+}
+
+JNIEXPORT jint JNICALL Java_ai_onnxruntime_extensions_OrtxTokenizer_encodeLong(JNIEnv* env, jclass cls,
+                                                                               jlong handle, jobject text,
+                                                                               jint text_offset, jint text_size,
+                                                                               jobject ids, jint ids_offset,
+                                                                               jint ids_capacity) {
+  OrtxStringSpan span = {(const char*)BufferAt(env, text, text_offset, 1), (size_t)text_size};
+  int64_t* id_data = (int64_t*)BufferAt(env, ids, ids_offset, sizeof(int64_t));
+  size_t row_offsets[2] = {0, 0};
+  if (span.data == NULL || id_data == NULL) {
+    return 0;
+  }
+
+  // jlong is int64_t, so the ids are written into the buffer directly
+  int status = OrtxEncodeBatch((const OrtxTokenizer*)(intptr_t)handle, &span, 1, id_data, (size_t)ids_capacity,
+                               row_offsets);
+  return CheckStatus(env, status) ? (jint)row_offsets[1] : 0;
+}
+
+JNIEXPORT jint JNICALL Java_ai_onnxruntime_extensions_OrtxTokenizer_encodeInt(JNIEnv* env, jclass cls,
+                                                                              jlong handle, jobject text,
+                                                                              jint text_offset, jint text_size,
+                                                                              jobject ids, jint ids_offset,
+                                                                              jint ids_capacity) {
+  OrtxStringSpan span = {(const char*)BufferAt(env, text, text_offset, 1), (size_t)text_size};
+  int32_t* id_data = (int32_t*)BufferAt(env, ids, ids_offset, sizeof(int32_t));
+  size_t row_offsets[2] = {0, 0};
+  if (span.data == NULL || id_data == NULL) {
+    return 0;
+  }
+
+  // the ids of a keystroke fit on the stack, longer texts are encoded into the heap before they're narrowed
+  int64_t stack_ids[256];
+  int64_t* wide_ids = (size_t)ids_capacity <= sizeof(stack_ids) / sizeof(stack_ids[0])
+                          ? stack_ids
+                          : (int64_t*)malloc((size_t)ids_capacity * sizeof(int64_t));
+  if (wide_ids == NULL) {
+    ThrowError(env, "[OrtxTokenizer] out of memory.");
+    return 0;
+  }
+
+  int status = OrtxEncodeBatch((const OrtxTokenizer*)(intptr_t)handle, &span, 1, wide_ids, (size_t)ids_capacity,
+                               row_offsets);
+  if (status == 0 && row_offsets[1] <= (size_t)ids_capacity) {
+    for (size_t i = 0; i < row_offsets[1]; ++i) {
+      id_data[i] = (int32_t)wide_ids[i];
+    }
+  }
+  if (wide_ids != stack_ids) {
+    free(wide_ids);
+  }
+  return CheckStatus(env, status) ? (jint)row_offsets[1] : 0;
+}
+
+JNIEXPORT jlong JNICALL Java_ai_onnxruntime_extensions_OrtxTokenizer_encodeBatch(
+    JNIEnv* env, jclass cls, jlong handle, jobject text, jint text_offset, jint text_size, jobject text_offsets,
+    jint text_offsets_offset, jint count, jobject ids, jint ids_offset, jint ids_capacity, jobject row_offsets,
+    jint row_offsets_offset) {
+  const char* text_data = (const char*)BufferAt(env, text, text_offset, 1);
+  const int32_t* offsets = (const int32_t*)BufferAt(env, text_offsets, text_offsets_offset, sizeof(int32_t));
+  int64_t* id_data = (int64_t*)BufferAt(env, ids, ids_offset, sizeof(int64_t));
+  int64_t* row_data = (int64_t*)BufferAt(env, row_offsets, row_offsets_offset, sizeof(int64_t));
+  if (text_data == NULL || offsets == NULL || id_data == NULL || row_data == NULL) {
+    return 0;
+  }
+
+  OrtxStringSpan* spans = (OrtxStringSpan*)malloc(((size_t)count + 1) * sizeof(OrtxStringSpan));
+  size_t* rows = (size_t*)malloc(((size_t)count + 1) * sizeof(size_t));
+  jlong total = 0;
+  if (spans == NULL || rows == NULL) {
+    ThrowError(env, "[OrtxTokenizer] out of memory.");
+  } else {
+    int valid = 1;
+    for (jint i = 0; i < count && valid; ++i) {
+      valid = offsets[i] >= 0 && offsets[i] <= offsets[i + 1] && offsets[i + 1] <= text_size;
+      spans[i].data = text_data + offsets[i];
+      spans[i].size = (size_t)(offsets[i + 1] - offsets[i]);
+    }
+
+    if (!valid) {
+      ThrowError(env, "[OrtxTokenizer] the text offsets should be ascending and within the text.");
+    } else if (CheckStatus(env, OrtxEncodeBatch((const OrtxTokenizer*)(intptr_t)handle, spans, (size_t)count,
+                                                 id_data, (size_t)ids_capacity, rows))) {
+      for (jint i = 0; i <= count; ++i) {
+        row_data[i] = (int64_t)rows[i];
+      }
+      total = (jlong)rows[count];
+    }
+  }
+
+  free(spans);
+  free(rows);
+  return total;
+}
+
+JNIEXPORT jint JNICALL Java_ai_onnxruntime_extensions_OrtxTokenizer_decodeLong(JNIEnv* env, jclass cls,
+                                                                               jlong handle, jobject ids,
+                                                                               jint ids_offset, jint ids_count,
+                                                                               jobject text, jint text_offset,
+                                                                               jint text_capacity) {
+  const int64_t* id_data = (const int64_t*)BufferAt(env, ids, ids_offset, sizeof(int64_t));
+  char* text_data = (char*)BufferAt(env, text, text_offset, 1);
+  size_t id_offsets[2] = {0, (size_t)ids_count};
+  size_t text_offsets[2] = {0, 0};
+  if (id_data == NULL || text_data == NULL) {
+    return 0;
+  }
+
+  int status = OrtxDecodeBatch((const OrtxTokenizer*)(intptr_t)handle, id_data, id_offsets, 1, text_data,
+                               (size_t)text_capacity, text_offsets);
+  return CheckStatus(env, status) ? (jint)text_offsets[1] : 0;
+}
@@ -1,5 +1,10 @@
 package ai.onnxruntime.extensions;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.IntBuffer;
+import java.nio.LongBuffer;
+import java.nio.charset.StandardCharsets;
 import org.junit.jupiter.api.Assertions;
 import org.junit.jupiter.api.Test;
 
@@ -10,4 +15,58 @@ public class OrtxTest {
         long handle = OrtxLibrary.getNativeExtensionOperatorRegister();
         Assertions.assertNotEquals(handle, Long.valueOf(0));
     }
+
+    private static ByteBuffer directUtf8(String text) {
+        byte[] bytes = text.getBytes(StandardCharsets.UTF_8);
+        ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+        buffer.put(bytes).flip();
+        return buffer;
+    }
+
+    @Test
+    void trieTokenizerTest() {
+        ByteBuffer vocab = directUtf8("1 'a' 1\n2 'b' 1\n3 'ab' 2\n4 'abc' 3\n");
+        try (OrtxTokenizer tokenizer = OrtxTokenizer.fromBytes("TrieTokenizer", vocab, null)) {
+            LongBuffer ids = ByteBuffer.allocateDirect(8 * 8).order(ByteOrder.nativeOrder()).asLongBuffer();
+            Assertions.assertEquals(2, tokenizer.encode(directUtf8("abcab"), ids));
+            Assertions.assertEquals(4, ids.get(0));
+            Assertions.assertEquals(3, ids.get(1));
+
+            IntBuffer intIds = ByteBuffer.allocateDirect(4 * 8).order(ByteOrder.nativeOrder()).asIntBuffer();
+            Assertions.assertEquals(3, tokenizer.encode(directUtf8("aba"), intIds));
+            Assertions.assertEquals(3, intIds.get(0));
+            Assertions.assertEquals(1, intIds.get(2));
+
+            // a batch of "ab" and "b"
+            IntBuffer textOffsets = ByteBuffer.allocateDirect(4 * 3).order(ByteOrder.nativeOrder()).asIntBuffer();
+            textOffsets.put(0, 0).put(1, 2).put(2, 3);
+            LongBuffer rowOffsets = ByteBuffer.allocateDirect(8 * 3).order(ByteOrder.nativeOrder()).asLongBuffer();
+            Assertions.assertEquals(2, tokenizer.encodeBatch(directUtf8("abb"), textOffsets, ids, rowOffsets));
+            Assertions.assertEquals(1, rowOffsets.get(1));
+            Assertions.assertEquals(2, ids.get(1));
+
+            ids.put(0, 4).put(1, 3).limit(2);
+            ByteBuffer text = ByteBuffer.allocateDirect(16);
+            int size = tokenizer.decode(ids, text);
+            byte[] bytes = new byte[size];
+            text.get(bytes);
+            Assertions.assertEquals("abcab", new String(bytes, StandardCharsets.UTF_8));
+
+            Assertions.assertThrows(RuntimeException.class, () -> tokenizer.encode(directUtf8("d"), ids));
+            Assertions.assertThrows(IllegalArgumentException.class,
+                    () -> tokenizer.encode(ByteBuffer.wrap(new byte[1]), ids));
+
+            // the view of a buffer without an order is big-endian, whatever the order of the host is
+            ByteOrder other = ByteOrder.nativeOrder() == ByteOrder.BIG_ENDIAN ? ByteOrder.LITTLE_ENDIAN
+                    : ByteOrder.BIG_ENDIAN;
+            LongBuffer otherIds = ByteBuffer.allocateDirect(8 * 8).order(other).asLongBuffer();
+            Assertions.assertThrows(IllegalArgumentException.class,
+                    () -> tokenizer.encode(directUtf8("abcab"), otherIds));
+            if (other == ByteOrder.BIG_ENDIAN) {
+                LongBuffer unorderedIds = ByteBuffer.allocateDirect(8 * 8).asLongBuffer();
+                Assertions.assertThrows(IllegalArgumentException.class,
+                        () -> tokenizer.encode(directUtf8("abcab"), unorderedIds));
+            }
+        }
+    }
 }
@@ -24,6 +24,8 @@ __all__ = [
     'make_onnx_model',
     'ONNXRuntimeError',
     'hash_64',
+    'get_runtime_stats',
+    'KernelRun',
     '__version__',
 ]
 
@@ -31,6 +33,7 @@ from ._version import __version__
 from ._ocos import get_library_path
 from ._ocos import Opdef, PyCustomOpDef
 from ._ocos import hash_64
+from ._ocos import get_runtime_stats, KernelRun
 from ._ocos import enable_py_op
 from ._ocos import expand_onnx_inputs
 from ._ocos import hook_model_op
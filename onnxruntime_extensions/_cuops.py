@@ -30,6 +30,15 @@ class CustomOp:
     def get_outputs(cls):
         return None
 
+    @classmethod
+    def get_outputs_of_attrs(cls, attrs):
+        """
+        The outputs of a node with the attributes, for the ops whose outputs depend on them
+        :param attrs: the dict attributes
+        :return: the outputs, which are get_outputs() by default
+        """
+        return cls.get_outputs()
+
     @classmethod
     def input_default_values(cls):
         return None
@@ -109,6 +118,20 @@ class BpeDecoder(CustomOp):
         return [cls.io_def('str', onnx_proto.TensorProto.STRING, None)]
 
 
+class BpeStreamingDecoder(CustomOp):
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def("ids", onnx.TensorProto.INT64, [None, None]),
+            cls.io_def("stream_ids", onnx.TensorProto.INT64, [None]),
+            cls.io_def("finished", onnx.TensorProto.BOOL, [None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [cls.io_def('text', onnx_proto.TensorProto.STRING, [None])]
+
+
 class VectorToString(CustomOp):
 
     @classmethod
@@ -157,6 +180,49 @@ class StringMapping(CustomOp):
         return attr_data
 
 
+class StringMultiReplace(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [cls.io_def("input", onnx.TensorProto.STRING, [])]
+
+    @classmethod
+    def get_outputs(cls):
+        return [cls.io_def('output', onnx_proto.TensorProto.STRING, [])]
+
+    @classmethod
+    def serialize_attr(cls, attrs):
+        attr_data = {}
+        for k_, v_ in attrs.items():
+            if k_ == 'map' and isinstance(v_, dict):
+                attr_data[k_] = '\n'.join(k + "\t" + v for k, v in v_.items())
+            else:
+                attr_data[k_] = v_
+        return attr_data
+
+
+class StringNormalize(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [cls.io_def("input", onnx.TensorProto.STRING, [])]
+
+    @classmethod
+    def get_outputs(cls):
+        return [cls.io_def('output', onnx_proto.TensorProto.STRING, [])]
+
+
+class StringNormalizeSteps(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [cls.io_def("input", onnx.TensorProto.STRING, [])]
+
+    @classmethod
+    def get_outputs(cls):
+        return [cls.io_def('output', onnx_proto.TensorProto.STRING, [])]
+
+
 class MaskedFill(CustomOp):
 
     @classmethod
@@ -305,6 +371,55 @@ class BertTokenizerDecoder(CustomOp):
         return attrs_data
 
 
+class QuestionAnsweringSpans(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('context', onnx_proto.TensorProto.STRING, [None]),
+            cls.io_def('start_logits', onnx_proto.TensorProto.FLOAT, [None, None]),
+            cls.io_def('end_logits', onnx_proto.TensorProto.FLOAT, [None, None]),
+            cls.io_def('offset_mapping', onnx_proto.TensorProto.INT64, None),
+            cls.io_def('token_type_ids', onnx_proto.TensorProto.INT64, [None, None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('answers', onnx_proto.TensorProto.STRING, [None, None]),
+            cls.io_def('scores', onnx_proto.TensorProto.FLOAT, [None, None]),
+            cls.io_def('spans', onnx_proto.TensorProto.INT64, [None, None, 2])
+        ]
+
+
+class TokenClassificationSpans(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('logits', onnx_proto.TensorProto.FLOAT, None),
+            cls.io_def('offset_mapping', onnx_proto.TensorProto.INT64, None)
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('spans', onnx_proto.TensorProto.INT64, [None, 3]),
+            cls.io_def('types', onnx_proto.TensorProto.STRING, [None]),
+            cls.io_def('scores', onnx_proto.TensorProto.FLOAT, [None])
+        ]
+
+    @classmethod
+    def serialize_attr(cls, attrs):
+        attrs_data = {}
+        for k_, v_ in attrs.items():
+            if k_ == 'labels' and not isinstance(v_, str):
+                attrs_data[k_] = '\n'.join(v_)
+            else:
+                attrs_data[k_] = v_
+        return attrs_data
+
+
 class SentencepieceTokenizer(CustomOp):
 
     @classmethod
@@ -336,18 +451,29 @@ class SentencepieceTokenizer(CustomOp):
             cls.io_def('indices', onnx_proto.TensorProto.INT64, [None])
         ]
 
+    @classmethod
+    def get_outputs_of_attrs(cls, attrs):
+        # the tokens are padded into [batch, length] with the attention mask by padding_length
+        if 'padding_length' not in attrs:
+            return cls.get_outputs()
+        return [
+            cls.io_def('tokens', onnx_proto.TensorProto.INT32, [None, None]),
+            cls.io_def('indices', onnx_proto.TensorProto.INT64, [None]),
+            cls.io_def('attention_mask', onnx_proto.TensorProto.INT64, [None, None])
+        ]
+
 
 class SentencepieceDecoder(CustomOp):
 
     @classmethod
     def get_inputs(cls):
         return [
-            cls.io_def("ids", onnx.TensorProto.INT64, [None])
+            cls.io_def("ids", onnx.TensorProto.INT64, None)
         ]
 
     @classmethod
     def get_outputs(cls):
-        return [cls.io_def('str', onnx_proto.TensorProto.STRING, [None])]
+        return [cls.io_def('str', onnx_proto.TensorProto.STRING, None)]
 
 
 class TrieTokenizer(CustomOp):
@@ -370,18 +496,66 @@ class TrieDetokenizer(CustomOp):
         return [cls.io_def('str', onnx_proto.TensorProto.STRING, [None])]
 
 
+class EmbeddingPooling(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('hidden_states', onnx_proto.TensorProto.FLOAT, [None, None, None]),
+            cls.io_def('attention_mask', onnx_proto.TensorProto.INT64, [None, None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('embeddings', onnx_proto.TensorProto.FLOAT, [None, None])
+        ]
+
+
 class Inverse(CustomOp):
 
     @classmethod
     def get_inputs(cls):
         return [
-            cls.io_def('input', onnx_proto.TensorProto.FLOAT, [None, None])
+            cls.io_def('input', onnx_proto.TensorProto.FLOAT, None)
         ]
 
     @classmethod
     def get_outputs(cls):
         return [
-            cls.io_def('output', onnx_proto.TensorProto.FLOAT, [None, None])
+            cls.io_def('output', onnx_proto.TensorProto.FLOAT, None)
+        ]
+
+
+class LogitsProcessor(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('logits', onnx_proto.TensorProto.FLOAT, [None, None]),
+            cls.io_def('generated_ids', onnx_proto.TensorProto.INT64, [None, None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('processed_logits', onnx_proto.TensorProto.FLOAT, [None, None])
+        ]
+
+
+class LogitsSampler(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('logits', onnx_proto.TensorProto.FLOAT, [None, None]),
+            cls.io_def('previous_ids', onnx_proto.TensorProto.INT64, [None, None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('ids', onnx_proto.TensorProto.INT64, [None, 1])
         ]
 
 
@@ -432,6 +606,129 @@ class ImageDecoder(CustomOp):
         ]
 
 
+class DecodeImage(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('image', onnx_proto.TensorProto.UINT8, [None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('bgr_data', onnx_proto.TensorProto.UINT8, [None, None, None])
+        ]
+
+
+class DecodeImageBatch(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('images', onnx_proto.TensorProto.UINT8, [None]),
+            cls.io_def('offsets', onnx_proto.TensorProto.INT64, [None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('bgr_data', onnx_proto.TensorProto.UINT8, [None, None, None, None]),
+            cls.io_def('sizes', onnx_proto.TensorProto.INT64, [None, 2])
+        ]
+
+
+class EncodeImage(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('bgr_data', onnx_proto.TensorProto.UINT8, [None, None, 3])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('image', onnx_proto.TensorProto.UINT8, [None])
+        ]
+
+
+class ReadImageBatch(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('paths', onnx_proto.TensorProto.STRING, [None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('bgr_data', onnx_proto.TensorProto.UINT8, [None, None, None, None]),
+            cls.io_def('sizes', onnx_proto.TensorProto.INT64, [None, 2])
+        ]
+
+
+class DecodeImageNormalize(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('image', onnx_proto.TensorProto.UINT8, [None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('normalized_image', onnx_proto.TensorProto.FLOAT, [3, None, None])
+        ]
+
+
+class ImageNormalize(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('image', onnx_proto.TensorProto.UINT8, [None, None, None, 3])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('normalized_image', onnx_proto.TensorProto.FLOAT, [None, 3, None, None])
+        ]
+
+
+class FrameNormalize(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('plane0', onnx_proto.TensorProto.UINT8, [None, None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('normalized_image', onnx_proto.TensorProto.FLOAT, [3, None, None])
+        ]
+
+
+class DetectionPostProcess(CustomOp):
+
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('predictions', onnx_proto.TensorProto.FLOAT, [None, None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('boxes', onnx_proto.TensorProto.FLOAT, [None, 6])
+        ]
+
+
 class AudioDecoder(CustomOp):
     @classmethod
     def get_inputs(cls):
@@ -446,6 +743,97 @@ class AudioDecoder(CustomOp):
         ]
 
 
+class AudioDecoderInt16(CustomOp):
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('audio_stream', onnx_proto.TensorProto.UINT8, [1, None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('int16PCM', onnx_proto.TensorProto.INT16, [1, None])
+        ]
+
+
+class AudioDecoderBatch(CustomOp):
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('audio_streams', onnx_proto.TensorProto.UINT8, [None]),
+            cls.io_def('offsets', onnx_proto.TensorProto.INT64, [None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('floatPCM', onnx_proto.TensorProto.FLOAT, [None, None]),
+            cls.io_def('lengths', onnx_proto.TensorProto.INT64, [None])
+        ]
+
+
+class AudioChunk(CustomOp):
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('pcm', onnx_proto.TensorProto.FLOAT, [None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('chunks', onnx_proto.TensorProto.FLOAT, [None, None]),
+            cls.io_def('lengths', onnx_proto.TensorProto.INT64, [None])
+        ]
+
+
+class LogMelSpectrogram(CustomOp):
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('pcm', onnx_proto.TensorProto.FLOAT, [None, None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('log_mel', onnx_proto.TensorProto.FLOAT, [None, None, None])
+        ]
+
+
+class LogMelSpectrogramStreaming(CustomOp):
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('pcm', onnx_proto.TensorProto.FLOAT, [None]),
+            cls.io_def('state', onnx_proto.TensorProto.FLOAT, [None]),
+            cls.io_def('flush', onnx_proto.TensorProto.BOOL, [])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('log_mel', onnx_proto.TensorProto.FLOAT, [1, None, None]),
+            cls.io_def('state_out', onnx_proto.TensorProto.FLOAT, [None])
+        ]
+
+
+class VoiceActivityDetection(CustomOp):
+    @classmethod
+    def get_inputs(cls):
+        return [
+            cls.io_def('pcm', onnx_proto.TensorProto.FLOAT, [None])
+        ]
+
+    @classmethod
+    def get_outputs(cls):
+        return [
+            cls.io_def('segments', onnx_proto.TensorProto.INT64, [None, 2]),
+            cls.io_def('speech', onnx_proto.TensorProto.FLOAT, [1, None])
+        ]
+
+
 class StftNorm(CustomOp):
     @classmethod
     def get_inputs(cls):
@@ -503,7 +891,7 @@ class SingleOpGraph:
 
         op_type = op_class.op_type()
         inputs = op_class.get_inputs()
-        outputs = op_class.get_outputs()
+        outputs = op_class.get_outputs_of_attrs(new_kwargs)
         attrs = op_class.serialize_attr(new_kwargs)
         cuop = onnx.helper.make_node(op_type, [i_.name for i_ in inputs],
                                      [o_.name for o_ in outputs],
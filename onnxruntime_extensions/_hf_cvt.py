@@ -9,6 +9,7 @@ _hf_cvt.py: HuggingFace Tokenizer/Processor Converter
 
 import json
 import onnx
+import struct
 from numpy import array as nparray
 from functools import partial
 from collections import namedtuple, OrderedDict
@@ -17,21 +18,103 @@ from ._cuops import CustomOpConverter, SingleOpGraph
 from .util import read_file
 
 
+# The unk_token and the special tokens of the BPE tokenizer kernels, which a binary vocab is made for.
+_BPE_KERNEL_TOKENS = {
+    'GPT2Tokenizer': ('<|endoftext|>', '<|endoftext|>'),
+    'CLIPTokenizer': ('<|endoftext|>', '<|startoftext|>\n<|endoftext|>'),
+    'RobertaTokenizer': ('<unk>', '<s>\n</s>\n<pad>\n<mask>'),
+}
+
+
+def _bytes_to_unicode():
+    # the same table as the GPT-2 tokenizer, and VocabData::Load in C++
+    bs = list(range(ord("!"), ord("~") + 1)) + list(range(ord("\xa1"), ord("\xac") + 1)) + \
+        list(range(ord("\xae"), ord("\xff") + 1))
+    cs = bs[:]
+    n = 0
+    for b in range(256):
+        if b not in bs:
+            bs.append(b)
+            cs.append(256 + n)
+            n += 1
+    return dict(zip(bs, (chr(c) for c in cs)))
+
+
+def serialize_bpe_model(encoder, bpe_ranks, op_type='GPT2Tokenizer'):
+    """
+    Serializes the vocab and the merges of a BPE tokenizer into the binary model of the kernel, which is
+    loaded without parsing the JSON vocab and the merges text when a session is created. The result is
+    the 'vocab' attribute of the op, without any 'merges' attribute, and has to be made for the op_type.
+    The layout is documented at VocabData::LoadBinary in operators/tokenizer/bpe_tokenizer.hpp.
+    """
+    unk_token, special_tokens = _BPE_KERNEL_TOKENS[op_type]
+
+    def u32(value):
+        return struct.pack('<I', value & 0xFFFFFFFF)
+
+    def string(value):
+        data = value.encode('utf-8')
+        return u32(len(data)) + data
+
+    # the kernel parses the JSON object into a map ordered by the UTF-8 bytes of the tokens
+    vocab = {}
+    for token in sorted(encoder, key=lambda t_: t_.encode('utf-8')):
+        vocab[token] = int(encoder[token])
+    unk_id = vocab.get(unk_token, -1)
+    if unk_id < 0:
+        vocab[unk_token] = len(vocab)
+    byte_encoder = {b_: vocab[c_] for b_, c_ in _bytes_to_unicode().items()}
+
+    merges = {}
+    rank = 0
+    sorted_merges = sorted(bpe_ranks.items(), key=lambda kv_: kv_[1])
+    for line in ("{} {}".format(*pair_) for pair_, _ in sorted_merges):
+        line = line.replace('\r', '')
+        if not line or (line[0] == '#' and rank == 0):
+            continue
+        w1, w2 = line.split(' ', 1)
+        # a duplicated merge takes the last rank
+        merges[(vocab[w1], vocab[w2])] = (vocab[w1 + w2], rank)
+        rank += 1
+
+    for token in special_tokens.split():
+        if token not in vocab:
+            vocab[token] = len(vocab)
+
+    data = [b'OCXBPE01', string(unk_token), string(special_tokens), u32(unk_id)]
+    data.extend(u32(byte_encoder[b_]) for b_ in range(256))
+    data.append(u32(len(vocab)))
+    data.extend(u32(id_) + u32(len(token.encode('utf-8'))) for token, id_ in vocab.items())
+    data.extend(token.encode('utf-8') for token in vocab)
+    data.append(u32(len(merges)))
+    for (id1, id2), (id_, rank) in sorted(merges.items(), key=lambda kv_: kv_[1][1]):
+        data.append(u32(id1) + u32(id2) + u32(id_) + u32(rank))
+    return b''.join(data)
+
+
 class HFTokenizerConverter(CustomOpConverter):
     def __init__(self, tokenizer):
         self.tokenizer = tokenizer
 
+    @staticmethod
+    def _bpe_model_attrs(bpe_tokenizer, op_type, binary_vocab):
+        if binary_vocab:
+            return {'vocab': serialize_bpe_model(bpe_tokenizer.encoder, bpe_tokenizer.bpe_ranks, op_type)}
+
+        attrs = {'vocab': json.dumps(
+            bpe_tokenizer.encoder, separators=(',', ':'))}
+        sorted_merges = {v_: k_ for k_, v_ in bpe_tokenizer.bpe_ranks.items()}
+        attrs['merges'] = '\n'.join("{} {}".format(
+            *sorted_merges[n_]) for n_ in range(len(sorted_merges)))
+        return attrs
+
     def bpe_tokenizer(self, **kwargs):
         hf_gpt2_tokenizer = self.tokenizer
 
         if type(self.tokenizer).__name__.endswith('Fast'):
             raise ValueError('Please use the slow version of the tokenizer (ex: GPT2Tokenizer).')
 
-        attrs = {'vocab': json.dumps(
-            hf_gpt2_tokenizer.encoder, separators=(',', ':'))}
-        sorted_merges = {v_: k_ for k_, v_ in hf_gpt2_tokenizer.bpe_ranks.items()}
-        attrs['merges'] = '\n'.join("{} {}".format(
-            *sorted_merges[n_]) for n_ in range(len(sorted_merges)))
+        attrs = self._bpe_model_attrs(hf_gpt2_tokenizer, 'GPT2Tokenizer', kwargs.pop('binary_vocab', False))
         attrs.update(**kwargs)
         return attrs
 
@@ -80,12 +163,7 @@ class HFTokenizerConverter(CustomOpConverter):
         if type(self.tokenizer).__name__.endswith('Fast'):
             raise ValueError('Please use the slow version of the tokenizer (ex: CLIPTokenizer).')
 
-        attrs = {'vocab': json.dumps(
-            hf_clip_tokenizer.encoder, separators=(',', ':'))}
-        sorted_merges = {v_: k_ for k_,
-        v_ in hf_clip_tokenizer.bpe_ranks.items()}
-        attrs['merges'] = '\n'.join("{} {}".format(
-            *sorted_merges[n_]) for n_ in range(len(sorted_merges)))
+        attrs = self._bpe_model_attrs(hf_clip_tokenizer, 'CLIPTokenizer', kwargs.pop('binary_vocab', False))
         attrs.update(**kwargs)
         return attrs
 
@@ -95,12 +173,7 @@ class HFTokenizerConverter(CustomOpConverter):
         if type(self.tokenizer).__name__.endswith('Fast'):
             raise ValueError('Please use the slow version of the tokenizer (ex: RobertaTokenizer).')
 
-        attrs = {'vocab': json.dumps(
-            hf_roberta_tokenizer.encoder, separators=(',', ':'))}
-        sorted_merges = {v_: k_ for k_,
-        v_ in hf_roberta_tokenizer.bpe_ranks.items()}
-        attrs['merges'] = '\n'.join("{} {}".format(
-            *sorted_merges[n_]) for n_ in range(len(sorted_merges)))
+        attrs = self._bpe_model_attrs(hf_roberta_tokenizer, 'RobertaTokenizer', kwargs.pop('binary_vocab', False))
         attrs.update(**kwargs)
         return attrs
 
@@ -8,10 +8,13 @@ _ocos.py: PythonOp implementation
 
 import sys
 import copy
+import json
+import numpy
 import onnx
 from onnx import helper
 from ._extensions_pydll import (  # noqa
-    PyCustomOpDef, enable_py_op, add_custom_op, hash_64, default_opset_domain)
+    PyCustomOpDef, enable_py_op, add_custom_op, hash_64, default_opset_domain, runtime_statistics,
+    begin_kernel_run, end_kernel_run, cancel_kernel_run)
 
 
 def get_library_path():
@@ -23,6 +26,51 @@ def get_library_path():
     return mod.__file__
 
 
+def get_runtime_stats():
+    """
+    The runtime statistics of the custom operators of this process, since it started.
+    :return: A dict of 'counters', like the hits, misses and entries of the caches and the bytes of the scratch
+        arenas, by their names, to which the 'hit_rate' of each cache is added, and of the 'latencies' of each
+        operator, the 'count' and 'total_us' of its calls and the 'buckets' of the counts of their microseconds,
+        in which bucket i has the calls in [2^(i-1), 2^i) us.
+    """
+    stats = json.loads(runtime_statistics())
+    counters = stats['counters']
+    for name in [n for n in counters if n.endswith('.hits')]:
+        prefix = name[:-len('.hits')]
+        lookups = counters[name] + counters.get(prefix + '.misses', 0)
+        if lookups > 0:
+            counters[prefix + '.hit_rate'] = counters[name] / lookups
+    return stats
+
+
+class KernelRun:
+    """
+    A run of the custom operator kernels started on the calling thread within its `with` block, like the ones of the
+    runs of the sessions from it with the sequential execution. cancel() from another thread cancels the kernels of
+    this run only, which fail their runs at the next boundary of their loops, like the rows of a tokenizer or the
+    progress of a request of a cloud op, as they do once the deadline of the run passes. Set the terminate flag of
+    the RunOptions of the run too, which the kernels don't see, to stop the run.
+    :param timeout_ms: the milliseconds from the start of the block to the deadline, or None for none.
+    """
+
+    def __init__(self, timeout_ms=None):
+        self._timeout_ms = -1 if timeout_ms is None else int(timeout_ms)
+        self._handle = None
+
+    def __enter__(self):
+        self._handle = begin_kernel_run(self._timeout_ms)
+        return self
+
+    def __exit__(self, *args):
+        end_kernel_run(self._handle)
+        self._handle = None
+
+    def cancel(self):
+        """Cancel the kernels of the run, and return False if its block has ended."""
+        return self._handle is not None and cancel_kernel_run(self._handle)
+
+
 class Opdef:
 
     _odlist = {}
@@ -30,6 +78,7 @@ class Opdef:
     def __init__(self, op_type, func):
         self.op_type = op_type
         self.body = func
+        self.output_shapes = None
         self._id = id(self)
 
     @staticmethod
@@ -67,6 +116,9 @@ class Opdef:
         elif isinstance(attrs, (list, tuple)):
                 attrs = {k: PyCustomOpDef.dt_string for k in attrs}
         opdef._nativedef.attrs = attrs
+        # a function of the inputs which returns the shapes of the outputs, so the outputs are allocated before the
+        # call, and passed as `out`, a tuple of them for several outputs, for the function to write into
+        opdef.output_shapes = kwargs.get('output_shapes', None)
         add_custom_op(opdef._nativedef)
         return opdef
 
@@ -88,23 +140,33 @@ class Opdef:
         return res
 
 
-def _on_pyop_invocation(k_id, feed, attributes):
+def _on_pyop_invocation(k_id, feed, attributes, allocator):
     if k_id not in Opdef._odlist:
         raise RuntimeError(
             "Unable to find function id={}. "
             "Did you decorate the operator with @onnx_op?.".format(k_id))
     op_ = Opdef._odlist[k_id]
-    rv = op_.body(*feed, **op_.cast_attributes(attributes))
-    if isinstance(rv, tuple):
-        # Multiple outputs.
+    # the numeric inputs are read-only views of the tensors, which are only valid during the call
+    if op_.output_shapes is not None:
+        shapes = op_.output_shapes(*feed)
+        outputs = tuple(allocator(i, [int(d) for d in shape]) for i, shape in enumerate(shapes))
+        op_.body(*feed, out=outputs[0] if len(outputs) == 1 else outputs, **op_.cast_attributes(attributes))
         res = []
-        for r in rv:
-            res.append(r.shape)
-            res.append(r.flatten().tolist())
-        res = tuple(res)
-    else:
-        res = (rv.shape, rv.flatten().tolist())
-    return (k_id, ) + res
+        for o in outputs:
+            res.append(o.shape)
+            res.append(None)
+        return (k_id, ) + tuple(res)
+
+    rv = op_.body(*feed, **op_.cast_attributes(attributes))
+    if not isinstance(rv, tuple):
+        rv = (rv, )
+    res = []
+    for r in rv:
+        r = numpy.asarray(r)
+        res.append(r.shape)
+        # the numeric arrays are copied into the outputs as they are, and only the strings are converted
+        res.append(r.flatten().tolist() if r.dtype.kind in 'OSU' else r)
+    return (k_id, ) + tuple(res)
 
 
 def _ensure_opset_domain(model):
@@ -179,7 +241,11 @@ def hook_model_op(model, node_name, hook_func, input_types):
     del hkd_model.graph.node[:]
     hkd_model.graph.node.extend(repacked)
 
-    Opdef.create(hook_func, op_type=optype_name, inputs=input_types, outputs=input_types)
+    def _hook(*inputs):
+        # the inputs are views of the tensors of the call, which a hook may keep for the diagnosis
+        return hook_func(*[numpy.copy(x) for x in inputs])
+
+    Opdef.create(_hook, op_type=optype_name, inputs=input_types, outputs=input_types)
     return _ensure_opset_domain(hkd_model)
 
 
@@ -0,0 +1,245 @@
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+
+"""
+benchmark_pipelines.py: the end-to-end latency of the pre/post processing models under onnxruntime.
+
+It runs the complete models, like those of add_pre_post_processing_to_model.py and gen_processing_models (the
+GPT-2 tokenizer and decoder, the Whisper audio decoder, the CLIP image processor), for every combination of the
+intra/inter-op threads and the batch sizes, and reports the p50/p95/p99 latency, the throughput and the peak RSS
+of each combination as JSON, so the results of the releases can be compared.
+
+    python -m onnxruntime_extensions.tools.benchmark_pipelines gpt2_pre.onnx clip_pre.onnx \
+        --image test/data/pineapple.jpg --batch-sizes 1 8 --intra-op-threads 1 4 --output results.json
+
+The inputs are made from the metadata of the model: the strings are the lines of --text-file, the 1-D uint8
+inputs are the bytes of --image or --audio by the name of the input, the integers are random ids below --max-id
+and the floats are random. The leading dynamic dimension of an input is the batch size, the encoded bytes of an
+image or an audio file are a single stream.
+"""
+
+import argparse
+import json
+import multiprocessing
+import os
+import platform
+import sys
+import time
+
+import numpy as np
+
+from pathlib import Path
+from typing import Dict, List, Optional
+
+
+_DEFAULT_TEXT = "The quick brown fox jumps over the lazy dog, and the 12 dogs don't seem to mind it. 你好!"
+
+
+def _peak_rss_bytes() -> Optional[int]:
+    try:
+        import resource
+        peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+        # the peak is in bytes on macOS and in kilobytes elsewhere
+        return int(peak) if sys.platform == "darwin" else int(peak) * 1024
+    except ImportError:
+        pass
+
+    try:
+        import psutil
+        info = psutil.Process().memory_info()
+        return int(getattr(info, "peak_wset", info.rss))
+    except ImportError:
+        return None
+
+
+def _is_dynamic(dim) -> bool:
+    return not isinstance(dim, int) or dim < 0
+
+
+def _make_inputs(session, batch_size: int, texts: List[str], byte_inputs: Dict[str, bytes], max_id: int, seed: int):
+    rng = np.random.default_rng(seed)
+    inputs = {}
+    for meta in session.get_inputs():
+        shape = list(meta.shape)
+        if meta.type == "tensor(uint8)" and len(shape) <= 2 and byte_inputs:
+            name = meta.name.lower()
+            kind = next((k for k in byte_inputs if k in name), next(iter(byte_inputs)))
+            data = np.frombuffer(byte_inputs[kind], dtype=np.uint8)
+            inputs[meta.name] = data if len(shape) == 1 else data.reshape(1, -1)
+            continue
+
+        if shape and _is_dynamic(shape[0]):
+            shape[0] = batch_size
+        # the other dynamic dimensions, like the length of a sequence, are one text's worth
+        shape = [dim if not _is_dynamic(dim) else 16 for dim in shape]
+
+        if meta.type == "tensor(string)":
+            count = int(np.prod(shape)) if shape else 1
+            values = [texts[i % len(texts)] for i in range(count)]
+            inputs[meta.name] = np.array(values, dtype=object).reshape(shape)
+        elif meta.type in ("tensor(int64)", "tensor(int32)"):
+            dtype = np.int64 if meta.type == "tensor(int64)" else np.int32
+            inputs[meta.name] = rng.integers(0, max_id, size=shape).astype(dtype)
+        elif meta.type in ("tensor(float)", "tensor(double)"):
+            dtype = np.float32 if meta.type == "tensor(float)" else np.float64
+            inputs[meta.name] = rng.random(size=shape).astype(dtype)
+        elif meta.type == "tensor(uint8)":
+            inputs[meta.name] = rng.integers(0, 256, size=shape).astype(np.uint8)
+        elif meta.type == "tensor(bool)":
+            inputs[meta.name] = np.ones(shape, dtype=bool)
+        else:
+            raise ValueError(f"Can't make the input {meta.name} of the type {meta.type}, "
+                             "the model needs its own inputs.")
+    return inputs
+
+
+def run_benchmark(model: str, batch_size: int = 1, intra_op_threads: int = 0, inter_op_threads: int = 0,
+                  warmup: int = 5, iterations: int = 50, texts: List[str] = None,
+                  byte_inputs: Dict[str, bytes] = None, max_id: int = 50000, seed: int = 0) -> dict:
+    """
+    Runs the model iterations times after its warmup runs, and returns the result of the combination.
+
+    Parameters
+    ----------
+    model:
+        the path of the ONNX model, whose ops of the extensions are registered from get_library_path()
+    batch_size:
+        the leading dynamic dimension of the inputs
+    intra_op_threads, inter_op_threads:
+        the threads of the session, 0 for the default of onnxruntime
+    texts:
+        the strings of the string inputs
+    byte_inputs:
+        the encoded files of the 1-D uint8 inputs by the kinds their names contain, like {"image": b"..."}
+
+    Returns
+    -------
+    dict
+        The latencies in milliseconds, the items per second and the peak RSS in bytes of the process
+    """
+    import onnxruntime as ort
+    from onnxruntime_extensions import get_library_path
+
+    so = ort.SessionOptions()
+    so.register_custom_ops_library(get_library_path())
+    so.intra_op_num_threads = intra_op_threads
+    so.inter_op_num_threads = inter_op_threads
+    if inter_op_threads > 1:
+        so.execution_mode = ort.ExecutionMode.ORT_PARALLEL
+
+    begin = time.perf_counter()
+    session = ort.InferenceSession(str(model), so, providers=["CPUExecutionProvider"])
+    load_ms = (time.perf_counter() - begin) * 1000.0
+
+    feeds = _make_inputs(session, batch_size, texts or [_DEFAULT_TEXT], byte_inputs or {}, max_id, seed)
+    for _ in range(warmup):
+        session.run(None, feeds)
+
+    latencies = np.empty(iterations, dtype=np.float64)
+    total_begin = time.perf_counter()
+    for i in range(iterations):
+        begin = time.perf_counter()
+        session.run(None, feeds)
+        latencies[i] = (time.perf_counter() - begin) * 1000.0
+    total_s = time.perf_counter() - total_begin
+
+    return {
+        "model": str(model),
+        "batch_size": batch_size,
+        "intra_op_threads": intra_op_threads,
+        "inter_op_threads": inter_op_threads,
+        "iterations": iterations,
+        "session_load_ms": load_ms,
+        "latency_ms": {
+            "mean": float(latencies.mean()),
+            "min": float(latencies.min()),
+            "max": float(latencies.max()),
+            "p50": float(np.percentile(latencies, 50)),
+            "p95": float(np.percentile(latencies, 95)),
+            "p99": float(np.percentile(latencies, 99)),
+        },
+        "throughput_per_s": batch_size * iterations / total_s if total_s > 0 else None,
+        "peak_rss_bytes": _peak_rss_bytes(),
+    }
+
+
+def _run_isolated(kwargs: dict) -> dict:
+    return run_benchmark(**kwargs)
+
+
+def run_benchmarks(models: List[str], batch_sizes: List[int], intra_op_threads: List[int],
+                   inter_op_threads: List[int], isolate: bool = True, **kwargs) -> dict:
+    """
+    Runs every combination of the models, the batch sizes and the threads, each in a new process when isolate
+    is set, so the peak RSS is of that combination only, and returns the report of all the results.
+    """
+    import onnxruntime as ort
+    from onnxruntime_extensions import __version__ as ortx_version
+
+    results = []
+    context = multiprocessing.get_context("spawn")
+    for model in models:
+        for batch_size in batch_sizes:
+            for intra in intra_op_threads:
+                for inter in inter_op_threads:
+                    args = dict(kwargs, model=str(model), batch_size=batch_size, intra_op_threads=intra,
+                                inter_op_threads=inter)
+                    if isolate:
+                        with context.Pool(1) as pool:
+                            results.append(pool.apply(_run_isolated, (args,)))
+                    else:
+                        results.append(run_benchmark(**args))
+
+    return {
+        "onnxruntime_version": ort.__version__,
+        "onnxruntime_extensions_version": ortx_version,
+        "python_version": platform.python_version(),
+        "platform": platform.platform(),
+        "processor": platform.processor() or platform.machine(),
+        "cpu_count": os.cpu_count(),
+        "results": results,
+    }
+
+
+def main(argv: List[str] = None):
+    parser = argparse.ArgumentParser(
+        os.path.basename(__file__),
+        description="Benchmarks the end-to-end latency of the pre/post processing models under onnxruntime.")
+    parser.add_argument("models", type=Path, nargs="+", help="The ONNX models to benchmark.")
+    parser.add_argument("--batch-sizes", type=int, nargs="+", default=[1], help="The batch sizes.")
+    parser.add_argument("--intra-op-threads", type=int, nargs="+", default=[0],
+                        help="The intra-op threads of the session, 0 for the default.")
+    parser.add_argument("--inter-op-threads", type=int, nargs="+", default=[0],
+                        help="The inter-op threads of the session, 0 for the default.")
+    parser.add_argument("--warmup", type=int, default=5, help="The runs before the measured ones.")
+    parser.add_argument("--iterations", type=int, default=50, help="The measured runs of each combination.")
+    parser.add_argument("--text-file", type=Path, help="The lines are the texts of the string inputs.")
+    parser.add_argument("--image", type=Path, help="The image file of the uint8 image inputs.")
+    parser.add_argument("--audio", type=Path, help="The audio file of the uint8 audio inputs.")
+    parser.add_argument("--max-id", type=int, default=50000, help="The bound of the random ids of the int inputs.")
+    parser.add_argument("--no-isolate", action="store_true",
+                        help="Runs all the combinations in this process, then the peak RSS is of all of them.")
+    parser.add_argument("--output", type=Path, help="The JSON file of the report, which is printed otherwise.")
+    args = parser.parse_args(argv)
+
+    texts = None
+    if args.text_file:
+        texts = [line for line in args.text_file.read_text(encoding="utf-8").splitlines() if line]
+    byte_inputs = {}
+    if args.image:
+        byte_inputs["image"] = args.image.read_bytes()
+    if args.audio:
+        byte_inputs["audio"] = args.audio.read_bytes()
+
+    report = run_benchmarks([str(m) for m in args.models], args.batch_sizes, args.intra_op_threads,
+                            args.inter_op_threads, isolate=not args.no_isolate, warmup=args.warmup,
+                            iterations=args.iterations, texts=texts, byte_inputs=byte_inputs, max_id=args.max_id)
+    text = json.dumps(report, indent=2)
+    if args.output:
+        args.output.write_text(text, encoding="utf-8")
+    else:
+        print(text)
+
+
+if __name__ == "__main__":
+    main()
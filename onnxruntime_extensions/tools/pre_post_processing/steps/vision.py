@@ -56,15 +56,21 @@ class ConvertBGRToImage(Step):
     Output shape: {num_encoded_bytes}
     """
 
-    def __init__(self, image_format: str = "jpg", name: Optional[str] = None):
+    def __init__(self, image_format: str = "jpg", quality: Optional[int] = None,
+                 compression_level: Optional[int] = None, name: Optional[str] = None):
         """
         Args:
             image_format: Format to encode to. jpg and png are supported.
+            quality: Optional JPEG quality in 0..100. Defaults to the one of OpenCV, 95.
+            compression_level: Optional PNG compression level in 0..9. The lower levels are several times faster.
+                               Defaults to the one of OpenCV.
             name: Optional step name. Defaults to 'ConvertBGRToImage'
         """
         super().__init__(["bgr_data"], ["image"], name)
         assert image_format == "jpg" or image_format == "png"
         self._format = image_format
+        self._quality = quality
+        self._compression_level = compression_level
 
     def _create_graph_for_step(self, graph: onnx.GraphProto, onnx_opset: int):
         input_type_str, input_shape_str = self._get_input_type_and_shape_strs(graph, 0)
@@ -87,6 +93,11 @@ class ConvertBGRToImage(Step):
         format_attr.name = "format"
         format_attr.type = onnx.AttributeProto.AttributeType.STRING
         format_attr.s = bytes(self._format, "utf-8")
+        if self._quality is not None:
+            converter_graph.node[0].attribute.append(onnx.helper.make_attribute("quality", self._quality))
+        if self._compression_level is not None:
+            converter_graph.node[0].attribute.append(
+                onnx.helper.make_attribute("compression_level", self._compression_level))
 
         return converter_graph
 
@@ -640,7 +651,8 @@ class DrawBoundingBoxes(Step):
     """
 
     def __init__(self, mode: str = "XYXY", thickness: int = 4, num_classes: int = 10,
-                 colour_by_classes=False, name: Optional[str] = None):
+                 colour_by_classes=False, score_threshold: Optional[float] = None, max_boxes: int = 0,
+                 name: Optional[str] = None):
         """
         Args:
             mode: The mode of the boxes, 
@@ -660,6 +672,8 @@ class DrawBoundingBoxes(Step):
                                `num_colours` classes displayed. A colour is only used for a single class. 
                                If `False`, we draw boxes for the top `num_colours` results. A colour is used 
                                for a single result, regardless of class.
+            score_threshold: Optional. The boxes with a lower score are skipped before the boxes are sorted.
+            max_boxes: Optional. Only the boxes of the `max_boxes` highest scores are drawn if it's greater than 0.
             name: Optional name of step. Defaults to 'DrawBoundingBoxes'
         """
         super().__init__(["image", "boxes"], ["image_out"], name)
@@ -667,6 +681,8 @@ class DrawBoundingBoxes(Step):
         self.num_classes_ = num_classes
         self.colour_by_classes_ = colour_by_classes
         self.mode_ = mode
+        self.score_threshold_ = score_threshold
+        self.max_boxes_ = max_boxes
 
     def _create_graph_for_step(self, graph: onnx.GraphProto, onnx_opset: int):
         input0_type_str, input0_shape_str = self._get_input_type_and_shape_strs(graph, 0)
@@ -692,6 +708,10 @@ class DrawBoundingBoxes(Step):
         token_model_attr.append(onnx.helper.make_attribute(op_attr[1], self.num_classes_))
         token_model_attr.append(onnx.helper.make_attribute(op_attr[2], int(self.colour_by_classes_)))
         token_model_attr.append(onnx.helper.make_attribute(op_attr[3], self.mode_))
+        if self.score_threshold_ is not None:
+            token_model_attr.append(onnx.helper.make_attribute("score_threshold", float(self.score_threshold_)))
+        if self.max_boxes_ > 0:
+            token_model_attr.append(onnx.helper.make_attribute("max_boxes", self.max_boxes_))
         converter_graph.node[0].attribute.extend(token_model_attr)
 
         return converter_graph
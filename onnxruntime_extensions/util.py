@@ -65,6 +65,39 @@ def mel_filterbank(
     return fbank
 
 
+# the string attributes of the assets of the tokenizers, which the kernels decompress by their _compression attribute
+ASSET_ATTRIBUTES = ('vocab', 'merges', 'model', 'id_vocab', 'map', 'phrases', 'vocab_file', 'tokenizer_json')
+
+
+def compress_asset_attributes(model, names=ASSET_ATTRIBUTES, level=19):
+    """
+    Compresses the string attributes of the assets of the custom op nodes of the model with zstd, and sets the
+    _compression attribute of each, like vocab_compression="zstd". The extensions library has to be built with
+    OCOS_ENABLE_ZSTD=ON to load the model then.
+    """
+    import zstandard
+
+    compressor = zstandard.ZstdCompressor(level=level)
+    domains = ('ai.onnx.contrib', 'com.microsoft.extensions')
+
+    def _compress_graph(graph):
+        for node in graph.node:
+            for attr in node.attribute:
+                if attr.type == onnx.AttributeProto.GRAPH:
+                    _compress_graph(attr.g)
+            if node.domain not in domains:
+                continue
+            existing = {attr.name for attr in node.attribute}
+            for attr in node.attribute:
+                if attr.name in names and attr.type == onnx.AttributeProto.STRING and \
+                        attr.name + '_compression' not in existing and len(attr.s) > 0:
+                    attr.s = compressor.compress(attr.s)
+                    node.attribute.append(onnx.helper.make_attribute(attr.name + '_compression', 'zstd'))
+
+    _compress_graph(model.graph)
+    return model
+
+
 def remove_unused_constants(subgraph):
     nodes = [_n for _n in subgraph.node]
 
@@ -2,16 +2,24 @@
 // Licensed under the MIT License.
 
 #include "ocos.h"
+#include "audio_chunk.hpp"
+#include "log_mel.hpp"
+#include "voice_activity.hpp"
 #ifdef ENABLE_DR_LIBS
 #include "audio_decoder.hpp"
 #endif  // ENABLE_DR_LIBS
 
 FxLoadCustomOpFactory LoadCustomOpClasses_Audio = []()-> CustomOpArray& {
   static OrtOpLoader op_loader(
-    []() { return nullptr; }
+    CustomCpuStruct("AudioChunk", AudioChunk),
+    CustomCpuStruct("LogMelSpectrogram", LogMelSpectrogram),
+    CustomCpuStruct("LogMelSpectrogramStreaming", LogMelSpectrogramStreaming),
+    CustomCpuStruct("VoiceActivityDetection", VoiceActivityDetection)
 #ifdef ENABLE_DR_LIBS
     ,
-    CustomCpuStruct("AudioDecoder", AudioDecoder)
+    CustomCpuStruct("AudioDecoder", AudioDecoder),
+    CustomCpuStruct("AudioDecoderInt16", AudioDecoderInt16),
+    CustomCpuStruct("AudioDecoderBatch", AudioDecoderBatch)
 #endif
   );
 
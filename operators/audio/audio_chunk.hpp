@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "log_mel.hpp"
+#include "parallel_for.h"
+#include "string_utils.h"
+
+// Splits the PCM of [n] or [1, n] into the windows of chunk_length samples every stride samples, into
+// [chunks, chunk_length], which is the batch of LogMelSpectrogram, like the 30 second windows of 480000 samples of
+// Whisper. There is one chunk for a signal up to chunk_length, and enough chunks to cover all of a longer one, in
+// which the last chunk is padded with zeros, or with the reflection of the signal at its end with padding "reflect".
+// The optional lengths are the numbers of the samples of the signal in every chunk, before the padding.
+struct AudioChunk : public BaseKernel {
+ public:
+  AudioChunk(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+    int64_t chunk_length = TryToGetAttributeWithDefault<int64_t>("chunk_length", 480000);
+    int64_t stride = TryToGetAttributeWithDefault<int64_t>("stride", chunk_length);
+    if (chunk_length <= 0 || stride <= 0) {
+      ORTX_CXX_API_THROW("[AudioChunk]: chunk_length and stride should be positive.", ORT_INVALID_ARGUMENT);
+    }
+    chunk_length_ = static_cast<size_t>(chunk_length);
+    stride_ = static_cast<size_t>(stride);
+
+    std::string padding = TryToGetAttributeWithDefault<std::string>("padding", "constant");
+    if (padding == "reflect") {
+      reflect_ = true;
+    } else if (padding != "constant") {
+      ORTX_CXX_API_THROW(MakeString("[AudioChunk]: unknown padding ", padding,
+                                    ", which should be constant or reflect."),
+                         ORT_INVALID_ARGUMENT);
+    }
+
+    num_threads_ = ReadNumThreadsAttribute(*this);
+  }
+
+  size_t NumChunks(size_t num_samples) const {
+    return num_samples <= chunk_length_ ? 1 : 1 + (num_samples - chunk_length_ + stride_ - 1) / stride_;
+  }
+
+  void Compute(const ortc::Tensor<float>& input, ortc::Tensor<float>& output,
+               std::optional<ortc::Tensor<int64_t>*> lengths) const {
+    auto& dims = input.Shape();
+    if (dims.size() > 2 || (dims.size() == 2 && dims[0] != 1)) {
+      ORTX_CXX_API_THROW("[AudioChunk]: Expect input dimension [n] or [1, n].", ORT_INVALID_ARGUMENT);
+    }
+    const float* pcm = input.Data();
+    const size_t num_samples = static_cast<size_t>(input.NumberOfElement());
+    const size_t chunks = NumChunks(num_samples);
+    float* out = output.Allocate({static_cast<int64_t>(chunks), static_cast<int64_t>(chunk_length_)});
+
+    ParallelFor(chunks, num_threads_, [&](size_t begin, size_t end) {
+      for (size_t c = begin; c < end; ++c) {
+        const size_t start = c * stride_;
+        const size_t valid = std::min(chunk_length_, num_samples - std::min(start, num_samples));
+        float* chunk = out + c * chunk_length_;
+        std::copy(pcm + start, pcm + start + valid, chunk);
+        if (!reflect_ || num_samples == 0) {
+          std::fill(chunk + valid, chunk + chunk_length_, 0.0f);
+          continue;
+        }
+        for (size_t i = valid; i < chunk_length_; ++i) {
+          chunk[i] = pcm[ReflectIndex(static_cast<int64_t>(start + i), num_samples)];
+        }
+      }
+    });
+
+    if (lengths.has_value() && *lengths != nullptr) {
+      int64_t* p_lengths = (*lengths)->Allocate({static_cast<int64_t>(chunks)});
+      for (size_t c = 0; c < chunks; ++c) {
+        const size_t start = std::min(c * stride_, num_samples);
+        p_lengths[c] = static_cast<int64_t>(std::min(chunk_length_, num_samples - start));
+      }
+    }
+  }
+
+ private:
+  size_t chunk_length_{};
+  size_t stride_{};
+  bool reflect_{};
+  size_t num_threads_{1};
+};
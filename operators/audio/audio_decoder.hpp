@@ -5,10 +5,12 @@
 
 #include "ocos.h"
 
-#include <list>
+#include <cmath>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
+#include <type_traits>
 #define DR_FLAC_IMPLEMENTATION
 #include "dr_flac.h"
 #define DR_MP3_IMPLEMENTATION 1
@@ -21,7 +23,9 @@
 #include "narrow.h"
 #include "string_utils.h"
 #include "string_tensor.h"
+#include "parallel_for.h"
 #include "sampling.h"
+#include "trace_scope.h"
 
 struct AudioDecoder : public BaseKernel {
  public:
@@ -29,6 +33,8 @@ struct AudioDecoder : public BaseKernel {
       : BaseKernel(api, info),
         downsample_rate_(TryToGetAttributeWithDefault<int64_t>("downsampling_rate", 0)),
         stereo_mixer_(TryToGetAttributeWithDefault<int64_t>("stereo_to_mono", 0)) {
+    // the weights of the channels to mix into mono, 1 / channels by default
+    TryToGetAttribute("channel_weights", channel_weights_);
   }
 
   enum class AudioStreamType {
@@ -38,7 +44,7 @@ struct AudioDecoder : public BaseKernel {
     kFLAC
   };
 
-  AudioStreamType ReadStreamFormat(const uint8_t* p_data, const std::string& str_format) const {
+  AudioStreamType ReadStreamFormat(const uint8_t* p_data, size_t size, const std::string& str_format) const {
     static const std::map<std::string, AudioStreamType> format_mapping = {
         {"default", AudioStreamType::kDefault},
         {"wav", AudioStreamType::kWAV},
@@ -57,6 +63,9 @@ struct AudioDecoder : public BaseKernel {
     }
 
     if (stream_format == AudioStreamType::kDefault) {
+      if (size < 4) {
+        ORTX_CXX_API_THROW("[AudioDecoder]: Cannot detect audio stream format", ORT_INVALID_ARGUMENT);
+      }
       auto p_stream = reinterpret_cast<char const*>(p_data);
       std::string_view marker(p_stream, 4);
       if (marker == "fLaC") {
@@ -75,116 +84,384 @@ struct AudioDecoder : public BaseKernel {
     return stream_format;
   }
 
-  template <typename TY_AUDIO, typename FX_DECODER>
-  static size_t DrReadFrames(std::list<std::vector<float>>& frames, FX_DECODER fx, TY_AUDIO& obj) {
-    const size_t default_chunk_size = 1024 * 256;
-    int64_t total_buf_size = 0;
+  // The samples of a decoded stream, which are written into the output tensor, or into a vector. The output is
+  // allocated with the size from the frame count of the stream, or gathered until the end of the stream if the
+  // count is unknown. A stream shorter than its frame count is padded with zeros, and the samples beyond the
+  // count are dropped. The float samples are converted into the type of the output when they are written.
+  template <typename T>
+  class SampleWriter {
+   public:
+    explicit SampleWriter(ortc::Tensor<T>& output) : output_(&output) {}
+    explicit SampleWriter(std::vector<T>& values) : values_(&values) {}
 
-    for (;;) {
-      std::vector<float> buf;
-      buf.resize(default_chunk_size * obj.channels);
-      auto n_frames = fx(&obj, default_chunk_size, buf.data());
-      if (n_frames <= 0) {
-        break;
+    void Open(size_t num_samples) {
+      if (output_ == nullptr) {
+        values_->clear();
+        if (num_samples > 0) {
+          values_->resize(num_samples);
+          data_ = values_->data();
+        }
+      } else if (num_samples > 0) {
+        data_ = output_->Allocate({1, ort_extensions::narrow<int64_t>(num_samples)});
+      } else {
+        buffer_.emplace(*output_);
       }
-      auto data_size = n_frames * obj.channels;
-      total_buf_size += data_size;
-      buf.resize(data_size);
-      frames.emplace_back(std::move(buf));
+      capacity_ = num_samples;
     }
 
-    return total_buf_size;
-  }
+    template <typename S>
+    void Write(const S* samples, size_t size) {
+      if (data_ == nullptr) {
+        std::vector<T>& values = buffer_ ? buffer_->Values() : *values_;
+        const size_t offset = values.size();
+        values.resize(offset + size);
+        Convert(samples, size, values.data() + offset);
+        return;
+      }
+      size = std::min(size, capacity_ - size_);
+      Convert(samples, size, data_ + size_);
+      size_ += size;
+    }
 
-  void Compute(const ortc::Tensor<uint8_t>& input,
-               const std::optional<std::string> format,
-               ortc::Tensor<float>& output0) const {
-    const uint8_t* p_data = input.Data();
-    auto input_dim = input.Shape();
-    if (!((input_dim.size() == 1) || (input_dim.size() == 2 && input_dim[0] == 1))) {
-      ORTX_CXX_API_THROW("[AudioDecoder]: Expect input dimension [n] or [1,n].", ORT_INVALID_ARGUMENT);
+    void Close() {
+      if (data_ != nullptr) {
+        std::fill(data_ + size_, data_ + capacity_, T{});
+      } else if (buffer_) {
+        buffer_->Commit({1, ort_extensions::narrow<int64_t>(buffer_->Size())});
+      }
+    }
+
+   private:
+    static void Convert(const T* samples, size_t size, T* output) {
+      std::copy(samples, samples + size, output);
+    }
+
+    // the same conversion as the s16 readers of dr_libs do from the float samples
+    static void Convert(const float* samples, size_t size, int16_t* output) {
+      for (size_t i = 0; i < size; ++i) {
+        float x = std::min(std::max(samples[i], -1.0f), 1.0f) + 1.0f;
+        output[i] = static_cast<int16_t>(static_cast<int32_t>(x * 32767.5f) - 32768);
+      }
+    }
+
+    ortc::Tensor<T>* output_{};
+    std::vector<T>* values_{};
+    std::optional<ortc::OutputBuffer<T>> buffer_;
+    T* data_{};
+    size_t capacity_{};
+    size_t size_{};
+  };
+
+  // The part of a stream to decode, in the seconds of the stream, where a negative duration is up to its end.
+  struct TimeRange {
+    double start_time{};
+    double duration{-1.0};
+  };
+
+  // Decodes the frames a block after another, and mixes, filters and resamples each block into the output,
+  // so only a block of the decoded samples is held at any time. The int16 output of the samples which aren't
+  // mixed or resampled is read by the s16 decoder of dr_libs into the output directly. The decoder seeks to the
+  // start of the range, so the frames before it aren't decoded, and stops at its end.
+  template <typename T, typename TY_AUDIO, typename FX_DECODER, typename FX_DECODER_S16, typename FX_SEEK>
+  void DrReadFrames(SampleWriter<T>& writer, FX_DECODER fx, FX_DECODER_S16 fx_s16, FX_SEEK fx_seek, TY_AUDIO& obj,
+                    uint64_t total_frames, size_t stream_size, const TimeRange& range) const {
+    const size_t block_frames = 1024 * 16;
+    // a frame count beyond what any stream of the size decodes to is ignored, and the output grows instead
+    const uint64_t max_samples_per_byte = 256;
+    const int64_t orig_sample_rate = obj.sampleRate;
+    const size_t channels = obj.channels;
+    if (downsample_rate_ != 0 &&
+        orig_sample_rate < downsample_rate_) {
+      ORTX_CXX_API_THROW("[AudioDecoder]: only down-sampling supported.", ORT_INVALID_ARGUMENT);
+    }
+
+    const bool mix = stereo_mixer_ && channels > 1;
+    std::optional<ChannelMixer> mixer;
+    if (mix) {
+      if (!channel_weights_.empty() && channel_weights_.size() != channels) {
+        ORTX_CXX_API_THROW(MakeString("[AudioDecoder]: ", channel_weights_.size(),
+                                      " channel weights for the stream of ", channels, " channels."),
+                           ORT_INVALID_ARGUMENT);
+      }
+      mixer.emplace(channels, channel_weights_);
+    }
+    const bool resample = downsample_rate_ != 0 && downsample_rate_ != orig_sample_rate;
+    const size_t out_channels = mix ? 1 : channels;
+    std::optional<ButterworthLowpass> filter;
+    std::vector<KaiserWindowInterpolation> resamplers;
+    if (resample) {
+      // A lowpass filter on the audio data to remove high frequency noise before the downsampling,
+      // in which the channels which aren't mixed are filtered and resampled one by one
+      filter.emplace(0.5 * downsample_rate_, 1.0 * orig_sample_rate, out_channels);
+      resamplers.assign(out_channels, KaiserWindowInterpolation(1.0f * orig_sample_rate, 1.0f * downsample_rate_));
     }
 
-    std::string str_format;
-    if (format) {
-      str_format = *format;
+    if (channels == 0 || total_frames > stream_size * max_samples_per_byte / channels) {
+      total_frames = 0;
     }
-    auto stream_format = ReadStreamFormat(p_data, str_format);
 
-    int64_t total_buf_size = 0;
-    std::list<std::vector<float>> lst_frames;
-    int64_t orig_sample_rate = 0;
-    int64_t orig_channels = 0;
+    uint64_t first_frame = static_cast<uint64_t>(std::llround(range.start_time * orig_sample_rate));
+    uint64_t remaining = range.duration < 0 ? std::numeric_limits<uint64_t>::max()
+                                            : static_cast<uint64_t>(std::llround(range.duration * orig_sample_rate));
+    if (total_frames != 0) {
+      first_frame = std::min(first_frame, total_frames);
+      remaining = std::min(remaining, total_frames - first_frame);
+      total_frames = remaining;
+    }
+    if (first_frame > 0 && remaining > 0 && !fx_seek(&obj, first_frame)) {
+      // the stream of an unknown frame count ends before the start
+      remaining = 0;
+    }
+    // the size of the next block, which stops the decoding at the end of the range
+    auto next_block = [&remaining, block_frames]() {
+      return static_cast<size_t>(std::min<uint64_t>(block_frames, remaining));
+    };
+    size_t num_samples = ort_extensions::narrow<size_t>(total_frames);
+    if (resample) {
+      num_samples = KaiserWindowInterpolation::OutputSize(num_samples, 1.0f * orig_sample_rate,
+                                                          1.0f * downsample_rate_);
+    }
+    writer.Open(num_samples * out_channels);
+
+    if constexpr (std::is_same_v<T, int16_t>) {
+      if (!mix && !resample) {
+        std::vector<int16_t> block(block_frames * channels);
+        while (remaining > 0) {
+          ort_extensions::RunCancellation::ThrowIfCancelled("AudioDecoder");
+          auto n_frames = fx_s16(&obj, next_block(), block.data());
+          if (n_frames == 0) {
+            break;
+          }
+          remaining -= n_frames;
+          writer.Write(block.data(), static_cast<size_t>(n_frames) * channels);
+        }
+        writer.Close();
+        return;
+      }
+    }
+
+    std::vector<float> block(block_frames * channels);
+    std::vector<float> resampled;
+    std::vector<float> planar;
+    std::vector<std::vector<float>> planar_resampled(out_channels);
+    // resamples the interleaved frames of the block into the writer, or the rest of the stream without samples
+    auto resample_block = [&](const float* samples, size_t size) {
+      resampled.clear();
+      if (out_channels == 1) {
+        if (samples != nullptr) {
+          resamplers[0].Push(samples, size, resampled);
+        } else {
+          resamplers[0].Finish(resampled);
+        }
+        writer.Write(resampled.data(), resampled.size());
+        return;
+      }
+
+      const size_t frames = size / out_channels;
+      planar.resize(frames);
+      for (size_t c = 0; c < out_channels; ++c) {
+        auto& channel = planar_resampled[c];
+        channel.clear();
+        if (samples == nullptr) {
+          resamplers[c].Finish(channel);
+          continue;
+        }
+        for (size_t i = 0; i < frames; ++i) {
+          planar[i] = samples[i * out_channels + c];
+        }
+        resamplers[c].Push(planar.data(), frames, channel);
+      }
+      // the resamplers of the channels have the same input, so they output the same number of samples
+      const size_t resampled_frames = planar_resampled[0].size();
+      resampled.resize(resampled_frames * out_channels);
+      for (size_t c = 0; c < out_channels; ++c) {
+        for (size_t i = 0; i < resampled_frames; ++i) {
+          resampled[i * out_channels + c] = planar_resampled[c][i];
+        }
+      }
+      writer.Write(resampled.data(), resampled.size());
+    };
+    while (remaining > 0) {
+      ort_extensions::RunCancellation::ThrowIfCancelled("AudioDecoder");
+      float* samples = block.data();
+      auto n_frames = fx(&obj, next_block(), samples);
+      if (n_frames <= 0) {
+        break;
+      }
+      remaining -= n_frames;
+      size_t size = static_cast<size_t>(n_frames) * out_channels;
+
+      if (resample) {
+        ORTX_TRACE_SCOPE("AudioDecoder.Resample");
+        if (mix) {
+          // the channels are mixed into the first stage of the filter, which reads every frame once
+          filter->ProcessBlock([&](size_t i) { return mixer->MixFrame(samples + i * channels); }, samples, size);
+        } else {
+          filter->ProcessBlock(samples, size);
+        }
+        resample_block(samples, size);
+      } else {
+        if (mix) {
+          mixer->Mix(samples, size, samples);
+        }
+        writer.Write(samples, size);
+      }
+    }
+
+    if (resample) {
+      resample_block(nullptr, 0);
+    }
+    writer.Close();
+  }
+
+  // Decodes the range of the stream of size bytes into the writer.
+  template <typename T>
+  void Decode(const uint8_t* p_data, size_t size, const std::string& str_format, SampleWriter<T>& writer,
+              const TimeRange& range = {}) const {
+    ORTX_TRACE_SCOPE("AudioDecoder.Decode");
+    auto stream_format = ReadStreamFormat(p_data, size, str_format);
 
     if (stream_format == AudioStreamType::kMP3) {
       auto mp3_obj_ptr = std::make_unique<drmp3>();
-      if (!drmp3_init_memory(mp3_obj_ptr.get(), p_data, input.NumberOfElement(), nullptr)) {
+      if (!drmp3_init_memory(mp3_obj_ptr.get(), p_data, size, nullptr)) {
         ORTX_CXX_API_THROW("[AudioDecoder]: unexpected error on MP3 stream.", ORT_RUNTIME_EXCEPTION);
       }
-      orig_sample_rate = mp3_obj_ptr->sampleRate;
-      orig_channels = mp3_obj_ptr->channels;
-      total_buf_size = DrReadFrames(lst_frames, drmp3_read_pcm_frames_f32, *mp3_obj_ptr);
+      auto mp3_obj_closer = gsl::finally([&mp3_obj_ptr]() { drmp3_uninit(mp3_obj_ptr.get()); });
+      // counting the frames only parses the frame headers, and seeks back to the start.
+      uint64_t total_frames = drmp3_get_pcm_frame_count(mp3_obj_ptr.get());
+      DrReadFrames(writer, drmp3_read_pcm_frames_f32, drmp3_read_pcm_frames_s16, drmp3_seek_to_pcm_frame, *mp3_obj_ptr,
+                   total_frames, size, range);
 
     } else if (stream_format == AudioStreamType::kFLAC) {
-      drflac* flac_obj = drflac_open_memory(p_data, input.NumberOfElement(), nullptr);
+      drflac* flac_obj = drflac_open_memory(p_data, size, nullptr);
       auto flac_obj_closer = gsl::finally([flac_obj]() { drflac_close(flac_obj); });
       if (flac_obj == nullptr) {
         ORTX_CXX_API_THROW("[AudioDecoder]: unexpected error on FLAC stream.", ORT_RUNTIME_EXCEPTION);
       }
-      orig_sample_rate = flac_obj->sampleRate;
-      orig_channels = flac_obj->channels;
-      total_buf_size = DrReadFrames(lst_frames, drflac_read_pcm_frames_f32, *flac_obj);
+      // 0 if the stream info doesn't have the count.
+      DrReadFrames(writer, drflac_read_pcm_frames_f32, drflac_read_pcm_frames_s16, drflac_seek_to_pcm_frame, *flac_obj,
+                   flac_obj->totalPCMFrameCount, size, range);
 
     } else {
       drwav wav_obj;
-      if (!drwav_init_memory(&wav_obj, p_data, input.NumberOfElement(), nullptr)) {
+      if (!drwav_init_memory(&wav_obj, p_data, size, nullptr)) {
         ORTX_CXX_API_THROW("[AudioDecoder]: unexpected error on WAV stream.", ORT_RUNTIME_EXCEPTION);
       }
-      orig_sample_rate = wav_obj.sampleRate;
-      orig_channels = wav_obj.channels;
-      total_buf_size = DrReadFrames(lst_frames, drwav_read_pcm_frames_f32, wav_obj);
+      auto wav_obj_closer = gsl::finally([&wav_obj]() { drwav_uninit(&wav_obj); });
+      DrReadFrames(writer, drwav_read_pcm_frames_f32, drwav_read_pcm_frames_s16, drwav_seek_to_pcm_frame, wav_obj,
+                   wav_obj.totalPCMFrameCount, size, range);
     }
+  }
 
-    if (downsample_rate_ != 0 &&
-        orig_sample_rate < downsample_rate_) {
-      ORTX_CXX_API_THROW("[AudioDecoder]: only down-sampling supported.", ORT_INVALID_ARGUMENT);
-    }
+  void Compute(const ortc::Tensor<uint8_t>& input,
+               const std::optional<std::string> format,
+               std::optional<float> start_time,
+               std::optional<float> duration,
+               ortc::Tensor<float>& output0) const {
+    DecodeInput(input, format, start_time, duration, output0);
+  }
 
-    // join all frames
-    std::vector<float> buf;
-    buf.resize(total_buf_size);
-    int64_t offset = 0;
-    for (auto& _b : lst_frames) {
-      std::copy(_b.begin(), _b.end(), buf.begin() + offset);
-      offset += _b.size();
+ protected:
+  template <typename T>
+  void DecodeInput(const ortc::Tensor<uint8_t>& input, const std::optional<std::string>& format,
+                   std::optional<float> start_time, std::optional<float> duration,
+                   ortc::Tensor<T>& output0) const {
+    auto input_dim = input.Shape();
+    if (!((input_dim.size() == 1) || (input_dim.size() == 2 && input_dim[0] == 1))) {
+      ORTX_CXX_API_THROW("[AudioDecoder]: Expect input dimension [n] or [1,n].", ORT_INVALID_ARGUMENT);
     }
 
-    // mix the stereo channels into mono channel
-    if (stereo_mixer_ && orig_channels > 1) {
-      if (buf.size() > 1) {
-        for (size_t i = 0; i < buf.size() / 2; ++i) {
-          buf[i] = (buf[i * 2] + buf[i * 2 + 1]) / 2;
-        }
-        buf.resize(buf.size() / 2);
-      }
+    TimeRange range;
+    range.start_time = start_time.value_or(0.0f);
+    if (!(range.start_time >= 0) || (duration && !(*duration >= 0))) {
+      ORTX_CXX_API_THROW("[AudioDecoder]: start_time and duration shouldn't be negative.", ORT_INVALID_ARGUMENT);
+    }
+    if (duration) {
+      range.duration = *duration;
     }
 
-    if (downsample_rate_ != 0 &&
-        downsample_rate_ != orig_sample_rate) {
-      // A lowpass filter on buf audio data to remove high frequency noise
-      ButterworthLowpass filter(0.5 * downsample_rate_, 1.0 * orig_sample_rate);
-      std::vector<float> filtered_buf = filter.Process(buf);
-      // downsample the audio data
-      KaiserWindowInterpolation::Process(filtered_buf, buf,
-                                         1.0f * orig_sample_rate, 1.0f * downsample_rate_);
-    }
-
-    std::vector<int64_t> dim_out = {1, ort_extensions::narrow<int64_t>(buf.size())};
-    float* p_output = output0.Allocate(dim_out);
-    std::copy(buf.begin(), buf.end(), p_output);
+    SampleWriter<T> writer(output0);
+    Decode(input.Data(), input.NumberOfElement(), format ? *format : std::string(), writer, range);
   }
 
  private:
   int64_t downsample_rate_{};
   int64_t stereo_mixer_{};
+  std::vector<float> channel_weights_;
+};
+
+// The same as AudioDecoder, which outputs the int16 PCM for the models of the quantized audio, so the samples
+// aren't decoded into float and cast again.
+struct AudioDecoderInt16 : public AudioDecoder {
+  AudioDecoderInt16(const OrtApi& api, const OrtKernelInfo& info) : AudioDecoder(api, info) {}
+
+  void Compute(const ortc::Tensor<uint8_t>& input,
+               const std::optional<std::string> format,
+               std::optional<float> start_time,
+               std::optional<float> duration,
+               ortc::Tensor<int16_t>& output0) const {
+    DecodeInput(input, format, start_time, duration, output0);
+  }
+};
+
+// Decodes a batch of the audio streams in parallel. The streams are concatenated into one tensor, and the offsets
+// of [batch + 1] are where they start and end, like the row splits of a ragged tensor. The PCM is padded with
+// zeros to the longest stream, and the lengths are the numbers of the samples of every stream.
+struct AudioDecoderBatch : public BaseKernel {
+ public:
+  AudioDecoderBatch(const OrtApi& api, const OrtKernelInfo& info)
+      : BaseKernel(api, info), decoder_(api, info) {
+    num_threads_ = ReadNumThreadsAttribute(*this);
+  }
+
+  void Compute(const ortc::Tensor<uint8_t>& streams,
+               const ortc::Tensor<int64_t>& offsets,
+               const std::optional<std::string> format,
+               ortc::Tensor<float>& output0,
+               ortc::Tensor<int64_t>& output1) const {
+    if (streams.Shape().size() != 1) {
+      ORTX_CXX_API_THROW("[AudioDecoderBatch]: Expect the streams of dimension [n].", ORT_INVALID_ARGUMENT);
+    }
+    if (offsets.Shape().size() != 1 || offsets.NumberOfElement() < 1) {
+      ORTX_CXX_API_THROW("[AudioDecoderBatch]: Expect the offsets of dimension [batch + 1].", ORT_INVALID_ARGUMENT);
+    }
+
+    const uint8_t* p_streams = streams.Data();
+    const int64_t* p_offsets = offsets.Data();
+    const size_t batch = static_cast<size_t>(offsets.NumberOfElement()) - 1;
+    if (p_offsets[0] != 0 || p_offsets[batch] != streams.NumberOfElement()) {
+      ORTX_CXX_API_THROW("[AudioDecoderBatch]: The offsets should start at 0 and end at the size of the streams.",
+                         ORT_INVALID_ARGUMENT);
+    }
+    for (size_t i = 0; i < batch; ++i) {
+      if (p_offsets[i] > p_offsets[i + 1]) {
+        ORTX_CXX_API_THROW(MakeString("[AudioDecoderBatch]: The offsets are decreasing at ", i, "."),
+                           ORT_INVALID_ARGUMENT);
+      }
+    }
+
+    const std::string str_format = format ? *format : std::string();
+    ortc::PaddedOutput<float> pcm(output0, {static_cast<int64_t>(batch)}, -1);
+    ParallelFor(batch, num_threads_, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        std::vector<float> values;
+        AudioDecoder::SampleWriter<float> writer(values);
+        decoder_.Decode(p_streams + p_offsets[i], static_cast<size_t>(p_offsets[i + 1] - p_offsets[i]),
+                        str_format, writer);
+        pcm.SetRow(i, std::move(values));
+      }
+    });
+
+    pcm.Allocate();
+    ParallelFor(batch, num_threads_, [&pcm](size_t begin, size_t end) { pcm.WriteRows(begin, end); });
+
+    int64_t* lengths = output1.Allocate({static_cast<int64_t>(batch)});
+    for (size_t i = 0; i < batch; ++i) {
+      lengths[i] = static_cast<int64_t>(pcm.Length(i));
+    }
+  }
+
+ private:
+  AudioDecoder decoder_;
+  size_t num_threads_{1};
 };
@@ -0,0 +1,234 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// A plan of the forward complex FFT of any size, a mixed radix Stockham autosort FFT. The size is factored into the
+// radices 4, 2, 3 and the other primes, and every stage reads the sequence of the previous one and writes it in the
+// order of the next, so there is no bit reversal. The twiddle factors of all the stages are computed once.
+// A large prime factor costs O(p^2) in its stage.
+class ComplexFft {
+ public:
+  using Complex = std::complex<float>;
+
+  explicit ComplexFft(size_t n) : n_(n) {
+    size_t rest = n;
+    for (size_t radix : {4, 2, 3}) {
+      while (rest % radix == 0 && rest > 1) {
+        stages_.push_back({radix, 0});
+        rest /= radix;
+      }
+    }
+    for (size_t radix = 5; rest > 1; radix += 2) {
+      if (radix * radix > rest) {
+        radix = rest;
+      }
+      while (rest % radix == 0) {
+        stages_.push_back({radix, 0});
+        rest /= radix;
+      }
+    }
+
+    // the twiddle factors W(length)^(u * p) of every stage, which has length / radix of p and radix - 1 of u
+    size_t length = n;
+    for (auto& stage : stages_) {
+      stage.twiddles = twiddles_.size();
+      size_t m = length / stage.radix;
+      for (size_t p = 0; p < m; ++p) {
+        for (size_t u = 1; u < stage.radix; ++u) {
+          twiddles_.push_back(Twiddle(u * p, length));
+        }
+      }
+      if (stage.radix > 4) {
+        // the DFT matrix of the radix
+        stage.dft = twiddles_.size();
+        for (size_t u = 0; u < stage.radix; ++u) {
+          for (size_t k = 0; k < stage.radix; ++k) {
+            twiddles_.push_back(Twiddle(u * k, stage.radix));
+          }
+        }
+      }
+      length = m;
+    }
+  }
+
+  size_t Size() const { return n_; }
+
+  // Transforms the n values of data in place, in which work has n values too.
+  void Forward(Complex* data, Complex* work) const {
+    Complex* x = data;
+    Complex* y = work;
+    size_t length = n_;
+    size_t stride = 1;
+    for (const auto& stage : stages_) {
+      RunStage(stage, length, stride, x, y);
+      length /= stage.radix;
+      stride *= stage.radix;
+      std::swap(x, y);
+    }
+    if (x != data) {
+      std::copy(x, x + n_, data);
+    }
+  }
+
+ private:
+  struct Stage {
+    size_t radix;
+    size_t twiddles;
+    size_t dft = 0;
+  };
+
+  static Complex Twiddle(size_t k, size_t n) {
+    double angle = -2.0 * M_PI * static_cast<double>(k % n) / static_cast<double>(n);
+    return Complex(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+  }
+
+  // y[q + stride * (radix * p + u)] = W(length)^(u * p) * sum(x[q + stride * (p + k * m)] * W(radix)^(u * k))
+  void RunStage(const Stage& stage, size_t length, size_t stride, const Complex* x, Complex* y) const {
+    const size_t radix = stage.radix;
+    const size_t m = length / radix;
+    const Complex* twiddles = twiddles_.data() + stage.twiddles;
+    Complex a[8];
+    std::vector<Complex> large(radix > 8 ? radix * 2 : 0);
+    Complex* in = radix > 8 ? large.data() : a;
+    Complex b[8];
+    Complex* out = radix > 8 ? large.data() + radix : b;
+
+    for (size_t p = 0; p < m; ++p) {
+      const Complex* w = twiddles + p * (radix - 1);
+      for (size_t q = 0; q < stride; ++q) {
+        for (size_t k = 0; k < radix; ++k) {
+          in[k] = x[q + stride * (p + k * m)];
+        }
+
+        if (radix == 2) {
+          out[0] = in[0] + in[1];
+          out[1] = in[0] - in[1];
+        } else if (radix == 4) {
+          Complex t0 = in[0] + in[2];
+          Complex t1 = in[0] - in[2];
+          Complex t2 = in[1] + in[3];
+          Complex t3 = in[1] - in[3];
+          t3 = Complex(t3.imag(), -t3.real());  // * -i
+          out[0] = t0 + t2;
+          out[1] = t1 + t3;
+          out[2] = t0 - t2;
+          out[3] = t1 - t3;
+        } else if (radix == 3) {
+          constexpr float kSin60 = 0.866025403784438647f;
+          Complex t1 = in[1] + in[2];
+          Complex t2 = in[0] - 0.5f * t1;
+          Complex d = in[1] - in[2];
+          Complex t3(kSin60 * d.imag(), -kSin60 * d.real());  // * -i sin(60)
+          out[0] = in[0] + t1;
+          out[1] = t2 + t3;
+          out[2] = t2 - t3;
+        } else {
+          const Complex* dft = twiddles_.data() + stage.dft;
+          for (size_t u = 0; u < radix; ++u) {
+            Complex sum = in[0];
+            for (size_t k = 1; k < radix; ++k) {
+              sum += in[k] * dft[u * radix + k];
+            }
+            out[u] = sum;
+          }
+        }
+
+        Complex* dst = y + q + stride * radix * p;
+        dst[0] = out[0];
+        for (size_t u = 1; u < radix; ++u) {
+          dst[stride * u] = out[u] * w[u - 1];
+        }
+      }
+    }
+  }
+
+  size_t n_;
+  std::vector<Stage> stages_;
+  std::vector<Complex> twiddles_;
+};
+
+// A plan of the FFT of n real samples into the n / 2 + 1 bins of the one-sided spectrum. With an even n, the samples
+// are transformed as n / 2 complex values, whose spectrum is split into the spectra of the even and odd samples.
+// The plans are immutable, so one plan may be shared by the threads, each with its own work buffer.
+class RealFft {
+ public:
+  using Complex = ComplexFft::Complex;
+
+  explicit RealFft(size_t n) : n_(n), fft_(n % 2 == 0 ? n / 2 : n) {
+    if (n % 2 == 0) {
+      twiddles_.resize(n / 2 + 1);
+      for (size_t k = 0; k <= n / 2; ++k) {
+        double angle = -2.0 * M_PI * static_cast<double>(k) / static_cast<double>(n);
+        twiddles_[k] = Complex(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+      }
+    }
+  }
+
+  // The plan of the size, which is created once and shared by all the callers.
+  static std::shared_ptr<const RealFft> Get(size_t n) {
+    static std::mutex mutex;
+    static std::map<size_t, std::shared_ptr<const RealFft>> plans;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& plan = plans[n];
+    if (!plan) {
+      plan = std::make_shared<RealFft>(n);
+    }
+    return plan;
+  }
+
+  size_t Size() const { return n_; }
+  size_t NumBins() const { return n_ / 2 + 1; }
+  size_t WorkSize() const { return n_ % 2 == 0 ? n_ : n_ * 2; }
+
+  // Transforms the n samples into the NumBins() bins of out, in which work has WorkSize() values.
+  void Forward(const float* samples, Complex* out, Complex* work) const {
+    const size_t n = n_;
+    if (n % 2 != 0) {
+      for (size_t i = 0; i < n; ++i) {
+        work[i] = Complex(samples[i], 0.0f);
+      }
+      fft_.Forward(work, work + n);
+      std::copy(work, work + NumBins(), out);
+      return;
+    }
+
+    const size_t half = n / 2;
+    if (half == 0) {
+      return;
+    }
+    Complex* z = work;
+    for (size_t i = 0; i < half; ++i) {
+      z[i] = Complex(samples[2 * i], samples[2 * i + 1]);
+    }
+    fft_.Forward(z, work + half);
+
+    // Z = E + iO, in which E and O are the spectra of the even and the odd samples
+    for (size_t k = 0; k <= half; ++k) {
+      Complex zk = z[k % half];
+      Complex zc = std::conj(z[(half - k) % half]);
+      Complex even = 0.5f * (zk + zc);
+      Complex diff = 0.5f * (zk - zc);
+      Complex odd(diff.imag(), -diff.real());  // / i
+      out[k] = even + twiddles_[k] * odd;
+    }
+  }
+
+ private:
+  size_t n_;
+  ComplexFft fft_;
+  std::vector<Complex> twiddles_;
+};
@@ -0,0 +1,320 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+
+#include <memory>
+#include <vector>
+
+#include "fft.h"
+#include "parallel_for.h"
+#include "sampling.h"
+#include "stft_stream.h"
+
+// The periodic Hann window of n values, the same as torch.hann_window and the window of Whisper.
+inline std::vector<float> PeriodicHannWindow(size_t n) {
+  std::vector<float> window(n);
+  for (size_t i = 0; i < n; ++i) {
+    window[i] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * M_PI * static_cast<double>(i) / n));
+  }
+  return window;
+}
+
+// The index of the sample which is reflected at the ends of the signal of n samples.
+inline size_t ReflectIndex(int64_t i, size_t n) {
+  if (n == 1) {
+    return 0;
+  }
+  const int64_t period = 2 * (static_cast<int64_t>(n) - 1);
+  i %= period;
+  if (i < 0) {
+    i += period;
+  }
+  return static_cast<size_t>(i < static_cast<int64_t>(n) ? i : period - i);
+}
+
+// Writes the frame t of the centered STFT into frame: the window.size() samples centered at t * hop_length, with the
+// reflection of the signal at its ends, multiplied by the window.
+inline void CenteredFrame(const float* x, size_t num_samples, size_t t, size_t hop_length,
+                          const std::vector<float>& window, float* frame) {
+  const size_t n_fft = window.size();
+  int64_t start = static_cast<int64_t>(t * hop_length) - static_cast<int64_t>(n_fft / 2);
+  if (start >= 0 && start + static_cast<int64_t>(n_fft) <= static_cast<int64_t>(num_samples)) {
+    for (size_t i = 0; i < n_fft; ++i) {
+      frame[i] = x[start + i] * window[i];
+    }
+  } else {
+    for (size_t i = 0; i < n_fft; ++i) {
+      frame[i] = x[ReflectIndex(start + static_cast<int64_t>(i), num_samples)] * window[i];
+    }
+  }
+}
+
+// The mel filters of the Slaney mel scale with the Slaney normalization, the same as librosa.filters.mel and the
+// filters of Whisper. A filter is a triangle of a few bins, so only its bins from the first nonzero one are kept,
+// padded with zeros to a multiple of 4, and a power spectrum is read up to PaddedBins().
+class MelFilterBank {
+ public:
+  MelFilterBank(size_t n_fft, size_t n_mel, double sampling_rate) : num_bins_(n_fft / 2 + 1) {
+    // the edges of the filters, evenly spaced on the mel scale from 0 to the Nyquist frequency
+    std::vector<double> edges(n_mel + 2);
+    double max_mel = HzToMel(sampling_rate / 2.0);
+    for (size_t i = 0; i < edges.size(); ++i) {
+      edges[i] = MelToHz(max_mel * static_cast<double>(i) / static_cast<double>(n_mel + 1));
+    }
+
+    padded_bins_ = num_bins_;
+    filters_.resize(n_mel);
+    for (size_t i = 0; i < n_mel; ++i) {
+      std::vector<float> weights(num_bins_);
+      double norm = 2.0 / (edges[i + 2] - edges[i]);
+      size_t first = num_bins_;
+      size_t last = 0;
+      for (size_t k = 0; k < num_bins_; ++k) {
+        double freq = static_cast<double>(k) * sampling_rate / static_cast<double>(n_fft);
+        double lower = (freq - edges[i]) / (edges[i + 1] - edges[i]);
+        double upper = (edges[i + 2] - freq) / (edges[i + 2] - edges[i + 1]);
+        double weight = std::max(0.0, std::min(lower, upper)) * norm;
+        weights[k] = static_cast<float>(weight);
+        if (weights[k] != 0.0f) {
+          first = std::min(first, k);
+          last = k;
+        }
+      }
+
+      Filter& filter = filters_[i];
+      if (first > last) {
+        continue;  // no bin in the filter
+      }
+      filter.begin = first;
+      filter.length = (last - first + 1 + 3) / 4 * 4;
+      filter.offset = weights_.size();
+      weights_.insert(weights_.end(), weights.begin() + first, weights.begin() + last + 1);
+      weights_.resize(filter.offset + filter.length, 0.0f);
+      padded_bins_ = std::max(padded_bins_, filter.begin + filter.length);
+    }
+  }
+
+  size_t NumMels() const { return filters_.size(); }
+  size_t NumBins() const { return num_bins_; }
+  size_t PaddedBins() const { return padded_bins_; }
+
+  // The log10 of the mel bands of the NumBins() bins of a spectrum, in which power has PaddedBins() values for the
+  // power spectrum with zeros beyond NumBins() and mel has NumMels() values.
+  void LogMel(const std::complex<float>* bins, float* power, float* mel) const {
+    for (size_t k = 0; k < num_bins_; ++k) {
+      power[k] = std::norm(bins[k]);
+    }
+    Apply(power, mel);
+    for (size_t m = 0; m < filters_.size(); ++m) {
+      mel[m] = std::log10(std::max(mel[m], 1e-10f));
+    }
+  }
+
+  // Applies the filters to the power spectrum, which has PaddedBins() values with zeros beyond NumBins().
+  void Apply(const float* power, float* mel) const {
+    for (size_t i = 0; i < filters_.size(); ++i) {
+      const Filter& filter = filters_[i];
+      mel[i] = DotProduct(power + filter.begin, weights_.data() + filter.offset, filter.length);
+    }
+  }
+
+  // The weights of all the bins of the filters, [NumMels(), NumBins()], for a kernel which reads them densely.
+  std::vector<float> DenseWeights() const {
+    std::vector<float> dense(filters_.size() * num_bins_, 0.0f);
+    for (size_t i = 0; i < filters_.size(); ++i) {
+      const Filter& filter = filters_[i];
+      const size_t length = std::min(filter.length, num_bins_ - std::min(filter.begin, num_bins_));
+      std::copy_n(weights_.begin() + filter.offset, length, dense.begin() + i * num_bins_ + filter.begin);
+    }
+    return dense;
+  }
+
+ private:
+  static constexpr double kLinearStep = 200.0 / 3;  // the Hz of a mel below 1000 Hz
+  static constexpr double kLogStartHz = 1000.0;
+
+  static double LogStep() { return std::log(6.4) / 27.0; }
+
+  static double HzToMel(double hz) {
+    if (hz < kLogStartHz) {
+      return hz / kLinearStep;
+    }
+    return kLogStartHz / kLinearStep + std::log(hz / kLogStartHz) / LogStep();
+  }
+
+  static double MelToHz(double mel) {
+    const double log_start_mel = kLogStartHz / kLinearStep;
+    if (mel < log_start_mel) {
+      return mel * kLinearStep;
+    }
+    return kLogStartHz * std::exp(LogStep() * (mel - log_start_mel));
+  }
+
+  struct Filter {
+    size_t begin = 0;   // the first bin
+    size_t length = 0;  // the number of the weights, a multiple of 4
+    size_t offset = 0;  // the first weight in weights_
+  };
+
+  size_t num_bins_;
+  size_t padded_bins_;
+  std::vector<Filter> filters_;
+  std::vector<float> weights_;
+};
+
+// The log mel spectrogram of the PCM of [n_samples] or [batch, n_samples] into [batch, n_mel, frames], the same as
+// the preprocessing of Whisper: the STFT of the frames centered every hop_length samples, with the periodic Hann
+// window of n_fft and the reflection of the signal at its ends, the power spectrum, the mel filters and log10.
+// The last frame of the centered STFT is dropped, so frames is n_samples / hop_length.
+// With normalize, the log mel of every signal is clamped to 8 below its maximum and scaled by (x + 4) / 4.
+struct LogMelSpectrogram : public BaseKernel {
+ public:
+  LogMelSpectrogram(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+    int64_t n_fft = TryToGetAttributeWithDefault<int64_t>("n_fft", 400);
+    int64_t hop_length = TryToGetAttributeWithDefault<int64_t>("hop_length", 160);
+    int64_t n_mel = TryToGetAttributeWithDefault<int64_t>("n_mel", 80);
+    int64_t sampling_rate = TryToGetAttributeWithDefault<int64_t>("sampling_rate", 16000);
+    normalize_ = TryToGetAttributeWithDefault<int64_t>("normalize", 1) != 0;
+    if (n_fft <= 0 || hop_length <= 0 || n_mel <= 0 || sampling_rate <= 0) {
+      ORTX_CXX_API_THROW("[LogMelSpectrogram]: n_fft, hop_length, n_mel and sampling_rate should be positive.",
+                         ORT_INVALID_ARGUMENT);
+    }
+
+    num_threads_ = ReadNumThreadsAttribute(*this);
+
+    n_fft_ = static_cast<size_t>(n_fft);
+    hop_length_ = static_cast<size_t>(hop_length);
+    fft_ = RealFft::Get(n_fft_);
+    mel_ = std::make_shared<MelFilterBank>(n_fft_, static_cast<size_t>(n_mel), static_cast<double>(sampling_rate));
+    window_ = PeriodicHannWindow(n_fft_);
+  }
+
+  void Compute(const ortc::Tensor<float>& input, ortc::Tensor<float>& output) const {
+    auto& dims = input.Shape();
+    if (dims.size() != 1 && dims.size() != 2) {
+      ORTX_CXX_API_THROW("[LogMelSpectrogram]: Expect input dimension [n] or [batch, n].", ORT_INVALID_ARGUMENT);
+    }
+    const size_t batch = dims.size() == 1 ? 1 : static_cast<size_t>(dims[0]);
+    const size_t num_samples = static_cast<size_t>(dims.back());
+    const size_t frames = num_samples / hop_length_;
+    const size_t n_mel = mel_->NumMels();
+    const float* pcm = input.Data();
+    float* out = output.Allocate({static_cast<int64_t>(batch), static_cast<int64_t>(n_mel),
+                                  static_cast<int64_t>(frames)});
+
+    ParallelFor(batch * frames, num_threads_, [&](size_t begin, size_t end) {
+      std::vector<float> frame(n_fft_);
+      std::vector<RealFft::Complex> spectrum(fft_->NumBins());
+      std::vector<RealFft::Complex> work(fft_->WorkSize());
+      std::vector<float> power(mel_->PaddedBins(), 0.0f);
+      std::vector<float> mel(n_mel);
+      for (size_t task = begin; task < end; ++task) {
+        const size_t b = task / frames;
+        const size_t t = task % frames;
+        CenteredFrame(pcm + b * num_samples, num_samples, t, hop_length_, window_, frame.data());
+        fft_->Forward(frame.data(), spectrum.data(), work.data());
+        mel_->LogMel(spectrum.data(), power.data(), mel.data());
+
+        float* column = out + b * n_mel * frames + t;
+        for (size_t m = 0; m < n_mel; ++m) {
+          column[m * frames] = mel[m];
+        }
+      }
+    });
+
+    if (normalize_) {
+      const size_t size = n_mel * frames;
+      for (size_t b = 0; b < batch && size > 0; ++b) {
+        float* spec = out + b * size;
+        float floor = *std::max_element(spec, spec + size) - 8.0f;
+        for (size_t i = 0; i < size; ++i) {
+          spec[i] = (std::max(spec[i], floor) + 4.0f) / 4.0f;
+        }
+      }
+    }
+  }
+
+ private:
+  size_t n_fft_{};
+  size_t hop_length_{};
+  bool normalize_{};
+  size_t num_threads_{1};
+  std::shared_ptr<const RealFft> fft_;
+  std::shared_ptr<const MelFilterBank> mel_;
+  std::vector<float> window_;
+};
+
+// The log mel spectrogram of a stream of PCM chunks, the frames of LogMelSpectrogram without the normalization,
+// which needs the whole signal. The state of the stream is an input and an output of every call: it is [0] for a
+// new stream, and the state output of a call is the state input of the next one. A call computes only the frames
+// which have all their samples in the chunks so far, into [1, n_mel, frames], and the call with flush ends the
+// stream with the reflection at its end, after which the state output is [0] again. The frames of all the calls of a
+// stream are the frames of LogMelSpectrogram of the whole stream.
+struct LogMelSpectrogramStreaming : public BaseKernel {
+ public:
+  LogMelSpectrogramStreaming(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+    int64_t n_fft = TryToGetAttributeWithDefault<int64_t>("n_fft", 400);
+    int64_t hop_length = TryToGetAttributeWithDefault<int64_t>("hop_length", 160);
+    int64_t n_mel = TryToGetAttributeWithDefault<int64_t>("n_mel", 80);
+    int64_t sampling_rate = TryToGetAttributeWithDefault<int64_t>("sampling_rate", 16000);
+    if (n_fft <= 0 || hop_length <= 0 || n_mel <= 0 || sampling_rate <= 0) {
+      ORTX_CXX_API_THROW("[LogMelSpectrogramStreaming]: n_fft, hop_length, n_mel and sampling_rate should be positive.",
+                         ORT_INVALID_ARGUMENT);
+    }
+    n_fft_ = static_cast<size_t>(n_fft);
+    hop_length_ = static_cast<size_t>(hop_length);
+    mel_ = std::make_shared<MelFilterBank>(n_fft_, static_cast<size_t>(n_mel), static_cast<double>(sampling_rate));
+    window_ = PeriodicHannWindow(n_fft_);
+  }
+
+  void Compute(const ortc::Tensor<float>& input, const ortc::Tensor<float>& state, std::optional<bool> flush,
+               ortc::Tensor<float>& output, ortc::Tensor<float>& state_output) const {
+    auto& dims = input.Shape();
+    if (dims.size() > 2 || (dims.size() == 2 && dims[0] != 1)) {
+      ORTX_CXX_API_THROW("[LogMelSpectrogramStreaming]: Expect input dimension [n] or [1, n].", ORT_INVALID_ARGUMENT);
+    }
+
+    StftStream stream(n_fft_, hop_length_, window_);
+    stream.Restore(state.Data(), static_cast<size_t>(state.NumberOfElement()));
+
+    const size_t n_mel = mel_->NumMels();
+    std::vector<float> power(mel_->PaddedBins(), 0.0f);
+    std::vector<float> frames;
+    auto on_frame = [&](const StftStream::Complex* bins) {
+      frames.resize(frames.size() + n_mel);
+      mel_->LogMel(bins, power.data(), frames.data() + frames.size() - n_mel);
+    };
+    stream.Push(input.Data(), static_cast<size_t>(input.NumberOfElement()), on_frame);
+    if (flush.value_or(false)) {
+      // the last frame of the centered STFT, which LogMelSpectrogram drops, unless a hop longer than the half of
+      // n_fft has left no frame to the end of the stream
+      if (stream.Finish(on_frame) > 0) {
+        frames.resize(frames.size() - n_mel);
+      }
+    }
+
+    const size_t count = frames.size() / n_mel;
+    float* out = output.Allocate({1, static_cast<int64_t>(n_mel), static_cast<int64_t>(count)});
+    for (size_t t = 0; t < count; ++t) {
+      for (size_t m = 0; m < n_mel; ++m) {
+        out[m * count + t] = frames[t * n_mel + m];
+      }
+    }
+
+    std::vector<float> saved = stream.SaveState();
+    if (flush.value_or(false)) {
+      saved.clear();
+    }
+    float* state_out = state_output.Allocate({static_cast<int64_t>(saved.size())});
+    std::copy(saved.begin(), saved.end(), state_out);
+  }
+
+ private:
+  size_t n_fft_{};
+  size_t hop_length_{};
+  std::shared_ptr<const MelFilterBank> mel_;
+  std::vector<float> window_;
+};
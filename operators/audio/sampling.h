@@ -3,16 +3,56 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
 #include <cmath>
 #include <complex>
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include "narrow.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SAMPLING_USE_SSE
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SAMPLING_USE_NEON
+#include <arm_neon.h>
+#endif
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
+// The dot product of x and y, whose size is a multiple of 4.
+inline float DotProduct(const float* x, const float* y, size_t size) {
+#if defined(SAMPLING_USE_SSE)
+  __m128 sum = _mm_setzero_ps();
+  for (size_t k = 0; k < size; k += 4) {
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(x + k), _mm_loadu_ps(y + k)));
+  }
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+  return _mm_cvtss_f32(sum);
+#elif defined(SAMPLING_USE_NEON)
+  float32x4_t sum = vdupq_n_f32(0.0f);
+  for (size_t k = 0; k < size; k += 4) {
+    sum = vmlaq_f32(sum, vld1q_f32(x + k), vld1q_f32(y + k));
+  }
+  return vaddvq_f32(sum);
+#else
+  float sum[4] = {};
+  for (size_t k = 0; k < size; k += 4) {
+    for (size_t lane = 0; lane < 4; ++lane) {
+      sum[lane] += x[k + lane] * y[k + lane];
+    }
+  }
+  return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+#endif
+}
+
 // http://www.dspguide.com/CH33.PDF, p625
 class ButterworthLowpass {
  private:
@@ -106,9 +146,20 @@ class ButterworthLowpass {
   std::vector<double> coefs_b_;
 
  public:
-  ButterworthLowpass(double cutoff_freq, double sampling_rate) {
+  // The filter of the interleaved frames of the channels, in which every channel has its own delay elements.
+  ButterworthLowpass(double cutoff_freq, double sampling_rate, size_t channels = 1) : channels_(channels) {
     auto normalized_cutoff = cutoff_freq / sampling_rate;
     CalculateCoefs(coefs_b_, coefs_a_, kFilterOrder, normalized_cutoff);
+
+    // Every pole pair is a second order section, which is normalized to the unit gain at DC, so the cascade is the
+    // filter of the coefficients above, without the rounding of the high order polynomials.
+    for (size_t p = 0; p < kSections; ++p) {
+      double a[3]{}, b[3]{};
+      OnePoleCoefs(static_cast<double>(p + 1), kFilterOrder, normalized_cutoff, a, b);
+      double gain = (a[0] + a[1] + a[2]) / (1.0 - b[1] - b[2]);
+      sections_[p] = {a[0] / gain, a[1] / gain, a[2] / gain, -b[1], -b[2]};
+    }
+    state_.assign(kSections * 2 * channels_, 0.0);
   }
 
   const std::vector<double>& GetCoefs_A() {
@@ -119,84 +170,404 @@ class ButterworthLowpass {
     return coefs_b_;
   }
 
+  size_t Channels() const { return channels_; }
+
+  // Filters the interleaved samples of the channels in place, continuing from the delay elements of the previous
+  // block. The channels are filtered in the SIMD lanes two by two.
+  void ProcessBlock(float* samples, size_t size) {
+    const size_t frames = size / channels_;
+    if (channels_ == 1) {
+      ProcessBlock([samples](size_t i) { return samples[i]; }, samples, size);
+      return;
+    }
+
+    size_t c = 0;
+#if defined(SAMPLING_USE_SSE) || defined(SAMPLING_USE_NEON)
+    for (; c + 2 <= channels_; c += 2) {
+      ProcessPair(samples + c, frames, c);
+    }
+#endif
+    for (; c < channels_; ++c) {
+      float* channel = samples + c;
+      const size_t stride = channels_;
+      Filter([channel, stride](size_t i) { return channel[i * stride]; }, channel, stride, frames, c);
+    }
+  }
+
+  // Filters the samples of source(0) to source(size - 1) into output in one pass, so the input which is computed
+  // by the source, like a mix of the channels, isn't stored. output[i] may alias the input of source(i).
+  // The filter is of one channel.
+  template <typename Source>
+  void ProcessBlock(Source&& source, float* output, size_t size) {
+    Filter(std::forward<Source>(source), output, 1, size, 0);
+  }
+
+  void Reset() {
+    std::fill(state_.begin(), state_.end(), 0.0);
+  }
+
   std::vector<float> Process(const std::vector<float>& input) {
-    std::vector<float> output(input.size(), 0.0);
+    std::vector<float> output(input);
+    Reset();
+    ProcessBlock(output.data(), output.size());
+    return output;
+  }
+
+ private:
+  static constexpr size_t kSections = kFilterOrder / 2;
 
-    // Initialize delay elements
-    double x_n_1 = 0.0, x_n_2 = 0.0, x_n_3 = 0.0, x_n_4 = 0.0;
-    double y_n_1 = 0.0, y_n_2 = 0.0, y_n_3 = 0.0, y_n_4 = 0.0;
+  // H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+  struct Section {
+    double b0, b1, b2, a1, a2;
+  };
 
-    for (size_t i = 0; i < input.size(); ++i) {
-      double x = input[i];
+  // The delay elements of the section and the channel, in which the channels are next to each other.
+  double& State(size_t section, size_t k, size_t channel) {
+    return state_[(section * 2 + k) * channels_ + channel];
+  }
 
-      // Compute the output
-      double y = coefs_b_[0] * x + coefs_b_[1] * x_n_1 + coefs_b_[2] * x_n_2 + coefs_b_[3] * x_n_3 + coefs_b_[4] * x_n_4
-        - coefs_a_[1] * y_n_1 - coefs_a_[2] * y_n_2 - coefs_a_[3] * y_n_3 - coefs_a_[4] * y_n_4;
+  // The cascade of the sections in the transposed direct form II, of the samples output[i * stride].
+  template <typename Source>
+  void Filter(Source&& source, float* output, size_t stride, size_t size, size_t channel) {
+    double z[kSections][2];
+    for (size_t s = 0; s < kSections; ++s) {
+      z[s][0] = State(s, 0, channel);
+      z[s][1] = State(s, 1, channel);
+    }
 
-      // Shuffle old input and output values
-      x_n_4 = x_n_3;
-      x_n_3 = x_n_2;
-      x_n_2 = x_n_1;
-      x_n_1 = x;
+    for (size_t i = 0; i < size; ++i) {
+      double x = source(i);
+      for (size_t s = 0; s < kSections; ++s) {
+        const Section& f = sections_[s];
+        double y = f.b0 * x + z[s][0];
+        z[s][0] = f.b1 * x - f.a1 * y + z[s][1];
+        z[s][1] = f.b2 * x - f.a2 * y;
+        x = y;
+      }
+      output[i * stride] = static_cast<float>(x);
+    }
 
-      y_n_4 = y_n_3;
-      y_n_3 = y_n_2;
-      y_n_2 = y_n_1;
-      y_n_1 = y;
+    for (size_t s = 0; s < kSections; ++s) {
+      State(s, 0, channel) = z[s][0];
+      State(s, 1, channel) = z[s][1];
+    }
+  }
 
-      output[i] = static_cast<float>(y);
+#if defined(SAMPLING_USE_SSE)
+  // The channels c and c + 1 of the frames, in the two double lanes.
+  void ProcessPair(float* samples, size_t frames, size_t c) {
+    __m128d z[kSections][2];
+    for (size_t s = 0; s < kSections; ++s) {
+      z[s][0] = _mm_loadu_pd(&State(s, 0, c));
+      z[s][1] = _mm_loadu_pd(&State(s, 1, c));
     }
 
-    return output;
+    for (size_t i = 0; i < frames; ++i) {
+      float* frame = samples + i * channels_;
+      __m128d x = _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(frame))));
+      for (size_t s = 0; s < kSections; ++s) {
+        const Section& f = sections_[s];
+        __m128d y = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(f.b0), x), z[s][0]);
+        z[s][0] = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(_mm_set1_pd(f.b1), x), _mm_mul_pd(_mm_set1_pd(f.a1), y)), z[s][1]);
+        z[s][1] = _mm_sub_pd(_mm_mul_pd(_mm_set1_pd(f.b2), x), _mm_mul_pd(_mm_set1_pd(f.a2), y));
+        x = y;
+      }
+      _mm_storel_pi(reinterpret_cast<__m64*>(frame), _mm_cvtpd_ps(x));
+    }
+
+    for (size_t s = 0; s < kSections; ++s) {
+      _mm_storeu_pd(&State(s, 0, c), z[s][0]);
+      _mm_storeu_pd(&State(s, 1, c), z[s][1]);
+    }
+  }
+#elif defined(SAMPLING_USE_NEON)
+  // The channels c and c + 1 of the frames, in the two double lanes.
+  void ProcessPair(float* samples, size_t frames, size_t c) {
+    float64x2_t z[kSections][2];
+    for (size_t s = 0; s < kSections; ++s) {
+      z[s][0] = vld1q_f64(&State(s, 0, c));
+      z[s][1] = vld1q_f64(&State(s, 1, c));
+    }
+
+    for (size_t i = 0; i < frames; ++i) {
+      float* frame = samples + i * channels_;
+      float64x2_t x = vcvt_f64_f32(vld1_f32(frame));
+      for (size_t s = 0; s < kSections; ++s) {
+        const Section& f = sections_[s];
+        float64x2_t y = vfmaq_f64(z[s][0], x, vdupq_n_f64(f.b0));
+        z[s][0] = vfmsq_f64(vfmaq_f64(z[s][1], x, vdupq_n_f64(f.b1)), y, vdupq_n_f64(f.a1));
+        z[s][1] = vfmsq_f64(vmulq_f64(x, vdupq_n_f64(f.b2)), y, vdupq_n_f64(f.a2));
+        x = y;
+      }
+      vst1_f32(frame, vcvt_f32_f64(x));
+    }
+
+    for (size_t s = 0; s < kSections; ++s) {
+      vst1q_f64(&State(s, 0, c), z[s][0]);
+      vst1q_f64(&State(s, 1, c), z[s][1]);
+    }
+  }
+#endif
+
+  size_t channels_;
+  std::array<Section, kSections> sections_{};
+  // the delay elements of every section and channel
+  std::vector<double> state_;
+};
+
+// Mixes the interleaved frames of the channels into mono, with a weight of every channel, which is 1 / channels
+// by default.
+class ChannelMixer {
+ public:
+  explicit ChannelMixer(size_t channels, std::vector<float> weights = {})
+      : channels_(channels), weights_(std::move(weights)) {
+    if (weights_.empty()) {
+      weights_.assign(channels_, 1.0f / static_cast<float>(channels_));
+    }
+  }
+
+  size_t Channels() const { return channels_; }
+
+  float MixFrame(const float* frame) const {
+    float value = 0.0f;
+    for (size_t c = 0; c < channels_; ++c) {
+      value += frame[c] * weights_[c];
+    }
+    return value;
   }
+
+  // Mixes the frames into the mono samples, which may be in place of the frames.
+  void Mix(const float* frames, size_t num_frames, float* mono) const {
+    size_t i = 0;
+    if (channels_ == 2) {
+#if defined(SAMPLING_USE_SSE)
+      const __m128 w0 = _mm_set1_ps(weights_[0]);
+      const __m128 w1 = _mm_set1_ps(weights_[1]);
+      for (; i + 4 <= num_frames; i += 4) {
+        __m128 a = _mm_loadu_ps(frames + i * 2);
+        __m128 b = _mm_loadu_ps(frames + i * 2 + 4);
+        __m128 left = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 right = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        _mm_storeu_ps(mono + i, _mm_add_ps(_mm_mul_ps(left, w0), _mm_mul_ps(right, w1)));
+      }
+#elif defined(SAMPLING_USE_NEON)
+      for (; i + 4 <= num_frames; i += 4) {
+        float32x4x2_t lr = vld2q_f32(frames + i * 2);
+        vst1q_f32(mono + i, vaddq_f32(vmulq_n_f32(lr.val[0], weights_[0]), vmulq_n_f32(lr.val[1], weights_[1])));
+      }
+#endif
+    }
+
+    for (; i < num_frames; ++i) {
+      mono[i] = MixFrame(frames + i * channels_);
+    }
+  }
+
+ private:
+  size_t channels_;
+  std::vector<float> weights_;
 };
 
 // https://ccrma.stanford.edu/~jos/sasp/Kaiser_Window.html
+// A polyphase resampler. With the ratio L/M of the two rates in the lowest terms, the output sample i is at
+// the input position i * M / L, whose fraction is one of the L phases, so the Kaiser windowed sinc taps of all
+// the phases are computed once, and shared by all the calls with the same rates.
 class KaiserWindowInterpolation {
  private:
   // Kaiser window parameters, empirically
   static constexpr double kBeta = 6.0;  // Beta controls the width of the transition band
+  // the most phases in a filter bank, above which the taps are computed for every output sample.
+  static constexpr int64_t kMaxPhases = 4096;
+
+  struct FilterBank {
+    int64_t up = 0;         // L
+    int64_t down = 0;       // M
+    int range = 0;          // the taps are the input samples [integer position - range, integer position + range]
+    size_t num_taps = 0;    // 2 * range + 1, rounded up to a multiple of 4 with zeros
+    std::vector<float> taps;  // num_taps of every phase
+  };
 
  public:
-  static void Process(const std::vector<float>& input, std::vector<float>& output, float inputSampleRate, float outputSampleRate) {
+  // The number of the output samples of num_samples input samples.
+  static size_t OutputSize(size_t num_samples, float inputSampleRate, float outputSampleRate) {
+    float factor = outputSampleRate / inputSampleRate;
+    return static_cast<size_t>(std::ceil(static_cast<float>(num_samples) * factor));
+  }
+
+  // A resampler of a stream, which is given the input block by block, and only keeps the input samples of the
+  // windows which haven't been output yet. The output is the same as that of Process on the whole input.
+  KaiserWindowInterpolation(float inputSampleRate, float outputSampleRate)
+      : input_rate_(inputSampleRate), output_rate_(outputSampleRate) {
     // Downsampling factor
     float factor = outputSampleRate / inputSampleRate;
 
-    // Calculate the number of output samples
-    int outputSize = static_cast<int>(std::ceil(static_cast<float>(input.size()) * factor));
-    output.resize(outputSize);
+    // Calculate the range of input samples for interpolation
+    range_ = static_cast<int>(std::ceil(kBeta / (2.0 * factor)));
 
-    for (size_t i = 0; i < outputSize; i++) {
-      float index = i / factor;  // Fractional index for interpolation
+    bank_ = GetFilterBank(inputSampleRate, outputSampleRate, range_);
+    if (bank_) {
+      num_taps_ = static_cast<int64_t>(bank_->num_taps);
+    } else {
+      // the rates have no small ratio, so the sinc is evaluated for every sample with a window of the interior.
+      window_ = KaiserWin(2 * static_cast<size_t>(range_) + 1);
+      num_taps_ = 2 * range_ + 1;
+    }
+  }
 
-      // Calculate the integer and fractional parts of the index
-      int integerPart = static_cast<int>(index);
-      float fractionalPart = index - integerPart;
+  // Appends the output samples of the next block of the input whose windows are complete.
+  void Push(const float* input, size_t size, std::vector<float>& output) {
+    const bool buffered = !history_.empty();
+    const float* data = input;
+    if (buffered) {
+      history_.insert(history_.end(), input, input + size);
+      data = history_.data();
+    } else {
+      base_ = received_;
+    }
+    received_ += static_cast<int64_t>(size);
 
-      // Calculate the range of input samples for interpolation
-      int range = static_cast<int>(std::ceil(kBeta / (2.0 * factor)));
-      size_t startSample = std::max(0, integerPart - range);
-      size_t endSample = std::min(static_cast<int>(input.size()) - 1, integerPart + range);
+    Emit(data, false, output);
 
-      // Calculate the Kaiser window weights for the input samples
-      std::vector<double> weights = KaiserWin(static_cast<size_t>(endSample - startSample + 1));
-      for (size_t j = startSample; j <= endSample; j++) {
-        double distance = std::abs(static_cast<double>(j) - index);
-        double sincValue = (distance < 1e-6f) ? 1.0f : std::sin(M_PI * distance) / (M_PI * distance);
-        weights[j - startSample] *= sincValue;
-      }
+    // keep the input samples from the window of the next output sample
+    int64_t keep = std::min(received_, std::max(base_, IntegerPart(next_) - range_));
+    if (buffered) {
+      history_.erase(history_.begin(), history_.begin() + (keep - base_));
+    } else {
+      history_.assign(input + (keep - base_), input + size);
+    }
+    base_ = keep;
+  }
+
+  // Appends the rest of the output samples at the end of the input.
+  void Finish(std::vector<float>& output) {
+    Emit(history_.data(), true, output);
+    history_.clear();
+  }
 
-      // Perform the interpolation
-      double interpolatedValue = 0.0f;
-      for (size_t j = startSample; j <= endSample; j++) {
-        interpolatedValue += input[j] * weights[j - startSample];
+  static void Process(const std::vector<float>& input, std::vector<float>& output, float inputSampleRate, float outputSampleRate) {
+    KaiserWindowInterpolation resampler(inputSampleRate, outputSampleRate);
+    output.clear();
+    output.reserve(OutputSize(input.size(), inputSampleRate, outputSampleRate));
+    resampler.Push(input.data(), input.size(), output);
+    resampler.Finish(output);
+  }
+
+ private:
+  int64_t IntegerPart(size_t i) const {
+    if (bank_) {
+      return static_cast<int64_t>(i) * bank_->down / bank_->up;
+    }
+    return static_cast<int64_t>(i * step());
+  }
+
+  double step() const { return static_cast<double>(input_rate_) / output_rate_; }
+
+  // Outputs the samples whose windows are in data, the input samples from base_ to received_. A window cut by
+  // an end of the input is only final at the start of the input, or at its end.
+  void Emit(const float* data, bool at_end, std::vector<float>& output) {
+    const size_t output_size = OutputSize(static_cast<size_t>(received_), input_rate_, output_rate_);
+    for (; next_ < output_size; ++next_) {
+      int64_t integer_part = IntegerPart(next_);
+      double index = 0.0;  // Fractional index for interpolation
+      const float* taps = nullptr;
+      if (bank_) {
+        int64_t position = static_cast<int64_t>(next_) * bank_->down;
+        index = static_cast<double>(position) / bank_->up;
+        taps = bank_->taps.data() + (position % bank_->up) * bank_->num_taps;
+      } else {
+        index = next_ * step();
       }
 
-      output[i] = static_cast<float>(interpolatedValue);
+      int64_t start = integer_part - range_;
+      if (start >= 0 && start + num_taps_ <= received_) {
+        const float* x = data + (start - base_);
+        if (taps != nullptr) {
+          output.push_back(DotProduct(x, taps, bank_->num_taps));
+        } else {
+          double value = 0.0;
+          for (int k = 0; k <= 2 * range_; ++k) {
+            value += x[k] * window_[k] * Sinc(std::abs(k - range_ - (index - integer_part)));
+          }
+          output.push_back(static_cast<float>(value));
+        }
+      } else if (at_end || (start < 0 && integer_part + range_ < received_)) {
+        // the window is cut by the ends of the input
+        output.push_back(InterpolateAt(data, base_, received_, index, range_));
+      } else {
+        break;
+      }
     }
   }
 
  private:
+  static double Sinc(double distance) {
+    return (distance < 1e-6f) ? 1.0f : std::sin(M_PI * distance) / (M_PI * distance);
+  }
+
+  // Interpolates at the fractional index with the window of the input samples around it, which is shorter
+  // than 2 * range + 1 at the ends of the input. data holds the input samples from base to size.
+  static float InterpolateAt(const float* data, int64_t base, int64_t size, double index, int range) {
+    // Calculate the integer and fractional parts of the index
+    int64_t integerPart = static_cast<int64_t>(index);
+
+    int64_t startSample = std::max<int64_t>(0, integerPart - range);
+    int64_t endSample = std::min<int64_t>(size - 1, integerPart + range);
+    if (startSample > endSample) {
+      return 0.0f;
+    }
+
+    // Calculate the Kaiser window weights for the input samples
+    std::vector<double> weights = KaiserWin(static_cast<size_t>(endSample - startSample + 1));
+
+    // Perform the interpolation
+    double interpolatedValue = 0.0f;
+    for (int64_t j = startSample; j <= endSample; j++) {
+      double distance = std::abs(static_cast<double>(j) - index);
+      interpolatedValue += data[j - base] * weights[j - startSample] * Sinc(distance);
+    }
+
+    return static_cast<float>(interpolatedValue);
+  }
+
+  // Returns the filter bank of the rates, or nullptr if they aren't integers of a small enough ratio.
+  static std::shared_ptr<const FilterBank> GetFilterBank(double input_rate, double output_rate, int range) {
+    if (input_rate <= 0 || output_rate <= 0 || input_rate != std::floor(input_rate) ||
+        output_rate != std::floor(output_rate)) {
+      return nullptr;
+    }
+    int64_t in = static_cast<int64_t>(input_rate);
+    int64_t out = static_cast<int64_t>(output_rate);
+    int64_t divisor = std::gcd(in, out);
+    int64_t up = out / divisor;
+    int64_t down = in / divisor;
+    if (up > kMaxPhases) {
+      return nullptr;
+    }
+
+    static std::mutex mutex;
+    static std::map<std::pair<int64_t, int64_t>, std::shared_ptr<const FilterBank>> banks;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& bank = banks[{in, out}];
+    if (!bank) {
+      auto new_bank = std::make_shared<FilterBank>();
+      new_bank->up = up;
+      new_bank->down = down;
+      new_bank->range = range;
+      new_bank->num_taps = (2 * static_cast<size_t>(range) + 1 + 3) / 4 * 4;
+      new_bank->taps.resize(static_cast<size_t>(up) * new_bank->num_taps);
+      std::vector<double> window = KaiserWin(2 * static_cast<size_t>(range) + 1);
+      for (int64_t phase = 0; phase < up; ++phase) {
+        float* taps = new_bank->taps.data() + phase * new_bank->num_taps;
+        double fraction = static_cast<double>(phase) / up;
+        for (int k = 0; k <= 2 * range; ++k) {
+          taps[k] = static_cast<float>(window[k] * Sinc(std::abs(k - range - fraction)));
+        }
+      }
+      bank = std::move(new_bank);
+    }
+    return bank;
+  }
+
   // std::cyl_bessel_i is not available for every platform.
   static double cyl_bessel_i0(double x) {
     double sum = 0.0;
@@ -220,11 +591,22 @@ class KaiserWindowInterpolation {
     static const double i0_beta = cyl_bessel_i0(kBeta);
 
     for (size_t i = 0; i < window_length; i++) {
-      double x = 2.0 * i / (window_length - 1.0) - 1.0;
+      double x = window_length > 1 ? 2.0 * i / (window_length - 1.0) - 1.0 : 0.0;
       double bessel_value = cyl_bessel_i0(kBeta * std::sqrt(1 - x * x));
       window[i] = bessel_value / i0_beta;
     }
 
     return window;
   }
+
+  float input_rate_;
+  float output_rate_;
+  int range_ = 0;
+  int64_t num_taps_ = 0;  // the input samples read for an output sample in the interior
+  std::shared_ptr<const FilterBank> bank_;
+  std::vector<double> window_;  // the window of the interior without a filter bank
+  std::vector<float> history_;  // the input samples from base_ which are still needed
+  int64_t base_ = 0;
+  int64_t received_ = 0;  // the number of the input samples so far
+  size_t next_ = 0;       // the next output sample
 };
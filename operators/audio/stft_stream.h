@@ -0,0 +1,150 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+
+#include <memory>
+#include <vector>
+
+#include "fft.h"
+
+// The STFT of a stream of samples which arrive chunk by chunk, the same frames as the STFT of the whole stream with
+// center=True and pad_mode="reflect": the frames of n_fft samples are centered every hop_length samples, and the
+// signal is reflected at its both ends. A frame is computed once when all its samples have arrived, and only the
+// samples which the next frames need are kept, so every sample is in the FFTs of n_fft / hop_length frames at most.
+// The state may be saved into a float vector and restored, for the streams which are passed between the calls of
+// a kernel.
+class StftStream {
+ public:
+  using Complex = RealFft::Complex;
+
+  // The window has n_fft values.
+  StftStream(size_t n_fft, size_t hop_length, std::vector<float> window)
+      : n_fft_(n_fft), hop_length_(hop_length), window_(std::move(window)), fft_(RealFft::Get(n_fft)) {
+    if (n_fft == 0 || hop_length == 0 || window_.size() != n_fft) {
+      ORTX_CXX_API_THROW("[StftStream]: Expect positive n_fft and hop_length, and a window of n_fft.",
+                         ORT_INVALID_ARGUMENT);
+    }
+    frame_.resize(n_fft_);
+    spectrum_.resize(fft_->NumBins());
+    work_.resize(fft_->WorkSize());
+  }
+
+  size_t FftSize() const { return n_fft_; }
+  size_t HopLength() const { return hop_length_; }
+  size_t NumBins() const { return fft_->NumBins(); }
+
+  // Appends the samples to the stream, and calls on_frame(const Complex* bins) with the NumBins() bins of every
+  // frame which is complete now, in order. Returns the number of the frames.
+  template <typename F>
+  size_t Push(const float* samples, size_t size, F&& on_frame) {
+    history_.insert(history_.end(), samples, samples + size);
+    const size_t half = n_fft_ / 2;
+    size_t frames = 0;
+    // the reflection of the first frames reads the samples up to history_[half]
+    while (center_ + n_fft_ - half <= history_.size() && history_.size() > half) {
+      ComputeFrame(on_frame);
+      ++frames;
+    }
+
+    // the next frame begins at center_ - half, and n_fft samples before center_ are kept for the reflection at
+    // the end of the stream
+    if (center_ > n_fft_) {
+      const size_t drop = center_ - n_fft_;
+      history_.erase(history_.begin(), history_.begin() + drop);
+      center_ -= drop;
+      at_start_ = false;
+    }
+    return frames;
+  }
+
+  // Ends the stream, in which the rest of the frames are computed with the reflection at the end of the stream, and
+  // begins a new one. The stream of n samples has n / hop_length + 1 frames in all.
+  template <typename F>
+  size_t Finish(F&& on_frame) {
+    if (at_start_ && history_.size() <= n_fft_ / 2) {
+      ORTX_CXX_API_THROW("[StftStream]: The stream is shorter than the reflection padding of the frames.",
+                         ORT_INVALID_ARGUMENT);
+    }
+    size_t frames = 0;
+    while (center_ <= history_.size()) {
+      ComputeFrame(on_frame);
+      ++frames;
+    }
+    Reset();
+    return frames;
+  }
+
+  void Reset() {
+    history_.clear();
+    center_ = 0;
+    at_start_ = true;
+  }
+
+  // The state of the stream, which Restore() continues from.
+  std::vector<float> SaveState() const {
+    std::vector<float> state{static_cast<float>(n_fft_), static_cast<float>(hop_length_),
+                             static_cast<float>(center_), at_start_ ? 1.0f : 0.0f};
+    state.insert(state.end(), history_.begin(), history_.end());
+    return state;
+  }
+
+  // Restores the state of SaveState(), in which an empty state begins a new stream.
+  void Restore(const float* state, size_t size) {
+    Reset();
+    if (size == 0) {
+      return;
+    }
+    if (size < kStateHeader || state[0] != static_cast<float>(n_fft_) ||
+        state[1] != static_cast<float>(hop_length_) || state[2] < 0 || state[2] > n_fft_ + hop_length_) {
+      ORTX_CXX_API_THROW("[StftStream]: The state isn't of a stream with the same n_fft and hop_length.",
+                         ORT_INVALID_ARGUMENT);
+    }
+    center_ = static_cast<size_t>(state[2]);
+    at_start_ = state[3] != 0;
+    history_.assign(state + kStateHeader, state + size);
+  }
+
+ private:
+  static constexpr size_t kStateHeader = 4;
+
+  template <typename F>
+  void ComputeFrame(F&& on_frame) {
+    const int64_t start = static_cast<int64_t>(center_) - static_cast<int64_t>(n_fft_ / 2);
+    const int64_t last = static_cast<int64_t>(history_.size()) - 1;
+    if (start >= 0 && start + static_cast<int64_t>(n_fft_) <= last + 1) {
+      for (size_t i = 0; i < n_fft_; ++i) {
+        frame_[i] = history_[start + i] * window_[i];
+      }
+    } else {
+      for (size_t i = 0; i < n_fft_; ++i) {
+        int64_t index = start + static_cast<int64_t>(i);
+        if (index < 0) {
+          index = -index;  // only before the first sample of the stream
+        }
+        if (index > last) {
+          index = 2 * last - index;  // only at the end of the stream
+        }
+        frame_[i] = history_[static_cast<size_t>(index)] * window_[i];
+      }
+    }
+    fft_->Forward(frame_.data(), spectrum_.data(), work_.data());
+    on_frame(static_cast<const Complex*>(spectrum_.data()));
+    center_ += hop_length_;
+  }
+
+  size_t n_fft_;
+  size_t hop_length_;
+  std::vector<float> window_;
+  std::shared_ptr<const RealFft> fft_;
+
+  std::vector<float> history_;  // the samples from the first one which the next frames need
+  size_t center_{};             // the sample at the center of the next frame in history_
+  bool at_start_{true};         // history_ begins at the first sample of the stream
+
+  std::vector<float> frame_;
+  std::vector<Complex> spectrum_;
+  std::vector<Complex> work_;
+};
@@ -0,0 +1,191 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "log_mel.hpp"
+#include "parallel_for.h"
+
+// The energy and the zero-crossing rate of the frames of the centered STFT of LogMelSpectrogram, the frames of n_fft
+// samples centered every hop_length samples with the reflection at the ends of the signal, multiplied by the window.
+// The energy is the mean square of a frame weighted by the window, which is the sum of its power spectrum scaled by
+// Parseval, in dB of the full scale, and the zero-crossing rate is the share of the pairs of the adjacent samples of
+// the frame of the opposite signs. A signal of n samples has ceil(n / hop_length) frames, which cover all of it.
+struct FrameStatistics {
+  std::vector<float> energy_db;
+  std::vector<float> zero_crossing_rate;
+
+  FrameStatistics(const float* x, size_t num_samples, size_t hop_length, const std::vector<float>& window,
+                  size_t num_threads) {
+    const size_t frames = (num_samples + hop_length - 1) / hop_length;
+    const size_t n_fft = window.size();
+    double window_power = 0.0;
+    for (float w : window) {
+      window_power += static_cast<double>(w) * w;
+    }
+    energy_db.resize(frames);
+    zero_crossing_rate.resize(frames);
+    ParallelFor(frames, num_threads, [&](size_t begin, size_t end) {
+      std::vector<float> frame(n_fft);
+      for (size_t t = begin; t < end; ++t) {
+        CenteredFrame(x, num_samples, t, hop_length, window, frame.data());
+        double power = 0.0;
+        size_t crossings = 0;
+        for (size_t i = 0; i < n_fft; ++i) {
+          power += static_cast<double>(frame[i]) * frame[i];
+          crossings += i > 0 && frame[i - 1] * frame[i] < 0.0f;
+        }
+        energy_db[t] = static_cast<float>(10.0 * std::log10(std::max(power / window_power, 1e-10)));
+        zero_crossing_rate[t] = n_fft > 1 ? static_cast<float>(crossings) / static_cast<float>(n_fft - 1) : 0.0f;
+      }
+    });
+  }
+};
+
+// A voice activity detector of the energy and the zero-crossing rate of the frames. A frame is speech if its energy
+// is at least the threshold, which is threshold_db below the loudest frame of the signal but not below
+// min_energy_db, or if it's a frame of an unvoiced sound, whose energy is less than zcr_margin_db below the threshold
+// with a zero-crossing rate of zcr_threshold at least. The runs of the speech frames are the segments, in which the
+// gaps shorter than min_silence are filled, the segments shorter than min_speech are dropped, and the rest are
+// padded by speech_pad at their both ends. The durations are in samples.
+struct VoiceActivityOptions {
+  size_t frame_length = 400;
+  size_t hop_length = 160;
+  float threshold_db = -35.0f;
+  float min_energy_db = -60.0f;
+  float zcr_threshold = 0.3f;
+  float zcr_margin_db = 10.0f;
+  size_t min_speech = 4000;
+  size_t min_silence = 4800;
+  size_t speech_pad = 1600;
+};
+
+// Returns the [begin, end) samples of the speech segments of the signal, in order and not overlapping.
+inline std::vector<std::pair<size_t, size_t>> DetectVoiceActivity(const float* x, size_t num_samples,
+                                                                  const VoiceActivityOptions& options,
+                                                                  const std::vector<float>& window,
+                                                                  size_t num_threads) {
+  std::vector<std::pair<size_t, size_t>> segments;
+  if (num_samples == 0) {
+    return segments;
+  }
+
+  const FrameStatistics stats(x, num_samples, options.hop_length, window, num_threads);
+  const float loudest = *std::max_element(stats.energy_db.begin(), stats.energy_db.end());
+  const float threshold = std::max(loudest + options.threshold_db, options.min_energy_db);
+  const size_t frames = stats.energy_db.size();
+  for (size_t t = 0; t < frames;) {
+    auto is_speech = [&](size_t i) {
+      const float db = stats.energy_db[i];
+      return db >= threshold ||
+             (db >= threshold - options.zcr_margin_db && stats.zero_crossing_rate[i] >= options.zcr_threshold);
+    };
+    if (!is_speech(t)) {
+      ++t;
+      continue;
+    }
+    size_t end = t + 1;
+    while (end < frames && is_speech(end)) {
+      ++end;
+    }
+    const size_t begin_sample = t * options.hop_length;
+    const size_t end_sample = std::min(end * options.hop_length, num_samples);
+    if (!segments.empty() && begin_sample - segments.back().second < options.min_silence) {
+      segments.back().second = end_sample;
+    } else {
+      segments.emplace_back(begin_sample, end_sample);
+    }
+    t = end;
+  }
+
+  std::vector<std::pair<size_t, size_t>> padded;
+  for (auto [begin, end] : segments) {
+    if (end - begin < options.min_speech) {
+      continue;
+    }
+    begin = begin > options.speech_pad ? begin - options.speech_pad : 0;
+    end = std::min(end + options.speech_pad, num_samples);
+    if (!padded.empty() && begin <= padded.back().second) {
+      padded.back().second = end;
+    } else {
+      padded.emplace_back(begin, end);
+    }
+  }
+  return padded;
+}
+
+// Detects the speech segments of the PCM of [n] or [1, n], like the output of AudioDecoder, by DetectVoiceActivity:
+// segments is [segments, 2] of the begin and the end samples of each one, and the optional speech output is the
+// samples of all the segments, [1, samples], so a speech model skips the silence of a long recording. The frames are
+// the ones of LogMelSpectrogram, of n_fft and hop_length, and the durations are in milliseconds.
+struct VoiceActivityDetection : public BaseKernel {
+ public:
+  VoiceActivityDetection(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+    int64_t n_fft = TryToGetAttributeWithDefault<int64_t>("n_fft", 400);
+    int64_t hop_length = TryToGetAttributeWithDefault<int64_t>("hop_length", 160);
+    int64_t sampling_rate = TryToGetAttributeWithDefault<int64_t>("sampling_rate", 16000);
+    int64_t min_speech_ms = TryToGetAttributeWithDefault<int64_t>("min_speech_duration_ms", 250);
+    int64_t min_silence_ms = TryToGetAttributeWithDefault<int64_t>("min_silence_duration_ms", 300);
+    int64_t speech_pad_ms = TryToGetAttributeWithDefault<int64_t>("speech_pad_ms", 100);
+    if (n_fft <= 0 || hop_length <= 0 || sampling_rate <= 0) {
+      ORTX_CXX_API_THROW("[VoiceActivityDetection]: n_fft, hop_length and sampling_rate should be positive.",
+                         ORT_INVALID_ARGUMENT);
+    }
+    if (min_speech_ms < 0 || min_silence_ms < 0 || speech_pad_ms < 0) {
+      ORTX_CXX_API_THROW("[VoiceActivityDetection]: the durations shouldn't be negative.", ORT_INVALID_ARGUMENT);
+    }
+
+    options_.frame_length = static_cast<size_t>(n_fft);
+    options_.hop_length = static_cast<size_t>(hop_length);
+    options_.threshold_db = TryToGetAttributeWithDefault<float>("threshold_db", options_.threshold_db);
+    options_.min_energy_db = TryToGetAttributeWithDefault<float>("min_energy_db", options_.min_energy_db);
+    options_.zcr_threshold = TryToGetAttributeWithDefault<float>("zcr_threshold", options_.zcr_threshold);
+    options_.zcr_margin_db = TryToGetAttributeWithDefault<float>("zcr_margin_db", options_.zcr_margin_db);
+    auto to_samples = [sampling_rate](int64_t ms) { return static_cast<size_t>(ms * sampling_rate / 1000); };
+    options_.min_speech = to_samples(min_speech_ms);
+    options_.min_silence = to_samples(min_silence_ms);
+    options_.speech_pad = to_samples(speech_pad_ms);
+
+    num_threads_ = ReadNumThreadsAttribute(*this);
+    window_ = PeriodicHannWindow(options_.frame_length);
+  }
+
+  void Compute(const ortc::Tensor<float>& input, ortc::Tensor<int64_t>& segments,
+               std::optional<ortc::Tensor<float>*> speech) const {
+    auto& dims = input.Shape();
+    if (dims.size() > 2 || (dims.size() == 2 && dims[0] != 1)) {
+      ORTX_CXX_API_THROW("[VoiceActivityDetection]: Expect input dimension [n] or [1, n].", ORT_INVALID_ARGUMENT);
+    }
+    const float* pcm = input.Data();
+    const size_t num_samples = static_cast<size_t>(input.NumberOfElement());
+    const auto detected = DetectVoiceActivity(pcm, num_samples, options_, window_, num_threads_);
+
+    int64_t* out = segments.Allocate({static_cast<int64_t>(detected.size()), 2});
+    size_t speech_samples = 0;
+    for (size_t i = 0; i < detected.size(); ++i) {
+      out[2 * i] = static_cast<int64_t>(detected[i].first);
+      out[2 * i + 1] = static_cast<int64_t>(detected[i].second);
+      speech_samples += detected[i].second - detected[i].first;
+    }
+
+    if (speech.has_value() && *speech != nullptr) {
+      float* compact = (*speech)->Allocate({1, static_cast<int64_t>(speech_samples)});
+      for (auto [begin, end] : detected) {
+        compact = std::copy(pcm + begin, pcm + end, compact);
+      }
+    }
+  }
+
+ private:
+  VoiceActivityOptions options_;
+  size_t num_threads_{1};
+  std::vector<float> window_;
+};
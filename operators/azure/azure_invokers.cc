@@ -26,7 +26,7 @@ void AzureAudioToTextInvoker::ValidateInputs(const ortc::Variadic& inputs) const
 
 void AzureAudioToTextInvoker::SetupRequest(CurlHandler& curl_handler, const ortc::Variadic& inputs) const {
   // theoretically the filename the content was buffered from
-  static const std::string fake_filename = "audio." + audio_format_;
+  const std::string fake_filename = "audio." + audio_format_;
 
   const auto& property_names = RequestPropertyNames();
 
@@ -83,8 +83,7 @@ void AzureTextToTextInvoker::SetupRequest(CurlHandler& curl_handler, const ortc:
   curl_handler.AddHeader("Content-Type: application/json");
 
   const auto& text_input = inputs[1];
-  curl_handler.SetOption(CURLOPT_POSTFIELDS, text_input->DataRaw());
-  curl_handler.SetOption(CURLOPT_POSTFIELDSIZE_LARGE, text_input->SizeInBytes());
+  curl_handler.SetPostBody(text_input->DataRaw(), text_input->SizeInBytes(), CompressRequest());
 }
 
 void AzureTextToTextInvoker::ProcessResponse(const std::string& response, ortc::Variadic& outputs) const {
@@ -92,6 +91,12 @@ void AzureTextToTextInvoker::ProcessResponse(const std::string& response, ortc::
   string_tensor.SetStringOutput(std::vector<std::string>{response}, std::vector<int64_t>{1});
 }
 
+void AzureTextToTextInvoker::ProcessEvents(std::vector<std::string>& events, ortc::Variadic& outputs) const {
+  auto& string_tensor = outputs.AllocateStringTensor(0);
+  const int64_t num_events = static_cast<int64_t>(events.size());
+  string_tensor.SetStringOutput(events, std::vector<int64_t>{num_events});
+}
+
 std::string AzureTextToTextInvoker::ComposeFullAuthToken(const std::string& auth_token) const {
   return std::string{"api-key: "} + auth_token;
 }
@@ -36,7 +36,7 @@ class AzureAudioToTextInvoker : public CurlInvoker {
 
 /// Azure Text to Text
 /// Input: auth_token {string}, text {string}
-/// Output: text {string}
+/// Output: text {string}, or the data of each event of a streamed response {string}
 struct AzureTextToTextInvoker : public CurlInvoker {
   AzureTextToTextInvoker(const OrtApi& api, const OrtKernelInfo& info);
 
@@ -49,6 +49,7 @@ struct AzureTextToTextInvoker : public CurlInvoker {
   void ValidateInputs(const ortc::Variadic& inputs) const override;
   void SetupRequest(CurlHandler& curl_handler, const ortc::Variadic& inputs) const override;
   void ProcessResponse(const std::string& response, ortc::Variadic& outputs) const override;
+  void ProcessEvents(std::vector<std::string>& events, ortc::Variadic& outputs) const override;
   std::string ComposeFullAuthToken(const std::string& auth_token) const override;
 };
 
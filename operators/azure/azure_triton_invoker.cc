@@ -4,198 +4,697 @@
 #include "azure_triton_invoker.hpp"
 #include "string_utils.h"
 
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
+#ifdef AZURE_INVOKERS_ENABLE_TRITON_GRPC
+#include <condition_variable>
+#include <future>
+#endif
+
 ////////////////////// AzureTritonInvoker //////////////////////
 
 namespace tc = triton::client;
 
 namespace ort_extensions {
 
-AzureTritonInvoker::AzureTritonInvoker(const OrtApi& api, const OrtKernelInfo& info)
-    : CloudBaseKernel(api, info) {
-  auto err = tc::InferenceServerHttpClient::Create(&triton_client_, ModelUri(), Verbose());
-}
+namespace {
+#define CHECK_TRITON_ERR(ret, msg)                                                                          \
+  if (!ret.IsOk()) {                                                                                        \
+    ORTX_CXX_API_THROW(MakeString("Error: ", msg, ", Triton err: ", ret.Message()), ORT_RUNTIME_EXCEPTION); \
+  }
 
-std::string MapDataType(ONNXTensorElementDataType onnx_data_type) {
-  std::string triton_data_type;
+const char* MapDataType(ONNXTensorElementDataType onnx_data_type) {
   switch (onnx_data_type) {
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
-      triton_data_type = "FP32";
-      break;
+      return "FP32";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
-      triton_data_type = "UINT8";
-      break;
+      return "UINT8";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8:
-      triton_data_type = "INT8";
-      break;
+      return "INT8";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16:
-      triton_data_type = "UINT16";
-      break;
+      return "UINT16";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16:
-      triton_data_type = "INT16";
-      break;
+      return "INT16";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
-      triton_data_type = "INT32";
-      break;
+      return "INT32";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
-      triton_data_type = "INT64";
-      break;
+      return "INT64";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING:
-      triton_data_type = "BYTES";
-      break;
+      return "BYTES";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL:
-      triton_data_type = "BOOL";
-      break;
+      return "BOOL";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
-      triton_data_type = "FP16";
-      break;
+      return "FP16";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE:
-      triton_data_type = "FP64";
-      break;
+      return "FP64";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32:
-      triton_data_type = "UINT32";
-      break;
+      return "UINT32";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64:
-      triton_data_type = "UINT64";
-      break;
+      return "UINT64";
     case ONNX_TENSOR_ELEMENT_DATA_TYPE_BFLOAT16:
-      triton_data_type = "BF16";
-      break;
+      return "BF16";
     default:
-      break;
+      return nullptr;
   }
-  return triton_data_type;
 }
 
-int8_t* CreateNonStrTensor(const std::string& data_type,
-                           ortc::Variadic& outputs,
-                           size_t i,
-                           const std::vector<int64_t>& shape) {
-  if (data_type == "FP32") {
-    return reinterpret_cast<int8_t*>(outputs.AllocateOutput<float>(i, shape));
-  } else if (data_type == "UINT8") {
-    return reinterpret_cast<int8_t*>(outputs.AllocateOutput<uint8_t>(i, shape));
-  } else if (data_type == "INT8") {
-    return reinterpret_cast<int8_t*>(outputs.AllocateOutput<int8_t>(i, shape));
-  } else if (data_type == "UINT16") {
-    return reinterpret_cast<int8_t*>(outputs.AllocateOutput<uint16_t>(i, shape));
-  } else if (data_type == "INT16") {
-    return reinterpret_cast<int8_t*>(outputs.AllocateOutput<int16_t>(i, shape));
-  } else if (data_type == "INT32") {
-    return reinterpret_cast<int8_t*>(outputs.AllocateOutput<int32_t>(i, shape));
-  } else if (data_type == "UINT32") {
-    return reinterpret_cast<int8_t*>(outputs.AllocateOutput<uint32_t>(i, shape));
-  } else if (data_type == "INT64") {
-    return reinterpret_cast<int8_t*>(outputs.AllocateOutput<int64_t>(i, shape));
-  } else if (data_type == "UINT64") {
-    return reinterpret_cast<int8_t*>(outputs.AllocateOutput<uint64_t>(i, shape));
-  } else if (data_type == "BOOL") {
-    return reinterpret_cast<int8_t*>(outputs.AllocateOutput<bool>(i, shape));
-  } else if (data_type == "FP64") {
-    return reinterpret_cast<int8_t*>(outputs.AllocateOutput<double>(i, shape));
-  } else {
-    return {};
+// the inverse of MapDataType for the types the outputs can be allocated with
+ONNXTensorElementDataType ParseDataType(const std::string& triton_data_type) {
+  static const std::unordered_map<std::string, ONNXTensorElementDataType> data_types{
+      {"FP32", ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT},
+      {"UINT8", ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8},
+      {"INT8", ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8},
+      {"UINT16", ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16},
+      {"INT16", ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16},
+      {"INT32", ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32},
+      {"UINT32", ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32},
+      {"INT64", ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64},
+      {"UINT64", ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64},
+      {"BOOL", ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL},
+      {"FP64", ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE},
+      {"BYTES", ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING},
+  };
+
+  auto data_type = data_types.find(triton_data_type);
+  return data_type != data_types.end() ? data_type->second : ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED;
+}
+
+// the rows of a request in the output of a batch, or the whole output if `rows` is -1
+struct OutputRows {
+  int64_t begin;
+  int64_t rows;
+};
+
+// gets the shape of the rows, and the offset and count of their elements in the output of the batch
+void SliceRows(const OutputRows& rows, std::vector<int64_t>& shape, size_t num_elements,
+               size_t& element_begin, size_t& element_count) {
+  element_begin = 0;
+  element_count = num_elements;
+  if (rows.rows < 0) {
+    return;
+  }
+
+  if (shape.empty() || shape[0] < rows.begin + rows.rows) {
+    ORTX_CXX_API_THROW("the output of a batch of requests should have the rows of the batch in its first dimension",
+                       ORT_RUNTIME_EXCEPTION);
   }
+
+  const size_t row_elements = shape[0] > 0 ? num_elements / static_cast<size_t>(shape[0]) : 0;
+  element_begin = static_cast<size_t>(rows.begin) * row_elements;
+  element_count = static_cast<size_t>(rows.rows) * row_elements;
+  shape[0] = rows.rows;
 }
 
-#define CHECK_TRITON_ERR(ret, msg)                                                                          \
-  if (!ret.IsOk()) {                                                                                        \
-    ORTX_CXX_API_THROW(MakeString("Error: ", msg, ", Triton err: ", ret.Message()), ORT_RUNTIME_EXCEPTION); \
+template <typename T>
+void CopyOutput(ortc::Variadic& outputs, size_t i, std::vector<int64_t> shape, const OutputRows& rows,
+                const uint8_t* raw_data, size_t raw_size) {
+  size_t num_elements = 1;
+  for (int64_t dim : shape) {
+    num_elements *= static_cast<size_t>(dim);
   }
 
-void AzureTritonInvoker::Compute(const ortc::Variadic& inputs, ortc::Variadic& outputs) const {
-  auto auth_token = GetAuthToken(inputs);
+  if (raw_size != num_elements * sizeof(T)) {
+    ORTX_CXX_API_THROW(MakeString("output ", i, " has ", raw_size, " bytes of data for ", num_elements, " elements"),
+                       ORT_RUNTIME_EXCEPTION);
+  }
 
-  gsl::span<const std::string> input_names = InputNames();
-  if (inputs.Size() != input_names.size()) {
-    ORTX_CXX_API_THROW("input count mismatch", ORT_RUNTIME_EXCEPTION);
+  size_t element_begin = 0;
+  size_t element_count = 0;
+  SliceRows(rows, shape, num_elements, element_begin, element_count);
+
+  T* output = outputs.AllocateOutput<T>(i, shape);
+  if (element_count != 0) {
+    memcpy(output, raw_data + element_begin * sizeof(T), element_count * sizeof(T));
   }
+}
 
-  std::vector<std::unique_ptr<tc::InferInput>> triton_input_vec;
-  std::vector<tc::InferInput*> triton_inputs;
-  std::vector<std::unique_ptr<const tc::InferRequestedOutput>> triton_output_vec;
-  std::vector<const tc::InferRequestedOutput*> triton_outputs;
-  tc::Error err;
+void CopyNonStrOutput(ONNXTensorElementDataType data_type, ortc::Variadic& outputs, size_t i,
+                      const std::vector<int64_t>& shape, const OutputRows& rows,
+                      const uint8_t* raw_data, size_t raw_size) {
+  switch (data_type) {
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+      return CopyOutput<float>(outputs, i, shape, rows, raw_data, raw_size);
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
+      return CopyOutput<uint8_t>(outputs, i, shape, rows, raw_data, raw_size);
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8:
+      return CopyOutput<int8_t>(outputs, i, shape, rows, raw_data, raw_size);
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16:
+      return CopyOutput<uint16_t>(outputs, i, shape, rows, raw_data, raw_size);
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16:
+      return CopyOutput<int16_t>(outputs, i, shape, rows, raw_data, raw_size);
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+      return CopyOutput<int32_t>(outputs, i, shape, rows, raw_data, raw_size);
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32:
+      return CopyOutput<uint32_t>(outputs, i, shape, rows, raw_data, raw_size);
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+      return CopyOutput<int64_t>(outputs, i, shape, rows, raw_data, raw_size);
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64:
+      return CopyOutput<uint64_t>(outputs, i, shape, rows, raw_data, raw_size);
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL:
+      return CopyOutput<bool>(outputs, i, shape, rows, raw_data, raw_size);
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE:
+      return CopyOutput<double>(outputs, i, shape, rows, raw_data, raw_size);
+    default:
+      ORTX_CXX_API_THROW(MakeString("unsupported triton data type of output ", i), ORT_RUNTIME_EXCEPTION);
+  }
+}
+// A cached response has 3 parts for each output: its triton data type, its shape as int64 values, and its data.
+// The data of a BYTES output is each string after its uint32 length, as in the binary data of triton.
+ResponseCache::Response CacheOutputs(const tc::InferResult& result, gsl::span<const std::string> output_names,
+                                     const OutputRows& rows) {
+  ResponseCache::Response response;
+  response.reserve(output_names.size() * 3);
+  for (const auto& output_name : output_names) {
+    std::vector<int64_t> shape;
+    std::string type;
+    tc::Error err = result.Shape(output_name, &shape);
+    CHECK_TRITON_ERR(err, "failed to get output shape");
+    err = result.Datatype(output_name, &type);
+    CHECK_TRITON_ERR(err, "failed to get output type");
 
-  const auto& property_names = RequestPropertyNames();
+    std::string data;
+    size_t element_begin = 0;
+    size_t element_count = 0;
+    if (ParseDataType(type) == ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING) {
+      std::vector<std::string> output_strings;
+      err = result.StringData(output_name, &output_strings);
+      CHECK_TRITON_ERR(err, "failed to get output as string");
+      SliceRows(rows, shape, output_strings.size(), element_begin, element_count);
+      for (size_t i = element_begin; i < element_begin + element_count; ++i) {
+        const uint32_t size = static_cast<uint32_t>(output_strings[i].size());
+        data.append(reinterpret_cast<const char*>(&size), sizeof(size));
+        data += output_strings[i];
+      }
+    } else {
+      const uint8_t* raw_data = {};
+      size_t raw_size = 0;
+      err = result.RawData(output_name, &raw_data, &raw_size);
+      CHECK_TRITON_ERR(err, "failed to get output raw data");
+      size_t num_elements = 1;
+      for (int64_t dim : shape) {
+        num_elements *= static_cast<size_t>(dim);
+      }
 
-  for (size_t ith_input = 1; ith_input < inputs.Size(); ++ith_input) {
-    tc::InferInput* triton_input = {};
-    std::string triton_data_type = MapDataType(inputs[ith_input]->Type());
-    if (triton_data_type.empty()) {
-      ORTX_CXX_API_THROW("unknown onnx data type", ORT_RUNTIME_EXCEPTION);
+      const size_t element_size = num_elements > 0 ? raw_size / num_elements : 0;
+      SliceRows(rows, shape, num_elements, element_begin, element_count);
+      data.assign(reinterpret_cast<const char*>(raw_data) + element_begin * element_size,
+                  element_count * element_size);
     }
 
-    err = tc::InferInput::Create(&triton_input, property_names[ith_input], inputs[ith_input]->Shape(),
-                                 triton_data_type);
-    CHECK_TRITON_ERR(err, "failed to create triton input");
-    triton_input_vec.emplace_back(triton_input);
+    response.push_back(std::move(type));
+    response.emplace_back(reinterpret_cast<const char*>(shape.data()), shape.size() * sizeof(int64_t));
+    response.push_back(std::move(data));
+  }
 
-    triton_inputs.push_back(triton_input);
-    if ("BYTES" == triton_data_type) {
-      const auto* string_tensor = reinterpret_cast<const ortc::Tensor<std::string>*>(inputs[ith_input].get());
-      triton_input->AppendFromString(string_tensor->Data());
+  return response;
+}
+
+void SetCachedOutputs(const ResponseCache::Response& response, ortc::Variadic& outputs) {
+  for (size_t i = 0; i + 2 < response.size(); i += 3) {
+    const size_t output_index = i / 3;
+    const ONNXTensorElementDataType data_type = ParseDataType(response[i]);
+    std::vector<int64_t> shape(response[i + 1].size() / sizeof(int64_t));
+    memcpy(shape.data(), response[i + 1].data(), shape.size() * sizeof(int64_t));
+    const std::string& data = response[i + 2];
+    if (data_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING) {
+      std::vector<std::string> output_strings;
+      for (size_t offset = 0; offset + sizeof(uint32_t) <= data.size();) {
+        uint32_t size = 0;
+        memcpy(&size, data.data() + offset, sizeof(size));
+        offset += sizeof(size);
+        output_strings.emplace_back(data, offset, size);
+        offset += size;
+      }
+
+      auto& string_tensor = outputs.AllocateStringTensor(output_index);
+      string_tensor.SetStringOutput(output_strings, shape);
     } else {
-      const float* data_raw = reinterpret_cast<const float*>(inputs[ith_input]->DataRaw());
-      size_t size_in_bytes = inputs[ith_input]->SizeInBytes();
-      err = triton_input->AppendRaw(reinterpret_cast<const uint8_t*>(data_raw), size_in_bytes);
-      CHECK_TRITON_ERR(err, "failed to append raw data to input");
+      CopyNonStrOutput(data_type, outputs, output_index, shape, OutputRows{0, -1},
+                       reinterpret_cast<const uint8_t*>(data.data()), data.size());
     }
   }
+}
+}  // namespace
+
+#ifdef AZURE_INVOKERS_ENABLE_TRITON_GRPC
+// The bidirectional stream of the gRPC client, on which the requests of all the threads are sent and their results
+// are received in any order, matched by the ids of the requests. The headers of a stream are only sent when it's
+// started, so it's restarted with the auth token of a request once the requests of the previous token are done.
+class AzureTritonInvoker::TritonStream {
+ public:
+  explicit TritonStream(tc::InferenceServerGrpcClient& client) : client_(client) {}
+
+  ~TritonStream() {
+    if (started_) {
+      client_.StopStream();
+    }
+  }
+
+  // sends the request, whose inputs can be reused when it returns, and returns the future of its result
+  std::future<std::shared_ptr<tc::InferResult>> Send(tc::InferOptions& options,
+                                                     const std::vector<tc::InferInput*>& inputs,
+                                                     const std::vector<const tc::InferRequestedOutput*>& outputs,
+                                                     const std::string& auth_token) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      idle_.wait(lock, [this] { return !restarting_; });
+      if (started_ && auth_token == auth_token_) {
+        break;
+      }
+
+      if (!pending_.empty()) {
+        idle_.wait(lock, [this] { return pending_.empty() || restarting_; });
+        continue;
+      }
+
+      // the stream is restarted without the lock, as the reader thread of the stream may complete requests until
+      // it's stopped
+      restarting_ = true;
+      const bool stop = started_;
+      lock.unlock();
+      tc::Error err = stop ? client_.StopStream() : tc::Error::Success;
+      if (err.IsOk()) {
+        tc::Headers headers;
+        headers["Authorization"] = std::string{"Bearer "} + auth_token;
+        err = client_.StartStream([this](tc::InferResult* result) { OnComplete(result); }, false, 0, headers);
+      }
+
+      lock.lock();
+      restarting_ = false;
+      started_ = err.IsOk();
+      auth_token_ = auth_token;
+      idle_.notify_all();
+      CHECK_TRITON_ERR(err, "failed to start triton stream");
+    }
+
+    options.request_id_ = std::to_string(next_id_++);
+    auto future = pending_[options.request_id_].get_future();
+    tc::Error err = client_.AsyncStreamInfer(options, inputs, outputs);
+    if (!err.IsOk()) {
+      pending_.erase(options.request_id_);
+      idle_.notify_all();
+    }
+
+    CHECK_TRITON_ERR(err, "failed to send triton stream request");
+    return future;
+  }
+
+ private:
+  // called by the reader thread of the stream
+  void OnComplete(tc::InferResult* result) {
+    std::shared_ptr<tc::InferResult> owned(result);
+    std::string id;
+    result->Id(&id);
+    std::vector<std::promise<std::shared_ptr<tc::InferResult>>> completed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto request = pending_.find(id);
+      if (request != pending_.end()) {
+        completed.push_back(std::move(request->second));
+        pending_.erase(request);
+      } else {
+        // the error of the stream, which isn't of a request, is the result of all the pending ones
+        for (auto& pending : pending_) {
+          completed.push_back(std::move(pending.second));
+        }
+
+        pending_.clear();
+      }
+
+      if (pending_.empty()) {
+        idle_.notify_all();
+      }
+    }
+
+    for (auto& promise : completed) {
+      promise.set_value(owned);
+    }
+  }
+
+  tc::InferenceServerGrpcClient& client_;
+  std::mutex mutex_;
+  std::condition_variable idle_;
+  bool started_{};
+  bool restarting_{};
+  std::string auth_token_;
+  uint64_t next_id_{};
+  std::unordered_map<std::string, std::promise<std::shared_ptr<tc::InferResult>>> pending_;
+};
+#endif
+
+AzureTritonInvoker::AzureTritonInvoker(const OrtApi& api, const OrtKernelInfo& info)
+    : CloudBaseKernel(api, info) {
+  // the requests are made by the triton client, which doesn't give the metrics of a request
+  if (HasMetricsOutput()) {
+    ORTX_CXX_API_THROW("AzureTritonInvoker doesn't support metrics_output", ORT_INVALID_ARGUMENT);
+  }
+
+  const std::string protocol = TryToGetAttributeWithDefault<std::string>(kProtocol, "http");
+  const bool streaming = TryToGetAttributeWithDefault<int64_t>(kStreaming, 0) != 0;
+  tc::Error err;
+  if (protocol == "grpc") {
+#ifdef AZURE_INVOKERS_ENABLE_TRITON_GRPC
+    // the gRPC url is the host and the port, over TLS for an https uri
+    std::string url = ModelUri();
+    const bool use_ssl = url.rfind("https://", 0) == 0;
+    if (use_ssl || url.rfind("http://", 0) == 0) {
+      url = url.substr(url.find("://") + 3);
+    }
+
+    // the channel isn't shared with the other clients of the endpoint, and is kept alive while it's idle
+    tc::KeepAliveOptions keep_alive;
+    keep_alive.keepalive_time_ms = kGrpcKeepAliveMs;
+    keep_alive.keepalive_permit_without_calls = true;
+    err = tc::InferenceServerGrpcClient::Create(&grpc_client_, url, Verbose(), use_ssl, tc::SslOptions(), keep_alive,
+                                                false);
+    CHECK_TRITON_ERR(err, "failed to create triton gRPC client");
+    if (streaming) {
+      stream_ = std::make_unique<TritonStream>(*grpc_client_);
+    }
+#else
+    ORTX_CXX_API_THROW("the gRPC transport of AzureTritonInvoker requires a build with OCOS_ENABLE_AZURE_TRITON_GRPC",
+                       ORT_INVALID_ARGUMENT);
+#endif
+  } else if (protocol == "http") {
+    if (streaming) {
+      ORTX_CXX_API_THROW("streaming of AzureTritonInvoker requires the grpc protocol", ORT_INVALID_ARGUMENT);
+    }
+
+    err = tc::InferenceServerHttpClient::Create(&triton_client_, ModelUri(), Verbose());
+    CHECK_TRITON_ERR(err, "failed to create triton client");
+  } else {
+    ORTX_CXX_API_THROW(MakeString("unknown protocol of AzureTritonInvoker: ", protocol, ", expected http or grpc"),
+                       ORT_INVALID_ARGUMENT);
+  }
 
   gsl::span<const std::string> output_names = OutputNames();
   for (size_t ith_output = 0; ith_output < output_names.size(); ++ith_output) {
     tc::InferRequestedOutput* triton_output = {};
     err = tc::InferRequestedOutput::Create(&triton_output, output_names[ith_output]);
     CHECK_TRITON_ERR(err, "failed to create triton output");
-    triton_output_vec.emplace_back(triton_output);
-    triton_outputs.push_back(triton_output);
+    triton_output_vec_.emplace_back(triton_output);
+    triton_outputs_.push_back(triton_output);
   }
 
-  std::unique_ptr<tc::InferResult> results_ptr;
-  tc::InferResult* results = {};
-  tc::InferOptions options(ModelName());
-  options.model_version_ = ModelVersion();
-  options.client_timeout_ = 0;
+  if (BatchWindow().count() > 0 && MaxBatchSize() > 1) {
+    batcher_ = RequestBatcher<BatchRequest>::Get(BatchKey());
+  }
 
-  tc::Headers http_headers;
-  http_headers["Authorization"] = std::string{"Bearer "} + auth_token;
+  if (Prewarm() > 0) {
+    warmer_ = std::make_unique<ConnectionWarmer>([this] { WarmConnection(); }, KeepAliveInterval());
+  }
+}
 
-  err = triton_client_->Infer(&results, options, triton_inputs, triton_outputs,
-                              http_headers, tc::Parameters(),
-                              tc::InferenceServerHttpClient::CompressionType::NONE,  // support compression in config?
-                              tc::InferenceServerHttpClient::CompressionType::NONE);
+void AzureTritonInvoker::WarmConnection() const {
+  // the request has no auth token, so an endpoint may reject it, but the connection is open either way
+  bool live = false;
+  tc::Error err;
+#ifdef AZURE_INVOKERS_ENABLE_TRITON_GRPC
+  if (grpc_client_) {
+    err = grpc_client_->IsServerLive(&live, tc::Headers(), static_cast<uint64_t>(TimeoutSeconds()) * 1000);
+  } else
+#endif
+  {
+    err = triton_client_->IsServerLive(&live);
+  }
 
-  results_ptr.reset(results);
-  CHECK_TRITON_ERR(err, "failed to do triton inference");
+  if (!err.IsOk()) {
+    KERNEL_LOG(GetLogger(), ORT_LOGGING_LEVEL_INFO,
+               ("Prewarm request to " + ModelUri() + " failed: " + err.Message()).c_str());
+  }
+}
+
+AzureTritonInvoker::~AzureTritonInvoker() = default;
+
+std::unique_ptr<AzureTritonInvoker::TritonInputs> AzureTritonInvoker::AcquireInputs(
+    const ortc::Variadic& inputs, const std::vector<std::vector<int64_t>>& shapes) const {
+  std::unique_ptr<TritonInputs> triton_inputs;
+  {
+    std::lock_guard<std::mutex> lock(inputs_mutex_);
+    if (!idle_inputs_.empty()) {
+      triton_inputs = std::move(idle_inputs_.back());
+      idle_inputs_.pop_back();
+    }
+  }
+
+  if (!triton_inputs) {
+    triton_inputs = std::make_unique<TritonInputs>();
+  }
+
+  // the input 0 is the auth token
+  const auto& property_names = RequestPropertyNames();
+  triton_inputs->inputs.resize(inputs.Size() - 1);
+  triton_inputs->input_ptrs.resize(inputs.Size() - 1);
+  for (size_t ith_input = 1; ith_input < inputs.Size(); ++ith_input) {
+    const char* triton_data_type = MapDataType(inputs[ith_input]->Type());
+    if (triton_data_type == nullptr) {
+      ORTX_CXX_API_THROW("unknown onnx data type", ORT_RUNTIME_EXCEPTION);
+    }
+
+    auto& triton_input = triton_inputs->inputs[ith_input - 1];
+    if (triton_input && triton_input->Datatype() == triton_data_type) {
+      tc::Error err = triton_input->Reset();
+      CHECK_TRITON_ERR(err, "failed to reset triton input");
+      err = triton_input->SetShape(shapes[ith_input]);
+      CHECK_TRITON_ERR(err, "failed to set triton input shape");
+    } else {
+      tc::InferInput* created = {};
+      tc::Error err = tc::InferInput::Create(&created, property_names[ith_input], shapes[ith_input],
+                                             triton_data_type);
+      CHECK_TRITON_ERR(err, "failed to create triton input");
+      triton_input.reset(created);
+    }
+
+    triton_inputs->input_ptrs[ith_input - 1] = triton_input.get();
+  }
 
+  return triton_inputs;
+}
+
+void AzureTritonInvoker::ReleaseInputs(std::unique_ptr<TritonInputs> triton_inputs) const {
+  std::lock_guard<std::mutex> lock(inputs_mutex_);
+  idle_inputs_.push_back(std::move(triton_inputs));
+}
+
+void AzureTritonInvoker::Compute(const ortc::Variadic& inputs, ortc::Variadic& outputs) const {
+  auto auth_token = GetAuthToken(inputs);
+  if (warmer_) {
+    warmer_->Touch();
+  }
+
+  gsl::span<const std::string> input_names = InputNames();
+  if (inputs.Size() != input_names.size()) {
+    ORTX_CXX_API_THROW("input count mismatch", ORT_RUNTIME_EXCEPTION);
+  }
+
+  ResponseCache::Key cache_key{};
+  if (Cache()) {
+    cache_key = CacheKey(inputs);
+    ResponseCache::Response cached;
+    if (Cache()->Lookup(cache_key, cached)) {
+      SetCachedOutputs(cached, outputs);
+      return;
+    }
+  }
+
+  BatchRequest request{&inputs, std::move(auth_token)};
+  if (batcher_) {
+    batcher_->Run(request, MaxBatchSize(), BatchWindow(),
+                  [this](const std::vector<BatchRequest*>& requests, std::vector<std::exception_ptr>& errors) {
+                    InferBatch(requests, errors);
+                  });
+  } else {
+    Infer({&request});
+  }
+
+  const OutputRows rows{request.row_begin, request.rows};
   size_t output_index = 0;
+  tc::Error err;
 
-  for (const auto& output_name : output_names) {
+  for (const auto& output_name : OutputNames()) {
     std::vector<int64_t> shape;
-    err = results_ptr->Shape(output_name, &shape);
+    err = request.result->Shape(output_name, &shape);
     CHECK_TRITON_ERR(err, "failed to get output shape");
 
     std::string type;
-    err = results_ptr->Datatype(output_name, &type);
+    err = request.result->Datatype(output_name, &type);
     CHECK_TRITON_ERR(err, "failed to get output type");
 
-    if ("BYTES" == type) {
+    const ONNXTensorElementDataType data_type = ParseDataType(type);
+    if (data_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING) {
       std::vector<std::string> output_strings;
-      err = results_ptr->StringData(output_name, &output_strings);
+      err = request.result->StringData(output_name, &output_strings);
       CHECK_TRITON_ERR(err, "failed to get output as string");
+
+      size_t element_begin = 0;
+      size_t element_count = 0;
+      SliceRows(rows, shape, output_strings.size(), element_begin, element_count);
+      if (element_count != output_strings.size()) {
+        output_strings = std::vector<std::string>(output_strings.begin() + element_begin,
+                                                  output_strings.begin() + element_begin + element_count);
+      }
+
       auto& string_tensor = outputs.AllocateStringTensor(output_index);
       string_tensor.SetStringOutput(output_strings, shape);
     } else {
+      // the raw data points into the binary data of the response, and is copied once into the ORT output
       const uint8_t* raw_data = {};
-      size_t raw_size;
-      err = results_ptr->RawData(output_name, &raw_data, &raw_size);
+      size_t raw_size = 0;
+      err = request.result->RawData(output_name, &raw_data, &raw_size);
       CHECK_TRITON_ERR(err, "failed to get output raw data");
-      auto* output_raw = CreateNonStrTensor(type, outputs, output_index, shape);
-      memcpy(output_raw, raw_data, raw_size);
+      CopyNonStrOutput(data_type, outputs, output_index, shape, rows, raw_data, raw_size);
     }
 
     ++output_index;
   }
+
+  if (Cache()) {
+    Cache()->Insert(cache_key, CacheOutputs(*request.result, OutputNames(), rows));
+  }
+}
+
+void AzureTritonInvoker::InferBatch(const std::vector<BatchRequest*>& requests,
+                                    std::vector<std::exception_ptr>& errors) const {
+  // sends the requests at the indices, and sets the error of the request to all of them if it fails
+  auto infer = [this, &requests, &errors](const std::vector<size_t>& indices) {
+    std::vector<BatchRequest*> group;
+    group.reserve(indices.size());
+    for (size_t index : indices) {
+      group.push_back(requests[index]);
+    }
+
+    try {
+      Infer(group);
+    } catch (...) {
+      for (size_t index : indices) {
+        errors[index] = std::current_exception();
+      }
+    }
+  };
+
+  // the requests can be concatenated if they have the same auth token, and inputs of the same types and shapes
+  // apart from their first dimension, which is the same for all the inputs of a request
+  std::vector<std::pair<std::string, std::vector<size_t>>> groups;
+  for (size_t index = 0; index < requests.size(); ++index) {
+    const ortc::Variadic& inputs = *requests[index]->inputs;
+    std::ostringstream signature;
+    signature << requests[index]->auth_token << '\n';
+    bool batchable = true;
+    for (size_t ith_input = 1; ith_input < inputs.Size() && batchable; ++ith_input) {
+      const auto& shape = inputs[ith_input]->Shape();
+      batchable = !shape.empty() && shape[0] == inputs[1]->Shape()[0];
+      signature << inputs[ith_input]->Type() << ':';
+      for (size_t i = 1; i < shape.size(); ++i) {
+        signature << shape[i] << ',';
+      }
+
+      signature << ';';
+    }
+
+    if (!batchable || inputs.Size() < 2) {
+      infer({index});
+      continue;
+    }
+
+    auto group = std::find_if(groups.begin(), groups.end(),
+                              [key = signature.str()](const auto& group) { return group.first == key; });
+    if (group == groups.end()) {
+      groups.emplace_back(signature.str(), std::vector<size_t>{index});
+    } else {
+      group->second.push_back(index);
+    }
+  }
+
+  for (const auto& group : groups) {
+    infer(group.second);
+  }
+}
+
+void AzureTritonInvoker::Infer(const std::vector<BatchRequest*>& requests) const {
+  const ortc::Variadic& first_inputs = *requests[0]->inputs;
+  std::vector<std::vector<int64_t>> shapes(first_inputs.Size());
+  for (size_t ith_input = 1; ith_input < first_inputs.Size(); ++ith_input) {
+    shapes[ith_input] = first_inputs[ith_input]->Shape();
+    for (size_t i = 1; i < requests.size(); ++i) {
+      shapes[ith_input][0] += (*requests[i]->inputs)[ith_input]->Shape()[0];
+    }
+  }
+
+  std::unique_ptr<TritonInputs> triton_inputs = AcquireInputs(first_inputs, shapes);
+  tc::Error err;
+
+  for (size_t ith_input = 1; ith_input < first_inputs.Size(); ++ith_input) {
+    tc::InferInput* triton_input = triton_inputs->input_ptrs[ith_input - 1];
+    // the data of all the types, including BYTES, is sent as binary data after the JSON header of the request, or as
+    // the raw contents of a gRPC request. appending raw data doesn't copy it, and the requests of a batch are
+    // appended in order.
+    for (BatchRequest* request : requests) {
+      const auto& input = (*request->inputs)[ith_input];
+      if (input->Type() == ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING) {
+        const auto* string_tensor = reinterpret_cast<const ortc::Tensor<std::string>*>(input.get());
+        err = triton_input->AppendFromString(string_tensor->Data());
+        CHECK_TRITON_ERR(err, "failed to append string data to input");
+      } else {
+        const uint8_t* data_raw = reinterpret_cast<const uint8_t*>(input->DataRaw());
+        err = triton_input->AppendRaw(data_raw, input->SizeInBytes());
+        CHECK_TRITON_ERR(err, "failed to append raw data to input");
+      }
+    }
+  }
+
+  std::shared_ptr<tc::InferResult> result = Send(std::move(triton_inputs), requests[0]->auth_token);
+
+  int64_t row_begin = 0;
+  for (BatchRequest* request : requests) {
+    request->result = result;
+    if (requests.size() > 1) {
+      request->row_begin = row_begin;
+      request->rows = (*request->inputs)[1]->Shape()[0];
+      row_begin += request->rows;
+    }
+  }
+}
+
+std::shared_ptr<tc::InferResult> AzureTritonInvoker::Send(std::unique_ptr<TritonInputs> triton_inputs,
+                                                          const std::string& auth_token) const {
+  tc::InferResult* results = {};
+  tc::InferOptions options(ModelName());
+  options.model_version_ = ModelVersion();
+  options.client_timeout_ = 0;
+
+  tc::Headers http_headers;
+  http_headers["Authorization"] = std::string{"Bearer "} + auth_token;
+
+  tc::Error err;
+#ifdef AZURE_INVOKERS_ENABLE_TRITON_GRPC
+  if (stream_) {
+    auto future = stream_->Send(options, triton_inputs->input_ptrs, triton_outputs_, auth_token);
+    // the request was written to the stream, so the inputs can be reused while it's in flight
+    ReleaseInputs(std::move(triton_inputs));
+    std::shared_ptr<tc::InferResult> result = future.get();
+    err = result->RequestStatus();
+    CHECK_TRITON_ERR(err, "failed to do triton inference");
+    return result;
+  }
+
+  if (grpc_client_) {
+    err = grpc_client_->Infer(&results, options, triton_inputs->input_ptrs, triton_outputs_, http_headers);
+  } else
+#endif
+  {
+    err = triton_client_->Infer(&results, options, triton_inputs->input_ptrs, triton_outputs_,
+                                http_headers, tc::Parameters(),
+                                tc::InferenceServerHttpClient::CompressionType::NONE,  // support compression in config?
+                                tc::InferenceServerHttpClient::CompressionType::NONE);
+  }
+
+  std::shared_ptr<tc::InferResult> result(results);
+  // the inputs were only needed to send the request
+  ReleaseInputs(std::move(triton_inputs));
+  CHECK_TRITON_ERR(err, "failed to do triton inference");
+  return result;
 }
 
 }  // namespace ort_extensions
@@ -3,17 +3,85 @@
 
 #pragma once
 
+#include <mutex>
+#include <vector>
+
 #include "cloud_base_kernel.hpp"
+#include "request_batcher.hpp"
 #include "http_client.h"  // triton
+#ifdef AZURE_INVOKERS_ENABLE_TRITON_GRPC
+#include "grpc_client.h"  // triton
+#endif
 
 namespace ort_extensions {
 
 class AzureTritonInvoker : public CloudBaseKernel {
  public:
   AzureTritonInvoker(const OrtApi& api, const OrtKernelInfo& info);
+  ~AzureTritonInvoker();
   void Compute(const ortc::Variadic& inputs, ortc::Variadic& outputs) const;
 
  private:
+  // optional. the transport of the requests, "http" by default, or "grpc" in a build with the gRPC client of triton,
+  // whose channel to the endpoint lives as long as the kernel. with streaming=1, the gRPC requests are sent on one
+  // bidirectional stream of the kernel instead of a call each.
+  static constexpr const char* kProtocol = "protocol";
+  static constexpr const char* kStreaming = "streaming";
+  // the interval of the keepalive pings of an idle gRPC channel
+  static constexpr int kGrpcKeepAliveMs = 30000;
+
+  // A request of Compute, and the rows of the batch result that are its outputs. `rows` is -1 if the request was
+  // sent alone and the result is all its own.
+  struct BatchRequest {
+    const ortc::Variadic* inputs;
+    std::string auth_token;
+    std::shared_ptr<triton::client::InferResult> result;
+    int64_t row_begin{};
+    int64_t rows{-1};
+  };
+
+  // Sends the requests, grouped into the ones whose inputs can be concatenated on their first dimension. The error
+  // of a group is set for each of its requests in `errors`, so it doesn't fail the other groups.
+  void InferBatch(const std::vector<BatchRequest*>& requests, std::vector<std::exception_ptr>& errors) const;
+  void Infer(const std::vector<BatchRequest*>& requests) const;
+
+  // The inputs of a request, with their data type and name. They're reset and reused by later requests.
+  struct TritonInputs {
+    std::vector<std::unique_ptr<triton::client::InferInput>> inputs;
+    std::vector<triton::client::InferInput*> input_ptrs;
+  };
+
+  std::unique_ptr<TritonInputs> AcquireInputs(const ortc::Variadic& inputs,
+                                              const std::vector<std::vector<int64_t>>& shapes) const;
+  void ReleaseInputs(std::unique_ptr<TritonInputs> triton_inputs) const;
+
+  // connects the client by a liveness request of the server, whose result is ignored
+  void WarmConnection() const;
+
+  // sends the request of the inputs, and returns its result
+  std::shared_ptr<triton::client::InferResult> Send(std::unique_ptr<TritonInputs> triton_inputs,
+                                                    const std::string& auth_token) const;
+
   std::unique_ptr<triton::client::InferenceServerHttpClient> triton_client_;
+#ifdef AZURE_INVOKERS_ENABLE_TRITON_GRPC
+  // set instead of triton_client_ for the gRPC transport
+  std::unique_ptr<triton::client::InferenceServerGrpcClient> grpc_client_;
+  // set for the streaming of the gRPC requests
+  class TritonStream;
+  std::unique_ptr<TritonStream> stream_;
+#endif
+
+  // the requested outputs are the same for all the requests, and only read by the client
+  std::vector<std::unique_ptr<const triton::client::InferRequestedOutput>> triton_output_vec_;
+  std::vector<const triton::client::InferRequestedOutput*> triton_outputs_;
+
+  // set if the requests are batched
+  std::shared_ptr<RequestBatcher<BatchRequest>> batcher_;
+
+  mutable std::mutex inputs_mutex_;
+  mutable std::vector<std::unique_ptr<TritonInputs>> idle_inputs_;
+
+  // set if prewarm is enabled, last so its thread is stopped before the clients are released
+  std::unique_ptr<ConnectionWarmer> warmer_;
 };
 }  // namespace ort_extensions
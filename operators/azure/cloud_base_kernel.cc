@@ -5,9 +5,56 @@
 
 #include <sstream>
 
+#include "farmhash.h"
 #include "narrow.h"
 
 namespace ort_extensions {
+ConnectionWarmer::ConnectionWarmer(std::function<void()> warm, std::chrono::seconds interval)
+    : warm_(std::move(warm)), interval_(interval) {
+  Touch();
+  thread_ = std::thread(&ConnectionWarmer::Run, this);
+}
+
+ConnectionWarmer::~ConnectionWarmer() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+
+  stopped_.notify_all();
+  thread_.join();
+}
+
+void ConnectionWarmer::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    lock.unlock();
+    try {
+      warm_();
+    } catch (...) {
+      // the connections are opened by the requests instead
+    }
+
+    Touch();
+    lock.lock();
+    if (interval_.count() == 0) {
+      return;
+    }
+
+    // the next keep alive is an interval after the last request or keep alive
+    for (;;) {
+      const auto last_use = Clock::time_point(Clock::duration(last_use_.load(std::memory_order_relaxed)));
+      if (stopped_.wait_until(lock, last_use + interval_, [this] { return stop_; })) {
+        return;
+      }
+
+      if (Clock::now() - Clock::time_point(Clock::duration(last_use_.load(std::memory_order_relaxed))) >= interval_) {
+        break;
+      }
+    }
+  }
+}
+
 CloudBaseKernel::CloudBaseKernel(const OrtApi& api, const OrtKernelInfo& info)
     : BaseKernel(api, info),
       logger_(api, info) {
@@ -27,6 +74,37 @@ CloudBaseKernel::CloudBaseKernel(const OrtApi& api, const OrtKernelInfo& info)
   timeout_seconds_ = narrow<int>(TryToGetAttributeWithDefault<int64_t>(kTimeout, kDefaultTimeoutSeconds));
   verbose_ = TryToGetAttributeWithDefault<std::string>(kVerbose, "0") != "0";
 
+  float batch_window_ms = TryToGetAttributeWithDefault<float>(kBatchWindowMs, 0.f);
+  int64_t max_batch_size = TryToGetAttributeWithDefault<int64_t>(kMaxBatchSize, kDefaultMaxBatchSize);
+  if (batch_window_ms < 0.f || max_batch_size < 1) {
+    ORTX_CXX_API_THROW("batch_window_ms shouldn't be negative and max_batch_size should be at least 1",
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  batch_window_ = std::chrono::microseconds(static_cast<int64_t>(batch_window_ms * 1000));
+  max_batch_size_ = static_cast<size_t>(max_batch_size);
+
+  int64_t prewarm = TryToGetAttributeWithDefault<int64_t>(kPrewarm, 0);
+  int64_t keep_alive_seconds = TryToGetAttributeWithDefault<int64_t>(kKeepAliveSeconds, kDefaultKeepAliveSeconds);
+  if (prewarm < 0 || keep_alive_seconds < 0) {
+    ORTX_CXX_API_THROW("prewarm and keep_alive_seconds shouldn't be negative", ORT_INVALID_ARGUMENT);
+  }
+
+  prewarm_ = static_cast<size_t>(prewarm);
+  keep_alive_interval_ = std::chrono::seconds(keep_alive_seconds);
+
+  int64_t cache_max_bytes = TryToGetAttributeWithDefault<int64_t>(kCacheMaxBytes, 0);
+  int64_t cache_ttl_seconds = TryToGetAttributeWithDefault<int64_t>(kCacheTtlSeconds, kDefaultCacheTtlSeconds);
+  if (cache_max_bytes < 0 || cache_ttl_seconds < 0) {
+    ORTX_CXX_API_THROW("cache_max_bytes and cache_ttl_seconds shouldn't be negative", ORT_INVALID_ARGUMENT);
+  }
+
+  if (cache_max_bytes > 0) {
+    cache_ = std::make_unique<ResponseCache>(static_cast<size_t>(cache_max_bytes),
+                                             std::chrono::seconds(cache_ttl_seconds),
+                                             TryToGetAttributeWithDefault<std::string>(kCacheDir, ""));
+  }
+
   OrtStatusPtr status{};
   size_t input_count{};
   status = api_.KernelInfo_GetInputCount(&info_, &input_count);
@@ -69,6 +147,16 @@ CloudBaseKernel::CloudBaseKernel(const OrtApi& api, const OrtKernelInfo& info)
     }
     output_names_.push_back(output_name);
   }
+
+  has_metrics_output_ = TryToGetAttributeWithDefault<int64_t>(kMetricsOutput, 0) != 0;
+  if (has_metrics_output_) {
+    if (output_names_.size() < 2) {
+      ORTX_CXX_API_THROW("metrics_output requires an output for the metrics after the outputs of the request",
+                         ORT_INVALID_ARGUMENT);
+    }
+
+    output_names_.pop_back();
+  }
 }
 
 std::string CloudBaseKernel::GetAuthToken(const ortc::Variadic& inputs) const {
@@ -81,6 +169,59 @@ std::string CloudBaseKernel::GetAuthToken(const ortc::Variadic& inputs) const {
   return auth_token;
 }
 
+std::string CloudBaseKernel::BatchKey() const {
+  std::ostringstream key;
+  key << model_uri_ << '\n'
+      << model_name_ << '\n'
+      << model_ver_ << '\n';
+  for (const auto& name : property_names_) {
+    key << name << ',';
+  }
+
+  key << '\n';
+  for (const auto& name : output_names_) {
+    key << name << ',';
+  }
+
+  return key.str();
+}
+
+ResponseCache::Key CloudBaseKernel::CacheKey(const ortc::Variadic& inputs, const std::string& variant) const {
+  // the request is described by its metadata, the strings of its string inputs and the fingerprints of the data of
+  // its other inputs. the key is the fingerprint of that and of the auth token of input 0.
+  std::string request = BatchKey();
+  auto append = [&request](const void* data, size_t size) {
+    request.append(static_cast<const char*>(data), size);
+  };
+
+  const uint64_t variant_size = variant.size();
+  append(&variant_size, sizeof(variant_size));
+  request += variant;
+  for (size_t ith_input = 1; ith_input < inputs.Size(); ++ith_input) {
+    const auto& input = inputs[ith_input];
+    const int32_t type = static_cast<int32_t>(input->Type());
+    const auto& shape = input->Shape();
+    const uint64_t rank = shape.size();
+    append(&type, sizeof(type));
+    append(&rank, sizeof(rank));
+    append(shape.data(), shape.size() * sizeof(int64_t));
+    if (input->Type() == ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING) {
+      const auto* string_tensor = reinterpret_cast<const ortc::Tensor<std::string>*>(input.get());
+      for (const auto& str : string_tensor->Data()) {
+        const uint64_t size = str.size();
+        append(&size, sizeof(size));
+        request += str;
+      }
+    } else {
+      const auto fingerprint = util::Fingerprint128(static_cast<const char*>(input->DataRaw()), input->SizeInBytes());
+      append(&fingerprint.first, sizeof(fingerprint.first));
+      append(&fingerprint.second, sizeof(fingerprint.second));
+    }
+  }
+
+  return ResponseCache::RequestKey(std::move(request), GetAuthToken(inputs));
+}
+
 /*static */ std::string CloudBaseKernel::GetPropertyNameFromInputName(const std::string& input_name) {
   auto idx = input_name.find_last_of('/');
   if (idx == std::string::npos) {
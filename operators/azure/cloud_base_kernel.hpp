@@ -3,13 +3,52 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #include "ocos.h"
 #include "gsl/span"
 
 #include "azure/logger.hpp"
+#include "azure/response_cache.hpp"
 
 namespace ort_extensions {
 
+/// <summary>
+/// Warms the connections of a kernel to its endpoint on a background thread, so the first requests don't pay the
+/// DNS lookup, the connect and the TLS handshake. `warm` is run once when the warmer is created, and again after
+/// every interval in which the kernel made no request, so the idle connections aren't closed by the client or the
+/// server. An interval of 0 only warms them once. The thread is stopped when the warmer is destroyed.
+/// </summary>
+class ConnectionWarmer {
+ public:
+  ConnectionWarmer(std::function<void()> warm, std::chrono::seconds interval);
+  ConnectionWarmer(const ConnectionWarmer&) = delete;
+  ConnectionWarmer& operator=(const ConnectionWarmer&) = delete;
+  ~ConnectionWarmer();
+
+  // records a request of the kernel, which keeps its connection alive itself
+  void Touch() { last_use_.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed); }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  void Run();
+
+  std::function<void()> warm_;
+  std::chrono::seconds interval_;
+  std::atomic<Clock::rep> last_use_{};
+  std::mutex mutex_;
+  std::condition_variable stopped_;
+  bool stop_{};
+  std::thread thread_;
+};
+
 /// <summary>
 /// Base kernel for custom ops that call cloud endpoints.
 /// </summary>
@@ -24,9 +63,31 @@ class CloudBaseKernel : public BaseKernel {
   static constexpr const char* kModelVer = "model_version";   // optional
   static constexpr const char* kTimeout = "timeout_seconds";  // optional. timeout for request to endpoint
   static constexpr const char* kVerbose = "verbose";
+  // optional. concurrent requests of the nodes with the same endpoint, model, inputs and outputs arriving within
+  // the window are sent as one batch of up to the max batch size, by the operators of endpoints that support it.
+  static constexpr const char* kBatchWindowMs = "batch_window_ms";
+  static constexpr const char* kMaxBatchSize = "max_batch_size";
+  // optional. the responses of the requests are cached by a fingerprint of the endpoint, model and inputs other than
+  // the auth token, if the max bytes isn't 0. they expire after the TTL if it isn't 0, and are also kept in the
+  // directory if it's given, so they outlive the session.
+  static constexpr const char* kCacheMaxBytes = "cache_max_bytes";
+  static constexpr const char* kCacheTtlSeconds = "cache_ttl_seconds";
+  static constexpr const char* kCacheDir = "cache_dir";
+  // optional. if set, the last output of the node is a tensor of the metrics of its request, by the operators that
+  // support it, and that output isn't one of OutputNames().
+  static constexpr const char* kMetricsOutput = "metrics_output";
+  // optional. the number of connections to the endpoint opened on a background thread when the kernel is created,
+  // by the operators that support it, which are kept alive by a request after every keep alive interval in which the
+  // kernel made none, if the interval isn't 0.
+  static constexpr const char* kPrewarm = "prewarm";
+  static constexpr const char* kKeepAliveSeconds = "keep_alive_seconds";
 
   static constexpr int kMinimumSupportedOrtVersion = 14;
   static constexpr int kDefaultTimeoutSeconds = 15;
+  static constexpr int64_t kDefaultMaxBatchSize = 8;
+  static constexpr int64_t kDefaultCacheTtlSeconds = 3600;
+  // less than the 118 seconds after which curl doesn't reuse an idle connection
+  static constexpr int64_t kDefaultKeepAliveSeconds = 60;
 
   const std::string& ModelUri() const { return model_uri_; }
   const std::string& ModelName() const { return model_name_; }
@@ -34,9 +95,31 @@ class CloudBaseKernel : public BaseKernel {
   int TimeoutSeconds() const { return timeout_seconds_; }
   bool Verbose() const { return verbose_; }
 
+  // batching is enabled if the window isn't 0
+  std::chrono::microseconds BatchWindow() const { return batch_window_; }
+  size_t MaxBatchSize() const { return max_batch_size_; }
+
+  // the requests of the kernels with the same key can be batched together
+  std::string BatchKey() const;
+
+  // the connections to prewarm, 0 if it's not enabled, and the interval of their keep alive requests
+  size_t Prewarm() const { return prewarm_; }
+  std::chrono::seconds KeepAliveInterval() const { return keep_alive_interval_; }
+
+  // the cache of the responses, or nullptr if it's not enabled
+  ResponseCache* Cache() const { return cache_.get(); }
+
+  // fingerprint of the request of the inputs, and of `variant` for the options of the derived class that change the
+  // response
+  ResponseCache::Key CacheKey(const ortc::Variadic& inputs, const std::string& variant = {}) const;
+
   const gsl::span<const std::string> InputNames() const { return input_names_; }
   const gsl::span<const std::string> OutputNames() const { return output_names_; }
 
+  // the metrics output follows the outputs of OutputNames()
+  bool HasMetricsOutput() const { return has_metrics_output_; }
+  size_t MetricsOutputIndex() const { return output_names_.size(); }
+
   // Request property names that are parsed from input names. 1:1 with InputNames() values.
   // e.g. 'node0/prompt' -> 'prompt' and that input provides the 'prompt' property in the request to the endpoint.
   // <see cref="GetPropertyNameFromInputName"/> for further details.
@@ -62,12 +145,18 @@ class CloudBaseKernel : public BaseKernel {
   std::string model_ver_;
   int timeout_seconds_;
   bool verbose_;
+  std::chrono::microseconds batch_window_{};
+  size_t max_batch_size_{};
+  bool has_metrics_output_{};
+  size_t prewarm_{};
+  std::chrono::seconds keep_alive_interval_{};
 
   std::vector<std::string> input_names_;
   std::vector<std::string> property_names_;
   std::vector<std::string> output_names_;
 
   Logger logger_;
+  std::unique_ptr<ResponseCache> cache_;
 };
 
 }  // namespace ort_extensions
@@ -3,8 +3,17 @@
 
 #include "curl_invoker.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
 #include <sstream>
 
+#include <zlib.h>
+
+#include "runtime_stats.h"
+#include "trace_scope.h"
+
 // TODO: We were enabling this on Android but can now use the system certs.
 // TBD if there are user scenarios that require manual cert management where it would be beneficial for the user to
 // provide manage specific certs themselves. If nothing shows up in the next few months it can be removed.
@@ -82,6 +91,8 @@ X509_STORE* CreateX509Store(std::optional<const std::string> certs) {
 
 X509_STORE* GetCertificateStore(std::optional<const std::string> certs) {
   // first call populates the store. `certs` is ignored after that.
+  // the initialization of the static is thread-safe, and the store is only read after it, which OpenSSL allows
+  // from the concurrent requests.
   static std::unique_ptr<X509_STORE, decltype(&X509_STORE_free)> store{CreateX509Store(certs), &X509_STORE_free};
 
   return store.get();
@@ -107,7 +118,11 @@ size_t CurlHandler::WriteStringCallback(char* contents, size_t element_size, siz
   WriteStringCallbackData* data = static_cast<WriteStringCallbackData*>(userdata);
   try {
     size_t bytes = element_size * num_elements;
-    data->response.append(contents, bytes);
+    if (data->events && data->IsSuccess()) {
+      data->events->Append(contents, bytes);
+    } else {
+      data->response.append(contents, bytes);
+    }
     bytes_written = bytes;
   } catch (const std::exception& ex) {
     KERNEL_LOG(data->logger, ORT_LOGGING_LEVEL_ERROR, ex.what());
@@ -119,10 +134,405 @@ size_t CurlHandler::WriteStringCallback(char* contents, size_t element_size, siz
   return bytes_written;
 }
 
-CurlHandler::CurlHandler() : curl_(curl_easy_init(), curl_easy_cleanup),
-                             headers_(nullptr, curl_slist_free_all),
-                             from_holder_(from_, curl_formfree) {
-  CURL* curl = curl_.get();  // CURL == void* so can't dereference
+/// <summary>
+/// Callback of the progress of the transfer, which aborts it with CURLE_ABORTED_BY_CALLBACK once its kernel is
+/// cancelled or its deadline has passed
+/// </summary>
+/// <seealso cref="https://curl.se/libcurl/c/CURLOPT_XFERINFOFUNCTION.html"/>
+int CurlHandler::ProgressCallback(void* userdata, curl_off_t /*download_total*/, curl_off_t /*downloaded*/,
+                                  curl_off_t /*upload_total*/, curl_off_t /*uploaded*/) {
+  const auto* data = static_cast<const WriteStringCallbackData*>(userdata);
+  return ort_extensions::RunCancellation::Cancelled(data->cancellation) ? 1 : 0;
+}
+
+/// <summary>
+/// Callback of each header line, which reserves the response of its Content-Length so it isn't grown by the writes
+/// </summary>
+/// <seealso cref="https://curl.se/libcurl/c/CURLOPT_HEADERFUNCTION.html"/>
+size_t CurlHandler::HeaderCallback(char* buffer, size_t element_size, size_t num_elements, void* userdata) {
+  constexpr const char kContentLength[] = "content-length:";
+  constexpr size_t kContentLengthSize = sizeof(kContentLength) - 1;
+  // a limit to what a header can reserve, beyond which the response grows as it's written
+  constexpr size_t kMaxReserve = 64 * 1024 * 1024;
+
+  const size_t bytes = element_size * num_elements;
+  WriteStringCallbackData* data = static_cast<WriteStringCallbackData*>(userdata);
+  // curl's start transfer time of a POST is when its upload starts, so the time of the response is measured here.
+  // the status line of an informational response is "HTTP/<version> 1xx".
+  if (bytes > 5 && memcmp(buffer, "HTTP/", 5) == 0) {
+    const char* code = static_cast<const char*>(memchr(buffer, ' ', bytes));
+    if (code != nullptr && code + 1 < buffer + bytes && code[1] != '1') {
+      data->response_time = std::chrono::steady_clock::now();
+      data->status = 0;
+      for (++code; code < buffer + bytes && *code >= '0' && *code <= '9'; ++code) {
+        data->status = data->status * 10 + (*code - '0');
+      }
+    }
+  }
+
+  if ((data->events && data->IsSuccess()) || bytes <= kContentLengthSize) {
+    return bytes;
+  }
+
+  for (size_t i = 0; i < kContentLengthSize; ++i) {
+    if (std::tolower(static_cast<unsigned char>(buffer[i])) != kContentLength[i]) {
+      return bytes;
+    }
+  }
+
+  size_t content_length = 0;
+  for (size_t i = kContentLengthSize; i < bytes; ++i) {
+    if (buffer[i] >= '0' && buffer[i] <= '9') {
+      content_length = content_length * 10 + static_cast<size_t>(buffer[i] - '0');
+      if (content_length > kMaxReserve) {
+        return bytes;
+      }
+    } else if (buffer[i] != ' ' && buffer[i] != '\t') {
+      break;
+    }
+  }
+
+  try {
+    data->response.reserve(data->response.size() + content_length);
+  } catch (...) {
+    // the response is grown as it's written instead
+  }
+
+  return bytes;
+}
+
+void ServerSentEvents::Append(const char* data, size_t size) {
+  // lines end with CRLF, LF or CR, of which a CRLF can be split between the writes
+  size_t line_begin = 0;
+  for (size_t i = 0; i < size; ++i) {
+    const char c = data[i];
+    if (c != '\n' && c != '\r') {
+      continue;
+    }
+
+    if (c == '\n' && last_was_cr_ && i == line_begin && line_.empty()) {
+      // the LF of a CRLF whose CR ended the previous line
+      last_was_cr_ = false;
+      line_begin = i + 1;
+      continue;
+    }
+
+    if (line_.empty()) {
+      ProcessLine(data + line_begin, i - line_begin);
+    } else {
+      line_.append(data + line_begin, i - line_begin);
+      ProcessLine(line_.data(), line_.size());
+      line_.clear();
+    }
+
+    last_was_cr_ = c == '\r';
+    if (last_was_cr_ && i + 1 < size && data[i + 1] == '\n') {
+      ++i;
+      last_was_cr_ = false;
+    }
+
+    line_begin = i + 1;
+  }
+
+  if (line_begin < size) {
+    line_.append(data + line_begin, size - line_begin);
+    last_was_cr_ = false;
+  }
+}
+
+void ServerSentEvents::ProcessLine(const char* line, size_t size) {
+  if (size == 0) {
+    // a blank line dispatches the event
+    if (has_data_ && !done_) {
+      if (data_ == "[DONE]") {
+        done_ = true;
+      } else {
+        if (events_.empty()) {
+          first_event_time_ = std::chrono::steady_clock::now();
+        }
+
+        events_.push_back(std::move(data_));
+      }
+    }
+
+    data_.clear();
+    has_data_ = false;
+    return;
+  }
+
+  // a line of a field "data" has the value after the colon and an optional space. other fields and comments,
+  // which start with a colon, aren't used.
+  constexpr const char kData[] = "data";
+  constexpr size_t kDataSize = sizeof(kData) - 1;
+  if (size < kDataSize || std::memcmp(line, kData, kDataSize) != 0 || (size > kDataSize && line[kDataSize] != ':')) {
+    return;
+  }
+
+  size_t value_begin = std::min(size, kDataSize + 1);
+  if (value_begin < size && line[value_begin] == ' ') {
+    ++value_begin;
+  }
+
+  if (has_data_) {
+    data_.push_back('\n');
+  }
+
+  data_.append(line + value_begin, size - value_begin);
+  has_data_ = true;
+}
+
+CurlHandlePool::~CurlHandlePool() {
+  for (CURL* curl : handles_) {
+    curl_easy_cleanup(curl);
+  }
+}
+
+CURL* CurlHandlePool::Acquire(bool& reused) {
+  static StatCounter& reused_handles = RuntimeStats::Instance().Counter("curl_pool.reused");
+  static StatCounter& created_handles = RuntimeStats::Instance().Counter("curl_pool.created");
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    reused = !handles_.empty();
+    if (reused) {
+      CURL* curl = handles_.back();
+      handles_.pop_back();
+      reused_handles.Add();
+      return curl;
+    }
+  }
+
+  CURL* curl = curl_easy_init();
+  if (!curl) {
+    ORTX_CXX_API_THROW("curl_easy_init returned nullptr", ORT_RUNTIME_EXCEPTION);
+  }
+
+  created_handles.Add();
+  return curl;
+}
+
+void CurlHandlePool::Release(CURL* curl) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  handles_.push_back(curl);
+}
+
+////////////////////// CurlMultiExecutor //////////////////////
+
+// curl_multi_poll and curl_multi_wakeup were added in curl 7.68
+#if LIBCURL_VERSION_NUM >= 0x074400
+#define OCOS_CURL_MULTI_WAKEUP
+#endif
+
+std::shared_ptr<CurlMultiExecutor> CurlMultiExecutor::Get() {
+  static std::mutex mutex;
+  static std::weak_ptr<CurlMultiExecutor> instance;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  std::shared_ptr<CurlMultiExecutor> executor = instance.lock();
+  if (!executor) {
+    executor.reset(new CurlMultiExecutor());
+    instance = executor;
+  }
+
+  return executor;
+}
+
+CurlMultiExecutor::CurlMultiExecutor() : multi_(curl_multi_init()) {
+#if !defined(OCOS_CURL_MULTI_WAKEUP)
+  curl_multi_cleanup(multi_);
+  ORTX_CXX_API_THROW("async requests require curl 7.68 or later", ORT_RUNTIME_EXCEPTION);
+#else
+  if (!multi_) {
+    ORTX_CXX_API_THROW("curl_multi_init returned nullptr", ORT_RUNTIME_EXCEPTION);
+  }
+
+  curl_multi_setopt(multi_, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+
+  thread_ = std::thread(&CurlMultiExecutor::Run, this);
+#endif
+}
+
+CurlMultiExecutor::~CurlMultiExecutor() {
+#if defined(OCOS_CURL_MULTI_WAKEUP)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+
+  curl_multi_wakeup(multi_);
+  thread_.join();
+  curl_multi_cleanup(multi_);
+#endif
+}
+
+void CurlMultiExecutor::Start(Transfer& transfer) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    added_.push_back(&transfer);
+  }
+
+#if defined(OCOS_CURL_MULTI_WAKEUP)
+  curl_multi_wakeup(multi_);
+#endif
+}
+
+int CurlMultiExecutor::WaitAny(std::initializer_list<const Transfer*> transfers,
+                               std::chrono::steady_clock::time_point deadline) {
+  // done is set by the I/O thread under the mutex, so it's only read under it, which the predicate is called with
+  auto done = transfers.end();
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait_until(lock, deadline, [&] {
+    done = std::find_if(transfers.begin(), transfers.end(), [](const Transfer* transfer) { return transfer->done; });
+    return done != transfers.end();
+  });
+
+  return done != transfers.end() ? static_cast<int>(done - transfers.begin()) : -1;
+}
+
+void CurlMultiExecutor::Cancel(Transfer& transfer) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (transfer.done) {
+      return;
+    }
+
+    cancelled_.push_back(&transfer);
+  }
+
+#if defined(OCOS_CURL_MULTI_WAKEUP)
+  curl_multi_wakeup(multi_);
+#endif
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [&transfer] { return transfer.done; });
+}
+
+CURLcode CurlMultiExecutor::Perform(CURL* curl) {
+  Transfer transfer(curl);
+  Start(transfer);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [&transfer] { return transfer.done; });
+  return transfer.result;
+}
+
+void CurlMultiExecutor::Run() {
+#if defined(OCOS_CURL_MULTI_WAKEUP)
+  for (;;) {
+    {
+      // the executor is only released by the last kernel, so no request is waiting when it stops
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stop_) {
+        break;
+      }
+
+      for (Transfer* transfer : cancelled_) {
+        if (transfer->done) {
+          continue;  // finished before it was cancelled
+        }
+
+        auto added = std::find(added_.begin(), added_.end(), transfer);
+        if (added != added_.end()) {
+          added_.erase(added);
+        } else {
+          curl_multi_remove_handle(multi_, transfer->curl);
+          running_.erase(transfer->curl);
+        }
+
+        transfer->result = CURLE_ABORTED_BY_CALLBACK;
+        transfer->done = true;
+      }
+
+      cancelled_.clear();
+
+      for (Transfer* transfer : added_) {
+        CURLMcode code = curl_multi_add_handle(multi_, transfer->curl);
+        if (code != CURLM_OK) {
+          transfer->result = CURLE_FAILED_INIT;
+          transfer->done = true;
+          continue;
+        }
+
+        running_.emplace(transfer->curl, transfer);
+      }
+
+      added_.clear();
+    }
+
+    done_.notify_all();
+
+    int running_count = 0;
+    curl_multi_perform(multi_, &running_count);
+
+    int msgs_left = 0;
+    bool any_done = false;
+    while (CURLMsg* msg = curl_multi_info_read(multi_, &msgs_left)) {
+      if (msg->msg != CURLMSG_DONE) {
+        continue;
+      }
+
+      CURL* curl = msg->easy_handle;
+      CURLcode result = msg->data.result;
+      curl_multi_remove_handle(multi_, curl);
+
+      auto transfer = running_.find(curl);
+      if (transfer != running_.end()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        transfer->second->result = result;
+        transfer->second->done = true;
+        any_done = true;
+        running_.erase(transfer);
+      }
+    }
+
+    if (any_done) {
+      done_.notify_all();
+    }
+
+    // wait for the sockets of the transfers, or for a wakeup from Start, Cancel or the destructor
+    curl_multi_poll(multi_, nullptr, 0, 1000, nullptr);
+  }
+#endif
+}
+
+////////////////////// RequestMetrics //////////////////////
+
+std::array<double, RequestMetrics::kCount> RequestMetrics::Values() const {
+  return {dns_ms,
+          connect_ms,
+          tls_ms,
+          request_ms,
+          download_ms,
+          transfer_ms,
+          total_ms,
+          static_cast<double>(bytes_sent),
+          static_cast<double>(bytes_received),
+          static_cast<double>(new_connections),
+          handle_reused ? 1.0 : 0.0,
+          static_cast<double>(attempts),
+          hedged ? 1.0 : 0.0,
+          cache_hit ? 1.0 : 0.0};
+}
+
+std::string RequestMetrics::ToString() const {
+  std::ostringstream out;
+  out << "dns_ms=" << dns_ms << " connect_ms=" << connect_ms << " tls_ms=" << tls_ms << " request_ms=" << request_ms
+      << " download_ms=" << download_ms << " transfer_ms=" << transfer_ms << " total_ms=" << total_ms
+      << " bytes_sent=" << bytes_sent << " bytes_received=" << bytes_received
+      << " new_connections=" << new_connections << " handle_reused=" << handle_reused << " attempts=" << attempts
+      << " hedged=" << hedged << " cache_hit=" << cache_hit;
+  return out.str();
+}
+
+////////////////////// CurlHandler //////////////////////
+
+CurlHandler::CurlHandler(CurlHandlePool& pool) : pool_(pool),
+                                                 headers_(nullptr, curl_slist_free_all),
+                                                 mime_(nullptr, curl_mime_free) {
+  curl_ = pool.Acquire(handle_reused_);
+  CURL* curl = curl_;  // CURL == void* so can't dereference
+
+  // clear the options of the previous request. the live connections and the DNS and TLS session caches are kept.
+  curl_easy_reset(curl);
 
   curl_easy_setopt(curl, CURLOPT_BUFFERSIZE, 100 * 1024L);
   curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 1L);
@@ -131,6 +541,9 @@ CurlHandler::CurlHandler() : curl_(curl_easy_init(), curl_easy_cleanup),
   curl_easy_setopt(curl, CURLOPT_FTP_SKIP_PASV_IP, 1L);      // is this relevant to https requests?
   curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
   curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteStringCallback);
+  curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
+  // called once a request enables the progress with its data
+  curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, ProgressCallback);
 
 #if defined(ENABLE_USING_CERTS_FROM_MODEL)
   // using the in-memory store is optional so make sure we have one before we enable overriding the default
@@ -140,6 +553,146 @@ CurlHandler::CurlHandler() : curl_(curl_easy_init(), curl_easy_cleanup),
 #endif
 }
 
+void CurlHandler::ReadMetrics(RequestMetrics& metrics, const WriteStringCallbackData& data) const {
+  // the times are in microseconds since the start of the transfer. a time of a phase that didn't happen is 0.
+  curl_off_t name_lookup = 0, connect = 0, app_connect = 0, pre_transfer = 0, start_transfer = 0, total = 0;
+  curl_easy_getinfo(curl_, CURLINFO_NAMELOOKUP_TIME_T, &name_lookup);
+  curl_easy_getinfo(curl_, CURLINFO_CONNECT_TIME_T, &connect);
+  curl_easy_getinfo(curl_, CURLINFO_APPCONNECT_TIME_T, &app_connect);
+  curl_easy_getinfo(curl_, CURLINFO_PRETRANSFER_TIME_T, &pre_transfer);
+  curl_easy_getinfo(curl_, CURLINFO_STARTTRANSFER_TIME_T, &start_transfer);
+  curl_easy_getinfo(curl_, CURLINFO_TOTAL_TIME_T, &total);
+
+  const auto ms = [](curl_off_t begin, curl_off_t end) {
+    return end > begin ? static_cast<double>(end - begin) / 1000.0 : 0.0;
+  };
+
+  metrics.dns_ms = ms(0, name_lookup);
+  metrics.connect_ms = ms(name_lookup, connect);
+  metrics.tls_ms = app_connect > 0 ? ms(connect, app_connect) : 0.0;
+  curl_off_t response = start_transfer;
+  if (data.response_time != std::chrono::steady_clock::time_point{}) {
+    response = std::chrono::duration_cast<std::chrono::microseconds>(data.response_time - start_time_).count();
+    response = std::min(std::max(response, pre_transfer), total);
+  }
+
+  metrics.request_ms = ms(pre_transfer, response);
+  metrics.download_ms = ms(response, total);
+  metrics.transfer_ms = ms(0, total);
+
+  curl_off_t bytes_sent = 0, bytes_received = 0;
+  long new_connections = 0;
+  curl_easy_getinfo(curl_, CURLINFO_SIZE_UPLOAD_T, &bytes_sent);
+  curl_easy_getinfo(curl_, CURLINFO_SIZE_DOWNLOAD_T, &bytes_received);
+  curl_easy_getinfo(curl_, CURLINFO_NUM_CONNECTS, &new_connections);
+  metrics.bytes_sent = bytes_sent;
+  metrics.bytes_received = bytes_received;
+  metrics.new_connections = new_connections;
+  metrics.handle_reused = handle_reused_;
+}
+
+curl_mimepart* CurlHandler::AddFormPart(const char* name) {
+  if (!mime_) {
+    mime_.reset(curl_mime_init(curl_));
+    if (!mime_) {
+      ORTX_CXX_API_THROW("curl_mime_init failed", ORT_RUNTIME_EXCEPTION);
+    }
+  }
+
+  curl_mimepart* part = curl_mime_addpart(mime_.get());
+  if (part == nullptr || curl_mime_name(part, name) != CURLE_OK) {
+    ORTX_CXX_API_THROW("Failed to add a form part", ORT_RUNTIME_EXCEPTION);
+  }
+
+  return part;
+}
+
+void CurlHandler::AddFormString(const char* name, const char* value) {
+  curl_mimepart* part = AddFormPart(name);
+  if (curl_mime_data(part, value, CURL_ZERO_TERMINATED) != CURLE_OK) {
+    ORTX_CXX_API_THROW("Failed to set the data of a form part", ORT_RUNTIME_EXCEPTION);
+  }
+}
+
+void CurlHandler::AddFormBuffer(const char* name, const char* buffer_name, const void* buffer_ptr, size_t buffer_len) {
+  curl_mimepart* part = AddFormPart(name);
+  FormBuffer& buffer = form_buffers_.emplace_back(FormBuffer{static_cast<const char*>(buffer_ptr), buffer_len, 0});
+  // the size is known, so the length of the body is too and it's not sent chunked
+  // the type curl_formadd gave a buffer part
+  if (curl_mime_filename(part, buffer_name) != CURLE_OK ||
+      curl_mime_type(part, "application/octet-stream") != CURLE_OK ||
+      curl_mime_data_cb(part, static_cast<curl_off_t>(buffer_len), ReadFormBuffer, SeekFormBuffer, nullptr,
+                        &buffer) != CURLE_OK) {
+    ORTX_CXX_API_THROW("Failed to set the data of a form part", ORT_RUNTIME_EXCEPTION);
+  }
+}
+
+size_t CurlHandler::ReadFormBuffer(char* buffer, size_t element_size, size_t num_elements, void* userdata) {
+  auto& form_buffer = *static_cast<FormBuffer*>(userdata);
+  const size_t size = std::min(element_size * num_elements, form_buffer.size - form_buffer.offset);
+  memcpy(buffer, form_buffer.data + form_buffer.offset, size);
+  form_buffer.offset += size;
+  return size;
+}
+
+int CurlHandler::SeekFormBuffer(void* userdata, curl_off_t offset, int origin) {
+  // called to rewind the part if the request is sent again, e.g. after a redirect
+  auto& form_buffer = *static_cast<FormBuffer*>(userdata);
+  curl_off_t position = offset;
+  if (origin == SEEK_CUR) {
+    position += static_cast<curl_off_t>(form_buffer.offset);
+  } else if (origin == SEEK_END) {
+    position += static_cast<curl_off_t>(form_buffer.size);
+  }
+
+  if (position < 0 || position > static_cast<curl_off_t>(form_buffer.size)) {
+    return CURL_SEEKFUNC_FAIL;
+  }
+
+  form_buffer.offset = static_cast<size_t>(position);
+  return CURL_SEEKFUNC_OK;
+}
+
+void CurlHandler::SetPostBody(const void* data, size_t size, bool compress) {
+  if (!compress) {
+    SetOption(CURLOPT_POSTFIELDS, data);
+    SetOption(CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(size));
+    return;
+  }
+
+  z_stream stream{};
+  // 15 window bits, plus 16 for the gzip header and trailer
+  if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+    ORTX_CXX_API_THROW("deflateInit2 failed", ORT_RUNTIME_EXCEPTION);
+  }
+
+  compressed_body_.resize(deflateBound(&stream, static_cast<uLong>(size)));
+  stream.next_in = static_cast<Bytef*>(const_cast<void*>(data));
+  stream.avail_in = static_cast<uInt>(size);
+  stream.next_out = compressed_body_.data();
+  stream.avail_out = static_cast<uInt>(compressed_body_.size());
+  int ret = deflate(&stream, Z_FINISH);
+  compressed_body_.resize(stream.total_out);
+  deflateEnd(&stream);
+  if (ret != Z_STREAM_END) {
+    ORTX_CXX_API_THROW("gzip compression of the request body failed", ORT_RUNTIME_EXCEPTION);
+  }
+
+  AddHeader("Content-Encoding: gzip");
+  SetOption(CURLOPT_POSTFIELDS, compressed_body_.data());
+  SetOption(CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(compressed_body_.size()));
+}
+
+CurlHandler::~CurlHandler() {
+  // the form and the headers of the request are freed while the handle is still this one's, since the form is bound
+  // to the handle, which another request may reuse or the pool may clean up once it's released
+  curl_easy_setopt(curl_, CURLOPT_MIMEPOST, static_cast<curl_mime*>(nullptr));
+  curl_easy_setopt(curl_, CURLOPT_HTTPHEADER, static_cast<curl_slist*>(nullptr));
+  mime_.reset();
+  headers_.reset();
+  pool_.Release(curl_);
+}
+
 ////////////////////// CurlInvoker //////////////////////
 
 CurlInvoker::CurlInvoker(const OrtApi& api, const OrtKernelInfo& info)
@@ -154,10 +707,92 @@ CurlInvoker::CurlInvoker(const OrtApi& api, const OrtKernelInfo& info)
     // nodes in the model and any of them could provide the certs.
   }
 #endif
+
+  if (TryToGetAttributeWithDefault<int64_t>(kAsync, 0) != 0) {
+    executor_ = CurlMultiExecutor::Get();
+  }
+
+  std::string http_version = TryToGetAttributeWithDefault<std::string>(kHttpVersion, "");
+  if (http_version == "1.1") {
+    http_version_ = CURL_HTTP_VERSION_1_1;
+  } else if (http_version == "2") {
+    http_version_ = CURL_HTTP_VERSION_2TLS;
+  } else if (!http_version.empty()) {
+    ORTX_CXX_API_THROW("http_version should be \"1.1\" or \"2\", not " + http_version, ORT_INVALID_ARGUMENT);
+  }
+
+  compress_request_ = TryToGetAttributeWithDefault<int64_t>(kCompressRequest, 0) != 0;
+  compress_response_ = TryToGetAttributeWithDefault<int64_t>(kCompressResponse, 0) != 0;
+  stream_ = TryToGetAttributeWithDefault<int64_t>(kStream, 0) != 0;
+
+  RetryPolicy::Options retry;
+  retry.max_attempts = TryToGetAttributeWithDefault<int64_t>(kMaxAttempts, retry.max_attempts);
+  retry.backoff_ms = TryToGetAttributeWithDefault<int64_t>(kRetryBackoffMs, retry.backoff_ms);
+  retry.backoff_max_ms = TryToGetAttributeWithDefault<int64_t>(kRetryBackoffMaxMs, retry.backoff_max_ms);
+  retry.status_codes = TryToGetAttributeWithDefault<std::vector<int64_t>>(kRetryStatusCodes, retry.status_codes);
+  retry.hedge_delay_ms = TryToGetAttributeWithDefault<int64_t>(kHedgeDelayMs, retry.hedge_delay_ms);
+  metrics_log_level_ = TryToGetAttributeWithDefault<int64_t>(kMetricsLogLevel, -1);
+  if (metrics_log_level_ < -1 || metrics_log_level_ > ORT_LOGGING_LEVEL_FATAL) {
+    ORTX_CXX_API_THROW("metrics_log_level should be -1 or an ORT logging level", ORT_INVALID_ARGUMENT);
+  }
+
+  if (retry.max_attempts < 1) {
+    ORTX_CXX_API_THROW("max_attempts should be at least 1", ORT_INVALID_ARGUMENT);
+  }
+
+  if (retry.backoff_ms < 0 || retry.backoff_max_ms < 0) {
+    ORTX_CXX_API_THROW("retry_backoff_ms and retry_backoff_max_ms shouldn't be negative", ORT_INVALID_ARGUMENT);
+  }
+
+  if (retry.hedge_delay_ms < -1) {
+    ORTX_CXX_API_THROW("hedge_delay_ms should be -1, 0 or a delay", ORT_INVALID_ARGUMENT);
+  }
+
+  if (retry.hedge_delay_ms != 0 && !executor_) {
+    executor_ = CurlMultiExecutor::Get();
+  }
+
+  retry_policy_ = std::make_unique<RetryPolicy>(std::move(retry));
+
+  if (Prewarm() > 0) {
+    warmer_ = std::make_unique<ConnectionWarmer>([this] { WarmConnections(); }, KeepAliveInterval());
+  }
+}
+
+void CurlInvoker::WarmConnections() const {
+  // the handles are held together so each of them opens its own connection. the connections of the executor are
+  // shared by its transfers, so a request on it warms the connection that the requests of the nodes reuse.
+  const size_t count = executor_ ? 1 : Prewarm();
+  std::vector<std::unique_ptr<CurlHandler>> handlers;
+  CurlHandler::WriteStringCallbackData callback_data(GetLogger());
+  for (size_t i = 0; i < count; ++i) {
+    auto& handler = *handlers.emplace_back(std::make_unique<CurlHandler>(handle_pool_));
+    handler.SetOption(CURLOPT_URL, ModelUri().c_str());
+    handler.SetOption(CURLOPT_NOBODY, 1L);
+    handler.SetOption(CURLOPT_TIMEOUT_MS, static_cast<long>(TimeoutSeconds()) * 1000L);
+    handler.SetOption(CURLOPT_VERBOSE, Verbose());
+    if (http_version_ != CURL_HTTP_VERSION_NONE) {
+      handler.SetOption(CURLOPT_HTTP_VERSION, http_version_);
+    }
+
+    // the headers of the response are discarded
+    handler.SetOption(CURLOPT_HEADERFUNCTION, nullptr);
+    handler.SetOption(CURLOPT_WRITEDATA, (void*)&callback_data);
+
+    CURLcode result = executor_ ? handler.Perform(*executor_) : handler.Perform();
+    if (result != CURLE_OK) {
+      KERNEL_LOG(GetLogger(), ORT_LOGGING_LEVEL_WARNING,
+                 ("Failed to prewarm the connection to " + ModelUri() + ": " + curl_easy_strerror(result)).c_str());
+      break;
+    }
+  }
 }
 
 void CurlInvoker::ComputeImpl(const ortc::Variadic& inputs, ortc::Variadic& outputs) const {
   std::string auth_token = GetAuthToken(inputs);
+  if (warmer_) {
+    warmer_->Touch();
+  }
 
   if (inputs.Size() != InputNames().size()) {
     ORTX_CXX_API_THROW("input count mismatch", ORT_RUNTIME_EXCEPTION);
@@ -166,36 +801,213 @@ void CurlInvoker::ComputeImpl(const ortc::Variadic& inputs, ortc::Variadic& outp
   // do any additional validation of the number and type of inputs/outputs
   ValidateInputs(inputs);
 
-  // set the options for the curl handler that apply to all usages
-  CurlHandler curl_handler;
+  // a cached response is the body, or the data of the events of a streamed response
+  ResponseCache::Key cache_key{};
+  if (Cache()) {
+    cache_key = CacheKey(inputs, stream_ ? "stream" : "");
+    ResponseCache::Response cached;
+    if (Cache()->Lookup(cache_key, cached)) {
+      if (stream_) {
+        ProcessEvents(cached, outputs);
+      } else {
+        ProcessResponse(cached.empty() ? std::string{} : cached[0], outputs);
+      }
+
+      RequestMetrics metrics;
+      metrics.cache_hit = true;
+      ReportMetrics(metrics, outputs);
+      return;
+    }
+  }
 
   std::string full_auth = ComposeFullAuthToken(auth_token);
+
+  // the timeout is the budget of all the attempts and the backoffs between them. 0 is no timeout.
+  const Clock::time_point deadline = TimeoutSeconds() > 0 ? Clock::now() + std::chrono::seconds(TimeoutSeconds())
+                                                          : Clock::time_point::max();
+  const Clock::time_point start = Clock::now();
+  CurlHandler::WriteStringCallbackData response(GetLogger(), stream_);
+  long status = 0;
+  RequestMetrics metrics;
+  for (int64_t attempt = 1;; ++attempt) {
+    metrics.attempts = attempt;
+    auto curl_ret = ExecuteRequest(inputs, full_auth, deadline, response, status, metrics);
+    ort_extensions::RunCancellation::ThrowIfCancelled("CurlInvoker");
+    if (attempt < retry_policy_->GetOptions().max_attempts && retry_policy_->IsRetryable(curl_ret, status)) {
+      auto backoff = retry_policy_->Backoff(attempt);
+      if (Clock::now() + backoff < deadline) {
+        KERNEL_LOG(GetLogger(), ORT_LOGGING_LEVEL_WARNING,
+                   ("Retrying the request of attempt " + std::to_string(attempt) + " (CURLcode=" +
+                    std::to_string(curl_ret) + ", status=" + std::to_string(status) + ") in " +
+                    std::to_string(backoff.count()) + " ms")
+                       .c_str());
+        std::this_thread::sleep_for(backoff);
+        continue;
+      }
+    }
+
+    if (CURLE_OK != curl_ret) {
+      const char* err = curl_easy_strerror(curl_ret);
+      KERNEL_LOG(GetLogger(), ORT_LOGGING_LEVEL_ERROR,
+                 ("Curl error (CURLcode=" + std::to_string(curl_ret) + "): " + err).c_str());
+
+      ORTX_CXX_API_THROW(err, ORT_FAIL);
+    }
+
+    break;
+  }
+
+  metrics.total_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+  // the body of a failed streamed response isn't events, so it's kept like a response that isn't streamed
+  if (response.events && (status < 200 || status >= 300)) {
+    KERNEL_LOG(GetLogger(), ORT_LOGGING_LEVEL_ERROR,
+               ("Streamed request failed (status=" + std::to_string(status) + "): " + response.response).c_str());
+    ORTX_CXX_API_THROW("Streamed request failed with status " + std::to_string(status) + ": " + response.response,
+                       ORT_FAIL);
+  }
+
+  // only the successful responses are cached
+  if (Cache() && status >= 200 && status < 300) {
+    Cache()->Insert(cache_key,
+                    response.events ? response.events->Events() : ResponseCache::Response{response.response});
+  }
+
+  ORTX_TRACE_SCOPE("CurlInvoker.ProcessResponse");
+  if (response.events) {
+    if (Verbose() && !response.events->Events().empty()) {
+      auto time_to_first_event =
+          std::chrono::duration_cast<std::chrono::milliseconds>(response.events->FirstEventTime() - start);
+      KERNEL_LOG(GetLogger(), ORT_LOGGING_LEVEL_INFO,
+                 ("First event of the response after " + std::to_string(time_to_first_event.count()) + " ms").c_str());
+    }
+
+    ProcessEvents(response.events->Events(), outputs);
+  } else {
+    ProcessResponse(response.response, outputs);
+  }
+
+  ReportMetrics(metrics, outputs);
+}
+
+void CurlInvoker::ReportMetrics(const RequestMetrics& metrics, ortc::Variadic& outputs) const {
+  if (metrics_log_level_ >= 0) {
+    KERNEL_LOG(GetLogger(), static_cast<OrtLoggingLevel>(metrics_log_level_),
+               ("Request metrics: " + metrics.ToString()).c_str());
+  }
+
+  if (HasMetricsOutput()) {
+    const auto values = metrics.Values();
+    double* output = outputs.AllocateOutput<double>(MetricsOutputIndex(),
+                                                    {static_cast<int64_t>(RequestMetrics::kCount)});
+    std::copy(values.begin(), values.end(), output);
+  }
+}
+
+std::string CurlInvoker::ComposeFullAuthToken(const std::string& auth_token) const {
+  return std::string{"Authorization: Bearer "} + auth_token;
+}
+
+void CurlInvoker::PrepareRequest(CurlHandler& curl_handler, const std::string& full_auth, Clock::time_point deadline,
+                                 CurlHandler::WriteStringCallbackData& callback_data,
+                                 const ortc::Variadic& inputs) const {
   curl_handler.AddHeader(full_auth.c_str());
   curl_handler.SetOption(CURLOPT_URL, ModelUri().c_str());
-  curl_handler.SetOption(CURLOPT_TIMEOUT, TimeoutSeconds());
+  if (deadline != Clock::time_point::max()) {
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now());
+    curl_handler.SetOption(CURLOPT_TIMEOUT_MS, static_cast<long>(std::max<int64_t>(remaining.count(), 1)));
+  }
+
   curl_handler.SetOption(CURLOPT_VERBOSE, Verbose());
+  if (http_version_ != CURL_HTTP_VERSION_NONE) {
+    curl_handler.SetOption(CURLOPT_HTTP_VERSION, http_version_);
+  }
+
+  if (http_version_ == CURL_HTTP_VERSION_2TLS) {
+    // a request waits for a connection being set up to the endpoint, to multiplex on it instead of opening another
+    curl_handler.SetOption(CURLOPT_PIPEWAIT, 1L);
+  }
+
+  if (compress_response_) {
+    // an empty string asks for any encoding curl supports, and the response is decoded by curl
+    curl_handler.SetOption(CURLOPT_ACCEPT_ENCODING, "");
+  }
 
-  CurlHandler::WriteStringCallbackData callback_data(GetLogger());
   curl_handler.SetOption(CURLOPT_WRITEDATA, (void*)&callback_data);
+  curl_handler.SetOption(CURLOPT_HEADERDATA, (void*)&callback_data);
+  // curl calls the progress about once a second while the transfer is idle, and more often as the data moves
+  curl_handler.SetOption(CURLOPT_NOPROGRESS, 0L);
+  curl_handler.SetOption(CURLOPT_XFERINFODATA, (void*)&callback_data);
 
   SetupRequest(curl_handler, inputs);
-  ExecuteRequest(curl_handler);
-  ProcessResponse(callback_data.response, outputs);
 }
 
-std::string CurlInvoker::ComposeFullAuthToken(const std::string& auth_token) const {
-  return std::string{"Authorization: Bearer "} + auth_token;
-}
+CURLcode CurlInvoker::ExecuteRequest(const ortc::Variadic& inputs, const std::string& full_auth,
+                                     Clock::time_point deadline, CurlHandler::WriteStringCallbackData& response,
+                                     long& status, RequestMetrics& metrics) const {
+  ORTX_TRACE_SCOPE("CurlInvoker.ExecuteRequest");
+  const auto start = Clock::now();
+  if (start >= deadline) {
+    return CURLE_OPERATION_TIMEDOUT;
+  }
 
-void CurlInvoker::ExecuteRequest(CurlHandler& curl_handler) const {
-  // this is where we could add any logic required to make the request async or maybe handle retries/cancellation.
-  auto curl_ret = curl_handler.Perform();
-  if (CURLE_OK != curl_ret) {
-    const char* err = curl_easy_strerror(curl_ret);
-    KERNEL_LOG(GetLogger(), ORT_LOGGING_LEVEL_ERROR,
-               ("Curl error (CURLcode=" + std::to_string(curl_ret) + "): " + err).c_str());
+  CurlHandler::WriteStringCallbackData callback_data(GetLogger(), stream_);
+  CurlHandler curl_handler(handle_pool_);
+  PrepareRequest(curl_handler, full_auth, deadline, callback_data, inputs);
+
+  CURLcode curl_ret = CURLE_OK;
+  const std::chrono::milliseconds hedge_delay = retry_policy_->HedgeDelay();
+  if (hedge_delay.count() <= 0) {
+    // the calling thread waits for an async request, as custom operators can't yet return before their outputs
+    // are set.
+    curl_ret = executor_ ? curl_handler.Perform(*executor_) : curl_handler.Perform();
+    status = curl_handler.ResponseCode();
+    curl_handler.ReadMetrics(metrics, callback_data);
+    response.response = std::move(callback_data.response);
+    response.events = std::move(callback_data.events);
+  } else {
+    CurlMultiExecutor::Transfer transfer(curl_handler.Handle());
+    curl_handler.Start(*executor_, transfer);
+    if (executor_->WaitAny({&transfer}, std::min(start + hedge_delay, deadline)) >= 0) {
+      curl_ret = transfer.result;
+      status = curl_handler.ResponseCode();
+      curl_handler.ReadMetrics(metrics, callback_data);
+      response.response = std::move(callback_data.response);
+      response.events = std::move(callback_data.events);
+    } else {
+      CurlHandler::WriteStringCallbackData hedge_data(GetLogger(), stream_);
+      CurlHandler hedge_handler(handle_pool_);
+      PrepareRequest(hedge_handler, full_auth, deadline, hedge_data, inputs);
+      CurlMultiExecutor::Transfer hedge(hedge_handler.Handle());
+      hedge_handler.Start(*executor_, hedge);
+
+      // use the first successful response, or the result of the first to fail if both fail
+      int first = executor_->WaitAny({&transfer, &hedge}, Clock::time_point::max());
+      CurlMultiExecutor::Transfer* used = first == 0 ? &transfer : &hedge;
+      CurlMultiExecutor::Transfer* other = first == 0 ? &hedge : &transfer;
+      if (used->result != CURLE_OK) {
+        executor_->WaitAny({other}, Clock::time_point::max());
+        if (other->result == CURLE_OK) {
+          std::swap(used, other);
+        }
+      }
+
+      executor_->Cancel(*other);
+      const bool hedge_used = used == &hedge;
+      curl_ret = used->result;
+      status = (hedge_used ? hedge_handler : curl_handler).ResponseCode();
+      auto& used_data = hedge_used ? hedge_data : callback_data;
+      (hedge_used ? hedge_handler : curl_handler).ReadMetrics(metrics, used_data);
+      metrics.hedged = hedge_used;
+      response.response = std::move(used_data.response);
+      response.events = std::move(used_data.events);
+    }
+  }
 
-    ORTX_CXX_API_THROW(err, ORT_FAIL);
+  if (curl_ret == CURLE_OK) {
+    retry_policy_->RecordLatency(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start));
   }
+
+  return curl_ret;
 }
 }  // namespace ort_extensions
@@ -2,73 +2,259 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "curl/curl.h"
 
 #include "ocos.h"
 #include "cloud_base_kernel.hpp"
+#include "retry_policy.hpp"
 
 namespace ort_extensions {
 
+/// <summary>
+/// Easy handles kept for reuse across requests. A handle keeps its connection, DNS and TLS session caches
+/// when it's reset, so a request on a reused handle skips the TCP connect and TLS handshake to the same endpoint.
+/// </summary>
+class CurlHandlePool {
+ public:
+  CurlHandlePool() = default;
+  CurlHandlePool(const CurlHandlePool&) = delete;
+  CurlHandlePool& operator=(const CurlHandlePool&) = delete;
+  ~CurlHandlePool();
+
+  // Returns an idle handle, or a new one if all of them are in use, and sets `reused` if it's an idle one.
+  CURL* Acquire(bool& reused);
+  void Release(CURL* curl);
+
+ private:
+  std::mutex mutex_;
+  std::vector<CURL*> handles_;
+};
+
+/// <summary>
+/// Runs the transfers of the requests of all the nodes on one I/O thread with the curl multi interface, so the
+/// connections to an endpoint are shared by the nodes, and HTTP/2 requests are multiplexed on one connection.
+/// The executor is shared by the kernels that use it, and its thread stops when the last of them is released.
+/// </summary>
+class CurlMultiExecutor {
+ public:
+  // Returns the executor, and starts it if no kernel holds it.
+  static std::shared_ptr<CurlMultiExecutor> Get();
+
+  CurlMultiExecutor(const CurlMultiExecutor&) = delete;
+  CurlMultiExecutor& operator=(const CurlMultiExecutor&) = delete;
+  ~CurlMultiExecutor();
+
+  // A transfer of the request of a handle. It's set done by the I/O thread, and has to outlive its transfer.
+  struct Transfer {
+    explicit Transfer(CURL* curl_in) : curl{curl_in} {}
+    CURL* curl;
+    bool done{};
+    CURLcode result{CURLE_OK};
+  };
+
+  // Starts the transfer on the I/O thread.
+  void Start(Transfer& transfer);
+
+  // Waits until one of the transfers is done, or until the deadline. Returns the index of a transfer that's done,
+  // or -1 at the deadline.
+  int WaitAny(std::initializer_list<const Transfer*> transfers, std::chrono::steady_clock::time_point deadline);
+
+  // Stops the transfer if it's not done, and waits until its handle isn't used by the I/O thread.
+  void Cancel(Transfer& transfer);
+
+  // Transfers the request of the handle on the I/O thread, and waits for it.
+  CURLcode Perform(CURL* curl);
+
+ private:
+  CurlMultiExecutor();
+  void Run();
+
+  CURLM* multi_;
+  std::mutex mutex_;
+  std::condition_variable done_;
+  std::vector<Transfer*> added_;
+  std::vector<Transfer*> cancelled_;
+  std::unordered_map<CURL*, Transfer*> running_;
+  bool stop_{};
+  std::thread thread_;
+};
+
+/// <summary>
+/// Parser of a response of server-sent events, which keeps the data of each event as it arrives instead of the
+/// whole body. The stream of an OpenAI style endpoint ends with an event of "[DONE]", which isn't kept.
+/// </summary>
+/// <seealso cref="https://html.spec.whatwg.org/multipage/server-sent-events.html#event-stream-interpretation"/>
+class ServerSentEvents {
+ public:
+  void Append(const char* data, size_t size);
+
+  const std::vector<std::string>& Events() const { return events_; }
+  std::vector<std::string>& Events() { return events_; }
+
+  // time of the first event, to measure the time to the first token
+  std::chrono::steady_clock::time_point FirstEventTime() const { return first_event_time_; }
+
+ private:
+  void ProcessLine(const char* line, size_t size);
+
+  std::vector<std::string> events_;
+  std::string line_;  // the incomplete last line
+  std::string data_;  // the data of the event being received
+  bool has_data_{};
+  bool last_was_cr_{};
+  bool done_{};
+  std::chrono::steady_clock::time_point first_event_time_{};
+};
+
+/// <summary>
+/// Metrics of a request, to tune the timeouts and the reuse of the connections.
+/// </summary>
+struct RequestMetrics {
+  // the durations of the phases of the transfer of the response in milliseconds: the name lookup, the TCP connect,
+  // the TLS handshake, the upload and the time of the server until the first byte of the response, which curl
+  // doesn't measure apart, and the download of the response.
+  double dns_ms{};
+  double connect_ms{};
+  double tls_ms{};
+  double request_ms{};
+  double download_ms{};
+  double transfer_ms{};  // the total of the transfer
+  double total_ms{};     // of all the attempts and the backoffs between them
+  int64_t bytes_sent{};
+  int64_t bytes_received{};
+  int64_t new_connections{};  // 0 if the request reused a live connection
+  bool handle_reused{};       // the curl handle came from the pool of the node
+  int64_t attempts{};
+  bool hedged{};  // the response is of the hedged request
+  bool cache_hit{};
+
+  static constexpr size_t kCount = 14;
+
+  // the values in the order of the fields, which are the values of a metrics output
+  std::array<double, kCount> Values() const;
+  std::string ToString() const;
+};
+
 class CurlHandler {
  public:
   using WriteCallBack = size_t (*)(char*, size_t, size_t, void*);
 
-  CurlHandler();
-  ~CurlHandler() = default;
+  // Takes a handle from the pool and resets its options, and returns it to the pool on destruction.
+  explicit CurlHandler(CurlHandlePool& pool);
+  CurlHandler(const CurlHandler&) = delete;
+  CurlHandler& operator=(const CurlHandler&) = delete;
+  ~CurlHandler();
 
   void AddHeader(const char* data) {
     headers_.reset(curl_slist_append(headers_.release(), data));
   }
 
-  template <typename... Args>
-  void AddForm(Args... args) {
-    curl_formadd(&from_, &last_, args...);
-  }
+  // Adds a part of a multipart form with a copy of the zero-terminated value.
+  void AddFormString(const char* name, const char* value);
 
-  void AddFormString(const char* name, const char* value) {
-    AddForm(CURLFORM_COPYNAME, name,
-            CURLFORM_COPYCONTENTS, value,
-            CURLFORM_END);
-  }
+  // Adds a file part of a multipart form. The part is read from the buffer while the request is sent, without a copy,
+  // so the buffer has to outlive the request.
+  void AddFormBuffer(const char* name, const char* buffer_name, const void* buffer_ptr, size_t buffer_len);
 
-  void AddFormBuffer(const char* name, const char* buffer_name, const void* buffer_ptr, size_t buffer_len) {
-    AddForm(CURLFORM_COPYNAME, name,
-            CURLFORM_BUFFER, buffer_name,
-            CURLFORM_BUFFERPTR, buffer_ptr,
-            CURLFORM_BUFFERLENGTH, buffer_len,
-            CURLFORM_END);
-  }
+  // Sets the body of a POST request. If `compress` is set, the body is sent gzip compressed with its
+  // Content-Encoding header, otherwise the data is sent without a copy and has to outlive the request.
+  void SetPostBody(const void* data, size_t size, bool compress);
 
   template <typename T>
   void SetOption(CURLoption opt, T val) {
-    curl_easy_setopt(curl_.get(), opt, val);
+    curl_easy_setopt(curl_, opt, val);
   }
 
   CURLcode Perform() {
-    SetOption(CURLOPT_HTTPHEADER, headers_.get());
-    if (from_) {
-      SetOption(CURLOPT_HTTPPOST, from_);
-    }
+    SetRequestData();
+    return curl_easy_perform(curl_);
+  }
 
-    return curl_easy_perform(curl_.get());
+  CURLcode Perform(CurlMultiExecutor& executor) {
+    SetRequestData();
+    return executor.Perform(curl_);
+  }
+
+  // Starts the transfer of the request on the I/O thread of the executor. `transfer` has to be of this handle.
+  void Start(CurlMultiExecutor& executor, CurlMultiExecutor::Transfer& transfer) {
+    SetRequestData();
+    executor.Start(transfer);
+  }
+
+  CURL* Handle() const { return curl_; }
+
+  struct WriteStringCallbackData;
+
+  // Sets the metrics of the transfer and the handle, after the request of `data` is performed.
+  void ReadMetrics(RequestMetrics& metrics, const WriteStringCallbackData& data) const;
+
+  // HTTP status code of the response, or 0 if there's none
+  long ResponseCode() const {
+    long code = 0;
+    curl_easy_getinfo(curl_, CURLINFO_RESPONSE_CODE, &code);
+    return code;
   }
 
   struct WriteStringCallbackData {
-    WriteStringCallbackData(const Logger& logger_in) : logger{logger_in} {}
+    WriteStringCallbackData(const Logger& logger_in, bool stream = false)
+        : logger{logger_in}, events{stream ? std::make_unique<ServerSentEvents>() : nullptr} {}
     std::string response;
-    const Logger& logger;
+    const Logger logger;
+    // set to parse the response as server-sent events instead of keeping the body in `response`
+    std::unique_ptr<ServerSentEvents> events;
+    // time of the status line of the response, after the informational responses like 100 Continue
+    std::chrono::steady_clock::time_point response_time{};
+    // status code of that line. the body of a response that isn't a success is kept in `response` even if it's
+    // streamed, since it's the error of the request instead of events.
+    long status{};
+    bool IsSuccess() const { return status >= 200 && status < 300; }
+    // of the kernel the request is made for, which the progress of the transfer polls on the thread running it
+    ort_extensions::RunCancellation::Token cancellation{ort_extensions::RunCancellation::Current()};
   };
 
  private:
+  void SetRequestData() {
+    start_time_ = std::chrono::steady_clock::now();
+    SetOption(CURLOPT_HTTPHEADER, headers_.get());
+    if (mime_) {
+      SetOption(CURLOPT_MIMEPOST, mime_.get());
+    }
+  }
+
   static size_t WriteStringCallback(char* contents, size_t element_size, size_t num_elements, void* userdata);
+  static size_t HeaderCallback(char* buffer, size_t element_size, size_t num_elements, void* userdata);
+  static int ProgressCallback(void* userdata, curl_off_t download_total, curl_off_t downloaded,
+                              curl_off_t upload_total, curl_off_t uploaded);
+
+  // a buffer of a form part, and the offset of its next byte to send
+  struct FormBuffer {
+    const char* data;
+    size_t size;
+    size_t offset;
+  };
+
+  curl_mimepart* AddFormPart(const char* name);
+  static size_t ReadFormBuffer(char* buffer, size_t element_size, size_t num_elements, void* userdata);
+  static int SeekFormBuffer(void* userdata, curl_off_t offset, int origin);
 
-  std::unique_ptr<CURL, decltype(curl_easy_cleanup)*> curl_;
+  CurlHandlePool& pool_;
+  CURL* curl_{};
+  bool handle_reused_{};
+  std::chrono::steady_clock::time_point start_time_{};
   std::unique_ptr<curl_slist, decltype(curl_slist_free_all)*> headers_;
-  curl_httppost* from_{};
-  curl_httppost* last_{};
-  std::unique_ptr<curl_httppost, decltype(curl_formfree)*> from_holder_;
+  std::unique_ptr<curl_mime, decltype(curl_mime_free)*> mime_;
+  std::list<FormBuffer> form_buffers_;  // a list so the addresses given to the callbacks are stable
+  std::vector<uint8_t> compressed_body_;
 };
 
 /// <summary>
@@ -86,13 +272,62 @@ class CurlInvoker : public CloudBaseKernel {
   // see /test/data/azure/get_certs_for_model.py for example processing of a PEM file to extract the certificates.
   static constexpr const char* kX509Certificates = "x509_certificates";  
 
+  // attribute to run the requests on the shared I/O thread of CurlMultiExecutor instead of the calling thread.
+  static constexpr const char* kAsync = "async";
+
+  // attributes for the HTTP version, "1.1" or "2", and whether request bodies are gzip compressed and
+  // compressed responses are accepted. HTTP/2 is only negotiated over TLS.
+  static constexpr const char* kHttpVersion = "http_version";
+  static constexpr const char* kCompressRequest = "compress_request";
+  static constexpr const char* kCompressResponse = "compress_response";
+
+  // attributes of the retry policy. a request is retried up to max_attempts in total on a transient curl error or
+  // a response of the retryable status codes, after a random backoff of up to retry_backoff_ms doubled at each retry
+  // and capped at retry_backoff_max_ms. the timeout is the time budget of all the attempts.
+  static constexpr const char* kMaxAttempts = "max_attempts";
+  static constexpr const char* kRetryBackoffMs = "retry_backoff_ms";
+  static constexpr const char* kRetryBackoffMaxMs = "retry_backoff_max_ms";
+  static constexpr const char* kRetryStatusCodes = "retry_status_codes";
+
+  // attribute for a duplicate request sent if the response isn't received after this delay. the first successful
+  // response is used. -1 uses the 95th percentile of the latencies of recent requests once enough are known.
+  // hedged requests are transferred on the I/O thread of CurlMultiExecutor.
+  static constexpr const char* kHedgeDelayMs = "hedge_delay_ms";
+
+  // attribute to parse the response as a stream of server-sent events, like the chat completions of a request
+  // with "stream": true. the data of the events is given to ProcessEvents instead of the body to ProcessResponse.
+  static constexpr const char* kStream = "stream";
+
+  // attribute for the level the metrics of each request are logged at, as an ORT_LOGGING_LEVEL_... value. the
+  // default of -1 doesn't log them. the metrics are also set in the metrics output if the node has one.
+  static constexpr const char* kMetricsLogLevel = "metrics_log_level";
+
+  // the derived classes that send a raw body compress it if this is set. multipart forms aren't compressed.
+  bool CompressRequest() const { return compress_request_; }
+
   // Compute implementation that is used to co-ordinate all Curl based Azure requests.
   // Derived classes need their own Compute to work with the CustomOpLite infrastructure
   void ComputeImpl(const ortc::Variadic& inputs, ortc::Variadic& outputs) const;
   virtual std::string ComposeFullAuthToken(const std::string& auth_token) const;
 
  private:
-  void ExecuteRequest(CurlHandler& handler) const;
+  using Clock = std::chrono::steady_clock;
+
+  // sets the options that apply to all usages, and the request of the derived class
+  void PrepareRequest(CurlHandler& curl_handler, const std::string& full_auth, Clock::time_point deadline,
+                      CurlHandler::WriteStringCallbackData& callback_data, const ortc::Variadic& inputs) const;
+
+  // makes an attempt of the request, hedged if that's enabled, and returns the result of the response it uses
+  CURLcode ExecuteRequest(const ortc::Variadic& inputs, const std::string& full_auth, Clock::time_point deadline,
+                          CurlHandler::WriteStringCallbackData& response, long& status,
+                          RequestMetrics& metrics) const;
+
+  // logs the metrics and sets the metrics output, if they're enabled
+  void ReportMetrics(const RequestMetrics& metrics, ortc::Variadic& outputs) const;
+
+  // opens the connections of prewarm with HEAD requests, whose responses are ignored. the connections, the DNS
+  // lookups and the TLS sessions are kept by the handles of the pool, or by the multi handle of the executor.
+  void WarmConnections() const;
 
   // Derived classes can add any arg validation required.
   // Prior to this being called, `inputs` are validated to match the number of input names, and
@@ -105,5 +340,27 @@ class CurlInvoker : public CloudBaseKernel {
   // curl_handler has auth token set from input[0].
   virtual void SetupRequest(CurlHandler& curl_handler, const ortc::Variadic& inputs) const = 0;
   virtual void ProcessResponse(const std::string& response, ortc::Variadic& outputs) const = 0;
+
+  // processes the data of the events of a streamed response, in their order.
+  virtual void ProcessEvents(std::vector<std::string>& events, ortc::Variadic& outputs) const {
+    ORTX_CXX_API_THROW("the operator doesn't support streamed responses", ORT_INVALID_ARGUMENT);
+  }
+
+  // handles reused by the requests of this node, which are usually all to the same endpoint
+  mutable CurlHandlePool handle_pool_;
+  // set if the requests are transferred by the multi interface
+  std::shared_ptr<CurlMultiExecutor> executor_;
+
+  long http_version_{CURL_HTTP_VERSION_NONE};
+  bool compress_request_{};
+  bool compress_response_{};
+  bool stream_{};
+  int64_t metrics_log_level_{-1};
+
+  // the retries and the hedged requests, and the latencies of the recent requests for the hedge delay
+  std::unique_ptr<RetryPolicy> retry_policy_;
+
+  // set if prewarm is enabled. it's the last member, so its thread is stopped before the handles are released.
+  std::unique_ptr<ConnectionWarmer> warmer_;
 };
 }  // namespace ort_extensions
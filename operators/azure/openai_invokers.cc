@@ -47,7 +47,7 @@ void OpenAIAudioToTextInvoker::ValidateInputs(const ortc::Variadic& inputs) cons
 
 void OpenAIAudioToTextInvoker::SetupRequest(CurlHandler& curl_handler, const ortc::Variadic& inputs) const {
   // theoretically the filename the content was buffered from. provides the extensions indicating the audio format
-  static const std::string fake_filename = "audio." + audio_format_;
+  const std::string fake_filename = "audio." + audio_format_;
 
   const auto& property_names = RequestPropertyNames();
 
@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ort_extensions {
+
+/// <summary>
+/// Coalesces the concurrent requests of the kernels with the same key into batches executed by one call.
+/// There's no thread of its own. The first caller waiting for a batch leads it: it waits for the window, or until
+/// the batch is full, and executes the batch for all the callers in it, which wait for their results.
+/// </summary>
+template <typename Request>
+class RequestBatcher {
+ public:
+  // Executes the requests of a batch, and sets their results. The error of a request that failed on its own is set
+  // at its index in `errors`, which has an element for each request.
+  using Execute = std::function<void(const std::vector<Request*>& requests, std::vector<std::exception_ptr>& errors)>;
+
+  // Returns the batcher of the key, which is shared by the kernels holding it.
+  static std::shared_ptr<RequestBatcher> Get(const std::string& key) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::weak_ptr<RequestBatcher>> batchers;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = batchers.begin(); it != batchers.end();) {
+      it = it->second.expired() ? batchers.erase(it) : std::next(it);
+    }
+
+    std::shared_ptr<RequestBatcher> batcher = batchers[key].lock();
+    if (!batcher) {
+      batcher = std::make_shared<RequestBatcher>();
+      batchers[key] = batcher;
+    }
+
+    return batcher;
+  }
+
+  // Executes the request in a batch, and returns when it's executed. The error of the request is rethrown to its
+  // caller, and an exception thrown by the execution of the batch is rethrown to all the callers without one.
+  void Run(Request& request, size_t max_batch_size, std::chrono::microseconds window, const Execute& execute) {
+    Entry entry{&request};
+    std::unique_lock<std::mutex> lock(mutex_);
+    pending_.push_back(&entry);
+    // a leader waiting for a full batch may be able to take it now
+    changed_.notify_all();
+
+    while (!entry.done) {
+      if (leading_) {
+        changed_.wait(lock);
+        continue;
+      }
+
+      leading_ = true;
+      changed_.wait_until(lock, std::chrono::steady_clock::now() + window,
+                          [this, max_batch_size] { return pending_.size() >= max_batch_size; });
+
+      // the batch is the oldest requests, which may not include this one if more are waiting
+      const size_t batch_size = std::min(pending_.size(), max_batch_size);
+      std::vector<Entry*> batch(pending_.begin(), pending_.begin() + batch_size);
+      pending_.erase(pending_.begin(), pending_.begin() + batch_size);
+      leading_ = false;
+      if (!pending_.empty()) {
+        changed_.notify_all();  // one of the requests left leads the next batch
+      }
+
+      lock.unlock();
+      std::vector<Request*> requests;
+      requests.reserve(batch.size());
+      for (Entry* batch_entry : batch) {
+        requests.push_back(batch_entry->request);
+      }
+
+      std::vector<std::exception_ptr> errors(batch.size());
+      std::exception_ptr error;
+      try {
+        execute(requests, errors);
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      lock.lock();
+      for (size_t i = 0; i < batch.size(); ++i) {
+        batch[i]->error = errors[i] ? errors[i] : error;
+        batch[i]->done = true;
+      }
+
+      changed_.notify_all();
+    }
+
+    if (entry.error) {
+      std::rethrow_exception(entry.error);
+    }
+  }
+
+ private:
+  struct Entry {
+    explicit Entry(Request* request_in) : request{request_in} {}
+    Request* request;
+    bool done{};
+    std::exception_ptr error;
+  };
+
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  std::vector<Entry*> pending_;
+  bool leading_{};
+};
+
+}  // namespace ort_extensions
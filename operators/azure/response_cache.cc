@@ -0,0 +1,291 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "response_cache.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#include "farmhash.h"
+#include "runtime_stats.h"
+
+namespace ort_extensions {
+namespace {
+// the header of a file of a response, after which are the expiry in seconds since the epoch, the count of the parts,
+// and the size and bytes of each part
+constexpr char kFileMagic[8] = {'O', 'R', 'T', 'X', 'R', 'C', '1', '\0'};
+
+// the bytes counted for a response, with a small overhead per part
+size_t ResponseBytes(const ResponseCache::Response& response) {
+  size_t bytes = 0;
+  for (const auto& part : response) {
+    bytes += part.size() + sizeof(uint64_t);
+  }
+
+  return bytes;
+}
+}  // namespace
+
+/*static */ ResponseCache::Key ResponseCache::RequestKey(std::string request, std::string_view auth_token) {
+  const auto token_fingerprint = util::Fingerprint128(auth_token.data(), auth_token.size());
+  request.append(reinterpret_cast<const char*>(&token_fingerprint.first), sizeof(token_fingerprint.first));
+  request.append(reinterpret_cast<const char*>(&token_fingerprint.second), sizeof(token_fingerprint.second));
+  const auto fingerprint = util::Fingerprint128(request.data(), request.size());
+  return Key{util::Uint128Low64(fingerprint), util::Uint128High64(fingerprint)};
+}
+
+ResponseCache::ResponseCache(size_t max_bytes, std::chrono::seconds ttl, std::string directory)
+    : max_bytes_{max_bytes}, ttl_{ttl}, directory_{std::move(directory)} {
+  if (!directory_.empty()) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    PruneFiles();
+  }
+}
+
+ResponseCache::~ResponseCache() {
+  Unregister();
+  static StatCounter& bytes = RuntimeStats::Instance().Counter("response_cache.bytes");
+  bytes.Add(-static_cast<int64_t>(bytes_));
+}
+
+bool ResponseCache::Lookup(const Key& key, Response& response) {
+  static StatCounter& hits = RuntimeStats::Instance().Counter("response_cache.hits");
+  static StatCounter& misses = RuntimeStats::Instance().Counter("response_cache.misses");
+  const bool found = Find(key, response);
+  (found ? hits : misses).Add();
+  return found;
+}
+
+bool ResponseCache::Find(const Key& key, Response& response) {
+  const auto now = Clock::now();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      if (it->second->expiry > now) {
+        entries_.splice(entries_.begin(), entries_, it->second);
+        response = it->second->response;
+        Touch();
+        return true;
+      }
+
+      AddBytes(-static_cast<int64_t>(it->second->bytes));
+      entries_.erase(it->second);
+      index_.erase(it);
+    }
+  }
+
+  if (directory_.empty()) {
+    return false;
+  }
+
+  Clock::time_point expiry;
+  if (!ReadFile(key, response, expiry)) {
+    return false;
+  }
+
+  if (expiry <= now) {
+    std::error_code ec;
+    std::filesystem::remove(FilePath(key), ec);
+    return false;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    InsertInMemory(key, response, expiry);
+  }
+
+  MemoryBudget::Instance().Reclaim();
+  return true;
+}
+
+void ResponseCache::Insert(const Key& key, const Response& response) {
+  if (ResponseBytes(response) > max_bytes_) {
+    return;
+  }
+
+  const Clock::time_point expiry = ttl_.count() > 0 ? Clock::now() + ttl_ : Clock::time_point::max();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    InsertInMemory(key, response, expiry);
+  }
+
+  // without the lock, which the release of this cache takes
+  MemoryBudget::Instance().Reclaim();
+  if (!directory_.empty()) {
+    WriteFile(key, response, expiry);
+  }
+}
+
+void ResponseCache::Release(size_t bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const size_t target = bytes_ > bytes ? bytes_ - bytes : 0;
+  while (bytes_ > target && !entries_.empty()) {
+    AddBytes(-static_cast<int64_t>(entries_.back().bytes));
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+}
+
+void ResponseCache::InsertInMemory(const Key& key, Response response, Clock::time_point expiry) {
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    AddBytes(-static_cast<int64_t>(it->second->bytes));
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+
+  const size_t bytes = ResponseBytes(response);
+  entries_.push_front(Entry{key, std::move(response), expiry, bytes});
+  index_.emplace(key, entries_.begin());
+  AddBytes(static_cast<int64_t>(bytes));
+  while (bytes_ > max_bytes_ && !entries_.empty()) {
+    AddBytes(-static_cast<int64_t>(entries_.back().bytes));
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+}
+
+void ResponseCache::AddBytes(int64_t delta) {
+  static StatCounter& bytes = RuntimeStats::Instance().Counter("response_cache.bytes");
+  bytes_ = static_cast<size_t>(static_cast<int64_t>(bytes_) + delta);
+  bytes.Add(delta);
+  Charge(delta);
+}
+
+std::string ResponseCache::FilePath(const Key& key) const {
+  char name[40];
+  std::snprintf(name, sizeof(name), "%016llx%016llx.bin",
+                static_cast<unsigned long long>(key.high), static_cast<unsigned long long>(key.low));
+  return (std::filesystem::path(directory_) / name).string();
+}
+
+bool ResponseCache::ReadFile(const Key& key, Response& response, Clock::time_point& expiry) const {
+  std::ifstream file(FilePath(key), std::ios::binary);
+  if (!file) {
+    return false;
+  }
+
+  char magic[sizeof(kFileMagic)];
+  int64_t expiry_seconds = 0;
+  uint64_t count = 0;
+  if (!file.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), kFileMagic) ||
+      !file.read(reinterpret_cast<char*>(&expiry_seconds), sizeof(expiry_seconds)) ||
+      !file.read(reinterpret_cast<char*>(&count), sizeof(count)) || count > max_bytes_) {
+    return false;
+  }
+
+  response.clear();
+  response.reserve(static_cast<size_t>(count));
+  size_t total = 0;
+  for (uint64_t i = 0; i < count; ++i) {
+    uint64_t size = 0;
+    if (!file.read(reinterpret_cast<char*>(&size), sizeof(size)) || (total += size) > max_bytes_) {
+      return false;
+    }
+
+    std::string part(static_cast<size_t>(size), '\0');
+    if (!file.read(part.data(), static_cast<std::streamsize>(size))) {
+      return false;
+    }
+
+    response.push_back(std::move(part));
+  }
+
+  expiry = expiry_seconds == INT64_MAX ? Clock::time_point::max()
+                                       : Clock::time_point(std::chrono::seconds(expiry_seconds));
+  return true;
+}
+
+void ResponseCache::WriteFile(const Key& key, const Response& response, Clock::time_point expiry) {
+  const std::string path = FilePath(key);
+  // written to a temporary file of its own first, so a reader never sees a partial file
+  static const uint64_t writer_id = std::random_device{}();
+  static std::atomic<uint64_t> write_count{0};
+  const std::string temp_path = path + "." + std::to_string(writer_id) + "." + std::to_string(write_count++) + ".tmp";
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    const int64_t expiry_seconds =
+        expiry == Clock::time_point::max()
+            ? INT64_MAX
+            : std::chrono::duration_cast<std::chrono::seconds>(expiry.time_since_epoch()).count();
+    const uint64_t count = response.size();
+    file.write(kFileMagic, sizeof(kFileMagic));
+    file.write(reinterpret_cast<const char*>(&expiry_seconds), sizeof(expiry_seconds));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (const auto& part : response) {
+      const uint64_t size = part.size();
+      file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+      file.write(part.data(), static_cast<std::streamsize>(size));
+    }
+
+    if (!file) {
+      file.close();
+      std::error_code ec;
+      std::filesystem::remove(temp_path, ec);
+      return;
+    }
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(temp_path, path, ec);
+  if (ec) {
+    std::filesystem::remove(temp_path, ec);
+    return;
+  }
+
+  bool prune = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    file_bytes_ += ResponseBytes(response);
+    prune = file_bytes_ > max_bytes_;
+  }
+
+  if (prune) {
+    PruneFiles();
+  }
+}
+
+void ResponseCache::PruneFiles() {
+  struct File {
+    std::filesystem::path path;
+    std::filesystem::file_time_type time;
+    uintmax_t size;
+  };
+
+  std::vector<File> files;
+  std::error_code ec;
+  for (const auto& item : std::filesystem::directory_iterator(directory_, ec)) {
+    if (item.path().extension() != ".bin") {
+      continue;
+    }
+
+    std::error_code item_ec;
+    auto time = item.last_write_time(item_ec);
+    auto size = item.file_size(item_ec);
+    if (!item_ec) {
+      files.push_back(File{item.path(), time, size});
+    }
+  }
+
+  // the most recently written are kept
+  std::sort(files.begin(), files.end(), [](const File& a, const File& b) { return a.time > b.time; });
+  uintmax_t total = 0;
+  for (const auto& file : files) {
+    if (total + file.size <= max_bytes_) {
+      total += file.size;
+    } else {
+      std::filesystem::remove(file.path, ec);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  file_bytes_ = static_cast<size_t>(total);
+}
+
+}  // namespace ort_extensions
@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "memory_budget.h"
+
+namespace ort_extensions {
+
+/// <summary>
+/// A cache of the responses of requests, by a 128-bit fingerprint of the request. The responses are bounded by their
+/// total size and expire after the TTL. If a directory is given, the responses are also kept in a file each, so they
+/// outlive the process, in a total size of the same bound. The responses in memory are charged to the MemoryBudget of
+/// the process, which evicts the least recently used ones under its limit, and keeps their files.
+/// </summary>
+class ResponseCache : public MemoryBudget::Consumer {
+ public:
+  struct Key {
+    uint64_t low;
+    uint64_t high;
+    bool operator==(const Key& other) const { return low == other.low && high == other.high; }
+  };
+
+  // A response is the strings of its parts, like the body of a response or the data of its tensors.
+  using Response = std::vector<std::string>;
+
+  // The key of a request of the description, like its endpoint and the data of its inputs, and of the auth token it's
+  // sent with, so that a response isn't returned to a request of another principal, which the endpoint may answer
+  // differently. Only the fingerprint of the token is in the key.
+  static Key RequestKey(std::string request, std::string_view auth_token);
+
+  // A TTL of 0 doesn't expire the responses.
+  ResponseCache(size_t max_bytes, std::chrono::seconds ttl, std::string directory);
+  ResponseCache(const ResponseCache&) = delete;
+  ResponseCache& operator=(const ResponseCache&) = delete;
+  ~ResponseCache() override;
+
+  // Copies the response of the key into `response`, and returns false if there's none that hasn't expired.
+  // The lookups are counted in response_cache.hits and response_cache.misses of the runtime statistics, and the
+  // bytes in memory in response_cache.bytes.
+  bool Lookup(const Key& key, Response& response);
+  void Insert(const Key& key, const Response& response);
+
+  // Evicts the least recently used responses in memory until `bytes` of them are released.
+  void Release(size_t bytes) override;
+
+ private:
+  using Clock = std::chrono::system_clock;
+
+  struct Entry {
+    Key key;
+    Response response;
+    Clock::time_point expiry;
+    size_t bytes;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const { return static_cast<size_t>(key.low); }
+  };
+
+  bool Find(const Key& key, Response& response);
+  void InsertInMemory(const Key& key, Response response, Clock::time_point expiry);
+  // changes the bytes in memory, and their count in the runtime statistics and the budget
+  void AddBytes(int64_t delta);
+  bool ReadFile(const Key& key, Response& response, Clock::time_point& expiry) const;
+  void WriteFile(const Key& key, const Response& response, Clock::time_point expiry);
+  // deletes the least recently written files until they fit in the bound. an expired file is deleted by its lookup.
+  void PruneFiles();
+  std::string FilePath(const Key& key) const;
+
+  const size_t max_bytes_;
+  const std::chrono::seconds ttl_;
+  const std::string directory_;
+
+  std::mutex mutex_;
+  std::list<Entry> entries_;  // the most recently used first
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+  size_t bytes_{};
+  size_t file_bytes_{};
+};
+
+}  // namespace ort_extensions
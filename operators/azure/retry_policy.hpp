@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "curl/curl.h"
+
+namespace ort_extensions {
+
+/// <summary>
+/// The retry and hedging policy of the requests of a CurlInvoker node. A request is retried on a transient curl
+/// error or a response of the retryable status codes, after a backoff with full jitter. A duplicate request can be
+/// sent after a fixed delay, or after the 95th percentile of the latencies of the recent successful requests.
+/// </summary>
+class RetryPolicy {
+ public:
+  struct Options {
+    int64_t max_attempts{1};
+    int64_t backoff_ms{200};
+    int64_t backoff_max_ms{5000};
+    std::vector<int64_t> status_codes{429, 502, 503, 504};
+    // 0 disables hedging, and -1 uses the 95th percentile of the recent latencies
+    int64_t hedge_delay_ms{0};
+  };
+
+  // the latencies of the recent successful requests are kept in a ring of kLatencySamples. the adaptive hedge delay
+  // is used once kMinLatencySamples are known.
+  static constexpr size_t kLatencySamples = 64;
+  static constexpr size_t kMinLatencySamples = 16;
+
+  explicit RetryPolicy(Options options) : options_(std::move(options)) {}
+
+  const Options& GetOptions() const { return options_; }
+
+  // whether the attempt of a result and the status of its response should be retried
+  bool IsRetryable(CURLcode result, long status) const {
+    switch (result) {
+      case CURLE_OK:
+        return std::find(options_.status_codes.begin(), options_.status_codes.end(), status) !=
+               options_.status_codes.end();
+      case CURLE_COULDNT_RESOLVE_HOST:
+      case CURLE_COULDNT_CONNECT:
+      case CURLE_OPERATION_TIMEDOUT:
+      case CURLE_SSL_CONNECT_ERROR:
+      case CURLE_GOT_NOTHING:
+      case CURLE_SEND_ERROR:
+      case CURLE_RECV_ERROR:
+      case CURLE_PARTIAL_FILE:
+      case CURLE_HTTP2:
+      case CURLE_HTTP2_STREAM:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  // the upper bound of the backoff after an attempt, starting at 1. it's doubled at each retry and capped.
+  std::chrono::milliseconds MaxBackoff(int64_t attempt) const {
+    int64_t backoff = options_.backoff_ms;
+    for (int64_t i = 1; i < attempt && backoff < options_.backoff_max_ms; ++i) {
+      backoff *= 2;
+    }
+
+    return std::chrono::milliseconds(std::min(backoff, options_.backoff_max_ms));
+  }
+
+  // the exponential backoff with full jitter, so the retries of the clients throttled together are spread out
+  std::chrono::milliseconds Backoff(int64_t attempt) const {
+    thread_local std::mt19937_64 generator{std::random_device{}()};
+    return std::chrono::milliseconds(
+        std::uniform_int_distribution<int64_t>(0, MaxBackoff(attempt).count())(generator));
+  }
+
+  // the delay of the hedged request. 0 doesn't hedge the request.
+  std::chrono::milliseconds HedgeDelay() const {
+    if (options_.hedge_delay_ms >= 0) {
+      return std::chrono::milliseconds(options_.hedge_delay_ms);
+    }
+
+    std::vector<int64_t> latencies;
+    {
+      std::lock_guard<std::mutex> lock(latency_mutex_);
+      if (latencies_ms_.size() < kMinLatencySamples) {
+        return std::chrono::milliseconds(0);
+      }
+
+      latencies = latencies_ms_;
+    }
+
+    auto p95 = latencies.begin() + (latencies.size() * 95) / 100;
+    std::nth_element(latencies.begin(), p95, latencies.end());
+    return std::chrono::milliseconds(std::max<int64_t>(*p95, 1));
+  }
+
+  // records the latency of a successful request. it's only kept for the adaptive hedge delay.
+  void RecordLatency(std::chrono::milliseconds latency) {
+    if (options_.hedge_delay_ms >= 0) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(latency_mutex_);
+    if (latencies_ms_.size() < kLatencySamples) {
+      latencies_ms_.push_back(latency.count());
+    } else {
+      latencies_ms_[next_latency_] = latency.count();
+      next_latency_ = (next_latency_ + 1) % kLatencySamples;
+    }
+  }
+
+  size_t LatencySamples() const {
+    std::lock_guard<std::mutex> lock(latency_mutex_);
+    return latencies_ms_.size();
+  }
+
+ private:
+  const Options options_;
+
+  mutable std::mutex latency_mutex_;
+  std::vector<int64_t> latencies_ms_;
+  size_t next_latency_{};
+};
+}  // namespace ort_extensions
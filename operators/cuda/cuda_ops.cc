@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "ocos.h"
+#include "cuda_staging.h"
+#ifdef ENABLE_DR_LIBS
+#include "log_mel_cuda.hpp"
+#include "audio/audio_decoder.hpp"
+#endif
+#ifdef ENABLE_VISION
+#include "image_normalize_cuda.hpp"
+#include "vision/decode_image.hpp"
+#include "vision/decode_image_normalize.hpp"
+#endif
+#ifdef ENABLE_GPT2_TOKENIZER
+#include "gpt2_tokenizer.hpp"
+#include "hf_tokenizer.hpp"
+#endif
+#ifdef ENABLE_BERT_TOKENIZER
+#include "bert_tokenizer.hpp"
+#endif
+
+// The CUDA kernels are registered with the names of the CPU ones in the same domains, so ORT assigns a node to
+// the CUDA execution provider when a session has it, and to the CPU kernel otherwise.
+FxLoadCustomOpFactory LoadCustomOpClasses_Cuda = []() -> CustomOpArray& {
+#ifdef ENABLE_DR_LIBS
+  static OrtOpLoader op_loader(CustomCudaStruct("LogMelSpectrogram", ort_extensions::LogMelSpectrogramCuda));
+  return op_loader.GetCustomOps();
+#else
+  return LoadCustomOpClasses<>();
+#endif
+};
+
+FxLoadCustomOpFactory LoadCustomOpClasses_CudaExtensions = []() -> CustomOpArray& {
+#ifdef ENABLE_VISION
+  static OrtOpLoader op_loader(CustomCudaStruct("ImageNormalize", ort_extensions::KernelImageNormalizeCuda));
+  return op_loader.GetCustomOps();
+#else
+  return LoadCustomOpClasses<>();
+#endif
+};
+
+// The head of the op lists whose ops are all optional, which OrtOpLoader skips.
+static std::shared_ptr<ortc::OrtLiteCustomOp> NoOp() { return nullptr; }
+
+// The CPU kernels of the preprocessing, registered for the CUDA execution provider with their outputs staged in
+// the pinned memory when the session asks for it, see UseCudaStagedOutputs. The tokenizers are in both domains.
+FxLoadCustomOpFactory LoadCustomOpClasses_CudaStaged = []() -> CustomOpArray& {
+  static OrtOpLoader op_loader(
+      NoOp
+#ifdef ENABLE_DR_LIBS
+      ,
+      CustomCudaStagedStruct("AudioDecoder", AudioDecoder),
+      CustomCudaStagedStruct("AudioDecoderInt16", AudioDecoderInt16),
+      CustomCudaStagedStruct("AudioDecoderBatch", AudioDecoderBatch)
+#endif
+#ifdef ENABLE_GPT2_TOKENIZER
+      ,
+      CustomCudaStagedStruct("GPT2Tokenizer", KernelBpeTokenizer<int64_t>),
+      CustomCudaStagedStruct("GPT2Tokenizer", KernelBpeTokenizer<int32_t>),
+      CustomCudaStagedStruct("HfTokenizer", KernelHfTokenizer)
+#endif
+#ifdef ENABLE_BERT_TOKENIZER
+      ,
+      CustomCudaStagedStruct("BertTokenizer", KernelBertTokenizer<int64_t>),
+      CustomCudaStagedStruct("BertTokenizer", KernelBertTokenizer<int32_t>)
+#endif
+  );
+  return op_loader.GetCustomOps();
+};
+
+FxLoadCustomOpFactory LoadCustomOpClasses_CudaStagedExtensions = []() -> CustomOpArray& {
+  static OrtOpLoader op_loader(
+      NoOp
+#ifdef ENABLE_VISION
+      ,
+      CustomCudaStagedStruct("DecodeImage", ort_extensions::KernelDecodeImage),
+      CustomCudaStagedStruct("DecodeImageNormalize", ort_extensions::KernelDecodeImageNormalize)
+#endif
+#ifdef ENABLE_GPT2_TOKENIZER
+      ,
+      CustomCudaStagedStruct("GPT2Tokenizer", KernelBpeTokenizer<int64_t>),
+      CustomCudaStagedStruct("GPT2Tokenizer", KernelBpeTokenizer<int32_t>),
+      CustomCudaStagedStruct("HfTokenizer", KernelHfTokenizer)
+#endif
+#ifdef ENABLE_BERT_TOKENIZER
+      ,
+      CustomCudaStagedStruct("BertTokenizer", KernelBertTokenizer<int64_t>),
+      CustomCudaStagedStruct("BertTokenizer", KernelBertTokenizer<int32_t>)
+#endif
+  );
+  return op_loader.GetCustomOps();
+};
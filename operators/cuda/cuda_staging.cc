@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "cuda_staging.h"
+
+namespace ort_extensions {
+
+std::unique_ptr<Ort::Custom::OutputStaging> CudaOutputStaging::Create(const OrtApi& api, const OrtKernelInfo&) {
+  auto staging = std::make_unique<CudaOutputStaging>();
+  staging->api_ = &api;
+  return staging;
+}
+
+CudaOutputStaging::~CudaOutputStaging() {
+  for (auto& buffer : buffers_) {
+    if (buffer.copied != nullptr) {
+      cudaEventSynchronize(buffer.copied);
+      cudaEventDestroy(buffer.copied);
+    }
+    cudaFreeHost(buffer.data);
+  }
+}
+
+void* CudaOutputStaging::Acquire(size_t bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Buffer* best = nullptr;
+  for (auto& buffer : buffers_) {
+    if (!buffer.in_use && buffer.bytes >= bytes && (best == nullptr || buffer.bytes < best->bytes) &&
+        cudaEventQuery(buffer.copied) == cudaSuccess) {
+      best = &buffer;
+    }
+  }
+  if (best == nullptr) {
+    // the sizes are rounded up to a power of 2, so a buffer is reused by the batches of a little larger outputs
+    size_t size = 4096;
+    while (size < bytes) {
+      size *= 2;
+    }
+    Buffer buffer;
+    ORTX_CUDA_CALL(cudaHostAlloc(&buffer.data, size, cudaHostAllocDefault));
+    buffer.bytes = size;
+    if (cudaError_t error = cudaEventCreateWithFlags(&buffer.copied, cudaEventDisableTiming); error != cudaSuccess) {
+      cudaFreeHost(buffer.data);
+      ThrowOnCudaError(error, "cudaEventCreateWithFlags");
+    }
+    buffers_.push_back(buffer);
+    best = &buffers_.back();
+  }
+  best->in_use = true;
+  return best->data;
+}
+
+void CudaOutputStaging::Upload(OrtKernelContext* context, const std::vector<Ort::Custom::StagedOutput>& outputs) {
+  cudaStream_t stream = nullptr;
+  try {
+    stream = GetCudaStream(*api_, context);
+  } catch (...) {
+    Release(outputs);
+    throw;
+  }
+  cudaError_t error = cudaSuccess;
+  for (const auto& output : outputs) {
+    error = cudaMemcpyAsync(output.device, output.host, output.bytes, cudaMemcpyHostToDevice, stream);
+    if (error != cudaSuccess) {
+      break;
+    }
+  }
+  // the buffers are returned after the copies which have been issued, even if one of them failed
+  Return(outputs, stream);
+  ThrowOnCudaError(error, "cudaMemcpyAsync");
+}
+
+void CudaOutputStaging::Release(const std::vector<Ort::Custom::StagedOutput>& outputs) noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& output : outputs) {
+    for (auto& buffer : buffers_) {
+      if (buffer.data == output.host) {
+        buffer.in_use = false;
+      }
+    }
+  }
+}
+
+void CudaOutputStaging::Return(const std::vector<Ort::Custom::StagedOutput>& outputs, cudaStream_t stream) noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& output : outputs) {
+    for (auto& buffer : buffers_) {
+      if (buffer.data == output.host) {
+        cudaEventRecord(buffer.copied, stream);
+        buffer.in_use = false;
+      }
+    }
+  }
+}
+
+}  // namespace ort_extensions
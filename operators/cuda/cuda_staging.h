@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "cuda_utils.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ort_extensions {
+
+// The OutputStaging of a CPU kernel for the CUDA execution provider: the outputs are written into the buffers of
+// the pinned memory, and copied into the device outputs by async DMAs on the stream of the kernel, so the host
+// neither waits for the copies nor copies the outputs again into the staging buffers of a pageable copy. A buffer
+// is only reused once the event recorded after its copy has completed, and a new one is only allocated when no
+// free buffer is large enough, so the buffers of the usual batches are allocated by the first calls only.
+class CudaOutputStaging : public Ort::Custom::OutputStaging {
+ public:
+  CudaOutputStaging() = default;
+  ~CudaOutputStaging() override;
+
+  static std::unique_ptr<Ort::Custom::OutputStaging> Create(const OrtApi& api, const OrtKernelInfo& info);
+
+  void* Acquire(size_t bytes) override;
+  void Upload(OrtKernelContext* context, const std::vector<Ort::Custom::StagedOutput>& outputs) override;
+  void Release(const std::vector<Ort::Custom::StagedOutput>& outputs) noexcept override;
+
+ private:
+  struct Buffer {
+    void* data = nullptr;
+    size_t bytes = 0;
+    cudaEvent_t copied = nullptr;  // recorded after the last copy from the buffer
+    bool in_use = false;
+  };
+
+  void Return(const std::vector<Ort::Custom::StagedOutput>& outputs, cudaStream_t stream) noexcept;
+
+  const OrtApi* api_{};
+  std::mutex mutex_;
+  std::vector<Buffer> buffers_;
+};
+
+}  // namespace ort_extensions
+
+// A CPU kernel of the CUDA execution provider whose outputs are staged in the pinned memory.
+#define CustomCudaStagedStruct(name, s)                                                 \
+  []() {                                                                                \
+    return SelectedOpFactory<IsSelectedOp(name)>::StagedStruct<s>(                      \
+        name, "CUDAExecutionProvider", &ort_extensions::CudaOutputStaging::Create);     \
+  }
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "string_utils.h"
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ort_extensions {
+
+inline void ThrowOnCudaError(cudaError_t error, const char* call) {
+  if (error != cudaSuccess) {
+    ORTX_CXX_API_THROW(MakeString("[CUDA] ", call, " failed: ", cudaGetErrorString(error)), ORT_RUNTIME_EXCEPTION);
+  }
+}
+
+#define ORTX_CUDA_CALL(call) ort_extensions::ThrowOnCudaError((call), #call)
+
+// The stream of the CUDA execution provider, on which all the copies and the kernels of a Compute are issued, so
+// they are ordered with the nodes before and after it with no synchronization of the host.
+inline cudaStream_t GetCudaStream(const OrtApi& api, OrtKernelContext* context) {
+  void* stream = nullptr;
+  OrtW::ThrowOnError(api, api.KernelContext_GetGPUComputeStream(context, &stream));
+  return static_cast<cudaStream_t>(stream);
+}
+
+// A device buffer of the stream ordered allocator, which is freed on the stream after the kernels which use it, or
+// of cudaMalloc if it outlives the stream, as the constants which a kernel keeps.
+template <typename T>
+class CudaBuffer {
+ public:
+  CudaBuffer() = default;
+  CudaBuffer(size_t size, cudaStream_t stream) : stream_(stream) {
+    if (size > 0) {
+      ORTX_CUDA_CALL(cudaMallocAsync(reinterpret_cast<void**>(&data_), size * sizeof(T), stream_));
+    }
+  }
+  explicit CudaBuffer(size_t size) : ordered_(false) {
+    if (size > 0) {
+      ORTX_CUDA_CALL(cudaMalloc(reinterpret_cast<void**>(&data_), size * sizeof(T)));
+    }
+  }
+  CudaBuffer(const CudaBuffer&) = delete;
+  CudaBuffer& operator=(const CudaBuffer&) = delete;
+  CudaBuffer(CudaBuffer&& other) noexcept { *this = std::move(other); }
+  CudaBuffer& operator=(CudaBuffer&& other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(stream_, other.stream_);
+    std::swap(ordered_, other.ordered_);
+    return *this;
+  }
+  ~CudaBuffer() {
+    if (data_ != nullptr) {
+      ordered_ ? cudaFreeAsync(data_, stream_) : cudaFree(data_);
+    }
+  }
+
+  T* Data() const { return data_; }
+
+  // Copies the host values to the start of the buffer. The values may be freed once it returns, as a copy from
+  // the pageable memory is staged before the call returns.
+  void Upload(const std::vector<T>& values, cudaStream_t stream) {
+    ORTX_CUDA_CALL(cudaMemcpyAsync(data_, values.data(), values.size() * sizeof(T), cudaMemcpyHostToDevice, stream));
+  }
+
+ private:
+  T* data_{};
+  cudaStream_t stream_{};
+  bool ordered_{true};
+};
+
+}  // namespace ort_extensions
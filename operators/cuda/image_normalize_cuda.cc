@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "image_normalize_cuda.hpp"
+
+#include "cuda_utils.h"
+#include "image_normalize_impl.h"
+
+namespace ort_extensions {
+
+namespace {
+
+// The starts and the sizes of a filter, and its weights of the same number of taps per output pixel, which are
+// uploaded into one buffer of ints and one of floats.
+struct PackedFilter {
+  PackedFilter(const ResizeFilter& filter, int64_t num_pixels) {
+    const size_t count = static_cast<size_t>(num_pixels);
+    for (size_t i = 0; i < count; ++i) {
+      taps = std::max(taps, filter.Size(i));
+    }
+    ints.resize(count * 2);
+    weights.assign(count * taps, 0.0f);
+    for (size_t i = 0; i < count; ++i) {
+      ints[i] = static_cast<int32_t>(filter.Start(i));
+      ints[count + i] = static_cast<int32_t>(filter.Size(i));
+      std::copy_n(filter.Weights(i), filter.Size(i), weights.begin() + i * taps);
+    }
+  }
+
+  CudaResizeFilter OnDevice(const int32_t* device_ints, const float* device_weights) const {
+    const size_t count = ints.size() / 2;
+    return {device_ints, device_ints + count, device_weights, static_cast<int32_t>(taps)};
+  }
+
+  size_t taps = 0;
+  std::vector<int32_t> ints;
+  std::vector<float> weights;
+};
+
+}  // namespace
+
+void KernelImageNormalizeCuda::Compute(OrtKernelContext* context, const ortc::Tensor<uint8_t>& input,
+                                       ortc::Tensor<float>& output,
+                                       std::optional<ortc::Tensor<float>*> transform) const {
+  const auto& dims = input.Shape();
+  const auto image = ImageSize(dims);
+  const auto resized = ResizedImageSize(image[1], image[2], options_);
+  const auto layout = TransformedImageLayout(resized, options_);
+  const auto& size = layout.size;
+  float* out = output.Allocate(OutputShape(dims, layout.canvas));
+  cudaStream_t stream = GetCudaStream(api_, context);
+  if (transform.has_value() && *transform != nullptr) {
+    // the parameters of every image on the host, whose pageable memory is copied before cudaMemcpyAsync returns
+    const auto parameters = ImageTransformParameters(image[1], image[2], resized, options_);
+    std::vector<float> values;
+    for (int64_t n = 0; n < image[0]; ++n) {
+      values.insert(values.end(), parameters.begin(), parameters.end());
+    }
+    std::vector<int64_t> shape{4};
+    if (dims.size() == 4) {
+      shape.insert(shape.begin(), dims[0]);
+    }
+    float* device_transform = (*transform)->Allocate(shape);
+    if (!values.empty()) {
+      ORTX_CUDA_CALL(cudaMemcpyAsync(device_transform, values.data(), values.size() * sizeof(float),
+                                     cudaMemcpyHostToDevice, stream));
+    }
+  }
+  if (image[0] == 0) {
+    return;
+  }
+
+  const auto row_filter = filters_.Get(image[1], resized[0], layout.crop_top, size[0], options_.filter);
+  const auto column_filter = filters_.Get(image[2], resized[1], layout.crop_left, size[1], options_.filter);
+  const PackedFilter rows(*row_filter, size[0]);
+  const PackedFilter columns(*column_filter, size[1]);
+
+  CudaImageNormalizeParams params{};
+  params.batch = image[0];
+  params.height = image[1];
+  params.width = image[2];
+  params.out_height = size[0];
+  params.out_width = size[1];
+  params.canvas_height = layout.canvas[0];
+  params.canvas_width = layout.canvas[1];
+  params.pad_top = layout.pad_top;
+  params.pad_left = layout.pad_left;
+  params.first_row = row_filter.Start(0);
+  params.num_rows = row_filter.End() - params.first_row;
+  for (size_t c = 0; c < 3; ++c) {
+    size_t out_c = options_.swap_rb ? 2 - c : c;
+    params.scale[c] = options_.rescale / options_.std[out_c];
+    params.bias[c] = -options_.mean[out_c] / options_.std[out_c];
+    params.plane[c] = static_cast<int32_t>(out_c * layout.canvas[0] * layout.canvas[1]);
+    params.pad[c] = options_.pad_value * params.scale[c] + params.bias[c];
+  }
+
+  // the filters of the rows and of the columns in one buffer of each type, so there are only two uploads
+  std::vector<int32_t> ints(rows.ints);
+  ints.insert(ints.end(), columns.ints.begin(), columns.ints.end());
+  std::vector<float> weights(rows.weights);
+  weights.insert(weights.end(), columns.weights.begin(), columns.weights.end());
+
+  CudaBuffer<int32_t> device_ints(ints.size(), stream);
+  CudaBuffer<float> device_weights(weights.size(), stream);
+  CudaBuffer<float> buffer(static_cast<size_t>(params.batch * params.num_rows * params.out_width * 3), stream);
+  device_ints.Upload(ints, stream);
+  device_weights.Upload(weights, stream);
+
+  LaunchImageNormalize(stream, params, input.Data(),
+                       rows.OnDevice(device_ints.Data(), device_weights.Data()),
+                       columns.OnDevice(device_ints.Data() + rows.ints.size(),
+                                        device_weights.Data() + rows.weights.size()),
+                       buffer.Data(), out);
+  ORTX_CUDA_CALL(cudaGetLastError());
+}
+
+}  // namespace ort_extensions
@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "vision/image_normalize.hpp"
+
+namespace ort_extensions {
+
+// ImageNormalize of the CUDA execution provider, whose pixels of uint8 are uploaded instead of the floats of a 4
+// times larger output. The filters of the resize are computed on the host as the ones of the CPU kernel and
+// uploaded with the input, and the pixels are filtered along the columns and then the rows on the device, so the
+// output matches the CPU kernel up to the rounding of the floats. The padding of a letterbox is written by the same
+// threads as the resized pixels.
+struct KernelImageNormalizeCuda : KernelImageNormalize {
+  KernelImageNormalizeCuda(const OrtApi& api, const OrtKernelInfo& info) : KernelImageNormalize(api, info) {
+    if (options_.tile_size > 0 || options_.patch_size > 0) {
+      ORTX_CXX_API_THROW("[ImageNormalize]: The CUDA kernel writes the planes of the output, without the tiles and "
+                         "the patches.",
+                         ORT_NOT_IMPLEMENTED);
+    }
+  }
+
+  void Compute(OrtKernelContext* context, const ortc::Tensor<uint8_t>& input, ortc::Tensor<float>& output,
+               std::optional<ortc::Tensor<float>*> transform) const;
+};
+
+}  // namespace ort_extensions
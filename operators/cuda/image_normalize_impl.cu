@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "image_normalize_impl.h"
+
+namespace ort_extensions {
+
+namespace {
+
+constexpr int kThreadsPerBlock = 256;
+
+inline unsigned int NumBlocks(int64_t count) {
+  return static_cast<unsigned int>((count + kThreadsPerBlock - 1) / kThreadsPerBlock);
+}
+
+// A thread of every pixel of the rows of [batch, num_rows, out_width], the columns of which are filtered.
+__global__ void ResizeColumnsKernel(CudaImageNormalizeParams params, const uint8_t* image, CudaResizeFilter columns,
+                                    float* buffer) {
+  const int64_t i = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (i >= params.batch * params.num_rows * params.out_width) {
+    return;
+  }
+  const int64_t x = i % params.out_width;
+  const int64_t row = i / params.out_width;  // of the batch and of the rows
+  const int64_t n = row / params.num_rows;
+  const int64_t y = params.first_row + row % params.num_rows;
+
+  const uint8_t* src = image + ((n * params.height + y) * params.width + columns.starts[x]) * 3;
+  const float* w = columns.weights + x * columns.taps;
+  float b = 0.0f;
+  float g = 0.0f;
+  float r = 0.0f;
+  for (int32_t k = 0; k < columns.sizes[x]; ++k) {
+    b += w[k] * static_cast<float>(src[k * 3]);
+    g += w[k] * static_cast<float>(src[k * 3 + 1]);
+    r += w[k] * static_cast<float>(src[k * 3 + 2]);
+  }
+  // the pixels of the pass of the columns are clamped too, the order of the resize of PIL
+  buffer[i * 3] = fminf(fmaxf(b, 0.0f), 255.0f);
+  buffer[i * 3 + 1] = fminf(fmaxf(g, 0.0f), 255.0f);
+  buffer[i * 3 + 2] = fminf(fmaxf(r, 0.0f), 255.0f);
+}
+
+// A thread of every pixel of [batch, canvas_height, canvas_width], whose rows are filtered from the buffer,
+// normalized and written into the planes of the channels, or which is the padding around the resized pixels.
+__global__ void ResizeRowsKernel(CudaImageNormalizeParams params, const float* buffer, CudaResizeFilter rows,
+                                 float* output) {
+  const int64_t i = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  const int64_t plane_size = params.canvas_height * params.canvas_width;
+  if (i >= params.batch * plane_size) {
+    return;
+  }
+  const int64_t canvas_x = i % params.canvas_width;
+  const int64_t canvas_y = (i / params.canvas_width) % params.canvas_height;
+  const int64_t n = i / plane_size;
+  float* dst = output + n * 3 * plane_size + canvas_y * params.canvas_width + canvas_x;
+  const int64_t x = canvas_x - params.pad_left;
+  const int64_t y = canvas_y - params.pad_top;
+  if (x < 0 || x >= params.out_width || y < 0 || y >= params.out_height) {
+    for (int c = 0; c < 3; ++c) {
+      dst[params.plane[c]] = params.pad[c];
+    }
+    return;
+  }
+
+  const int64_t stride = params.out_width * 3;
+  const float* src = buffer + ((n * params.num_rows + rows.starts[y] - params.first_row) * params.out_width + x) * 3;
+  const float* w = rows.weights + y * rows.taps;
+  float sum[3] = {0.0f, 0.0f, 0.0f};
+  for (int32_t k = 0; k < rows.sizes[y]; ++k) {
+    sum[0] += w[k] * src[k * stride];
+    sum[1] += w[k] * src[k * stride + 1];
+    sum[2] += w[k] * src[k * stride + 2];
+  }
+
+  // clamped into the pixels of [0, 255], which the negative lobes of the bicubic and the Lanczos filters overshoot
+  for (int c = 0; c < 3; ++c) {
+    dst[params.plane[c]] = fminf(fmaxf(sum[c], 0.0f), 255.0f) * params.scale[c] + params.bias[c];
+  }
+}
+
+}  // namespace
+
+void LaunchImageNormalize(cudaStream_t stream, const CudaImageNormalizeParams& params, const uint8_t* image,
+                          const CudaResizeFilter& rows, const CudaResizeFilter& columns, float* buffer,
+                          float* output) {
+  const int64_t num_buffered = params.batch * params.num_rows * params.out_width;
+  const int64_t num_output = params.batch * params.canvas_height * params.canvas_width;
+  if (num_output == 0) {
+    return;
+  }
+  ResizeColumnsKernel<<<NumBlocks(num_buffered), kThreadsPerBlock, 0, stream>>>(params, image, columns, buffer);
+  ResizeRowsKernel<<<NumBlocks(num_output), kThreadsPerBlock, 0, stream>>>(params, buffer, rows, output);
+}
+
+}  // namespace ort_extensions
@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+
+namespace ort_extensions {
+
+// The resize of ImageNormalize on the device, the ResizeFilter of the rows and of the columns of the crop, whose
+// output pixel i reads sizes[i] input pixels from starts[i] with the weights of weights[i * taps].
+struct CudaResizeFilter {
+  const int32_t* starts;
+  const int32_t* sizes;
+  const float* weights;
+  int32_t taps;
+};
+
+struct CudaImageNormalizeParams {
+  int64_t batch;
+  int64_t height;  // of the input
+  int64_t width;
+  int64_t out_height;  // of the resized pixels, at (pad_top, pad_left) of the canvas of the output
+  int64_t out_width;
+  int64_t canvas_height;
+  int64_t canvas_width;
+  int64_t pad_top;
+  int64_t pad_left;
+  int64_t first_row;  // the input rows [first_row, first_row + num_rows) which the output reads
+  int64_t num_rows;
+  float scale[3];  // x * scale + bias of every input channel into the output plane of the channel
+  float bias[3];
+  float pad[3];  // the normalized padding of the letterbox of every input channel
+  int32_t plane[3];
+};
+
+// Resizes the uint8 BGR pixels of [batch, height, width, 3] by the columns into the rows of the float buffer of
+// [batch, num_rows, out_width, 3], and those by the rows into the normalized output of [batch, 3, canvas_height,
+// canvas_width], whose pixels out of the resized ones are the padding.
+void LaunchImageNormalize(cudaStream_t stream, const CudaImageNormalizeParams& params, const uint8_t* image,
+                          const CudaResizeFilter& rows, const CudaResizeFilter& columns, float* buffer,
+                          float* output);
+
+}  // namespace ort_extensions
@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "log_mel_cuda.hpp"
+
+#include <cmath>
+
+namespace ort_extensions {
+
+namespace {
+// M_PI isn't defined by the headers of MSVC without _USE_MATH_DEFINES
+constexpr double kPi = 3.14159265358979323846;
+}  // namespace
+
+LogMelSpectrogramCuda::LogMelSpectrogramCuda(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  int64_t n_fft = TryToGetAttributeWithDefault<int64_t>("n_fft", 400);
+  int64_t hop_length = TryToGetAttributeWithDefault<int64_t>("hop_length", 160);
+  int64_t n_mel = TryToGetAttributeWithDefault<int64_t>("n_mel", 80);
+  int64_t sampling_rate = TryToGetAttributeWithDefault<int64_t>("sampling_rate", 16000);
+  if (n_fft <= 0 || hop_length <= 0 || n_mel <= 0 || sampling_rate <= 0) {
+    ORTX_CXX_API_THROW("[LogMelSpectrogram]: n_fft, hop_length, n_mel and sampling_rate should be positive.",
+                       ORT_INVALID_ARGUMENT);
+  }
+  params_.n_fft = static_cast<int32_t>(n_fft);
+  params_.hop_length = static_cast<int32_t>(hop_length);
+  params_.num_bins = static_cast<int32_t>(n_fft / 2 + 1);
+  params_.n_mel = static_cast<int32_t>(n_mel);
+  params_.normalize = TryToGetAttributeWithDefault<int64_t>("normalize", 1) != 0;
+  // the frame and its spectrum have to fit the 48 KB of the shared memory of a block
+  if (CudaLogMelSharedSize(params_) > 48 * 1024) {
+    ORTX_CXX_API_THROW(MakeString("[LogMelSpectrogram]: n_fft of ", n_fft, " is too large for the CUDA kernel."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  const size_t size = static_cast<size_t>(n_fft);
+  constants_ = PeriodicHannWindow(size);
+  constants_.resize(size * 3);
+  for (size_t i = 0; i < size; ++i) {
+    const double phase = 2.0 * kPi * static_cast<double>(i) / static_cast<double>(size);
+    constants_[size + i] = static_cast<float>(std::cos(phase));
+    constants_[size * 2 + i] = static_cast<float>(std::sin(phase));
+  }
+  const MelFilterBank mel(size, static_cast<size_t>(n_mel), static_cast<double>(sampling_rate));
+  const std::vector<float> weights = mel.DenseWeights();
+  constants_.insert(constants_.end(), weights.begin(), weights.end());
+}
+
+const float* LogMelSpectrogramCuda::DeviceConstants(cudaStream_t stream) const {
+  int device = 0;
+  ORTX_CUDA_CALL(cudaGetDevice(&device));
+  std::lock_guard<std::mutex> lock(device_mutex_);
+  auto found = device_constants_.find(device);
+  if (found == device_constants_.end()) {
+    // each device keeps its copy, which the streams of the other devices may still be reading; the stream is
+    // synchronized once, as the other streams of the device read the constants too
+    CudaBuffer<float> constants(constants_.size());
+    constants.Upload(constants_, stream);
+    ORTX_CUDA_CALL(cudaStreamSynchronize(stream));
+    found = device_constants_.emplace(device, std::move(constants)).first;
+  }
+  return found->second.Data();
+}
+
+void LogMelSpectrogramCuda::Compute(OrtKernelContext* context, const ortc::Tensor<float>& input,
+                                    ortc::Tensor<float>& output) const {
+  auto& dims = input.Shape();
+  if (dims.size() != 1 && dims.size() != 2) {
+    ORTX_CXX_API_THROW("[LogMelSpectrogram]: Expect input dimension [n] or [batch, n].", ORT_INVALID_ARGUMENT);
+  }
+  CudaLogMelParams params = params_;
+  params.batch = dims.size() == 1 ? 1 : dims[0];
+  params.num_samples = dims.back();
+  params.frames = params.num_samples / params.hop_length;
+  if (params.batch > 65535) {
+    ORTX_CXX_API_THROW("[LogMelSpectrogram]: The CUDA kernel supports a batch of up to 65535 signals.",
+                       ORT_INVALID_ARGUMENT);
+  }
+  float* out = output.Allocate({params.batch, params.n_mel, params.frames});
+  if (params.batch == 0 || params.frames == 0) {
+    return;
+  }
+
+  cudaStream_t stream = GetCudaStream(api_, context);
+  const float* constants = DeviceConstants(stream);
+  CudaBuffer<float> maxes(params.normalize ? static_cast<size_t>(params.batch) : 0, stream);
+  LaunchLogMelSpectrogram(stream, params, input.Data(), constants, out, maxes.Data());
+  ORTX_CUDA_CALL(cudaGetLastError());
+}
+
+}  // namespace ort_extensions
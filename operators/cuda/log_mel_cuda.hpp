@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "audio/log_mel.hpp"
+#include "cuda_utils.h"
+#include "log_mel_impl.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace ort_extensions {
+
+// LogMelSpectrogram of the CUDA execution provider, with the attributes and the output of the CPU kernel, so the
+// raw PCM is uploaded instead of the spectrogram. A block of threads computes a frame, whose DFT is summed
+// directly, as n_fft is rarely a power of 2 and a frame of 400 samples fits the shared memory. The window, the
+// phases and the mel filters are uploaded by the first Compute on a device, and kept for the next ones of the device.
+struct LogMelSpectrogramCuda : BaseKernel {
+  LogMelSpectrogramCuda(const OrtApi& api, const OrtKernelInfo& info);
+
+  void Compute(OrtKernelContext* context, const ortc::Tensor<float>& input, ortc::Tensor<float>& output) const;
+
+ private:
+  const float* DeviceConstants(cudaStream_t stream) const;
+
+  CudaLogMelParams params_{};
+  std::vector<float> constants_;  // of CudaLogMelConstantsSize()
+  mutable std::mutex device_mutex_;
+  mutable std::unordered_map<int, CudaBuffer<float>> device_constants_;  // by the device id
+};
+
+}  // namespace ort_extensions
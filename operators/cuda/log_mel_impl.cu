@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "log_mel_impl.h"
+
+#include <cfloat>
+
+namespace ort_extensions {
+
+namespace {
+
+constexpr int kThreadsPerBlock = 256;
+
+// The index of the sample which is reflected at the ends of the signal, the same as LogMelSpectrogram::Reflect.
+__device__ int64_t Reflect(int64_t i, int64_t n) {
+  if (n == 1) {
+    return 0;
+  }
+  const int64_t period = 2 * (n - 1);
+  i %= period;
+  if (i < 0) {
+    i += period;
+  }
+  return i < n ? i : period - i;
+}
+
+// A block of every frame of [frames, batch]: the windowed frame is read into the shared memory, each thread sums
+// the DFT of some bins into their power, and then the mel filters of some bands into their log10. The phase of
+// the sample i of the bin k is k * i mod n_fft, so the cos and the sin are read from the table of n_fft phases.
+__global__ void LogMelKernel(CudaLogMelParams params, const float* pcm, const float* constants, float* output) {
+  extern __shared__ float shared[];
+  float* frame = shared;
+  float* power = shared + params.n_fft;
+
+  const int64_t t = blockIdx.x;
+  const int64_t b = blockIdx.y;
+  const float* x = pcm + b * params.num_samples;
+  const float* window = constants;
+  const float* cos_table = constants + params.n_fft;
+  const float* sin_table = cos_table + params.n_fft;
+  const float* mel_weights = sin_table + params.n_fft;
+
+  const int64_t start = t * params.hop_length - params.n_fft / 2;
+  for (int32_t i = threadIdx.x; i < params.n_fft; i += blockDim.x) {
+    frame[i] = x[Reflect(start + i, params.num_samples)] * window[i];
+  }
+  __syncthreads();
+
+  for (int32_t k = threadIdx.x; k < params.num_bins; k += blockDim.x) {
+    float re = 0.0f;
+    float im = 0.0f;
+    int32_t phase = 0;
+    for (int32_t i = 0; i < params.n_fft; ++i) {
+      re += frame[i] * cos_table[phase];
+      im -= frame[i] * sin_table[phase];
+      phase += k;
+      if (phase >= params.n_fft) {
+        phase -= params.n_fft;
+      }
+    }
+    power[k] = re * re + im * im;
+  }
+  __syncthreads();
+
+  float* column = output + b * params.n_mel * params.frames + t;
+  for (int32_t m = threadIdx.x; m < params.n_mel; m += blockDim.x) {
+    const float* w = mel_weights + static_cast<int64_t>(m) * params.num_bins;
+    float sum = 0.0f;
+    for (int32_t k = 0; k < params.num_bins; ++k) {
+      sum += power[k] * w[k];
+    }
+    column[m * params.frames] = log10f(fmaxf(sum, 1e-10f));
+  }
+}
+
+// A block of every signal, which reduces the maximum of its spectrogram.
+__global__ void MaxKernel(const float* spectrogram, int64_t size, float* maxes) {
+  __shared__ float partial[kThreadsPerBlock];
+  const float* spec = spectrogram + blockIdx.x * size;
+  float value = -FLT_MAX;
+  for (int64_t i = threadIdx.x; i < size; i += blockDim.x) {
+    value = fmaxf(value, spec[i]);
+  }
+  partial[threadIdx.x] = value;
+  __syncthreads();
+  for (unsigned int half = blockDim.x / 2; half > 0; half /= 2) {
+    if (threadIdx.x < half) {
+      partial[threadIdx.x] = fmaxf(partial[threadIdx.x], partial[threadIdx.x + half]);
+    }
+    __syncthreads();
+  }
+  if (threadIdx.x == 0) {
+    maxes[blockIdx.x] = partial[0];
+  }
+}
+
+// Clamps every value to 8 below the maximum of its signal and scales it by (x + 4) / 4.
+__global__ void NormalizeKernel(float* spectrogram, int64_t size, int64_t count, const float* maxes) {
+  const int64_t i = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (i >= count) {
+    return;
+  }
+  const float floor = maxes[i / size] - 8.0f;
+  spectrogram[i] = (fmaxf(spectrogram[i], floor) + 4.0f) / 4.0f;
+}
+
+}  // namespace
+
+void LaunchLogMelSpectrogram(cudaStream_t stream, const CudaLogMelParams& params, const float* pcm,
+                             const float* constants, float* output, float* maxes) {
+  if (params.batch == 0 || params.frames == 0) {
+    return;
+  }
+  const dim3 grid(static_cast<unsigned int>(params.frames), static_cast<unsigned int>(params.batch));
+  LogMelKernel<<<grid, kThreadsPerBlock, CudaLogMelSharedSize(params), stream>>>(params, pcm, constants, output);
+
+  if (params.normalize) {
+    const int64_t size = params.n_mel * params.frames;
+    const int64_t count = params.batch * size;
+    MaxKernel<<<static_cast<unsigned int>(params.batch), kThreadsPerBlock, 0, stream>>>(output, size, maxes);
+    const auto blocks = static_cast<unsigned int>((count + kThreadsPerBlock - 1) / kThreadsPerBlock);
+    NormalizeKernel<<<blocks, kThreadsPerBlock, 0, stream>>>(output, size, count, maxes);
+  }
+}
+
+}  // namespace ort_extensions
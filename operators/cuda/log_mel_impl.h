@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+
+namespace ort_extensions {
+
+struct CudaLogMelParams {
+  int64_t batch;
+  int64_t num_samples;
+  int64_t frames;
+  int32_t n_fft;
+  int32_t hop_length;
+  int32_t num_bins;  // n_fft / 2 + 1
+  int32_t n_mel;
+  bool normalize;
+};
+
+// The floats which a LogMelSpectrogram kernel keeps on the device: the window, the cos and the sin of the n_fft
+// phases of the DFT, and the dense mel filters of [n_mel, num_bins].
+inline size_t CudaLogMelConstantsSize(const CudaLogMelParams& params) {
+  return static_cast<size_t>(params.n_fft) * 3 + static_cast<size_t>(params.n_mel) * params.num_bins;
+}
+
+// The bytes of the shared memory of a block of a frame, the windowed frame and its power spectrum.
+inline size_t CudaLogMelSharedSize(const CudaLogMelParams& params) {
+  return (static_cast<size_t>(params.n_fft) + params.num_bins) * sizeof(float);
+}
+
+// The log mel spectrogram of the PCM of [batch, num_samples] into [batch, n_mel, frames], the spectrum of every
+// frame of which is the DFT of a block. With normalize, maxes is a buffer of the batch for the maximum of every
+// signal.
+void LaunchLogMelSpectrogram(cudaStream_t stream, const CudaLogMelParams& params, const float* pcm,
+                             const float* constants, float* output, float* maxes);
+
+}  // namespace ort_extensions
@@ -8,6 +8,8 @@
 #include <opencv2/imgcodecs.hpp>
 
 #include "ocos.h"
+#include "image_header.h"
+#include "narrow.h"
 #include "string_utils.h"
 
 #include <cstdint>
@@ -27,6 +29,27 @@ void image_decoder(const ortc::Tensor<uint8_t>& input,
   const std::vector<int32_t> encoded_image_sizes{1, static_cast<int32_t>(encoded_image_data_len)};
   const cv::Mat encoded_image(encoded_image_sizes, CV_8UC1,
                               const_cast<void*>(static_cast<const void*>(encoded_image_data)));
+
+  // The output of the size from the header is allocated first, and the image is decoded into it.
+  ort_extensions::ImageHeader header;
+  if (ort_extensions::ReadImageHeader(encoded_image_data, static_cast<size_t>(encoded_image_data_len), header)) {
+    uint8_t* const decoded_image_data = output.Allocate({header.height, header.width, 3});
+    cv::Mat decoded_image(ort_extensions::narrow<int>(header.height), ort_extensions::narrow<int>(header.width),
+                          CV_8UC3, decoded_image_data);
+    const cv::Mat result = cv::imdecode(encoded_image, cv::IMREAD_COLOR, &decoded_image);
+    if (result.data == nullptr) {
+      ORTX_CXX_API_THROW("[ImageDecoder]: Failed to decode the image.", ORT_INVALID_ARGUMENT);
+    }
+    if (result.data != decoded_image_data) {
+      // the decoder rotated the image out of place by its EXIF orientation
+      if (result.rows != header.height || result.cols != header.width || result.type() != CV_8UC3) {
+        ORTX_CXX_API_THROW("[ImageDecoder]: The image doesn't match its header.", ORT_INVALID_ARGUMENT);
+      }
+      result.copyTo(cv::Mat(result.rows, result.cols, CV_8UC3, decoded_image_data));
+    }
+    return;
+  }
+
   const cv::Mat decoded_image = cv::imdecode(encoded_image, cv::IMREAD_COLOR);
 
   // Setup output & copy to destination
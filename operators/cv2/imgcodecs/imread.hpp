@@ -7,7 +7,7 @@ struct KernelImageReader : BaseKernel {
   KernelImageReader(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
   }
 
-  void Compute(OrtKernelContext* context) {
+  void Compute(OrtKernelContext* context) const {
     const OrtValue* input_data = ort_.KernelContext_GetInput(context, 0);
     OrtTensorDimensions input_data_dimensions(ort_, input_data);
 
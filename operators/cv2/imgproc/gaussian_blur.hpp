@@ -1,40 +1,70 @@
 #include <opencv2/core.hpp>
 #include <opencv2/imgproc.hpp>
 
-void gaussian_blur(const ortc::Tensor<float>& input_data,
-                   const ortc::Span<int64_t>& input_ksize,
-                   const ortc::Span<double>& input_sigma,
-                   ortc::Tensor<float>& output) {
-  const float* p_input_data = input_data.Data();
-  std::int64_t ksize[] = {3, 3};
-  double sigma[] = {0., 0.};
-
-  if (input_ksize.size() != 2) {
-    ORTX_CXX_API_THROW("[GaussianBlur]: ksize shape is (2,)", ORT_INVALID_ARGUMENT);
+#include "parallel_for.h"
+#include "string_utils.h"
+
+// Blurs every image of the NHWC input of 1 to 4 channels, float or uint8, into its slice of the output. The
+// images are blurred in parallel, as the OpenCV of the extensions is built without its own threads.
+template <typename T>
+struct KernelGaussianBlur : BaseKernel {
+  KernelGaussianBlur(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+    num_threads_ = ReadNumThreadsAttribute(*this);
   }
-  std::copy_n(input_ksize.data(), 2, ksize);
 
-  if (input_sigma.size() != 2) {
-    ORTX_CXX_API_THROW("[GaussianBlur]: sigma shape is (2,)", ORT_INVALID_ARGUMENT);
+  void Compute(const ortc::Tensor<T>& input_data,
+               const ortc::Span<int64_t>& input_ksize,
+               const ortc::Span<double>& input_sigma,
+               ortc::Tensor<T>& output) const {
+    const T* p_input_data = input_data.Data();
+    std::int64_t ksize[] = {3, 3};
+    double sigma[] = {0., 0.};
+
+    if (input_ksize.size() != 2) {
+      ORTX_CXX_API_THROW("[GaussianBlur]: ksize shape is (2,)", ORT_INVALID_ARGUMENT);
+    }
+    std::copy_n(input_ksize.data(), 2, ksize);
+
+    if (input_sigma.size() != 2) {
+      ORTX_CXX_API_THROW("[GaussianBlur]: sigma shape is (2,)", ORT_INVALID_ARGUMENT);
+    }
+    std::copy_n(input_sigma.data(), 2, sigma);
+
+    auto& input_data_dimensions = input_data.Shape();
+    if (input_data_dimensions.size() != 4) {
+      ORTX_CXX_API_THROW("[GaussianBlur]: Expect the input of dimension [n, h, w, c].", ORT_INVALID_ARGUMENT);
+    }
+
+    const int64_t n = input_data_dimensions[0];
+    const int h = static_cast<int>(input_data_dimensions[1]);
+    const int w = static_cast<int>(input_data_dimensions[2]);
+    const int c = static_cast<int>(input_data_dimensions[3]);
+    if (c < 1 || c > 4) {
+      ORTX_CXX_API_THROW(MakeString("[GaussianBlur]: The images should have 1 to 4 channels, not ", c, "."),
+                         ORT_INVALID_ARGUMENT);
+    }
+
+    const int type = CV_MAKETYPE(cv::DataType<T>::depth, c);
+    const size_t image_size = static_cast<size_t>(h) * w * c;
+    T* p_output_data = output.Allocate(input_data_dimensions);
+    ParallelFor(static_cast<size_t>(n), num_threads_, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        const cv::Mat input_image(cv::Size(w, h), type, const_cast<T*>(p_input_data + i * image_size));
+        // the blur is written into the output, as the Mat of its size and type isn't reallocated
+        cv::Mat output_image(cv::Size(w, h), type, p_output_data + i * image_size);
+        cv::GaussianBlur(input_image,
+                         output_image,
+                         cv::Size(static_cast<int>(ksize[1]), static_cast<int>(ksize[0])),
+                         sigma[0], sigma[1], cv::BORDER_DEFAULT);
+      }
+    });
+  }
+
+  // the blurred images have the type and the shape of the input
+  static void InferOutputShape(const ortc::ShapeInferContext& ctx) {
+    ctx.SetOutput(0, ctx.InputType(0), ctx.InputShape(0));
   }
-  std::copy_n(input_sigma.data(), 2, sigma);
-
-  auto& input_data_dimensions = input_data.Shape();
-
-  int n = static_cast<int>(input_data_dimensions[0]);
-  int h = static_cast<int>(input_data_dimensions[1]);
-  int w = static_cast<int>(input_data_dimensions[2]);
-  int c = static_cast<int>(input_data_dimensions[3]);
-  (void)n;
-  (void)c;
-
-  cv::Mat input_image(cv::Size(w, h), CV_32FC3, (void*)p_input_data);
-  cv::Mat output_image;
-  cv::GaussianBlur(input_image,
-                   output_image,
-                   cv::Size(static_cast<int>(ksize[1]), static_cast<int>(ksize[0])),
-                   sigma[0], sigma[1], cv::BORDER_DEFAULT);
-
-  float* p_output_image = output.Allocate(input_data_dimensions);
-  memcpy(p_output_image, output_image.data, output_image.total() * output_image.elemSize());
-}
+
+ private:
+  size_t num_threads_{1};
+};
@@ -6,7 +6,8 @@
 #endif  // ENABLE_OPENCV_CODECS
 
 const std::vector<const OrtCustomOp*>& Cv2Loader() {
-  static OrtOpLoader op_loader(CustomCpuFunc("GaussianBlur", gaussian_blur)
+  static OrtOpLoader op_loader(CustomCpuStruct("GaussianBlur", KernelGaussianBlur<float>),
+                               CustomCpuStruct("GaussianBlur", KernelGaussianBlur<uint8_t>)
 #ifdef ENABLE_OPENCV_CODECS
                                    ,
                                CustomCpuFunc("ImageDecoder", image_decoder),
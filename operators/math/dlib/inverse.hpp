@@ -3,20 +3,159 @@
 
 #pragma once
 
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
 #include "ocos.h"
-#include <dlib/matrix.h>
+#include "parallel_for.h"
+#include "string_utils.h"
+
+namespace inverse_detail {
+
+// Inverts the n x n row-major matrix a in place, by its LU decomposition with partial pivoting, as getrf and getri
+// of LAPACK do. N is the size if it's known at the compile time, which unrolls the loops of the small matrices,
+// or 0 otherwise. A singular matrix gives infinities or NaNs.
+template <size_t N, typename T>
+void InvertInPlace(T* a, size_t n) {
+  const size_t size = N == 0 ? n : N;
+  using Buffer = std::conditional_t<N == 0, std::vector<T>, std::array<T, N>>;
+  using Pivots = std::conditional_t<N == 0, std::vector<size_t>, std::array<size_t, N>>;
+  Buffer work{};
+  Pivots pivots{};
+  if constexpr (N == 0) {
+    work.resize(size);
+    pivots.resize(size);
+  }
+
+  auto at = [a, size](size_t i, size_t j) -> T& { return a[i * size + j]; };
+
+  // A = P L U, L with a unit diagonal below it, U on and above it
+  for (size_t k = 0; k < size; ++k) {
+    size_t pivot = k;
+    for (size_t i = k + 1; i < size; ++i) {
+      if (std::abs(at(i, k)) > std::abs(at(pivot, k))) {
+        pivot = i;
+      }
+    }
+
+    pivots[k] = pivot;
+    if (pivot != k) {
+      for (size_t j = 0; j < size; ++j) {
+        std::swap(at(k, j), at(pivot, j));
+      }
+    }
+
+    const T inv_pivot = T{1} / at(k, k);
+    for (size_t i = k + 1; i < size; ++i) {
+      const T l = at(i, k) *= inv_pivot;
+      for (size_t j = k + 1; j < size; ++j) {
+        at(i, j) -= l * at(k, j);
+      }
+    }
+  }
+
+  // U^-1, a column at a time from the inverse of the block before it
+  for (size_t j = 0; j < size; ++j) {
+    at(j, j) = T{1} / at(j, j);
+    const T scale = -at(j, j);
+    for (size_t i = 0; i < j; ++i) {
+      T sum = T{};
+      for (size_t k = i; k < j; ++k) {
+        sum += at(i, k) * at(k, j);
+      }
+      at(i, j) = sum * scale;
+    }
+  }
+
+  // A^-1 L = U^-1, solved a column at a time from the last
+  for (size_t j = size; j-- > 0;) {
+    for (size_t i = j + 1; i < size; ++i) {
+      work[i] = at(i, j);
+      at(i, j) = T{};
+    }
+
+    for (size_t r = 0; r < size; ++r) {
+      T sum = at(r, j);
+      for (size_t i = j + 1; i < size; ++i) {
+        sum -= at(r, i) * work[i];
+      }
+      at(r, j) = sum;
+    }
+  }
 
+  // A^-1 = U^-1 L^-1 P^T, which swaps its columns back
+  for (size_t j = size; j-- > 0;) {
+    if (pivots[j] != j) {
+      for (size_t i = 0; i < size; ++i) {
+        std::swap(at(i, j), at(i, pivots[j]));
+      }
+    }
+  }
+}
+
+// Inverts a small matrix in double, in which a float one loses little to the rounding of the elimination.
+template <size_t N>
+void InvertSmall(const float* in, float* out) {
+  std::array<double, N * N> a;
+  for (size_t i = 0; i < N * N; ++i) {
+    a[i] = in[i];
+  }
+
+  InvertInPlace<N>(a.data(), N);
+  for (size_t i = 0; i < N * N; ++i) {
+    out[i] = static_cast<float>(a[i]);
+  }
+}
+
+}  // namespace inverse_detail
+
+// Inverts the matrices of the last two axes of the input, [..., n, n], each of its batch on its own.
 void inverse(const ortc::Tensor<float>& input,
              ortc::Tensor<float>& output) {
   auto& dimensions = input.Shape();
-  if (dimensions.size() != 2) {
-    throw std::runtime_error("Only 2-d matrix supported.");
+  if (dimensions.size() < 2) {
+    ORTX_CXX_API_THROW("Inverse needs a matrix of at least 2 dimensions.", ORT_INVALID_ARGUMENT);
+  }
+
+  const int64_t n = dimensions.back();
+  if (dimensions[dimensions.size() - 2] != n) {
+    ORTX_CXX_API_THROW(MakeString("Inverse needs square matrices, but the shape is ", dimensions, "."),
+                       ORT_INVALID_ARGUMENT);
   }
+
   const float* X = input.Data();
   float* out = output.Allocate(dimensions);
+  const size_t matrix_size = static_cast<size_t>(n * n);
+  if (matrix_size == 0) {
+    return;
+  }
 
-  dlib::matrix<float> dm_x(dimensions[0], dimensions[1]);
-  std::copy(X, X + dm_x.size(), dm_x.begin());
-  dlib::matrix<float> dm = dlib::inv(dm_x);
-  memcpy(out, dm.steal_memory().get(), dm_x.size() * sizeof(float));
+  const size_t batch = static_cast<size_t>(input.NumberOfElement()) / matrix_size;
+  const size_t size = static_cast<size_t>(n);
+  ParallelFor(Ort::Custom::ComputeContext::Current(), batch, 2.0 * static_cast<double>(matrix_size * size),
+              [&](size_t begin, size_t end) {
+                for (size_t b = begin; b < end; ++b) {
+                  const float* x = X + b * matrix_size;
+                  float* y = out + b * matrix_size;
+                  switch (size) {
+                    case 1:
+                      y[0] = 1.0f / x[0];
+                      break;
+                    case 2:
+                      inverse_detail::InvertSmall<2>(x, y);
+                      break;
+                    case 3:
+                      inverse_detail::InvertSmall<3>(x, y);
+                      break;
+                    case 4:
+                      inverse_detail::InvertSmall<4>(x, y);
+                      break;
+                    default:
+                      std::copy(x, x + matrix_size, y);
+                      inverse_detail::InvertInPlace<0>(y, size);
+                  }
+                }
+              });
 }
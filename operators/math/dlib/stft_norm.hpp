@@ -4,13 +4,23 @@
 #pragma once
 
 #include "ocos.h"
-#include <dlib/matrix.h>
 
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "audio/fft.h"
+#include "parallel_for.h"
+
+// The STFT of the signals of [batch, n_samples], the same as torch.stft with center=True and pad_mode="reflect":
+// the frames of n_fft samples are centered every hop_length samples, and the window is centered in the frame.
+// The output is [batch, bins, frames, 2] of the complex bins, or [batch, bins, frames] of their squared norms.
 struct STFT : public BaseKernel {
   STFT(const OrtApi& api, const OrtKernelInfo& info,
        bool with_norm = false) : BaseKernel(api, info),
                                  with_norm_(with_norm) {
     onesided_ = TryToGetAttributeWithDefault<int64_t>("onesided", 1);
+    num_threads_ = ReadNumThreadsAttribute(*this);
   }
 
   void Compute(const ortc::Tensor<float>& input0,
@@ -20,54 +30,108 @@ struct STFT : public BaseKernel {
                int64_t frame_length,
                ortc::Tensor<float>& output0) const {
     auto X = input0.Data();
-    auto window = input3.data();
     auto dimensions = input0.Shape();
     auto win_length = input3.size();
 
-    if (dimensions.size() < 2 || input0.NumberOfElement() != dimensions[1]) {
-      ORTX_CXX_API_THROW("[Stft] Only batch == 1 tensor supported.", ORT_INVALID_ARGUMENT);
+    if (dimensions.size() != 2) {
+      ORTX_CXX_API_THROW("[Stft] Expect input dimension [batch, n_samples].", ORT_INVALID_ARGUMENT);
     }
     if (frame_length != n_fft) {
       ORTX_CXX_API_THROW("[Stft] Only support size of FFT equals the frame length.", ORT_INVALID_ARGUMENT);
     }
+    if (n_fft <= 0 || hop_length <= 0 || win_length == 0 || win_length > static_cast<size_t>(n_fft)) {
+      ORTX_CXX_API_THROW("[Stft] Expect positive n_fft and hop_length, and a window not longer than n_fft.",
+                         ORT_INVALID_ARGUMENT);
+    }
 
-    dlib::matrix<float> dm_x = dlib::mat(X, 1, dimensions[1]);
-    dlib::matrix<float> hann_win = dlib::mat(window, 1, win_length);
+    const size_t batch = static_cast<size_t>(dimensions[0]);
+    const size_t num_samples = static_cast<size_t>(dimensions[1]);
+    const size_t fft_size = static_cast<size_t>(n_fft);
+    const size_t hop = static_cast<size_t>(hop_length);
+    const size_t frames = num_samples / hop + 1;
+    const size_t bins = onesided_ ? fft_size / 2 + 1 : fft_size;
+    if (num_samples <= fft_size / 2) {
+      ORTX_CXX_API_THROW("[Stft] The signal is shorter than the reflection padding of the frames.",
+                         ORT_INVALID_ARGUMENT);
+    }
 
-    auto m_stft = dlib::stft(
-        dm_x, [&hann_win](size_t x, size_t len) { return hann_win(0, x); },
-        n_fft, win_length, hop_length);
+    auto fft = RealFft::Get(fft_size);
+    std::vector<float> window(fft_size, 0.0f);
+    std::copy(input3.data(), input3.data() + win_length, window.begin() + (fft_size - win_length) / 2);
 
-    if (onesided_) {
-      m_stft = dlib::subm(m_stft, 0, 0, m_stft.nr(), (m_stft.nc() >> 1) + 1);
+    const size_t channels = with_norm_ ? 1 : 2;
+    std::vector<int64_t> outdim{static_cast<int64_t>(batch), static_cast<int64_t>(bins),
+                                static_cast<int64_t>(frames)};
+    if (!with_norm_) {
+      outdim.push_back(2);
     }
+    float* out0 = output0.Allocate(outdim);
+
+    // A task is a block of frames, which are transposed together so that every bin is written in a run of
+    // kBlock frames rather than one value at a time.
+    constexpr size_t kBlock = 16;
+    const size_t blocks = (frames + kBlock - 1) / kBlock;
+    ParallelFor(batch * blocks, num_threads_, [&](size_t begin, size_t end) {
+      std::vector<float> frame(fft_size);
+      std::vector<RealFft::Complex> spectra(kBlock * (fft_size / 2 + 1));
+      std::vector<RealFft::Complex> work(fft->WorkSize());
+      std::vector<float> run(kBlock * channels);
+      for (size_t task = begin; task < end; ++task) {
+        const size_t b = task / blocks;
+        const size_t first = task % blocks * kBlock;
+        const size_t count = std::min(kBlock, frames - first);
+        const float* x = X + b * num_samples;
+
+        for (size_t j = 0; j < count; ++j) {
+          int64_t start = static_cast<int64_t>((first + j) * hop) - static_cast<int64_t>(fft_size / 2);
+          if (start >= 0 && start + static_cast<int64_t>(fft_size) <= static_cast<int64_t>(num_samples)) {
+            for (size_t i = 0; i < fft_size; ++i) {
+              frame[i] = x[start + i] * window[i];
+            }
+          } else {
+            for (size_t i = 0; i < fft_size; ++i) {
+              frame[i] = x[Reflect(start + static_cast<int64_t>(i), num_samples)] * window[i];
+            }
+          }
+          fft->Forward(frame.data(), spectra.data() + j * fft->NumBins(), work.data());
+        }
 
-    if (with_norm_) {
-      dlib::matrix<float> result = dlib::norm(m_stft);
-      result = dlib::trans(result);
-      std::vector<int64_t> outdim{1, result.nr(), result.nc()};
-      auto result_size = result.size();
-      auto out0 = output0.Allocate(outdim);
-      memcpy(out0, result.steal_memory().get(), result_size * sizeof(float));
-    } else {
-      auto result = m_stft;
-      // No transpose here since it is done on copying data,
-      // switch nr and nc, so the output dim willbe tranposed one.
-      std::vector<int64_t> outdim{1, result.nc(), result.nr(), 2};
-      auto out0 = output0.Allocate(outdim);
-      for (size_t c = 0; c < result.nc(); ++c) {
-        for (size_t r = 0; r < result.nr(); ++r) {
-          *out0 = result(r, c).real();
-          *(out0 + 1) = result(r, c).imag();
-          out0 += 2;
+        float* dst = out0 + (b * bins * frames + first) * channels;
+        for (size_t k = 0; k < bins; ++k) {
+          // the bins beyond the half of a real signal are the conjugates of the ones below it
+          const bool mirrored = k >= fft->NumBins();
+          const size_t source = mirrored ? fft_size - k : k;
+          for (size_t j = 0; j < count; ++j) {
+            RealFft::Complex value = spectra[j * fft->NumBins() + source];
+            if (with_norm_) {
+              run[j] = std::norm(value);
+            } else {
+              run[2 * j] = value.real();
+              run[2 * j + 1] = mirrored ? -value.imag() : value.imag();
+            }
+          }
+          std::memcpy(dst + k * frames * channels, run.data(), count * channels * sizeof(float));
         }
       }
-    }
+    });
   }
 
  private:
+  // The index of the sample which is reflected at the ends of the signal, which is longer than n_fft / 2.
+  static size_t Reflect(int64_t i, size_t n) {
+    const int64_t last = static_cast<int64_t>(n) - 1;
+    if (i < 0) {
+      i = -i;
+    }
+    if (i > last) {
+      i = 2 * last - i;
+    }
+    return static_cast<size_t>(i);
+  }
+
   int64_t onesided_{};
   bool with_norm_{};
+  size_t num_threads_{1};
 };
 
 struct StftNormal : public STFT {
@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "embedding_pooling.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "parallel_for.h"
+#include "string_utils.h"
+
+void PoolEmbeddings(const float* hidden_states, const int64_t* mask, size_t seq_len, size_t hidden_size,
+                    PoolingMode mode, bool normalize, float* out) {
+  if (mode == PoolingMode::kCls || seq_len == 0) {
+    if (seq_len == 0) {
+      std::fill_n(out, hidden_size, 0.0f);
+    } else {
+      std::copy_n(hidden_states, hidden_size, out);
+    }
+  } else {
+    // the first token of the mask initializes out, and every other one is accumulated into it
+    size_t count = 0;
+    for (size_t t = 0; t < seq_len; ++t) {
+      if (mask != nullptr && mask[t] == 0) {
+        continue;
+      }
+
+      const float* x = hidden_states + t * hidden_size;
+      if (count++ == 0) {
+        std::copy_n(x, hidden_size, out);
+      } else if (mode == PoolingMode::kMean) {
+        for (size_t d = 0; d < hidden_size; ++d) {
+          out[d] += x[d];
+        }
+      } else {
+        for (size_t d = 0; d < hidden_size; ++d) {
+          out[d] = x[d] > out[d] ? x[d] : out[d];
+        }
+      }
+    }
+
+    if (count == 0) {
+      std::fill_n(out, hidden_size, 0.0f);
+    } else if (mode == PoolingMode::kMean && count > 1) {
+      const float scale = 1.0f / static_cast<float>(count);
+      for (size_t d = 0; d < hidden_size; ++d) {
+        out[d] *= scale;
+      }
+    }
+  }
+
+  if (normalize) {
+    float sum = 0;
+    for (size_t d = 0; d < hidden_size; ++d) {
+      sum += out[d] * out[d];
+    }
+
+    // as torch.nn.functional.normalize, a zero vector stays zero
+    const float scale = 1.0f / std::max(std::sqrt(sum), 1e-12f);
+    for (size_t d = 0; d < hidden_size; ++d) {
+      out[d] *= scale;
+    }
+  }
+}
+
+KernelEmbeddingPooling::KernelEmbeddingPooling(const OrtApi& api, const OrtKernelInfo& info)
+    : BaseKernel(api, info) {
+  std::string mode = TryToGetAttributeWithDefault("mode", std::string("mean"));
+  if (mode == "mean") {
+    mode_ = PoolingMode::kMean;
+  } else if (mode == "max") {
+    mode_ = PoolingMode::kMax;
+  } else if (mode == "cls") {
+    mode_ = PoolingMode::kCls;
+  } else {
+    ORTX_CXX_API_THROW(MakeString("[EmbeddingPooling]: mode must be mean, max or cls but is ", mode, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  normalize_ = TryToGetAttributeWithDefault<int64_t>("normalize", 0) != 0;
+}
+
+void KernelEmbeddingPooling::Compute(const ortc::Tensor<float>& hidden_states,
+                                     std::optional<const ortc::Tensor<int64_t>*> attention_mask,
+                                     ortc::Tensor<float>& output) const {
+  auto& shape = hidden_states.Shape();
+  if (shape.size() != 3) {
+    ORTX_CXX_API_THROW(MakeString("[EmbeddingPooling]: hidden_states must be [batch, seq, hidden] but is ", shape,
+                                  "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  const size_t batch = static_cast<size_t>(shape[0]);
+  const size_t seq_len = static_cast<size_t>(shape[1]);
+  const size_t hidden_size = static_cast<size_t>(shape[2]);
+  const int64_t* mask = nullptr;
+  if (attention_mask.has_value() && *attention_mask != nullptr) {
+    auto& mask_shape = (*attention_mask)->Shape();
+    if (mask_shape.size() != 2 || mask_shape[0] != shape[0] || mask_shape[1] != shape[1]) {
+      ORTX_CXX_API_THROW(MakeString("[EmbeddingPooling]: attention_mask ", mask_shape,
+                                    " must be the [batch, seq] of hidden_states ", shape, "."),
+                         ORT_INVALID_ARGUMENT);
+    }
+    mask = (*attention_mask)->Data();
+  }
+
+  const float* p_hidden = hidden_states.Data();
+  float* p_out = output.Allocate({shape[0], shape[2]});
+  const double cost = mode_ == PoolingMode::kCls ? static_cast<double>(hidden_size)
+                                                 : static_cast<double>(seq_len * hidden_size);
+  ParallelFor(Ort::Custom::ComputeContext::Current(), batch, cost, [&](size_t begin, size_t end) {
+    for (size_t b = begin; b < end; ++b) {
+      PoolEmbeddings(p_hidden + b * seq_len * hidden_size, mask == nullptr ? nullptr : mask + b * seq_len, seq_len,
+                     hidden_size, mode_, normalize_, p_out + b * hidden_size);
+    }
+  });
+}
@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "ocos.h"
+
+enum class PoolingMode {
+  kMean,
+  kMax,
+  kCls,
+};
+
+// Pools the hidden states of a row, [seq, hidden], into out, [hidden], over the tokens of a nonzero mask, or all
+// of them if mask is null. The mean and the max of a row without any token are zeros, and CLS pooling takes the
+// first token whatever its mask. If normalize, out is divided by its L2 norm.
+void PoolEmbeddings(const float* hidden_states, const int64_t* mask, size_t seq_len, size_t hidden_size,
+                    PoolingMode mode, bool normalize, float* out);
+
+// Pools the hidden states of an encoder, [batch, seq, hidden], into the sentence embeddings, [batch, hidden], by
+// the mode attribute, "mean" by default, "max" or "cls", with the optional attention_mask, [batch, seq], of the
+// tokenizers. Each row is pooled in one pass over its hidden states, and the rows in parallel.
+struct KernelEmbeddingPooling : BaseKernel {
+  KernelEmbeddingPooling(const OrtApi& api, const OrtKernelInfo& info);
+
+  void Compute(const ortc::Tensor<float>& hidden_states,
+               std::optional<const ortc::Tensor<int64_t>*> attention_mask,
+               ortc::Tensor<float>& output) const;
+
+ private:
+  PoolingMode mode_;
+  bool normalize_;
+};
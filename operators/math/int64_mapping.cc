@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "int64_mapping.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+#include "asset_attribute.h"
+#include "parallel_for.h"
+#include "shared_registry.h"
+
+namespace {
+// the ids whose slots are prefetched ahead of the lookups, which covers the latency of a miss of the caches
+constexpr size_t kPrefetchDistance = 16;
+
+std::string_view BytesOf(const std::vector<int64_t>& values) {
+  return std::string_view(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(int64_t));
+}
+}  // namespace
+
+KernelInt64Mapping::KernelInt64Mapping(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  default_value_ = TryToGetAttributeWithDefault<int64_t>("default_value", -1);
+
+  std::vector<int64_t> keys;
+  std::vector<int64_t> values;
+  TryToGetAttribute("keys", keys);
+  TryToGetAttribute("values", values);
+  if (keys.size() != values.size()) {
+    ORTX_CXX_API_THROW(MakeString("[Int64Mapping]: keys and values must be of the same size, but are ", keys.size(),
+                                  " and ", values.size()),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  // the pairs of the map are the little-endian int64 of a key and then its value
+  const ort_extensions::AssetBytes map = ort_extensions::GetAssetAttribute(*this, "map", !keys.empty());
+  const std::string_view pairs = map.View();
+  if (pairs.size() % (2 * sizeof(int64_t)) != 0) {
+    ORTX_CXX_API_THROW(MakeString("[Int64Mapping]: the map must be the pairs of int64 of its keys and values, but ",
+                                  "it has ", pairs.size(), " bytes"),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  table_ = SharedRegistry<Int64HashTable>::Instance().GetOrLoad({BytesOf(keys), BytesOf(values), pairs}, [&]() {
+    auto table = std::make_shared<Int64HashTable>();
+    const size_t map_count = pairs.size() / (2 * sizeof(int64_t));
+    table->Build(map_count + keys.size(), [&](size_t i) {
+      if (i >= map_count) {
+        return std::make_pair(keys[i - map_count], values[i - map_count]);
+      }
+      int64_t pair[2];
+      std::memcpy(pair, pairs.data() + i * sizeof(pair), sizeof(pair));
+      return std::make_pair(pair[0], pair[1]);
+    });
+    return table;
+  });
+}
+
+void KernelInt64Mapping::Compute(const ortc::Tensor<int64_t>& input,
+                                 ortc::Tensor<int64_t>& output) const {
+  const int64_t* ids = input.Data();
+  const size_t count = static_cast<size_t>(input.NumberOfElement());
+  int64_t* out = output.Allocate(input.Shape());
+  const Int64HashTable& table = *table_;
+  ParallelFor(Ort::Custom::ComputeContext::Current(), count, 8.0, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < std::min(end, begin + kPrefetchDistance); ++i) {
+      table.Prefetch(ids[i]);
+    }
+    for (size_t i = begin; i < end; ++i) {
+      if (i + kPrefetchDistance < end) {
+        table.Prefetch(ids[i + kPrefetchDistance]);
+      }
+      out[i] = table.Find(ids[i], default_value_);
+    }
+  });
+}
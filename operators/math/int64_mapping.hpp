@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "ocos.h"
+
+// An open-addressing table of int64 keys and their int64 values with linear probing, which is at most 3/4 full, and
+// whose slots hold a key next to its value, so a lookup mostly reads one cache line. The home slot of a key is the
+// top bits of its Fibonacci hash, which spreads the ids in sequence over the table.
+class Int64HashTable {
+ public:
+  // Builds the table of the pairs of pair_of(i) for the i in [0, count), where the value of a key given more than
+  // once is its last one.
+  template <typename PairOf>
+  void Build(size_t count, PairOf&& pair_of) {
+    bits_ = 4;
+    while ((size_t{1} << bits_) * 3 < count * 4) {
+      ++bits_;
+    }
+    mask_ = (size_t{1} << bits_) - 1;
+    slots_.assign(mask_ + 1, Slot{kEmpty, 0});
+    size_ = 0;
+    has_empty_key_ = false;
+    for (size_t i = 0; i < count; ++i) {
+      const auto [key, value] = pair_of(i);
+      Insert(key, value);
+    }
+  }
+
+  size_t size() const { return size_; }
+
+  // The bytes of the table, which are mostly its slots.
+  size_t MemoryBytes() const { return sizeof(*this) + slots_.capacity() * sizeof(Slot); }
+
+  int64_t Find(int64_t key, int64_t default_value) const {
+    if (key == kEmpty) {
+      return has_empty_key_ ? empty_key_value_ : default_value;
+    }
+
+    for (size_t pos = Home(key);; pos = (pos + 1) & mask_) {
+      const Slot& slot = slots_[pos];
+      if (slot.key == key) {
+        return slot.value;
+      }
+      if (slot.key == kEmpty) {
+        return default_value;
+      }
+    }
+  }
+
+  // Asks the CPU to read the home slot of the key into the caches, ahead of its Find.
+  void Prefetch(int64_t key) const {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(&slots_[Home(key)]);
+#else
+    (void)key;
+#endif
+  }
+
+ private:
+  // the key of the empty slots, whose own value is kept outside the slots
+  static constexpr int64_t kEmpty = std::numeric_limits<int64_t>::min();
+
+  struct Slot {
+    int64_t key;
+    int64_t value;
+  };
+
+  size_t Home(int64_t key) const {
+    return static_cast<size_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ULL) >> (64 - bits_));
+  }
+
+  void Insert(int64_t key, int64_t value) {
+    if (key == kEmpty) {
+      size_ += has_empty_key_ ? 0 : 1;
+      has_empty_key_ = true;
+      empty_key_value_ = value;
+      return;
+    }
+
+    size_t pos = Home(key);
+    while (slots_[pos].key != kEmpty && slots_[pos].key != key) {
+      pos = (pos + 1) & mask_;
+    }
+    size_ += slots_[pos].key == kEmpty ? 1 : 0;
+    slots_[pos] = Slot{key, value};
+  }
+
+  std::vector<Slot> slots_;
+  size_t mask_{};
+  int bits_{};
+  size_t size_{};
+  bool has_empty_key_{};
+  int64_t empty_key_value_{};
+};
+
+// Remaps the int64 ids, like the ids of the items or the segments of the users, to the indices of their embeddings,
+// by a table built once from the keys and the values attributes, or from the map asset of the pairs of int64, which
+// can be a file mapped by map_path. The ids which aren't keys are mapped to default_value. The tables of the same
+// attributes are shared by the kernels of all the sessions, and the batches are looked up in parallel with the
+// slots of the ids ahead prefetched.
+struct KernelInt64Mapping : BaseKernel {
+  KernelInt64Mapping(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<int64_t>& input,
+               ortc::Tensor<int64_t>& output) const;
+
+ private:
+  std::shared_ptr<const Int64HashTable> table_;
+  int64_t default_value_{-1};
+};
@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "logits_processor.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "logits_sampler.hpp"
+#include "parallel_for.h"
+#include "string_utils.h"
+
+void ProcessLogits(const float* logits, size_t vocab_size, const int64_t* generated_ids, size_t generated_count,
+                   const LogitsProcessing& options, LogitsProcessingScratch& scratch, float* output) {
+  std::vector<int64_t>& ids = scratch.ids;
+  ids.clear();
+  for (size_t i = 0; i < generated_count; ++i) {
+    if (generated_ids[i] >= 0) {
+      ids.push_back(generated_ids[i]);
+    }
+  }
+
+  // the penalties of each distinct id are applied once, with its count, and read the logits before they're scaled
+  std::vector<std::pair<int64_t, float>>& penalized = scratch.penalized;
+  penalized.clear();
+  const bool penalties =
+      options.repetition_penalty != 1.0f || options.presence_penalty != 0.0f || options.frequency_penalty != 0.0f;
+  if (penalties && !ids.empty()) {
+    std::vector<int64_t>& sorted = scratch.sorted;
+    sorted.assign(ids.begin(), ids.end());
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = 0; i < sorted.size();) {
+      const int64_t id = sorted[i];
+      size_t count = 1;
+      while (i + count < sorted.size() && sorted[i + count] == id) {
+        ++count;
+      }
+      i += count;
+      if (static_cast<uint64_t>(id) >= vocab_size) {
+        continue;
+      }
+
+      float logit = PenalizeRepetition(logits[id], options.repetition_penalty);
+      logit -= options.presence_penalty + options.frequency_penalty * static_cast<float>(count);
+      penalized.emplace_back(id, logit);
+    }
+  }
+
+  // the only pass over the vocabulary, which the compiler vectorizes
+  const float inv_temperature = 1.0f / options.temperature;
+  if (options.temperature != 1.0f) {
+    for (size_t i = 0; i < vocab_size; ++i) {
+      output[i] = logits[i] * inv_temperature;
+    }
+  } else if (output != logits) {
+    std::memcpy(output, logits, vocab_size * sizeof(float));
+  }
+  for (const auto& [id, logit] : penalized) {
+    output[id] = logit * inv_temperature;
+  }
+
+  constexpr float kMasked = -std::numeric_limits<float>::infinity();
+  const auto mask = [&](int64_t id) {
+    if (id >= 0 && static_cast<uint64_t>(id) < vocab_size) {
+      output[id] = kMasked;
+    }
+  };
+  if (static_cast<int64_t>(ids.size()) < options.min_length) {
+    for (int64_t id : options.eos_token_ids) {
+      mask(id);
+    }
+  }
+  for (int64_t id : options.banned_ids) {
+    mask(id);
+  }
+  for (const auto& sequence : options.bad_word_sequences) {
+    // the last token of a bad word is masked if the ids end with the others
+    const size_t prefix = sequence.size() - 1;
+    if (prefix <= ids.size() && std::equal(sequence.begin(), sequence.end() - 1, ids.end() - prefix)) {
+      mask(sequence.back());
+    }
+  }
+}
+
+KernelLogitsProcessor::KernelLogitsProcessor(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  options_.temperature = TryToGetAttributeWithDefault<float>("temperature", 1.0f);
+  options_.repetition_penalty = TryToGetAttributeWithDefault<float>("repetition_penalty", 1.0f);
+  options_.presence_penalty = TryToGetAttributeWithDefault<float>("presence_penalty", 0.0f);
+  options_.frequency_penalty = TryToGetAttributeWithDefault<float>("frequency_penalty", 0.0f);
+  options_.min_length = TryToGetAttributeWithDefault<int64_t>("min_length", 0);
+  if (!(options_.temperature > 0.0f)) {
+    ORTX_CXX_API_THROW(MakeString("[LogitsProcessor]: temperature must be positive but is ", options_.temperature,
+                                  "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  if (!(options_.repetition_penalty > 0.0f)) {
+    ORTX_CXX_API_THROW(MakeString("[LogitsProcessor]: repetition_penalty must be positive but is ",
+                                  options_.repetition_penalty, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  TryToGetAttribute("eos_token_ids", options_.eos_token_ids);
+  if (options_.min_length > 0 && options_.eos_token_ids.empty()) {
+    ORTX_CXX_API_THROW("[LogitsProcessor]: min_length needs eos_token_ids.", ORT_INVALID_ARGUMENT);
+  }
+
+  // the bad words are separated by -1
+  std::vector<int64_t> bad_words_ids;
+  TryToGetAttribute("bad_words_ids", bad_words_ids);
+  std::vector<int64_t> word;
+  for (size_t i = 0; i <= bad_words_ids.size(); ++i) {
+    if (i < bad_words_ids.size() && bad_words_ids[i] >= 0) {
+      word.push_back(bad_words_ids[i]);
+      continue;
+    }
+    if (i < bad_words_ids.size() && bad_words_ids[i] != -1) {
+      ORTX_CXX_API_THROW(MakeString("[LogitsProcessor]: bad_words_ids must be the ids separated by -1, but has ",
+                                    bad_words_ids[i], "."),
+                         ORT_INVALID_ARGUMENT);
+    }
+    if (word.size() == 1) {
+      options_.banned_ids.push_back(word[0]);
+    } else if (!word.empty()) {
+      options_.bad_word_sequences.push_back(word);
+    }
+    word.clear();
+  }
+}
+
+void KernelLogitsProcessor::Compute(const ortc::Tensor<float>& logits,
+                                    std::optional<const ortc::Tensor<int64_t>*> generated_ids,
+                                    ortc::Tensor<float>& output) const {
+  auto& shape = logits.Shape();
+  if (shape.size() != 2) {
+    ORTX_CXX_API_THROW(MakeString("[LogitsProcessor]: logits must be [batch, vocab] but is ", shape, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  const size_t batch = static_cast<size_t>(shape[0]);
+  const size_t vocab_size = static_cast<size_t>(shape[1]);
+  const int64_t* ids = nullptr;
+  size_t ids_count = 0;
+  if (generated_ids.has_value() && *generated_ids != nullptr && (*generated_ids)->NumberOfElement() > 0) {
+    auto& ids_shape = (*generated_ids)->Shape();
+    if (ids_shape.size() != 2 || static_cast<size_t>(ids_shape[0]) != batch) {
+      ORTX_CXX_API_THROW(MakeString("[LogitsProcessor]: generated_ids must be [batch, n] of the batch of the "
+                                    "logits, but is ", ids_shape, "."),
+                         ORT_INVALID_ARGUMENT);
+    }
+    ids = (*generated_ids)->Data();
+    ids_count = static_cast<size_t>(ids_shape[1]);
+  }
+
+  const float* p_logits = logits.Data();
+  float* p_output = output.Allocate(shape);
+  ParallelFor(Ort::Custom::ComputeContext::Current(), batch, 2.0 * static_cast<double>(vocab_size),
+              [&](size_t begin, size_t end) {
+                LogitsProcessingScratch scratch;
+                for (size_t b = begin; b < end; ++b) {
+                  ProcessLogits(p_logits + b * vocab_size, vocab_size,
+                                ids == nullptr ? nullptr : ids + b * ids_count, ids_count, options_, scratch,
+                                p_output + b * vocab_size);
+                }
+              });
+}
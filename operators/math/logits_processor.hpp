@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "ocos.h"
+
+struct LogitsProcessing {
+  float temperature{1.0f};
+  float repetition_penalty{1.0f};  // the one of CTRL, of LogitsSampler
+  float presence_penalty{0.0f};    // subtracted from the logit of a token generated at all
+  float frequency_penalty{0.0f};   // subtracted from it as many times as it was generated
+  int64_t min_length{0};           // the eos tokens are masked until a row has generated as many ids
+  std::vector<int64_t> eos_token_ids;
+  std::vector<int64_t> banned_ids;                       // the bad words of a single token
+  std::vector<std::vector<int64_t>> bad_word_sequences;  // the others, whose last token is masked after the rest
+};
+
+// The ids of a row, which are kept for the next row of the same thread.
+struct LogitsProcessingScratch {
+  std::vector<int64_t> ids;  // the generated ids of the row without the padding
+  std::vector<int64_t> sorted;
+  std::vector<std::pair<int64_t, float>> penalized;  // the penalized logits, before the temperature
+};
+
+// Processes a row of logits into output, which may be the logits. It's one pass over the vocabulary, which only
+// divides the logits by the temperature, and the penalties and the masks are sparse updates of the ids they
+// change: the generated ids, sorted into the distinct ones with their counts, the eos tokens and the bad words.
+// The penalties apply to the logits before the temperature, as the processors of HF run in that order, and a
+// masked token is -inf.
+void ProcessLogits(const float* logits, size_t vocab_size, const int64_t* generated_ids, size_t generated_count,
+                   const LogitsProcessing& options, LogitsProcessingScratch& scratch, float* output);
+
+// Applies the processors of the generation to each row of the logits, [batch, vocab], into the logits of the same
+// shape for LogitsSampler or an argmax. The optional generated_ids, [batch, n], are the ids generated so far in
+// each row, in which a negative one is padding.
+struct KernelLogitsProcessor : BaseKernel {
+  KernelLogitsProcessor(const OrtApi& api, const OrtKernelInfo& info);
+
+  void Compute(const ortc::Tensor<float>& logits,
+               std::optional<const ortc::Tensor<int64_t>*> generated_ids,
+               ortc::Tensor<float>& output) const;
+
+ private:
+  LogitsProcessing options_;
+};
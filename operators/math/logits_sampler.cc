@@ -0,0 +1,186 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "logits_sampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "parallel_for.h"
+#include "string_utils.h"
+
+namespace {
+
+void ApplyRepetitionPenalty(float* logits, size_t vocab_size, const int64_t* seen_ids, size_t seen_count,
+                            float penalty, std::vector<uint64_t>& seen) {
+  seen.resize((vocab_size + 63) / 64);
+  for (size_t i = 0; i < seen_count; ++i) {
+    const int64_t id = seen_ids[i];
+    if (id < 0 || static_cast<uint64_t>(id) >= vocab_size) {
+      continue;
+    }
+
+    uint64_t& word = seen[static_cast<size_t>(id) / 64];
+    const uint64_t bit = uint64_t{1} << (id % 64);
+    if ((word & bit) == 0) {
+      word |= bit;
+      logits[id] = PenalizeRepetition(logits[id], penalty);
+    }
+  }
+
+  // only the words which were set are cleared for the next row
+  for (size_t i = 0; i < seen_count; ++i) {
+    const int64_t id = seen_ids[i];
+    if (id >= 0 && static_cast<uint64_t>(id) < vocab_size) {
+      seen[static_cast<size_t>(id) / 64] = 0;
+    }
+  }
+}
+
+}  // namespace
+
+int64_t SampleLogits(const float* logits, size_t vocab_size, const int64_t* seen_ids, size_t seen_count,
+                     const SamplingOptions& options, double u, SamplingScratch& scratch) {
+  std::vector<float>& x = scratch.logits;
+  x.assign(logits, logits + vocab_size);
+  if (options.repetition_penalty != 1.0f && seen_count > 0) {
+    ApplyRepetitionPenalty(x.data(), vocab_size, seen_ids, seen_count, options.repetition_penalty, scratch.seen);
+  }
+
+  if (options.temperature <= 0 || options.top_k == 1) {
+    return std::max_element(x.begin(), x.end()) - x.begin();
+  }
+
+  std::vector<uint32_t>& candidates = scratch.candidates;
+  candidates.resize(vocab_size);
+  std::iota(candidates.begin(), candidates.end(), 0U);
+  auto more_likely = [&x](uint32_t a, uint32_t b) { return x[a] > x[b]; };
+  size_t count = vocab_size;
+  if (options.top_k > 0 && static_cast<uint64_t>(options.top_k) < vocab_size) {
+    count = static_cast<size_t>(options.top_k);
+    std::nth_element(candidates.begin(), candidates.begin() + (count - 1), candidates.end(), more_likely);
+  }
+
+  // the logits of the candidates are replaced by their weights, exp((x - max) / temperature)
+  float max_logit = x[candidates[0]];
+  for (size_t i = 1; i < count; ++i) {
+    max_logit = std::max(max_logit, x[candidates[i]]);
+  }
+
+  const float inv_temperature = 1.0f / options.temperature;
+  double total = 0;
+  for (size_t i = 0; i < count; ++i) {
+    float& weight = x[candidates[i]];
+    weight = std::exp((weight - max_logit) * inv_temperature);
+    total += weight;
+  }
+
+  if (options.top_p < 1.0f) {
+    // the most likely are sorted in blocks which double, until they hold the mass
+    const double target = options.top_p * total;
+    double mass = 0;
+    size_t sorted = 0;
+    size_t block_end = std::min<size_t>(64, count);
+    while (sorted < count) {
+      if (block_end < count) {
+        std::nth_element(candidates.begin() + sorted, candidates.begin() + block_end, candidates.begin() + count,
+                         more_likely);
+      }
+      std::sort(candidates.begin() + sorted, candidates.begin() + block_end, more_likely);
+      for (; sorted < block_end; ++sorted) {
+        mass += x[candidates[sorted]];
+        if (mass >= target) {
+          break;
+        }
+      }
+
+      if (sorted < block_end) {
+        count = sorted + 1;
+        break;
+      }
+      block_end = std::min(block_end * 2, count);
+    }
+
+    total = mass;
+  }
+
+  double r = u * total;
+  for (size_t i = 0; i < count; ++i) {
+    r -= x[candidates[i]];
+    if (r < 0) {
+      return candidates[i];
+    }
+  }
+
+  return candidates[count - 1];
+}
+
+KernelLogitsSampler::KernelLogitsSampler(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  options_.temperature = TryToGetAttributeWithDefault<float>("temperature", 1.0f);
+  options_.top_k = TryToGetAttributeWithDefault<int64_t>("top_k", 0);
+  options_.top_p = TryToGetAttributeWithDefault<float>("top_p", 1.0f);
+  options_.repetition_penalty = TryToGetAttributeWithDefault<float>("repetition_penalty", 1.0f);
+  if (options_.top_k < 0) {
+    ORTX_CXX_API_THROW(MakeString("[LogitsSampler]: top_k must not be negative but is ", options_.top_k, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  if (!(options_.top_p > 0.0f && options_.top_p <= 1.0f)) {
+    ORTX_CXX_API_THROW(MakeString("[LogitsSampler]: top_p must be in (0, 1] but is ", options_.top_p, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  if (!(options_.repetition_penalty > 0.0f)) {
+    ORTX_CXX_API_THROW(MakeString("[LogitsSampler]: repetition_penalty must be positive but is ",
+                                  options_.repetition_penalty, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  const int64_t seed = TryToGetAttributeWithDefault<int64_t>("seed", -1);
+  rng_.seed(seed >= 0 ? static_cast<uint64_t>(seed) : std::random_device{}());
+}
+
+void KernelLogitsSampler::Compute(const ortc::Tensor<float>& logits,
+                                  std::optional<const ortc::Tensor<int64_t>*> previous_ids,
+                                  ortc::Tensor<int64_t>& output) const {
+  auto& shape = logits.Shape();
+  if (shape.size() != 2 || shape[1] == 0) {
+    ORTX_CXX_API_THROW(MakeString("[LogitsSampler]: logits must be [batch, vocab] but is ", shape, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  const size_t batch = static_cast<size_t>(shape[0]);
+  const size_t vocab_size = static_cast<size_t>(shape[1]);
+  const int64_t* seen_ids = nullptr;
+  size_t seen_count = 0;
+  if (previous_ids.has_value() && *previous_ids != nullptr && (*previous_ids)->NumberOfElement() > 0) {
+    auto& seen_shape = (*previous_ids)->Shape();
+    if (seen_shape.size() != 2 || static_cast<size_t>(seen_shape[0]) != batch) {
+      ORTX_CXX_API_THROW(MakeString("[LogitsSampler]: previous_ids must be [batch, n] of the batch of the logits, "
+                                    "but is ", seen_shape, "."),
+                         ORT_INVALID_ARGUMENT);
+    }
+    seen_ids = (*previous_ids)->Data();
+    seen_count = static_cast<size_t>(seen_shape[1]);
+  }
+
+  // the numbers of the batch are drawn together, so that a seed gives the same tokens on any threads
+  std::vector<double> uniforms(batch);
+  {
+    std::lock_guard<std::mutex> lock(rng_mutex_);
+    for (double& u : uniforms) {
+      u = static_cast<double>(rng_() >> 11) * 0x1.0p-53;
+    }
+  }
+
+  const float* p_logits = logits.Data();
+  int64_t* ids = output.Allocate({static_cast<int64_t>(batch), 1});
+  ParallelFor(Ort::Custom::ComputeContext::Current(), batch, 24.0 * static_cast<double>(vocab_size),
+              [&](size_t begin, size_t end) {
+                SamplingScratch scratch;
+                for (size_t b = begin; b < end; ++b) {
+                  ids[b] = SampleLogits(p_logits + b * vocab_size, vocab_size,
+                                        seen_ids == nullptr ? nullptr : seen_ids + b * seen_count, seen_count,
+                                        options_, uniforms[b], scratch);
+                }
+              });
+}
@@ -0,0 +1,54 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "ocos.h"
+
+struct SamplingOptions {
+  float temperature{1.0f};  // 0 or less picks the most likely token
+  int64_t top_k{0};         // 0 keeps all the tokens
+  float top_p{1.0f};        // the probability mass of the most likely tokens which are kept
+  float repetition_penalty{1.0f};
+};
+
+// The buffers of the sampling of a row, which are kept for the next row of the same thread.
+struct SamplingScratch {
+  std::vector<float> logits;
+  std::vector<uint32_t> candidates;
+  std::vector<uint64_t> seen;  // a bit per token of the vocabulary
+};
+
+// The logit of a repeated token by the penalty of the CTRL paper, which LogitsSampler and LogitsProcessor share:
+// divided by the penalty if it's positive, and multiplied by it otherwise.
+inline float PenalizeRepetition(float logit, float penalty) { return logit > 0 ? logit / penalty : logit * penalty; }
+
+// Samples a token from a row of logits by the options, with u a uniform number in [0, 1). A logit of a token of
+// seen_ids is divided by the repetition penalty if it's positive, and multiplied by it otherwise, as in the
+// CTRL paper. top_k selects the candidates with nth_element and the top-p mass is found by sorting the most likely
+// of them a few at a time, so neither sorts the vocabulary.
+int64_t SampleLogits(const float* logits, size_t vocab_size, const int64_t* seen_ids, size_t seen_count,
+                     const SamplingOptions& options, double u, SamplingScratch& scratch);
+
+// Samples a token id from each row of the logits, [batch, vocab], into [batch, 1], which is the input of the ids
+// of BpeStreamingDecoder. The optional previous_ids, [batch, n], are the ids penalized in each row, in which a
+// negative one is padding. The random numbers are drawn from a generator of the seed attribute, or a random one if
+// it's negative, which a kernel keeps across its calls.
+struct KernelLogitsSampler : BaseKernel {
+  KernelLogitsSampler(const OrtApi& api, const OrtKernelInfo& info);
+
+  void Compute(const ortc::Tensor<float>& logits,
+               std::optional<const ortc::Tensor<int64_t>*> previous_ids,
+               ortc::Tensor<int64_t>& output) const;
+
+ private:
+  SamplingOptions options_;
+  mutable std::mutex rng_mutex_;
+  mutable std::mt19937_64 rng_;
+};
@@ -6,16 +6,27 @@
 #endif
 #include "segment_extraction.hpp"
 #include "segment_sum.hpp"
+#include "logits_sampler.hpp"
+#include "logits_processor.hpp"
+#include "embedding_pooling.hpp"
+#include "int64_mapping.hpp"
 
 const std::vector<const OrtCustomOp*>& MathLoader() {
-  static OrtOpLoader op_loader(CustomCpuFunc("NegPos", neg_pos),
+  static OrtOpLoader op_loader(CustomCpuFuncWithTraits("NegPos", neg_pos, NegPosTraits),
 #ifdef ENABLE_DLIB
                                CustomCpuFunc("Inverse", inverse),
                                CustomCpuStruct("STFT", STFT),
                                CustomCpuStruct("StftNorm", StftNormal),
 #endif
                                CustomCpuFunc("SegmentExtraction", segment_extraction),
-                               CustomCpuFunc("SegmentSum", segment_sum));
+                               CustomCpuStruct("LogitsSampler", KernelLogitsSampler),
+                               CustomCpuStruct("LogitsProcessor", KernelLogitsProcessor),
+                               CustomCpuStruct("EmbeddingPooling", KernelEmbeddingPooling),
+                               CustomCpuStruct("Int64Mapping", KernelInt64Mapping),
+                               CustomCpuFunc("SegmentSum", segment_sum<float>),
+                               CustomCpuFunc("SegmentSum", segment_sum<double>),
+                               CustomCpuFunc("UnsortedSegmentSum", unsorted_segment_sum<float>),
+                               CustomCpuFunc("UnsortedSegmentSum", unsorted_segment_sum<double>));
   return op_loader.GetCustomOps();
 }
 
@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "ocos.h"
+#include "elementwise.h"
 
 void neg_pos(const ortc::Tensor<float>& input,
              ortc::Tensor<float>& out0_tensor,
@@ -12,14 +15,25 @@ void neg_pos(const ortc::Tensor<float>& input,
   float* out0 = out0_tensor.Allocate(input.Shape());
   float* out1 = out1_tensor.Allocate(input.Shape());
   const float* X = input.Data();
-  // Do computation
-  for (int64_t i = 0; i < size; i++) {
-    if (X[i] > 0) {
-      out0[i] = 0;
-      out1[i] = X[i];
-    } else {
-      out0[i] = X[i];
-      out1[i] = 0;
-    }
-  }
+  // min and max in this order of their operands keep a NaN and -0 in the negative part, as x > 0 does
+  ort_extensions::TransformElements(
+      static_cast<size_t>(size), 1.0,
+      [](float x, float& neg, float& pos) {
+        neg = std::min(x, 0.0f);
+        pos = std::max(0.0f, x);
+      },
+      X, out0, out1);
 }
+
+// The outputs of NegPos have the shape of the input, and the negative part may be written into the buffer of the
+// input, as each element is read before its parts are written.
+struct NegPosTraits {
+  static void InferOutputShape(const ortc::ShapeInferContext& ctx) {
+    ctx.SetOutput(0, ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, ctx.InputShape(0));
+    ctx.SetOutput(1, ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, ctx.InputShape(0));
+  }
+
+  static std::vector<std::pair<int, int>> MayInplace() {
+    return {{0, 0}};
+  }
+};
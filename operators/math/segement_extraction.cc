@@ -3,6 +3,21 @@
 
 #include "segment_extraction.hpp"
 
+#include <cstring>
+
+#include "parallel_for.h"
+
+namespace {
+// the elements of a chunk of the input, which is scanned by one thread
+constexpr size_t kChunk = 65536;
+
+// the segments which start in a chunk, their start and end positions and their values
+struct ChunkSegments {
+  std::vector<int64_t> positions;
+  std::vector<int64_t> values;
+};
+}  // namespace
+
 void segment_extraction(const ortc::Tensor<int64_t>& input,
                         ortc::Tensor<int64_t>& output0,
                         ortc::Tensor<int64_t>& output1) {
@@ -11,31 +26,53 @@ void segment_extraction(const ortc::Tensor<int64_t>& input,
     ORTX_CXX_API_THROW("[SegmentExtraction]: Expect input dimension [n] or [1,n].", ORT_INVALID_GRAPH);
   }
   const int64_t* p_data = input.Data();
-  std::vector<std::int64_t> segment_value;
-  std::vector<std::int64_t> segment_position;
-  for (std::int64_t i = 0; i < input.NumberOfElement(); i++) {
-    if (!p_data[i]) {
-      continue;
-    }
+  const size_t size = static_cast<size_t>(input.NumberOfElement());
+  const size_t num_chunks = (size + kChunk - 1) / kChunk;
 
-    // push start position and value
-    if (i == 0 || p_data[i - 1] != p_data[i]) {
-      segment_value.push_back(p_data[i]);
-      segment_position.push_back(i);
-    }
+  // the input is scanned a run of equal values at a time, and a run of a non-zero value is a segment. A chunk skips
+  // the run which continues from the chunk before it, and its last run may end after it.
+  std::vector<ChunkSegments> chunks(num_chunks);
+  ParallelFor(Ort::Custom::ComputeContext::Current(), num_chunks, 2.0 * kChunk, [&](size_t begin, size_t end) {
+    for (size_t c = begin; c < end; ++c) {
+      const size_t first = c * kChunk;
+      const size_t last = std::min(first + kChunk, size);
+      ChunkSegments& chunk = chunks[c];
+      size_t i = first;
+      if (first > 0) {
+        while (i < last && p_data[i] == p_data[first - 1]) {
+          ++i;
+        }
+      }
 
-    // push end position
-    if (i == (input.NumberOfElement() - 1) || p_data[i + 1] != p_data[i]) {
-      segment_position.push_back(i + 1);
-    }
-  }
+      while (i < last) {
+        const int64_t value = p_data[i];
+        size_t j = i + 1;
+        while (j < size && p_data[j] == value) {
+          ++j;
+        }
 
-  std::vector<int64_t> segment_value_dim({static_cast<int64_t>(segment_value.size())});
-  std::vector<int64_t> segment_position_dim({static_cast<int64_t>(segment_value.size()), 2});
+        if (value != 0) {
+          chunk.positions.push_back(static_cast<int64_t>(i));
+          chunk.positions.push_back(static_cast<int64_t>(j));
+          chunk.values.push_back(value);
+        }
+        i = j;
+      }
+    }
+  });
 
-  int64_t* out0_data = output0.Allocate(segment_position_dim);
-  std::copy(segment_position.begin(), segment_position.end(), out0_data);
+  std::vector<size_t> offsets(num_chunks + 1, 0);
+  for (size_t c = 0; c < num_chunks; ++c) {
+    offsets[c + 1] = offsets[c] + chunks[c].values.size();
+  }
 
-  int64_t* out1_data = output1.Allocate(segment_value_dim);
-  std::copy(segment_value.begin(), segment_value.end(), out1_data);
+  const int64_t segment_count = static_cast<int64_t>(offsets[num_chunks]);
+  int64_t* out0_data = output0.Allocate({segment_count, 2});
+  int64_t* out1_data = output1.Allocate({segment_count});
+  for (size_t c = 0; c < num_chunks; ++c) {
+    if (!chunks[c].values.empty()) {
+      std::memcpy(out0_data + 2 * offsets[c], chunks[c].positions.data(), chunks[c].positions.size() * sizeof(int64_t));
+      std::memcpy(out1_data + offsets[c], chunks[c].values.data(), chunks[c].values.size() * sizeof(int64_t));
+    }
+  }
 }
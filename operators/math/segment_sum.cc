@@ -3,11 +3,13 @@
 
 #include "segment_sum.hpp"
 
-void segment_sum(const ortc::Tensor<float>& data,
-                 const ortc::Tensor<int64_t>& segment_ids,
-                 ortc::Tensor<float>& output) {
-  auto& dim_data = data.Shape();
-  auto& dim_seg = segment_ids.Shape();
+#include <cstring>
+
+#include "parallel_for.h"
+
+namespace {
+
+void CheckSegmentShapes(const std::vector<int64_t>& dim_data, const std::vector<int64_t>& dim_seg) {
   if (dim_data.size() == 0 || dim_seg.size() == 0)
     ORTX_CXX_API_THROW("Both inputs cannot be empty.", ORT_INVALID_GRAPH);
   if (dim_seg.size() != 1)
@@ -17,35 +19,152 @@ void segment_sum(const ortc::Tensor<float>& data,
                            "First dimensions of data and segment_ids should be the same, data shape: ", dim_data,
                            " segment_ids shape: ", dim_seg),
                        ORT_INVALID_GRAPH);
+}
 
-  const int64_t* p_segment_ids = segment_ids.Data();
-  const float* p_data = data.Data();
+// the number of the elements of a row of data
+size_t RowSize(const std::vector<int64_t>& dim_data) {
+  size_t stride = 1;
+  for (size_t i = 1; i < dim_data.size(); ++i) {
+    stride *= static_cast<size_t>(dim_data[i]);
+  }
+  return stride;
+}
 
-  int64_t last_seg = p_segment_ids[dim_seg[0] - 1];
+// Sums the rows of data into each segment of the output, whose rows are rows[starts[s]:starts[s + 1]], or the
+// rows of data in the range if rows is null. The segments are split across the threads, so that each of them
+// writes its own rows of the output.
+template <typename T>
+void SumSegments(const T* p_data, const int64_t* rows, const std::vector<size_t>& starts, size_t stride,
+                 T* p_output) {
+  const size_t num_segments = starts.size() - 1;
+  const double rows_per_segment = static_cast<double>(starts.back()) / std::max<size_t>(num_segments, 1);
+  ParallelFor(Ort::Custom::ComputeContext::Current(), num_segments,
+              (rows_per_segment + 1.0) * static_cast<double>(stride),
+              [&](size_t begin, size_t end) {
+                for (size_t s = begin; s < end; ++s) {
+                  T* out = p_output + s * stride;
+                  if (starts[s] == starts[s + 1]) {
+                    std::fill(out, out + stride, T{});
+                    continue;
+                  }
+
+                  auto row = [&](size_t i) {
+                    return p_data + (rows == nullptr ? i : static_cast<size_t>(rows[i])) * stride;
+                  };
+                  std::memcpy(out, row(starts[s]), stride * sizeof(T));
+                  for (size_t i = starts[s] + 1; i < starts[s + 1]; ++i) {
+                    const T* in = row(i);
+                    for (size_t j = 0; j < stride; ++j) {
+                      out[j] += in[j];
+                    }
+                  }
+                }
+              });
+}
+
+}  // namespace
+
+template <typename T>
+void segment_sum(const ortc::Tensor<T>& data,
+                 const ortc::Tensor<int64_t>& segment_ids,
+                 ortc::Tensor<T>& output) {
+  auto& dim_data = data.Shape();
+  auto& dim_seg = segment_ids.Shape();
+  CheckSegmentShapes(dim_data, dim_seg);
+
+  const size_t num_rows = static_cast<size_t>(dim_seg[0]);
   std::vector<int64_t> dim_out = dim_data;
-  dim_out[0] = last_seg + 1;
-
-  float* p_output = output.Allocate(dim_out);
-  int64_t out_size = output.NumberOfElement();
-  memset(p_output, 0, static_cast<size_t>(out_size * sizeof(float)));
-
-  // The implementation is naive. It could be parallelized and
-  // use SIMD instructions to be faster.
-  int64_t in_stride = data.NumberOfElement();
-  const float* begin = p_data;
-  const float* end = p_data + in_stride;
-  in_stride /= dim_data[0];
-  float *p_out, *p_out_end;
-  const int64_t* p_seg = p_segment_ids;
-  for (; begin != end; ++p_seg) {
-    if ((p_seg != p_segment_ids) && (*p_seg != *(p_seg - 1)) && (*p_seg != *(p_seg - 1) + 1))
-      ORTX_CXX_API_THROW(MakeString("segment_ids must be increasing but found ",
-                                    *(p_seg - 1), " and ", *p_seg, " at position ",
-                                    std::distance(p_segment_ids, p_seg), "."),
+  if (num_rows == 0) {
+    output.Allocate(dim_out);
+    return;
+  }
+
+  const int64_t* p_segment_ids = segment_ids.Data();
+  // a segment is either the one of the previous row or the next one, checked without a branch in one pass
+  uint64_t bad_steps = 0;
+  for (size_t i = 1; i < num_rows; ++i) {
+    bad_steps |= static_cast<uint64_t>(static_cast<uint64_t>(p_segment_ids[i] - p_segment_ids[i - 1]) > 1);
+  }
+
+  if (p_segment_ids[0] < 0)
+    ORTX_CXX_API_THROW(MakeString("segment_ids must not be negative but starts with ", p_segment_ids[0], "."),
+                       ORT_RUNTIME_EXCEPTION);
+  if (bad_steps != 0) {
+    for (size_t i = 1; i < num_rows; ++i) {
+      if (static_cast<uint64_t>(p_segment_ids[i] - p_segment_ids[i - 1]) > 1)
+        ORTX_CXX_API_THROW(MakeString("segment_ids must be increasing but found ",
+                                      p_segment_ids[i - 1], " and ", p_segment_ids[i], " at position ", i, "."),
+                           ORT_RUNTIME_EXCEPTION);
+    }
+  }
+
+  // the rows of a segment follow those of the previous one, and the segments before the first id are empty
+  const size_t num_segments = static_cast<size_t>(p_segment_ids[num_rows - 1]) + 1;
+  std::vector<size_t> starts(num_segments + 1, 0);
+  for (size_t i = 1; i < num_rows; ++i) {
+    if (p_segment_ids[i] != p_segment_ids[i - 1]) {
+      starts[static_cast<size_t>(p_segment_ids[i])] = i;
+    }
+  }
+  starts[num_segments] = num_rows;
+
+  dim_out[0] = static_cast<int64_t>(num_segments);
+  T* p_output = output.Allocate(dim_out);
+  SumSegments(data.Data(), nullptr, starts, RowSize(dim_data), p_output);
+}
+
+template <typename T>
+void unsorted_segment_sum(const ortc::Tensor<T>& data,
+                          const ortc::Tensor<int64_t>& segment_ids,
+                          const ortc::Tensor<int64_t>& num_segments_tensor,
+                          ortc::Tensor<T>& output) {
+  auto& dim_data = data.Shape();
+  auto& dim_seg = segment_ids.Shape();
+  CheckSegmentShapes(dim_data, dim_seg);
+  if (num_segments_tensor.NumberOfElement() != 1)
+    ORTX_CXX_API_THROW("num_segments must be a scalar.", ORT_INVALID_ARGUMENT);
+  const int64_t num_segments = num_segments_tensor.Data()[0];
+  if (num_segments < 0)
+    ORTX_CXX_API_THROW(MakeString("num_segments must not be negative but is ", num_segments, "."),
+                       ORT_INVALID_ARGUMENT);
+
+  const size_t num_rows = static_cast<size_t>(dim_seg[0]);
+  const int64_t* p_segment_ids = segment_ids.Data();
+  // the rows are sorted by their segment in a counting sort, which keeps their order in a segment
+  std::vector<size_t> starts(static_cast<size_t>(num_segments) + 1, 0);
+  for (size_t i = 0; i < num_rows; ++i) {
+    if (p_segment_ids[i] >= num_segments)
+      ORTX_CXX_API_THROW(MakeString("segment_ids[", i, "] = ", p_segment_ids[i], " is not less than num_segments ",
+                                    num_segments, "."),
                          ORT_RUNTIME_EXCEPTION);
-    p_out = p_output + *p_seg * in_stride;
-    p_out_end = p_out + in_stride;
-    for (; p_out != p_out_end; ++p_out, ++begin)
-      *p_out += *begin;
+    if (p_segment_ids[i] >= 0) {
+      ++starts[static_cast<size_t>(p_segment_ids[i]) + 1];
+    }
+  }
+
+  for (size_t s = 1; s < starts.size(); ++s) {
+    starts[s] += starts[s - 1];
   }
+
+  std::vector<int64_t> rows(starts.back());
+  {
+    std::vector<size_t> next(starts.begin(), starts.end() - 1);
+    for (size_t i = 0; i < num_rows; ++i) {
+      if (p_segment_ids[i] >= 0) {
+        rows[next[static_cast<size_t>(p_segment_ids[i])]++] = static_cast<int64_t>(i);
+      }
+    }
+  }
+
+  std::vector<int64_t> dim_out = dim_data;
+  dim_out[0] = num_segments;
+  T* p_output = output.Allocate(dim_out);
+  SumSegments(data.Data(), rows.data(), starts, RowSize(dim_data), p_output);
 }
+
+template void segment_sum<float>(const ortc::Tensor<float>&, const ortc::Tensor<int64_t>&, ortc::Tensor<float>&);
+template void segment_sum<double>(const ortc::Tensor<double>&, const ortc::Tensor<int64_t>&, ortc::Tensor<double>&);
+template void unsorted_segment_sum<float>(const ortc::Tensor<float>&, const ortc::Tensor<int64_t>&,
+                                          const ortc::Tensor<int64_t>&, ortc::Tensor<float>&);
+template void unsorted_segment_sum<double>(const ortc::Tensor<double>&, const ortc::Tensor<int64_t>&,
+                                           const ortc::Tensor<int64_t>&, ortc::Tensor<double>&);
@@ -6,6 +6,16 @@
 #include "ocos.h"
 #include "string_utils.h"
 
-void segment_sum(const ortc::Tensor<float>& data,
+// Sums the rows of data of each segment, which segment_ids must give in increasing order, without a gap.
+template <typename T>
+void segment_sum(const ortc::Tensor<T>& data,
                  const ortc::Tensor<int64_t>& segment_ids,
-                 ortc::Tensor<float>& output);
+                 ortc::Tensor<T>& output);
+
+// Sums the rows of data of each of the num_segments segments, which segment_ids may give in any order, in which a
+// negative one drops its row.
+template <typename T>
+void unsorted_segment_sum(const ortc::Tensor<T>& data,
+                          const ortc::Tensor<int64_t>& segment_ids,
+                          const ortc::Tensor<int64_t>& num_segments,
+                          ortc::Tensor<T>& output);
@@ -4,36 +4,78 @@
 #include "masked_fill.hpp"
 #include "string_tensor.h"
 #include <vector>
-#include <locale>
-#include <codecvt>
 #include <algorithm>
+#include <numeric>
 
-void masked_fill(const ortc::Tensor<std::string>& input,
-                 const ortc::Tensor<bool>& input_mask,
-                 ortc::Tensor<std::string>& output) {
-  auto& value_dimensions = input.Shape();
-  auto& mask_dimensions = input_mask.Shape();
-  if (!(value_dimensions.empty() || mask_dimensions.size() == 1)) {
-    ORTX_CXX_API_THROW("[MaskedFill]: the dimension of input value should be vector or scalar.", ORT_INVALID_ARGUMENT);
+namespace {
+
+// The count of the true values of the mask, 8 at a time: the bytes of bool are 0 or 1, so the sum of the bytes of a
+// word is its top byte once multiplied by 0x0101010101010101.
+size_t CountTrue(const bool* mask, size_t size) {
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, mask + i, sizeof(word));
+    count += static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
   }
 
-  if (value_dimensions != mask_dimensions) {
-    ORTX_CXX_API_THROW("[MaskedFill]: the dimension of input value and mask should be same.", ORT_INVALID_ARGUMENT);
+  for (; i < size; ++i) {
+    count += mask[i] ? 1 : 0;
   }
 
-  auto& value = input.Data();
-  const bool* mask = input_mask.Data();
+  return count;
+}
+
+size_t ShapeSize(std::vector<int64_t>::const_iterator begin, std::vector<int64_t>::const_iterator end) {
+  return static_cast<size_t>(std::accumulate(begin, end, int64_t{1}, std::multiplies<int64_t>()));
+}
+
+}  // namespace
+
+MaskedSelection SelectMasked(const std::vector<int64_t>& value_shape, const std::vector<int64_t>& mask_shape,
+                             const bool* mask, int64_t axis) {
+  MaskedSelection selection;
+  if (value_shape == mask_shape) {
+    selection.axis_length = ShapeSize(value_shape.begin(), value_shape.end());
+  } else if (mask_shape.size() == 1 && !value_shape.empty()) {
+    const int64_t rank = static_cast<int64_t>(value_shape.size());
+    if (axis < -rank || axis >= rank) {
+      ORTX_CXX_API_THROW(MakeString("[MaskedFill]: the axis ", axis, " is out of the rank ", rank, " of the value."),
+                         ORT_INVALID_ARGUMENT);
+    }
+
+    const size_t dim = static_cast<size_t>(axis < 0 ? axis + rank : axis);
+    if (value_shape[dim] != mask_shape[0]) {
+      ORTX_CXX_API_THROW(MakeString("[MaskedFill]: the length of the mask ", mask_shape[0],
+                                    " should be the dimension ", value_shape[dim], " of the value on the axis."),
+                         ORT_INVALID_ARGUMENT);
+    }
 
-  std::vector<std::string> result;
-  std::vector<int64_t> result_dimension;
+    selection.outer = ShapeSize(value_shape.begin(), value_shape.begin() + dim);
+    selection.axis_length = static_cast<size_t>(value_shape[dim]);
+    selection.inner = ShapeSize(value_shape.begin() + dim + 1, value_shape.end());
+    selection.output_shape = value_shape;
+  } else {
+    ORTX_CXX_API_THROW("[MaskedFill]: the dimension of input value and mask should be same, or the mask a vector.",
+                       ORT_INVALID_ARGUMENT);
+  }
 
-  for (size_t i = 0; i < value.size(); i++) {
-    if (!mask[i]) {
-      continue;
+  // the positions are counted first, so they're written once into their exact size
+  const size_t count = CountTrue(mask, selection.axis_length);
+  selection.selected.reserve(count);
+  for (size_t i = 0; i < selection.axis_length; ++i) {
+    if (mask[i]) {
+      selection.selected.push_back(i);
     }
+  }
 
-    result.push_back(value[i]);
+  if (selection.output_shape.empty()) {
+    selection.output_shape.push_back(static_cast<int64_t>(count));
+  } else {
+    selection.output_shape[static_cast<size_t>(axis < 0 ? axis + static_cast<int64_t>(value_shape.size()) : axis)] =
+        static_cast<int64_t>(count);
   }
-  result_dimension.push_back(result.size());
-  output.SetStringOutput(result, result_dimension);
+
+  return selection;
 }
@@ -5,8 +5,76 @@
 
 #include "ocos.h"
 #include "string_utils.h"
-#include <unordered_map>
+#include <cstring>
+#include <type_traits>
 
-void masked_fill(const ortc::Tensor<std::string>& input,
-                 const ortc::Tensor<bool>& input_mask,
-                 ortc::Tensor<std::string>& output);
+// The slices of the input kept by a mask. The input is seen as [outer, axis_length, inner]: the mask selects among
+// axis_length the positions `selected`, each of inner elements, in every one of the outer blocks.
+struct MaskedSelection {
+  std::vector<int64_t> output_shape;
+  std::vector<size_t> selected;
+  size_t outer{1};
+  size_t axis_length{1};
+  size_t inner{1};
+};
+
+// A mask of the shape of the input keeps its elements, in a vector. A vector mask keeps the slices of the input
+// along the axis, whose length it must have.
+MaskedSelection SelectMasked(const std::vector<int64_t>& value_shape, const std::vector<int64_t>& mask_shape,
+                             const bool* mask, int64_t axis);
+
+template <typename T>
+struct KernelMaskedFill : BaseKernel {
+  // the strings are read as views of the input, and only copied once into the output
+  using InputT = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+  KernelMaskedFill(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+    axis_ = TryToGetAttributeWithDefault<int64_t>("axis", 0);
+  }
+
+  void Compute(const ortc::Tensor<InputT>& input,
+               const ortc::Tensor<bool>& input_mask,
+               ortc::Tensor<T>& output) const {
+    const MaskedSelection selection = SelectMasked(input.Shape(), input_mask.Shape(), input_mask.Data(), axis_);
+
+    if constexpr (std::is_same_v<T, std::string>) {
+      auto& value = input.Data();
+      size_t num_chars = 0;
+      ForEachSelected(selection, [&](size_t begin) {
+        for (size_t i = begin; i < begin + selection.inner; ++i) {
+          num_chars += value[i].size();
+        }
+      });
+
+      ortc::StringTensorBuilder result;
+      result.Reserve(selection.outer * selection.selected.size() * selection.inner, num_chars);
+      ForEachSelected(selection, [&](size_t begin) {
+        for (size_t i = begin; i < begin + selection.inner; ++i) {
+          result.Append(value[i]);
+        }
+      });
+      output.SetStringOutput(result, selection.output_shape);
+    } else {
+      const T* value = input.Data();
+      T* out = output.Allocate(selection.output_shape);
+      ForEachSelected(selection, [&](size_t begin) {
+        std::memcpy(out, value + begin, selection.inner * sizeof(T));
+        out += selection.inner;
+      });
+    }
+  }
+
+ private:
+  // calls fn with the offset of each selected slice of the input, in the order of the output
+  template <typename Fn>
+  static void ForEachSelected(const MaskedSelection& selection, Fn&& fn) {
+    for (size_t o = 0; o < selection.outer; ++o) {
+      const size_t block = o * selection.axis_length;
+      for (size_t k : selection.selected) {
+        fn((block + k) * selection.inner);
+      }
+    }
+  }
+
+  int64_t axis_;
+};
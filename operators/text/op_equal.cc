@@ -8,9 +8,15 @@
 KernelStringEqual::KernelStringEqual(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
 }
 
-void KernelStringEqual::Compute(OrtKernelContext* context,
-                                const ortc::Tensor<std::string>&,
-                                const ortc::Tensor<std::string>&,
+void KernelStringEqual::Compute(const ortc::Tensor<std::string_view>& input_x,
+                                const ortc::Tensor<std::string_view>& input_y,
                                 ortc::Tensor<bool>& output) const {
-  KernelEqual_Compute<std::string>(api_, ort_, context);
+  if (input_x.NumberOfElement() >= input_y.NumberOfElement()) {
+    bool* out = output.Allocate(input_x.Shape());
+    StringEqual_Compute(input_x.Shape(), input_x.Data().data(), input_y.Shape(), input_y.Data().data(), out);
+  } else {
+    // Operator Equal is commutative.
+    bool* out = output.Allocate(input_y.Shape());
+    StringEqual_Compute(input_y.Shape(), input_y.Data().data(), input_x.Shape(), input_x.Data().data(), out);
+  }
 }
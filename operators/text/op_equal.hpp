@@ -8,8 +8,7 @@
 
 struct KernelStringEqual : BaseKernel {
   KernelStringEqual(const OrtApi& api, const OrtKernelInfo& info);
-  void Compute(OrtKernelContext* context,
-               const ortc::Tensor<std::string>&,
-               const ortc::Tensor<std::string>&,
+  void Compute(const ortc::Tensor<std::string_view>& input_x,
+               const ortc::Tensor<std::string_view>& input_y,
                ortc::Tensor<bool>& output) const;
 };
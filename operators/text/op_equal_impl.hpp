@@ -1,8 +1,13 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #pragma once
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <numeric>
 #include <vector>
 #include <string>
+#include <string_view>
 #include "string_utils.h"
 #include "string_tensor.h"
 
@@ -144,36 +149,87 @@ void KernelEqual_Compute(const OrtApi& api, const OrtW::CustomOpApi& ort_, OrtKe
   }
 }
 
+// The length and the first 8 bytes of a string, which tell most unequal strings apart before their bytes are
+// compared. The signatures of the strings compared many times with broadcasting are computed once.
+struct StringSignature {
+  explicit StringSignature(std::string_view s) : str{s}, prefix{Prefix(s)} {}
+
+  static uint64_t Prefix(std::string_view s) {
+    uint64_t prefix = 0;
+    std::memcpy(&prefix, s.data(), std::min(s.size(), sizeof(prefix)));
+    return prefix;
+  }
+
+  bool Equals(std::string_view s) const {
+    if (s.size() != str.size() || Prefix(s) != prefix) {
+      return false;
+    }
+
+    return s.size() <= sizeof(prefix) ||
+           std::memcmp(s.data() + sizeof(prefix), str.data() + sizeof(prefix), s.size() - sizeof(prefix)) == 0;
+  }
+
+  std::string_view str;
+  uint64_t prefix;
+};
+
 template <>
-void KernelEqual_Compute<std::string>(const OrtApi& api, const OrtW::CustomOpApi& ort_,
-                                      OrtKernelContext* context) {
-  // Setup inputs
-  const OrtValue* input_X = ort_.KernelContext_GetInput(context, 0);
-  const OrtValue* input_Y = ort_.KernelContext_GetInput(context, 1);
-  std::vector<std::string> X, Y;
-  GetTensorMutableDataString(api, ort_, context, input_X, X);
-  GetTensorMutableDataString(api, ort_, context, input_Y, Y);
+inline bool Compare<std::string_view>::operator()(const std::string_view& s1, const std::string_view& s2) const {
+  return StringSignature(s2).Equals(s1);
+}
 
-  // Setup output
-  OrtTensorDimensions dimensions_x(ort_, input_X);
-  OrtTensorDimensions dimensions_y(ort_, input_Y);
-  Compare<std::string> cmp;
+// Compares the strings of x with those of y broadcast to the shape of x, which has at least as many elements.
+// The common shapes, the same, a single string, or y repeated over the outer or the inner dimensions of x,
+// are compared without the broadcast iterator.
+inline void StringEqual_Compute(const std::vector<int64_t>& shape_x, const std::string_view* x,
+                                const std::vector<int64_t>& shape_y, const std::string_view* y, bool* out) {
+  const size_t size_x = static_cast<size_t>(
+      std::accumulate(shape_x.begin(), shape_x.end(), int64_t{1}, std::multiplies<int64_t>()));
+  const size_t size_y = static_cast<size_t>(
+      std::accumulate(shape_y.begin(), shape_y.end(), int64_t{1}, std::multiplies<int64_t>()));
+  if (shape_x == shape_y) {
+    for (size_t i = 0; i < size_x; ++i) {
+      out[i] = x[i].size() == y[i].size() && std::memcmp(x[i].data(), y[i].data(), x[i].size()) == 0;
+    }
+    return;
+  }
 
-  typename BroadcastIteratorRight<std::string, std::string, bool>::BroadcastIteratorRightState state;
-  if (dimensions_x.Size() >= dimensions_y.Size()) {
-    OrtValue* v = ort_.KernelContext_GetOutput(context, 0, dimensions_x.data(), dimensions_x.size());
-    bool* out = ort_.GetTensorMutableData<bool>(v);
-    BroadcastIteratorRight<std::string, std::string, bool> iter(
-        dimensions_x, dimensions_y, X.data(), Y.data(), out);
-    state.init(iter);
-    state.loop(cmp, state);
-  } else {
-    // Operator Equal is commutative.
-    OrtValue* v = ort_.KernelContext_GetOutput(context, 0, dimensions_y.data(), dimensions_y.size());
-    bool* out = ort_.GetTensorMutableData<bool>(v);
-    BroadcastIteratorRight<std::string, std::string, bool> iter(
-        dimensions_y, dimensions_x, Y.data(), X.data(), out);
-    state.init(iter);
-    state.loop(cmp, state);
+  if (size_y == 1 && shape_y.size() <= shape_x.size()) {
+    const StringSignature signature(y[0]);
+    for (size_t i = 0; i < size_x; ++i) {
+      out[i] = signature.Equals(x[i]);
+    }
+    return;
+  }
+
+  // y is [1,..,1, d_k,..,d_n] or [d_1,..,d_k, 1,..,1] of the same dimensions d of x
+  size_t leading_ones = 0;
+  size_t trailing_ones = 0;
+  if (shape_x.size() == shape_y.size() && size_y > 0) {
+    while (leading_ones < shape_y.size() && shape_y[leading_ones] == 1) {
+      ++leading_ones;
+    }
+    while (trailing_ones < shape_y.size() && shape_y[shape_y.size() - 1 - trailing_ones] == 1) {
+      ++trailing_ones;
+    }
   }
+
+  const bool outer = leading_ones > 0 && std::equal(shape_y.begin() + leading_ones, shape_y.end(),
+                                                    shape_x.begin() + leading_ones);
+  const bool inner = !outer && trailing_ones > 0 && std::equal(shape_y.begin(), shape_y.end() - trailing_ones,
+                                                               shape_x.begin());
+  if (outer || inner) {
+    std::vector<StringSignature> signatures(y, y + size_y);
+    const size_t repeat = size_x / size_y;
+    for (size_t i = 0; i < size_x; ++i) {
+      out[i] = signatures[outer ? i % size_y : i / repeat].Equals(x[i]);
+    }
+    return;
+  }
+
+  Compare<std::string_view> cmp;
+  typename BroadcastIteratorRight<std::string_view, std::string_view, bool>::BroadcastIteratorRightState state;
+  BroadcastIteratorRight<std::string_view, std::string_view, bool> iter(shape_x, shape_y, x, y, out);
+  state.init(iter);
+  state.loop(cmp, state);
 }
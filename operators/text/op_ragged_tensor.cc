@@ -3,6 +3,11 @@
 #include "string_utils.h"
 #include "string_tensor.h"
 #include "op_ragged_tensor.hpp"
+#include "parallel_for.h"
+#include "ragged_rows.h"
+
+#include <algorithm>
+#include <cstring>
 
 void KernelRaggedTensoroSparse::Compute(const ortc::Tensor<int64_t>& n_element,
                                         ortc::Tensor<int64_t>& output_0,
@@ -42,21 +47,11 @@ CommonRaggedTensoroDense::CommonRaggedTensoroDense(const OrtApi& api, const OrtK
     : BaseKernel(api, info) {
 }
 
-void CommonRaggedTensoroDense::GetInputDims(OrtKernelContext* context, const OrtValue** inputs,
-                                            OrtTensorDimensions* dims) const {
-  for (int i = 0; i < 4; ++i) {
-    inputs[i] = ort_.KernelContext_GetInput(context, i);
-    dims[i] = OrtTensorDimensions(ort_, inputs[i]);
-  }
-}
-
-int64_t CommonRaggedTensoroDense::GetMaxCol(int64_t n, const int64_t* p_indices) const {
-  int64_t size = n;
-  int64_t max_col = 0;
-  for (int64_t i = 1; i < size; ++i) {
-    max_col = std::max(max_col, p_indices[i] - p_indices[i - 1]);
-  }
-  return max_col;
+int64_t CommonRaggedTensoroDense::GetMaxCol(const char* op, int64_t n, const int64_t* p_indices,
+                                            int64_t value_count) const {
+  const ort_extensions::RowSplits splits(op, p_indices, static_cast<size_t>(n),
+                                         static_cast<size_t>(value_count), ort_extensions::RowSplits::Check::kWithin);
+  return static_cast<int64_t>(splits.MaxLength());
 }
 
 KernelRaggedTensoroDense::KernelRaggedTensoroDense(const OrtApi& api, const OrtKernelInfo& info)
@@ -74,28 +69,22 @@ void KernelRaggedTensoroDense::Compute(const ortc::Tensor<int64_t>& input0,
   const int64_t* p_indices = input3.Data();
 
   int64_t size = input3.NumberOfElement();
-  int64_t max_col = GetMaxCol(size, p_indices);
-
-  std::vector<int64_t> shape_out{size - 1, max_col};
+  int64_t max_col = GetMaxCol("RaggedTensorToDense", size, p_indices, input1.NumberOfElement());
+  std::vector<int64_t> shape_out{std::max<int64_t>(size - 1, 0), max_col};
   int64_t* dense = output.Allocate(shape_out);
 
-  int64_t pos = 0;
-  int64_t j, pos_end;
-  int64_t shape_out_size = shape_out[0] * shape_out[1];
-  for (int64_t i = 0; i < size - 1; ++i) {
-    pos_end = pos + max_col;
-    if (pos_end > shape_out_size)
-      ORTX_CXX_API_THROW(MakeString(
-                             "Unexpected index ", pos_end, " greather than ", shape_out[0], "x", shape_out[1],
-                             " - i=", i, " size=", size, "."),
-                         ORT_INVALID_ARGUMENT);
-    for (j = p_indices[i]; j < p_indices[i + 1]; ++j, ++pos) {
-      dense[pos] = p_values[j];
-    }
-    for (; pos < pos_end; ++pos) {
-      dense[pos] = p_missing[0];
-    }
-  }
+  // the rows are filled with a copy of their values and the default value after them, or missing_value without one
+  const int64_t missing = input2.NumberOfElement() > 0 ? p_missing[0] : missing_value_;
+  const auto& context = Ort::Custom::ComputeContext::Current();
+  ParallelFor(context, static_cast<size_t>(shape_out[0]), 8.0 + static_cast<double>(max_col),
+              [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                  int64_t* row = dense + i * max_col;
+                  const int64_t length = p_indices[i + 1] - p_indices[i];
+                  std::memcpy(row, p_values + p_indices[i], static_cast<size_t>(length) * sizeof(int64_t));
+                  std::fill(row + length, row + max_col, missing);
+                }
+              });
 }
 
 KernelStringRaggedTensoroDense::KernelStringRaggedTensoroDense(const OrtApi& api, const OrtKernelInfo& info)
@@ -103,34 +92,42 @@ KernelStringRaggedTensoroDense::KernelStringRaggedTensoroDense(const OrtApi& api
 }
 
 void KernelStringRaggedTensoroDense::Compute(const ortc::Tensor<int64_t>& input0,
-                                             const ortc::Tensor<std::string>& input1,
+                                             const ortc::Tensor<std::string_view>& input1,
                                              const ortc::Tensor<int64_t>& input2,
-                                             const ortc::Tensor<std::string>& input3,
+                                             const ortc::Tensor<std::string_view>& input3,
                                              ortc::Tensor<std::string>& output) const {
-  // const OrtValue* inputs[4];
-  // OrtTensorDimensions dims[4];
-
   auto& input = input1.Data();
   const int64_t* p_indices = input2.Data();
-  int64_t size = input3.NumberOfElement();
-  int64_t max_col = GetMaxCol(size, p_indices);
-  std::vector<int64_t> shape_out{size - 1, max_col};
-
-  int64_t shape_out_size = shape_out[0] * shape_out[1];
-  std::vector<std::string> dense(static_cast<size_t>(max_col * (size - 1)));
-  int64_t pos = 0;
-  int64_t j, pos_end;
-  for (int64_t i = 0; i < size - 1; ++i) {
-    pos_end = pos + max_col;
-    if (pos_end > shape_out_size)
-      ORTX_CXX_API_THROW(MakeString(
-                             "Unexpected index ", pos_end, " greather than ", shape_out[0], "x", shape_out[1],
-                             " - i=", i, " size=", size, "."),
-                         ORT_INVALID_ARGUMENT);
-    for (j = p_indices[i]; j < p_indices[i + 1]; ++j, ++pos) {
-      dense[static_cast<size_t>(pos)] = input[static_cast<size_t>(j)];
-    }
-    pos = pos_end;
+  int64_t size = input2.NumberOfElement();
+  int64_t max_col = GetMaxCol("StringRaggedTensorToDense", size, p_indices, static_cast<int64_t>(input.size()));
+  std::vector<int64_t> shape_out{std::max<int64_t>(size - 1, 0), max_col};
+
+  // the padding is the default value, if any, and the empty string otherwise
+  const std::string_view missing = input3.NumberOfElement() > 0 ? input3.Data()[0] : std::string_view{};
+  const size_t rows = static_cast<size_t>(shape_out[0]);
+  const size_t cols = static_cast<size_t>(max_col);
+
+  const auto dense_string = [&](size_t pos) {
+    const size_t row = pos / cols;
+    const int64_t j = p_indices[row] + static_cast<int64_t>(pos % cols);
+    return j < p_indices[row + 1] ? input[static_cast<size_t>(j)] : missing;
+  };
+
+  // the strings are written into one buffer of their exact size, straight from the input
+  std::vector<size_t> sizes(rows * cols);
+  for (size_t pos = 0; pos < sizes.size(); ++pos) {
+    sizes[pos] = dense_string(pos).size();
   }
+
+  ortc::StringTensorBuilder dense;
+  dense.AppendUninitialized(sizes);
+  const auto& context = Ort::Custom::ComputeContext::Current();
+  ParallelFor(context, sizes.size(), 24.0, [&](size_t begin, size_t end) {
+    for (size_t pos = begin; pos < end; ++pos) {
+      const std::string_view str = dense_string(pos);
+      std::memcpy(dense.MutableData(pos), str.data(), str.size());
+    }
+  });
+
   output.SetStringOutput(dense, shape_out);
 }
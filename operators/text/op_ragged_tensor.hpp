@@ -18,8 +18,9 @@ struct CommonRaggedTensoroDense : BaseKernel {
   CommonRaggedTensoroDense(const OrtApi& api, const OrtKernelInfo& info);
 
  protected:
-  void GetInputDims(OrtKernelContext* context, const OrtValue** inputs, OrtTensorDimensions* dims) const;
-  int64_t GetMaxCol(int64_t n, const int64_t* p_indices) const;
+  // Returns the length of the longest row of the row splits, which must be increasing values in [0, value_count],
+  // see RowSplits of base/ragged_rows.h.
+  int64_t GetMaxCol(const char* op, int64_t n, const int64_t* p_indices, int64_t value_count) const;
 };
 
 struct KernelRaggedTensoroDense : CommonRaggedTensoroDense {
@@ -37,8 +38,8 @@ struct KernelRaggedTensoroDense : CommonRaggedTensoroDense {
 struct KernelStringRaggedTensoroDense : CommonRaggedTensoroDense {
   KernelStringRaggedTensoroDense(const OrtApi& api, const OrtKernelInfo& info);
   void Compute(const ortc::Tensor<int64_t>& input0,
-               const ortc::Tensor<std::string>& input1,
+               const ortc::Tensor<std::string_view>& input1,
                const ortc::Tensor<int64_t>& input2,
-               const ortc::Tensor<std::string>& input3,
+               const ortc::Tensor<std::string_view>& input3,
                ortc::Tensor<std::string>& output) const;
 };
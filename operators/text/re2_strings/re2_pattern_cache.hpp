@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "re2/re2.h"
+#include "lru_cache.h"
+
+// The compiled RE2 patterns of a kernel, which are reused across the calls.
+// The pattern inputs are almost always the constants of the graph, and compiling a pattern costs
+// more than matching it against a short text. RE2 objects are thread-safe once compiled.
+class Re2PatternCache {
+ public:
+  static constexpr size_t kDefaultCapacity = 16;
+
+  explicit Re2PatternCache(size_t capacity = kDefaultCapacity) : cache_(capacity) {
+    cache_.SetStatsName("re2_pattern_cache");
+  }
+
+  std::shared_ptr<const re2::RE2> Get(std::string_view pattern) const {
+    std::string key(pattern);
+    std::shared_ptr<const re2::RE2> reg;
+    if (!cache_.Lookup(key, reg)) {
+      reg = std::make_shared<const re2::RE2>(key);
+      cache_.Insert(key, reg);
+    }
+    return reg;
+  }
+
+ private:
+  mutable LruCache<std::string, std::shared_ptr<const re2::RE2>> cache_;
+};
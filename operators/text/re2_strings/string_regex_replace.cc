@@ -7,13 +7,22 @@
 #include <algorithm>
 #include "re2/re2.h"
 #include "string_tensor.h"
+#include "parallel_for.h"
 
 KernelStringRegexReplace::KernelStringRegexReplace(const OrtApi& api, const OrtKernelInfo& info)
     : BaseKernel(api, info) {
   global_replace_ = TryToGetAttributeWithDefault("global_replace", 1);
+
+  // a pattern known at the session creation is compiled here, instead of by the first call.
+  std::string pattern;
+  if (TryToGetAttribute("pattern", pattern) && !pattern.empty()) {
+    patterns_.Get(pattern);
+  }
+
+  num_threads_ = ReadNumThreadsAttribute(*this);
 }
 
-void KernelStringRegexReplace::Compute(const ortc::Tensor<std::string>& input,
+void KernelStringRegexReplace::Compute(const ortc::Tensor<std::string_view>& input,
                                        std::string_view str_pattern,
                                        std::string_view str_rewrite,
                                        ortc::Tensor<std::string>& output) const {
@@ -21,21 +30,35 @@ void KernelStringRegexReplace::Compute(const ortc::Tensor<std::string>& input,
     ORTX_CXX_API_THROW("pattern (second input) cannot be empty.", ORT_INVALID_ARGUMENT);
 
   // Setup output
-  std::vector<std::string> str_input{input.Data()};
+  auto& str_input = input.Data();
   auto dim = input.Shape();
-  size_t size = input.NumberOfElement();
 
   re2::StringPiece piece(str_rewrite.data());
-  re2::RE2 reg(str_pattern.data());
+  auto reg = patterns_.Get(str_pattern);
 
-  if (global_replace_) {
-    for (size_t i = 0; i < size; i++) {
-      re2::RE2::GlobalReplace(&(str_input[i]), reg, piece);
+  // re2 rewrites a std::string in place, so the rows are rewritten in their own strings, on the threads since an
+  // RE2 is thread-safe to match, and then copied in parallel straight into the strings of the output.
+  const size_t rows = str_input.size();
+  std::vector<std::string> str_output(rows);
+  std::vector<size_t> sizes(rows);
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      std::string& str = str_output[row];
+      str.assign(str_input[row]);
+      if (global_replace_) {
+        re2::RE2::GlobalReplace(&str, *reg, piece);
+      } else {
+        re2::RE2::Replace(&str, *reg, piece);
+      }
+      sizes[row] = str.size();
     }
-  } else {
-    for (size_t i = 0; i < size; i++) {
-      re2::RE2::Replace(&(str_input[i]), reg, piece);
-    }
-  }
-  output.SetStringOutput(str_input, dim);
+  });
+
+  output.SetStringOutput(dim, sizes, [&](const std::vector<char*>& buffers) {
+    ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+      for (size_t row = begin; row < end; ++row) {
+        std::copy(str_output[row].begin(), str_output[row].end(), buffers[row]);
+      }
+    });
+  });
 }
@@ -5,14 +5,17 @@
 
 #include "ocos.h"
 #include "string_utils.h"
+#include "re2_pattern_cache.hpp"
 
 struct KernelStringRegexReplace : BaseKernel {
   KernelStringRegexReplace(const OrtApi& api, const OrtKernelInfo& info);
-  void Compute(const ortc::Tensor<std::string>& input,
+  void Compute(const ortc::Tensor<std::string_view>& input,
                std::string_view str_pattern,
                std::string_view str_rewrite,
                ortc::Tensor<std::string>& output) const;
 
  protected:
   int64_t global_replace_;
+  Re2PatternCache patterns_;
+  size_t num_threads_{1};
 };
@@ -4,19 +4,36 @@
 #include "string_regex_split.hpp"
 #include "string_regex_split_re.hpp"
 #include "string_tensor.h"
+#include "parallel_for.h"
 #include <vector>
 #include <cmath>
+#include <cstring>
 
-void KernelStringRegexSplitWithOffsets(const ortc::Tensor<std::string>& input,
-                                       std::string_view str_pattern,
-                                       const ortc::Tensor<std::string>& str_keep_pattern,
-                                       ortc::Tensor<std::string>& output_text,
-                                       ortc::Tensor<int64_t>& output_begin,
-                                       ortc::Tensor<int64_t>& output_end,
-                                       ortc::Tensor<int64_t>& output_offset) {
-  // Setup inputs
+KernelStringRegexSplitWithOffsets::KernelStringRegexSplitWithOffsets(const OrtApi& api, const OrtKernelInfo& info)
+    : BaseKernel(api, info) {
+  // the patterns known at the session creation are compiled here, instead of by the first call.
+  std::string pattern;
+  if (TryToGetAttribute("pattern", pattern) && !pattern.empty()) {
+    patterns_.Get(pattern);
+  }
+  std::string keep_pattern;
+  if (TryToGetAttribute("keep_pattern", keep_pattern) && !keep_pattern.empty()) {
+    patterns_.Get(keep_pattern);
+  }
 
-  std::vector<std::string> str_input(input.Data());
+  offsets_only_ = TryToGetAttributeWithDefault<int64_t>("offsets_only", 0) != 0;
+  num_threads_ = ReadNumThreadsAttribute(*this);
+}
+
+void KernelStringRegexSplitWithOffsets::Compute(const ortc::Tensor<std::string>& input,
+                                                std::string_view str_pattern,
+                                                const ortc::Tensor<std::string>& str_keep_pattern,
+                                                ortc::Tensor<std::string>& output_text,
+                                                ortc::Tensor<int64_t>& output_begin,
+                                                ortc::Tensor<int64_t>& output_end,
+                                                ortc::Tensor<int64_t>& output_offset) const {
+  // Setup inputs
+  auto& str_input = input.Data();
 
   if (str_pattern.empty()) {
     ORTX_CXX_API_THROW("Splitting pattern cannot be empty.", ORT_INVALID_ARGUMENT);
@@ -29,40 +46,62 @@ void KernelStringRegexSplitWithOffsets(const ortc::Tensor<std::string>& input,
   auto dimensions = input.Shape();
   bool include_delimiter = (str_keep_pattern.Data().size() == 1) && (!str_keep_pattern.Data()[0].empty());
 
-  re2::RE2 reg(str_pattern.data());
-  re2::RE2 keep_reg(include_delimiter ? str_keep_pattern.Data()[0].data() : "");
+  auto reg = patterns_.Get(str_pattern);
+  auto keep_reg = patterns_.Get(include_delimiter ? std::string_view(str_keep_pattern.Data()[0]) : std::string_view());
 
-  std::vector<std::string> all_tokens;
-  std::vector<int64_t> all_begin_offsets, all_end_offsets;
-  std::vector<int64_t> row_offsets;
-
-  for (int64_t i = 0; i < dimensions[0]; i++) {
-    row_offsets.push_back(all_begin_offsets.size());
-    std::vector<std::string_view> tokens;
-    std::vector<int64_t> begin_offsets;
-    std::vector<int64_t> end_offsets;
-    RegexSplitImpl(str_input[static_cast<size_t>(i)], reg,
-                   include_delimiter, keep_reg,
-                   tokens, begin_offsets, end_offsets);
-    all_tokens.insert(all_tokens.end(), tokens.begin(), tokens.end());
-    for (size_t j = 0; j < begin_offsets.size(); ++j) {
-      all_begin_offsets.push_back(begin_offsets[j]);
-      all_end_offsets.push_back(end_offsets[j]);
+  // the rows are split on the threads, since an RE2 is thread-safe to match, and each row then writes its part of
+  // the outputs, which are allocated once by the counts of the tokens of the rows.
+  const size_t rows = static_cast<size_t>(dimensions[0]);
+  std::vector<std::vector<std::string_view>> tokens(rows);
+  std::vector<std::vector<int64_t>> begin_offsets(rows);
+  std::vector<std::vector<int64_t>> end_offsets(rows);
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      RegexSplitImpl(str_input[row], *reg, include_delimiter, *keep_reg,
+                     tokens[row], begin_offsets[row], end_offsets[row]);
     }
+  });
+
+  std::vector<int64_t> row_offsets(rows + 1, 0);
+  for (size_t row = 0; row < rows; ++row) {
+    row_offsets[row + 1] = row_offsets[row] + static_cast<int64_t>(tokens[row].size());
   }
-  row_offsets.push_back(all_begin_offsets.size());
+  const size_t num_tokens = static_cast<size_t>(row_offsets[rows]);
 
   // Setup output
-  std::vector<int64_t> dim_out{(int64_t)all_tokens.size()};
-  output_text.SetStringOutput(all_tokens, dim_out);
-
-  auto output_raw = output_begin.Allocate(dim_out);
-  memcpy(output_raw, all_begin_offsets.data(), all_begin_offsets.size() * sizeof(int64_t));
+  std::vector<int64_t> dim_out{static_cast<int64_t>(num_tokens)};
+  int64_t* p_begin = output_begin.Allocate(dim_out);
+  int64_t* p_end = output_end.Allocate(dim_out);
+  std::vector<size_t> sizes(offsets_only_ ? 0 : num_tokens);
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      const size_t first = static_cast<size_t>(row_offsets[row]);
+      std::copy(begin_offsets[row].begin(), begin_offsets[row].end(), p_begin + first);
+      std::copy(end_offsets[row].begin(), end_offsets[row].end(), p_end + first);
+      for (size_t i = 0; !offsets_only_ && i < tokens[row].size(); ++i) {
+        sizes[first + i] = tokens[row][i].size();
+      }
+    }
+  });
 
-  output_raw = output_end.Allocate(dim_out);
-  memcpy(output_raw, all_end_offsets.data(), all_end_offsets.size() * sizeof(int64_t));
+  // the tokens are views of the input, which are copied straight into the strings of the output, unless they're
+  // sliced from the input by their offsets, e.g. by StringSliceWithOffsets
+  if (offsets_only_) {
+    output_text.SetStringOutput(std::vector<std::string>(), {0});
+  } else {
+    output_text.SetStringOutput(dim_out, sizes, [&](const std::vector<char*>& words) {
+      ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+        for (size_t row = begin; row < end; ++row) {
+          const size_t first = static_cast<size_t>(row_offsets[row]);
+          for (size_t i = 0; i < tokens[row].size(); ++i) {
+            memcpy(words[first + i], tokens[row][i].data(), tokens[row][i].size());
+          }
+        }
+      });
+    });
+  }
 
-  std::vector<int64_t> dim_out_row{(int64_t)row_offsets.size()};
-  output_raw = output_offset.Allocate(dim_out_row);
-  memcpy(output_raw, row_offsets.data(), row_offsets.size() * sizeof(int64_t));
+  std::vector<int64_t> dim_out_row{static_cast<int64_t>(row_offsets.size())};
+  int64_t* p_offset = output_offset.Allocate(dim_out_row);
+  memcpy(p_offset, row_offsets.data(), row_offsets.size() * sizeof(int64_t));
 }
@@ -5,12 +5,21 @@
 
 #include "ocos.h"
 #include "string_utils.h"
+#include "re2_pattern_cache.hpp"
 
 // See https://github.com/tensorflow/text/blob/master/docs/api_docs/python/text/regex_split_with_offsets.md.
-void KernelStringRegexSplitWithOffsets(const ortc::Tensor<std::string>& input,
-                                       std::string_view str_pattern,
-                                       const ortc::Tensor<std::string>& str_keep_pattern,
-                                       ortc::Tensor<std::string>& output_text,
-                                       ortc::Tensor<int64_t>& output_begin,
-                                       ortc::Tensor<int64_t>& output_end,
-                                       ortc::Tensor<int64_t>& output_offset);
\ No newline at end of file
+struct KernelStringRegexSplitWithOffsets : BaseKernel {
+  KernelStringRegexSplitWithOffsets(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string>& input,
+               std::string_view str_pattern,
+               const ortc::Tensor<std::string>& str_keep_pattern,
+               ortc::Tensor<std::string>& output_text,
+               ortc::Tensor<int64_t>& output_begin,
+               ortc::Tensor<int64_t>& output_end,
+               ortc::Tensor<int64_t>& output_offset) const;
+
+ private:
+  Re2PatternCache patterns_;
+  bool offsets_only_{};
+  size_t num_threads_{1};
+};
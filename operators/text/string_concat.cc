@@ -3,24 +3,118 @@
 
 #include "string_concat.hpp"
 #include "string_tensor.h"
-#include <vector>
-#include <locale>
-#include <codecvt>
+#include "parallel_for.h"
+
 #include <algorithm>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <vector>
 
-void string_concat(const ortc::Tensor<std::string>& left,
-                   const ortc::Tensor<std::string>& right,
-                   ortc::Tensor<std::string>& output) {
-  if (left.Shape() != right.Shape()) {
-    ORTX_CXX_API_THROW("Two input tensor should have the same dimension.", ORT_INVALID_ARGUMENT);
+namespace {
+
+// The flat indices of the two inputs of the outputs of a numpy broadcast, from an output on in the order of the
+// outputs. The stride of an input is 0 on its dimensions of 1, so it stays on the same string along them.
+class BroadcastWalk {
+ public:
+  BroadcastWalk(const std::vector<int64_t>& dims, const std::vector<int64_t>& left_strides,
+                const std::vector<int64_t>& right_strides, size_t pos)
+      : dims_(dims), left_strides_(left_strides), right_strides_(right_strides), counters_(dims.size()) {
+    for (size_t d = dims.size(); d-- > 0;) {
+      counters_[d] = static_cast<int64_t>(pos) % dims[d];
+      pos /= static_cast<size_t>(dims[d]);
+      left_ += counters_[d] * left_strides[d];
+      right_ += counters_[d] * right_strides[d];
+    }
   }
-  // make a copy as input is const
-  std::vector<std::string> left_value = left.Data();
-  auto& right_value = right.Data();
 
-  for (size_t i = 0; i < left_value.size(); i++) {
-    left_value[i].append(right_value[i]);
+  size_t Left() const { return static_cast<size_t>(left_); }
+  size_t Right() const { return static_cast<size_t>(right_); }
+
+  void Next() {
+    for (size_t d = dims_.size(); d-- > 0;) {
+      left_ += left_strides_[d];
+      right_ += right_strides_[d];
+      if (++counters_[d] < dims_[d]) {
+        return;
+      }
+      left_ -= left_strides_[d] * dims_[d];
+      right_ -= right_strides_[d] * dims_[d];
+      counters_[d] = 0;
+    }
   }
 
-  output.SetStringOutput(left_value, left.Shape());
+ private:
+  const std::vector<int64_t>& dims_;
+  const std::vector<int64_t>& left_strides_;
+  const std::vector<int64_t>& right_strides_;
+  std::vector<int64_t> counters_;
+  int64_t left_{};
+  int64_t right_{};
+};
+
+// the strides of the shape within the output dims, right-aligned, of 0 on its dimensions of 1
+std::vector<int64_t> BroadcastStrides(const std::vector<int64_t>& shape, size_t rank) {
+  std::vector<int64_t> strides(rank, 0);
+  int64_t stride = 1;
+  for (size_t i = shape.size(); i-- > 0;) {
+    strides[rank - shape.size() + i] = shape[i] == 1 ? 0 : stride;
+    stride *= shape[i];
+  }
+  return strides;
+}
+
+}  // namespace
+
+void string_concat(const ortc::Tensor<std::string_view>& left,
+                   const ortc::Tensor<std::string_view>& right,
+                   ortc::Tensor<std::string>& output) {
+  const auto& left_shape = left.Shape();
+  const auto& right_shape = right.Shape();
+  const size_t rank = std::max(left_shape.size(), right_shape.size());
+  std::vector<int64_t> dims(rank);
+  for (size_t i = 0; i < rank; ++i) {
+    const int64_t l = i + left_shape.size() < rank ? 1 : left_shape[i + left_shape.size() - rank];
+    const int64_t r = i + right_shape.size() < rank ? 1 : right_shape[i + right_shape.size() - rank];
+    if (l != r && l != 1 && r != 1) {
+      ORTX_CXX_API_THROW(MakeString("[StringConcat]: Cannot broadcast the shapes ", left_shape, " and ", right_shape,
+                                    ", dimension ", i, " is ", l, " and ", r, "."),
+                         ORT_INVALID_ARGUMENT);
+    }
+    dims[i] = l == 1 ? r : l;
+  }
+
+  const auto& left_value = left.Data();
+  const auto& right_value = right.Data();
+  const size_t count =
+      static_cast<size_t>(std::accumulate(dims.begin(), dims.end(), int64_t{1}, std::multiplies<int64_t>()));
+  const std::vector<int64_t> left_strides = BroadcastStrides(left_shape, rank);
+  const std::vector<int64_t> right_strides = BroadcastStrides(right_shape, rank);
+
+  // the sizes of the outputs are computed first, so they're all written into the one buffer of their exact size
+  const auto& context = Ort::Custom::ComputeContext::Current();
+  std::vector<size_t> sizes(count);
+  ParallelFor(context, count, 8.0, [&](size_t begin, size_t end) {
+    BroadcastWalk walk(dims, left_strides, right_strides, begin);
+    for (size_t pos = begin; pos < end; ++pos, walk.Next()) {
+      sizes[pos] = left_value[walk.Left()].size() + right_value[walk.Right()].size();
+    }
+  });
+
+  size_t total_chars = 0;
+  for (size_t size : sizes) {
+    total_chars += size;
+  }
+  const double cost = 16.0 + (count == 0 ? 0.0 : static_cast<double>(total_chars) / static_cast<double>(count));
+  output.SetStringOutput(dims, sizes, [&](const std::vector<char*>& out) {
+    ParallelFor(context, count, cost, [&](size_t begin, size_t end) {
+      BroadcastWalk walk(dims, left_strides, right_strides, begin);
+      for (size_t pos = begin; pos < end; ++pos, walk.Next()) {
+        const std::string_view l = left_value[walk.Left()];
+        const std::string_view r = right_value[walk.Right()];
+        std::memcpy(out[pos], l.data(), l.size());
+        std::memcpy(out[pos] + l.size(), r.data(), r.size());
+      }
+    });
+  });
 }
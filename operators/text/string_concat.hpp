@@ -6,6 +6,7 @@
 #include "ocos.h"
 #include "string_utils.h"
 
-void string_concat(const ortc::Tensor<std::string>& left,
-                   const ortc::Tensor<std::string>& right,
+// Concatenates the strings of the two tensors, whose shapes are broadcast like the ones of numpy.
+void string_concat(const ortc::Tensor<std::string_view>& left,
+                   const ortc::Tensor<std::string_view>& right,
                    ortc::Tensor<std::string>& output);
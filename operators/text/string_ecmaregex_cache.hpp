@@ -0,0 +1,192 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <memory>
+#include <regex>
+#include <string>
+#include <string_view>
+
+#include "lru_cache.h"
+#ifdef ENABLE_RE2_REGEX
+#include "re2/re2.h"
+#endif
+
+// The compiled std::regex objects of a kernel, which are reused across the calls.
+// Constructing a std::regex costs far more than matching it against the short texts of a request,
+// and the patterns are almost always the constants of the graph.
+class EcmaRegexCache {
+ public:
+  static constexpr size_t kDefaultCapacity = 16;
+
+  explicit EcmaRegexCache(size_t capacity = kDefaultCapacity) : cache_(capacity) {
+    cache_.SetStatsName("ecma_regex_cache");
+  }
+
+  std::shared_ptr<const std::regex> Get(std::string_view pattern, std::regex_constants::syntax_option_type flags) const {
+    // the flags are a part of the key, so the same pattern compiled with other options is kept apart.
+    std::string key = std::to_string(static_cast<unsigned>(flags)) + ':';
+    key.append(pattern.data(), pattern.size());
+
+    std::shared_ptr<const std::regex> reg;
+    if (!cache_.Lookup(key, reg)) {
+      reg = std::make_shared<const std::regex>(pattern.begin(), pattern.end(), flags);
+      cache_.Insert(key, reg);
+    }
+    return reg;
+  }
+
+ private:
+  mutable LruCache<std::string, std::shared_ptr<const std::regex>> cache_;
+};
+
+#ifdef ENABLE_RE2_REGEX
+// Translates an ECMAScript pattern into the RE2 syntax with the same meaning on the bytes,
+// as std::regex<char> sees the text. It returns false for the constructs RE2 doesn't support
+// or the translation doesn't handle, e.g. the back references, \u escapes or \S in a class.
+// std::regex folds the case of the ASCII letters only, by the ctype of the "C" locale, and
+// RE2 folds the Latin-1 ones too, so with ascii_only a pattern which has a non-ASCII byte,
+// literal or by a \x escape, isn't translated either.
+inline bool EcmaPatternToRe2(std::string_view pattern, std::string& re2_pattern, bool ascii_only = false) {
+  // std::regex matches \s with isspace() and stops '.' at both of the line terminators.
+  static constexpr std::string_view kSpaces = "\\t\\n\\v\\f\\r ";
+  re2_pattern.clear();
+  bool in_class = false;
+  size_t class_begin = 0;  // the first position which may close the class
+  for (size_t i = 0; i < pattern.size(); ++i) {
+    char ch = pattern[i];
+    if (ascii_only && static_cast<unsigned char>(ch) >= 0x80) {
+      return false;
+    }
+    if (ch == '\\') {
+      if (++i == pattern.size()) {
+        return false;
+      }
+      char escaped = pattern[i];
+      if (ascii_only && (escaped == 'x' || static_cast<unsigned char>(escaped) >= 0x80)) {
+        return false;
+      }
+      if (escaped == 's' || escaped == 'S') {
+        if (in_class) {
+          if (escaped == 'S') {
+            return false;
+          }
+          re2_pattern.append(kSpaces);
+        } else {
+          re2_pattern.append(escaped == 's' ? "[" : "[^").append(kSpaces).append("]");
+        }
+      } else if ((escaped >= '0' && escaped <= '9') || escaped == 'u' || escaped == 'c' || escaped == 'k') {
+        return false;
+      } else {
+        re2_pattern.push_back('\\');
+        re2_pattern.push_back(escaped);
+      }
+    } else if (in_class) {
+      if (ch == ']') {
+        if (i == class_begin) {
+          return false;  // [] and [^] are valid in ECMAScript only
+        }
+        in_class = false;
+      }
+      re2_pattern.push_back(ch);
+    } else if (ch == '[') {
+      in_class = true;
+      class_begin = (i + 1 < pattern.size() && pattern[i + 1] == '^') ? i + 2 : i + 1;
+      re2_pattern.push_back(ch);
+    } else if (ch == '.') {
+      re2_pattern.append("[^\\n\\r]");
+    } else {
+      re2_pattern.push_back(ch);
+    }
+  }
+  return !in_class;
+}
+
+// Translates an ECMAScript replacement format into an RE2 rewrite string.
+inline bool EcmaFormatToRe2Rewrite(std::string_view format, std::string& rewrite) {
+  rewrite.clear();
+  for (size_t i = 0; i < format.size(); ++i) {
+    char ch = format[i];
+    if (ch == '\\') {
+      rewrite.append("\\\\");
+    } else if (ch == '$' && i + 1 < format.size()) {
+      char next = format[i + 1];
+      if (next == '$') {
+        rewrite.push_back('$');
+        ++i;
+      } else if (next == '&') {
+        rewrite.append("\\0");
+        ++i;
+      } else if (next >= '0' && next <= '9') {
+        if (i + 2 < format.size() && format[i + 2] >= '0' && format[i + 2] <= '9') {
+          return false;  // RE2 only rewrites the groups up to \9
+        }
+        rewrite.push_back('\\');
+        rewrite.push_back(next);
+        ++i;
+      } else if (next == '`' || next == '\'') {
+        return false;
+      } else {
+        rewrite.push_back(ch);
+      }
+    } else {
+      rewrite.push_back(ch);
+    }
+  }
+  return true;
+}
+
+// Compiles an ECMAScript pattern with RE2, or returns nullptr if it has to stay with std::regex.
+inline std::unique_ptr<re2::RE2> CompileEcmaPatternWithRe2(std::string_view pattern, bool ignore_case) {
+  // a pattern which ignores the case is only translated if RE2 folds it as std::regex does
+  std::string re2_pattern;
+  if (!EcmaPatternToRe2(pattern, re2_pattern, ignore_case)) {
+    return nullptr;
+  }
+
+  // Latin-1, not UTF-8, as std::regex<char> matches the bytes, so '.' and the classes match one
+  // byte of a multi-byte character in both of them.
+  re2::RE2::Options options;
+  options.set_encoding(re2::RE2::Options::EncodingLatin1);
+  options.set_case_sensitive(!ignore_case);
+  options.set_log_errors(false);
+  auto reg = std::make_unique<re2::RE2>(re2_pattern, options);
+  if (!reg->ok()) {
+    return nullptr;
+  }
+
+  // RE2 and std::regex step over the empty matches differently, so a pattern which may match
+  // the empty string stays with std::regex. An empty lower bound of the matches means it may.
+  std::string min_match;
+  std::string max_match;
+  if (!reg->PossibleMatchRange(&min_match, &max_match, 1) || min_match.empty()) {
+    return nullptr;
+  }
+  return reg;
+}
+
+// The RE2 translations of the ECMAScript patterns of a kernel, in which nullptr marks a pattern
+// that has to stay with std::regex.
+class EcmaRe2Cache {
+ public:
+  explicit EcmaRe2Cache(size_t capacity = EcmaRegexCache::kDefaultCapacity) : cache_(capacity) {
+    cache_.SetStatsName("ecma_re2_cache");
+  }
+
+  std::shared_ptr<const re2::RE2> Get(std::string_view pattern, bool ignore_case) const {
+    std::string key(ignore_case ? "i:" : ":");
+    key.append(pattern.data(), pattern.size());
+
+    std::shared_ptr<const re2::RE2> reg;
+    if (!cache_.Lookup(key, reg)) {
+      reg = CompileEcmaPatternWithRe2(pattern, ignore_case);
+      cache_.Insert(key, reg);
+    }
+    return reg;
+  }
+
+ private:
+  mutable LruCache<std::string, std::shared_ptr<const re2::RE2>> cache_;
+};
+#endif
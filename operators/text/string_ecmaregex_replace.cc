@@ -4,6 +4,7 @@
 #include "string_ecmaregex_replace.hpp"
 #include <vector>
 #include <algorithm>
+#include <iterator>
 #include <regex>
 #include "string_tensor.h"
 
@@ -11,36 +12,54 @@ KernelStringECMARegexReplace::KernelStringECMARegexReplace(const OrtApi& api, co
     : BaseKernel(api, info) {
   global_replace_ = TryToGetAttributeWithDefault("global_replace", true);
   ignore_case_ = TryToGetAttributeWithDefault("ignore_case", false);
+  use_re2_ = TryToGetAttributeWithDefault("use_re2", false);
 }
 
-void KernelStringECMARegexReplace::Compute(const ortc::Tensor<std::string>& input,
+void KernelStringECMARegexReplace::Compute(const ortc::Tensor<std::string_view>& input,
                                            std::string_view pattern,
                                            std::string_view rewrite,
                                            ortc::Tensor<std::string>& output) const {
-  // make a copy as input is constant;
-  std::vector<std::string> str_input = input.Data();
+  auto& str_input = input.Data();
   if (pattern.empty()) {
     ORTX_CXX_API_THROW("pattern (second input) cannot be empty.", ORT_INVALID_GRAPH);
   }
-  size_t size = input.NumberOfElement();
-
   auto regex_flag = std::regex_constants::optimize | std::regex_constants::ECMAScript;
   if (ignore_case_) {
     regex_flag |= std::regex_constants::icase;
   }
 
-  std::regex reg(pattern.data(), regex_flag);
-
-  if (global_replace_) {
-    for (size_t i = 0; i < size; i++) {
-      str_input[i] = std::regex_replace(str_input[i], reg, rewrite.data());
-    }
-  } else {
-    for (size_t i = 0; i < size; i++) {
-      str_input[i] = std::regex_replace(str_input[i], reg, rewrite.data(), std::regex_constants::format_first_only);
+#ifdef ENABLE_RE2_REGEX
+  // the patterns and the rewrites in the syntax both of RE2 and ECMAScript support run on RE2.
+  if (use_re2_) {
+    auto re2_reg = re2_regexes_.Get(pattern, ignore_case_);
+    std::string re2_rewrite;
+    std::string error;
+    if (re2_reg != nullptr && EcmaFormatToRe2Rewrite(rewrite, re2_rewrite) &&
+        re2_reg->CheckRewriteString(re2_rewrite, &error)) {
+      // re2 rewrites the rows in place, which are then copied once into the output
+      std::vector<std::string> str_output(str_input.begin(), str_input.end());
+      for (std::string& str : str_output) {
+        if (global_replace_) {
+          re2::RE2::GlobalReplace(&str, *re2_reg, re2_rewrite);
+        } else {
+          re2::RE2::Replace(&str, *re2_reg, re2_rewrite);
+        }
+      }
+      output.SetStringOutput(str_output, input.Shape());
+      return;
     }
   }
+#endif
+
+  auto reg = regexes_.Get(pattern, regex_flag);
+
+  auto format_flag = global_replace_ ? std::regex_constants::format_default : std::regex_constants::format_first_only;
+  std::vector<std::string> str_output(str_input.size());
+  for (size_t i = 0; i < str_input.size(); ++i) {
+    std::string_view str = str_input[i];
+    std::regex_replace(std::back_inserter(str_output[i]), str.begin(), str.end(), *reg, rewrite.data(), format_flag);
+  }
 
   auto& dimensions = input.Shape();
-  output.SetStringOutput(str_input, dimensions);
+  output.SetStringOutput(str_output, dimensions);
 }
@@ -5,10 +5,11 @@
 
 #include "ocos.h"
 #include "string_utils.h"
+#include "string_ecmaregex_cache.hpp"
 
 struct KernelStringECMARegexReplace : BaseKernel {
   KernelStringECMARegexReplace(const OrtApi& api, const OrtKernelInfo& info);
-  void Compute(const ortc::Tensor<std::string>& input,
+  void Compute(const ortc::Tensor<std::string_view>& input,
                std::string_view pattern,
                std::string_view rewrite,
                ortc::Tensor<std::string>& output) const;
@@ -16,4 +17,9 @@ struct KernelStringECMARegexReplace : BaseKernel {
  protected:
   bool global_replace_;
   bool ignore_case_;
+  bool use_re2_;
+  EcmaRegexCache regexes_;
+#ifdef ENABLE_RE2_REGEX
+  EcmaRe2Cache re2_regexes_;
+#endif
 };
@@ -6,18 +6,23 @@
 #include <regex>
 #include <vector>
 #include <cmath>
+#include <cstring>
+#include <optional>
 #include "string_ecmaregex_split.hpp"
 #include "string_tensor.h"
+#include "ragged_rows.h"
 
 KernelStringECMARegexSplitWithOffsets::KernelStringECMARegexSplitWithOffsets(const OrtApi& api,
                                                                              const OrtKernelInfo& info)
     : BaseKernel(api, info) {
   ignore_case_ = TryToGetAttributeWithDefault("ignore_case", false);
+  offsets_only_ = TryToGetAttributeWithDefault<int64_t>("offsets_only", 0) != 0;
 }
 
 void KernelStringECMARegexSplitWithOffsets::Compute(const ortc::Tensor<std::string>& input,
                                                     std::string_view pattern,
                                                     std::string_view keep_pattern,
+                                                    std::optional<const ortc::Tensor<int64_t>*> row_splits,
                                                     ortc::Tensor<std::string>& output_text,
                                                     ortc::Tensor<int64_t>& output1,
                                                     ortc::Tensor<int64_t>& output2,
@@ -33,10 +38,10 @@ void KernelStringECMARegexSplitWithOffsets::Compute(const ortc::Tensor<std::stri
     regex_flag |= std::regex_constants::icase;
   }
 
-  std::regex reg(pattern.data(), regex_flag);
-  std::regex keep_reg(include_delimiter ? keep_pattern.data() : "", regex_flag);
+  auto reg = regexes_.Get(pattern, regex_flag);
+  auto keep_reg = regexes_.Get(include_delimiter ? keep_pattern : std::string_view(), regex_flag);
 
-  std::vector<std::string> all_tokens;
+  std::vector<std::string_view> all_tokens;
   std::vector<int64_t> all_begin_offsets, all_end_offsets;
   std::vector<int64_t> row_offsets;
 
@@ -45,8 +50,8 @@ void KernelStringECMARegexSplitWithOffsets::Compute(const ortc::Tensor<std::stri
     std::vector<std::string_view> tokens;
     std::vector<int64_t> begin_offsets;
     std::vector<int64_t> end_offsets;
-    ECMARegexSplitImpl(str_input[static_cast<size_t>(i)], reg,
-                       include_delimiter, keep_reg,
+    ECMARegexSplitImpl(str_input[static_cast<size_t>(i)], *reg,
+                       include_delimiter, *keep_reg,
                        tokens, begin_offsets, end_offsets);
     all_tokens.insert(all_tokens.end(), tokens.begin(), tokens.end());
     for (size_t j = 0; j < begin_offsets.size(); ++j) {
@@ -58,7 +63,20 @@ void KernelStringECMARegexSplitWithOffsets::Compute(const ortc::Tensor<std::stri
 
   // Setup output
   std::vector<int64_t> dim_out{(int64_t)all_tokens.size()};
-  output_text.SetStringOutput(all_tokens, dim_out);
+  if (offsets_only_) {
+    // the tokens are sliced from the input by their offsets, e.g. by StringSliceWithOffsets, and aren't copied here
+    output_text.SetStringOutput(std::vector<std::string>(), {0});
+  } else {
+    std::vector<size_t> sizes(all_tokens.size());
+    for (size_t i = 0; i < all_tokens.size(); ++i) {
+      sizes[i] = all_tokens[i].size();
+    }
+    output_text.SetStringOutput(dim_out, sizes, [&all_tokens](const std::vector<char*>& words) {
+      for (size_t i = 0; i < all_tokens.size(); ++i) {
+        memcpy(words[i], all_tokens[i].data(), all_tokens[i].size());
+      }
+    });
+  }
 
   int64_t* p_output = output1.Allocate(dim_out);
   memcpy(p_output, all_begin_offsets.data(), all_begin_offsets.size() * sizeof(int64_t));
@@ -66,6 +84,23 @@ void KernelStringECMARegexSplitWithOffsets::Compute(const ortc::Tensor<std::stri
   p_output = output2.Allocate(dim_out);
   memcpy(p_output, all_end_offsets.data(), all_end_offsets.size() * sizeof(int64_t));
 
+  // the rows of the ragged input are the ones of its tokens too
+  if (row_splits.has_value() && *row_splits != nullptr) {
+    const auto& splits_tensor = **row_splits;
+    if (dimensions.size() != 1 || splits_tensor.Shape().size() != 1) {
+      ORTX_CXX_API_THROW(MakeString("[StringECMARegexSplitWithOffsets]: the values ", dimensions, " and row_splits ",
+                                    splits_tensor.Shape(), " of a ragged input must be 1D."),
+                         ORT_INVALID_ARGUMENT);
+    }
+    const ort_extensions::RowSplits splits("StringECMARegexSplitWithOffsets", splits_tensor.Data(),
+                                           static_cast<size_t>(splits_tensor.NumberOfElement()), str_input.size());
+    p_output = output3.Allocate({static_cast<int64_t>(splits.Rows() + 1)});
+    for (size_t row = 0; row <= splits.Rows(); ++row) {
+      p_output[row] = row_offsets[static_cast<size_t>(splits_tensor.Data()[row])];
+    }
+    return;
+  }
+
   std::vector<int64_t> dim_out_row{(int64_t)row_offsets.size()};
   p_output = output3.Allocate(dim_out_row);
   memcpy(p_output, row_offsets.data(), row_offsets.size() * sizeof(int64_t));
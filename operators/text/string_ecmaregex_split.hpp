@@ -3,16 +3,21 @@
 
 #pragma once
 
+#include <optional>
 #include <regex>
 #include "ocos.h"
 #include "string_utils.h"
+#include "string_ecmaregex_cache.hpp"
 
 // See https://github.com/tensorflow/text/blob/master/docs/api_docs/python/text/regex_split_with_offsets.md.
+// The input may be the values of a ragged tensor with its optional row_splits, whose rows are then the ones of the
+// row offsets of the tokens, so a split of the sentences of the texts keeps the rows of the texts.
 struct KernelStringECMARegexSplitWithOffsets : BaseKernel {
   KernelStringECMARegexSplitWithOffsets(const OrtApi& api, const OrtKernelInfo& info);
   void Compute(const ortc::Tensor<std::string>& input,
                std::string_view pattern,
                std::string_view keep_pattern,
+               std::optional<const ortc::Tensor<int64_t>*> row_splits,
                ortc::Tensor<std::string>& output_text,
                ortc::Tensor<int64_t>& output1,
                ortc::Tensor<int64_t>& output2,
@@ -20,6 +25,8 @@ struct KernelStringECMARegexSplitWithOffsets : BaseKernel {
 
  private:
   bool ignore_case_;
+  bool offsets_only_;
+  EcmaRegexCache regexes_;
 };
 
 template <typename T>
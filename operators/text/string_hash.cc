@@ -7,38 +7,90 @@
 #include "farmhash.h"
 #include "string_tensor.h"
 #include "string_hash.hpp"
+#include "parallel_for.h"
+
+namespace {
+
+template <typename HashFn>
+void HashToBuckets(const ortc::Tensor<std::string_view>& input,
+                   int64_t num_buckets,
+                   ortc::Tensor<int64_t>& output,
+                   HashFn hash) {
+  if (num_buckets <= 0) {
+    ORTX_CXX_API_THROW(MakeString("num_buckets must be positive, but got ", num_buckets), ORT_INVALID_ARGUMENT);
+  }
 
-void string_hash(const ortc::Tensor<std::string>& input,
-                 int64_t num_buckets,
-                 ortc::Tensor<int64_t>& output) {
-  // Setup inputs
   auto& str_input = input.Data();
+  int64_t* out = output.Allocate(input.Shape());
+  const BucketModulo modulo(static_cast<uint64_t>(num_buckets));
 
-  // Setup output
-  auto& dimensions = input.Shape();
-  int64_t* out = output.Allocate(dimensions);
+  // the hashes of a few strings are computed at once, as most are short and their hashes are independent
+  constexpr size_t kBatch = 4;
+  const auto& context = Ort::Custom::ComputeContext::Current();
+  ParallelFor(context, str_input.size(), 40.0, [&](size_t begin, size_t end) {
+    size_t i = begin;
+    for (; i + kBatch <= end; i += kBatch) {
+      uint64_t hashes[kBatch];
+      for (size_t j = 0; j < kBatch; ++j) {
+        hashes[j] = hash(str_input[i + j]);
+      }
+      for (size_t j = 0; j < kBatch; ++j) {
+        out[i + j] = static_cast<int64_t>(modulo(hashes[j]));
+      }
+    }
 
-  size_t size = output.NumberOfElement();
+    for (; i < end; ++i) {
+      out[i] = static_cast<int64_t>(modulo(hash(str_input[i])));
+    }
+  });
+}
 
-  // Do computation
-  size_t nb = static_cast<size_t>(num_buckets);
-  for (size_t i = 0; i < size; i++) {
-    out[i] = static_cast<int64_t>(Hash64(str_input[i].c_str(), str_input[i].size()) % nb);
-  }
+}  // namespace
+
+void string_hash(const ortc::Tensor<std::string_view>& input,
+                 int64_t num_buckets,
+                 ortc::Tensor<int64_t>& output) {
+  HashToBuckets(input, num_buckets, output, [](std::string_view str) { return Hash64(str.data(), str.size()); });
 }
 
-void string_hash_fast(const ortc::Tensor<std::string>& input,
+void string_hash_fast(const ortc::Tensor<std::string_view>& input,
                       int64_t num_buckets,
                       ortc::Tensor<int64_t>& output) {
-  // Setup inputs
-  auto& str_input = input.Data();
-  // Setup output
-  auto& dimensions = input.Shape();
-  int64_t* out = output.Allocate(dimensions);
-  size_t size = output.NumberOfElement();
-  // Do computation
-  size_t nb = static_cast<size_t>(num_buckets);
-  for (size_t i = 0; i < size; i++) {
-    out[i] = static_cast<int64_t>(util::Fingerprint64(str_input[i].c_str(), str_input[i].size()) % nb);
+  HashToBuckets(input, num_buckets, output,
+                [](std::string_view str) { return util::Fingerprint64(str.data(), str.size()); });
+}
+
+void string_hash_fast_sparse(const ortc::Tensor<std::string_view>& input,
+                             int64_t num_buckets,
+                             ortc::Tensor<int64_t>& indices,
+                             ortc::Tensor<float>& values,
+                             ortc::Tensor<int64_t>& dense_shape) {
+  if (num_buckets <= 0) {
+    ORTX_CXX_API_THROW(MakeString("num_buckets must be positive, but got ", num_buckets), ORT_INVALID_ARGUMENT);
   }
+
+  // the features of a row are on the last axis, so the rows are the others, and a 1D input is one row
+  auto& str_input = input.Data();
+  const auto& shape = input.Shape();
+  const size_t features = shape.empty() ? 1 : static_cast<size_t>(shape.back());
+  const size_t rows = features == 0 ? 0 : str_input.size() / features;
+  const BucketModulo modulo(static_cast<uint64_t>(num_buckets));
+
+  std::vector<std::vector<int64_t>> row_ids(rows);
+  const auto& context = Ort::Custom::ComputeContext::Current();
+  ParallelFor(context, rows, 40.0 * static_cast<double>(features), [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      auto& ids = row_ids[row];
+      ids.resize(features);
+      for (size_t i = 0; i < features; ++i) {
+        std::string_view str = str_input[row * features + i];
+        ids[i] = static_cast<int64_t>(modulo(util::Fingerprint64(str.data(), str.size())));
+      }
+    }
+  });
+
+  const double sort_cost = 10.0 * static_cast<double>(features);
+  WriteSparseBuckets(
+      row_ids, num_buckets, [&](size_t n, auto&& fn) { ParallelFor(context, n, sort_cost, fn); }, indices, values,
+      dense_shape);
 }
@@ -3,12 +3,104 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "ocos.h"
 #include "string_utils.h"
 
-void string_hash(const ortc::Tensor<std::string>& input,
+// The remainder of a 64-bit hash by a number of buckets fixed for a tensor, which is a mask for a power of 2 and
+// otherwise Lemire's fastmod, two multiplications in place of a division, where the compiler has 128-bit integers.
+class BucketModulo {
+ public:
+  explicit BucketModulo(uint64_t num_buckets) : divisor_{num_buckets} {
+    is_power_of_2_ = (divisor_ & (divisor_ - 1)) == 0;
+#ifdef __SIZEOF_INT128__
+    inverse_ = ~static_cast<unsigned __int128>(0) / divisor_ + 1;
+#endif
+  }
+
+  uint64_t operator()(uint64_t hash) const {
+    if (is_power_of_2_) {
+      return hash & (divisor_ - 1);
+    }
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 low_bits = inverse_ * hash;
+    const unsigned __int128 bottom = (static_cast<unsigned __int128>(static_cast<uint64_t>(low_bits)) * divisor_) >> 64;
+    const unsigned __int128 top = (low_bits >> 64) * divisor_;
+    return static_cast<uint64_t>((bottom + top) >> 64);
+#else
+    return hash % divisor_;
+#endif
+  }
+
+ private:
+  uint64_t divisor_;
+  bool is_power_of_2_{};
+#ifdef __SIZEOF_INT128__
+  unsigned __int128 inverse_{};
+#endif
+};
+
+// Writes the bucket ids of each row as a sparse COO tensor of [rows, num_buckets] for the linear and the
+// EmbeddingBag models, without the dense tensor of the counts: indices, [nnz, 2], the row and the bucket of each
+// value, sorted by the row and then the bucket, values, [nnz], the count of the bucket in the row, as the ids of
+// the same bucket in a row are accumulated, and dense_shape, [2]. The ids are sorted in place, on the rows of
+// parallel_for(rows, fn), which calls fn(begin, end) on the ranges of the rows.
+template <typename ParallelRows>
+void WriteSparseBuckets(std::vector<std::vector<int64_t>>& row_ids, int64_t num_buckets, ParallelRows&& parallel_for,
+                        ortc::Tensor<int64_t>& indices, ortc::Tensor<float>& values,
+                        ortc::Tensor<int64_t>& dense_shape) {
+  const size_t rows = row_ids.size();
+  std::vector<int64_t> row_begins(rows + 1, 0);
+  parallel_for(rows, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      auto& ids = row_ids[row];
+      std::sort(ids.begin(), ids.end());
+      int64_t distinct = 0;
+      for (size_t i = 0; i < ids.size(); ++i) {
+        distinct += i == 0 || ids[i] != ids[i - 1];
+      }
+      row_begins[row + 1] = distinct;
+    }
+  });
+  for (size_t row = 0; row < rows; ++row) {
+    row_begins[row + 1] += row_begins[row];
+  }
+
+  const int64_t nnz = row_begins[rows];
+  int64_t* p_indices = indices.Allocate({nnz, 2});
+  float* p_values = values.Allocate({nnz});
+  int64_t* p_shape = dense_shape.Allocate({2});
+  p_shape[0] = static_cast<int64_t>(rows);
+  p_shape[1] = num_buckets;
+  parallel_for(rows, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      const auto& ids = row_ids[row];
+      int64_t k = row_begins[row] - 1;
+      for (size_t i = 0; i < ids.size(); ++i) {
+        if (i == 0 || ids[i] != ids[i - 1]) {
+          ++k;
+          p_indices[2 * k] = static_cast<int64_t>(row);
+          p_indices[2 * k + 1] = ids[i];
+          p_values[k] = 0.0f;
+        }
+        p_values[k] += 1.0f;
+      }
+    }
+  });
+}
+
+void string_hash(const ortc::Tensor<std::string_view>& input,
                  int64_t num_buckets,
                  ortc::Tensor<int64_t>& output);
-void string_hash_fast(const ortc::Tensor<std::string>& input,
+void string_hash_fast(const ortc::Tensor<std::string_view>& input,
                       int64_t num_buckets,
                       ortc::Tensor<int64_t>& output);
+// The ids of StringToHashBucketFast as a sparse COO tensor of [rows, num_buckets] of the counts of the buckets of
+// each row, whose features are the strings of the last axis of the input, as WriteSparseBuckets writes them.
+void string_hash_fast_sparse(const ortc::Tensor<std::string_view>& input,
+                             int64_t num_buckets,
+                             ortc::Tensor<int64_t>& indices,
+                             ortc::Tensor<float>& values,
+                             ortc::Tensor<int64_t>& dense_shape);
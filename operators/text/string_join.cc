@@ -3,8 +3,11 @@
 
 #include "string_join.hpp"
 #include "string_tensor.h"
+#include "parallel_for.h"
 
-void string_join(const ortc::Tensor<std::string>& input_X,
+#include <cstring>
+
+void string_join(const ortc::Tensor<std::string_view>& input_X,
                  std::string_view input_sep,
                  int64_t axis,
                  ortc::Tensor<std::string>& output) {
@@ -32,7 +35,6 @@ void string_join(const ortc::Tensor<std::string>& input_X,
   }
 
   int64_t size = std::accumulate(dimensions_out.begin(), dimensions_out.end(), 1ULL, std::multiplies<int64_t>());
-  std::vector<std::string> out(static_cast<size_t>(size));
 
   if (dimensions.size() > 0) {
     if (X.size() > 0) {
@@ -45,26 +47,60 @@ void string_join(const ortc::Tensor<std::string>& input_X,
       int64_t right_part = size / left_part;
       int64_t n_red = dimensions[static_cast<size_t>(axis)] - 1;
       int64_t inc = right_part * (n_red + 1);
-      int64_t pos = 0;
-      for (int64_t li = 0; li < left_part; ++li) {
-        for (int64_t ri = 0; ri < right_part; ++ri, ++pos) {
-          std::ostringstream st;
-          int64_t index = ri + li * inc;
-          for (int64_t j = 0; j < n_red; ++j, index += h) {
-            st << X[static_cast<size_t>(index)] << input_sep;
+
+      // the sizes of the joined strings are computed first, so they're all written into one buffer of their exact
+      // size. the output pos is in the grid of [left_part, right_part], and its first input is at index.
+      const auto first_index = [&](size_t pos) {
+        return static_cast<int64_t>(pos) % right_part + static_cast<int64_t>(pos) / right_part * inc;
+      };
+
+      std::vector<size_t> sizes(static_cast<size_t>(size));
+      size_t total_chars = 0;
+      for (const auto& x : X) {
+        total_chars += x.size();
+      }
+
+      // the rough cycles of an output, of its pieces and their chars
+      const double pieces = static_cast<double>(n_red + 1);
+      const double cost = pieces * (16.0 + static_cast<double>(total_chars) / static_cast<double>(X.size()));
+      const auto& context = Ort::Custom::ComputeContext::Current();
+      ParallelFor(context, sizes.size(), pieces * 4.0, [&](size_t begin, size_t end) {
+        for (size_t pos = begin; pos < end; ++pos) {
+          int64_t index = first_index(pos);
+          size_t length = static_cast<size_t>(n_red) * input_sep.size();
+          for (int64_t j = 0; j <= n_red; ++j, index += h) {
+            length += X[static_cast<size_t>(index)].size();
           }
-          st << X[static_cast<size_t>(index)];
-          out[static_cast<size_t>(pos)] = st.str();
+          sizes[pos] = length;
         }
-      }
+      });
+
+      output.SetStringOutput(dimensions_out, sizes, [&](const std::vector<char*>& out) {
+        ParallelFor(context, sizes.size(), cost, [&](size_t begin, size_t end) {
+          for (size_t pos = begin; pos < end; ++pos) {
+            char* dst = out[pos];
+            int64_t index = first_index(pos);
+            for (int64_t j = 0; j < n_red; ++j, index += h) {
+              const auto& piece = X[static_cast<size_t>(index)];
+              std::memcpy(dst, piece.data(), piece.size());
+              dst += piece.size();
+              std::memcpy(dst, input_sep.data(), input_sep.size());
+              dst += input_sep.size();
+            }
+            const auto& piece = X[static_cast<size_t>(index)];
+            std::memcpy(dst, piece.data(), piece.size());
+          }
+        });
+      });
     } else {
       // for input 1 contains 0 elements, output joined string is empty string
-      out[0] = "";
+      output.SetStringOutput(dimensions_out, std::vector<size_t>(static_cast<size_t>(size)), [](const auto&) {});
     }
   } else {
     // for input 1 (scalar) which has 1 element, output joined string is input string itself. See issue: https://github.com/onnx/onnx/issues/3724
-    out[0] = X[0];
+    const std::string_view str = X[0];
+    output.SetStringOutput(dimensions_out, {str.size()}, [str](const std::vector<char*>& out) {
+      std::memcpy(out[0], str.data(), str.size());
+    });
   }
-
-  output.SetStringOutput(out, dimensions_out);
 }
@@ -6,7 +6,7 @@
 #include "ocos.h"
 #include "string_utils.h"
 
-void string_join(const ortc::Tensor<std::string>& input_X,
+void string_join(const ortc::Tensor<std::string_view>& input_X,
                  std::string_view input_sep,
                  int64_t axis,
                  ortc::Tensor<std::string>& output);
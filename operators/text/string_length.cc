@@ -4,12 +4,10 @@
 #include "string_length.hpp"
 #include "string_tensor.h"
 #include <vector>
-#include <locale>
-#include <codecvt>
 #include <algorithm>
 #include "ustring.h"
 
-void string_length(const ortc::Tensor<std::string>& input,
+void string_length(const ortc::Tensor<std::string_view>& input,
                    ortc::Tensor<int64_t>& output) {
   // Setup inputs
   auto& input_data = input.Data();
@@ -18,6 +16,6 @@ void string_length(const ortc::Tensor<std::string>& input,
   auto* output_data = output.Allocate(dimensions);
 
   for (int i = 0; i < input.NumberOfElement(); i++) {
-    output_data[i] = ustring(input_data[i]).size();
+    output_data[i] = static_cast<int64_t>(ustring::CountUTF8Chars(input_data[i]));
   }
 }
@@ -6,5 +6,5 @@
 #include "ocos.h"
 #include "string_utils.h"
 
-void string_length(const ortc::Tensor<std::string>& input,
+void string_length(const ortc::Tensor<std::string_view>& input,
                    ortc::Tensor<int64_t>& output);
@@ -9,20 +9,54 @@
 #include <algorithm>
 #include <iterator>
 
-void string_lower(const ortc::Tensor<std::string>& input,
+void string_lower(const ortc::Tensor<std::string_view>& input,
                   ortc::Tensor<std::string>& output) {
   const auto& input_strings = input.Data();
 
-  std::vector<std::string> output_strings;
-  output_strings.reserve(input_strings.size());
+  size_t total_size = 0;
+  for (std::string_view input_string : input_strings) {
+    total_size += input_string.size();
+  }
 
-  std::transform(input_strings.begin(), input_strings.end(), std::back_inserter(output_strings),
-                 [](const std::string& input_string) {
-                   ustring u32_input_string(input_string);
-                   std::transform(u32_input_string.begin(), u32_input_string.end(), u32_input_string.begin(),
-                                  [](char32_t c) { return ToLower(c); });
-                   return static_cast<std::string>(u32_input_string);
-                 });
+  ortc::StringTensorBuilder output_strings;
+  output_strings.Reserve(input_strings.size(), total_size);
+  std::string lower;
+  std::u32string decoded;
+  char utf8_buf[4];
+  for (std::string_view input_string : input_strings) {
+    // the ASCII runs are mapped in the UTF-8 bytes, and only the other runs are decoded. an ASCII byte is never a
+    // part of a multi-byte character, so the runs are decoded the same as the whole string.
+    const size_t size = input_string.size();
+    lower.resize(size);
+    size_t lower_size = 0;
+    for (size_t i = 0; i < size;) {
+      size_t ascii = ustring::LowerAsciiPrefix(input_string.data() + i, size - i, &lower[lower_size]);
+      i += ascii;
+      lower_size += ascii;
+
+      size_t end = i;
+      while (end < size && static_cast<unsigned char>(input_string[end]) >= 0x80) {
+        ++end;
+      }
+
+      if (end == i) {
+        continue;
+      }
+
+      ustring::DecodeUTF8(input_string.substr(i, end - i), decoded);
+      lower.resize(lower_size);
+      for (char32_t c : decoded) {
+        lower.append(utf8_buf, ustring::EncodeUTF8Char(utf8_buf, ToLower(c)));
+      }
+
+      lower_size = lower.size();
+      lower.resize(lower_size + size - end);
+      i = end;
+    }
+
+    lower.resize(lower_size);
+    output_strings.Append(lower);
+  }
 
   output.SetStringOutput(output_strings, input.Shape());
 }
@@ -6,5 +6,12 @@
 #include "ocos.h"
 #include "string_utils.h"
 
-void string_lower(const ortc::Tensor<std::string>& input,
+void string_lower(const ortc::Tensor<std::string_view>& input,
                   ortc::Tensor<std::string>& output);
+
+// The output of StringLower has the shape of the input.
+struct StringLowerTraits {
+  static void InferOutputShape(const ortc::ShapeInferContext& ctx) {
+    ctx.SetOutput(0, ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING, ctx.InputShape(0));
+  }
+};
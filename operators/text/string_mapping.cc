@@ -3,14 +3,19 @@
 
 #include "string_mapping.hpp"
 #include "string_tensor.h"
+#include "asset_attribute.h"
+#include <unordered_map>
 #include <vector>
-#include <locale>
-#include <codecvt>
-#include <algorithm>
 
 KernelStringMapping::KernelStringMapping(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
-  std::string map = ort_.KernelInfoGetAttribute<std::string>(&info, "map");
-  auto lines = SplitString(map, "\n", true);
+  ort_extensions::AssetBytes map = ort_extensions::GetAssetAttribute(*this, "map");
+  auto lines = SplitString(map.View(), "\n", true);
+
+  // the value of a key given more than once is its last one
+  std::vector<std::string_view> keys;
+  std::vector<std::string_view> values;
+  std::unordered_map<std::string_view, size_t> key_lines;
+  key_lines.reserve(lines.size());
   for (const auto& line : lines) {
     auto items = SplitString(line, "\t", true);
 
@@ -19,20 +24,52 @@ KernelStringMapping::KernelStringMapping(const OrtApi& api, const OrtKernelInfo&
           "[StringMapping]: Should only exist two items in one line, find error in line: " + std::string(line),
           ORT_INVALID_GRAPH);
     }
-    map_[std::string(items[0])] = std::string(items[1]);
+
+    auto [it, inserted] = key_lines.emplace(items[0], keys.size());
+    if (inserted) {
+      keys.push_back(items[0]);
+      values.push_back(items[1]);
+    } else {
+      values[it->second] = items[1];
+    }
+  }
+
+  const std::vector<size_t> indices = keys_.Build(keys);
+  std::vector<std::string_view> value_of_index(keys.size());
+  size_t value_bytes = 0;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    value_of_index[indices[i]] = values[i];
+    value_bytes += values[i].size();
+  }
+
+  values_.reserve(value_bytes);
+  value_offsets_.reserve(keys.size() + 1);
+  value_offsets_.push_back(0);
+  for (const auto& value : value_of_index) {
+    values_.append(value);
+    value_offsets_.push_back(values_.size());
   }
 }
 
-void KernelStringMapping::Compute(const ortc::Tensor<std::string>& input,
+void KernelStringMapping::Compute(const ortc::Tensor<std::string_view>& input,
                                   ortc::Tensor<std::string>& output) const {
-  // make a copy as input is constant
-  std::vector<std::string> input_data = input.Data();
+  auto& input_data = input.Data();
+  std::vector<std::string_view> mapped(input_data.size());
+  size_t num_chars = 0;
+  for (size_t i = 0; i < input_data.size(); ++i) {
+    const size_t index = keys_.Find(input_data[i]);
+    mapped[i] = index == StringPerfectHash::kNotFound
+                    ? input_data[i]
+                    : std::string_view(values_.data() + value_offsets_[index],
+                                       value_offsets_[index + 1] - value_offsets_[index]);
+    num_chars += mapped[i].size();
+  }
 
-  for (auto& str : input_data) {
-    auto entry = map_.find(str);
-    if (entry != map_.end()) {
-      str = entry->second;
-    }
+  ortc::StringTensorBuilder output_strings;
+  output_strings.Reserve(mapped.size(), num_chars);
+  for (const auto& str : mapped) {
+    output_strings.Append(str);
   }
-  output.SetStringOutput(input_data, input.Shape());
+
+  output.SetStringOutput(output_strings, input.Shape());
 }
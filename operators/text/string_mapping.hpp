@@ -5,13 +5,16 @@
 
 #include "ocos.h"
 #include "string_utils.h"
-#include <unordered_map>
+#include "perfect_hash.h"
 
 struct KernelStringMapping : BaseKernel {
   KernelStringMapping(const OrtApi& api, const OrtKernelInfo& info);
-  void Compute(const ortc::Tensor<std::string>& input,
+  void Compute(const ortc::Tensor<std::string_view>& input,
                ortc::Tensor<std::string>& output) const;
 
  private:
-  std::unordered_map<std::string, std::string> map_;
+  StringPerfectHash keys_;
+  // the values in the order of the indices of their keys
+  std::string values_;
+  std::vector<size_t> value_offsets_;
 };
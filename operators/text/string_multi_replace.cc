@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "string_multi_replace.hpp"
+#include "string_tensor.h"
+#include "asset_attribute.h"
+#include "parallel_for.h"
+#include "scratch_arena.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+void MultiReplacer::Build(const std::vector<std::pair<std::string_view, std::string_view>>& table) {
+  matcher_.Clear();
+  replacements_.clear();
+  std::unordered_map<std::string_view, size_t> pattern_index;
+  pattern_index.reserve(table.size());
+  for (const auto& [pattern, replacement] : table) {
+    if (pattern.empty()) {
+      ORTX_CXX_API_THROW("[StringMultiReplace]: the patterns shouldn't be empty.", ORT_INVALID_ARGUMENT);
+    }
+    auto [it, inserted] = pattern_index.emplace(pattern, replacements_.size());
+    if (inserted) {
+      matcher_.AddPattern(pattern);
+      replacements_.emplace_back(replacement);
+    } else {
+      replacements_[it->second] = std::string(replacement);
+    }
+  }
+  matcher_.Build();
+}
+
+size_t MultiReplacer::Find(std::string_view text, std::vector<Match>& matches) const {
+  matches.clear();
+  if (replacements_.empty()) {
+    return text.size();
+  }
+
+  // the occurrences are reported by their ends, so the longest pattern of each begin is kept until the scan is over
+  ScratchScope scratch;
+  ScratchVector<size_t> longest(text.size(), 0);  // the pattern + 1 of each begin, 0 for none
+  bool found = false;
+  matcher_.FindAll(text, [&](size_t pattern, size_t begin, size_t) {
+    found = true;
+    size_t& best = longest[begin];
+    if (best == 0 || matcher_.PatternLength(best - 1) < matcher_.PatternLength(pattern)) {
+      best = pattern + 1;
+    }
+  });
+  if (!found) {
+    return text.size();
+  }
+
+  size_t size = text.size();
+  for (size_t pos = 0; pos < text.size();) {
+    if (longest[pos] == 0) {
+      ++pos;
+      continue;
+    }
+    const size_t pattern = longest[pos] - 1;
+    matches.emplace_back(pos, pattern);
+    size = size - matcher_.PatternLength(pattern) + replacements_[pattern].size();
+    pos += matcher_.PatternLength(pattern);
+  }
+  return size;
+}
+
+void MultiReplacer::Write(std::string_view text, const std::vector<Match>& matches, char* output) const {
+  size_t pos = 0;
+  for (auto [begin, pattern] : matches) {
+    output = std::copy(text.begin() + pos, text.begin() + begin, output);
+    output = std::copy(replacements_[pattern].begin(), replacements_[pattern].end(), output);
+    pos = begin + matcher_.PatternLength(pattern);
+  }
+  std::copy(text.begin() + pos, text.end(), output);
+}
+
+std::string MultiReplacer::Replace(std::string_view text) const {
+  std::vector<Match> matches;
+  std::string result(Find(text, matches), '\0');
+  Write(text, matches, result.data());
+  return result;
+}
+
+KernelStringMultiReplace::KernelStringMultiReplace(const OrtApi& api, const OrtKernelInfo& info)
+    : BaseKernel(api, info) {
+  // a line of the map is a pattern, a tab and its replacement, which can be empty to remove the pattern
+  ort_extensions::AssetBytes map = ort_extensions::GetAssetAttribute(*this, "map");
+  std::vector<std::pair<std::string_view, std::string_view>> table;
+  for (std::string_view line : SplitString(map.View(), "\n", true)) {
+    const size_t tab = line.find('\t');
+    if (tab == std::string_view::npos) {
+      ORTX_CXX_API_THROW(MakeString("[StringMultiReplace]: a line of the map should be a pattern, a tab and its ",
+                                    "replacement, but it is: ", line),
+                         ORT_INVALID_GRAPH);
+    }
+    table.emplace_back(line.substr(0, tab), line.substr(tab + 1));
+  }
+  replacer_.Build(table);
+
+  num_threads_ = ReadNumThreadsAttribute(*this);
+}
+
+void KernelStringMultiReplace::Compute(const ortc::Tensor<std::string_view>& input,
+                                       ortc::Tensor<std::string>& output) const {
+  auto& input_data = input.Data();
+  const size_t rows = input_data.size();
+
+  // the occurrences of each row are found first, by which its replaced text is written straight into the output
+  std::vector<std::vector<MultiReplacer::Match>> matches(rows);
+  std::vector<size_t> sizes(rows);
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      sizes[row] = replacer_.Find(input_data[row], matches[row]);
+    }
+  });
+
+  output.SetStringOutput(input.Shape(), sizes, [&](const std::vector<char*>& buffers) {
+    ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+      for (size_t row = begin; row < end; ++row) {
+        replacer_.Write(input_data[row], matches[row], buffers[row]);
+      }
+    });
+  });
+}
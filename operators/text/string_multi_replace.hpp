@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "string_utils.h"
+#include "aho_corasick.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// The literal replacements of a table of patterns in one scan of a text, by an Aho-Corasick automaton of the
+// patterns. The longest pattern which starts at a position is replaced, and the scan goes on after it, so the
+// occurrences don't overlap and the ones on the left win.
+class MultiReplacer {
+ public:
+  // (begin, pattern) of an occurrence which is replaced
+  using Match = std::pair<size_t, size_t>;
+
+  // The patterns can't be empty, and a pattern given more than once has its last replacement.
+  void Build(const std::vector<std::pair<std::string_view, std::string_view>>& table);
+
+  bool Empty() const { return replacements_.empty(); }
+
+  // Finds the occurrences of the patterns in the text which are replaced, in their order, and returns the size of
+  // the replaced text.
+  size_t Find(std::string_view text, std::vector<Match>& matches) const;
+
+  // Writes the replaced text of the matches Find gave, of the size it returned.
+  void Write(std::string_view text, const std::vector<Match>& matches, char* output) const;
+
+  std::string Replace(std::string_view text) const;
+
+ private:
+  AhoCorasick<char> matcher_;
+  std::vector<std::string> replacements_;  // of the patterns of the matcher
+};
+
+struct KernelStringMultiReplace : BaseKernel {
+  KernelStringMultiReplace(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               ortc::Tensor<std::string>& output) const;
+
+ private:
+  MultiReplacer replacer_;
+  size_t num_threads_{1};
+};
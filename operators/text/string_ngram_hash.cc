@@ -0,0 +1,277 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "string_ngram_hash.hpp"
+#include "farmhash.h"
+#include "string_tensor.h"
+#include "parallel_for.h"
+#include "ragged_rows.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+// the start of the hashes of the character n-grams, so a char isn't hashed as the word of it
+constexpr uint64_t kCharNGramSeed = 0x8f3b5c2d6e1a4907ULL;
+
+inline uint64_t Combine(uint64_t hash, uint64_t next) { return util::Fingerprint(util::Uint128(hash, next)); }
+
+// The bytes of the UTF-8 char of a lead byte, in which a byte which doesn't lead a char is a char of its own.
+inline size_t Utf8CharLength(unsigned char lead) {
+  if (lead < 0xC0) {
+    return 1;
+  }
+  return lead < 0xE0 ? 2 : (lead < 0xF0 ? 3 : 4);
+}
+
+void ReadNGramRange(int64_t min, int64_t max, const char* name, size_t& out_min, size_t& out_max) {
+  if (max < 0 || (max > 0 && (min < 1 || min > max))) {
+    ORTX_CXX_API_THROW(MakeString("[StringNGramHash]: ", name, "_min and ", name, "_max must be 1 <= min <= max, ",
+                                  "or max 0 for none of the n-grams, but got ", min, " and ", max),
+                       ORT_INVALID_ARGUMENT);
+  }
+  out_min = static_cast<size_t>(min);
+  out_max = static_cast<size_t>(max);
+}
+}  // namespace
+
+// the words of a row and the units of the word of which the char n-grams are hashed, reused by the rows of a block
+struct KernelStringNGramHash::RowScratch {
+  std::vector<std::string_view> words;
+  std::vector<uint64_t> word_hashes;
+  std::vector<uint64_t> chars;
+};
+
+KernelStringNGramHash::KernelStringNGramHash(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  num_buckets_ = TryToGetAttributeWithDefault<int64_t>("num_buckets", 0);
+  if (num_buckets_ <= 0) {
+    ORTX_CXX_API_THROW(MakeString("[StringNGramHash]: num_buckets must be positive, but got ", num_buckets_),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  ReadNGramRange(TryToGetAttributeWithDefault<int64_t>("word_ngram_min", 1),
+                 TryToGetAttributeWithDefault<int64_t>("word_ngram_max", 1), "word_ngram",
+                 word_ngram_min_, word_ngram_max_);
+  ReadNGramRange(TryToGetAttributeWithDefault<int64_t>("char_ngram_min", 0),
+                 TryToGetAttributeWithDefault<int64_t>("char_ngram_max", 0), "char_ngram",
+                 char_ngram_min_, char_ngram_max_);
+  if (word_ngram_max_ == 0 && char_ngram_max_ == 0) {
+    ORTX_CXX_API_THROW("[StringNGramHash]: word_ngram_max or char_ngram_max must be positive.", ORT_INVALID_ARGUMENT);
+  }
+  char_boundaries_ = TryToGetAttributeWithDefault<int64_t>("char_ngram_boundaries", 1) != 0;
+
+  const std::string separators = TryToGetAttributeWithDefault<std::string>("separators", " \t\n\r");
+  for (char c : separators) {
+    is_separator_[static_cast<unsigned char>(c)] = true;
+  }
+
+  max_length_ = TryToGetAttributeWithDefault<int64_t>("max_length", 0);
+  if (max_length_ < 0) {
+    ORTX_CXX_API_THROW("[StringNGramHash]: max_length shouldn't be negative", ORT_INVALID_ARGUMENT);
+  }
+  padding_value_ = TryToGetAttributeWithDefault<int64_t>("padding_value", -1);
+
+  num_threads_ = ReadNumThreadsAttribute(*this);
+}
+
+// Calls emit(hash) on the word n-grams of the words of the row, by their first word and then their length, and then
+// on the char n-grams of each word, by their first char and then their length. The n-grams are only counted, with
+// no hash, if not kHash.
+template <bool kHash, typename Emit>
+void KernelStringNGramHash::ForEachNGram(RowScratch& scratch, Emit&& emit) const {
+  const auto& words = scratch.words;
+  if (word_ngram_max_ > 0) {
+    if constexpr (kHash) {
+      // the hash of a word is its fingerprint, so the unigrams are the ids of StringToHashBucketFast
+      scratch.word_hashes.resize(words.size());
+      for (size_t i = 0; i < words.size(); ++i) {
+        scratch.word_hashes[i] = util::Fingerprint64(words[i].data(), words[i].size());
+      }
+    }
+
+    for (size_t i = 0; i < words.size(); ++i) {
+      uint64_t hash = 0;
+      const size_t longest = std::min(word_ngram_max_, words.size() - i);
+      for (size_t n = 1; n <= longest; ++n) {
+        if constexpr (kHash) {
+          hash = n == 1 ? scratch.word_hashes[i] : Combine(hash, scratch.word_hashes[i + n - 1]);
+        }
+        if (n >= word_ngram_min_) {
+          emit(hash);
+        }
+      }
+    }
+  }
+
+  if (char_ngram_max_ == 0) {
+    return;
+  }
+
+  auto& chars = scratch.chars;
+  for (std::string_view word : words) {
+    // the chars are the bytes of their UTF-8, within the boundaries of the word '<' and '>' like in fastText
+    chars.clear();
+    if (char_boundaries_) {
+      chars.push_back('<');
+    }
+    for (size_t pos = 0; pos < word.size();) {
+      const size_t length = std::min(Utf8CharLength(static_cast<unsigned char>(word[pos])), word.size() - pos);
+      uint64_t unit = 0;
+      for (size_t j = 0; j < length; ++j) {
+        unit = (unit << 8) | static_cast<unsigned char>(word[pos + j]);
+      }
+      chars.push_back(unit);
+      pos += length;
+    }
+    if (char_boundaries_) {
+      chars.push_back('>');
+    }
+
+    for (size_t i = 0; i < chars.size(); ++i) {
+      uint64_t hash = kCharNGramSeed;
+      const size_t longest = std::min(char_ngram_max_, chars.size() - i);
+      for (size_t n = 1; n <= longest; ++n) {
+        if constexpr (kHash) {
+          hash = Combine(hash, chars[i + n - 1]);
+        }
+        // a boundary alone isn't an n-gram
+        const bool boundary = char_boundaries_ && n == 1 && (i == 0 || i + 1 == chars.size());
+        if (n >= char_ngram_min_ && !boundary) {
+          emit(hash);
+        }
+      }
+    }
+  }
+}
+
+size_t KernelStringNGramHash::CheckRows(const ortc::Tensor<std::string_view>& input,
+                                        std::optional<const ortc::Tensor<int64_t>*> row_splits,
+                                        const int64_t*& splits) const {
+  // the rows are the strings, or the tokens between the row splits
+  splits = nullptr;
+  if (!row_splits.has_value() || *row_splits == nullptr) {
+    return input.Data().size();
+  }
+
+  const auto& splits_tensor = **row_splits;
+  if (input.Shape().size() != 1 || splits_tensor.Shape().size() != 1 || splits_tensor.NumberOfElement() < 1) {
+    ORTX_CXX_API_THROW(MakeString("[StringNGramHash]: the tokens ", input.Shape(), " and row_splits ",
+                                  splits_tensor.Shape(), " must be 1D, and row_splits not empty."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  const ort_extensions::RowSplits checked("StringNGramHash", splits_tensor.Data(),
+                                          static_cast<size_t>(splits_tensor.NumberOfElement()), input.Data().size());
+  splits = splits_tensor.Data();
+  return checked.Rows();
+}
+
+void KernelStringNGramHash::LoadWords(const std::vector<std::string_view>& strings, const int64_t* splits, size_t row,
+                                      RowScratch& scratch) const {
+  auto& words = scratch.words;
+  words.clear();
+  if (splits != nullptr) {
+    words.assign(strings.begin() + splits[row], strings.begin() + splits[row + 1]);
+    return;
+  }
+
+  std::string_view str = strings[row];
+  size_t begin = 0;
+  for (size_t pos = 0; pos <= str.size(); ++pos) {
+    if (pos == str.size() || is_separator_[static_cast<unsigned char>(str[pos])]) {
+      if (pos > begin) {
+        words.push_back(str.substr(begin, pos - begin));
+      }
+      begin = pos + 1;
+    }
+  }
+}
+
+void KernelStringNGramHash::Compute(const ortc::Tensor<std::string_view>& input,
+                                    std::optional<const ortc::Tensor<int64_t>*> row_splits,
+                                    ortc::Tensor<int64_t>& ids,
+                                    ortc::Tensor<int64_t>& out_row_splits) const {
+  auto& strings = input.Data();
+  const int64_t* splits = nullptr;
+  const size_t rows = CheckRows(input, row_splits, splits);
+  const bool tokens = splits != nullptr;
+  const auto load_words = [&](size_t row, RowScratch& scratch) { LoadWords(strings, splits, row, scratch); };
+
+  // the n-grams of the rows are counted first, so the ids are allocated once and each row writes its part
+  const size_t limit = max_length_ > 0 ? static_cast<size_t>(max_length_) : SIZE_MAX;
+  std::vector<int64_t> row_begins(rows + 1);
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    RowScratch scratch;
+    for (size_t row = begin; row < end; ++row) {
+      load_words(row, scratch);
+      size_t count = 0;
+      ForEachNGram<false>(scratch, [&count](uint64_t) { ++count; });
+      row_begins[row + 1] = static_cast<int64_t>(std::min(count, limit));
+    }
+  });
+
+  for (size_t row = 0; row < rows; ++row) {
+    row_begins[row + 1] += row_begins[row];
+  }
+
+  int64_t* p_ids = nullptr;
+  if (max_length_ > 0) {
+    // the strings of any shape have the ids on a last axis, and the tokens of the rows the ids of a row each
+    std::vector<int64_t> shape = tokens ? std::vector<int64_t>{static_cast<int64_t>(rows)} : input.Shape();
+    shape.push_back(max_length_);
+    p_ids = ids.Allocate(shape);
+    std::fill(p_ids, p_ids + rows * limit, padding_value_);
+  } else {
+    p_ids = ids.Allocate({row_begins[rows]});
+  }
+
+  const BucketModulo modulo(static_cast<uint64_t>(num_buckets_));
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    RowScratch scratch;
+    for (size_t row = begin; row < end; ++row) {
+      load_words(row, scratch);
+      int64_t* out = p_ids + (max_length_ > 0 ? row * limit : static_cast<size_t>(row_begins[row]));
+      const size_t count = static_cast<size_t>(row_begins[row + 1] - row_begins[row]);
+      size_t i = 0;
+      ForEachNGram<true>(scratch, [&](uint64_t hash) {
+        if (i < count) {
+          out[i++] = static_cast<int64_t>(modulo(hash));
+        }
+      });
+    }
+  });
+
+  int64_t* p_splits = out_row_splits.Allocate({static_cast<int64_t>(rows + 1)});
+  std::copy(row_begins.begin(), row_begins.end(), p_splits);
+}
+
+void KernelStringNGramHashSparse::Compute(const ortc::Tensor<std::string_view>& input,
+                                          std::optional<const ortc::Tensor<int64_t>*> row_splits,
+                                          ortc::Tensor<int64_t>& indices,
+                                          ortc::Tensor<float>& values,
+                                          ortc::Tensor<int64_t>& dense_shape) const {
+  auto& strings = input.Data();
+  const int64_t* splits = nullptr;
+  const size_t rows = CheckRows(input, row_splits, splits);
+
+  // the first max_length n-grams of a row are its features, as they're the ids of StringNGramHash
+  const size_t limit = max_length_ > 0 ? static_cast<size_t>(max_length_) : SIZE_MAX;
+  const BucketModulo modulo(static_cast<uint64_t>(num_buckets_));
+  std::vector<std::vector<int64_t>> row_ids(rows);
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    RowScratch scratch;
+    for (size_t row = begin; row < end; ++row) {
+      LoadWords(strings, splits, row, scratch);
+      auto& ids = row_ids[row];
+      ForEachNGram<true>(scratch, [&](uint64_t hash) {
+        if (ids.size() < limit) {
+          ids.push_back(static_cast<int64_t>(modulo(hash)));
+        }
+      });
+    }
+  });
+
+  WriteSparseBuckets(
+      row_ids, num_buckets_, [this](size_t n, auto&& fn) { ParallelFor(n, num_threads_, fn); }, indices, values,
+      dense_shape);
+}
@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "ocos.h"
+#include "string_utils.h"
+#include "string_hash.hpp"
+
+// The hashed ids of the word n-grams and the character n-grams of the rows of the text, the features of the
+// fastText-like classifiers, which are either the strings split by the separators into their words, or the tokens
+// of the rows of row_splits. The hashes of the n-grams are composed by rolling over the farmhash fingerprints of
+// their words or the code points of their chars, so no n-gram is materialized as a string. The ids of the rows are
+// either ragged, by the row_splits of the output, or padded to max_length.
+struct KernelStringNGramHash : BaseKernel {
+  KernelStringNGramHash(const OrtApi& api, const OrtKernelInfo& info);
+
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               std::optional<const ortc::Tensor<int64_t>*> row_splits,
+               ortc::Tensor<int64_t>& ids,
+               ortc::Tensor<int64_t>& out_row_splits) const;
+
+ protected:
+  struct RowScratch;
+
+  // The count of the rows of the input, and the row splits of its tokens, which are null for the strings.
+  size_t CheckRows(const ortc::Tensor<std::string_view>& input,
+                   std::optional<const ortc::Tensor<int64_t>*> row_splits, const int64_t*& splits) const;
+  void LoadWords(const std::vector<std::string_view>& strings, const int64_t* splits, size_t row,
+                 RowScratch& scratch) const;
+
+  template <bool kHash, typename Emit>
+  void ForEachNGram(RowScratch& scratch, Emit&& emit) const;
+
+  int64_t num_buckets_{};
+  size_t word_ngram_min_{1};
+  size_t word_ngram_max_{1};
+  size_t char_ngram_min_{};
+  size_t char_ngram_max_{};
+  bool char_boundaries_{true};
+  std::array<bool, 256> is_separator_{};
+  int64_t max_length_{};
+  int64_t padding_value_{-1};
+  size_t num_threads_{1};
+};
+
+// The n-gram ids of StringNGramHash as the bag of them, a sparse COO tensor of [rows, num_buckets] of the counts
+// of the buckets in each row, for the linear and the EmbeddingBag models which sum the features of a row: no ids
+// are padded, and the ids of the same bucket in a row are one value.
+struct KernelStringNGramHashSparse : KernelStringNGramHash {
+  using KernelStringNGramHash::KernelStringNGramHash;
+
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               std::optional<const ortc::Tensor<int64_t>*> row_splits,
+               ortc::Tensor<int64_t>& indices,
+               ortc::Tensor<float>& values,
+               ortc::Tensor<int64_t>& dense_shape) const;
+};
@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "string_normalize.hpp"
+#include "string_tensor.h"
+#include "parallel_for.h"
+
+#include <algorithm>
+
+KernelStringNormalize::KernelStringNormalize(const OrtApi& api, const OrtKernelInfo& info)
+    : BaseKernel(api, info) {
+  const std::string form = TryToGetAttributeWithDefault<std::string>("form", "NFC");
+  if (!ParseNormalizationForm(form, form_)) {
+    ORTX_CXX_API_THROW(MakeString("[StringNormalize]: form should be NFC, NFD, NFKC or NFKD, but it is ", form),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  num_threads_ = ReadNumThreadsAttribute(*this);
+}
+
+void KernelStringNormalize::Compute(const ortc::Tensor<std::string_view>& input,
+                                    ortc::Tensor<std::string>& output) const {
+  auto& input_data = input.Data();
+  const size_t rows = input_data.size();
+
+  // the rows which pass the quick check are copied into the output as they are, and only the others are normalized
+  std::vector<std::string> normalized(rows);
+  std::vector<uint8_t> changed(rows, 0);
+  std::vector<size_t> sizes(rows);
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      std::string_view text = input_data[row];
+      if (NormalizedPrefixLength(text, form_) == text.size()) {
+        sizes[row] = text.size();
+      } else {
+        NormalizeUtf8(text, form_, normalized[row]);
+        changed[row] = 1;
+        sizes[row] = normalized[row].size();
+      }
+    }
+  });
+
+  output.SetStringOutput(input.Shape(), sizes, [&](const std::vector<char*>& buffers) {
+    ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+      for (size_t row = begin; row < end; ++row) {
+        std::string_view text = changed[row] ? std::string_view(normalized[row]) : input_data[row];
+        std::copy(text.begin(), text.end(), buffers[row]);
+      }
+    });
+  });
+}
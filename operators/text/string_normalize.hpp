@@ -0,0 +1,18 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "string_utils.h"
+#include "unicode_normalization.h"
+
+struct KernelStringNormalize : BaseKernel {
+  KernelStringNormalize(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               ortc::Tensor<std::string>& output) const;
+
+ private:
+  NormalizationForm form_{NormalizationForm::kNFC};
+  size_t num_threads_{1};
+};
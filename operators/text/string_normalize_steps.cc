@@ -0,0 +1,242 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "string_normalize_steps.hpp"
+#include "string_tensor.h"
+#include "ustring.h"
+#include "parallel_for.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+using Stage = KernelStringNormalizeSteps::Stage;
+
+Stage& CharsStage(std::vector<Stage>& stages) {
+  if (stages.empty() || stages.back().kind != Stage::Kind::kChars) {
+    Stage stage;
+    for (int c = 0; c < 128; ++c) {
+      stage.ascii_map[c] = static_cast<char>(c);
+    }
+    stages.push_back(std::move(stage));
+  }
+  return stages.back();
+}
+
+// One pass of the chars over the text. A run of whitespace is kept until the next char which isn't one, so it's
+// dropped at the ends by strip, and is one space by collapse_spaces.
+void ApplyChars(const Stage& stage, std::string_view text, std::string& out) {
+  out.clear();
+  out.reserve(text.size());
+  const bool spaces = stage.strip || stage.collapse_spaces;
+  size_t space_begin = std::string_view::npos;
+  size_t space_end = 0;
+  const auto flush_spaces = [&]() {
+    if (space_begin == std::string_view::npos) {
+      return;
+    }
+    if (stage.collapse_spaces) {
+      out.push_back(' ');
+    } else {
+      out.append(text.substr(space_begin, space_end - space_begin));
+    }
+    space_begin = std::string_view::npos;
+  };
+
+  char utf8_buf[4];
+  for (size_t i = 0; i < text.size();) {
+    const char byte = text[i];
+    size_t len = 1;
+    char32_t ch = static_cast<unsigned char>(byte);
+    if (ch >= 0x80) {
+      ch = ustring::DecodeUTF8Char(text, i, len);
+    }
+
+    if (spaces && (ch < 0x80 ? ustring::IsAsciiSpace(byte) : IsSpace(ch))) {
+      if (space_begin == std::string_view::npos) {
+        space_begin = i;
+      }
+      space_end = i + len;
+      i += len;
+      continue;
+    }
+
+    if (space_begin != std::string_view::npos && (!out.empty() || !stage.strip)) {
+      flush_spaces();
+    }
+    space_begin = std::string_view::npos;
+
+    if (ch < 0x80) {
+      out.push_back(stage.ascii_map[static_cast<size_t>(ch)]);
+    } else if (stage.lower_non_ascii) {
+      const char32_t lower = ToLower(ch);
+      if (lower < 0x80) {
+        out.push_back(stage.ascii_map[static_cast<size_t>(lower)]);
+      } else {
+        out.append(utf8_buf, ustring::EncodeUTF8Char(utf8_buf, lower));
+      }
+    } else {
+      out.append(text.substr(i, len));  // an ill-formed sequence stays as it is
+    }
+    i += len;
+  }
+
+  if (!stage.strip) {
+    flush_spaces();
+  }
+}
+
+}  // namespace
+
+std::vector<Stage> KernelStringNormalizeSteps::ParseSteps(std::string_view steps) {
+  std::vector<Stage> stages;
+  size_t line_number = 0;
+  for (size_t pos = 0; pos < steps.size();) {
+    size_t end = steps.find('\n', pos);
+    if (end == std::string_view::npos) {
+      end = steps.size();
+    }
+    std::string_view line = steps.substr(pos, end - pos);
+    pos = end + 1;
+    ++line_number;
+    if (!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+    }
+    if (line.empty()) {
+      continue;
+    }
+
+    std::vector<std::string_view> fields;
+    for (size_t field = 0;;) {
+      const size_t tab = line.find('\t', field);
+      fields.push_back(line.substr(field, tab == std::string_view::npos ? std::string_view::npos : tab - field));
+      if (tab == std::string_view::npos) {
+        break;
+      }
+      field = tab + 1;
+    }
+
+    const std::string_view name = fields[0];
+    const size_t arguments = name == "normalize" ? 1 : (name == "replace" ? 2 : 0);
+    if (fields.size() != arguments + 1) {
+      ORTX_CXX_API_THROW(MakeString("[StringNormalizeSteps]: the step '", name, "' in line ", line_number,
+                                    " takes ", arguments, " arguments after a tab, but has ", fields.size() - 1, "."),
+                         ORT_INVALID_ARGUMENT);
+    }
+
+    if (name == "lower" || name == "upper") {
+      Stage& stage = CharsStage(stages);
+      const bool upper = name == "upper";
+      for (char& c : stage.ascii_map) {
+        if (!upper && c >= 'A' && c <= 'Z') {
+          c = static_cast<char>(c - 'A' + 'a');
+        } else if (upper && c >= 'a' && c <= 'z') {
+          c = static_cast<char>(c - 'a' + 'A');
+        }
+      }
+      stage.lower_non_ascii = stage.lower_non_ascii || !upper;  // only the ASCII letters are upper cased
+    } else if (name == "strip") {
+      CharsStage(stages).strip = true;
+    } else if (name == "collapse_spaces") {
+      CharsStage(stages).collapse_spaces = true;
+    } else if (name == "normalize") {
+      Stage stage;
+      stage.kind = Stage::Kind::kNormalize;
+      if (!ParseNormalizationForm(fields[1], stage.form)) {
+        ORTX_CXX_API_THROW(MakeString("[StringNormalizeSteps]: the form in line ", line_number,
+                                      " should be NFC, NFD, NFKC or NFKD, but it is ", fields[1], "."),
+                           ORT_INVALID_ARGUMENT);
+      }
+      stages.push_back(std::move(stage));
+    } else if (name == "replace") {
+      Stage stage;
+      stage.kind = Stage::Kind::kReplace;
+      try {
+        stage.regex = std::make_shared<const std::regex>(fields[1].begin(), fields[1].end(),
+                                                         std::regex_constants::ECMAScript);
+      } catch (const std::regex_error& e) {
+        ORTX_CXX_API_THROW(MakeString("[StringNormalizeSteps]: the pattern in line ", line_number, " is invalid, ",
+                                      e.what()),
+                           ORT_INVALID_ARGUMENT);
+      }
+      stage.rewrite = std::string(fields[2]);
+      stages.push_back(std::move(stage));
+    } else {
+      ORTX_CXX_API_THROW(MakeString("[StringNormalizeSteps]: unknown step '", name, "' in line ", line_number,
+                                    ", which should be strip, lower, upper, collapse_spaces, normalize or replace."),
+                         ORT_INVALID_ARGUMENT);
+    }
+  }
+  return stages;
+}
+
+std::string_view KernelStringNormalizeSteps::Apply(const std::vector<Stage>& stages, std::string_view text,
+                                                   std::string buffers[2]) {
+  // the result of a stage is in the buffer which the text of the stage isn't in
+  int current = -1;
+  for (const Stage& stage : stages) {
+    std::string& out = buffers[current == 0 ? 1 : 0];
+    switch (stage.kind) {
+      case Stage::Kind::kChars:
+        ApplyChars(stage, text, out);
+        break;
+      case Stage::Kind::kNormalize:
+        if (NormalizedPrefixLength(text, stage.form) == text.size()) {
+          continue;  // most texts are normalized already
+        }
+        NormalizeUtf8(text, stage.form, out);
+        break;
+      case Stage::Kind::kReplace:
+        out.clear();
+        std::regex_replace(std::back_inserter(out), text.begin(), text.end(), *stage.regex, stage.rewrite);
+        break;
+    }
+    current = current == 0 ? 1 : 0;
+    text = out;
+  }
+  return text;
+}
+
+KernelStringNormalizeSteps::KernelStringNormalizeSteps(const OrtApi& api, const OrtKernelInfo& info)
+    : BaseKernel(api, info) {
+  const std::string steps = TryToGetAttributeWithDefault<std::string>("steps", "");
+  stages_ = ParseSteps(steps);
+  if (stages_.empty()) {
+    ORTX_CXX_API_THROW("[StringNormalizeSteps]: steps should have at least one step.", ORT_INVALID_ARGUMENT);
+  }
+
+  num_threads_ = ReadNumThreadsAttribute(*this);
+}
+
+void KernelStringNormalizeSteps::Compute(const ortc::Tensor<std::string_view>& input,
+                                         ortc::Tensor<std::string>& output) const {
+  auto& input_data = input.Data();
+  const size_t rows = input_data.size();
+
+  // the rows which the steps don't change are copied into the output from the input, and only the others are kept
+  std::vector<std::string> normalized(rows);
+  std::vector<uint8_t> changed(rows, 0);
+  std::vector<size_t> sizes(rows);
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    std::string buffers[2];
+    for (size_t row = begin; row < end; ++row) {
+      const std::string_view text = input_data[row];
+      const std::string_view result = Apply(stages_, text, buffers);
+      sizes[row] = result.size();
+      if (result != text) {
+        normalized[row].assign(result.data(), result.size());
+        changed[row] = 1;
+      }
+    }
+  });
+
+  output.SetStringOutput(input.Shape(), sizes, [&](const std::vector<char*>& buffers) {
+    ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+      for (size_t row = begin; row < end; ++row) {
+        std::string_view text = changed[row] ? std::string_view(normalized[row]) : input_data[row];
+        std::copy(text.begin(), text.end(), buffers[row]);
+      }
+    });
+  });
+}
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <memory>
+#include <regex>
+
+#include "ocos.h"
+#include "string_utils.h"
+#include "unicode_normalization.h"
+
+// The normalization of the strings by an ordered list of steps, in place of a chain of the StringStrip, StringLower,
+// StringUpper, StringECMARegexReplace and StringNormalize nodes, each of which reads and writes the whole batch.
+// The steps are compiled once into stages: a run of the steps of the chars, the case maps, the strip and the
+// collapse of the whitespace, is one pass over a string, and a Unicode normalization or a regex replacement is a pass
+// of its own, between two buffers which a thread reuses for all its rows. The rows are normalized in parallel.
+struct KernelStringNormalizeSteps : BaseKernel {
+  KernelStringNormalizeSteps(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               ortc::Tensor<std::string>& output) const;
+
+  struct Stage {
+    enum class Kind { kChars, kNormalize, kReplace };
+    Kind kind{Kind::kChars};
+
+    // the chars: the map of the ASCII bytes of the case maps, and the whitespace, ASCII or Unicode
+    char ascii_map[128]{};
+    bool lower_non_ascii{};
+    bool strip{};
+    bool collapse_spaces{};
+
+    NormalizationForm form{NormalizationForm::kNFC};
+
+    std::shared_ptr<const std::regex> regex;
+    std::string rewrite;
+  };
+
+  // Parses the steps, a line of each: strip, lower, upper, collapse_spaces, normalize and the form, or replace, the
+  // ECMAScript pattern and the rewrite of it, separated by tabs.
+  static std::vector<Stage> ParseSteps(std::string_view steps);
+
+  // Applies the stages to the text, into the two buffers, and returns the result, in one of the buffers, or the text
+  // itself if it's only normalized by stages which find it normalized already.
+  static std::string_view Apply(const std::vector<Stage>& stages, std::string_view text, std::string buffers[2]);
+
+ private:
+  std::vector<Stage> stages_;
+  size_t num_threads_{1};
+};
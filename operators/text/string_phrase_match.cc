@@ -0,0 +1,298 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "string_phrase_match.hpp"
+#include "string_tensor.h"
+#include "asset_attribute.h"
+#include "parallel_for.h"
+#include "scratch_arena.h"
+#include "ustring.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <tuple>
+
+namespace {
+// Writes the text folded to lower case into lower, in which the ASCII runs are mapped in their bytes like in
+// StringLower, and only the other chars are decoded. offsets is left empty if every folded char has the bytes of
+// its char, so the offsets in lower are the ones in the text, and otherwise it has the offset in the text of each
+// byte of lower and the size of the text at its end.
+template <typename Chars, typename Offsets>
+void FoldCase(std::string_view text, Chars& lower, Offsets& offsets) {
+  const size_t size = text.size();
+  lower.resize(size);
+  offsets.clear();
+  bool mapped = false;
+  size_t lower_size = 0;
+  char utf8[4];
+  for (size_t i = 0; i < size;) {
+    const size_t ascii = ustring::LowerAsciiPrefix(text.data() + i, size - i, lower.data() + lower_size);
+    if (mapped) {
+      for (size_t k = 0; k < ascii; ++k) {
+        offsets.push_back(i + k);
+      }
+    }
+    i += ascii;
+    lower_size += ascii;
+    if (i == size) {
+      break;
+    }
+
+    size_t length = 0;
+    const char32_t folded = ToLower(ustring::DecodeUTF8Char(text, i, length));
+    const size_t folded_length = ustring::EncodeUTF8Char(utf8, folded);
+    if (folded_length != length && !mapped) {
+      // the chars before are of the same offsets
+      mapped = true;
+      offsets.resize(lower_size);
+      std::iota(offsets.begin(), offsets.end(), size_t{0});
+    }
+    if (lower.size() < lower_size + folded_length + size - i - length) {
+      lower.resize(lower_size + folded_length + size - i - length);
+    }
+    std::copy(utf8, utf8 + folded_length, lower.data() + lower_size);
+    if (mapped) {
+      offsets.insert(offsets.end(), folded_length, i);
+    }
+    lower_size += folded_length;
+    i += length;
+  }
+
+  lower.resize(lower_size);
+  if (mapped) {
+    offsets.push_back(size);
+  }
+}
+
+// Calls fn(begin, end) on the words of the text, which are split by the separators, with no empty word.
+template <typename Fn>
+void ForEachWord(std::string_view text, const std::array<bool, 256>& is_separator, Fn&& fn) {
+  size_t begin = 0;
+  for (size_t pos = 0; pos <= text.size(); ++pos) {
+    if (pos == text.size() || is_separator[static_cast<unsigned char>(text[pos])]) {
+      if (pos > begin) {
+        fn(begin, pos);
+      }
+      begin = pos + 1;
+    }
+  }
+}
+
+// the id of a word of a text which isn't a word of any phrase, which no edge of the automaton has
+constexpr char32_t kUnknownWord = 0xFFFFFFFF;
+}  // namespace
+
+void PhraseMatcher::Build(const std::vector<std::pair<std::string_view, int64_t>>& phrases, const Options& options) {
+  options_ = options;
+  is_separator_.fill(false);
+  for (char c : options_.separators) {
+    is_separator_[static_cast<unsigned char>(c)] = true;
+  }
+  char_matcher_.Clear();
+  token_matcher_.Clear();
+  words_.clear();
+  word_ids_.clear();
+  entities_.clear();
+
+  // the patterns by their folded chars, or the ids of their words of the token level
+  std::unordered_map<std::string, size_t> pattern_index;
+  pattern_index.reserve(phrases.size());
+  std::string folded;
+  std::vector<size_t> offsets;
+  std::u32string tokens;
+  for (const auto& [phrase, entity] : phrases) {
+    std::string_view text = phrase;
+    if (options_.case_insensitive) {
+      FoldCase(phrase, folded, offsets);
+      text = folded;
+    }
+
+    std::string key;
+    if (options_.token_level) {
+      tokens.clear();
+      ForEachWord(text, is_separator_, [&](size_t begin, size_t end) {
+        const std::string_view word = text.substr(begin, end - begin);
+        auto it = word_ids_.find(word);
+        if (it == word_ids_.end()) {
+          words_.emplace_back(word);
+          it = word_ids_.emplace(words_.back(), static_cast<char32_t>(words_.size() - 1)).first;
+        }
+        tokens.push_back(it->second);
+      });
+      key.assign(reinterpret_cast<const char*>(tokens.data()), tokens.size() * sizeof(char32_t));
+    } else {
+      key.assign(text);
+    }
+
+    if (key.empty()) {
+      ORTX_CXX_API_THROW("[StringPhraseMatch]: the phrases shouldn't be empty.", ORT_INVALID_ARGUMENT);
+    }
+    auto [it, inserted] = pattern_index.emplace(std::move(key), entities_.size());
+    if (inserted) {
+      if (options_.token_level) {
+        token_matcher_.AddPattern(tokens);
+      } else {
+        char_matcher_.AddPattern(text);
+      }
+      entities_.push_back(entity);
+    } else {
+      entities_[it->second] = entity;
+    }
+  }
+
+  char_matcher_.Build();
+  token_matcher_.Build();
+}
+
+// Calls to_span(pattern, begin, end) on the occurrences find_all gives in a text of the units, the bytes or the
+// words, which are the leftmost longest ones which don't overlap, or all of them, by their begin and their end.
+template <typename FindAll, typename ToSpan>
+void PhraseMatcher::Select(size_t units, FindAll&& find_all, ToSpan&& to_span) const {
+  if (!options_.longest) {
+    ScratchVector<std::tuple<size_t, size_t, size_t>> matches;
+    find_all([&](size_t pattern, size_t begin, size_t end) { matches.emplace_back(begin, end, pattern); });
+    std::sort(matches.begin(), matches.end());
+    for (const auto& [begin, end, pattern] : matches) {
+      to_span(pattern, begin, end);
+    }
+    return;
+  }
+
+  // the occurrences are reported by their ends, so the longest one of each begin is kept until the scan is over
+  ScratchVector<std::pair<size_t, size_t>> longest(units, {0, 0});  // the end and the pattern + 1 of each begin
+  bool found = false;
+  find_all([&](size_t pattern, size_t begin, size_t end) {
+    found = true;
+    auto& best = longest[begin];
+    if (best.second == 0 || best.first < end) {
+      best = {end, pattern + 1};
+    }
+  });
+  if (!found) {
+    return;
+  }
+
+  for (size_t pos = 0; pos < units;) {
+    const auto [end, pattern] = longest[pos];
+    if (pattern == 0) {
+      ++pos;
+      continue;
+    }
+    to_span(pattern - 1, pos, end);
+    pos = end;
+  }
+}
+
+void PhraseMatcher::Find(std::string_view text, std::vector<Span>& spans) const {
+  spans.clear();
+  if (entities_.empty()) {
+    return;
+  }
+
+  ScratchScope scratch;
+  ScratchVector<char> lower;
+  ScratchVector<size_t> offsets;
+  std::string_view folded = text;
+  if (options_.case_insensitive) {
+    FoldCase(text, lower, offsets);
+    folded = std::string_view(lower.data(), lower.size());
+  }
+  const auto offset = [&offsets](size_t pos) { return offsets.empty() ? pos : offsets[pos]; };
+
+  if (!options_.token_level) {
+    Select(
+        folded.size(), [&](auto&& on_match) { char_matcher_.FindAll(folded, on_match); },
+        [&](size_t pattern, size_t begin, size_t end) {
+          spans.push_back({offset(begin), offset(end), entities_[pattern]});
+        });
+    return;
+  }
+
+  ScratchVector<std::pair<size_t, size_t>> words;
+  ScratchVector<char32_t> ids;
+  ForEachWord(folded, is_separator_, [&](size_t begin, size_t end) {
+    words.emplace_back(begin, end);
+    auto it = word_ids_.find(folded.substr(begin, end - begin));
+    ids.push_back(it == word_ids_.end() ? kUnknownWord : it->second);
+  });
+  Select(
+      ids.size(), [&](auto&& on_match) { token_matcher_.FindAll({ids.data(), ids.size()}, on_match); },
+      [&](size_t pattern, size_t begin, size_t end) {
+        spans.push_back({offset(words[begin].first), offset(words[end - 1].second), entities_[pattern]});
+      });
+}
+
+KernelStringPhraseMatch::KernelStringPhraseMatch(const OrtApi& api, const OrtKernelInfo& info)
+    : BaseKernel(api, info) {
+  // a line of the phrases is a phrase, and a tab and its entity id, or the phrase alone of the id of its line
+  ort_extensions::AssetBytes asset = ort_extensions::GetAssetAttribute(*this, "phrases");
+  std::vector<std::pair<std::string_view, int64_t>> phrases;
+  for (std::string_view line : SplitString(asset.View(), "\n", true)) {
+    const size_t tab = line.find('\t');
+    int64_t entity = static_cast<int64_t>(phrases.size());
+    if (tab != std::string_view::npos) {
+      const std::string id(line.substr(tab + 1));
+      char* end = nullptr;
+      entity = std::strtoll(id.c_str(), &end, 10);
+      if (id.empty() || *end != '\0') {
+        ORTX_CXX_API_THROW(MakeString("[StringPhraseMatch]: a line of the phrases should be a phrase, and a tab and ",
+                                      "its entity id, but it is: ", line),
+                           ORT_INVALID_GRAPH);
+      }
+    }
+    phrases.emplace_back(line.substr(0, tab), entity);
+  }
+
+  PhraseMatcher::Options options;
+  const std::string level = TryToGetAttributeWithDefault<std::string>("level", "char");
+  if (level != "char" && level != "token") {
+    ORTX_CXX_API_THROW(MakeString("[StringPhraseMatch]: level should be char or token, but got ", level),
+                       ORT_INVALID_ARGUMENT);
+  }
+  options.token_level = level == "token";
+  const std::string mode = TryToGetAttributeWithDefault<std::string>("mode", "longest");
+  if (mode != "longest" && mode != "all") {
+    ORTX_CXX_API_THROW(MakeString("[StringPhraseMatch]: mode should be longest or all, but got ", mode),
+                       ORT_INVALID_ARGUMENT);
+  }
+  options.longest = mode == "longest";
+  options.case_insensitive = TryToGetAttributeWithDefault<int64_t>("case_insensitive", 0) != 0;
+  options.separators = TryToGetAttributeWithDefault<std::string>("separators", options.separators);
+  matcher_.Build(phrases, options);
+
+  num_threads_ = ReadNumThreadsAttribute(*this);
+}
+
+void KernelStringPhraseMatch::Compute(const ortc::Tensor<std::string_view>& input,
+                                      ortc::Tensor<int64_t>& spans,
+                                      ortc::Tensor<int64_t>& row_splits) const {
+  auto& input_data = input.Data();
+  const size_t rows = input_data.size();
+
+  // the occurrences of each row are found first, by which the spans are allocated once
+  std::vector<std::vector<PhraseMatcher::Span>> matches(rows);
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      matcher_.Find(input_data[row], matches[row]);
+    }
+  });
+
+  int64_t* p_splits = row_splits.Allocate({static_cast<int64_t>(rows + 1)});
+  p_splits[0] = 0;
+  for (size_t row = 0; row < rows; ++row) {
+    p_splits[row + 1] = p_splits[row] + static_cast<int64_t>(matches[row].size());
+  }
+
+  int64_t* p_spans = spans.Allocate({p_splits[rows], 3});
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      int64_t* out = p_spans + 3 * p_splits[row];
+      for (const auto& span : matches[row]) {
+        *out++ = static_cast<int64_t>(span.begin);
+        *out++ = static_cast<int64_t>(span.end);
+        *out++ = span.entity;
+      }
+    }
+  });
+}
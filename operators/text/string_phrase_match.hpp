@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "string_utils.h"
+#include "aho_corasick.h"
+
+#include <array>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// The occurrences of a dictionary of phrases, like the names of the entities of a gazetteer, in one scan of a text,
+// by an Aho-Corasick automaton of the phrases, which is of their chars, or of their words for the phrases which
+// match whole words only. The phrases and the texts can be folded to lower case, by the ASCII runs of StringLower.
+class PhraseMatcher {
+ public:
+  struct Span {
+    size_t begin;  // the offsets of the bytes of the occurrence in the text
+    size_t end;
+    int64_t entity;
+  };
+
+  struct Options {
+    bool token_level{};
+    bool case_insensitive{};
+    bool longest{true};  // the leftmost longest occurrences which don't overlap, or all of them
+    std::string separators{" \t\n\r"};  // of the words of the token level
+  };
+
+  // The phrases can't be empty, and a phrase given more than once, or once folded, has its last entity.
+  void Build(const std::vector<std::pair<std::string_view, int64_t>>& phrases, const Options& options);
+
+  // Finds the occurrences of the phrases in the text, ordered by their begin and then their end.
+  void Find(std::string_view text, std::vector<Span>& spans) const;
+
+ private:
+  template <typename FindAll, typename ToSpan>
+  void Select(size_t units, FindAll&& find_all, ToSpan&& to_span) const;
+
+  Options options_;
+  std::array<bool, 256> is_separator_{};
+  AhoCorasick<char> char_matcher_;
+  // the ids of the words of the phrases, which are the chars of the automaton of the token level
+  AhoCorasick<char32_t> token_matcher_;
+  std::deque<std::string> words_;
+  std::unordered_map<std::string_view, char32_t> word_ids_;
+  std::vector<int64_t> entities_;  // of the patterns
+};
+
+struct KernelStringPhraseMatch : BaseKernel {
+  KernelStringPhraseMatch(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               ortc::Tensor<int64_t>& spans,
+               ortc::Tensor<int64_t>& row_splits) const;
+
+ private:
+  PhraseMatcher matcher_;
+  size_t num_threads_{1};
+};
@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "string_slice.hpp"
+#include "string_tensor.h"
+#include "parallel_for.h"
+
+#include <cstring>
+
+KernelStringSliceWithOffsets::KernelStringSliceWithOffsets(const OrtApi& api, const OrtKernelInfo& info)
+    : BaseKernel(api, info) {
+  num_threads_ = ReadNumThreadsAttribute(*this);
+}
+
+void KernelStringSliceWithOffsets::Compute(const ortc::Tensor<std::string_view>& input,
+                                           const ortc::Tensor<int64_t>& begins,
+                                           const ortc::Tensor<int64_t>& ends,
+                                           const ortc::Tensor<int64_t>& row_indices,
+                                           ortc::Tensor<std::string>& output) const {
+  auto& texts = input.Data();
+  const size_t rows = texts.size();
+  const size_t num_tokens = static_cast<size_t>(begins.NumberOfElement());
+  if (static_cast<size_t>(ends.NumberOfElement()) != num_tokens) {
+    ORTX_CXX_API_THROW(MakeString("[StringSliceWithOffsets]: begins and ends should have the same size, but they have ",
+                                  num_tokens, " and ", ends.NumberOfElement(), " values."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  if (static_cast<size_t>(row_indices.NumberOfElement()) != rows + 1) {
+    ORTX_CXX_API_THROW(MakeString("[StringSliceWithOffsets]: row_indices should have the ", rows + 1,
+                                  " values of the rows and the end, but it has ", row_indices.NumberOfElement(), "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  const int64_t* p_begins = begins.Data();
+  const int64_t* p_ends = ends.Data();
+  const int64_t* p_rows = row_indices.Data();
+  if (p_rows[0] != 0 || p_rows[rows] != static_cast<int64_t>(num_tokens)) {
+    ORTX_CXX_API_THROW("[StringSliceWithOffsets]: row_indices should begin at 0 and end at the number of the tokens.",
+                       ORT_INVALID_ARGUMENT);
+  }
+  for (size_t row = 0; row < rows; ++row) {
+    if (p_rows[row] > p_rows[row + 1]) {
+      ORTX_CXX_API_THROW("[StringSliceWithOffsets]: row_indices should be non-decreasing.", ORT_INVALID_ARGUMENT);
+    }
+    const int64_t length = static_cast<int64_t>(texts[row].size());
+    for (int64_t i = p_rows[row]; i < p_rows[row + 1]; ++i) {
+      if (p_begins[i] < 0 || p_begins[i] > p_ends[i] || p_ends[i] > length) {
+        ORTX_CXX_API_THROW(MakeString("[StringSliceWithOffsets]: the token ", i, " [", p_begins[i], ", ", p_ends[i],
+                                      ") is out of its row ", row, " of the length ", length, "."),
+                           ORT_INVALID_ARGUMENT);
+      }
+    }
+  }
+
+  std::vector<size_t> sizes(num_tokens);
+  for (size_t i = 0; i < num_tokens; ++i) {
+    sizes[i] = static_cast<size_t>(p_ends[i] - p_begins[i]);
+  }
+  output.SetStringOutput({static_cast<int64_t>(num_tokens)}, sizes, [&](const std::vector<char*>& words) {
+    ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+      for (size_t row = begin; row < end; ++row) {
+        for (int64_t i = p_rows[row]; i < p_rows[row + 1]; ++i) {
+          memcpy(words[i], texts[row].data() + p_begins[i], sizes[i]);
+        }
+      }
+    });
+  });
+}
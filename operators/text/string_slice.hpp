@@ -0,0 +1,21 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "string_utils.h"
+
+// Slices the tokens of the rows of the texts by their offsets, which are the begins, the ends and the row indices
+// of StringRegexSplitWithOffsets with offsets_only, so the tokens are only copied once where they're needed.
+struct KernelStringSliceWithOffsets : BaseKernel {
+  KernelStringSliceWithOffsets(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               const ortc::Tensor<int64_t>& begins,
+               const ortc::Tensor<int64_t>& ends,
+               const ortc::Tensor<int64_t>& row_indices,
+               ortc::Tensor<std::string>& output) const;
+
+ private:
+  size_t num_threads_{1};
+};
@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "string_sort.hpp"
+#include "string_tensor.h"
+#include "parallel_for.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+KernelStringSort::KernelStringSort(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  descending_ = TryToGetAttributeWithDefault<int64_t>("descending", 0) != 0;
+  num_threads_ = ReadNumThreadsAttribute(*this);
+}
+
+void KernelStringSort::Compute(const ortc::Tensor<std::string_view>& input,
+                               ortc::Tensor<std::string>& output,
+                               ortc::Tensor<int64_t>& indices) const {
+  auto& strings = input.Data();
+  const auto& shape = input.Shape();
+  const size_t total = strings.size();
+  // a scalar is a row of one string
+  const size_t width = shape.empty() ? 1 : static_cast<size_t>(shape.back());
+  const size_t rows = width == 0 ? 0 : total / width;
+
+  // the strings are sorted by their indices in the row, and the sorted views are copied into the output
+  int64_t* p_indices = indices.Allocate(shape);
+  std::vector<size_t> sizes(total);
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    std::vector<int64_t> order(width);
+    for (size_t row = begin; row < end; ++row) {
+      const std::string_view* values = strings.data() + row * width;
+      std::iota(order.begin(), order.end(), int64_t{0});
+      if (descending_) {
+        std::stable_sort(order.begin(), order.end(), [values](int64_t lhs, int64_t rhs) {
+          return values[rhs] < values[lhs];
+        });
+      } else {
+        std::stable_sort(order.begin(), order.end(), [values](int64_t lhs, int64_t rhs) {
+          return values[lhs] < values[rhs];
+        });
+      }
+
+      int64_t* out = p_indices + row * width;
+      for (size_t i = 0; i < width; ++i) {
+        out[i] = order[i];
+        sizes[row * width + i] = values[order[i]].size();
+      }
+    }
+  });
+
+  output.SetStringOutput(shape, sizes, [&](const std::vector<char*>& buffers) {
+    ParallelFor(total, num_threads_, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        const std::string_view value = strings[i - i % width + static_cast<size_t>(p_indices[i])];
+        memcpy(buffers[i], value.data(), value.size());
+      }
+    });
+  });
+}
@@ -0,0 +1,21 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "string_utils.h"
+
+// Sorts the strings along the last axis by their bytes, ascending by default or descending, with the indices of the
+// sorted strings in their row, like TopK of all the strings. The sort is stable, so the equal strings keep the order
+// of their indices, and the rows are sorted in parallel.
+struct KernelStringSort : BaseKernel {
+  KernelStringSort(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               ortc::Tensor<std::string>& output,
+               ortc::Tensor<int64_t>& indices) const;
+
+ private:
+  bool descending_{};
+  size_t num_threads_{1};
+};
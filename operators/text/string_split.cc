@@ -3,13 +3,76 @@
 
 #include "string_split.hpp"
 #include "string_tensor.h"
+#include "parallel_for.h"
 
-void string_split(const ortc::Tensor<std::string>& input_X,
-                  std::string_view sep,
-                  bool skip_empty,
-                  ortc::Tensor<int64_t>& out_indices,
-                  ortc::Tensor<std::string>& out_text,
-                  ortc::Tensor<int64_t>& out_shape) {
+#include <array>
+#include <cstring>
+
+namespace {
+// Finds the separators of the strings, which are any of the chars of sep, or all of sep as a substring.
+class SeparatorFinder {
+ public:
+  SeparatorFinder(std::string_view sep, bool substring) : sep_(sep), substring_(substring) {
+    for (char c : sep) {
+      is_sep_[static_cast<unsigned char>(c)] = true;
+    }
+  }
+
+  // Returns the position of the first separator at or after pos, or npos.
+  size_t Find(std::string_view str, size_t pos) const {
+    if (substring_ && sep_.size() > 1) {
+      return str.find(sep_, pos);
+    }
+
+    if (sep_.size() == 1) {
+      const void* found = memchr(str.data() + pos, sep_[0], str.size() - pos);
+      return found ? static_cast<const char*>(found) - str.data() : std::string_view::npos;
+    }
+
+    for (; pos < str.size(); ++pos) {
+      if (is_sep_[static_cast<unsigned char>(str[pos])]) {
+        return pos;
+      }
+    }
+    return std::string_view::npos;
+  }
+
+  size_t Length() const { return substring_ ? sep_.size() : 1; }
+
+ private:
+  std::string_view sep_;
+  bool substring_;
+  std::array<bool, 256> is_sep_{};
+};
+
+// Calls fn(piece) on the pieces of the string, in which the empty pieces are skipped if not keep.
+template <typename Fn>
+void ForEachPiece(std::string_view str, const SeparatorFinder& finder, bool keep, Fn&& fn) {
+  size_t previous = 0;
+  for (size_t current = finder.Find(str, 0); current != std::string_view::npos;
+       current = finder.Find(str, previous)) {
+    if (keep || current > previous) {
+      fn(str.substr(previous, current - previous));
+    }
+    previous = current + finder.Length();
+  }
+  if (keep || str.size() > previous) {
+    fn(str.substr(previous));
+  }
+}
+}  // namespace
+
+KernelStringSplit::KernelStringSplit(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  substring_sep_ = TryToGetAttributeWithDefault<int64_t>("substring_sep", 0) != 0;
+  num_threads_ = ReadNumThreadsAttribute(*this);
+}
+
+void KernelStringSplit::Compute(const ortc::Tensor<std::string_view>& input_X,
+                                std::string_view sep,
+                                bool skip_empty,
+                                ortc::Tensor<int64_t>& out_indices,
+                                ortc::Tensor<std::string>& out_text,
+                                ortc::Tensor<int64_t>& out_shape) const {
   // Setup inputs
   auto& X = input_X.Data();
 
@@ -18,63 +81,66 @@ void string_split(const ortc::Tensor<std::string>& input_X,
   if (dimensions.size() != 1)
     ORTX_CXX_API_THROW("Only 1D tensor are supported as input.", ORT_INVALID_ARGUMENT);
 
-  std::vector<std::string> words;
-  std::vector<int64_t> indices;
-  int64_t maxc = 0;
-  int64_t col;
-  if (sep.size() == 0) {
-    char word[2] = "a";
-    for (int64_t row = 0; row < dimensions[0]; ++row) {
-      const std::string& str = X[static_cast<size_t>(row)];
-      if (str.empty())
-        continue;
-      maxc = static_cast<int64_t>(static_cast<int64_t>(str.size()) > maxc ? str.size() : maxc);
-      for (auto it = str.begin(); it != str.end(); ++it) {
-        word[0] = *it;
-        words.push_back(word);
-        indices.push_back(row);
-        indices.push_back(std::distance(str.begin(), it));
-      }
+  // an empty sep splits the strings into their chars. the empty strings have no pieces.
+  const SeparatorFinder finder(sep, substring_sep_);
+  const bool keep = !skip_empty;
+  const size_t rows = X.size();
+  const auto for_each_piece = [&](std::string_view str, auto&& fn) {
+    if (str.empty()) {
+      return;
     }
-  } else {
-    bool keep = !skip_empty;
-    std::size_t current, previous = 0;
-    for (int64_t row = 0; row < dimensions[0]; ++row) {
-      const std::string& str = X[static_cast<size_t>(row)];
-      if (str.empty())
-        continue;
-      previous = 0;
-      col = 0;
-      current = str.find_first_of(sep);
-      while (current != std::string::npos) {
-        if (keep || current > previous) {
-          words.push_back(str.substr(previous, current - previous));
-          indices.push_back(row);
-          indices.push_back(col);
-          ++col;
-        }
-        previous = current + 1;
-        current = str.find_first_of(sep, previous);
-      }
-      current = str.size();
-      if (keep || current > previous) {
-        words.push_back(str.substr(previous, current - previous));
-        indices.push_back(row);
-        indices.push_back(col);
-        ++col;
+    if (sep.empty()) {
+      for (size_t i = 0; i < str.size(); ++i) {
+        fn(str.substr(i, 1));
       }
-      maxc = col > maxc ? col : maxc;
+    } else {
+      ForEachPiece(str, finder, keep, fn);
     }
+  };
+
+  // the pieces of the rows are counted first, so the outputs are allocated once and each row writes its part
+  std::vector<size_t> row_begins(rows + 1);
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      size_t count = 0;
+      for_each_piece(X[row], [&count](std::string_view) { ++count; });
+      row_begins[row + 1] = count;
+    }
+  });
+
+  int64_t maxc = 0;
+  for (size_t row = 0; row < rows; ++row) {
+    maxc = std::max(maxc, static_cast<int64_t>(row_begins[row + 1]));
+    row_begins[row + 1] += row_begins[row];
   }
 
-  std::vector<int64_t> shape_indices = {static_cast<int64_t>(indices.size()) / 2, 2};
-  int64_t* p_indices = out_indices.Allocate(shape_indices);
-  std::vector<int64_t> shape_text(1, words.size());
-  std::vector<int64_t> shape_shape(1, 2);
-  int64_t* p_shape = out_shape.Allocate(shape_shape);
+  const size_t num_pieces = row_begins[rows];
+  int64_t* p_indices = out_indices.Allocate({static_cast<int64_t>(num_pieces), 2});
+  std::vector<std::string_view> pieces(num_pieces);
+  std::vector<size_t> sizes(num_pieces);
+  ParallelFor(rows, num_threads_, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      size_t i = row_begins[row];
+      for_each_piece(X[row], [&](std::string_view piece) {
+        p_indices[2 * i] = static_cast<int64_t>(row);
+        p_indices[2 * i + 1] = static_cast<int64_t>(i - row_begins[row]);
+        pieces[i] = piece;
+        sizes[i] = piece.size();
+        ++i;
+      });
+    }
+  });
 
-  memcpy(p_indices, indices.data(), indices.size() * sizeof(int64_t));
+  int64_t* p_shape = out_shape.Allocate({2});
   p_shape[0] = dimensions[0];
   p_shape[1] = maxc;
-  out_text.SetStringOutput(words, shape_text);
+
+  // the pieces are views of the input, which are copied straight into the strings of the output
+  out_text.SetStringOutput({static_cast<int64_t>(num_pieces)}, sizes, [&](const std::vector<char*>& words) {
+    ParallelFor(num_pieces, num_threads_, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        memcpy(words[i], pieces[i].data(), pieces[i].size());
+      }
+    });
+  });
 }
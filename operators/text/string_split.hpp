@@ -6,9 +6,17 @@
 #include "ocos.h"
 #include "string_utils.h"
 
-void string_split(const ortc::Tensor<std::string>& input_X,
-                  std::string_view sep,
-                  bool skip_empty,
-                  ortc::Tensor<int64_t>& out_indices,
-                  ortc::Tensor<std::string>& out_text,
-                  ortc::Tensor<int64_t>& out_shape);
+struct KernelStringSplit : BaseKernel {
+  KernelStringSplit(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string_view>& input_X,
+               std::string_view sep,
+               bool skip_empty,
+               ortc::Tensor<int64_t>& out_indices,
+               ortc::Tensor<std::string>& out_text,
+               ortc::Tensor<int64_t>& out_shape) const;
+
+ private:
+  // sep is one separator instead of a set of separator chars
+  bool substring_sep_{};
+  size_t num_threads_{1};
+};
@@ -3,22 +3,77 @@
 
 #include "string_strip.hpp"
 #include "string_tensor.h"
+#include "ustring.h"
+#include "parallel_for.h"
+
+#include <cstring>
 #include <vector>
-#include <cmath>
-#include <algorithm>
-
-const char* WHITE_SPACE_CHARS = " \t\n\r\f\v";
-
-void string_strip(const ortc::Tensor<std::string>& input,
-                  ortc::Tensor<std::string>& output) {
-  std::vector<std::string> X = input.Data();
-  for (size_t i = 0; i < X.size(); ++i) {
-    size_t nonWhitespaceBegin = X[i].find_first_not_of(WHITE_SPACE_CHARS);
-    if (nonWhitespaceBegin != std::string::npos) {
-      size_t nonWhitespaceEnd = X[i].find_last_not_of(WHITE_SPACE_CHARS);
-      size_t nonWhitespaceRange = nonWhitespaceEnd - nonWhitespaceBegin + 1;
-      X[i] = X[i].substr(nonWhitespaceBegin, nonWhitespaceRange);
+
+namespace {
+
+// the stripped range of the string, whose whitespace of the other chars is skipped if unicode_spaces; a string of
+// only whitespace is kept as it is, as the op always did
+std::string_view Strip(std::string_view x, bool unicode_spaces) {
+  size_t begin = 0;
+  size_t end = x.size();
+  for (;;) {
+    begin += ustring::CountLeadingAsciiSpaces(x.data() + begin, end - begin);
+    if (!unicode_spaces || begin == end || static_cast<unsigned char>(x[begin]) < 0x80) {
+      break;
+    }
+    size_t len = 0;
+    if (!IsSpace(ustring::DecodeUTF8Char(x, begin, len))) {
+      break;
+    }
+    begin += len;
+  }
+
+  for (;;) {
+    end -= ustring::CountTrailingAsciiSpaces(x.data() + begin, end - begin);
+    if (!unicode_spaces || begin == end || static_cast<unsigned char>(x[end - 1]) < 0x80) {
+      break;
+    }
+    // the lead byte of the last char is before its continuation bytes
+    size_t lead = end - 1;
+    while (lead > begin && end - lead < 4 && (static_cast<unsigned char>(x[lead]) & 0xC0) == 0x80) {
+      --lead;
+    }
+    size_t len = 0;
+    if (!IsSpace(ustring::DecodeUTF8Char(x, lead, len)) || lead + len != end) {
+      break;
     }
+    end = lead;
   }
-  output.SetStringOutput(X, input.Shape());
+  return begin == end ? x : x.substr(begin, end - begin);
+}
+
+}  // namespace
+
+KernelStringStrip::KernelStringStrip(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  unicode_spaces_ = TryToGetAttributeWithDefault<int64_t>("unicode_spaces", 0) != 0;
+}
+
+void KernelStringStrip::Compute(const ortc::Tensor<std::string_view>& input,
+                                ortc::Tensor<std::string>& output) const {
+  auto& X = input.Data();
+
+  // the stripped ranges are found first, so the strings are all written into one buffer of their exact size
+  const auto& context = Ort::Custom::ComputeContext::Current();
+  std::vector<size_t> begins(X.size());
+  std::vector<size_t> sizes(X.size());
+  ParallelFor(context, X.size(), 16.0, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+      const std::string_view stripped = Strip(X[i], unicode_spaces_);
+      begins[i] = static_cast<size_t>(stripped.data() - X[i].data());
+      sizes[i] = stripped.size();
+    }
+  });
+
+  output.SetStringOutput(input.Shape(), sizes, [&](const std::vector<char*>& out) {
+    ParallelFor(context, X.size(), 32.0, [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; ++i) {
+        std::memcpy(out[i], X[i].data() + begins[i], sizes[i]);
+      }
+    });
+  });
 }
@@ -6,5 +6,14 @@
 #include "ocos.h"
 #include "string_utils.h"
 
-void string_strip(const ortc::Tensor<std::string>& input,
-                  ortc::Tensor<std::string>& output);
\ No newline at end of file
+// Strips the leading and trailing ASCII whitespace of the strings, or all the Unicode whitespace too with
+// unicode_spaces of 1. The runs of the ASCII whitespace are skipped 16 bytes at a time, and the rows of a big
+// batch are stripped in parallel into the one buffer of the output.
+struct KernelStringStrip : BaseKernel {
+  KernelStringStrip(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               ortc::Tensor<std::string>& output) const;
+
+ private:
+  bool unicode_spaces_{};
+};
@@ -1,4 +1,6 @@
 #include <charconv>
+#include <cstring>
+#include <unordered_map>
 #include "farmhash.h"
 #include "string_utils.h"
 #include "string_to_vector.hpp"
@@ -9,28 +11,14 @@ StringToVectorImpl::StringToVectorImpl(std::string& map, std::string& unk) {
   ParseUnkownValue(unk);
 }
 
-std::vector<std::vector<int64_t>> StringToVectorImpl::Compute(const std::vector<std::string>& str_input,
-                                                              const std::vector<int64_t>& input_dim,
-                                                              std::vector<int64_t>& output_dim) const {
-  std::vector<std::vector<int64_t>> result;
-
-  // Set output dimension
-  output_dim = input_dim;
-  output_dim.push_back(vector_len_);
-
-  std::string key;
-  for (size_t i = 0; i < str_input.size(); i++) {
-    key = str_input[i];
-
-    auto it = map_.find(key);
-    if (it != map_.end()) {
-      result.push_back(it->second);
-    } else {
-      result.push_back(unk_value_);
-    }
+void StringToVectorImpl::Compute(const std::vector<std::string_view>& str_input, int64_t* output) const {
+  for (const auto& str : str_input) {
+    const size_t index = keys_.Find(str);
+    const int64_t* value = index == StringPerfectHash::kNotFound ? unk_value_.data()
+                                                                 : values_.data() + index * vector_len_;
+    std::memcpy(output, value, vector_len_ * sizeof(int64_t));
+    output += vector_len_;
   }
-
-  return result;
 }
 
 void StringToVectorImpl::ParseMappingTable(std::string& map) {
@@ -46,7 +34,13 @@ void StringToVectorImpl::ParseMappingTable(std::string& map) {
                        ORT_INVALID_ARGUMENT);
   }
 
-  std::vector<int64_t> values(vector_len_);
+  // the vector of a key given more than once is its last one
+  std::vector<std::string_view> keys;
+  std::vector<int64_t> values;
+  std::unordered_map<std::string_view, size_t> key_lines;
+  keys.reserve(lines.size());
+  values.reserve(lines.size() * vector_len_);
+  key_lines.reserve(lines.size());
   for (auto& line : lines) {
     auto kv = SplitString(line, "\t", true);
 
@@ -55,10 +49,21 @@ void StringToVectorImpl::ParseMappingTable(std::string& map) {
                          ORT_INVALID_ARGUMENT);
     }
 
-    ParseValues(kv[1], values);
+    auto [it, inserted] = key_lines.emplace(kv[0], keys.size());
+    if (inserted) {
+      keys.push_back(kv[0]);
+      values.resize(values.size() + vector_len_);
+    }
+
+    ParseValues(kv[1], values.data() + it->second * vector_len_);
+  }
 
-    // string to vector mapping
-    map_[std::string{kv[0]}] = values;
+  // the rows in the order of the indices of the keys
+  const std::vector<size_t> indices = keys_.Build(keys);
+  values_.resize(values.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    std::memcpy(values_.data() + indices[i] * vector_len_, values.data() + i * vector_len_,
+                vector_len_ * sizeof(int64_t));
   }
 }
 
@@ -94,8 +99,13 @@ size_t StringToVectorImpl::ParseVectorLen(const std::string_view& line) {
   return value_strs.size();
 }
 
-void StringToVectorImpl::ParseValues(const std::string_view& v, std::vector<int64_t>& values) {
+void StringToVectorImpl::ParseValues(const std::string_view& v, int64_t* values) {
   std::vector<std::string_view> value_strs = SplitString(v, " ", true);
+  if (value_strs.size() != vector_len_) {
+    ORTX_CXX_API_THROW(MakeString("Incompatible dimension: required vector length of map should be: ", vector_len_,
+                                  ", but got: ", v),
+                       ORT_INVALID_ARGUMENT);
+  }
 
   int64_t value;
   for (size_t i = 0; i < value_strs.size(); i++) {
@@ -116,22 +126,10 @@ KernelStringToVector::KernelStringToVector(const OrtApi& api, const OrtKernelInf
   impl_ = std::make_shared<StringToVectorImpl>(map, unk);
 }
 
-void KernelStringToVector::Compute(const ortc::Tensor<std::string>& input,
+void KernelStringToVector::Compute(const ortc::Tensor<std::string_view>& input,
                                    ortc::Tensor<int64_t>& out) const {
-  // Setup input
-  auto& input_data = input.Data();
-  // Get output
-  std::vector<int64_t> output_dim;
-  auto mapping_result = impl_->Compute(input_data, input.Shape(), output_dim);
-
+  std::vector<int64_t> output_dim = input.Shape();
+  output_dim.push_back(static_cast<int64_t>(impl_->VectorLength()));
   auto* output_data = out.Allocate(output_dim);
-
-  // Set output tensor data
-  int idx = 0;
-  for (auto& res : mapping_result) {
-    for (int64_t value : res) {
-      output_data[idx] = value;
-      idx++;
-    }
-  }
+  impl_->Compute(input.Data(), output_data);
 }
@@ -4,34 +4,35 @@
 #pragma once
 
 #include <memory>
-#include <unordered_map>
 #include <vector>
 #include "ocos.h"
 #include "string_utils.h"
+#include "perfect_hash.h"
 
 class StringToVectorImpl {
  public:
   StringToVectorImpl(std::string& map, std::string& unk);
-  std::vector<std::vector<int64_t>> Compute(const std::vector<std::string>& str_input,
-                                            const std::vector<int64_t>& input_dim,
-                                            std::vector<int64_t>& output_dim) const;
+  size_t VectorLength() const { return vector_len_; }
+  // Writes the vector of each input string, of VectorLength() values, to the output one after the other.
+  void Compute(const std::vector<std::string_view>& str_input, int64_t* output) const;
 
  private:
   void ParseMappingTable(std::string& map);
   void ParseUnkownValue(std::string& unk);
   size_t ParseVectorLen(const std::string_view& line);
-  void ParseValues(const std::string_view& v, std::vector<int64_t>& values);
+  void ParseValues(const std::string_view& v, int64_t* values);
 
-  // mapping of string to vector
-  std::unordered_map<std::string, std::vector<int64_t>> map_;
+  // the keys of the mapping, whose vectors are the rows of values_ at their indices
+  StringPerfectHash keys_;
+  std::vector<int64_t> values_;
   // unkown value is a vector of int
   std::vector<int64_t> unk_value_;
-  size_t vector_len_;
+  size_t vector_len_{};
 };
 
 struct KernelStringToVector : BaseKernel {
   KernelStringToVector(const OrtApi& api, const OrtKernelInfo& info);
-  void Compute(const ortc::Tensor<std::string>& input,
+  void Compute(const ortc::Tensor<std::string_view>& input,
                ortc::Tensor<int64_t>& out) const;
 
  private:
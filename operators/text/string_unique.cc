@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "string_unique.hpp"
+#include "string_tensor.h"
+#include "unique_rows.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+KernelStringUnique::KernelStringUnique(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  sorted_ = TryToGetAttributeWithDefault<int64_t>("sorted", 1) != 0;
+}
+
+void KernelStringUnique::Compute(const ortc::Tensor<std::string_view>& input,
+                                 ortc::Tensor<std::string>& unique,
+                                 ortc::Tensor<int64_t>& indices,
+                                 ortc::Tensor<int64_t>& inverse_indices,
+                                 ortc::Tensor<int64_t>& counts) const {
+  auto& strings = input.Data();
+  const ort_extensions::UniqueRows rows(strings);
+  const size_t size = rows.size();
+
+  // the distinct strings of each position of the output, and the position of each distinct string
+  std::vector<size_t> order(size);
+  std::iota(order.begin(), order.end(), size_t{0});
+  if (sorted_) {
+    std::sort(order.begin(), order.end(), [&rows](size_t lhs, size_t rhs) { return rows[lhs] < rows[rhs]; });
+  }
+  std::vector<size_t> position(size);
+  for (size_t i = 0; i < size; ++i) {
+    position[order[i]] = i;
+  }
+
+  const std::vector<int64_t> dims{static_cast<int64_t>(size)};
+  int64_t* p_indices = indices.Allocate(dims);
+  int64_t* p_counts = counts.Allocate(dims);
+  std::vector<size_t> sizes(size);
+  for (size_t i = 0; i < size; ++i) {
+    p_indices[i] = static_cast<int64_t>(rows.FirstRow(order[i]));
+    p_counts[i] = static_cast<int64_t>(rows.Count(order[i]));
+    sizes[i] = rows[order[i]].size();
+  }
+
+  int64_t* p_inverse = inverse_indices.Allocate({static_cast<int64_t>(strings.size())});
+  for (size_t row = 0; row < strings.size(); ++row) {
+    p_inverse[row] = static_cast<int64_t>(position[rows.Index(row)]);
+  }
+
+  // the distinct strings are views of the input, which are copied straight into the strings of the output
+  unique.SetStringOutput(dims, sizes, [&](const std::vector<char*>& buffers) {
+    for (size_t i = 0; i < size; ++i) {
+      memcpy(buffers[i], rows[order[i]].data(), sizes[i]);
+    }
+  });
+}
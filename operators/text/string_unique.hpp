@@ -0,0 +1,23 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "string_utils.h"
+
+// The distinct strings of a tensor, like ONNX Unique without an axis, which many runtimes only have for numbers:
+// the distinct strings, the first index of each of them in the flattened input, the index of the distinct string of
+// each input, and the occurrences of each of them. The distinct strings are sorted, by default, or in the order of
+// their first occurrences by sorted of 0.
+struct KernelStringUnique : BaseKernel {
+  KernelStringUnique(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               ortc::Tensor<std::string>& unique,
+               ortc::Tensor<int64_t>& indices,
+               ortc::Tensor<int64_t>& inverse_indices,
+               ortc::Tensor<int64_t>& counts) const;
+
+ private:
+  bool sorted_{true};
+};
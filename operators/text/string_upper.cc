@@ -3,18 +3,30 @@
 
 #include "string_upper.hpp"
 #include "string_tensor.h"
+#include "ustring.h"
 #include <vector>
 #include <cmath>
 #include <algorithm>
 
-void string_upper(const ortc::Tensor<std::string>& input,
+void string_upper(const ortc::Tensor<std::string_view>& input,
                   ortc::Tensor<std::string>& output) {
   // Setup inputs
-  std::vector<std::string> X = input.Data();
+  auto& X = input.Data();
 
-  for (size_t i = 0; i < X.size(); ++i) {
-    std::transform(X[i].begin(), X[i].end(), X[i].begin(), [](char c) { return static_cast<char>(::toupper(c)); });
+  size_t total_size = 0;
+  for (std::string_view x : X) {
+    total_size += x.size();
   }
 
-  output.SetStringOutput(X, input.Shape());
+  ortc::StringTensorBuilder Y;
+  Y.Reserve(X.size(), total_size);
+  std::string upper;
+  for (std::string_view x : X) {
+    // only the ASCII letters are mapped, as ::toupper of the C locale did
+    upper.resize(x.size());
+    ustring::UpperAscii(x.data(), x.size(), upper.data());
+    Y.Append(upper);
+  }
+
+  output.SetStringOutput(Y, input.Shape());
 }
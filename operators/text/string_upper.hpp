@@ -6,5 +6,5 @@
 #include "ocos.h"
 #include "string_utils.h"
 
-void string_upper(const ortc::Tensor<std::string>& input,
+void string_upper(const ortc::Tensor<std::string_view>& input,
                   ortc::Tensor<std::string>& output);
@@ -1,6 +1,7 @@
 #include "text/op_equal.hpp"
 #include "text/op_ragged_tensor.hpp"
 #include "text/string_hash.hpp"
+#include "text/string_ngram_hash.hpp"
 #include "text/string_join.hpp"
 #include "text/string_lower.hpp"
 #include "text/string_split.hpp"
@@ -13,6 +14,13 @@
 #include "text/string_ecmaregex_replace.hpp"
 #include "text/string_ecmaregex_split.hpp"
 #include "text/string_mapping.hpp"
+#include "text/string_multi_replace.hpp"
+#include "text/string_phrase_match.hpp"
+#include "text/string_normalize.hpp"
+#include "text/string_normalize_steps.hpp"
+#include "text/string_slice.hpp"
+#include "text/string_sort.hpp"
+#include "text/string_unique.hpp"
 #include "text/masked_fill.hpp"
 
 #if defined(ENABLE_RE2_REGEX)
@@ -24,7 +32,7 @@ const std::vector<const OrtCustomOp*>& TextLoader() {
   static OrtOpLoader op_loader(
 #if defined(ENABLE_RE2_REGEX)
       CustomCpuStruct("StringRegexReplace", KernelStringRegexReplace),
-      CustomCpuFunc("StringRegexSplitWithOffsets", KernelStringRegexSplitWithOffsets),
+      CustomCpuStruct("StringRegexSplitWithOffsets", KernelStringRegexSplitWithOffsets),
 #endif  // ENABLE_RE2_REGEX
       CustomCpuStruct("RaggedTensorToSparse", KernelRaggedTensoroSparse),
       CustomCpuStruct("RaggedTensorToDense", KernelRaggedTensoroDense),
@@ -32,13 +40,26 @@ const std::vector<const OrtCustomOp*>& TextLoader() {
       CustomCpuStruct("StringEqual", KernelStringEqual),
       CustomCpuFunc("StringToHashBucket", string_hash),
       CustomCpuFunc("StringToHashBucketFast", string_hash_fast),
+      CustomCpuFunc("StringToHashBucketFastSparse", string_hash_fast_sparse),
+      CustomCpuStruct("StringNGramHash", KernelStringNGramHash),
+      CustomCpuStruct("StringNGramHashSparse", KernelStringNGramHashSparse),
       CustomCpuFunc("StringJoin", string_join),
-      CustomCpuFunc("StringLower", string_lower),
+      CustomCpuFuncWithTraits("StringLower", string_lower, StringLowerTraits),
       CustomCpuFunc("StringUpper", string_upper),
       CustomCpuStruct("StringMapping", KernelStringMapping),
-      CustomCpuFunc("MaskedFill", masked_fill),
-      CustomCpuFunc("StringSplit", string_split),
-      CustomCpuFunc("StringStrip", string_strip),
+      CustomCpuStruct("StringMultiReplace", KernelStringMultiReplace),
+      CustomCpuStruct("StringPhraseMatch", KernelStringPhraseMatch),
+      CustomCpuStruct("StringNormalize", KernelStringNormalize),
+      CustomCpuStruct("StringNormalizeSteps", KernelStringNormalizeSteps),
+      CustomCpuStruct("MaskedFill", KernelMaskedFill<std::string>),
+      CustomCpuStruct("MaskedFill", KernelMaskedFill<float>),
+      CustomCpuStruct("MaskedFill", KernelMaskedFill<int32_t>),
+      CustomCpuStruct("MaskedFill", KernelMaskedFill<int64_t>),
+      CustomCpuStruct("StringSplit", KernelStringSplit),
+      CustomCpuStruct("StringSliceWithOffsets", KernelStringSliceWithOffsets),
+      CustomCpuStruct("StringSort", KernelStringSort),
+      CustomCpuStruct("StringUnique", KernelStringUnique),
+      CustomCpuStruct("StringStrip", KernelStringStrip),
       CustomCpuStruct("StringToVector", KernelStringToVector),
       CustomCpuStruct("VectorToString", KernelVectorToString),
       CustomCpuFunc("StringLength", string_length),
@@ -1,28 +1,18 @@
 #include <charconv>
+#include <cstring>
+#include <numeric>
 #include "farmhash.h"
 #include "string_utils.h"
 #include "vector_to_string.hpp"
 #include "string_tensor.h"
 
-namespace std {
-
-template <class T>
-size_t hash<std::vector<T>>::operator()(const vector<T>& __vector) const noexcept {
-  return util::Hash(reinterpret_cast<const char*>(__vector.data()), __vector.size() * sizeof(T));
-}
-
-template struct hash<std::vector<std::string>>;
-}  // namespace std
-
 VectorToStringImpl::VectorToStringImpl(std::string& map, std::string& unk) : unk_value_(unk) {
   ParseMappingTable(map);
 }
 
-std::vector<std::string> VectorToStringImpl::Compute(const void* input,
-                                                     const std::vector<int64_t>& input_dim,
-                                                     std::vector<int64_t>& output_dim) const {
-  std::vector<std::string> result;
-
+std::vector<std::string_view> VectorToStringImpl::Compute(const void* input,
+                                                          const std::vector<int64_t>& input_dim,
+                                                          std::vector<int64_t>& output_dim) const {
   const int64_t* ptr = static_cast<const int64_t*>(input);
 
   if (vector_len_ == 1 && (input_dim.size() == 1 || input_dim.empty())) {
@@ -38,27 +28,41 @@ std::vector<std::string> VectorToStringImpl::Compute(const void* input,
     output_dim.pop_back();
   }
 
-  std::vector<int64_t> key(vector_len_);
-  int64_t input_element_size = std::accumulate(input_dim.begin(), input_dim.end(), 1ULL, std::multiplies<int64_t>());
-  for (int64_t i = 0; i < input_element_size; i = static_cast<int64_t>(i + vector_len_)) {
-    // construct key
-    for (size_t j = 0; j < vector_len_; j++) {
-      key[j] = ptr[j];
-    }
+  const int64_t input_element_size =
+      std::accumulate(input_dim.begin(), input_dim.end(), int64_t{1}, std::multiplies<int64_t>());
+  const size_t row_count = vector_len_ == 0 ? 0 : static_cast<size_t>(input_element_size) / vector_len_;
+  std::vector<std::string_view> result(row_count, unk_value_);
+  if (slot_keys_.empty()) {
+    return result;
+  }
 
-    auto it = map_.find(key);
-    if (it != map_.end()) {
-      result.push_back(it->second);
-    } else {
-      result.push_back(unk_value_);
+  for (size_t i = 0; i < row_count; ++i, ptr += vector_len_) {
+    const uint32_t key = slot_keys_[FindSlot(ptr, HashRow(ptr))];
+    if (key != kEmptySlot) {
+      result[i] = std::string_view(values_.data() + value_offsets_[key],
+                                   value_offsets_[key + 1] - value_offsets_[key]);
     }
-
-    ptr = ptr + vector_len_;
   }
 
   return result;
 }
 
+uint64_t VectorToStringImpl::HashRow(const int64_t* row) const {
+  return util::Fingerprint64(reinterpret_cast<const char*>(row), vector_len_ * sizeof(int64_t));
+}
+
+size_t VectorToStringImpl::FindSlot(const int64_t* row, uint64_t hash) const {
+  const size_t mask = slot_keys_.size() - 1;
+  for (size_t slot = static_cast<size_t>(hash) & mask;; slot = (slot + 1) & mask) {
+    const uint32_t key = slot_keys_[slot];
+    if (key == kEmptySlot ||
+        (slot_hashes_[slot] == hash &&
+         std::memcmp(keys_.data() + key * vector_len_, row, vector_len_ * sizeof(int64_t)) == 0)) {
+      return slot;
+    }
+  }
+}
+
 void VectorToStringImpl::ParseMappingTable(std::string& map) {
   auto lines = SplitString(map, "\n", true);
 
@@ -68,7 +72,18 @@ void VectorToStringImpl::ParseMappingTable(std::string& map) {
 
   vector_len_ = ParseVectorLen(lines[0]);
 
-  std::vector<int64_t> values(vector_len_);
+  // the table is at most half full, so a probe ends soon at an empty slot
+  size_t slot_count = 1;
+  while (slot_count < 2 * lines.size()) {
+    slot_count *= 2;
+  }
+  slot_hashes_.assign(slot_count, 0);
+  slot_keys_.assign(slot_count, kEmptySlot);
+
+  std::vector<std::string_view> values;
+  std::vector<int64_t> row(vector_len_);
+  keys_.reserve(lines.size() * vector_len_);
+  values.reserve(lines.size());
   for (auto& line : lines) {
     auto kv = SplitString(line, "\t", true);
 
@@ -77,9 +92,32 @@ void VectorToStringImpl::ParseMappingTable(std::string& map) {
                          ORT_INVALID_ARGUMENT);
     }
 
-    ParseValues(kv[1], values);
+    ParseValues(kv[1], row.data());
+
+    // the string of a vector given more than once is its last one
+    const uint64_t hash = HashRow(row.data());
+    const size_t slot = FindSlot(row.data(), hash);
+    if (slot_keys_[slot] == kEmptySlot) {
+      slot_hashes_[slot] = hash;
+      slot_keys_[slot] = static_cast<uint32_t>(values.size());
+      keys_.insert(keys_.end(), row.begin(), row.end());
+      values.push_back(kv[0]);
+    } else {
+      values[slot_keys_[slot]] = kv[0];
+    }
+  }
+
+  size_t value_bytes = 0;
+  for (const auto& value : values) {
+    value_bytes += value.size();
+  }
 
-    map_[values] = kv[0];
+  values_.reserve(value_bytes);
+  value_offsets_.reserve(values.size() + 1);
+  value_offsets_.push_back(0);
+  for (const auto& value : values) {
+    values_.append(value);
+    value_offsets_.push_back(values_.size());
   }
 }
 
@@ -95,8 +133,13 @@ size_t VectorToStringImpl::ParseVectorLen(const std::string_view& line) {
   return value_strs.size();
 }
 
-void VectorToStringImpl::ParseValues(const std::string_view& v, std::vector<int64_t>& values) {
+void VectorToStringImpl::ParseValues(const std::string_view& v, int64_t* values) {
   std::vector<std::string_view> value_strs = SplitString(v, " ", true);
+  if (value_strs.size() != vector_len_) {
+    ORTX_CXX_API_THROW(MakeString("Incompatible dimension: required vector length of map should be: ", vector_len_,
+                                  ", but got: ", v),
+                       ORT_INVALID_ARGUMENT);
+  }
 
   int64_t value;
   for (size_t i = 0; i < value_strs.size(); i++) {
@@ -122,6 +165,18 @@ void KernelVectorToString::Compute(const ortc::Tensor<int64_t>& input,
   const void* input_data = input.Data();
 
   std::vector<int64_t> output_dim;
-  std::vector<std::string> mapping_result = impl_->Compute(input_data, input.Shape(), output_dim);
-  out.SetStringOutput(mapping_result, output_dim);
+  std::vector<std::string_view> mapping_result = impl_->Compute(input_data, input.Shape(), output_dim);
+
+  size_t num_chars = 0;
+  for (const auto& str : mapping_result) {
+    num_chars += str.size();
+  }
+
+  ortc::StringTensorBuilder output_strings;
+  output_strings.Reserve(mapping_result.size(), num_chars);
+  for (const auto& str : mapping_result) {
+    output_strings.Append(str);
+  }
+
+  out.SetStringOutput(output_strings, output_dim);
 }
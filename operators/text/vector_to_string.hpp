@@ -4,34 +4,37 @@
 #pragma once
 
 #include <memory>
-#include <unordered_map>
 #include <vector>
 #include "ocos.h"
 #include "string_utils.h"
 
-namespace std {
-
-template <class T>
-struct hash<std::vector<T>> {
-  size_t operator()(const vector<T>& __vector) const noexcept;
-};
-}  // namespace std
-
 class VectorToStringImpl {
  public:
   VectorToStringImpl(std::string& map, std::string& unk);
-  std::vector<std::string> Compute(const void* input,
-                                   const std::vector<int64_t>& input_dim,
-                                   std::vector<int64_t>& output_dim) const;
+  // Returns the string of each row of the input, which are views of the mapping or of the unknown value.
+  std::vector<std::string_view> Compute(const void* input,
+                                        const std::vector<int64_t>& input_dim,
+                                        std::vector<int64_t>& output_dim) const;
 
  private:
+  static constexpr uint32_t kEmptySlot = UINT32_MAX;
+
   void ParseMappingTable(std::string& map);
   size_t ParseVectorLen(const std::string_view& line);
-  void ParseValues(const std::string_view& v, std::vector<int64_t>& values);
-
-  std::unordered_map<std::vector<int64_t>, std::string> map_;
+  void ParseValues(const std::string_view& v, int64_t* values);
+  uint64_t HashRow(const int64_t* row) const;
+  // Returns the slot of the row in the table, which is either the row's or the empty one where it belongs.
+  size_t FindSlot(const int64_t* row, uint64_t hash) const;
+
+  // the rows of the keys one after the other, and the strings of the keys, by the index of each key
+  std::vector<int64_t> keys_;
+  std::string values_;
+  std::vector<size_t> value_offsets_;
+  // an open addressing table of a power of 2 slots, each the hash and the index of a key, or kEmptySlot
+  std::vector<uint64_t> slot_hashes_;
+  std::vector<uint32_t> slot_keys_;
   std::string unk_value_;
-  size_t vector_len_;
+  size_t vector_len_{};
 };
 
 struct KernelVectorToString : BaseKernel {
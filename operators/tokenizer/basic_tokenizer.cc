@@ -14,7 +14,16 @@ BasicTokenizer::BasicTokenizer(bool do_lower_case, bool tokenize_chinese_chars,
       strip_accents_(strip_accents),
       tokenize_chinese_chars_(tokenize_chinese_chars),
       tokenize_punctuation_(tokenize_punctuation),
-      remove_control_chars_(remove_control_chars) {}
+      remove_control_chars_(remove_control_chars) {
+  for (char32_t c = 0; c < latin1_map_.size(); ++c) {
+    // strip accent first
+    char32_t normalized = strip_accents_ ? StripAccent(c) : c;
+    latin1_map_[c] = do_lower_case_ ? ToLower(normalized) : normalized;
+  }
+  for (size_t category = 0; category < actions_.size(); ++category) {
+    actions_[category] = ActionOf(static_cast<uint8_t>(category));
+  }
+}
 
 std::vector<ustring> BasicTokenizer::Tokenize(ustring text) {
   std::vector<ustring> result;
@@ -32,53 +41,52 @@ std::vector<ustring> BasicTokenizer::Tokenize(ustring text) {
     token.clear();
   };
 
-  // strip accent first
-  if (strip_accents_) {
-    for (auto& c : text) {
-      c = StripAccent(c);
-    }
-  }
-
-  if (do_lower_case_) {
-    for (auto& c : text) {
-      c = ToLower(c);
+  for (auto c : text) {
+    switch (Classify(c)) {
+      case CharAction::kSingleToken:
+        push_current_token_and_clear();
+        push_single_char_and_clear(c);
+        break;
+      case CharAction::kSplit:
+        push_current_token_and_clear();
+        break;
+      case CharAction::kAppend:
+        token.push_back(c);
+        break;
+      case CharAction::kSkip:
+        break;
     }
   }
 
-  for (auto c : text) {
-    if (tokenize_chinese_chars_ && IsCJK(c)) {
-      push_current_token_and_clear();
-      push_single_char_and_clear(c);
-      continue;
-    }
+  push_current_token_and_clear();
+  return result;
+}
 
-    if (strip_accents_ && IsAccent(c)) {
-      continue;
-    }
+BasicTokenizer::CharAction BasicTokenizer::ActionOf(uint8_t category) const {
+  if (tokenize_chinese_chars_ && (category & kCharCJK)) {
+    return CharAction::kSingleToken;
+  }
 
-    // 0x2019 unicode is not punctuation in some Linux platform,
-    // to be consistent, take it as punctuation.
-    if (tokenize_punctuation_ && IsPunct(c)) {
-      push_current_token_and_clear();
-      push_single_char_and_clear(c);
-      continue;
-    }
+  if (strip_accents_ && (category & kCharAccent)) {
+    return CharAction::kSkip;
+  }
 
-    // split by space
-    if (IsSpace(c)) {
-      push_current_token_and_clear();
-      continue;
-    }
+  // 0x2019 unicode is not punctuation in some Linux platform,
+  // to be consistent, take it as punctuation.
+  if (tokenize_punctuation_ && (category & kCharPunct)) {
+    return CharAction::kSingleToken;
+  }
 
-    if (remove_control_chars_ && IsControl(c)) {
-      continue;
-    }
+  // split by space
+  if (category & kCharSpace) {
+    return CharAction::kSplit;
+  }
 
-    token.push_back(c);
+  if (remove_control_chars_ && (category & kCharControl)) {
+    return CharAction::kSkip;
   }
 
-  push_current_token_and_clear();
-  return result;
+  return CharAction::kAppend;
 }
 
 KernelBasicTokenizer::KernelBasicTokenizer(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
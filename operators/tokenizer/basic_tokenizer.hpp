@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+
 #include "ocos.h"
 #include "string_utils.h"
 #include "ustring.h"
@@ -13,12 +15,35 @@ class BasicTokenizer {
                  bool remove_control_chars);
   std::vector<ustring> Tokenize(ustring text);
 
+  // How a character goes into the tokens.
+  enum class CharAction {
+    kAppend,       // to the current token
+    kSkip,         // dropped from the text
+    kSplit,        // ends the current token
+    kSingleToken,  // a token by itself
+  };
+
+  // Normalizes the character and returns how it is tokenized, which is the step of Tokenize for one character,
+  // so that a caller can tokenize the text as it decodes it.
+  CharAction Classify(char32_t& c) const {
+    // the accents are stripped and the case is lowered only for the Latin-1 characters
+    if (c < latin1_map_.size()) {
+      c = latin1_map_[c];
+    }
+    return actions_[GetCharCategory(c)];
+  }
+
  private:
+  CharAction ActionOf(uint8_t category) const;
+
   bool do_lower_case_;
   bool strip_accents_;
   bool tokenize_chinese_chars_;
   bool tokenize_punctuation_;
   bool remove_control_chars_;
+
+  std::array<char32_t, 256> latin1_map_;                 // the normalized Latin-1 characters
+  std::array<CharAction, kCharCategoryCount> actions_;  // the action of every category
 };
 
 struct KernelBasicTokenizer : BaseKernel {
@@ -5,41 +5,47 @@
 #include <optional>
 #include <list>
 
-BertTokenizerVocab::BertTokenizerVocab(std::string_view vocab) : raw_vocab_(vocab) {
-  auto tokens = SplitString(raw_vocab_, "\r\n", true);
+#include "trace_scope.h"
+#include "asset_attribute.h"
+#include "token_windows.hpp"
 
+BertTokenizerVocab::BertTokenizerVocab(std::string_view vocab) {
+  auto tokens = SplitString(vocab, "\r\n", true);
+
+  vocab_.Reserve(tokens.size(), vocab.size());
   for (size_t i = 0; i < tokens.size(); i++) {
-    (vocab_)[tokens[i]] = static_cast<int32_t>(i);
+    vocab_.Add(tokens[i], static_cast<int32_t>(i));
   }
+  vocab_.ShrinkToFit();
 }
 
 bool BertTokenizerVocab::FindToken(const ustring& token) {
   auto utf8_token = std::string(token);
 
-  return vocab_.find(utf8_token) != vocab_.end();
+  return vocab_.Contains(utf8_token);
 }
 
 bool BertTokenizerVocab::FindTokenId(const ustring& token, int32_t& token_id) {
   auto utf8_token = std::string(token);
 
-  auto it = vocab_.find(utf8_token);
-  if (it == vocab_.end()) {
+  int32_t id = vocab_.Find(utf8_token);
+  if (id == TokenVocab::kInvalidId) {
     return false;
   }
 
-  token_id = it->second;
+  token_id = id;
   return true;
 }
 
 int32_t BertTokenizerVocab::FindTokenId(const ustring& token) {
   auto utf8_token = std::string(token);
 
-  auto it = vocab_.find(utf8_token);
-  if (it == vocab_.end()) {
+  int32_t id = vocab_.Find(utf8_token);
+  if (id == TokenVocab::kInvalidId) {
     ORTX_CXX_API_THROW("[BertTokenizerVocab]: can not find tokens: " + std::string(token), ORT_RUNTIME_EXCEPTION);
   }
 
-  return it->second;
+  return id;
 }
 
 WordpieceTokenizer::WordpieceTokenizer(
@@ -51,14 +57,18 @@ WordpieceTokenizer::WordpieceTokenizer(
                                     unk_token_(std::move(unk_token)),
                                     vocab_(std::move(vocab)) {
   unk_token_id_ = vocab_->FindTokenId(unk_token_);
+  auto trie = std::make_shared<WordpieceTrie>();
+  trie->Build(vocab_->GetVocab(), suffix_indicator_);
+  trie_ = std::move(trie);
 }
 
-std::vector<ustring> WordpieceTokenizer::Tokenize(const ustring& text, std::list<OffsetMappingType>& offset_map, bool compute_offset_mapping) {
+std::vector<ustring> WordpieceTokenizer::Tokenize(const ustring& text) {
   std::vector<ustring> result;
+  std::vector<int32_t> pieces;
   ustring token;
   for (auto c : text) {
     if (c == U' ' && !token.empty()) {
-      GreedySearch(token, result);
+      GreedySearch(token, pieces, result);
       token.clear();
       continue;
     }
@@ -67,48 +77,17 @@ std::vector<ustring> WordpieceTokenizer::Tokenize(const ustring& text, std::list
   }
 
   if (!token.empty()) {
-    GreedySearch(token, result);
+    GreedySearch(token, pieces, result);
   }
 
   return result;
 }
 
-std::vector<ustring> WordpieceTokenizer::Tokenize(const std::vector<ustring>& tokens, std::list<OffsetMappingType>& offset_map, bool compute_offset_mapping) {
+std::vector<ustring> WordpieceTokenizer::Tokenize(const std::vector<ustring>& tokens) {
   std::vector<ustring> result;
+  std::vector<int32_t> pieces;
   for (const auto& token : tokens) {
-    GreedySearch(token, result);
-  }
-
-  if (compute_offset_mapping) {
-    size_t offset = 0;
-    OffsetMappingType offset_mapping;
-
-    // Add offset mapping for BOS token
-    offset_mapping.push_back(std::make_pair(0, 0));
-
-    for (auto i : result) {
-      // Handle special cases for offset mapping
-      size_t idx = 0;
-      if (idx < std::string(i).size() && std::string(i).at(idx) == '#') {
-        while (idx < std::string(i).size() && std::string(i).at(idx) == '#') {
-          idx++;
-        }
-        offset--;
-        offset_mapping.emplace_back(std::make_pair(offset, offset + std::string(i).size() - idx));
-        offset += (std::string(i).size() - idx) + 1;
-      } else if (std::string(i).compare("[UNK]") == 0) {
-        offset_mapping.emplace_back(std::make_pair(offset, offset + 1));
-        offset += 2;
-      } else {
-        offset_mapping.emplace_back(std::make_pair(offset, offset + std::string(i).size()));
-        offset += std::string(i).size() + 1;
-      }
-    }
-    // Add offset mapping for EOS token
-    offset_mapping.emplace_back(std::make_pair(0, 0));
-
-    // Add offset mappings for input in this instance to list of offset mappings for all inputs
-    offset_map.emplace_back(offset_mapping);
+    GreedySearch(token, pieces, result);
   }
 
   return result;
@@ -128,38 +107,51 @@ std::vector<int64_t> WordpieceTokenizer::Encode(const std::vector<ustring>& toke
   return ids;
 }
 
-void WordpieceTokenizer::GreedySearch(const ustring& token, std::vector<ustring>& tokenized_result) {
+void WordpieceTokenizer::EncodeWord(std::u32string_view word, const int64_t* positions, std::vector<int32_t>& pieces,
+                                    std::vector<int64_t>& ids, std::vector<int64_t>* offsets) const {
+  pieces.clear();
+  const WordpieceTrie& trie = Trie();
+  bool is_found = static_cast<int64_t>(word.size()) <= max_input_chars_per_word_ && trie.Tokenize(word, pieces);
+  size_t begin = 0;
+  for (size_t k = 0; k < pieces.size(); ++k) {
+    const auto& matched = trie.GetPiece(pieces[k]);
+    ids.push_back(matched.id);
+    if (offsets != nullptr) {
+      // the pieces after the first one are matched without the suffix indicator
+      size_t length = matched.token.size() - (k == 0 ? 0 : suffix_indicator_.size());
+      offsets->push_back(positions[begin]);
+      offsets->push_back(positions[begin + length - 1] + 1);
+      begin += length;
+    }
+  }
+
+  // token not found in vocab, which is the rest of the word
+  if (!is_found) {
+    ids.push_back(unk_token_id_);
+    if (offsets != nullptr) {
+      offsets->push_back(positions[begin]);
+      offsets->push_back(positions[word.size() - 1] + 1);
+    }
+  }
+}
+
+void WordpieceTokenizer::GreedySearch(const ustring& token, std::vector<int32_t>& pieces,
+                                      std::vector<ustring>& tokenized_result) {
   if (static_cast<int64_t>(token.size()) > max_input_chars_per_word_) {
     tokenized_result.push_back(unk_token_);
     return;
   }
 
-  size_t start = 0;
-  size_t end = 0;
-  ustring substr;
-  for (; start < token.size();) {
-    end = token.size();
-    bool is_found = false;
-    // try to found the longest matched sub-token in vocab
-    for (; start < end;) {
-      substr = static_cast<const ustring>(token.substr(start, end - start));
-      if (start > 0) {
-        substr = static_cast<const ustring>(suffix_indicator_ + substr);
-      }
-      if (vocab_->FindToken(substr)) {
-        is_found = true;
-        break;
-      }
-      end -= 1;
-    }
-    // token not found in vocab
-    if (!is_found) {
-      tokenized_result.push_back(unk_token_);
-      break;
-    }
-
-    tokenized_result.push_back(substr);
-    start = end;
+  // the longest matched sub-tokens in vocab are found by the trie in one pass over the token
+  pieces.clear();
+  const WordpieceTrie& trie = Trie();
+  bool is_found = trie.Tokenize(token, pieces);
+  for (int32_t piece : pieces) {
+    tokenized_result.emplace_back(trie.GetPiece(piece).token);
+  }
+  // token not found in vocab
+  if (!is_found) {
+    tokenized_result.push_back(unk_token_);
   }
 }
 
@@ -210,7 +202,7 @@ void TruncateStrategy::Truncate(std::vector<int64_t>& ids1, std::vector<int64_t>
 }
 
 BertTokenizer::BertTokenizer(
-    const std::string& vocab,
+    std::string_view vocab,
     bool do_lower_case,
     bool do_basic_tokenize,
     ustring unk_token,
@@ -241,17 +233,104 @@ BertTokenizer::BertTokenizer(
   mask_token_id_ = vocab_->FindTokenId(mask_token);
 }
 
-std::vector<ustring> BertTokenizer::Tokenize(const ustring& text, std::list<OffsetMappingType>& offset_map, bool compute_offset_mapping) {
+std::vector<ustring> BertTokenizer::Tokenize(const ustring& text) {
   if (do_basic_tokenize_) {
-    return wordpiece_tokenizer_->Tokenize(basic_tokenizer_->Tokenize(text), offset_map, compute_offset_mapping);
+    return wordpiece_tokenizer_->Tokenize(basic_tokenizer_->Tokenize(text));
   }
-  return wordpiece_tokenizer_->Tokenize(text, offset_map, compute_offset_mapping);
+  return wordpiece_tokenizer_->Tokenize(text);
 }
 
 std::vector<int64_t> BertTokenizer::Encode(const std::vector<ustring>& tokens) {
   return wordpiece_tokenizer_->Encode(tokens);
 }
 
+std::vector<int64_t> BertTokenizer::Encode(std::string_view text, std::vector<int64_t>* offsets,
+                                           size_t max_ids) const {
+  ORTX_TRACE_SCOPE("BertTokenizer.Encode");
+  std::vector<int64_t> ids;
+  std::vector<int32_t> pieces;
+  std::u32string word;             // the scratch buffer of the normalized word
+  std::vector<int64_t> positions;  // the offsets of the characters of the word in the text
+
+  auto encode_word = [&]() {
+    if (!word.empty()) {
+      wordpiece_tokenizer_->EncodeWord(word, positions.data(), pieces, ids, offsets);
+      word.clear();
+      positions.clear();
+    }
+  };
+
+  // the normalization maps every character to one character or none, so each one keeps its own offset.
+  auto append_char = [&](char32_t c, int64_t position) {
+    word.push_back(c);
+    if (offsets != nullptr) {
+      positions.push_back(position);
+    }
+  };
+
+  int64_t position = 0;
+  size_t ascii_end = 0;  // the end of the ASCII bytes from pos, which are characters by themselves
+  // a word is encoded whole before the check, so the rest of the text is neither decoded nor matched once the
+  // ids reach max_ids, and the extra ids of the last word are dropped below.
+  for (size_t pos = 0; pos < text.size() && ids.size() < max_ids; ++position) {
+    if (pos == ascii_end) {
+      ascii_end = pos + ustring::CountAsciiPrefix(text.data() + pos, text.size() - pos);
+    }
+
+    char32_t c;
+    if (pos < ascii_end) {
+      c = static_cast<unsigned char>(text[pos++]);
+    } else {
+      size_t len = 0;
+      c = ustring::DecodeUTF8Char(text, pos, len);
+      pos += len;
+      ascii_end = pos;
+    }
+
+    if (!do_basic_tokenize_) {
+      // WordpieceTokenizer only splits the text by the spaces, and a leading space stays in the word.
+      if (c == U' ' && !word.empty()) {
+        encode_word();
+      } else {
+        append_char(c, position);
+      }
+      continue;
+    }
+
+    switch (basic_tokenizer_->Classify(c)) {
+      case BasicTokenizer::CharAction::kSingleToken:
+        encode_word();
+        append_char(c, position);
+        encode_word();
+        break;
+      case BasicTokenizer::CharAction::kSplit:
+        encode_word();
+        break;
+      case BasicTokenizer::CharAction::kAppend:
+        append_char(c, position);
+        break;
+      case BasicTokenizer::CharAction::kSkip:
+        break;
+    }
+  }
+  if (ids.size() < max_ids) {
+    encode_word();
+  }
+
+  if (ids.size() > max_ids) {
+    if (offsets != nullptr) {
+      offsets->resize(offsets->size() - 2 * (ids.size() - max_ids));
+    }
+    ids.resize(max_ids);
+  }
+  return ids;
+}
+
+size_t BertTokenizer::MaxEncodedLength() const {
+  // the same bound as Truncate(ids), which keeps all the ids for a max_length of 2 or less
+  return max_length_ > 2 ? static_cast<size_t>(max_length_ - 2) : SIZE_MAX;
+}
+
 void BertTokenizer::Truncate(std::vector<int64_t>& ids) {
   truncate_->Truncate(ids, (max_length_ > 0 && max_length_ <= 2) ? 0 : max_length_ - 2);
 }
@@ -304,8 +383,37 @@ TruncateStrategy::TruncateStrategy(std::string_view strategy_name) : strategy_(T
   }
 }
 
-KernelBertTokenizer::KernelBertTokenizer(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
-  std::string vocab = ort_.KernelInfoGetAttribute<std::string>(&info, "vocab_file");
+namespace {
+// Copies the offsets of the ids after the (0, 0) of the special token before them, and returns the end.
+template <typename T>
+T* CopyOffsetMapping(const int64_t* offsets, size_t id_count, T* output) {
+  output[0] = 0;
+  output[1] = 0;
+  return std::copy_n(offsets, id_count * 2, output + 2);
+}
+
+// Writes the [1] mapping of the output without windows, whose one row is of the one sample.
+template <typename T>
+void WriteSingleSampleMapping(std::optional<ortc::Tensor<T>*> overflow_to_sample_mapping) {
+  if (overflow_to_sample_mapping.has_value()) {
+    *(*overflow_to_sample_mapping)->Allocate({1}) = 0;
+  }
+}
+}  // namespace
+
+template <typename T>
+void KernelBertTokenizer<T>::PadToLength(size_t length, std::vector<int64_t>& input_ids,
+                                         std::vector<int64_t>& token_type_ids,
+                                         std::vector<int64_t>& attention_mask) const {
+  input_ids.resize(length, tokenizer_->PadTokenId());
+  token_type_ids.resize(length, 0);
+  attention_mask.resize(length, 0);
+}
+
+template <typename T>
+KernelBertTokenizer<T>::KernelBertTokenizer(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  CheckOutputDtype<T>(*this, "BertTokenizer");
+  ort_extensions::AssetBytes vocab = ort_extensions::GetAssetAttribute(*this, "vocab_file");
   bool do_lower_case = TryToGetAttributeWithDefault("do_lower_case", true);
   bool do_basic_tokenize = TryToGetAttributeWithDefault("do_basic_tokenize", true);
   std::string unk_token = TryToGetAttributeWithDefault("unk_token", std::string("[UNK]"));
@@ -325,45 +433,138 @@ KernelBertTokenizer::KernelBertTokenizer(const OrtApi& api, const OrtKernelInfo&
       ustring(sep_token), ustring(pad_token), ustring(cls_token),
       ustring(mask_token), tokenize_chinese_chars, strip_accents,
       ustring(suffix_indicator), max_len, truncation_strategy_name);
+
+  int64_t window_length = TryToGetAttributeWithDefault("window_length", int64_t(0));
+  int64_t stride = TryToGetAttributeWithDefault("stride", int64_t(0));
+  if (window_length < 0 || stride < 0 || (window_length > 0 && window_length <= stride + 2)) {
+    ORTX_CXX_API_THROW(MakeString("[BertTokenizer]: window_length ", window_length,
+                                  " should be 0, or more than stride ", stride, " and the [CLS] and [SEP]."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  window_length_ = static_cast<size_t>(window_length);
+  stride_ = static_cast<size_t>(stride);
+
+  padded_length_ = PaddedLength(*this);
+  if (padded_length_.IsSet() && window_length_ > 0) {
+    ORTX_CXX_API_THROW("[BertTokenizer]: pad_to_multiple_of and length_buckets can't be set with window_length.",
+                       ORT_INVALID_ARGUMENT);
+  }
 }
 
-void KernelBertTokenizer::Compute(const ortc::Tensor<std::string>& input,
-                                  ortc::Tensor<int64_t>& output,
-                                  ortc::Tensor<int64_t>& output1,
-                                  ortc::Tensor<int64_t>& output2,
-                                  std::optional<ortc::Tensor<int64_t>*> offset_mapping) const {
+template <typename T>
+void KernelBertTokenizer<T>::ComputeWindows(const std::vector<std::string_view>& input_data,
+                                            ortc::Tensor<T>& input_ids,
+                                            ortc::Tensor<T>& token_type_ids,
+                                            ortc::Tensor<T>& attention_mask,
+                                            std::optional<ortc::Tensor<T>*> offset_mapping,
+                                            std::optional<ortc::Tensor<T>*> overflow_to_sample_mapping) const {
+  // the texts are encoded once, without the truncation, and the windows are written from their ids
+  bool compute_offset_mapping = offset_mapping.has_value();
+  const bool is_pair = input_data.size() == 2;
+  std::vector<int64_t> offsets1;
+  std::vector<int64_t> offsets2;
+  std::vector<int64_t> encoded1 = tokenizer_->Encode(input_data[0], compute_offset_mapping ? &offsets1 : nullptr);
+  std::vector<int64_t> encoded2;
+  if (is_pair) {
+    encoded2 = tokenizer_->Encode(input_data[1], compute_offset_mapping ? &offsets2 : nullptr);
+  }
+
+  const std::vector<int64_t>& sequence = is_pair ? encoded2 : encoded1;
+  const int64_t* sequence_offsets = is_pair ? offsets2.data() : offsets1.data();
+  const size_t reserved = is_pair ? encoded1.size() + 3 : 2;
+  if (window_length_ <= reserved + stride_) {
+    ORTX_CXX_API_THROW(MakeString("[BertTokenizer]: window_length ", window_length_, " leaves no ids for the windows",
+                                  " of stride ", stride_, " after the special tokens and the ", encoded1.size(),
+                                  " ids of the first text."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  const TokenWindows windows{window_length_ - reserved, stride_};
+  const size_t count = windows.Count(sequence.size());
+  const std::vector<int64_t> output_dim{static_cast<int64_t>(count), static_cast<int64_t>(window_length_)};
+  T* p_ids = input_ids.Allocate(output_dim);
+  T* p_type_ids = token_type_ids.Allocate(output_dim);
+  T* p_mask = attention_mask.Allocate(output_dim);
+  T* p_offset = compute_offset_mapping
+                    ? (*offset_mapping)->Allocate({output_dim[0], output_dim[1], 2})
+                    : nullptr;
+  if (overflow_to_sample_mapping.has_value()) {
+    T* p_mapping = (*overflow_to_sample_mapping)->Allocate({output_dim[0]});
+    std::fill(p_mapping, p_mapping + count, 0);
+  }
+
+  for (size_t w = 0; w < count; ++w) {
+    const size_t begin = windows.Begin(w);
+    const size_t end = windows.End(w, sequence.size());
+    std::vector<int64_t> slice(sequence.begin() + begin, sequence.begin() + end);
+    std::vector<int64_t> ids = is_pair ? tokenizer_->AddSpecialToken(encoded1, slice)
+                                       : tokenizer_->AddSpecialToken(slice);
+    std::vector<int64_t> type_ids = is_pair ? tokenizer_->GenerateTypeId(encoded1, slice)
+                                            : tokenizer_->GenerateTypeId(slice);
+
+    T* row = p_ids + w * window_length_;
+    std::fill(std::copy(ids.begin(), ids.end(), row), row + window_length_, tokenizer_->PadTokenId());
+    row = p_type_ids + w * window_length_;
+    std::fill(std::copy(type_ids.begin(), type_ids.end(), row), row + window_length_, 0);
+    row = p_mask + w * window_length_;
+    std::fill(std::fill_n(row, ids.size(), 1), row + window_length_, 0);
+
+    if (p_offset != nullptr) {
+      T* offset_row = p_offset + w * window_length_ * 2;
+      T* next = offset_row;
+      if (is_pair) {
+        next = CopyOffsetMapping(offsets1.data(), encoded1.size(), next);
+      }
+      next = CopyOffsetMapping(sequence_offsets + begin * 2, end - begin, next);
+      // the last [SEP] and the padding
+      std::fill(next, offset_row + window_length_ * 2, 0);
+    }
+  }
+}
+
+template <typename T>
+void KernelBertTokenizer<T>::Compute(const ortc::Tensor<std::string_view>& input,
+                                     ortc::Tensor<T>& output,
+                                     ortc::Tensor<T>& output1,
+                                     ortc::Tensor<T>& output2,
+                                     std::optional<ortc::Tensor<T>*> offset_mapping,
+                                     std::optional<ortc::Tensor<T>*> overflow_to_sample_mapping) const {
   // Setup inputs
   auto& input_data = input.Data();
 
   if (input_data.size() != 1 && input_data.size() != 2) {
     ORTX_CXX_API_THROW("[BertTokenizer]: only support one or two query.", ORT_INVALID_GRAPH);
   }
+  if (window_length_ > 0) {
+    ComputeWindows(input_data, output, output1, output2, offset_mapping, overflow_to_sample_mapping);
+    return;
+  }
+  WriteSingleSampleMapping(overflow_to_sample_mapping);
   std::vector<int64_t> input_ids;
   std::vector<int64_t> token_type_ids;
-  std::list<OffsetMappingType> offset_map;
 
   // Only compute offset mapping if optional output for it exists.
-  bool compute_offset_mapping = false;
-  if (offset_mapping.has_value()) {
-    compute_offset_mapping = true;
-  }
-
+  std::vector<int64_t> offsets1;
+  std::vector<int64_t> offsets2;
+  bool compute_offset_mapping = offset_mapping.has_value();
+
+  // a single text is only encoded up to the ids its truncation keeps, the pairs aren't truncated
+  std::vector<int64_t> encoded1 =
+      tokenizer_->Encode(input_data[0], compute_offset_mapping ? &offsets1 : nullptr,
+                         input_data.size() == 1 ? tokenizer_->MaxEncodedLength() : SIZE_MAX);
+  std::vector<int64_t> encoded2;
   if (input_data.size() == 1) {
-    std::vector<ustring> tokens = tokenizer_->Tokenize(ustring(input_data[0]), offset_map, compute_offset_mapping);
-    std::vector<int64_t> encoded = tokenizer_->Encode(tokens);
-    tokenizer_->Truncate(encoded);
-    input_ids = tokenizer_->AddSpecialToken(encoded);
-    token_type_ids = tokenizer_->GenerateTypeId(encoded);
+    tokenizer_->Truncate(encoded1);
+    input_ids = tokenizer_->AddSpecialToken(encoded1);
+    token_type_ids = tokenizer_->GenerateTypeId(encoded1);
   } else {
-    std::vector<ustring> tokens1 = tokenizer_->Tokenize(ustring(input_data[0]), offset_map, compute_offset_mapping);
-    std::vector<ustring> tokens2 = tokenizer_->Tokenize(ustring(input_data[1]), offset_map, compute_offset_mapping);
-    std::vector<int64_t> encoded1 = tokenizer_->Encode(tokens1);
-    std::vector<int64_t> encoded2 = tokenizer_->Encode(tokens2);
+    encoded2 = tokenizer_->Encode(input_data[1], compute_offset_mapping ? &offsets2 : nullptr);
     input_ids = tokenizer_->AddSpecialToken(encoded1, encoded2);
     token_type_ids = tokenizer_->GenerateTypeId(encoded1, encoded2);
   }
 
   std::vector<int64_t> attention_mask(input_ids.size(), 1);
+  PadToLength(padded_length_.Round(input_ids.size()), input_ids, token_type_ids, attention_mask);
 
   std::vector<int64_t> output_dim{static_cast<int64_t>(input_ids.size())};
 
@@ -376,50 +577,68 @@ void KernelBertTokenizer::Compute(const ortc::Tensor<std::string>& input,
 
   std::vector<int64_t> offset_dim{static_cast<int64_t>(input_ids.size()), 2};  // tuple of offsets for each input id
 
-  if (offset_mapping.has_value()) {
-    auto* offset = (*offset_mapping)->Allocate(offset_dim);
-    int idx2 = 0;
-    for (auto& res : offset_map) {
-      for (auto& mapping : res) {
-        offset[idx2] = mapping.first;
-        idx2++;
-        offset[idx2] = mapping.second;
-        idx2++;
-      }
+  if (compute_offset_mapping) {
+    auto* p_begin = (*offset_mapping)->Allocate(offset_dim);
+    auto* p_offset = CopyOffsetMapping(offsets1.data(), encoded1.size(), p_begin);
+    if (input_data.size() == 2) {
+      p_offset = CopyOffsetMapping(offsets2.data(), encoded2.size(), p_offset);
     }
+    // the last [SEP] and the padding
+    std::fill(p_offset, p_begin + offset_dim[0] * 2, 0);
   }
 }
 
+template <typename T>
+void KernelBertTokenizer<T>::InferOutputShape(const ortc::ShapeInferContext& ctx) {
+  // the ids of the query, whose length is unknown until then, or the [num_windows, window_length] windows
+  const ONNXTensorElementDataType type = GetOutputDtype(ctx);
+  const int64_t window_length = ctx.GetAttributeInt("window_length", 0);
+  const std::vector<int64_t> output_dims = window_length > 0 ? std::vector<int64_t>{-1, window_length}
+                                                             : std::vector<int64_t>{-1};
+  std::vector<int64_t> offset_dims = output_dims;
+  offset_dims.push_back(2);
+  ctx.SetOutput(0, type, output_dims);
+  ctx.SetOutput(1, type, output_dims);
+  ctx.SetOutput(2, type, output_dims);
+  ctx.SetOptionalOutput(3, type, offset_dims);
+  ctx.SetOptionalOutput(4, type, {window_length > 0 ? -1 : 1});
+}
+
+template struct KernelBertTokenizer<int64_t>;
+template struct KernelBertTokenizer<int32_t>;
+
 KernelHfBertTokenizer::KernelHfBertTokenizer(const OrtApi& api, const OrtKernelInfo& info)
-    : KernelBertTokenizer(api, info) {}
+    : KernelBertTokenizer<int64_t>(api, info) {}
 
-void KernelHfBertTokenizer::Compute(const ortc::Tensor<std::string>& input,
+void KernelHfBertTokenizer::Compute(const ortc::Tensor<std::string_view>& input,
                                     ortc::Tensor<int64_t>& output,
                                     ortc::Tensor<int64_t>& output1,
                                     ortc::Tensor<int64_t>& output2,
-                                    std::optional<ortc::Tensor<int64_t>*> offset_mapping) const {
+                                    std::optional<ortc::Tensor<int64_t>*> offset_mapping,
+                                    std::optional<ortc::Tensor<int64_t>*> overflow_to_sample_mapping) const {
   // Setup inputs
   auto& input_data = input.Data();
 
   if (input_data.size() != 2) {
     ORTX_CXX_API_THROW("[HfBertTokenizer]: Support only two input strings.", ORT_INVALID_GRAPH);
   }
-
-  std::list<OffsetMappingType> offset_map;
+  if (window_length_ > 0) {
+    ComputeWindows(input_data, output, output2, output1, offset_mapping, overflow_to_sample_mapping);
+    return;
+  }
+  WriteSingleSampleMapping(overflow_to_sample_mapping);
 
   // Only compute offset mapping if optional output for it exists.
-  bool compute_offset_mapping = false;
-  if (offset_mapping.has_value()) {
-    compute_offset_mapping = true;
-  }
+  std::vector<int64_t> offsets1;
+  std::vector<int64_t> offsets2;
+  bool compute_offset_mapping = offset_mapping.has_value();
 
-  std::vector<ustring> tokens1 = tokenizer_->Tokenize(ustring(input_data[0]), offset_map, compute_offset_mapping);
-  std::vector<ustring> tokens2 = tokenizer_->Tokenize(ustring(input_data[1]), offset_map, compute_offset_mapping);
-  std::vector<int64_t> encoded1 = tokenizer_->Encode(tokens1);
-  std::vector<int64_t> encoded2 = tokenizer_->Encode(tokens2);
+  std::vector<int64_t> encoded1 = tokenizer_->Encode(input_data[0], compute_offset_mapping ? &offsets1 : nullptr);
+  std::vector<int64_t> encoded2 = tokenizer_->Encode(input_data[1], compute_offset_mapping ? &offsets2 : nullptr);
   std::vector<int64_t> input_ids = tokenizer_->AddSpecialToken(encoded1, encoded2);
   std::vector<int64_t> token_type_ids = tokenizer_->GenerateTypeId(encoded1, encoded2);
   std::vector<int64_t> attention_mask(input_ids.size(), 1LL);
+  PadToLength(padded_length_.Round(input_ids.size()), input_ids, token_type_ids, attention_mask);
 
   const std::vector<int64_t> outer_dims{1LL, static_cast<int64_t>(input_ids.size())};
 
@@ -432,16 +651,23 @@ void KernelHfBertTokenizer::Compute(const ortc::Tensor<std::string>& input,
 
   std::vector<int64_t> offset_dim{static_cast<int64_t>(input_ids.size()), 2};  // tuple of offsets for each input id
 
-  if (offset_mapping.has_value()) {
-    auto* offset = (*offset_mapping)->Allocate(offset_dim);
-    int idx2 = 0;
-    for (auto& res : offset_map) {
-      for (auto& mapping : res) {
-        offset[idx2] = mapping.first;
-        idx2++;
-        offset[idx2] = mapping.second;
-        idx2++;
-      }
-    }
+  if (compute_offset_mapping) {
+    auto* p_begin = (*offset_mapping)->Allocate(offset_dim);
+    auto* p_offset = CopyOffsetMapping(offsets1.data(), encoded1.size(), p_begin);
+    p_offset = CopyOffsetMapping(offsets2.data(), encoded2.size(), p_offset);
+    // the last [SEP] and the padding
+    std::fill(p_offset, p_begin + offset_dim[0] * 2, 0);
   }
 }
+
+void KernelHfBertTokenizer::InferOutputShape(const ortc::ShapeInferContext& ctx) {
+  const int64_t window_length = ctx.GetAttributeInt("window_length", 0);
+  const std::vector<int64_t> output_dims{window_length > 0 ? -1 : 1, window_length > 0 ? window_length : -1};
+  const std::vector<int64_t> offset_dims = window_length > 0 ? std::vector<int64_t>{-1, window_length, 2}
+                                                             : std::vector<int64_t>{-1, 2};
+  ctx.SetOutput(0, ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64, output_dims);
+  ctx.SetOutput(1, ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64, output_dims);
+  ctx.SetOutput(2, ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64, output_dims);
+  ctx.SetOptionalOutput(3, ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64, offset_dims);
+  ctx.SetOptionalOutput(4, ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64, {output_dims[0]});
+}
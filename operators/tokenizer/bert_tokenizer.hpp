@@ -8,9 +8,13 @@
 #include "string_utils.h"
 #include "string_tensor.h"
 #include "basic_tokenizer.hpp"
+#include "wordpiece_trie.hpp"
+#include "numa.h"
+#include "token_vocab.h"
+#include "padded_length.hpp"
+#include "output_dtype.hpp"
 
 #include <unordered_map>
-#include <list>
 
 class BertTokenizerVocab final {
  public:
@@ -18,12 +22,17 @@ class BertTokenizerVocab final {
   bool FindToken(const ustring& token);
   bool FindTokenId(const ustring& token, int32_t& token_id);
   int32_t FindTokenId(const ustring& token);
+  const TokenVocab& GetVocab() const { return vocab_; }
 
  private:
-  std::string raw_vocab_;
-  std::unordered_map<std::string_view, int32_t> vocab_;
+  TokenVocab vocab_;
 };
 
+namespace ort_extensions {
+template <>
+struct IsNumaReplicable<WordpieceTrie> : std::true_type {};
+}  // namespace ort_extensions
+
 class TruncateStrategy final {
  public:
   explicit TruncateStrategy(std::string_view strategy_name);
@@ -45,12 +54,13 @@ class WordpieceTokenizer final {
   WordpieceTokenizer(
       std::shared_ptr<BertTokenizerVocab> vocab, ustring unk_token,
       ustring suffix_indicator, int max_input_chars_per_word = 100);
-  using OffsetMappingType = std::list<std::pair<size_t, size_t>>;
-  std::vector<ustring> Tokenize(const ustring& text, std::list<OffsetMappingType>& offset_map,
-                                bool compute_offset_mapping);
-  std::vector<ustring> Tokenize(const std::vector<ustring>& tokens, std::list<OffsetMappingType>& offset_map,
-                                bool compute_offset_mapping);
+  std::vector<ustring> Tokenize(const ustring& text);
+  std::vector<ustring> Tokenize(const std::vector<ustring>& tokens);
   std::vector<int64_t> Encode(const std::vector<ustring>& tokens);
+  // Appends the ids of the word as Encode(Tokenize(...)) would, and their (begin, end) offsets if offsets isn't null,
+  // where positions are the offsets of the characters of the word. The pieces are the scratch buffer of the trie.
+  void EncodeWord(std::u32string_view word, const int64_t* positions, std::vector<int32_t>& pieces,
+                  std::vector<int64_t>& ids, std::vector<int64_t>* offsets) const;
 
  private:
   int64_t max_input_chars_per_word_;
@@ -58,21 +68,34 @@ class WordpieceTokenizer final {
   ustring unk_token_;
   int32_t unk_token_id_;
   std::shared_ptr<BertTokenizerVocab> vocab_;
+  std::shared_ptr<const WordpieceTrie> trie_;
+  ort_extensions::NumaReplicas<WordpieceTrie> trie_replicas_;
+
+  // the trie, or its copy of the NUMA node of the thread with ORTX_NUMA_REPLICAS=1
+  const WordpieceTrie& Trie() const {
+    return ort_extensions::NumaTopology::ReplicasEnabled() ? *trie_replicas_.Get(trie_) : *trie_;
+  }
 
-  void GreedySearch(const ustring& token, std::vector<ustring>& tokenized_result);
+  void GreedySearch(const ustring& token, std::vector<int32_t>& pieces, std::vector<ustring>& tokenized_result);
 };
 
 class BertTokenizer final {
  public:
-  BertTokenizer(const std::string& vocab, bool do_lower_case, bool do_basic_tokenize,
+  BertTokenizer(std::string_view vocab, bool do_lower_case, bool do_basic_tokenize,
                 ustring unk_token, ustring sep_token, ustring pad_token, ustring cls_token,
                 ustring mask_token, bool tokenize_chinese_chars, bool strip_accents,
                 ustring suffix_indicator, int32_t max_len, const std::string& truncation_strategy);
-  using OffsetMappingType = std::list<std::pair<size_t, size_t>>;
-  std::vector<ustring> Tokenize(const ustring& text, std::list<OffsetMappingType>& offset_map,
-                                bool compute_offset_mapping);
+  std::vector<ustring> Tokenize(const ustring& text);
   std::vector<int64_t> Encode(const std::vector<ustring>& tokens);
-
+  // Encodes the UTF-8 text in one pass, which normalizes, splits and matches the words as it decodes the text,
+  // with the same ids as Encode(Tokenize(text)). If offsets isn't null, the (begin, end) character offsets
+  // of the ids in the text are appended to it, which are tracked through the normalization and the matching.
+  // The encoding stops once it has max_ids ids, which are the first ones of the whole text.
+  std::vector<int64_t> Encode(std::string_view text, std::vector<int64_t>* offsets = nullptr,
+                              size_t max_ids = SIZE_MAX) const;
+
+  // The ids of a single text which Truncate(ids) keeps, SIZE_MAX if it keeps them all.
+  size_t MaxEncodedLength() const;
   void Truncate(std::vector<int64_t>& ids);
   void Truncate(std::vector<int64_t>& ids1, std::vector<int64_t>& ids2);
 
@@ -80,6 +103,7 @@ class BertTokenizer final {
   std::vector<int64_t> AddSpecialToken(const std::vector<int64_t>& ids1, const std::vector<int64_t>& ids2);
   std::vector<int64_t> GenerateTypeId(const std::vector<int64_t>& ids);
   std::vector<int64_t> GenerateTypeId(const std::vector<int64_t>& ids1, const std::vector<int64_t>& ids2);
+  int32_t PadTokenId() const { return pad_token_id_; }
 
  private:
   int32_t unk_token_id_ = 0;
@@ -95,25 +119,49 @@ class BertTokenizer final {
   std::unique_ptr<WordpieceTokenizer> wordpiece_tokenizer_;
 };
 
+// The outputs are of T, int64_t or int32_t by the output_dtype attribute.
+template <typename T>
 struct KernelBertTokenizer : BaseKernel {
   KernelBertTokenizer(const OrtApi& api, const OrtKernelInfo& info);
-  void Compute(const ortc::Tensor<std::string>& input,
-               ortc::Tensor<int64_t>& output,
-               ortc::Tensor<int64_t>& output1,
-               ortc::Tensor<int64_t>& output2,
-               std::optional<ortc::Tensor<int64_t>*> offset_mapping) const;
-  using OffsetMappingType = std::list<std::pair<size_t, size_t>>;
+  static constexpr bool kShareableAcrossSessions = true;  // with ORTX_SHARE_KERNELS=1
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               ortc::Tensor<T>& output,
+               ortc::Tensor<T>& output1,
+               ortc::Tensor<T>& output2,
+               std::optional<ortc::Tensor<T>*> offset_mapping,
+               std::optional<ortc::Tensor<T>*> overflow_to_sample_mapping) const;
+
+  static void InferOutputShape(const ortc::ShapeInferContext& ctx);
 
  protected:
+  // Writes the [num_windows, window_length] outputs of the windows of the text, or of the second text of a pair,
+  // which follows the whole first one in each window.
+  void ComputeWindows(const std::vector<std::string_view>& input_data,
+                      ortc::Tensor<T>& input_ids,
+                      ortc::Tensor<T>& token_type_ids,
+                      ortc::Tensor<T>& attention_mask,
+                      std::optional<ortc::Tensor<T>*> offset_mapping,
+                      std::optional<ortc::Tensor<T>*> overflow_to_sample_mapping) const;
+
+  // Pads the outputs of the sequence to the length of padded_length_, which is at least their length.
+  void PadToLength(size_t length, std::vector<int64_t>& input_ids, std::vector<int64_t>& token_type_ids,
+                   std::vector<int64_t>& attention_mask) const;
+
   std::unique_ptr<BertTokenizer> tokenizer_;
+  size_t window_length_ = 0;  // 0 for no windows
+  size_t stride_ = 0;
+  PaddedLength padded_length_;
 };
 
-struct KernelHfBertTokenizer : KernelBertTokenizer {
+struct KernelHfBertTokenizer : KernelBertTokenizer<int64_t> {
   KernelHfBertTokenizer(const OrtApi& api, const OrtKernelInfo& info);
-  using OffsetMappingType = std::list<std::pair<size_t, size_t>>;
-  void Compute(const ortc::Tensor<std::string>& input,
+  void Compute(const ortc::Tensor<std::string_view>& input,
                ortc::Tensor<int64_t>& output,
                ortc::Tensor<int64_t>& output1,
                ortc::Tensor<int64_t>& output2,
-               std::optional<ortc::Tensor<int64_t>*> offset_mapping) const;
+               std::optional<ortc::Tensor<int64_t>*> offset_mapping,
+               std::optional<ortc::Tensor<int64_t>*> overflow_to_sample_mapping) const;
+
+  // the outputs are [1, length], or the windows, instead of the ones of the BertTokenizer
+  static void InferOutputShape(const ortc::ShapeInferContext& ctx);
 };
@@ -1,4 +1,6 @@
 #include "bert_tokenizer_decoder.hpp"
+#include "asset_attribute.h"
+#include "parallel_for.h"
 
 BertTokenizerDecoder::BertTokenizerDecoder(
     std::string vocab,
@@ -21,7 +23,7 @@ BertTokenizerDecoder::BertTokenizerDecoder(
       sep_token_id_ = static_cast<int32_t>(i);
     }
     if (token == pad_token) {
-      sep_token_id_ = static_cast<int32_t>(i);
+      pad_token_id_ = static_cast<int32_t>(i);
     }
     if (token == cls_token) {
       cls_token_id_ = static_cast<int32_t>(i);
@@ -32,25 +34,40 @@ BertTokenizerDecoder::BertTokenizerDecoder(
 
     if (token.rfind(suffix_indicator_, 0) == 0) {
       vocab_.emplace_back(token.substr(suffix_indicator.size(), token.size() - suffix_indicator.size()));
-      is_substr_.push_back(true);
+      flags_.push_back(kSubword | CleanUpFlags(vocab_.back()));
     } else {
       vocab_.push_back(token);
-      is_substr_.push_back(false);
+      flags_.push_back(CleanUpFlags(token));
     }
   }
 }
 
-std::string BertTokenizerDecoder::Decode(const std::vector<int64_t>& ids, bool skip_special_tokens, bool clean_up_tokenization_spaces) {
+std::string BertTokenizerDecoder::Decode(const int64_t* ids, size_t count, bool skip_special_tokens,
+                                         bool clean_up_tokenization_spaces) const {
+  const auto is_special = [this](int64_t id) {
+    return id == sep_token_id_ || id == pad_token_id_ || id == cls_token_id_ || id == mask_token_id_;
+  };
+  const auto in_vocab = [this](int64_t id) { return id >= 0 && static_cast<size_t>(id) < vocab_.size(); };
+
+  // the output is reserved for all the tokens and their spaces, so it's never reallocated
+  size_t size = 0;
+  for (size_t i = 0; i < count; ++i) {
+    size += (in_vocab(ids[i]) ? vocab_[static_cast<size_t>(ids[i])].size() : unk_token_.size()) + 1;
+  }
   std::string result;
-  int64_t pre_token = -1;
-
-  for (auto id : ids) {
-    if (skip_special_tokens && (id == sep_token_id_ || id == pad_token_id_ || id == cls_token_id_ || id == mask_token_id_)) {
+  result.reserve(size);
+
+  // the flags of the last token of the vocab which was appended. Until the first one, the cleanup adds no space
+  // before the tokens, even after an unk token.
+  uint8_t pre_flags = kNoSpaceAfter;
+  for (size_t i = 0; i < count; ++i) {
+    const int64_t id = ids[i];
+    if (skip_special_tokens && is_special(id)) {
       continue;
     }
 
     // deal with unk ids
-    if (id < 0 || static_cast<size_t>(id) >= vocab_.size()) {
+    if (!in_vocab(id)) {
       if (!result.empty()) {
         result.push_back(' ');
       }
@@ -59,68 +76,70 @@ std::string BertTokenizerDecoder::Decode(const std::vector<int64_t>& ids, bool s
     }
 
     // skip first substr
-    if (result.empty() && is_substr_[static_cast<size_t>(id)]) {
+    const uint8_t flags = flags_[static_cast<size_t>(id)];
+    if (result.empty() && (flags & kSubword) != 0) {
       continue;
     }
 
     // At following situations, we needn't add space
     // we needn't add a space at the beginning of the output
     // we needn't add a space when the token is a substr (such as ##ing)
-    // we needn't add a space at the left or right of punctuation (such as client-side shouldn't be client - side), when clean_up_tokenization_spaces is true
-    if (!(result.empty() || is_substr_[static_cast<size_t>(id)] || (clean_up_tokenization_spaces && RemoveTokenizeSpace(pre_token, id)))) {
+    // we needn't add a space at the left or right of punctuation (such as client-side shouldn't be client - side),
+    // when clean_up_tokenization_spaces is true
+    const bool clean_up = clean_up_tokenization_spaces &&
+                          ((pre_flags & kNoSpaceAfter) != 0 || (flags & kNoSpaceBefore) != 0);
+    if (!(result.empty() || (flags & kSubword) != 0 || clean_up)) {
       result.push_back(' ');
     }
 
     result.append(vocab_[static_cast<size_t>(id)]);
-    pre_token = id;
+    pre_flags = flags;
   }
 
   return result;
 }
 
-bool BertTokenizerDecoder::RemoveTokenizeSpace(int64_t pre_token_id, int64_t new_token_id) {
-  if (pre_token_id < 0) {
-    return true;
+uint8_t BertTokenizerDecoder::CleanUpFlags(std::string_view token) {
+  if (token.empty()) {
+    return 0;
   }
 
-  auto pre_char = ustring(vocab_[static_cast<size_t>(pre_token_id)]).back();
-  auto cur_char = ustring(vocab_[static_cast<size_t>(new_token_id)])[0];
-
-  // normal punctuation
-  if (cur_char == U'!' || cur_char == U'.' || cur_char == U'?' || cur_char == U',' || cur_char == '~' || cur_char == ':') {
-    return true;
+  size_t len = 0;
+  const char32_t first_char = ustring::DecodeUTF8Char(token, 0, len);
+  size_t last = token.size() - 1;
+  while (last > 0 && (static_cast<unsigned char>(token[last]) & 0xC0) == 0x80) {
+    --last;
   }
+  const char32_t last_char = ustring::DecodeUTF8Char(token, last, len);
 
-  // only remove left side space
-  if (cur_char == U'}' || cur_char == U']' || cur_char == U'>' || cur_char == ')') {
-    return true;
+  uint8_t flags = 0;
+  // normal punctuation, and the ones which only remove the left side space
+  if (first_char == U'!' || first_char == U'.' || first_char == U'?' || first_char == U',' || first_char == U'~' ||
+      first_char == U':' || first_char == U'}' || first_char == U']' || first_char == U'>' || first_char == U')') {
+    flags |= kNoSpaceBefore;
   }
 
   // only remove right side space
-  if (pre_char == U'{' || pre_char == U'[' || pre_char == U'<' || pre_char == '(' || pre_char == '$') {
-    return true;
+  if (last_char == U'{' || last_char == U'[' || last_char == U'<' || last_char == U'(' || last_char == U'$') {
+    flags |= kNoSpaceAfter;
   }
 
   // remove both side space
-  if (pre_char == U'-' || pre_char == U'\'' || pre_char == U'"' || pre_char == U'/' || pre_char == U'@' || pre_char == U'\\' ||
-      cur_char == U'-' || cur_char == U'\'' || cur_char == U'"' || cur_char == U'/' || cur_char == U'@' || cur_char == U'\\') {
-    return true;
-  }
-
-  // remove both space beside unicode punctuation
-  if (pre_char > 128 && IsPunct(pre_char)) {
-    return true;
+  const auto both_sides = [](char32_t c) {
+    return c == U'-' || c == U'\'' || c == U'"' || c == U'/' || c == U'@' || c == U'\\' || (c > 128 && IsPunct(c));
+  };
+  if (both_sides(first_char)) {
+    flags |= kNoSpaceBefore;
   }
-
-  if (cur_char > 128 && IsPunct(cur_char)) {
-    return true;
+  if (both_sides(last_char)) {
+    flags |= kNoSpaceAfter;
   }
-
-  return false;
+  return flags;
 }
 
 KernelBertTokenizerDecoder::KernelBertTokenizerDecoder(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
-  std::string vocab = ort_.KernelInfoGetAttribute<std::string>(&info, "vocab_file");
+  // the decoder keeps the views of the tokens in its copy of the vocab
+  std::string vocab(ort_extensions::GetAssetAttribute(*this, "vocab_file").View());
   std::string unk_token = TryToGetAttributeWithDefault("unk_token", std::string("[UNK]"));
   std::string sep_token = TryToGetAttributeWithDefault("sep_token", std::string("[SEP]"));
   std::string pad_token = TryToGetAttributeWithDefault("pad_token", std::string("[PAD]"));
@@ -142,11 +161,12 @@ void KernelBertTokenizerDecoder::Compute(const ortc::Tensor<int64_t>& ids,
   const int64_t* p_ids = ids.Data();
   auto& ids_dim = ids.Shape();
 
-  if (!((ids_dim.size() == 1) || (ids_dim.size() == 2 && ids_dim[0] == 1))) {
-    ORTX_CXX_API_THROW("[BertTokenizerDecoder]: Expect ids dimension [n] or [1,n].", ORT_INVALID_GRAPH);
+  if (ids_dim.size() != 1 && ids_dim.size() != 2) {
+    ORTX_CXX_API_THROW("[BertTokenizerDecoder]: Expect ids dimension [n] or [batch, n].", ORT_INVALID_GRAPH);
   }
+  const size_t batch = ids_dim.size() == 1 ? 1 : static_cast<size_t>(ids_dim[0]);
+  const size_t seq_len = static_cast<size_t>(ids_dim.back());
 
-  //  const int64_t* p_row_indices = ort_row_indices_dim.empty() ? nullptr : ort_.GetTensorData<int64_t>(ort_row_indices);
   auto& positions_dim = positions.Shape();
   if (use_indices_ &&
       (!((positions.NumberOfElement() == 0) ||
@@ -154,26 +174,40 @@ void KernelBertTokenizerDecoder::Compute(const ortc::Tensor<int64_t>& ids,
     ORTX_CXX_API_THROW("[BertTokenizerDecoder]: Expect positions empty or a [n, 2] matrix when use indices",
                        ORT_INVALID_GRAPH);
   }
+  if (use_indices_ && batch != 1) {
+    ORTX_CXX_API_THROW("[BertTokenizerDecoder]: Expect ids dimension [n] or [1, n] when use indices",
+                       ORT_INVALID_GRAPH);
+  }
 
   const int64_t* p_positions = positions.NumberOfElement() == 0 ? nullptr : positions.Data();
 
-  std::vector<std::string> result;
-  std::vector<int64_t> output_dim(1);
+  // the spans of the ids of each output, which are the rows of the batch, or the ranges of the positions
+  std::vector<std::pair<size_t, size_t>> spans;
   if (!use_indices_) {
-    result.push_back(decoder_->Decode(std::vector<int64_t>(p_ids, p_ids + ids.NumberOfElement()),
-                                      skip_special_tokens_, clean_up_tokenization_spaces_));
-    output_dim[0] = 1;
-  } else {
-    if (p_positions != nullptr) {
-      for (int i = 0; i < positions_dim[0]; i++) {
-        int64_t start = p_positions[2 * i];
-        int64_t end = p_positions[2 * i + 1];
-
-        result.push_back(decoder_->Decode(std::vector<int64_t>(p_ids + start, p_ids + end),
-                                          skip_special_tokens_, clean_up_tokenization_spaces_));
+    for (size_t i = 0; i < batch; ++i) {
+      spans.emplace_back(i * seq_len, seq_len);
+    }
+  } else if (p_positions != nullptr) {
+    for (int64_t i = 0; i < positions_dim[0]; i++) {
+      int64_t start = p_positions[2 * i];
+      int64_t end = p_positions[2 * i + 1];
+      if (start < 0 || start > end || end > static_cast<int64_t>(seq_len)) {
+        ORTX_CXX_API_THROW(MakeString("[BertTokenizerDecoder]: The position [", start, ", ", end,
+                                      "] is out of the range of the ids of ", seq_len),
+                           ORT_INVALID_ARGUMENT);
       }
-      output_dim[0] = positions_dim[0];
+      spans.emplace_back(static_cast<size_t>(start), static_cast<size_t>(end - start));
     }
   }
-  output.SetStringOutput(result, output_dim);
+
+  // the sequences are decoded in parallel, which is the most of the time of the batches of the answers
+  std::vector<std::string> result(spans.size());
+  ParallelFor(Ort::Custom::ComputeContext::Current(), spans.size(), 16.0 * static_cast<double>(seq_len),
+              [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                  result[i] = decoder_->Decode(p_ids + spans[i].first, spans[i].second, skip_special_tokens_,
+                                               clean_up_tokenization_spaces_);
+                }
+              });
+  output.SetStringOutput(result, {static_cast<int64_t>(result.size())});
 }
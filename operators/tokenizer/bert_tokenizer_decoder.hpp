@@ -12,9 +12,18 @@ class BertTokenizerDecoder {
  public:
   BertTokenizerDecoder(std::string vocab, std::string unk_token, std::string sep_token, std::string pad_token,
                        std::string cls_token, std::string mask_token, std::string suffix_indicator);
-  std::string Decode(const std::vector<int64_t>& ids, bool skip_special_tokens, bool clean_up_tokenization_spaces);
+  std::string Decode(const int64_t* ids, size_t count, bool skip_special_tokens,
+                     bool clean_up_tokenization_spaces) const;
 
  private:
+  // the flags of a token, in which the spaces that clean_up_tokenization_spaces removes are found once for the
+  // vocab, and not for every pair of the decoded tokens
+  enum TokenFlags : uint8_t {
+    kSubword = 1,        // a suffix, which is appended without a space
+    kNoSpaceBefore = 2,  // such as the punctuation, or the closing brackets
+    kNoSpaceAfter = 4,   // such as the opening brackets
+  };
+
   std::string unk_token_;
   int32_t unk_token_id_ = -1;
   int32_t sep_token_id_ = -1;
@@ -24,9 +33,9 @@ class BertTokenizerDecoder {
   std::string suffix_indicator_;
   std::vector<std::string_view> vocab_;
   std::string raw_vocab_;
-  std::vector<bool> is_substr_;
+  std::vector<uint8_t> flags_;
 
-  bool RemoveTokenizeSpace(int64_t pre_token_id, int64_t new_token_id);
+  static uint8_t CleanUpFlags(std::string_view token);
 };
 
 struct KernelBertTokenizerDecoder : BaseKernel {
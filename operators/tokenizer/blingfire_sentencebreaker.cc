@@ -3,12 +3,28 @@
 
 #include "blingfire_sentencebreaker.hpp"
 #include "string_tensor.h"
+#include "parallel_for.h"
+#include "scratch_arena.h"
 #include <vector>
-#include <locale>
-#include <codecvt>
 #include <algorithm>
+#include <cstring>
 #include <memory>
 
+namespace {
+// Calls fn(sentence) on the sentences of the '\n' separated text, in which a trailing '\n' starts no sentence.
+template <typename Fn>
+void ForEachSentence(std::string_view text, Fn&& fn) {
+  size_t begin = 0;
+  for (size_t end = text.find('\n'); end != std::string_view::npos && end + 1 < text.size();
+       end = text.find('\n', begin)) {
+    fn(text.substr(begin, end - begin));
+    begin = end + 1;
+  }
+  const size_t end = text.find('\n', begin);
+  fn(text.substr(begin, end == std::string_view::npos ? std::string_view::npos : end - begin));
+}
+}  // namespace
+
 KernelBlingFireSentenceBreaker::KernelBlingFireSentenceBreaker(const OrtApi& api, const OrtKernelInfo& info)
     : BaseKernel(api, info), max_sentence(-1) {
   model_data_ = ort_.KernelInfoGetAttribute<std::string>(&info, "model");
@@ -26,42 +42,103 @@ KernelBlingFireSentenceBreaker::KernelBlingFireSentenceBreaker(const OrtApi& api
   model_ = std::shared_ptr<void>(model_ptr, FreeModel);
 
   max_sentence = TryToGetAttributeWithDefault("max_sentence", -1);
+  offsets_only_ = TryToGetAttributeWithDefault<int64_t>("offsets_only", 0) != 0;
 }
 
-void KernelBlingFireSentenceBreaker::Compute(std::string_view input,
-                                             ortc::Tensor<std::string>& output) const {
-  int max_length = static_cast<int>(2 * input.size() + 1);
-  std::unique_ptr<char[]> output_str = std::make_unique<char[]>(max_length);
+void KernelBlingFireSentenceBreaker::Split(std::string_view document, bool with_offsets,
+                                           Sentences& sentences) const {
+  // the buffers of the model's output are taken from the scratch arena of the thread, which keeps them for the next
+  // documents
+  ScratchScope scratch;
+  const int max_length = static_cast<int>(2 * document.size() + 1);
+  ScratchVector<char> text(max_length);
+  ScratchVector<int> starts(with_offsets ? max_length : 0);
+  ScratchVector<int> ends(with_offsets ? max_length : 0);
 
-  int output_length = TextToSentencesWithOffsetsWithModel(input.data(), static_cast<int>(input.size()),
-                                                          output_str.get(), nullptr, nullptr, max_length,
+  int output_length = TextToSentencesWithOffsetsWithModel(document.data(), static_cast<int>(document.size()),
+                                                          text.data(), with_offsets ? starts.data() : nullptr,
+                                                          with_offsets ? ends.data() : nullptr, max_length,
                                                           model_.get());
   if (output_length < 0) {
-    ORTX_CXX_API_THROW(MakeString("splitting input:\"", input, "\"  failed"), ORT_INVALID_ARGUMENT);
+    ORTX_CXX_API_THROW(MakeString("splitting input:\"", document, "\"  failed"), ORT_INVALID_ARGUMENT);
   }
 
-  // inline split output_str by newline '\n'
-  std::vector<const char*> output_sentences;
-
-  if (output_length == 0) {
-    // put one empty string if output_length is 0
-    output_sentences.push_back("");
-  } else {
-    bool head_flag = true;
-    for (int i = 0; i < output_length; i++) {
-      if (head_flag) {
-        output_sentences.push_back(&output_str[i]);
-        head_flag = false;
-      }
+  // a document without a sentence gets one empty sentence
+  const std::string_view output(text.data(), static_cast<size_t>(output_length));
+  sentences.count = 0;
+  ForEachSentence(output, [&sentences](std::string_view) { ++sentences.count; });
+  if (!offsets_only_) {
+    sentences.text.assign(output);
+  }
+  if (with_offsets) {
+    // the end offsets of the model are the last bytes of the sentences
+    sentences.offsets.assign(sentences.count * 2, 0);
+    for (size_t i = 0; output_length > 0 && i < sentences.count; ++i) {
+      sentences.offsets[2 * i] = starts[i];
+      sentences.offsets[2 * i + 1] = static_cast<int64_t>(ends[i]) + 1;
+    }
+  }
+}
 
-      if (output_str[i] == '\n') {
-        head_flag = true;
-        output_str[i] = '\0';
-      }
+void KernelBlingFireSentenceBreaker::Compute(const ortc::Tensor<std::string_view>& input,
+                                             ortc::Tensor<std::string>& output,
+                                             std::optional<ortc::Tensor<int64_t>*> row_splits,
+                                             std::optional<ortc::Tensor<int64_t>*> offsets) const {
+  auto& documents = input.Data();
+  const size_t num_documents = documents.size();
+  const bool with_offsets = offsets.has_value() && *offsets != nullptr;
+
+  size_t total_size = 0;
+  for (const auto& document : documents) {
+    total_size += document.size();
+  }
+  const double cost = 64.0 * static_cast<double>(total_size) / static_cast<double>(std::max<size_t>(num_documents, 1));
+
+  std::vector<Sentences> sentences(num_documents);
+  ParallelFor(Ort::Custom::ComputeContext::Current(), num_documents, cost, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      Split(documents[i], with_offsets, sentences[i]);
+    }
+  });
+
+  std::vector<size_t> row_begins(num_documents + 1);
+  for (size_t i = 0; i < num_documents; ++i) {
+    row_begins[i + 1] = row_begins[i] + sentences[i].count;
+  }
+  const size_t num_sentences = row_begins[num_documents];
+
+  if (row_splits.has_value() && *row_splits != nullptr) {
+    int64_t* p_splits = (*row_splits)->Allocate({static_cast<int64_t>(num_documents + 1)});
+    std::copy(row_begins.begin(), row_begins.end(), p_splits);
+  }
+
+  if (with_offsets) {
+    int64_t* p_offsets = (*offsets)->Allocate({static_cast<int64_t>(num_sentences), 2});
+    for (size_t i = 0; i < num_documents; ++i) {
+      std::copy(sentences[i].offsets.begin(), sentences[i].offsets.end(), p_offsets + 2 * row_begins[i]);
     }
   }
 
-  std::vector<int64_t> output_dimensions(1);
-  output_dimensions[0] = output_sentences.size();
-  output.SetStringOutput(output_sentences, output_dimensions);
+  if (offsets_only_) {
+    output.SetStringOutput(std::vector<const char*>{}, {0});
+    return;
+  }
+
+  std::vector<size_t> sizes;
+  sizes.reserve(num_sentences);
+  for (const auto& document : sentences) {
+    ForEachSentence(document.text, [&sizes](std::string_view sentence) { sizes.push_back(sentence.size()); });
+  }
+
+  // the sentences are copied straight into the strings of the output
+  output.SetStringOutput({static_cast<int64_t>(num_sentences)}, sizes, [&](const std::vector<char*>& buffers) {
+    ParallelFor(Ort::Custom::ComputeContext::Current(), num_documents, 2.0 * cost, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        size_t j = row_begins[i];
+        ForEachSentence(sentences[i].text, [&buffers, &j](std::string_view sentence) {
+          std::memcpy(buffers[j++], sentence.data(), sentence.size());
+        });
+      }
+    });
+  });
 }
@@ -6,6 +6,8 @@
 #include "ocos.h"
 #include "string_utils.h"
 
+#include <optional>
+
 extern "C" const int TextToSentencesWithOffsetsWithModel(
     const char* pInUtf8Str, int InUtf8StrByteCount,
     char* pOutUtf8Str, int* pStartOffsets, int* pEndOffsets,
@@ -15,14 +17,29 @@ extern "C" int FreeModel(void* ModelPtr);
 
 extern "C" void* SetModel(const unsigned char* pImgBytes, int ModelByteCount);
 
+// Splits each document of the input into its sentences, which are output in one flat tensor with the row splits of
+// the documents, like the other ragged outputs, and the optional [begin, end) byte offsets of the sentences in their
+// documents. With offsets_only, the sentences output is empty, and the callers slice the input by the offsets.
 struct KernelBlingFireSentenceBreaker : BaseKernel {
   KernelBlingFireSentenceBreaker(const OrtApi& api, const OrtKernelInfo& info);
-  void Compute(std::string_view input,
-               ortc::Tensor<std::string>& output) const;
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               ortc::Tensor<std::string>& output,
+               std::optional<ortc::Tensor<int64_t>*> row_splits,
+               std::optional<ortc::Tensor<int64_t>*> offsets) const;
 
  private:
+  // the sentences of a document, separated by '\n' in text, and the offsets of each of them
+  struct Sentences {
+    std::string text;
+    std::vector<int64_t> offsets;
+    size_t count = 0;
+  };
+
+  void Split(std::string_view document, bool with_offsets, Sentences& sentences) const;
+
   using ModelPtr = std::shared_ptr<void>;
   ModelPtr model_;
   std::string model_data_;
   int max_sentence;
+  bool offsets_only_{};
 };
@@ -6,47 +6,43 @@
 #include "ocos.h"
 #include "ustring.h"
 #include "narrow.h"
+#include "token_vocab.h"
+#include "string_utils.h"
+#include "parallel_for.h"
+#include "shared_registry.h"
+#include "background_load.h"
+#include "asset_attribute.h"
+#include "runtime_stats.h"
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <sstream>
 #include <string>
 #include <vector>
-#include <locale>
-#include <codecvt>
-#include <set>
-#include <map>
 #include <unordered_map>
 
 struct KernelBpeDecoder : public BaseKernel {
  public:
   KernelBpeDecoder(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
-    std::string vocab = ort_.KernelInfoGetAttribute<std::string>(&info, "id_vocab");
+    ort_extensions::AssetBytes vocab = ort_extensions::GetAssetAttribute(*this, "id_vocab");
     if (vocab.empty()) {
       ORTX_CXX_API_THROW("[BPEDecoder]id vocab text cannot be empty.", ORT_INVALID_ARGUMENT);
     }
-    BuildIdVocab(vocab);
 
     std::string byte_decoder = ort_.KernelInfoGetAttribute<std::string>(&info, "byte_decoder");
     if (byte_decoder.empty()) {
       ORTX_CXX_API_THROW("[BPEDecoder]byte_decoder cannot be empty.", ORT_INVALID_ARGUMENT);
-    } else {
-      auto um = ParseId2String(byte_decoder);
-      std::transform(um.begin(), um.end(),
-                     std::inserter(byte_decoder_, byte_decoder_.end()),
-                     [](const auto& p) { return std::make_pair(static_cast<char32_t>(p.first),
-                                                               ort_extensions::narrow<unsigned char>(std::stoul(p.second))); });
     }
 
     std::string added_tokens = TryToGetAttributeWithDefault<std::string>("added_tokens", "");
-    if (!added_tokens.empty()) {
-      auto um = ParseId2String(added_tokens);
-      added_tokens_ = std::map<int64_t, std::string>(um.begin(), um.end());
-    }
-
     std::string all_special_ids = TryToGetAttributeWithDefault<std::string>("all_special_ids", "");
-    if (!all_special_ids.empty()) {
-      auto um = ParseId2String(all_special_ids);
-      std::transform(um.begin(), um.end(),
-                     std::inserter(all_special_ids_, all_special_ids_.end()),
-                     [](const auto& p) { return p.first; });
-    }
+    decoded_.Start([vocab = std::move(vocab), byte_decoder = std::move(byte_decoder),
+                    added_tokens = std::move(added_tokens), all_special_ids = std::move(all_special_ids)]() {
+      return SharedRegistry<DecodedTokens>::Instance().GetOrLoad(
+          {vocab, byte_decoder, added_tokens, all_special_ids},
+          [&]() { return DecodedTokens::Load(vocab, byte_decoder, added_tokens, all_special_ids); });
+    });
 
     en_normalization_ = TryToGetAttributeWithDefault<int64_t>("en_normalization", 0);
     skip_special_tokens_ = TryToGetAttributeWithDefault<int64_t>("skip_special_tokens", 0);
@@ -54,9 +50,11 @@ struct KernelBpeDecoder : public BaseKernel {
     bos_token_ = TryToGetAttributeWithDefault("bos_token", std::string("<|endoftext|>"));
     eos_token_ = TryToGetAttributeWithDefault("eos_token", std::string("<|endoftext|>"));
     unk_token_ = TryToGetAttributeWithDefault("unk_token", std::string("<|endoftext|>"));
+
+    num_threads_ = ReadNumThreadsAttribute(*this);
   }
 
-  std::unordered_map<int64_t, std::string> ParseId2String(const std::string& s_attr) {
+  static std::unordered_map<int64_t, std::string> ParseId2String(const std::string& s_attr) {
     std::unordered_map<int64_t, std::string> result;
     result.reserve(s_attr.size() / 4);
     std::stringstream ss(s_attr);
@@ -77,26 +75,21 @@ struct KernelBpeDecoder : public BaseKernel {
     return result;
   }
 
-  void BuildIdVocab(const std::string& vocab) {
-    arr_vocab_.reserve(vocab.size() / 2);  // give a rough estimation.
-
-    std::u32string u_vocab = ustring(vocab);
-    std::u32string_view uv_vocab(u_vocab);
+  static TokenVocab BuildIdVocab(std::string_view vocab) {
+    // the id of a token is its line number
+    TokenVocab id_vocab;
+    int32_t id = 0;
     size_t last_pos = 0;
-
-    auto ccount = uv_vocab.size();
-    for (size_t n = 0; n < ccount; ++n) {
-      if (uv_vocab[n] == char32_t('\n')) {
-        std::u32string_view s_tok = uv_vocab.substr(last_pos, n - last_pos);
-        arr_vocab_.emplace_back(ustring(s_tok));
-        last_pos = n + 1;
-      } else if (n == ccount - 1) {
-        std::u32string_view s_tok = uv_vocab.substr(last_pos, n - last_pos + 1);
-        arr_vocab_.emplace_back(ustring(s_tok));
+    while (last_pos < vocab.size()) {
+      size_t pos = vocab.find('\n', last_pos);
+      if (pos == std::string_view::npos) {
+        pos = vocab.size();
       }
+      id_vocab.Add(vocab.substr(last_pos, pos - last_pos), id++);
+      last_pos = pos + 1;
     }
 
-    arr_vocab_.shrink_to_fit();
+    return id_vocab;
   }
 
   void Compute(const ortc::Tensor<int64_t>& ids,
@@ -109,62 +102,187 @@ struct KernelBpeDecoder : public BaseKernel {
       std::copy(ids_dim.begin(), ids_dim.begin() + ids_dim.size() - 1, output_dim.begin());
     }
 
-    size_t seq_len = ids_dim.back();
-    size_t string_batch = ids.NumberOfElement() / seq_len;
-    std::vector<std::string> decoded_strings;
-    decoded_strings.reserve(string_batch);
+    // every string is decoded from a row of the last dimension, and the rows are decoded concurrently.
+    const size_t seq_len = ids_dim.empty() ? 1 : static_cast<size_t>(ids_dim.back());
+    size_t string_batch = 1;
+    for (int64_t dim : output_dim) {
+      string_batch *= static_cast<size_t>(dim);
+    }
+    std::vector<std::string> decoded_strings(string_batch);
+    ParallelFor(string_batch, num_threads_, [&](size_t begin, size_t end) {
+      for (size_t n = begin; n < end; ++n) {
+        decoded_strings[n] = Decode(p_ids + n * seq_len, seq_len);
+      }
+    });
+    output.SetStringOutput(decoded_strings, output_dim);
+  }
 
-    for (auto n = string_batch; n > 0; n--) {
-      std::string text;
-      bool f_special_last = false;
-      bool f_special = false;
-      auto count = static_cast<size_t>(ids.NumberOfElement());
+ private:
+  enum TokenFlag : uint8_t {
+    kSpecial = 1,      // in all_special_ids
+    kDecoded = 2,      // an added token or in the vocab, which is decoded in decoded_bytes_
+    kUndecodable = 4,  // in the vocab, but some characters aren't in the byte decoder
+  };
 
-      for (size_t tok_idx = 0; tok_idx < count; ++tok_idx) {
-        const auto token = *(p_ids + tok_idx);
-        std::string decoded_token;
-        f_special = all_special_ids_.count(token) ? true : false;
-        if (skip_special_tokens_ && f_special) {
-          f_special_last = f_special;
-          continue;
+  // The decoded bytes of all the tokens and their flags, which the kernels of the same vocab share.
+  struct DecodedTokens {
+    // Decodes all the tokens at once into one arena, in which the added tokens take the place of the vocab ones.
+    static std::shared_ptr<const DecodedTokens> Load(std::string_view vocab, const std::string& byte_decoder,
+                                                     const std::string& added_tokens_attr,
+                                                     const std::string& all_special_ids) {
+      TokenVocab id_vocab = BuildIdVocab(vocab);
+
+      // the byte decoder maps the characters of the byte-level vocab, which are all below 512, to the bytes.
+      std::vector<int16_t> byte_table;
+      for (const auto& [ch, byte] : ParseId2String(byte_decoder)) {
+        if (ch < 0) {
+          ORTX_CXX_API_THROW("[BPEDecoder]invalid character in byte_decoder.", ORT_INVALID_ARGUMENT);
+        }
+        if (static_cast<size_t>(ch) >= byte_table.size()) {
+          byte_table.resize(static_cast<size_t>(ch) + 1, -1);
         }
+        byte_table[ch] = ort_extensions::narrow<unsigned char>(std::stoul(byte));
+      }
 
-        if (added_tokens_.count(token)) {
-          const std::string ws = added_tokens_.at(token);
-          decoded_token = (std::string)ws;
-        } else if (static_cast<size_t>(token) < arr_vocab_.size()) {
-          const auto str = arr_vocab_[token];
-          for (auto wchr : str) {
-            unsigned char uchr = byte_decoder_.at(wchr);
-            decoded_token.push_back(uchr);
-          }
-        } else {
-          if (skip_special_tokens_) {
-            continue;
-          } else {
-            decoded_token = unk_token_;
+      std::unordered_map<int64_t, std::string> added_tokens;
+      if (!added_tokens_attr.empty()) {
+        added_tokens = ParseId2String(added_tokens_attr);
+      }
+
+      auto decoded = std::make_shared<DecodedTokens>();
+      std::vector<uint8_t>& token_flags = decoded->flags;
+      if (!all_special_ids.empty()) {
+        for (const auto& [id, str] : ParseId2String(all_special_ids)) {
+          if (id >= 0) {
+            if (static_cast<size_t>(id) >= token_flags.size()) {
+              token_flags.resize(static_cast<size_t>(id) + 1, 0);
+            }
+            token_flags[id] |= kSpecial;
           }
         }
+      }
+
+      size_t id_limit = std::max(id_vocab.IdLimit(), token_flags.size());
+      for (const auto& [id, token] : added_tokens) {
+        if (id >= 0) {
+          id_limit = std::max(id_limit, static_cast<size_t>(id) + 1);
+        }
+      }
+      token_flags.resize(id_limit, 0);
+      std::string& decoded_bytes = decoded->bytes;
+      std::vector<uint32_t>& decoded_offsets = decoded->offsets;
+      decoded_offsets.assign(id_limit + 1, 0);
 
-        if (whitespace_token_ &&
-            f_special && (tok_idx > 0 && !f_special_last)) {
-          text.push_back(' ');
+      for (size_t id = 0; id < id_limit; ++id) {
+        decoded_offsets[id] = static_cast<uint32_t>(decoded_bytes.size());
+        auto added = added_tokens.find(static_cast<int64_t>(id));
+        if (added != added_tokens.end()) {
+          decoded_bytes.append(added->second);
+          token_flags[id] |= kDecoded;
+        } else if (id_vocab.HasId(id)) {
+          std::string_view str = id_vocab.Token(id);
+          size_t begin = decoded_bytes.size();
+          for (size_t pos = 0, len = 0; pos < str.size(); pos += len) {
+            char32_t ch = ustring::DecodeUTF8Char(str, pos, len);
+            if (ch >= byte_table.size() || byte_table[ch] < 0) {
+              token_flags[id] |= kUndecodable;
+              decoded_bytes.resize(begin);
+              break;
+            }
+            decoded_bytes.push_back(static_cast<char>(byte_table[ch]));
+          }
+          token_flags[id] |= kDecoded;
         }
+      }
+      decoded_offsets[id_limit] = static_cast<uint32_t>(decoded_bytes.size());
+      decoded_bytes.shrink_to_fit();
+      return decoded;
+    }
 
-        text.append(decoded_token);
+    uint8_t Flags(int64_t token) const {
+      return (token >= 0 && static_cast<size_t>(token) < flags.size()) ? flags[token] : 0;
+    }
+
+    std::string_view Token(int64_t token) const {
+      return std::string_view(bytes.data() + offsets[token], offsets[token + 1] - offsets[token]);
+    }
+
+    std::string bytes;              // the UTF-8 bytes of all the decoded tokens
+    std::vector<uint32_t> offsets;  // the token of id is [offsets[id], offsets[id + 1])
+    std::vector<uint8_t> flags;     // the TokenFlag of every id
+  };
+
+  std::string Decode(const int64_t* tokens, size_t count) const {
+    std::string text;
+    size_t length = 0;
+    const DecodedTokens& decoded = *decoded_;
+    for (size_t tok_idx = 0; tok_idx < count; ++tok_idx) {
+      length += (decoded.Flags(tokens[tok_idx]) & kDecoded) ? decoded.Token(tokens[tok_idx]).size()
+                                                            : unk_token_.size();
+    }
+    text.reserve(length + (whitespace_token_ ? 2 * count : 0));
 
-        if (whitespace_token_ &&
-            f_special && tok_idx != count - 1) {
-          text.push_back(' ');
+    DecodeState state;
+    AppendDecoded(tokens, count, state, text);
+    return text;
+  }
+
+ protected:
+  // The state of the decoding between the tokens, so a sequence can be decoded in pieces.
+  struct DecodeState {
+    bool started = false;        // any token was decoded before
+    bool special_last = false;   // the last token was special
+    bool space_pending = false;  // the space after the last special token, which isn't added after the last one
+  };
+
+  // Appends the decoded tokens to text, which is the same for a whole sequence and for its pieces in turn.
+  void AppendDecoded(const int64_t* tokens, size_t count, DecodeState& state, std::string& text) const {
+    const DecodedTokens& decoded = *decoded_;
+    for (size_t tok_idx = 0; tok_idx < count; ++tok_idx) {
+      if (state.space_pending) {
+        text.push_back(' ');
+        state.space_pending = false;
+      }
+
+      const auto token = tokens[tok_idx];
+      const uint8_t flags = decoded.Flags(token);
+      bool f_special = (flags & kSpecial) != 0;
+      if (skip_special_tokens_ && f_special) {
+        state.special_last = f_special;
+        state.started = true;
+        continue;
+      }
+
+      std::string_view decoded_token;
+      if (flags & kDecoded) {
+        if (flags & kUndecodable) {
+          ORTX_CXX_API_THROW(MakeString("[BPEDecoder]token ", token, " has a character out of the byte decoder."),
+                             ORT_INVALID_ARGUMENT);
         }
+        decoded_token = decoded.Token(token);
+      } else {
+        if (skip_special_tokens_) {
+          state.started = true;
+          continue;
+        } else {
+          decoded_token = unk_token_;
+        }
+      }
+
+      if (whitespace_token_ &&
+          f_special && (state.started && !state.special_last)) {
+        text.push_back(' ');
+      }
+
+      text.append(decoded_token);
 
-        f_special_last = f_special;
+      if (whitespace_token_ && f_special) {
+        state.space_pending = true;
       }
 
-      decoded_strings.emplace_back(std::move(text));
-      p_ids += seq_len;
+      state.special_last = f_special;
+      state.started = true;
     }
-    output.SetStringOutput(decoded_strings, output_dim);
   }
 
  private:
@@ -177,8 +295,120 @@ struct KernelBpeDecoder : public BaseKernel {
   int64_t en_normalization_ = 0;
   int64_t skip_special_tokens_ = 0;
   int64_t whitespace_token_ = 0;
-  std::vector<ustring> arr_vocab_;
-  std::map<char32_t, unsigned char> byte_decoder_;
-  std::map<int64_t, std::string> added_tokens_;
-  std::set<int64_t> all_special_ids_;
+  size_t num_threads_ = 1;
+
+  BackgroundLoad<DecodedTokens> decoded_;
+};
+
+// The BpeDecoder of the token-by-token generation, which is run with the new ids of every step and returns only
+// the text they complete. Every stream keeps the decoding state and the bytes of a UTF-8 character which is split
+// across the tokens, so a step costs the new ids instead of the whole sequence.
+// The streams live in the kernel until they are finished, which also outputs the rest of their bytes, and up to
+// max_streams of them are kept, so the least recently run stream of a client which never finishes it is evicted.
+struct KernelBpeStreamingDecoder : public KernelBpeDecoder {
+ public:
+  static constexpr int64_t kDefaultMaxStreams = 4096;
+
+  KernelBpeStreamingDecoder(const OrtApi& api, const OrtKernelInfo& info) : KernelBpeDecoder(api, info) {
+    int64_t max_streams = TryToGetAttributeWithDefault<int64_t>("max_streams", kDefaultMaxStreams);
+    if (max_streams <= 0) {
+      ORTX_CXX_API_THROW(MakeString("[BpeStreamingDecoder]max_streams should be positive, but got ", max_streams),
+                         ORT_INVALID_ARGUMENT);
+    }
+    max_streams_ = static_cast<size_t>(max_streams);
+  }
+
+  void Compute(const ortc::Tensor<int64_t>& ids,
+               const ortc::Tensor<int64_t>& stream_ids,
+               std::optional<const ortc::Tensor<bool>*> finished,
+               ortc::Tensor<std::string>& output) const {
+    const int64_t* p_ids = ids.Data();
+    const auto& ids_dim = ids.Shape();
+    const size_t batch = static_cast<size_t>(stream_ids.NumberOfElement());
+    const size_t seq_len = ids_dim.size() > 1 ? static_cast<size_t>(ids_dim.back()) : (batch == 1 ? ids.NumberOfElement() : 0);
+    if (seq_len * batch != static_cast<size_t>(ids.NumberOfElement())) {
+      ORTX_CXX_API_THROW("[BpeStreamingDecoder]ids should be [batch, seq] with a stream id for every row.",
+                         ORT_INVALID_ARGUMENT);
+    }
+    const bool* p_finished = nullptr;
+    if (finished.has_value() && (*finished)->NumberOfElement() > 0) {
+      if (static_cast<size_t>((*finished)->NumberOfElement()) != batch) {
+        ORTX_CXX_API_THROW("[BpeStreamingDecoder]finished should have a flag for every stream.", ORT_INVALID_ARGUMENT);
+      }
+      p_finished = (*finished)->Data();
+    }
+    if (batch > max_streams_) {
+      ORTX_CXX_API_THROW(MakeString("[BpeStreamingDecoder]a run has ", batch, " streams, more than max_streams ",
+                                    max_streams_, "."),
+                         ORT_INVALID_ARGUMENT);
+    }
+
+    const int64_t* p_streams = stream_ids.Data();
+    std::vector<std::string> texts(batch);
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t n = 0; n < batch; ++n) {
+      StreamState& stream = GetStream(p_streams[n]);
+      std::string& text = texts[n];
+      text.swap(stream.pending);
+      AppendDecoded(p_ids + n * seq_len, seq_len, stream.state, text);
+
+      if (p_finished != nullptr && p_finished[n]) {
+        recent_.erase(stream.recent);
+        streams_.erase(p_streams[n]);
+      } else {
+        // the bytes of the last character are held back until it's complete
+        size_t complete = CompleteUTF8Length(text);
+        stream.pending.assign(text, complete, std::string::npos);
+        text.resize(complete);
+      }
+    }
+
+    output.SetStringOutput(texts, {static_cast<int64_t>(batch)});
+  }
+
+ private:
+  struct StreamState {
+    DecodeState state;
+    std::string pending;  // the first bytes of a character which isn't complete yet
+    std::list<int64_t>::iterator recent;
+  };
+
+  // Returns the state of the stream as the most recently run one, which is new if the stream isn't kept, and
+  // evicts the least recently run one over max_streams. Called with the mutex held.
+  StreamState& GetStream(int64_t stream_id) const {
+    auto it = streams_.find(stream_id);
+    if (it != streams_.end()) {
+      recent_.splice(recent_.begin(), recent_, it->second.recent);
+      return it->second;
+    }
+
+    if (streams_.size() >= max_streams_) {
+      static auto& evicted = ort_extensions::RuntimeStats::Instance().Counter("bpe_streaming_decoder.evicted");
+      evicted.Add();
+      streams_.erase(recent_.back());
+      recent_.pop_back();
+    }
+    recent_.push_front(stream_id);
+    StreamState& stream = streams_[stream_id];
+    stream.recent = recent_.begin();
+    return stream;
+  }
+
+  // Returns the length of the text without its last UTF-8 character if it's incomplete.
+  static size_t CompleteUTF8Length(std::string_view text) {
+    for (size_t back = 1; back <= std::min<size_t>(4, text.size()); ++back) {
+      unsigned char ch = static_cast<unsigned char>(text[text.size() - back]);
+      if ((ch & 0xC0) == 0x80) {
+        continue;  // a continuation byte
+      }
+      size_t length = ch < 0x80 ? 1 : (ch & 0xE0) == 0xC0 ? 2 : (ch & 0xF0) == 0xE0 ? 3 : (ch & 0xF8) == 0xF0 ? 4 : 1;
+      return length > back ? text.size() - back : text.size();
+    }
+    return text.size();  // not UTF-8, so nothing is held back
+  }
+
+  size_t max_streams_{static_cast<size_t>(kDefaultMaxStreams)};
+  mutable std::mutex mutex_;
+  mutable std::unordered_map<int64_t, StreamState> streams_;
+  mutable std::list<int64_t> recent_;  // the ids of the streams, from the most recently run one
 };
@@ -5,14 +5,30 @@
 #include "narrow.h"
 #include "ustring.h"
 
-#include <regex>
+#include <array>
+#include <algorithm>
+#include <cctype>
 #include <list>
+#include <optional>
+#include <queue>
+#include <type_traits>
 #include <unordered_map>
 
 #include "unicode.h"
 #include "nlohmann/json.hpp"
 #include "string_utils.h"
 #include "string_tensor.h"
+#include "lru_cache.h"
+#include "aho_corasick.h"
+#include "token_vocab.h"
+#include "pre_tokenizer_dfa.hpp"
+#include "json_vocab.h"
+#include "shared_registry.h"
+#include "background_load.h"
+#include "asset_attribute.h"
+#include "parallel_for.h"
+#include "scratch_arena.h"
+#include "trace_scope.h"
 
 #include <iostream>
 #include <utility>
@@ -54,31 +70,77 @@ inline bool IsUnicodeSpace(char32_t ch) {
   return false;
 }
 
-inline bool IsEmptyUString(const ustring& str) {
-  if (str == ustring(" ")) {
+inline bool IsEmptyUString(std::u32string_view str) {
+  if (str == U" ") {
     return false;
   } else {
     return std::all_of(str.begin(), str.end(), [](char32_t ch) { return IsUnicodeSpace(ch); });
   }
 }
 
+inline bool IsEmptyUString(std::string_view str) {
+  if (str == " ") {
+    return false;
+  }
+  for (size_t i = 0, len = 0; i < str.size(); i += len) {
+    if (!IsUnicodeSpace(ustring::DecodeUTF8Char(str, i, len))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 inline bool BothSpaces(char32_t lhs, char32_t rhs) {
     return (lhs == rhs) && IsUnicodeSpace(lhs);
 }
 
-inline ustring ReplaceString(ustring str, const ustring& search, const ustring& replace) {
-    size_t pos = 0;
-    while ((pos = str.find(search, pos)) != ustring::npos) {
-    str.replace(pos, search.length(), replace);
-        pos += replace.length();
+// The whitespace clean of CLIP, in place: the newlines are spaces, and a run of the same space is one, with the
+// letters lowercased if lowercase is true, in one pass over the text. Returns whether the result isn't empty for
+// IsEmptyUString.
+inline bool WhiteSpaceClean(ustring& str, bool lowercase = false) {
+  size_t n = 0;
+  bool all_spaces = true;
+  for (size_t i = 0; i < str.size(); ++i) {
+    char32_t ch = str[i] == U'\n' ? U' ' : str[i];
+    if (n > 0 && BothSpaces(str[n - 1], ch)) {
+      continue;
+    }
+    if (!IsUnicodeSpace(ch)) {
+      all_spaces = false;
+      ch = lowercase ? ToLower(ch) : ch;
     }
-    return str;
+    str[n++] = ch;
+  }
+  str.resize(n);
+  return !all_spaces || (n == 1 && str[0] == U' ');
 }
 
-inline void WhiteSpaceClean(ustring& str) {
-    str = ReplaceString(str, ustring("\n"), ustring(" "));
-    str.erase(std::unique(str.begin(), str.end(), BothSpaces), str.end());
-}
+// The characters of the bytes in the byte-level BPE vocabularies of GPT-2, RoBERTa and CLIP, the bytes_to_unicode
+// of GPT-2: the printable Latin-1 characters stand for themselves, and U+0100 on for the others in their order.
+constexpr std::array<char32_t, 256> kBytesToUnicode = [] {
+  std::array<char32_t, 256> table{};
+  char32_t next = 256;
+  for (int b = 0; b < 256; ++b) {
+    const bool printable = (b >= 33 && b <= 126) || (b >= 161 && b <= 172) || (b >= 174 && b <= 255);
+    table[b] = printable ? static_cast<char32_t>(b) : next++;
+  }
+  return table;
+}();
+
+// The byte of each character of kBytesToUnicode, or -1 for a character of none.
+constexpr std::array<int16_t, 256 + 68> kUnicodeToBytes = [] {
+  std::array<int16_t, 256 + 68> table{};
+  for (auto& byte : table) {
+    byte = -1;
+  }
+  for (int b = 0; b < 256; ++b) {
+    table[kBytesToUnicode[b]] = static_cast<int16_t>(b);
+  }
+  return table;
+}();
+
+static_assert(kBytesToUnicode['!'] == U'!' && kBytesToUnicode[' '] == 0x120 && kBytesToUnicode[173] == 0x143);
+static_assert(kUnicodeToBytes[0x120] == ' ' && kUnicodeToBytes[0x100] == 0);
 
 class SpecialTokenMap {
  public:
@@ -94,62 +156,117 @@ class SpecialTokenMap {
     }
   }
 
-  std::list<std::pair<ustring, int>> SplitBySpecialTokens(ustring input) const {
-    std::list<std::pair<ustring, int>> res;
-    res.emplace_back(std::move(input), -1);
+  // Builds the matchers of all the special tokens, it must be called after the last Add().
+  void Build() {
+    matcher_.Clear();
+    utf8_matcher_.Clear();
     for (const auto& st : token_list_) {
-      std::list<std::pair<ustring, int>> new_split_res;
-      for (auto& str : res) {
-        if (str.second != -1) {
-          new_split_res.push_back(std::move(str));
-          continue;
-        }
-        auto it = str.first.begin();
-        size_t search_pos = 0;
-        while (it != str.first.end()) {
-// works fine for all clang-based platform: Mac OS, Android, WebAssembly
-#if defined(__clang__)
-          auto search_it = std::search(it, str.first.end(), st.str.begin(), st.str.end());
-#else
-          auto search_it = std::search(it, str.first.end(),
-                                       std::boyer_moore_searcher(st.str.begin(), st.str.end()));
-#endif
-          if (search_it == str.first.end()) {
-            new_split_res.emplace_back(str.first.substr(search_pos), -1);
-            break;
-          }
-          auto prefixLen = search_it - it;
-          if (prefixLen != 0) {
-            new_split_res.emplace_back(str.first.substr(search_pos, prefixLen), -1);
-            search_pos += prefixLen;
-          }
-          new_split_res.emplace_back(str.first.substr(search_pos, st.str.size()), st.id);
-          it = search_it + st.str.size();
-          search_pos += st.str.size();
-        }
+      matcher_.AddPattern(st.str);
+      utf8_matcher_.AddPattern(st.utf8_str);
+    }
+    matcher_.Build();
+    utf8_matcher_.Build();
+  }
+
+  // Splits the input in one scan, the segments are views of the input with the special token id, or -1 for the
+  // normal text. The tokens take effect in the order they were added, the same as splitting the input by one
+  // token after another, so an occurrence overlapping with the one of a prior token is ignored.
+  std::vector<std::pair<std::u32string_view, int>> SplitBySpecialTokens(std::u32string_view input) const {
+    return Split(matcher_, input);
+  }
+
+  // The same as above on the UTF-8 bytes, which must be well-formed so a match always starts at a character.
+  std::vector<std::pair<std::string_view, int>> SplitBySpecialTokens(std::string_view input) const {
+    return Split(utf8_matcher_, input);
+  }
+
+  // The length of the longest special token in the characters of CharT, 0 without any token.
+  template <typename CharT>
+  size_t MaxTokenLength() const {
+    size_t len = 0;
+    for (const auto& st : token_list_) {
+      len = std::max(len, std::is_same_v<CharT, char> ? st.utf8_str.size() : st.str.size());
+    }
+    return len;
+  }
+
+  // Whether any special token occurs in the input.
+  bool Contains(std::u32string_view input) const { return Contains(matcher_, input); }
+  bool Contains(std::string_view input) const { return Contains(utf8_matcher_, input); }
+
+ private:
+  template <typename CharT>
+  bool Contains(const AhoCorasick<CharT>& matcher, std::basic_string_view<CharT> input) const {
+    bool found = false;
+    if (!token_list_.empty()) {
+      matcher.FindAll(input, [&found](size_t, size_t, size_t) { found = true; });
+    }
+    return found;
+  }
+
+  template <typename CharT>
+  std::vector<std::pair<std::basic_string_view<CharT>, int>> Split(const AhoCorasick<CharT>& matcher,
+                                                                  std::basic_string_view<CharT> input) const {
+    std::vector<std::pair<std::basic_string_view<CharT>, int>> res;
+    if (token_list_.empty()) {
+      res.emplace_back(input, -1);
+      return res;
+    }
+
+    ScratchVector<std::pair<size_t, size_t>> matches;  // (token index, begin)
+    matcher.FindAll(input, [&matches](size_t token, size_t begin, size_t) { matches.emplace_back(token, begin); });
+    std::sort(matches.begin(), matches.end());
+
+    ScratchVector<bool> taken(matches.empty() ? 0 : input.size());
+    ScratchVector<std::pair<size_t, size_t>> selected;  // (begin, token index)
+    for (auto [token, begin] : matches) {
+      size_t end = begin + matcher.PatternLength(token);
+      if (std::find(taken.begin() + begin, taken.begin() + end, true) != taken.begin() + end) {
+        continue;
       }
-      std::swap(new_split_res, res);
+      std::fill(taken.begin() + begin, taken.begin() + end, true);
+      selected.emplace_back(begin, token);
+    }
+    std::sort(selected.begin(), selected.end());
+
+    size_t pos = 0;
+    for (auto [begin, token] : selected) {
+      if (begin > pos) {
+        res.emplace_back(input.substr(pos, begin - pos), -1);
+      }
+      size_t len = matcher.PatternLength(token);
+      res.emplace_back(input.substr(begin, len), token_list_[token].id);
+      pos = begin + len;
+    }
+    if (pos < input.size()) {
+      res.emplace_back(input.substr(pos), -1);
     }
     return res;
   }
 
- private:
   struct SpecialTokenInfo {
     ustring str;
+    std::string utf8_str;
     int id;
 
     SpecialTokenInfo(ustring p_str, int p_id)
-        : str(std::move(p_str)), id(p_id) {
+        : str(std::move(p_str)), utf8_str(str), id(p_id) {
       if (str.empty()) {
         ORTX_CXX_API_THROW("Empty special token.", ORT_INVALID_ARGUMENT);
       }
     }
   };
 
-  std::list<SpecialTokenInfo> token_list_;
+  std::vector<SpecialTokenInfo> token_list_;
   std::unordered_map<ustring, int> token_map_;
+  AhoCorasick<char32_t> matcher_;
+  AhoCorasick<char> utf8_matcher_;
 };
 
+// The word level BPE results cached by the tokenizer kernels, keyed by the UTF-8 bytes of the word.
+using BpeCache = LruCache<std::string, std::vector<std::pair<int, int>>>;
+constexpr int64_t kDefaultBpeCacheCapacity = 10000;
+
 using json = nlohmann::json;
 class VocabData {
  public:
@@ -158,47 +275,395 @@ class VocabData {
   }
 
   struct BpeNode {
-    int id;
-    int value;
-    int length;
+    int id;     // the id of the merged token
+    int value;  // the rank of the merge
   };
 
   void Load(std::istream& vocab_stream, std::istream& merges_stream, const char* unk_token, const char* special_tokens) {
-    json tok_json;
-    vocab_stream >> tok_json;
-    vocab_map_ = std::move(tok_json.get<std::unordered_map<std::string, int>>());
+    std::string vocab{std::istreambuf_iterator<char>(vocab_stream), std::istreambuf_iterator<char>()};
+    std::string merges{std::istreambuf_iterator<char>(merges_stream), std::istreambuf_iterator<char>()};
+    Load(std::string_view(vocab), std::string_view(merges), unk_token, special_tokens);
+  }
 
-    auto it = vocab_map_.find(unk_token);
-    if (it != vocab_map_.end()) {
-      unk_id_ = it->second;
-    } else {
-      int id = static_cast<int>(vocab_map_.size());
-      vocab_map_[unk_token] = id;
+  // Loads the JSON vocabulary, whose tokens are parsed into vocab_ directly, and the merges, a pair of tokens a line.
+  void Load(std::string_view vocab, std::string_view merges, const char* unk_token, const char* special_tokens) {
+    LoadVocab(vocab, unk_token);
+    LoadByteEncoder();
+    LoadMerges(merges);
+    LoadSpecialTokens(special_tokens);
+    LoadWholeWords();
+    vocab_.ShrinkToFit();
+  }
+
+  // Loads the vocabulary and the merges of a BPE whose tokens are the characters of the text instead of the
+  // byte-level ones, like the one of Llama, whose spaces are U+2581. It has no ByteEncoder(), and the initial
+  // symbols of a word are the ids of its characters, or of their bytes with the byte fallback.
+  void LoadCharLevel(std::string_view vocab, std::string_view merges, const char* unk_token) {
+    LoadVocab(vocab, unk_token);
+    LoadMerges(merges);
+    LoadSpecialTokens(nullptr);
+    vocab_.ShrinkToFit();
+  }
+
+  // The binary model is the vocabulary after Load(), saved by Save() or by the Python converter, which
+  // skips the parsing of the JSON vocabulary and the merges text whenever a session is created.
+  // All the integers are little-endian, and the strings are prefixed by their uint32 length:
+  //   the magic "OCXBPE01", unk_token, special_tokens, int32 unk_id, int32 byte_encoder[256],
+  //   uint32 token_count, token_count x (int32 id, uint32 length), the bytes of all the tokens,
+  //   uint32 merge_count, merge_count x (int32 id1, int32 id2, int32 merged id, int32 rank).
+  // The tokens are in the order they were added, and the merges in the order of their ranks.
+  static constexpr std::string_view kBinaryMagic{"OCXBPE01"};
+
+  static bool IsBinaryModel(std::string_view model) {
+    return model.substr(0, kBinaryMagic.size()) == kBinaryMagic;
+  }
+
+  void LoadBinary(std::string_view model, const char* unk_token, const char* special_tokens) {
+    BinaryReader reader{model};
+    if (!IsBinaryModel(model)) {
+      ORTX_CXX_API_THROW("The binary BPE model doesn't start with the magic.", ORT_INVALID_ARGUMENT);
     }
+    reader.Skip(kBinaryMagic.size());
 
-    for (auto i = 33; i <= 126; ++i) {
-      byte_encoder_[i] = GetVocabIndex(ustring::EncodeUTF8Char((char32_t)i));
+    // the special tokens change the vocabulary, so a model only loads with the tokens it was saved with.
+    if (reader.ReadString() != unk_token ||
+        reader.ReadString() != std::string_view(special_tokens != nullptr ? special_tokens : "")) {
+      ORTX_CXX_API_THROW("The binary BPE model was saved with other unk_token or special tokens.",
+                         ORT_INVALID_ARGUMENT);
     }
-    for (auto i = 161; i <= 172; ++i) {
-      byte_encoder_[i] = GetVocabIndex(ustring::EncodeUTF8Char((char32_t)i));
+
+    unk_id_ = reader.ReadInt();
+    for (auto& id : byte_encoder_) {
+      id = reader.ReadInt();
+    }
+
+    uint32_t token_count = reader.ReadUInt();
+    std::string_view entries = reader.Read(size_t{token_count} * 8);
+    size_t byte_count = 0;
+    for (uint32_t i = 0; i < token_count; ++i) {
+      byte_count += BinaryReader{entries.substr(size_t{i} * 8 + 4, 4)}.ReadUInt();
     }
-    for (auto i = 174; i <= 255; ++i) {
-      byte_encoder_[i] = GetVocabIndex(ustring::EncodeUTF8Char((char32_t)i));
+    std::string_view tokens = reader.Read(byte_count);
+    vocab_.Reserve(token_count, byte_count);
+    BinaryReader entry_reader{entries};
+    for (size_t offset = 0; token_count > 0; --token_count) {
+      int id = entry_reader.ReadInt();
+      uint32_t length = entry_reader.ReadUInt();
+      vocab_.Add(tokens.substr(offset, length), id);
+      offset += length;
     }
 
-    int index = 256;
-    for (auto i = 0; i < 33; ++i) {
-      byte_encoder_[i] = GetVocabIndex(ustring::EncodeUTF8Char((char32_t)(index++)));
+    uint32_t merge_count = reader.ReadUInt();
+    BinaryReader merge_reader{reader.Read(size_t{merge_count} * 16)};
+    for (; merge_count > 0; --merge_count) {
+      int id1 = merge_reader.ReadInt();
+      int id2 = merge_reader.ReadInt();
+      int id = merge_reader.ReadInt();
+      bpe_map_.Insert(id1, id2, BpeNode{id, merge_reader.ReadInt()});
     }
-    for (auto i = 127; i < 161; ++i) {
-      byte_encoder_[i] = GetVocabIndex(ustring::EncodeUTF8Char((char32_t)(index++)));
+    if (!reader.AtEnd()) {
+      ORTX_CXX_API_THROW("The binary BPE model has trailing bytes.", ORT_INVALID_ARGUMENT);
     }
-    byte_encoder_[173] = GetVocabIndex(ustring::EncodeUTF8Char((char32_t)(index++)));
 
-    index = 0;
+    // the special tokens were added to the vocabulary before it was saved, so they are only looked up.
+    LoadSpecialTokens(special_tokens);
+    LoadWholeWords();
+  }
+
+  // Saves the loaded vocabulary as the binary model, with the unk_token and the special tokens it was loaded with.
+  std::string Save(const char* unk_token, const char* special_tokens) const {
+    std::string model(kBinaryMagic);
+    WriteString(model, unk_token);
+    WriteString(model, special_tokens != nullptr ? special_tokens : "");
+    WriteInt(model, static_cast<uint32_t>(unk_id_));
+    for (int id : byte_encoder_) {
+      WriteInt(model, static_cast<uint32_t>(id));
+    }
+
+    WriteInt(model, static_cast<uint32_t>(vocab_.size()));
+    for (auto [token, id] : vocab_) {
+      WriteInt(model, static_cast<uint32_t>(id));
+      WriteInt(model, static_cast<uint32_t>(token.size()));
+    }
+    for (auto [token, id] : vocab_) {
+      model.append(token);
+    }
+
+    std::vector<std::pair<BpeNode, std::pair<int, int>>> merges;
+    bpe_map_.ForEach([&merges](int id1, int id2, const BpeNode& node) {
+      merges.emplace_back(node, std::make_pair(id1, id2));
+    });
+    std::sort(merges.begin(), merges.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.first.value < rhs.first.value;
+    });
+    WriteInt(model, static_cast<uint32_t>(merges.size()));
+    for (const auto& [node, ids] : merges) {
+      WriteInt(model, static_cast<uint32_t>(ids.first));
+      WriteInt(model, static_cast<uint32_t>(ids.second));
+      WriteInt(model, static_cast<uint32_t>(node.id));
+      WriteInt(model, static_cast<uint32_t>(node.value));
+    }
+    return model;
+  }
+
+  // Merges the (id, length) pairs in place. The symbols are kept in a contiguous array linked with
+  // prev/next indices, and the candidate pairs in a min-heap ordered by (rank, position), so every
+  // merge costs O(log n) instead of a rescan of the whole word.
+  void bpe(std::vector<std::pair<int, int>>& vals) const {
+    if (vals.size() < 2) {
+      return;
+    }
+
+    struct Merge {
+      int rank;
+      int left;
+      int right;
+      int id1;
+      int id2;
+      int id;
+
+      bool operator>(const Merge& rhs) const {
+        return rank != rhs.rank ? rank > rhs.rank : left > rhs.left;
+      }
+    };
+
+    const int num_symbols = static_cast<int>(vals.size());
+    // next[i] == kRemoved marks a symbol that has been folded into its left neighbour.
+    constexpr int kRemoved = -2;
+    // the temporaries are from the scratch arena of the thread when the caller has a scope.
+    ScratchVector<int> prev(num_symbols);
+    ScratchVector<int> next(num_symbols);
+    for (int i = 0; i < num_symbols; ++i) {
+      prev[i] = i - 1;
+      next[i] = i + 1 < num_symbols ? i + 1 : -1;
+    }
+
+    ScratchVector<Merge> heap_storage;
+    heap_storage.reserve(vals.size());
+    std::priority_queue<Merge, ScratchVector<Merge>, std::greater<Merge>> queue(std::greater<Merge>(),
+                                                                               std::move(heap_storage));
+    auto add_candidate = [&](int left, int right) {
+      const BpeNode* node = bpe_map_.Find(vals[left].first, vals[right].first);
+      if (node != nullptr) {
+        queue.push({node->value, left, right, vals[left].first, vals[right].first, node->id});
+      }
+    };
+
+    for (int i = 0; i + 1 < num_symbols; ++i) {
+      add_candidate(i, i + 1);
+    }
+
+    ScratchVector<std::pair<int, int>> new_pairs;
+    while (!queue.empty()) {
+      // All the occurrences of the lowest ranked pair are merged from left to right before any pair
+      // formed by these merges is considered, which keeps the result identical to the classic scan.
+      const int rank = queue.top().rank;
+      while (!queue.empty() && queue.top().rank == rank) {
+        Merge m = queue.top();
+        queue.pop();
+        if (next[m.left] != m.right || vals[m.left].first != m.id1 || vals[m.right].first != m.id2) {
+          continue;  // stale candidate
+        }
+
+        vals[m.left].first = m.id;
+        vals[m.left].second += vals[m.right].second;
+        next[m.left] = next[m.right];
+        if (next[m.left] != -1) {
+          prev[next[m.left]] = m.left;
+        }
+        next[m.right] = kRemoved;
+
+        if (prev[m.left] != -1) {
+          new_pairs.emplace_back(prev[m.left], m.left);
+        }
+        if (next[m.left] != -1) {
+          new_pairs.emplace_back(m.left, next[m.left]);
+        }
+      }
+
+      for (auto [left, right] : new_pairs) {
+        if (next[left] == right) {
+          add_candidate(left, right);
+        }
+      }
+      new_pairs.clear();
+    }
+
+    // the first symbol always survives since a merge keeps the left one.
+    size_t n = 0;
+    for (int i = 0; i != -1; i = next[i]) {
+      vals[n++] = vals[i];
+    }
+    vals.resize(n);
+  }
+
+  const auto& ByteEncoder() const {
+    return byte_encoder_;
+  }
+
+  // Appends the (id, 1) symbols of the bytes of the word, the initial symbols of its merges, in one pass over the
+  // bytes into the memory of the symbols, which the callers reuse for the words of a text.
+  void AppendByteSymbols(std::string_view word, std::vector<std::pair<int, int>>& symbols) const {
+    const size_t begin = symbols.size();
+    symbols.resize(begin + word.size());
+    std::pair<int, int>* out = symbols.data() + begin;
+    for (size_t i = 0; i < word.size(); ++i) {
+      out[i] = {byte_encoder_[static_cast<unsigned char>(word[i])], 1};
+    }
+  }
+
+  // The id of the byte-level word, of the bytes of the text, if the merges of its bytes end in this one token,
+  // or -1 otherwise. Most of the words of a text are single tokens, which skip the merges and the cache this way.
+  int FindWholeWord(std::string_view word) const { return whole_words_.Find(word); }
+
+  auto SplitBySpecialTokens(std::u32string_view input) const {
+    return special_tokens_.SplitBySpecialTokens(input);
+  }
+
+  auto SplitBySpecialTokens(std::string_view input) const {
+    return special_tokens_.SplitBySpecialTokens(input);
+  }
+
+  // Finds the first position from `from` at which the input can be cut so that its prefix has the same ids as
+  // the start of the whole input, or input.size() if there is none. It's a space before an ASCII letter or
+  // digit, where the pre-tokenizer always starts a word, and without a special token in 2x its longest length
+  // before it, so no token across the cut could have changed the special tokens which the prefix matches.
+  template <typename CharT>
+  size_t FindPrefixCut(std::basic_string_view<CharT> input, size_t from) const {
+    const size_t margin = 2 * special_tokens_.MaxTokenLength<CharT>();
+    for (size_t pos = std::max<size_t>(from, 1); pos + 1 < input.size(); ++pos) {
+      const auto next = static_cast<char32_t>(static_cast<std::make_unsigned_t<CharT>>(input[pos + 1]));
+      if (input[pos] != CharT(' ') || next >= 0x80 || !std::isalnum(static_cast<int>(next))) {
+        continue;
+      }
+      const size_t begin = pos > margin ? pos - margin : 0;
+      if (margin == 0 || !special_tokens_.Contains(input.substr(begin, pos - begin))) {
+        return pos;
+      }
+    }
+    return input.size();
+  }
+
+  // Returns token if key was found in vocab, and unk_id_ otherwise
+  int GetEncoding(std::string_view key) const {
+    int id = vocab_.Find(key);
+    return id != TokenVocab::kInvalidId ? id : unk_id_;
+  }
+
+  // The id of the token, or -1 if it isn't in the vocab.
+  int FindToken(std::string_view token) const { return vocab_.Find(token); }
+
+  size_t VocabSize() const { return vocab_.size(); }
+
+  int TokenToID(std::string_view input) const {
+    int id = vocab_.Find(input);
+    if (id == TokenVocab::kInvalidId) {
+      ORTX_CXX_API_THROW(MakeString("Token not found: ", input), ORT_INVALID_ARGUMENT);
+    }
+    return id;
+  }
+
+  std::string_view IdToToken(int64_t id) const {
+    if (!vocab_.HasId(id)) {
+      ORTX_CXX_API_THROW("Invalid ID: " + std::to_string(id), ORT_INVALID_ARGUMENT);
+    }
+    return vocab_.Token(id);
+  }
+
+ private:
+  void LoadVocab(std::string_view vocab, const char* unk_token) {
+    const size_t token_count = CountJsonVocabEntries(vocab);
+    vocab_.Reserve(token_count, vocab.size() > token_count * 6 ? vocab.size() - token_count * 6 : vocab.size());
+    ParseJsonVocab(vocab, [this](std::string_view token, int32_t id) { vocab_.Add(token, id); });
+
+    int unk_id = vocab_.Find(unk_token);
+    if (unk_id != TokenVocab::kInvalidId) {
+      unk_id_ = unk_id;
+    } else {
+      vocab_.Add(unk_token, static_cast<int>(vocab_.size()));
+    }
+  }
+
+  void LoadByteEncoder() {
+    for (int byte = 0; byte < 256; ++byte) {
+      byte_encoder_[byte] = GetVocabIndex(ustring::EncodeUTF8Char(kBytesToUnicode[byte]));
+    }
+  }
+
+  // Adds the bytes of each token of the byte-level vocabulary whose merges end in a single token, which is
+  // the BPE of a word of these bytes then. A token which the merges can't make up, or make up into another
+  // token, stays out, so the words found here always get the ids of bpe().
+  void LoadWholeWords() {
+    // the characters of the bytes are the code points before U+0144 in the byte-level vocabularies
+    std::vector<int16_t> bytes_of_chars;
+    for (int byte = 0; byte < 256; ++byte) {
+      std::string_view token = vocab_.Token(byte_encoder_[byte]);
+      size_t len = 0;
+      const char32_t ch = token.empty() ? 0 : ustring::DecodeUTF8Char(token, 0, len);
+      if (len != token.size() || ch >= 0x800) {
+        return;  // not the byte-level tokens, which get no whole words
+      }
+      bytes_of_chars.resize(std::max<size_t>(bytes_of_chars.size(), ch + 1), -1);
+      bytes_of_chars[ch] = static_cast<int16_t>(byte);
+    }
+    // a special or added token isn't of the bytes
+    auto to_bytes = [&bytes_of_chars](std::string_view token, std::string& word) {
+      word.clear();
+      for (size_t i = 0, len = 0; i < token.size(); i += len) {
+        const char32_t ch = ustring::DecodeUTF8Char(token, i, len);
+        if (ch >= bytes_of_chars.size() || bytes_of_chars[ch] < 0) {
+          return false;
+        }
+        word.push_back(static_cast<char>(bytes_of_chars[ch]));
+      }
+      return !word.empty();
+    };
+
+    std::vector<std::string_view> tokens;
+    tokens.reserve(vocab_.size());
+    for (auto [token, id] : vocab_) {
+      tokens.push_back(token);
+    }
+    // the merges of the tokens are the most of the loading, so they run on the threads of the pool
+    std::vector<int> whole_ids(tokens.size(), -1);
+    ParallelFor(Ort::Custom::ComputeContext::Current(), tokens.size(), 2000, [&](size_t begin, size_t end) {
+      std::string word;
+      std::vector<std::pair<int, int>> symbols;
+      for (size_t i = begin; i < end; ++i) {
+        if (!to_bytes(tokens[i], word)) {
+          continue;
+        }
+        ScratchScope scratch;
+        symbols.clear();
+        AppendByteSymbols(word, symbols);
+        bpe(symbols);
+        if (symbols.size() == 1) {
+          whole_ids[i] = symbols[0].first;
+        }
+      }
+    });
+
+    std::string word;
+    whole_words_.Reserve(tokens.size(), tokens.size() * 4);
+    for (size_t i = 0; i < tokens.size(); ++i) {
+      if (whole_ids[i] >= 0 && to_bytes(tokens[i], word)) {
+        whole_words_.Add(word, whole_ids[i]);
+      }
+    }
+    whole_words_.ShrinkToFit();
+  }
+
+  void LoadMerges(std::string_view merges) {
+    int index = 0;
     std::string line;
-    while (std::getline(merges_stream, line)) {
-      line = std::regex_replace(line, std::regex("\r"), "");
+    for (size_t line_begin = 0; line_begin < merges.size();) {
+      size_t line_end = merges.find('\n', line_begin);
+      if (line_end == std::string_view::npos) {
+        line_end = merges.size();
+      }
+      line.assign(merges.substr(line_begin, line_end - line_begin));
+      line_begin = line_end + 1;
+      line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
       if (line.empty()) continue;
       if ((line[0] == '#') && (index == 0)) continue;
       auto pos = line.find(' ');
@@ -207,156 +672,243 @@ class VocabData {
       }
       std::string w1 = line.substr(0, pos);
       std::string w2 = line.substr(pos + 1);
-      int token_length = ort_extensions::narrow<int>(w1.length() + w2.length());
-      if (w2.find("</w>") != std::string::npos || w1.find("</w>") != std::string::npos) {
-        token_length -= 4;
-      }
       int iw1 = GetVocabIndex(w1);
       int iw2 = GetVocabIndex(w2);
       int iww = GetVocabIndex(w1 + w2);
-      std::pair<int, int> key{iw1, iw2};
-      BpeNode value{iww, index++, token_length};
-      bpe_map_[key] = value;
+      bpe_map_.Insert(iw1, iw2, BpeNode{iww, index++});
     }
+  }
 
+  void LoadSpecialTokens(const char* special_tokens) {
     if (special_tokens != nullptr) {
       std::istringstream istrea(special_tokens);
-
+      std::string line;
       while (istrea >> line) {
+        line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
         if (line.empty()) continue;
-        line = std::regex_replace(line, std::regex("\r"), "");
         ustring line_32(line);
-        int id = static_cast<int>(vocab_map_.size());
-        if (auto nestedIt = vocab_map_.find(line); nestedIt != vocab_map_.end()) {
-          id = nestedIt->second;
-        } else {
-          vocab_map_[line] = id;
+        int id = vocab_.Find(line);
+        if (id == TokenVocab::kInvalidId) {
+          id = static_cast<int>(vocab_.size());
+          vocab_.Add(line, id);
         }
         special_tokens_.Add(std::move(line_32), id);
       }
     }
 
-    id2token_map_.resize(vocab_map_.size());
-    for (const auto& [t, i] : vocab_map_) {
-      id2token_map_[i] = t;
-    }
-  }
-
-  void bpe(std::list<std::pair<int, int>>& vals) const {
-    while (vals.size() >= 2) {
-      auto pos_it = vals.end();
-      int minval = std::numeric_limits<int>::max();
-      int ori_id1 = 0, ori_id2 = 0;
-      int aim_id = 0;
-      int token_length = 0;
-      for (auto it = vals.begin(); it != vals.end(); ++it) {
-        auto it2 = it;
-        ++it2;
-        if (it2 == vals.end()) break;
-        auto map_it = bpe_map_.find({it->first, it2->first});
-        if (map_it == bpe_map_.end()) continue;
-        if (minval > map_it->second.value) {
-          ori_id1 = it->first;
-          ori_id2 = it2->first;
-          minval = map_it->second.value;
-          pos_it = it;
-          aim_id = map_it->second.id;
-        }
+    special_tokens_.Build();
+  }
+
+  // Reads the little-endian fields of the binary model, which aren't aligned.
+  struct BinaryReader {
+    std::string_view data;
+
+    std::string_view Read(size_t size) {
+      if (size > data.size()) {
+        ORTX_CXX_API_THROW("The binary BPE model is truncated.", ORT_INVALID_ARGUMENT);
       }
-      if (pos_it == vals.end()) break;
+      std::string_view bytes = data.substr(0, size);
+      data.remove_prefix(size);
+      return bytes;
+    }
+
+    void Skip(size_t size) { Read(size); }
 
-      token_length = pos_it->second;
-      pos_it = vals.erase(pos_it);
-      pos_it->first = aim_id;
-      pos_it->second = pos_it->second + token_length;
-      for (++pos_it; pos_it != vals.end(); ++pos_it) {
-        if (pos_it->first != ori_id1) continue;
-        auto it2 = pos_it;
-        ++it2;
-        if (it2 == vals.end()) break;
-        if (it2->first != ori_id2) continue;
-        token_length = pos_it->second;
-        pos_it = vals.erase(pos_it);
-        pos_it->first = aim_id;
-        pos_it->second = pos_it->second + token_length;
+    uint32_t ReadUInt() {
+      std::string_view bytes = Read(4);
+      uint32_t value = 0;
+      for (size_t i = 0; i < 4; ++i) {
+        value |= static_cast<uint32_t>(static_cast<uint8_t>(bytes[i])) << (8 * i);
       }
+      return value;
     }
-  }
 
-  const auto& ByteEncoder() const {
-    return byte_encoder_;
+    int ReadInt() { return static_cast<int>(static_cast<int32_t>(ReadUInt())); }
+
+    std::string_view ReadString() { return Read(ReadUInt()); }
+
+    bool AtEnd() const { return data.empty(); }
+  };
+
+  static void WriteInt(std::string& model, uint32_t value) {
+    for (size_t i = 0; i < 4; ++i) {
+      model.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
   }
 
-  auto SplitBySpecialTokens(const ustring& input) const {
-    return special_tokens_.SplitBySpecialTokens(input);
+  static void WriteString(std::string& model, std::string_view str) {
+    WriteInt(model, static_cast<uint32_t>(str.size()));
+    model.append(str);
   }
 
-  // Returns token if key was found in vocab, and unk_id_ otherwise
-  int GetEncoding(const std::string& key) {
-    auto it = vocab_map_.find(key);
-    if (it != end(vocab_map_)) {
-      return it->second;
-    } else {
-      return unk_id_;
+  int GetVocabIndex(std::string_view str) const {
+    int id = vocab_.Find(str);
+    if (id == TokenVocab::kInvalidId) {
+      ORTX_CXX_API_THROW(MakeString("Cannot find word in vocabulary: ", str), ORT_INVALID_ARGUMENT);
     }
+    return id;
   }
 
-  size_t VocabSize() const { return vocab_map_.size(); }
+ private:
+#ifdef OCOS_BPE_STD_MERGE_MAP
+  // The node based map, only kept to benchmark the flat table against.
+  class MergeMap {
+   public:
+    void Insert(int id1, int id2, const BpeNode& node) { map_[MakeKey(id1, id2)] = node; }
 
-  int TokenToID(const std::string& input) const {
-    auto it = vocab_map_.find(input);
-    if (it == vocab_map_.end()) {
-      ORTX_CXX_API_THROW("Token not found: " + input, ORT_INVALID_ARGUMENT);
+    const BpeNode* Find(int id1, int id2) const {
+      auto it = map_.find(MakeKey(id1, id2));
+      return it == map_.end() ? nullptr : &it->second;
     }
-    return it->second;
-  }
 
-  const std::string& IdToToken(int id) const {
-    if ((id < 0) || (static_cast<size_t>(id) >= id2token_map_.size())) {
-      ORTX_CXX_API_THROW("Invalid ID: " + std::to_string(id), ORT_INVALID_ARGUMENT);
+    template <typename Fn>
+    void ForEach(Fn&& fn) const {
+      for (const auto& [key, node] : map_) {
+        fn(static_cast<int>(key >> 32), static_cast<int>(key & 0xFFFFFFFF), node);
+      }
     }
-    return id2token_map_[id];
-  }
 
- private:
-  int GetVocabIndex(const std::string& str) {
-    auto it = vocab_map_.find(str);
-    if (it == vocab_map_.end()) {
-      ORTX_CXX_API_THROW("Cannot find word in vocabulary: " + str, ORT_INVALID_ARGUMENT);
+   private:
+    static uint64_t MakeKey(int id1, int id2) {
+      return (static_cast<uint64_t>(static_cast<uint32_t>(id1)) << 32) | static_cast<uint32_t>(id2);
     }
-    return it->second;
-  }
 
- private:
-  struct hash_pair {
-    template <class T1, class T2>
-    size_t operator()(const std::pair<T1, T2>& p) const {
-      auto hash1 = std::hash<T1>{}(p.first);
-      auto hash2 = std::hash<T2>{}(p.second);
-      return hash1 ^ (hash2 << 16);
+    std::unordered_map<uint64_t, BpeNode> map_;
+  };
+#else
+  // An open-addressing table with linear probing, keyed by the two ids packed into 64 bits.
+  // A slot is 16 bytes, so a probe sequence rarely leaves the cache line the hash points at.
+  class MergeMap {
+   public:
+    void Insert(int id1, int id2, const BpeNode& node) {
+      if ((size_ + 1) * 2 > slots_.size()) {
+        Rehash(slots_.empty() ? 1024 : slots_.size() * 2);
+      }
+
+      uint64_t key = MakeKey(id1, id2);
+      Slot& slot = slots_[Probe(key)];
+      if (slot.key == kEmptyKey) {
+        slot.key = key;
+        ++size_;
+      }
+      slot.node = node;
+    }
+
+    const BpeNode* Find(int id1, int id2) const {
+      if (slots_.empty()) {
+        return nullptr;
+      }
+
+      const Slot& slot = slots_[Probe(MakeKey(id1, id2))];
+      return slot.key == kEmptyKey ? nullptr : &slot.node;
     }
+
+    // Calls fn(id1, id2, node) for every merge, in no particular order.
+    template <typename Fn>
+    void ForEach(Fn&& fn) const {
+      for (const auto& slot : slots_) {
+        if (slot.key != kEmptyKey) {
+          fn(static_cast<int>(slot.key >> 32), static_cast<int>(slot.key & 0xFFFFFFFF), slot.node);
+        }
+      }
+    }
+
+   private:
+    // the ids are always non-negative, so no real key can be all ones.
+    static constexpr uint64_t kEmptyKey = ~uint64_t{0};
+
+    struct Slot {
+      uint64_t key = kEmptyKey;
+      BpeNode node{};
+    };
+
+    static uint64_t MakeKey(int id1, int id2) {
+      return (static_cast<uint64_t>(static_cast<uint32_t>(id1)) << 32) | static_cast<uint32_t>(id2);
+    }
+
+    // the finalizer of MurmurHash3, it spreads the bits of both ids over the whole word.
+    static uint64_t Mix(uint64_t key) {
+      key ^= key >> 33;
+      key *= 0xff51afd7ed558ccdULL;
+      key ^= key >> 33;
+      key *= 0xc4ceb9fe1a85ec53ULL;
+      key ^= key >> 33;
+      return key;
+    }
+
+    // returns the slot of the key, or the empty slot where it should be inserted.
+    size_t Probe(uint64_t key) const {
+      size_t mask = slots_.size() - 1;
+      size_t i = static_cast<size_t>(Mix(key)) & mask;
+      while (slots_[i].key != key && slots_[i].key != kEmptyKey) {
+        i = (i + 1) & mask;
+      }
+      return i;
+    }
+
+    void Rehash(size_t capacity) {
+      ort_extensions::HugePageVector<Slot> slots(capacity);
+      std::swap(slots, slots_);
+      for (const auto& slot : slots) {
+        if (slot.key != kEmptyKey) {
+          slots_[Probe(slot.key)] = slot;
+        }
+      }
+    }
+
+    ort_extensions::HugePageVector<Slot> slots_;  // of the huge pages of ORTX_HUGE_PAGES
+    size_t size_{};
   };
-  std::unordered_map<std::pair<int, int>, BpeNode, hash_pair> bpe_map_;
+#endif
+
+  MergeMap bpe_map_;
 
   int byte_encoder_[256] = {};
-  std::unordered_map<std::string, int> vocab_map_;
-  std::vector<std::string> id2token_map_;
+  TokenVocab vocab_;
+  TokenVocab whole_words_;  // the bytes of the words of a single token, see LoadWholeWords()
 
   int unk_id_;
   SpecialTokenMap special_tokens_;
 };
 
-class TokenWithRegularExp {
+// the tables of the vocabulary are values, which the BPE kernels read from the copy of the NUMA node of the thread
+namespace ort_extensions {
+template <>
+struct IsNumaReplicable<VocabData> : std::true_type {};
+}  // namespace ort_extensions
+
+// Loads the vocabulary and the merges, or the binary model in the vocab without any merges, or returns the instance which another kernel has loaded from the same ones.
+inline std::shared_ptr<const VocabData> LoadSharedVocabData(std::string_view vocab, std::string_view merges,
+                                                            const char* unk_token, const char* special_tokens) {
+  return SharedRegistry<VocabData>::Instance().GetOrLoad(
+      {vocab, merges, unk_token, special_tokens != nullptr ? special_tokens : ""}, [&]() {
+        auto vocab_data = std::make_shared<VocabData>();
+        if (VocabData::IsBinaryModel(vocab)) {
+          vocab_data->LoadBinary(vocab, unk_token, special_tokens);
+          return vocab_data;
+        }
+
+        vocab_data->Load(vocab, merges, unk_token, special_tokens);
+        return vocab_data;
+      });
+}
+
+// The GPT-2 pre-tokenizer, which works on either the UTF-32 code points or the UTF-8 bytes of the text.
+// The UTF-8 text must be well-formed, and the ASCII characters are classified with a lookup table.
+template <typename CharT>
+class BasicTokenWithRegularExp {
  public:
-  void Set(std::u32string_view val) {
+  using string_view = std::basic_string_view<CharT>;
+
+  void Set(string_view val) {
     m_text = val;
   }
 
-  std::pair<bool, std::u32string_view> GetNextToken() {
+  std::pair<bool, string_view> GetNextToken() {
     while (!m_text.empty()) {
       auto res = TryMatch();
       if (res.empty()) {
-        m_text = m_text.substr(1);
+        m_text = m_text.substr(CharLength(0));
         continue;
       }
       return {true, res};
@@ -365,132 +917,403 @@ class TokenWithRegularExp {
   }
 
  private:
-  std::u32string_view TryMatch() {
+  enum : uint8_t {
+    kLetter = 1,
+    kNumber = 2,
+    kSpace = 4,
+  };
+
+  string_view TryMatch() {
     // python pattern:
     // 's|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+
 
     // 's|'t|'re|'ve|'m|'ll|'d|
     // Note: the sequencial of the following if should not be switched, which follows the python regex's syntax
-    if ((m_text[0] == U'\'') && (m_text.size() > 1)) {
-      if ((m_text[1] == U's') || (m_text[1] == U't') ||
-          (m_text[1] == U'm') || (m_text[1] == U'd')) {
-        std::u32string_view res = m_text.substr(0, 2);
-        m_text = m_text.substr(2);
-        return res;
+    if ((m_text[0] == '\'') && (m_text.size() > 1)) {
+      if ((m_text[1] == 's') || (m_text[1] == 't') ||
+          (m_text[1] == 'm') || (m_text[1] == 'd')) {
+        return Take(2);
       }
 
       if (m_text.size() > 2) {
-        if (((m_text[1] == U'r') && (m_text[2] == U'e')) ||
-            ((m_text[1] == U'v') && (m_text[2] == U'e')) ||
-            ((m_text[1] == U'l') && (m_text[2] == U'l'))) {
-          std::u32string_view res = m_text.substr(0, 3);
-          m_text = m_text.substr(3);
-          return res;
+        if (((m_text[1] == 'r') && (m_text[2] == 'e')) ||
+            ((m_text[1] == 'v') && (m_text[2] == 'e')) ||
+            ((m_text[1] == 'l') && (m_text[2] == 'l'))) {
+          return Take(3);
         }
       }
     }
 
+    size_t len = 0;
+    const uint8_t first = Category(0, len);
+    const uint8_t second = (m_text[0] == ' ' && m_text.size() > 1) ? Category(1, len) : 0;
+
     // ?\p{L}+
-    if ((m_text[0] == U' ') && (m_text.size() > 1) && (ufal::unilib::unicode::category(m_text[1]) & ufal::unilib::unicode::L)) {
-      size_t i = 2;
-      for (; i < m_text.size(); ++i) {
-        if ((ufal::unilib::unicode::category(m_text[i]) & ufal::unilib::unicode::L) == 0)
-          break;
-      }
-      std::u32string_view res = m_text.substr(0, i);
-      m_text = m_text.substr(i);
-      return res;
+    if (second & kLetter) {
+      return Take(Span(1, kLetter));
     }
-    if (ufal::unilib::unicode::category(m_text[0]) & ufal::unilib::unicode::L) {
-      size_t i = 1;
-      for (; i < m_text.size(); ++i) {
-        if ((ufal::unilib::unicode::category(m_text[i]) & ufal::unilib::unicode::L) == 0)
-          break;
-      }
-      std::u32string_view res = m_text.substr(0, i);
-      m_text = m_text.substr(i);
-      return res;
+    if (first & kLetter) {
+      return Take(Span(0, kLetter));
     }
 
     // ?\p{N}+
-    if ((m_text[0] == U' ') && (m_text.size() > 1) && (ufal::unilib::unicode::category(m_text[1]) & ufal::unilib::unicode::N)) {
-      size_t i = 2;
-      for (; i < m_text.size(); ++i) {
-        if ((ufal::unilib::unicode::category(m_text[i]) & ufal::unilib::unicode::N) == 0)
-          break;
-      }
-      std::u32string_view res = m_text.substr(0, i);
-      m_text = m_text.substr(i);
-      return res;
+    if (second & kNumber) {
+      return Take(Span(1, kNumber));
     }
-    if (ufal::unilib::unicode::category(m_text[0]) & ufal::unilib::unicode::N) {
-      size_t i = 1;
-      for (; i < m_text.size(); ++i) {
-        if ((ufal::unilib::unicode::category(m_text[i]) & ufal::unilib::unicode::N) == 0)
-          break;
-      }
-      std::u32string_view res = m_text.substr(0, i);
-      m_text = m_text.substr(i);
-      return res;
+    if (first & kNumber) {
+      return Take(Span(0, kNumber));
     }
 
     // ?[^\s\p{L}\p{N}]+
-    if ((m_text[0] == U' ') && (m_text.size() > 1) && (NotLNZ(m_text[1]))) {
-      size_t i = 2;
-      for (; i < m_text.size(); ++i) {
-        if (!NotLNZ(m_text[i]))
-          break;
-      }
-      std::u32string_view res = m_text.substr(0, i);
-      m_text = m_text.substr(i);
-      return res;
+    if (m_text[0] == ' ' && m_text.size() > 1 && second == 0) {
+      return Take(Span(1, 0));
     }
-    if (NotLNZ(m_text[0])) {
-      size_t i = 1;
-      for (; i < m_text.size(); ++i) {
-        if (!NotLNZ(m_text[i]))
-          break;
-      }
-      std::u32string_view res = m_text.substr(0, i);
-      m_text = m_text.substr(i);
-      return res;
+    if (first == 0) {
+      return Take(Span(0, 0));
     }
 
     // \s+(?!\S)|\s+
-    if ((m_text.size() >= 1) && (IsZ(m_text[0]))) {
-      size_t i = 1;
-      for (; i < m_text.size(); ++i) {
-        if (!IsZ(m_text[i])) break;
+    if (first & kSpace) {
+      size_t last = 0;
+      size_t i = 0;
+      size_t count = 0;
+      while (i < m_text.size() && (Category(i, len) & kSpace)) {
+        last = i;
+        i += len;
+        ++count;
       }
-      if ((i > 1) && (i != m_text.size()))  //\s+(?!\S)
+      if ((count > 1) && (i != m_text.size()))  //\s+(?!\S)
       {
-        i--;
-        std::u32string_view res = m_text.substr(0, i);
-        m_text = m_text.substr(i);
-        return res;
+        return Take(last);
       }
       // \s+
-      std::u32string_view res = m_text.substr(0, i);
-      m_text = m_text.substr(i);
-      return res;
+      return Take(i);
     }
 
-    return std::u32string_view{};
+    return string_view{};
   }
 
-  static bool IsZ(char32_t ch) {
-    auto category = ufal::unilib::unicode::category(ch);
-    return (category & ufal::unilib::unicode::Z) != 0;
+  string_view Take(size_t len) {
+    string_view res = m_text.substr(0, len);
+    m_text = m_text.substr(len);
+    return res;
+  }
+
+  // Returns the end of the characters from pos, which all belong to the category, or none of L/N/Z for 0.
+  size_t Span(size_t pos, uint8_t category) const {
+    size_t len = 0;
+    while (pos < m_text.size()) {
+      uint8_t c = Category(pos, len);
+      if (category == 0 ? c != 0 : (c & category) == 0) {
+        break;
+      }
+      pos += len;
+    }
+    return pos;
   }
 
-  static bool NotLNZ(char32_t ch) {
+  size_t CharLength(size_t pos) const {
+    if constexpr (std::is_same_v<CharT, char>) {
+      size_t len = 0;
+      ustring::DecodeUTF8Char(m_text, pos, len);
+      return len;
+    } else {
+      return 1;
+    }
+  }
+
+  // Returns the category of the character at pos, and its length in the code units.
+  uint8_t Category(size_t pos, size_t& len) const {
+    char32_t ch = 0;
+    if constexpr (std::is_same_v<CharT, char>) {
+      ch = ustring::DecodeUTF8Char(m_text, pos, len);
+    } else {
+      ch = m_text[pos];
+      len = 1;
+    }
+    return ch < 0x80 ? AsciiCategories()[ch] : CategoryOf(ch);
+  }
+
+  static uint8_t CategoryOf(char32_t ch) {
     auto category = ufal::unilib::unicode::category(ch);
-    if (category & ufal::unilib::unicode::L) return false;
-    if (category & ufal::unilib::unicode::N) return false;
-    if (category & ufal::unilib::unicode::Z) return false;
-    return true;
+    uint8_t res = 0;
+    if (category & ufal::unilib::unicode::L) res |= kLetter;
+    if (category & ufal::unilib::unicode::N) res |= kNumber;
+    if (category & ufal::unilib::unicode::Z) res |= kSpace;
+    return res;
+  }
+
+  static const std::array<uint8_t, 128>& AsciiCategories() {
+    static const std::array<uint8_t, 128> table = [] {
+      std::array<uint8_t, 128> res{};
+      for (char32_t ch = 0; ch < 128; ++ch) {
+        res[ch] = CategoryOf(ch);
+      }
+      return res;
+    }();
+    return table;
   }
 
  private:
-  std::u32string_view m_text;
+  string_view m_text;
 };
+
+using TokenWithRegularExp = BasicTokenWithRegularExp<char32_t>;
+using Utf8TokenWithRegularExp = BasicTokenWithRegularExp<char>;
+
+// the buffer is reused by all the tokens, so that it doesn't allocate memory for each of them.
+inline void AssignBpeUTF8(std::string& buffer, std::string_view token) {
+  buffer.assign(token.data(), token.size());
+}
+
+inline void AssignBpeUTF8(std::string& buffer, std::u32string_view token) {
+  buffer.clear();
+  char utf8_buf[4];
+  for (char32_t ch : token) {
+    buffer.append(utf8_buf, ustring::EncodeUTF8Char(utf8_buf, ch));
+  }
+}
+
+// Tokenizes the input by tokenize(prefix) on the prefixes of VocabData::FindPrefixCut, which grow 2x from a few
+// bytes per id for max_length, until one gives min_ids ids, since those are the ones of the whole input then.
+// A long text truncated to max_length is only split, matched and pre-tokenized up to about where its ids end.
+template <typename CharT, typename Fn>
+std::vector<int64_t> TokenizeByPrefixes(const VocabData& vocab, std::basic_string_view<CharT> input,
+                                        int64_t max_length, int64_t min_ids, Fn&& tokenize) {
+  constexpr size_t kBytesPerId = 4;
+  if (max_length < 0 || static_cast<uint64_t>(max_length) >= input.size() / (2 * kBytesPerId)) {
+    return tokenize(input);
+  }
+
+  for (size_t window = std::max<size_t>(static_cast<size_t>(max_length) * kBytesPerId, 16);; window *= 2) {
+    const size_t cut = window < input.size() ? vocab.FindPrefixCut(input, window) : input.size();
+    std::vector<int64_t> res = tokenize(input.substr(0, cut));
+    if (cut == input.size() || static_cast<int64_t>(res.size()) >= min_ids) {
+      return res;
+    }
+  }
+}
+
+// The bounds of the work of the byte-level BPE on a text, which bound its latency on the adversarial inputs, like a
+// long word of no spaces, whose merges cost O(n log n) and whose bytes would be a key of the cache. 0 is no bound.
+struct BpeLimits {
+  // a longer word is merged as the chunks of up to these bytes, cut at the boundaries of the characters
+  size_t max_word_bytes = 0;
+  // the bytes of the words of a text which are merged, without the ones of the cache or the whole words, over
+  // which the tokenization fails; the prefixes of a truncated text and the segments of the prefix cache add up
+  size_t max_merged_bytes = 0;
+};
+
+// Merges the bytes of the word into the (id, length) symbols, in the chunks of up to max_word_bytes if it's longer.
+inline void MergeBpeWord(const VocabData& vocab, std::string_view word, size_t max_word_bytes,
+                         std::vector<std::pair<int, int>>& symbols) {
+  symbols.clear();
+  const size_t chunk_bytes = max_word_bytes == 0 ? word.size() : max_word_bytes;
+  std::vector<std::pair<int, int>> chunk_symbols;
+  for (size_t begin = 0; begin < word.size();) {
+    size_t end = std::min(begin + chunk_bytes, word.size());
+    // a chunk ends before a continuation byte only if a character is longer than the chunk
+    while (end < word.size() && end > begin + 1 && (static_cast<unsigned char>(word[end]) & 0xC0) == 0x80) {
+      --end;
+    }
+    auto& chunk = end - begin == word.size() ? symbols : chunk_symbols;
+    chunk.clear();
+    vocab.AppendByteSymbols(word.substr(begin, end - begin), chunk);
+    vocab.bpe(chunk);
+    if (&chunk != &symbols) {
+      symbols.insert(symbols.end(), chunk.begin(), chunk.end());
+    }
+    begin = end;
+  }
+}
+
+// Tokenizes a text by the GPT-2 pre-tokenizer, or the compiled pattern if it isn't null, and the byte-level BPE of
+// the vocabulary, without the early exit.
+template <typename CharT>
+std::vector<int64_t> Gpt2BpeTokenizeText(const VocabData& vocab, BpeCache& cache, std::basic_string_view<CharT> input,
+                                         int64_t max_length, const PreTokenizerDfa* pattern = nullptr,
+                                         const BpeLimits& limits = {}, size_t* merged_bytes = nullptr) {
+  // the temporaries of the words of the row are from the scratch arena of this thread
+  ScratchScope scratch;
+  std::vector<int64_t> res;
+  std::vector<std::pair<int, int>> byte_list;
+
+  if (IsEmptyUString(input)) {
+    return res;
+  }
+
+  auto special_token_split_res = [&]() {
+    ORTX_TRACE_SCOPE("GPT2Tokenizer.SplitBySpecialTokens");
+    return vocab.SplitBySpecialTokens(input);
+  }();
+  BasicTokenWithRegularExp<CharT> regcmp;
+  std::optional<BasicDfaPreTokenizer<CharT>> dfa_cmp;
+  if (pattern != nullptr) {
+    dfa_cmp.emplace(*pattern);
+  }
+  std::string utf8_token;
+  size_t text_merged_bytes = 0;
+  if (merged_bytes == nullptr) {
+    merged_bytes = &text_merged_bytes;
+  }
+
+  for (auto& seg_id : special_token_split_res) {
+    if (static_cast<int64_t>(res.size()) >= max_length) break;
+
+    if (seg_id.second != -1) {
+      res.push_back(seg_id.second);
+      continue;
+    }
+
+    // the segment is a view of the input, which outlives the following process
+    if (dfa_cmp) {
+      dfa_cmp->Set(seg_id.first);
+    } else {
+      regcmp.Set(seg_id.first);
+    }
+
+    while (static_cast<int64_t>(res.size()) < max_length) {
+      auto [b, tok] = dfa_cmp ? dfa_cmp->GetNextToken() : regcmp.GetNextToken();
+      if (!b) break;
+
+      AssignBpeUTF8(utf8_token, tok);
+
+      if (int id = vocab.FindWholeWord(utf8_token); id >= 0) {
+        byte_list.assign(1, std::make_pair(id, static_cast<int>(utf8_token.size())));
+      } else if (!cache.Lookup(utf8_token, byte_list)) {
+        ORTX_TRACE_SCOPE("GPT2Tokenizer.bpe");
+        *merged_bytes += utf8_token.size();
+        if (limits.max_merged_bytes != 0 && *merged_bytes > limits.max_merged_bytes) {
+          ORTX_CXX_API_THROW(MakeString("[GPT2Tokenizer]: The words of the text to merge are over max_merged_bytes of ",
+                                        limits.max_merged_bytes, "."),
+                             ORT_INVALID_ARGUMENT);
+        }
+        // the merges of the words missed by the cache are the long part of a row
+        ort_extensions::RunCancellation::ThrowIfCancelled("GPT2Tokenizer");
+        MergeBpeWord(vocab, utf8_token, limits.max_word_bytes, byte_list);
+        // a word of the chunks is too long to be a key of the cache
+        if (limits.max_word_bytes == 0 || utf8_token.size() <= limits.max_word_bytes) {
+          cache.Insert(utf8_token, byte_list);
+        }
+      }
+
+      for (auto p : byte_list) {
+        if (static_cast<int64_t>(res.size()) >= max_length) {
+          break;
+        }
+
+        res.push_back(p.first);
+      }
+    }
+  }
+
+  return res;
+}
+
+// The ids of the segments of the long texts, which are cut by VocabData::FindPrefixCut every kBpePrefixSegment
+// characters or so. An entry is keyed by the hash of the whole prefix up to the end of its segment, chained from the
+// hash of the prefix before it, so the texts which start with the same system prompt or template share the entries
+// of its segments, and only the segments after it are tokenized.
+using BpePrefixCache = LruCache<uint64_t, std::vector<int64_t>>;
+constexpr int64_t kDefaultBpePrefixCacheCapacity = 1024;
+constexpr size_t kBpePrefixSegment = 256;
+
+// the finalizer of MurmurHash3 over the key of the prefix before the segment, the hash of the segment and its end
+inline uint64_t ChainPrefixKey(uint64_t key, size_t segment_hash, size_t end) {
+  key ^= static_cast<uint64_t>(segment_hash) + 0x9E3779B97F4A7C15ULL * (static_cast<uint64_t>(end) + 1);
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  key *= 0xc4ceb9fe1a85ec53ULL;
+  key ^= key >> 33;
+  return key;
+}
+
+// Tokenizes the input by tokenize(text, max_length) on its segments between the cuts, whose ids are looked up in,
+// and added to, the prefix cache, and on the rest after the last cut. The ids of a text are those of its segments
+// in turn, as no word nor special token crosses a cut. The cached segments of a prefix are looked up from the first
+// one until one misses, and the segments from there on are tokenized and added. The rest of a text, its own part,
+// isn't cached.
+template <typename CharT, typename Fn>
+std::vector<int64_t> TokenizeByCachedPrefixes(const VocabData& vocab, BpePrefixCache& cache,
+                                              std::basic_string_view<CharT> input, int64_t max_length,
+                                              Fn&& tokenize) {
+  if (cache.Capacity() == 0 || input.size() < 2 * kBpePrefixSegment) {
+    return tokenize(input, max_length);
+  }
+
+  std::vector<int64_t> res;
+  std::vector<int64_t> segment_ids;
+  uint64_t key = 0;
+  bool cached = true;  // whether all the segments before are in the cache
+  size_t begin = 0;
+  while (static_cast<int64_t>(res.size()) < max_length && begin + kBpePrefixSegment < input.size()) {
+    const size_t cut = vocab.FindPrefixCut(input, begin + kBpePrefixSegment);
+    if (cut == input.size()) {
+      break;
+    }
+    const auto segment = input.substr(begin, cut - begin);
+    key = ChainPrefixKey(key, std::hash<std::basic_string_view<CharT>>{}(segment), cut);
+    if (!cached || !cache.Lookup(key, segment_ids)) {
+      cached = false;
+      // a text which is only spaces has no ids, so a segment of them isn't the start of the ids of the input
+      if (IsEmptyUString(segment)) {
+        return tokenize(input, max_length);
+      }
+      segment_ids = tokenize(segment, INT64_MAX);
+      cache.Insert(key, segment_ids);
+    }
+    res.insert(res.end(), segment_ids.begin(), segment_ids.end());
+    begin = cut;
+  }
+
+  if (static_cast<int64_t>(res.size()) < max_length) {
+    const std::vector<int64_t> rest = tokenize(input.substr(begin), max_length - static_cast<int64_t>(res.size()));
+    res.insert(res.end(), rest.begin(), rest.end());
+  }
+  if (static_cast<int64_t>(res.size()) > max_length) {
+    res.resize(static_cast<size_t>(max_length));
+  }
+  return res;
+}
+
+// Tokenizes a text by the GPT-2 pre-tokenizer, or the compiled pattern, and the byte-level BPE of the vocabulary, up
+// to max_length ids. The input is a UTF-32 ustring, or the UTF-8 bytes if they are well-formed, which skips the
+// transcoding. The merges of the words are looked up in, and added to, the cache, and the segments of the long
+// texts in the prefix cache if it isn't null. The limits bound the merges of each text, or of each of its prefixes.
+template <typename CharT>
+std::vector<int64_t> Gpt2BpeTokenize(const VocabData& vocab, BpeCache& cache, std::basic_string_view<CharT> input,
+                                     int64_t max_length, const PreTokenizerDfa* pattern = nullptr,
+                                     BpePrefixCache* prefix_cache = nullptr, const BpeLimits& limits = {}) {
+  // the cuts of the prefixes are where the GPT-2 pattern starts a word, which another pattern needn't do
+  if (pattern != nullptr) {
+    return Gpt2BpeTokenizeText(vocab, cache, input, max_length, pattern, limits);
+  }
+  size_t merged_bytes = 0;
+  auto tokenize = [&](std::basic_string_view<CharT> text, int64_t text_max_length) {
+    return TokenizeByPrefixes(vocab, text, text_max_length, text_max_length,
+                              [&](std::basic_string_view<CharT> prefix) {
+                                return Gpt2BpeTokenizeText(vocab, cache, prefix, text_max_length, nullptr, limits,
+                                                           &merged_bytes);
+                              });
+  };
+  if (prefix_cache == nullptr) {
+    return tokenize(input, max_length);
+  }
+  return TokenizeByCachedPrefixes(vocab, *prefix_cache, input, max_length, tokenize);
+}
+
+// Appends the bytes of a token of a byte-level BPE vocabulary, whose characters stand for the bytes as in
+// kBytesToUnicode.
+inline void AppendBpeTokenBytes(std::string_view token, std::string& out) {
+  for (size_t i = 0, len = 0; i < token.size(); i += len) {
+    const char32_t ch = ustring::DecodeUTF8Char(token, i, len);
+    const int byte = ch < kUnicodeToBytes.size() ? kUnicodeToBytes[ch] : -1;
+    if (byte < 0) {
+      // a special or added token is kept as it is
+      out.append(token.substr(i, len));
+    } else {
+      out.push_back(static_cast<char>(byte));
+    }
+  }
+}
@@ -3,19 +3,39 @@
 
 #pragma once
 #include "bpe_tokenizer.hpp"
+#include "token_pair.hpp"
+#include "output_dtype.hpp"
 
+// The outputs are of T, int64_t or int32_t by the output_dtype attribute.
+template <typename T>
 struct KernelClipBpeTokenizer : BaseKernel {
   KernelClipBpeTokenizer(const OrtApi& api, const OrtKernelInfo& info);
-  void Compute(const ortc::Tensor<std::string>& input,
-               ortc::Tensor<int64_t>& tokenize_output,
-               std::optional<ortc::Tensor<int64_t>*> attention_mask,
-               std::optional<ortc::Tensor<int64_t>*> offset_mapping) const;
+  static constexpr bool kShareableAcrossSessions = true;  // with ORTX_SHARE_KERNELS=1
+  // The optional text_pair, of the shape of the input, has the second texts of the pairs.
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               std::optional<const ortc::Tensor<std::string_view>*> text_pair,
+               ortc::Tensor<T>& tokenize_output,
+               std::optional<ortc::Tensor<T>*> attention_mask,
+               std::optional<ortc::Tensor<T>*> offset_mapping,
+               std::optional<ortc::Tensor<T>*> token_type_ids) const;
+
+  static void InferOutputShape(const ortc::ShapeInferContext& ctx);
+
+  uint64_t CacheHits() const { return bpe_cache_.Hits(); }
+  uint64_t CacheMisses() const { return bpe_cache_.Misses(); }
 
  private:
   using OffsetMappingType = std::list<std::pair<size_t, size_t>>;
   std::vector<int64_t> Tokenize(ustring& input, int64_t max_length, bool compute_offset_mapping,
                                 std::list<OffsetMappingType>& offset_map) const;
+  // The ids of a text of a pair, without the special tokens around it.
+  std::vector<int64_t> TokenizeSequence(std::string_view text, int64_t max_length) const;
+  void ComputePairs(const ortc::Tensor<std::string_view>& input, const std::vector<std::string_view>& pair_input,
+                    ortc::Tensor<T>& tokenize_output,
+                    std::optional<ortc::Tensor<T>*> attention_mask,
+                    std::optional<ortc::Tensor<T>*> token_type_ids) const;
 
   int64_t padding_length_;
-  std::shared_ptr<VocabData> bbpe_tokenizer_;
+  BackgroundLoad<VocabData> bbpe_tokenizer_;
+  mutable BpeCache bpe_cache_;
 };
@@ -0,0 +1,136 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// A trie of byte strings in the two arrays of a double array (Aoe, An Efficient Digital Search Algorithm by Using a
+// Double-Array Structure, 1989), the structure of the Darts trie of SentencePiece: the child of a node by a byte is
+// at the base of the node + the byte + 1, and it's a child if its check is the node. The end of a key is the child
+// by 0, whose base is the value of the key, so a lookup is two loads for each byte, without any pointer or branch
+// over the edges.
+class DoubleArrayTrie {
+ public:
+  // Builds the trie of the keys, which are sorted and unique, and their values, which aren't negative.
+  void Build(const std::vector<std::pair<std::string_view, int32_t>>& keys) {
+    units_.assign(1, Unit{0, kNone});
+    first_free_ = 1;
+    if (!keys.empty()) {
+      Insert(keys, 0, keys.size(), 0, 0);
+    }
+    units_.shrink_to_fit();
+  }
+
+  // Calls fn(length, value) for each key which is a prefix of the text, from the shortest one.
+  template <typename Fn>
+  void CommonPrefixSearch(std::string_view text, Fn&& fn) const {
+    int32_t node = 0;
+    for (size_t i = 0;; ++i) {
+      const int32_t leaf = units_[node].base;
+      if (i > 0 && IsChild(leaf, node)) {
+        fn(i, units_[leaf].base);
+      }
+      if (i == text.size()) {
+        return;
+      }
+      const int32_t next = units_[node].base + static_cast<unsigned char>(text[i]) + 1;
+      if (!IsChild(next, node)) {
+        return;
+      }
+      node = next;
+    }
+  }
+
+  // The value of the key, or -1 if it isn't in the trie.
+  int32_t Find(std::string_view key) const {
+    int32_t node = 0;
+    for (char ch : key) {
+      const int32_t next = units_[node].base + static_cast<unsigned char>(ch) + 1;
+      if (!IsChild(next, node)) {
+        return -1;
+      }
+      node = next;
+    }
+    const int32_t leaf = units_[node].base;
+    return !key.empty() && IsChild(leaf, node) ? units_[leaf].base : -1;
+  }
+
+  size_t UnitCount() const { return units_.size(); }
+
+ private:
+  struct Unit {
+    int32_t base;
+    int32_t check;  // the parent, or kNone for a free unit
+  };
+
+  static constexpr int32_t kNone = -1;
+
+  bool IsChild(int32_t unit, int32_t node) const {
+    return static_cast<size_t>(unit) < units_.size() && units_[unit].check == node;
+  }
+
+  // Places the children of the node, which are the bytes at depth of the keys [begin, end), and then their children,
+  // depth first.
+  void Insert(const std::vector<std::pair<std::string_view, int32_t>>& keys, size_t begin, size_t end, size_t depth,
+              int32_t node) {
+    std::vector<std::pair<int32_t, size_t>> children;  // (label, the first key), of the sorted labels
+    for (size_t i = begin; i < end; ++i) {
+      const std::string_view key = keys[i].first;
+      const int32_t label = key.size() == depth ? 0 : static_cast<unsigned char>(key[depth]) + 1;
+      if (children.empty() || children.back().first != label) {
+        children.emplace_back(label, i);
+      }
+    }
+
+    const int32_t base = FindBase(children);
+    units_[node].base = base;
+    for (const auto& child : children) {
+      units_[base + child.first].check = node;
+    }
+    while (static_cast<size_t>(first_free_) < units_.size() && units_[first_free_].check != kNone) {
+      ++first_free_;
+    }
+
+    for (size_t c = 0; c < children.size(); ++c) {
+      const auto [label, first] = children[c];
+      if (label == 0) {
+        units_[base].base = keys[first].second;
+      } else {
+        const size_t last = c + 1 < children.size() ? children[c + 1].second : end;
+        Insert(keys, first, last, depth + 1, base + label);
+      }
+    }
+  }
+
+  // The first base from the first free unit at which all the children are free units.
+  int32_t FindBase(const std::vector<std::pair<int32_t, size_t>>& children) {
+    for (int32_t pos = first_free_;; ++pos) {
+      const int32_t base = pos - children.front().first;
+      if (base < 1 || (static_cast<size_t>(pos) < units_.size() && units_[pos].check != kNone)) {
+        continue;
+      }
+      const size_t needed = static_cast<size_t>(base + children.back().first) + 1;
+      if (needed > units_.size()) {
+        units_.resize(std::max(needed, units_.size() + units_.size() / 2), Unit{0, kNone});
+      }
+
+      bool fits = true;
+      for (const auto& child : children) {
+        if (units_[base + child.first].check != kNone) {
+          fits = false;
+          break;
+        }
+      }
+      if (fits) {
+        return base;
+      }
+    }
+  }
+
+  std::vector<Unit> units_{Unit{0, kNone}};
+  int32_t first_free_ = 1;
+};
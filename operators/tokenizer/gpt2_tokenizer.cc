@@ -3,16 +3,21 @@
 // Partial code comes from other Microsoft employee.
 
 #include "gpt2_tokenizer.hpp"
+#include "trace_scope.h"
+#include "unique_rows.h"
 
-KernelBpeTokenizer::KernelBpeTokenizer(const OrtApi& api, const OrtKernelInfo& info)
+template <typename T>
+KernelBpeTokenizer<T>::KernelBpeTokenizer(const OrtApi& api, const OrtKernelInfo& info)
     : BaseKernel(api, info) {
-  std::string vocab = ort_.KernelInfoGetAttribute<std::string>(&info, "vocab");
+  CheckOutputDtype<T>(*this, "GPT2Tokenizer");
+  ort_extensions::AssetBytes vocab = ort_extensions::GetAssetAttribute(*this, "vocab");
   if (vocab.empty()) {
     ORTX_CXX_API_THROW("vocabulary shouldn't be empty.", ORT_INVALID_ARGUMENT);
   }
 
-  std::string merges = ort_.KernelInfoGetAttribute<std::string>(&info, "merges");
-  if (merges.empty()) {
+  // a binary model, made by the converter, has the merges in it.
+  ort_extensions::AssetBytes merges = ort_extensions::GetAssetAttribute(*this, "merges", true);
+  if (merges.empty() && !VocabData::IsBinaryModel(vocab)) {
     ORTX_CXX_API_THROW("merges shouldn't be empty.", ORT_INVALID_ARGUMENT);
   }
 
@@ -24,111 +29,310 @@ KernelBpeTokenizer::KernelBpeTokenizer(const OrtApi& api, const OrtKernelInfo& i
     ORTX_CXX_API_THROW("padding_length should be more than 0 or equal -1", ORT_INVALID_ARGUMENT);
   }
 
-  std::stringstream vocabu_stream(vocab);
-  std::stringstream merges_stream(merges);
-  bbpe_tokenizer_ = std::make_shared<VocabData>();
-  bbpe_tokenizer_->Load(vocabu_stream, merges_stream, "<|endoftext|>", "<|endoftext|>");
-}
+  int64_t window_length = TryToGetAttributeWithDefault<int64_t>("window_length", 0);
+  int64_t stride = TryToGetAttributeWithDefault<int64_t>("stride", 0);
+  if (window_length < 0 || stride < 0 || (window_length > 0 && stride >= window_length)) {
+    ORTX_CXX_API_THROW("window_length should be 0, or more than stride", ORT_INVALID_ARGUMENT);
+  }
+  if (window_length > 0 && padding_length_ != -1) {
+    ORTX_CXX_API_THROW("padding_length can't be set with window_length", ORT_INVALID_ARGUMENT);
+  }
+  windows_ = TokenWindows{static_cast<size_t>(window_length), static_cast<size_t>(stride)};
 
-std::vector<int64_t> KernelBpeTokenizer::Tokenize(const ustring& input, int64_t max_length) const {
-  std::vector<int64_t> res;
-  std::list<std::pair<int, int>> byte_list;
+  padded_length_ = PaddedLength(*this);
+  if (padded_length_.IsSet() && (padding_length_ != -1 || window_length > 0)) {
+    ORTX_CXX_API_THROW("pad_to_multiple_of and length_buckets can't be set with padding_length or window_length",
+                       ORT_INVALID_ARGUMENT);
+  }
 
-  if (IsEmptyUString(input)) {
-    return res;
+  ragged_ = TryToGetAttributeWithDefault<int64_t>("ragged", 0) != 0;
+  if (ragged_ && (window_length > 0 || padded_length_.IsSet())) {
+    ORTX_CXX_API_THROW("ragged can't be set with window_length, pad_to_multiple_of or length_buckets",
+                       ORT_INVALID_ARGUMENT);
   }
 
-  auto special_token_split_res = bbpe_tokenizer_->SplitBySpecialTokens(input);
-  TokenWithRegularExp regcmp;
+  int64_t cache_capacity = TryToGetAttributeWithDefault<int64_t>("cache_capacity", kDefaultBpeCacheCapacity);
+  if (cache_capacity < 0) {
+    ORTX_CXX_API_THROW("cache_capacity shouldn't be negative", ORT_INVALID_ARGUMENT);
+  }
+  bpe_cache_.SetCapacity(static_cast<size_t>(cache_capacity));
+  bpe_cache_.SetStatsName("bpe_cache");
 
-  for (auto& seg_id : special_token_split_res) {
-    if (static_cast<int64_t>(res.size()) >= max_length) break;
+  int64_t prefix_cache_capacity = TryToGetAttributeWithDefault<int64_t>("prefix_cache_capacity", 0);
+  if (prefix_cache_capacity < 0) {
+    ORTX_CXX_API_THROW("prefix_cache_capacity shouldn't be negative", ORT_INVALID_ARGUMENT);
+  }
+  prefix_cache_.SetCapacity(static_cast<size_t>(prefix_cache_capacity));
+  prefix_cache_.SetStatsName("bpe_prefix_cache");
 
-    if (seg_id.second != -1) {
-      res.push_back(seg_id.second);
-      continue;
-    }
+  int64_t max_word_bytes = TryToGetAttributeWithDefault<int64_t>("max_word_bytes", 0);
+  int64_t max_merged_bytes = TryToGetAttributeWithDefault<int64_t>("max_merged_bytes", 0);
+  if (max_word_bytes < 0 || max_merged_bytes < 0) {
+    ORTX_CXX_API_THROW("max_word_bytes and max_merged_bytes shouldn't be negative", ORT_INVALID_ARGUMENT);
+  }
+  limits_.max_word_bytes = static_cast<size_t>(max_word_bytes);
+  limits_.max_merged_bytes = static_cast<size_t>(max_merged_bytes);
 
-    auto cur_input = std::move(seg_id.first);
-    // Note: keep ptr to make sure the string_view is valid in the following process
-    const char32_t* ptr = cur_input.c_str();
-    regcmp.Set(ptr);
+  num_threads_ = ReadNumThreadsAttribute(*this);
+  dedup_ = TryToGetAttributeWithDefault<int64_t>("dedup", 0) != 0;
 
-    while (static_cast<int64_t>(res.size()) < max_length) {
-      auto [b, tok] = regcmp.GetNextToken();
-      if (!b) break;
+  std::string pattern = TryToGetAttributeWithDefault<std::string>("pattern", "");
+  if (!pattern.empty()) {
+    pattern_ = std::make_unique<PreTokenizerDfa>(pattern);
+  }
 
-      std::string utf8_token = std::string(ustring(tok));
+  pair_template_.second_type_id = 1;
 
-      byte_list.clear();
-      for (char& cp : utf8_token) {
-        byte_list.push_back(std::make_pair(bbpe_tokenizer_->ByteEncoder()[static_cast<unsigned char>(cp)], 1));
-      }
+  bbpe_tokenizer_.Start([vocab = std::move(vocab), merges = std::move(merges)]() {
+    return LoadSharedVocabData(vocab, merges, "<|endoftext|>", "<|endoftext|>");
+  });
+}
 
-      bbpe_tokenizer_->bpe(byte_list);
+template <typename T>
+template <typename CharT>
+std::vector<int64_t> KernelBpeTokenizer<T>::Tokenize(std::basic_string_view<CharT> input, int64_t max_length) const {
+  return Gpt2BpeTokenize(*bbpe_tokenizer_, bpe_cache_, input, max_length, pattern_.get(), &prefix_cache_,
+                         limits_);
+}
 
-      for (auto p : byte_list) {
-        if (static_cast<int64_t>(res.size()) >= max_length) {
-          break;
-        }
+template <typename T>
+std::vector<int64_t> KernelBpeTokenizer<T>::TokenizeText(std::string_view text, int64_t max_length) const {
+  ORTX_TRACE_SCOPE("GPT2Tokenizer.Tokenize");
+  if (ustring::ValidateUTF8(text)) {
+    return Tokenize(text, max_length);
+  }
+  ustring ustr(text);
+  return Tokenize(std::u32string_view(ustr), max_length);
+}
+
+template <typename T>
+template <typename SetRow>
+void KernelBpeTokenizer<T>::TokenizeRows(const std::vector<std::string_view>& str_input,
+                                         const std::vector<std::string_view>* pair_input,
+                                         std::vector<size_t>& second_begin, SetRow&& set_row) const {
+  const int64_t row_max_length = padding_length_ < 0 ? INT64_MAX : padding_length_;
+  if (pair_input == nullptr) {
+    ort_extensions::ComputeRows(
+        str_input, dedup_, num_threads_,
+        [&](std::string_view text) { return TokenizeText(text, row_max_length); }, set_row);
+    return;
+  }
+
+  // a pair is truncated across its texts, each of which is only tokenized up to the ids the pair can keep of it
+  const int64_t sequence_max_length = pair_template_.MaxSequenceLength(padding_length_);
+  ParallelFor(str_input.size(), num_threads_, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      set_row(i, pair_template_.Apply(TokenizeText(str_input[i], sequence_max_length),
+                                      TokenizeText((*pair_input)[i], sequence_max_length), padding_length_,
+                                      second_begin[i]));
+    }
+  });
+}
 
-        res.push_back(p.first);
+template <typename T>
+void KernelBpeTokenizer<T>::ComputeRagged(const std::vector<std::string_view>& str_input,
+                                          const std::vector<std::string_view>* pair_input,
+                                          ortc::Tensor<T>& tokenize_output,
+                                          std::optional<ortc::Tensor<T>*> row_splits,
+                                          std::optional<ortc::Tensor<T>*> length_order,
+                                          std::optional<ortc::Tensor<T>*> token_type_ids) const {
+  std::vector<std::vector<int64_t>> rows(str_input.size());
+  std::vector<size_t> second_begin(str_input.size(), SIZE_MAX);
+  TokenizeRows(str_input, pair_input, second_begin,
+               [&](size_t i, std::vector<int64_t>&& ids) { rows[i] = std::move(ids); });
+
+  // the ids of each row follow the ones of the rows before it, without any padding
+  std::vector<size_t> splits(rows.size() + 1, 0);
+  for (size_t i = 0; i < rows.size(); ++i) {
+    splits[i + 1] = splits[i] + rows[i].size();
+  }
+  const std::vector<int64_t> output_dim{static_cast<int64_t>(splits.back())};
+  T* ids = tokenize_output.Allocate(output_dim);
+  T* type_ids = token_type_ids.has_value() ? (*token_type_ids)->Allocate(output_dim) : nullptr;
+  if (row_splits.has_value()) {
+    T* p_splits = (*row_splits)->Allocate({static_cast<int64_t>(splits.size())});
+    std::copy(splits.begin(), splits.end(), p_splits);
+  }
+  if (length_order.has_value()) {
+    WriteLengthOrder(rows.size(), [&splits](size_t i) { return splits[i + 1] - splits[i]; },
+                     (*length_order)->Allocate({static_cast<int64_t>(rows.size())}));
+  }
+  ParallelFor(rows.size(), num_threads_, [&](size_t begin, size_t end) {
+    ORTX_TRACE_SCOPE("GPT2Tokenizer.Pad");
+    for (size_t i = begin; i < end; ++i) {
+      std::copy(rows[i].begin(), rows[i].end(), ids + splits[i]);
+      if (type_ids != nullptr) {
+        pair_template_.WriteTypeIds(second_begin[i], rows[i].size(), rows[i].size(), type_ids + splits[i]);
       }
+      std::vector<int64_t>().swap(rows[i]);
     }
+  });
+}
+
+template <typename T>
+void KernelBpeTokenizer<T>::ComputeWindows(const std::vector<std::string_view>& str_input,
+                                           ortc::Tensor<T>& tokenize_output,
+                                           std::optional<ortc::Tensor<T>*> attention_mask,
+                                           std::optional<ortc::Tensor<T>*> overflow_to_sample_mapping,
+                                           std::optional<ortc::Tensor<T>*> length_order) const {
+  // each row is tokenized once, and its windows follow the ones of the rows before it
+  std::vector<std::vector<int64_t>> rows(str_input.size());
+  ort_extensions::ComputeRows(
+      str_input, dedup_, num_threads_, [&](std::string_view text) { return TokenizeText(text, INT64_MAX); },
+      [&](size_t i, std::vector<int64_t>&& ids) { rows[i] = std::move(ids); });
+
+  std::vector<size_t> first_window(rows.size() + 1, 0);
+  for (size_t i = 0; i < rows.size(); ++i) {
+    first_window[i + 1] = first_window[i] + windows_.Count(rows[i].size());
   }
 
-  return res;
+  const size_t length = windows_.length;
+  const std::vector<int64_t> output_dim{static_cast<int64_t>(first_window.back()), static_cast<int64_t>(length)};
+  T* ids = tokenize_output.Allocate(output_dim);
+  T* mask = attention_mask.has_value() ? (*attention_mask)->Allocate(output_dim) : nullptr;
+  T* mapping = overflow_to_sample_mapping.has_value()
+                         ? (*overflow_to_sample_mapping)->Allocate({output_dim[0]})
+                         : nullptr;
+  ParallelFor(rows.size(), num_threads_, [&](size_t begin, size_t end) {
+    ORTX_TRACE_SCOPE("GPT2Tokenizer.Pad");
+    for (size_t i = begin; i < end; ++i) {
+      const auto& row = rows[i];
+      for (size_t w = first_window[i]; w < first_window[i + 1]; ++w) {
+        const size_t id_begin = windows_.Begin(w - first_window[i]);
+        const size_t id_count = windows_.End(w - first_window[i], row.size()) - id_begin;
+        T* dst = ids + w * length;
+        std::fill(std::copy_n(row.begin() + id_begin, id_count, dst), dst + length, 0);
+        if (mask != nullptr) {
+          std::fill(std::fill_n(mask + w * length, id_count, 1), mask + (w + 1) * length, 0);
+        }
+        if (mapping != nullptr) {
+          mapping[w] = static_cast<T>(i);
+        }
+      }
+    }
+  });
+
+  if (length_order.has_value()) {
+    // only the last window of a row can be shorter
+    auto window_ids = [&](size_t w) {
+      const size_t row = std::upper_bound(first_window.begin(), first_window.end(), w) - first_window.begin() - 1;
+      return windows_.End(w - first_window[row], rows[row].size()) - windows_.Begin(w - first_window[row]);
+    };
+    WriteLengthOrder(first_window.back(), window_ids, (*length_order)->Allocate({output_dim[0]}));
+  }
 }
 
-void KernelBpeTokenizer::Compute(const ortc::Tensor<std::string>& input,
-                                 ortc::Tensor<int64_t>& tokenize_output,
-                                 std::optional<ortc::Tensor<int64_t>*> attention_mask) const {
+template <typename T>
+void KernelBpeTokenizer<T>::Compute(const ortc::Tensor<std::string_view>& input,
+                                    std::optional<const ortc::Tensor<std::string_view>*> text_pair,
+                                    ortc::Tensor<T>& tokenize_output,
+                                    std::optional<ortc::Tensor<T>*> attention_mask,
+                                    std::optional<ortc::Tensor<T>*> overflow_to_sample_mapping,
+                                    std::optional<ortc::Tensor<T>*> length_order,
+                                    std::optional<ortc::Tensor<T>*> token_type_ids) const {
   // Setup inputs
-  std::vector<std::string> str_input{input.Data()};
+  auto& str_input = input.Data();
   const auto& input_dim = input.Shape();
 
-  std::vector<std::vector<int64_t>> tokenize_results;
-  for (auto& str : str_input) {
-    tokenize_results.emplace_back(Tokenize(ustring(str), padding_length_ < 0 ? INT64_MAX : padding_length_));
+  const std::vector<std::string_view>* pair_input = nullptr;
+  if (text_pair.has_value() && *text_pair != nullptr) {
+    if ((*text_pair)->Shape() != input_dim) {
+      ORTX_CXX_API_THROW("[GPT2Tokenizer]: the text_pair should have the shape of the input.", ORT_INVALID_ARGUMENT);
+    }
+    pair_input = &(*text_pair)->Data();
   }
 
-  size_t max_length = 0;
-  if (padding_length_ == -1) {
-    for (auto& res : tokenize_results) {
-      max_length = std::max(max_length, res.size());
+  if (windows_.length > 0) {
+    if (pair_input != nullptr || token_type_ids.has_value()) {
+      ORTX_CXX_API_THROW("[GPT2Tokenizer]: the windows are of single texts.", ORT_INVALID_ARGUMENT);
+    }
+    if (input_dim.size() != 1) {
+      ORTX_CXX_API_THROW("[GPT2Tokenizer]: the input of the windows should be 1-D.", ORT_INVALID_ARGUMENT);
     }
-  } else {
-    max_length = static_cast<size_t>(padding_length_);
+    ComputeWindows(str_input, tokenize_output, attention_mask, overflow_to_sample_mapping, length_order);
+    return;
   }
 
-  std::vector<int64_t> output_dim = input_dim;
-  output_dim.push_back(max_length);
-  auto* token = tokenize_output.Allocate(output_dim);
-  if (attention_mask.has_value()) {
-    auto* mask = (*attention_mask)->Allocate(output_dim);
-    int idx = 0;
-    for (auto& res : tokenize_results) {
-      for (int64_t id : res) {
-        mask[idx] = 1;
-        idx++;
-      }
-
-      for (size_t i = res.size(); i < max_length; i++) {
-        mask[idx] = 0;
-        idx++;
-      }
+  // without the windows, each row is of its own sample
+  if (overflow_to_sample_mapping.has_value()) {
+    T* mapping = (*overflow_to_sample_mapping)->Allocate(input_dim);
+    for (size_t i = 0; i < str_input.size(); ++i) {
+      mapping[i] = static_cast<T>(i);
     }
   }
-  int idx = 0;
-  for (auto& res : tokenize_results) {
-    for (int64_t id : res) {
-      token[idx] = id;
-      idx++;
-    }
 
-    for (size_t i = res.size(); i < max_length; i++) {
-      token[idx] = 0;
-      idx++;
+  if (ragged_) {
+    ComputeRagged(str_input, pair_input, tokenize_output, attention_mask, length_order, token_type_ids);
+    return;
+  }
+
+  // the rows are tokenized concurrently into the output, or kept until the longest one gives its shape.
+  ortc::PaddedOutput<T, int64_t> tokens(tokenize_output, input_dim, padding_length_ < 0 ? -1 : padding_length_);
+  std::vector<size_t> second_begin(str_input.size(), SIZE_MAX);
+  TokenizeRows(str_input, pair_input, second_begin,
+               [&](size_t i, std::vector<int64_t>&& ids) { tokens.SetRow(i, std::move(ids)); });
+
+  tokens.Allocate([this](size_t length) { return padded_length_.Round(length); });
+  const size_t max_length = tokens.RowLength();
+  if (length_order.has_value()) {
+    WriteLengthOrder(tokens.RowCount(), [&tokens](size_t i) { return tokens.Length(i); },
+                     (*length_order)->Allocate(input_dim));
+  }
+  T* mask = nullptr;
+  if (attention_mask.has_value()) {
+    std::vector<int64_t> output_dim = input_dim;
+    output_dim.push_back(max_length);
+    mask = (*attention_mask)->Allocate(output_dim);
+  }
+  T* type_ids = nullptr;
+  if (token_type_ids.has_value()) {
+    std::vector<int64_t> output_dim = input_dim;
+    output_dim.push_back(max_length);
+    type_ids = (*token_type_ids)->Allocate(output_dim);
+  }
+  ParallelFor(tokens.RowCount(), num_threads_, [&](size_t begin, size_t end) {
+    ORTX_TRACE_SCOPE("GPT2Tokenizer.Pad");
+    tokens.WriteRows(begin, end);
+    for (size_t i = begin; i < end && mask != nullptr; ++i) {
+      T* mask_row = mask + i * max_length;
+      std::fill(mask_row, mask_row + tokens.Length(i), 1);
+      std::fill(mask_row + tokens.Length(i), mask_row + max_length, 0);
+    }
+    for (size_t i = begin; i < end && type_ids != nullptr; ++i) {
+      pair_template_.WriteTypeIds(second_begin[i], tokens.Length(i), max_length, type_ids + i * max_length);
     }
+  });
+}
+
+template <typename T>
+void KernelBpeTokenizer<T>::InferOutputShape(const ortc::ShapeInferContext& ctx) {
+  // the rows are padded to padding_length, or to the longest one, and the windows are [num_windows, window_length]
+  const ONNXTensorElementDataType type = GetOutputDtype(ctx);
+  const int64_t padding_length = ctx.GetAttributeInt("padding_length", -1);
+  const int64_t window_length = ctx.GetAttributeInt("window_length", 0);
+  std::vector<int64_t> row_dims{-1};
+  std::vector<int64_t> output_dims{-1, window_length};
+  if (ctx.GetAttributeInt("ragged", 0) != 0) {
+    // the ids of all the rows, and the row_splits of the batch + 1 rows in the place of the attention_mask
+    row_dims = ctx.InputShape(0);
+    ctx.SetOutput(0, type, {-1});
+    ctx.SetOptionalOutput(1, type, {-1});
+    ctx.SetOptionalOutput(2, type, row_dims);
+    ctx.SetOptionalOutput(3, type, row_dims);
+    ctx.SetOptionalOutput(4, type, {-1});
+    return;
+  }
+  if (window_length <= 0) {
+    row_dims = ctx.InputShape(0);
+    output_dims = row_dims;
+    output_dims.push_back(padding_length > 0 ? padding_length : -1);
   }
+  ctx.SetOutput(0, type, output_dims);
+  ctx.SetOptionalOutput(1, type, output_dims);
+  ctx.SetOptionalOutput(2, type, row_dims);
+  ctx.SetOptionalOutput(3, type, row_dims);
+  ctx.SetOptionalOutput(4, type, output_dims);
 }
+
+template struct KernelBpeTokenizer<int64_t>;
+template struct KernelBpeTokenizer<int32_t>;
@@ -3,16 +3,62 @@
 
 #pragma once
 #include "bpe_tokenizer.hpp"
+#include "token_windows.hpp"
+#include "padded_length.hpp"
+#include "token_pair.hpp"
+#include "output_dtype.hpp"
 
+// The outputs are of T, int64_t or int32_t by the output_dtype attribute.
+template <typename T>
 struct KernelBpeTokenizer : BaseKernel {
   KernelBpeTokenizer(const OrtApi& api, const OrtKernelInfo& info);
-  void Compute(const ortc::Tensor<std::string>& input,
-               ortc::Tensor<int64_t>& tokenize_output,
-               std::optional<ortc::Tensor<int64_t>*> attention_mask) const;
+  static constexpr bool kShareableAcrossSessions = true;  // with ORTX_SHARE_KERNELS=1
+  // The optional text_pair, of the shape of the input, has the second texts of the pairs.
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               std::optional<const ortc::Tensor<std::string_view>*> text_pair,
+               ortc::Tensor<T>& tokenize_output,
+               std::optional<ortc::Tensor<T>*> attention_mask,
+               std::optional<ortc::Tensor<T>*> overflow_to_sample_mapping,
+               std::optional<ortc::Tensor<T>*> length_order,
+               std::optional<ortc::Tensor<T>*> token_type_ids) const;
+
+  static void InferOutputShape(const ortc::ShapeInferContext& ctx);
+
+  uint64_t CacheHits() const { return bpe_cache_.Hits(); }
+  uint64_t CacheMisses() const { return bpe_cache_.Misses(); }
 
  private:
-  std::vector<int64_t> Tokenize(const ustring& input, int64_t max_length) const;
+  // The input is a UTF-32 ustring, or the UTF-8 bytes if they are well-formed, which skips the transcoding.
+  template <typename CharT>
+  std::vector<int64_t> Tokenize(std::basic_string_view<CharT> input, int64_t max_length) const;
+  std::vector<int64_t> TokenizeText(std::string_view text, int64_t max_length) const;
+  // Calls set_row(i, ids) with the ids of each row, or of each pair with its second one from second_begin[i].
+  template <typename SetRow>
+  void TokenizeRows(const std::vector<std::string_view>& str_input, const std::vector<std::string_view>* pair_input,
+                    std::vector<size_t>& second_begin, SetRow&& set_row) const;
+  // Writes the ids of all the rows without the padding, and the row_splits in the place of the attention_mask.
+  void ComputeRagged(const std::vector<std::string_view>& str_input, const std::vector<std::string_view>* pair_input,
+                     ortc::Tensor<T>& tokenize_output,
+                     std::optional<ortc::Tensor<T>*> row_splits,
+                     std::optional<ortc::Tensor<T>*> length_order,
+                     std::optional<ortc::Tensor<T>*> token_type_ids) const;
+  // Writes the [num_windows, window_length] windows of the ids of all the rows.
+  void ComputeWindows(const std::vector<std::string_view>& str_input,
+                      ortc::Tensor<T>& tokenize_output,
+                      std::optional<ortc::Tensor<T>*> attention_mask,
+                      std::optional<ortc::Tensor<T>*> overflow_to_sample_mapping,
+                      std::optional<ortc::Tensor<T>*> length_order) const;
 
   int64_t padding_length_;
-  std::shared_ptr<VocabData> bbpe_tokenizer_;
+  PaddedLength padded_length_;  // of the rows padded to the longest one
+  TokenWindows windows_;  // no windows for a length of 0
+  bool ragged_;  // the ids of the rows without the padding, and their row_splits
+  size_t num_threads_;
+  bool dedup_;  // of the rows of the same text, which are tokenized once
+  PairTemplate pair_template_;  // GPT-2 has no special tokens around the texts of a pair
+  std::unique_ptr<PreTokenizerDfa> pattern_;  // null for the GPT-2 pre-tokenizer
+  BpeLimits limits_;  // of the merges of a row
+  BackgroundLoad<VocabData> bbpe_tokenizer_;
+  mutable BpeCache bpe_cache_;
+  mutable BpePrefixCache prefix_cache_;  // of the segments of the long texts, disabled by default
 };
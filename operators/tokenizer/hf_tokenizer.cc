@@ -0,0 +1,775 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "hf_tokenizer.hpp"
+#include "unique_rows.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+
+using json = nlohmann::json;
+
+size_t Utf8CharLength(char lead) {
+  auto byte = static_cast<unsigned char>(lead);
+  return byte < 0xC0 ? 1 : byte < 0xE0 ? 2 : byte < 0xF0 ? 3 : byte < 0xF8 ? 4 : 1;
+}
+
+[[noreturn]] void ThrowUnsupported(std::string_view component, const json& node) {
+  const json& type_node = node.is_object() && node.contains("type") ? node["type"] : node;
+  const std::string type = type_node.is_string() ? type_node.get<std::string>() : type_node.dump();
+  ORTX_CXX_API_THROW(MakeString("[HfTokenizer]: the ", component, " ", type, " isn't supported."),
+                     ORT_INVALID_ARGUMENT);
+}
+
+std::string StringOf(const json& node, const char* key, std::string_view default_value = {}) {
+  auto it = node.find(key);
+  return it != node.end() && it->is_string() ? it->get<std::string>() : std::string(default_value);
+}
+
+bool BoolOf(const json& node, const char* key, bool default_value) {
+  auto it = node.find(key);
+  return it != node.end() && it->is_boolean() ? it->get<bool>() : default_value;
+}
+
+// The regex of a String pattern of HF, which is matched literally.
+std::string EscapeRegex(std::string_view text) {
+  std::string regex;
+  for (char ch : text) {
+    if (std::string_view("\\^$.|?*+()[]{}-/").find(ch) != std::string_view::npos) {
+      regex.push_back('\\');
+    }
+    regex.push_back(ch);
+  }
+  return regex;
+}
+
+// The pattern of a Split or a Replace, {"String": ...} or {"Regex": ...}.
+std::shared_ptr<PreTokenizerDfa> CompilePattern(const json& pattern) {
+  if (pattern.contains("String")) {
+    return std::make_shared<PreTokenizerDfa>(EscapeRegex(pattern["String"].get<std::string>()));
+  }
+  if (pattern.contains("Regex")) {
+    return std::make_shared<PreTokenizerDfa>(pattern["Regex"].get<std::string>());
+  }
+  ThrowUnsupported("pattern", pattern);
+}
+
+// Calls fn(begin, end) for each of the leftmost-first matches of the pattern in the text which aren't empty.
+template <typename Fn>
+void ForEachMatch(const PreTokenizerDfa& pattern, std::string_view text, Fn&& fn) {
+  for (size_t pos = 0; pos < text.size();) {
+    const size_t end = pattern.MatchEnd(text, pos, pos == 0);
+    if (end > pos) {
+      fn(pos, end);
+      pos = end;
+    } else {
+      pos += Utf8CharLength(text[pos]);
+    }
+  }
+}
+
+// The text without the whitespace, char::is_whitespace of Rust, at its start or its end.
+std::string_view TrimStart(std::string_view text) {
+  size_t pos = 0;
+  size_t len = 0;
+  while (pos < text.size() && IsRegexSpace(ustring::DecodeUTF8Char(text, pos, len))) {
+    pos += len;
+  }
+  return text.substr(pos);
+}
+
+std::string_view TrimEnd(std::string_view text) {
+  size_t end = 0;
+  size_t len = 0;
+  for (size_t pos = 0; pos < text.size(); pos += len) {
+    if (!IsRegexSpace(ustring::DecodeUTF8Char(text, pos, len))) {
+      end = pos + len;
+    }
+  }
+  return text.substr(0, end);
+}
+
+bool StartsWith(std::string_view text, std::string_view prefix) { return text.substr(0, prefix.size()) == prefix; }
+
+// the longest BPE word whose merges are cached
+constexpr size_t kMaxCachedWordLength = 256;
+
+}  // namespace
+
+void HfTokenizerPipeline::Load(std::string_view payload, bool skip_unicode_normalization) {
+  json root = json::parse(payload, nullptr, false);
+  if (!root.is_object() || !root.contains("model")) {
+    ORTX_CXX_API_THROW("[HfTokenizer]: tokenizer_json should be the JSON of a tokenizer.json of HF.",
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  // the longest added token takes effect first, as the leftmost-longest match of HF
+  if (root.contains("added_tokens") && root["added_tokens"].is_array()) {
+    std::vector<std::pair<std::string, int>> tokens;
+    for (const auto& token : root["added_tokens"]) {
+      const int id = token.at("id").get<int>();
+      tokens.emplace_back(token.at("content").get<std::string>(), id);
+      added_token_flags_[id] = AddedToken{BoolOf(token, "lstrip", false), BoolOf(token, "rstrip", false)};
+    }
+    std::stable_sort(tokens.begin(), tokens.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first.size() > rhs.first.size(); });
+    for (auto& [content, id] : tokens) {
+      added_tokens_.Add(ustring(content), id);
+    }
+  }
+  added_tokens_.Build();
+
+  LoadNormalizer(root.value("normalizer", json()), skip_unicode_normalization);
+  LoadPreTokenizer(root.value("pre_tokenizer", json()));
+  LoadModel(root["model"], payload);
+  LoadPostProcessor(root.value("post_processor", json()));
+}
+
+void HfTokenizerPipeline::LoadNormalizer(const json& node, bool skip_unicode_normalization) {
+  if (node.is_null()) {
+    return;
+  }
+  const std::string type = StringOf(node, "type");
+  if (type == "Sequence") {
+    for (const auto& child : node.at("normalizers")) {
+      LoadNormalizer(child, skip_unicode_normalization);
+    }
+  } else if (type == "Lowercase") {
+    normalizers_.push_back(Normalizer{Normalizer::kLowercase});
+  } else if (type == "Replace") {
+    // a String pattern, like the spaces to U+2581 of Llama, is replaced by a search instead of a DFA
+    Normalizer normalizer{Normalizer::kReplace};
+    const auto& pattern = node.at("pattern");
+    if (pattern.contains("String")) {
+      normalizer.literal = pattern["String"].get<std::string>();
+    }
+    if (normalizer.literal.empty()) {
+      normalizer.pattern = CompilePattern(pattern);
+    }
+    normalizer.content = StringOf(node, "content");
+    normalizers_.push_back(std::move(normalizer));
+  } else if (type == "Prepend") {
+    Normalizer normalizer{Normalizer::kPrepend};
+    normalizer.content = StringOf(node, "prepend");
+    normalizers_.push_back(std::move(normalizer));
+  } else if (type == "Strip") {
+    Normalizer normalizer{Normalizer::kStrip};
+    normalizer.left = BoolOf(node, "strip_left", true);
+    normalizer.right = BoolOf(node, "strip_right", true);
+    normalizers_.push_back(std::move(normalizer));
+  } else if (Normalizer normalizer{Normalizer::kUnicode}; ParseNormalizationForm(type, normalizer.form)) {
+    // it's the identity of the texts it's already applied to
+    if (!skip_unicode_normalization) {
+      normalizers_.push_back(std::move(normalizer));
+    }
+  } else if (type == "Precompiled") {
+    // the charsmap of SentencePiece has no interpreter here
+    if (!skip_unicode_normalization) {
+      ORTX_CXX_API_THROW("[HfTokenizer]: the normalizer Precompiled isn't supported, unless "
+                         "skip_unicode_normalization is 1 for the texts which are already normalized.",
+                         ORT_INVALID_ARGUMENT);
+    }
+  } else {
+    ThrowUnsupported("normalizer", node);
+  }
+}
+
+void HfTokenizerPipeline::LoadPreTokenizer(const json& node) {
+  if (node.is_null()) {
+    return;
+  }
+  auto split = [this](std::string_view regex, PreTokenizer::Behavior behavior, bool invert) {
+    PreTokenizer pre_tokenizer{PreTokenizer::kSplit};
+    pre_tokenizer.pattern = std::make_shared<PreTokenizerDfa>(regex);
+    pre_tokenizer.behavior = behavior;
+    pre_tokenizer.invert = invert;
+    pre_tokenizers_.push_back(std::move(pre_tokenizer));
+  };
+  auto behavior_of = [&node](std::string_view default_value) {
+    const std::string behavior = StringOf(node, "behavior", default_value);
+    if (behavior == "Removed") return PreTokenizer::kRemoved;
+    if (behavior == "Isolated") return PreTokenizer::kIsolated;
+    if (behavior == "MergedWithPrevious") return PreTokenizer::kMergedWithPrevious;
+    if (behavior == "MergedWithNext") return PreTokenizer::kMergedWithNext;
+    if (behavior == "Contiguous") return PreTokenizer::kContiguous;
+    ThrowUnsupported("behavior", node.value("behavior", json()));
+  };
+  // char::is_ascii_punctuation or a Unicode punctuation, the punctuation of the BERT pre-tokenizers
+  constexpr std::string_view kPunctuation = "[\\p{P}\\x21-\\x2F\\x3A-\\x40\\x5B-\\x60\\x7B-\\x7E]";
+
+  const std::string type = StringOf(node, "type");
+  if (type == "Sequence") {
+    for (const auto& child : node.at("pretokenizers")) {
+      LoadPreTokenizer(child);
+    }
+  } else if (type == "ByteLevel") {
+    PreTokenizer pre_tokenizer{PreTokenizer::kByteLevel};
+    pre_tokenizer.add_prefix_space = BoolOf(node, "add_prefix_space", true);
+    pre_tokenizer.use_regex = BoolOf(node, "use_regex", true);
+    pre_tokenizers_.push_back(std::move(pre_tokenizer));
+    byte_level_ = true;
+  } else if (type == "Split") {
+    PreTokenizer pre_tokenizer{PreTokenizer::kSplit};
+    pre_tokenizer.pattern = CompilePattern(node.at("pattern"));
+    pre_tokenizer.behavior = behavior_of("");
+    pre_tokenizer.invert = BoolOf(node, "invert", false);
+    pre_tokenizers_.push_back(std::move(pre_tokenizer));
+  } else if (type == "Metaspace") {
+    PreTokenizer pre_tokenizer{PreTokenizer::kMetaspace};
+    pre_tokenizer.replacement = StringOf(node, "replacement", "\xE2\x96\x81");
+    const std::string scheme =
+        StringOf(node, "prepend_scheme", BoolOf(node, "add_prefix_space", true) ? "always" : "never");
+    pre_tokenizer.prepend_scheme = scheme == "first"   ? PreTokenizer::kFirst
+                                   : scheme == "never" ? PreTokenizer::kNever
+                                                       : PreTokenizer::kAlways;
+    pre_tokenizer.split = BoolOf(node, "split", true);
+    pre_tokenizers_.push_back(std::move(pre_tokenizer));
+  } else if (type == "Whitespace") {
+    split("\\w+|[^\\w\\s]+", PreTokenizer::kRemoved, true);
+  } else if (type == "WhitespaceSplit") {
+    split("\\s+", PreTokenizer::kRemoved, false);
+  } else if (type == "Digits") {
+    split(BoolOf(node, "individual_digits", false) ? "\\p{N}" : "\\p{N}+", PreTokenizer::kIsolated, false);
+  } else if (type == "Punctuation") {
+    split(kPunctuation, behavior_of("Isolated"), false);
+  } else if (type == "BertPreTokenizer") {
+    split("\\s+", PreTokenizer::kRemoved, false);
+    split(kPunctuation, PreTokenizer::kIsolated, false);
+  } else {
+    ThrowUnsupported("pre-tokenizer", node);
+  }
+}
+
+void HfTokenizerPipeline::LoadModel(const json& node, std::string_view payload) {
+  model_type_ = StringOf(node, "type");
+  if (model_type_.empty() && node.contains("merges")) {
+    model_type_ = "BPE";  // the type is optional in the older files
+  }
+
+  if (model_type_ == "BPE") {
+    if ((node.contains("dropout") && !node["dropout"].is_null() && node["dropout"].get<double>() > 0) ||
+        !StringOf(node, "continuing_subword_prefix").empty() || !StringOf(node, "end_of_word_suffix").empty()) {
+      ORTX_CXX_API_THROW(
+          "[HfTokenizer]: the dropout, continuing_subword_prefix and end_of_word_suffix of BPE aren't supported.",
+          ORT_INVALID_ARGUMENT);
+    }
+
+    // the merges are "a b", or ["a", "b"] in the newer files, and the first line is skipped if it starts with #
+    std::string merges = "#version: 0.2\n";
+    for (const auto& merge : node.at("merges")) {
+      if (merge.is_string()) {
+        merges.append(merge.get<std::string>());
+      } else {
+        const std::string first = merge.at(0).get<std::string>();
+        const std::string second = merge.at(1).get<std::string>();
+        if (first.find(' ') != std::string::npos || second.find(' ') != std::string::npos) {
+          ORTX_CXX_API_THROW("[HfTokenizer]: a merge of a token with a space isn't supported.",
+                             ORT_INVALID_ARGUMENT);
+        }
+        merges.append(first).append(" ").append(second);
+      }
+      merges.push_back('\n');
+    }
+
+    const std::string unk_token = StringOf(node, "unk_token");
+    bpe_ = std::make_unique<VocabData>();
+    ignore_merges_ = BoolOf(node, "ignore_merges", false);
+    if (byte_level_) {
+      // the unk token is never a byte-level word, which keeps any byte-level word a normal one
+      bpe_->Load(node.at("vocab").dump(), merges, unk_token.c_str(), "");
+      return;
+    }
+
+    // the BPE of the characters, like the one of Llama, whose unknown characters are <0x..> of their bytes with
+    // byte_fallback, or else the unk token
+    bpe_->LoadCharLevel(node.at("vocab").dump(), merges, unk_token.c_str());
+    unk_id_ = unk_token.empty() ? -1 : bpe_->FindToken(unk_token);
+    fuse_unk_ = BoolOf(node, "fuse_unk", false);
+    byte_fallback_ = BoolOf(node, "byte_fallback", false);
+    for (int byte = 0; byte < 256 && byte_fallback_; ++byte) {
+      char piece[8];
+      std::snprintf(piece, sizeof(piece), "<0x%02X>", byte);
+      byte_ids_[byte] = bpe_->FindToken(piece);
+      if (byte_ids_[byte] < 0) {
+        ORTX_CXX_API_THROW(MakeString("[HfTokenizer]: the vocab of byte_fallback has no ", piece),
+                           ORT_INVALID_ARGUMENT);
+      }
+    }
+  } else if (model_type_ == "WordLevel") {
+    for (auto it = node.at("vocab").begin(); it != node.at("vocab").end(); ++it) {
+      word_level_.Add(it.key(), it.value().get<int32_t>());
+    }
+    const std::string unk_token = StringOf(node, "unk_token");
+    unk_id_ = unk_token.empty() ? -1 : word_level_.Find(unk_token);
+  } else if (model_type_ == "Unigram") {
+#ifdef ENABLE_UNIGRAM_TOKENIZER
+    unigram_ = std::make_unique<UnigramModel>();
+    unigram_->Load(payload);
+#else
+    ORTX_CXX_API_THROW("[HfTokenizer]: the Unigram model needs the UnigramTokenizer to be built.",
+                       ORT_INVALID_ARGUMENT);
+#endif
+  } else if (model_type_ == "WordPiece") {
+    ORTX_CXX_API_THROW("[HfTokenizer]: the WordPiece model is the one of BertTokenizer or HfBertTokenizer.",
+                       ORT_INVALID_ARGUMENT);
+  } else {
+    ThrowUnsupported("model", node);
+  }
+}
+
+void HfTokenizerPipeline::LoadPostProcessor(const json& node) {
+  if (node.is_null()) {
+    return;
+  }
+  const std::string type = StringOf(node, "type");
+  if (type == "Sequence") {
+    for (const auto& child : node.at("processors")) {
+      LoadPostProcessor(child);
+    }
+  } else if (type == "ByteLevel") {
+    // it only trims the offsets
+  } else if (type == "RobertaProcessing" || type == "BertProcessing") {
+    prefix_.insert(prefix_.begin(), node.at("cls").at(1).get<int64_t>());
+    suffix_.push_back(node.at("sep").at(1).get<int64_t>());
+  } else if (type == "TemplateProcessing") {
+    // the template of a single sequence, the pair one isn't used by a kernel of one input
+    std::vector<int64_t> prefix;
+    std::vector<int64_t> suffix;
+    bool in_suffix = false;
+    for (const auto& piece : node.at("single")) {
+      if (piece.contains("Sequence")) {
+        in_suffix = true;
+        continue;
+      }
+      const std::string id = piece.at("SpecialToken").at("id").get<std::string>();
+      const auto& special = node.at("special_tokens");
+      if (!special.contains(id)) {
+        ORTX_CXX_API_THROW(MakeString("[HfTokenizer]: the special token ", id, " of the template has no ids."),
+                           ORT_INVALID_ARGUMENT);
+      }
+      for (const auto& special_id : special[id].at("ids")) {
+        (in_suffix ? suffix : prefix).push_back(special_id.get<int64_t>());
+      }
+    }
+    prefix_.insert(prefix_.begin(), prefix.begin(), prefix.end());
+    suffix_.insert(suffix_.end(), suffix.begin(), suffix.end());
+  } else {
+    ThrowUnsupported("post-processor", node);
+  }
+}
+
+std::string HfTokenizerPipeline::Normalize(std::string_view text) const {
+  std::string normalized(text);
+  for (const auto& normalizer : normalizers_) {
+    switch (normalizer.kind) {
+      case Normalizer::kLowercase: {
+        ustring chars(normalized);
+        for (auto& ch : chars) {
+          ch = ufal::unilib::unicode::lowercase(ch);
+        }
+        normalized = std::string(chars);
+        break;
+      }
+      case Normalizer::kReplace: {
+        std::string replaced;
+        size_t last = 0;
+        auto replace = [&](size_t begin, size_t end) {
+          replaced.append(normalized, last, begin - last).append(normalizer.content);
+          last = end;
+        };
+        if (normalizer.pattern) {
+          ForEachMatch(*normalizer.pattern, normalized, replace);
+        } else {
+          for (size_t pos = normalized.find(normalizer.literal); pos != std::string::npos;
+               pos = normalized.find(normalizer.literal, pos + normalizer.literal.size())) {
+            replace(pos, pos + normalizer.literal.size());
+          }
+        }
+        normalized = replaced.append(normalized, last, std::string::npos);
+        break;
+      }
+      case Normalizer::kPrepend:
+        if (!normalized.empty()) {
+          normalized.insert(0, normalizer.content);
+        }
+        break;
+      case Normalizer::kStrip: {
+        std::string_view view(normalized);
+        view = normalizer.left ? TrimStart(view) : view;
+        view = normalizer.right ? TrimEnd(view) : view;
+        normalized = std::string(view);
+        break;
+      }
+      case Normalizer::kUnicode:
+        // the most of the texts are already in the form, and aren't copied
+        if (NormalizedPrefixLength(normalized, normalizer.form) != normalized.size()) {
+          normalized = NormalizeUtf8(normalized, normalizer.form);
+        }
+        break;
+    }
+  }
+  return normalized;
+}
+
+void HfTokenizerPipeline::PreTokenize(std::vector<std::string>& pieces, bool first_segment) const {
+  std::vector<std::string> next;
+  for (const auto& pre_tokenizer : pre_tokenizers_) {
+    next.clear();
+    for (size_t p = 0; p < pieces.size(); ++p) {
+      std::string& piece = pieces[p];
+      switch (pre_tokenizer.kind) {
+        case PreTokenizer::kByteLevel: {
+          // the bytes are mapped to the characters of the vocab by the model
+          if (pre_tokenizer.add_prefix_space && !StartsWith(piece, " ")) {
+            piece.insert(0, " ");
+          }
+          if (!pre_tokenizer.use_regex) {
+            next.push_back(std::move(piece));
+            break;
+          }
+          Utf8TokenWithRegularExp regcmp;
+          regcmp.Set(piece);
+          for (auto token = regcmp.GetNextToken(); token.first; token = regcmp.GetNextToken()) {
+            next.emplace_back(token.second);
+          }
+          break;
+        }
+
+        case PreTokenizer::kMetaspace: {
+          const std::string& meta = pre_tokenizer.replacement;
+          std::string replaced;
+          const bool prepend = pre_tokenizer.prepend_scheme == PreTokenizer::kAlways ||
+                               (pre_tokenizer.prepend_scheme == PreTokenizer::kFirst && first_segment && p == 0);
+          if (prepend && !StartsWith(piece, meta)) {
+            replaced.append(meta);
+          }
+          for (char ch : piece) {
+            if (ch == ' ') {
+              replaced.append(meta);
+            } else {
+              replaced.push_back(ch);
+            }
+          }
+          // each replacement starts a piece, as the MergedWithNext split of HF
+          for (size_t begin = 0; begin < replaced.size();) {
+            const size_t end = pre_tokenizer.split && !meta.empty()
+                                   ? std::min(replaced.find(meta, begin + 1), replaced.size())
+                                   : replaced.size();
+            next.push_back(replaced.substr(begin, end - begin));
+            begin = end;
+          }
+          break;
+        }
+
+        case PreTokenizer::kSplit: {
+          std::vector<std::tuple<size_t, size_t, bool>> splits;  // (begin, end, whether it's a match)
+          size_t last = 0;
+          ForEachMatch(*pre_tokenizer.pattern, piece, [&](size_t begin, size_t end) {
+            if (begin > last) {
+              splits.emplace_back(last, begin, pre_tokenizer.invert);
+            }
+            splits.emplace_back(begin, end, !pre_tokenizer.invert);
+            last = end;
+          });
+          if (last < piece.size()) {
+            splits.emplace_back(last, piece.size(), pre_tokenizer.invert);
+          }
+
+          // the behaviors of SplitDelimiterBehavior of HF, which fold the matches into the splits
+          std::vector<std::pair<size_t, size_t>> kept;
+          bool previous_match = false;
+          switch (pre_tokenizer.behavior) {
+            case PreTokenizer::kRemoved:
+              for (const auto& [begin, end, is_match] : splits) {
+                if (!is_match) {
+                  kept.emplace_back(begin, end);
+                }
+              }
+              break;
+            case PreTokenizer::kIsolated:
+              for (const auto& [begin, end, is_match] : splits) {
+                kept.emplace_back(begin, end);
+              }
+              break;
+            case PreTokenizer::kMergedWithPrevious:
+              for (const auto& [begin, end, is_match] : splits) {
+                if (is_match && !previous_match && !kept.empty()) {
+                  kept.back().second = end;
+                } else {
+                  kept.emplace_back(begin, end);
+                }
+                previous_match = is_match;
+              }
+              break;
+            case PreTokenizer::kMergedWithNext:
+              for (auto it = splits.rbegin(); it != splits.rend(); ++it) {
+                const auto& [begin, end, is_match] = *it;
+                if (is_match && !previous_match && !kept.empty()) {
+                  kept.back().first = begin;
+                } else {
+                  kept.emplace_back(begin, end);
+                }
+                previous_match = is_match;
+              }
+              std::reverse(kept.begin(), kept.end());
+              break;
+            case PreTokenizer::kContiguous:
+              for (const auto& [begin, end, is_match] : splits) {
+                if (is_match == previous_match && !kept.empty()) {
+                  kept.back().second = end;
+                } else {
+                  kept.emplace_back(begin, end);
+                }
+                previous_match = is_match;
+              }
+              break;
+          }
+          for (const auto& [begin, end] : kept) {
+            next.push_back(piece.substr(begin, end - begin));
+          }
+          break;
+        }
+      }
+    }
+    pieces.swap(next);
+  }
+}
+
+void HfTokenizerPipeline::InitialSymbols(std::string_view word, std::vector<std::pair<int, int>>& symbols) const {
+  symbols.clear();
+  if (byte_level_) {
+    bpe_->AppendByteSymbols(word, symbols);
+    return;
+  }
+
+  for (size_t pos = 0; pos < word.size();) {
+    const size_t len = std::min(Utf8CharLength(word[pos]), word.size() - pos);
+    const int id = bpe_->FindToken(word.substr(pos, len));
+    if (id >= 0) {
+      symbols.emplace_back(id, static_cast<int>(len));
+    } else if (byte_fallback_) {
+      for (size_t i = pos; i < pos + len; ++i) {
+        symbols.emplace_back(byte_ids_[static_cast<unsigned char>(word[i])], 1);
+      }
+    } else if (unk_id_ >= 0) {
+      if (fuse_unk_ && !symbols.empty() && symbols.back().first == unk_id_) {
+        symbols.back().second += static_cast<int>(len);
+      } else {
+        symbols.emplace_back(unk_id_, static_cast<int>(len));
+      }
+    }
+    pos += len;
+  }
+}
+
+void HfTokenizerPipeline::EncodePiece(const std::string& piece, std::vector<int64_t>& ids, BpeCache& cache) const {
+  if (bpe_) {
+    std::vector<std::pair<int, int>> byte_list;
+    if (!cache.Lookup(piece, byte_list)) {
+      ORTX_TRACE_SCOPE("HfTokenizer.bpe");
+      // the whole word is one token if it's in the vocab with ignore_merges, as the one of Llama-3
+      int word_id = -1;
+      if (ignore_merges_) {
+        if (byte_level_) {
+          std::string word;
+          for (char byte : piece) {
+            word.append(bpe_->IdToToken(bpe_->ByteEncoder()[static_cast<unsigned char>(byte)]));
+          }
+          word_id = bpe_->FindToken(word);
+        } else {
+          word_id = bpe_->FindToken(piece);
+        }
+      }
+      if (word_id >= 0) {
+        byte_list.assign(1, std::make_pair(word_id, static_cast<int>(piece.size())));
+      } else {
+        InitialSymbols(piece, byte_list);
+        bpe_->bpe(byte_list);
+      }
+      // a text without a pre-tokenizer, like the one of Llama, is one word, which is unlikely to recur
+      if (piece.size() <= kMaxCachedWordLength) {
+        cache.Insert(piece, byte_list);
+      }
+    }
+    for (const auto& [id, length] : byte_list) {
+      ids.push_back(id);
+    }
+    return;
+  }
+
+#ifdef ENABLE_UNIGRAM_TOKENIZER
+  if (unigram_) {
+    unigram_->Encode(piece, ids);
+    return;
+  }
+#endif
+
+  const int id = word_level_.Find(piece);
+  if (id == TokenVocab::kInvalidId && unk_id_ < 0) {
+    ORTX_CXX_API_THROW(MakeString("[HfTokenizer]: the word ", piece, " isn't in the vocab, which has no unk_token."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  ids.push_back(id != TokenVocab::kInvalidId ? id : unk_id_);
+}
+
+void HfTokenizerPipeline::EncodeSegments(std::vector<Segment>& segments, size_t max_ids, std::vector<int64_t>& ids,
+                                         BpeCache& cache) const {
+  // the temporaries of the BPE words of the row are from the scratch arena of this thread
+  ScratchScope scratch;
+  for (size_t i = 0; i < segments.size(); ++i) {
+    if (segments[i].second == -1) {
+      continue;
+    }
+    auto flags = added_token_flags_.find(segments[i].second);
+    if (flags == added_token_flags_.end()) {
+      continue;
+    }
+    // lstrip and rstrip take the whitespace before and after the added token into it
+    if (flags->second.lstrip && i > 0 && segments[i - 1].second == -1) {
+      segments[i - 1].first = TrimEnd(segments[i - 1].first);
+    }
+    if (flags->second.rstrip && i + 1 < segments.size() && segments[i + 1].second == -1) {
+      segments[i + 1].first = TrimStart(segments[i + 1].first);
+    }
+  }
+
+  const size_t initial_size = ids.size();
+  max_ids = max_ids == SIZE_MAX ? SIZE_MAX : initial_size + max_ids;
+  std::vector<std::string> pieces;
+  for (size_t i = 0; i < segments.size() && ids.size() < max_ids; ++i) {
+    const auto& [segment, special_id] = segments[i];
+    if (special_id != -1) {
+      ids.push_back(special_id);
+      continue;
+    }
+    if (segment.empty()) {
+      continue;
+    }
+
+    pieces.clear();
+    pieces.push_back(Normalize(segment));
+    PreTokenize(pieces, i == 0);
+    for (const auto& piece : pieces) {
+      if (ids.size() >= max_ids) {
+        break;
+      }
+      if (!piece.empty()) {
+        EncodePiece(piece, ids, cache);
+      }
+    }
+  }
+  if (ids.size() > max_ids) {
+    ids.resize(max_ids);
+  }
+}
+
+std::vector<int64_t> HfTokenizerPipeline::Encode(std::string_view text, int64_t max_length, BpeCache& cache) const {
+  auto segments = added_tokens_.SplitBySpecialTokens(text);
+
+  // the text is only encoded until its ids reach the truncation, which keeps the special tokens
+  const size_t special_count = prefix_.size() + suffix_.size();
+  const size_t max_ids =
+      max_length < 0 || max_length == INT64_MAX
+          ? SIZE_MAX
+          : static_cast<size_t>(std::max<int64_t>(max_length - static_cast<int64_t>(special_count), 0));
+  std::vector<int64_t> ids;
+  EncodeSegments(segments, max_ids, ids, cache);
+
+  std::vector<int64_t> res;
+  res.reserve(special_count + ids.size());
+  res.insert(res.end(), prefix_.begin(), prefix_.end());
+  res.insert(res.end(), ids.begin(), ids.end());
+  res.insert(res.end(), suffix_.begin(), suffix_.end());
+  if (max_ids != SIZE_MAX && res.size() > static_cast<size_t>(max_length)) {
+    res.resize(static_cast<size_t>(max_length));  // a max_length shorter than the special tokens themselves
+  }
+  return res;
+}
+
+KernelHfTokenizer::KernelHfTokenizer(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  ort_extensions::AssetBytes tokenizer_json = ort_extensions::GetAssetAttribute(*this, "tokenizer_json");
+  if (tokenizer_json.empty()) {
+    ORTX_CXX_API_THROW("tokenizer_json shouldn't be empty.", ORT_INVALID_ARGUMENT);
+  }
+
+  padding_length_ = TryToGetAttributeWithDefault<int64_t>("padding_length", -1);
+  if (padding_length_ != -1 && padding_length_ <= 0) {
+    ORTX_CXX_API_THROW("padding_length should be more than 0 or equal -1", ORT_INVALID_ARGUMENT);
+  }
+
+  num_threads_ = ReadNumThreadsAttribute(*this);
+  dedup_ = TryToGetAttributeWithDefault<int64_t>("dedup", 0) != 0;
+
+  int64_t cache_capacity = TryToGetAttributeWithDefault<int64_t>("cache_capacity", kDefaultBpeCacheCapacity);
+  if (cache_capacity < 0) {
+    ORTX_CXX_API_THROW("cache_capacity shouldn't be negative", ORT_INVALID_ARGUMENT);
+  }
+  bpe_cache_.SetCapacity(static_cast<size_t>(cache_capacity));
+  bpe_cache_.SetStatsName("hf_tokenizer_cache");
+
+  const bool skip_unicode_normalization =
+      TryToGetAttributeWithDefault<int64_t>("skip_unicode_normalization", 0) != 0;
+
+  // the pipeline of a payload is compiled once, and shared by all the kernels of the same payload
+  pipeline_.Start([tokenizer_json = std::move(tokenizer_json), skip_unicode_normalization]() {
+    std::string_view skip = skip_unicode_normalization ? "1" : "0";
+    return SharedRegistry<HfTokenizerPipeline>::Instance().GetOrLoad({tokenizer_json, skip}, [&]() {
+      auto pipeline = std::make_shared<HfTokenizerPipeline>();
+      pipeline->Load(tokenizer_json, skip_unicode_normalization);
+      return pipeline;
+    });
+  });
+}
+
+std::vector<int64_t> KernelHfTokenizer::TokenizeText(std::string_view text, int64_t max_length) const {
+  ORTX_TRACE_SCOPE("HfTokenizer.Tokenize");
+  if (ustring::ValidateUTF8(text)) {
+    return pipeline_->Encode(text, max_length, bpe_cache_);
+  }
+  // the ill-formed sequences are the replacement characters, as a Python str would have them
+  std::string utf8 = std::string(ustring(text));
+  return pipeline_->Encode(utf8, max_length, bpe_cache_);
+}
+
+void KernelHfTokenizer::InferOutputShape(const ortc::ShapeInferContext& ctx) {
+  // the rows of the input are padded to padding_length, or else to the longest one, which is unknown until then
+  const int64_t padding_length = ctx.GetAttributeInt("padding_length", -1);
+  std::vector<int64_t> output_dims = ctx.InputShape(0);
+  output_dims.push_back(padding_length > 0 ? padding_length : -1);
+  ctx.SetOutput(0, ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64, output_dims);
+  ctx.SetOptionalOutput(1, ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64, output_dims);
+}
+
+void KernelHfTokenizer::Compute(const ortc::Tensor<std::string_view>& input,
+                                ortc::Tensor<int64_t>& tokenize_output,
+                                std::optional<ortc::Tensor<int64_t>*> attention_mask) const {
+  auto& str_input = input.Data();
+  const auto& input_dim = input.Shape();
+
+  ortc::PaddedOutput<int64_t> tokens(tokenize_output, input_dim, padding_length_);
+  const int64_t row_max_length = padding_length_ < 0 ? INT64_MAX : padding_length_;
+  ort_extensions::ComputeRows(
+      str_input, dedup_, num_threads_,
+      [&](std::string_view text) { return TokenizeText(text, row_max_length); },
+      [&](size_t i, std::vector<int64_t>&& ids) { tokens.SetRow(i, std::move(ids)); });
+
+  tokens.Allocate();
+  const size_t max_length = tokens.RowLength();
+  int64_t* mask = nullptr;
+  if (attention_mask.has_value()) {
+    std::vector<int64_t> output_dim = input_dim;
+    output_dim.push_back(max_length);
+    mask = (*attention_mask)->Allocate(output_dim);
+  }
+  ParallelFor(tokens.RowCount(), num_threads_, [&](size_t begin, size_t end) {
+    ORTX_TRACE_SCOPE("HfTokenizer.Pad");
+    tokens.WriteRows(begin, end);
+    for (size_t i = begin; i < end && mask != nullptr; ++i) {
+      int64_t* mask_row = mask + i * max_length;
+      std::fill(mask_row, mask_row + tokens.Length(i), 1);
+      std::fill(mask_row + tokens.Length(i), mask_row + max_length, 0);
+    }
+  });
+}
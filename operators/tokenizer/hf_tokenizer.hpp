@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "bpe_tokenizer.hpp"
+#include "unicode_normalization.h"
+#ifdef ENABLE_UNIGRAM_TOKENIZER
+#include "unigram_tokenizer.hpp"
+#endif
+
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// A tokenizer.json of HF compiled into one pipeline when it's loaded: the added tokens are split off the text,
+// each of the other segments goes through the normalizers and the pre-tokenizers, and each piece is encoded by the
+// model, before the post-processor adds its special tokens. The regex patterns are compiled into PreTokenizerDfa,
+// and the models are the ones of the other kernels, so a model needs neither a conversion of its vocab nor a chain
+// of several ops.
+//
+// The supported components are
+//   normalizers: Lowercase, Replace, Prepend, Strip, Sequence and the Unicode forms NFC, NFD, NFKC and NFKD, and
+//     Precompiled as the identity if the Unicode normalization is skipped;
+//   pre-tokenizers: ByteLevel, Split, Metaspace, Whitespace, WhitespaceSplit, Digits, Punctuation, BertPreTokenizer
+//     and Sequence;
+//   models: BPE, of the bytes or of the characters with byte_fallback like the one of Llama, WordLevel and Unigram;
+//   post-processors: TemplateProcessing of a single sequence, RobertaProcessing, BertProcessing, ByteLevel and
+//     Sequence.
+// Any other one throws ORT_INVALID_ARGUMENT when the pipeline is loaded, instead of giving other ids than HF.
+class HfTokenizerPipeline {
+ public:
+  void Load(std::string_view json, bool skip_unicode_normalization);
+
+  // Encodes the UTF-8 text, which must be well-formed, into at most max_length ids, which keep the special tokens
+  // of the post-processor. The merges of the BPE words are looked up in, and added to, the cache.
+  std::vector<int64_t> Encode(std::string_view text, int64_t max_length, BpeCache& cache) const;
+
+  // A segment of a text, an added token of the id, or a text to encode of -1.
+  using Segment = std::pair<std::string_view, int>;
+
+  // Splits the added tokens off the text, which is how Encode starts.
+  std::vector<Segment> SplitAddedTokens(std::string_view text) const {
+    return added_tokens_.SplitBySpecialTokens(text);
+  }
+
+  // Appends the ids of the segments to ids, at most max_ids of them, without the special tokens of the
+  // post-processor. The lstrip and rstrip of the added tokens trim the text segments next to them.
+  void EncodeSegments(std::vector<Segment>& segments, size_t max_ids, std::vector<int64_t>& ids,
+                      BpeCache& cache) const;
+
+  const std::string& ModelType() const { return model_type_; }
+
+ private:
+  struct Normalizer {
+    enum Kind { kLowercase, kReplace, kPrepend, kStrip, kUnicode } kind;
+    std::shared_ptr<PreTokenizerDfa> pattern;  // of Replace, which is null for a literal
+    std::string literal;
+    std::string content;                       // the replacement of Replace, or the prefix of Prepend
+    bool left = false;                         // of Strip
+    bool right = false;
+    NormalizationForm form = NormalizationForm::kNFC;  // of the Unicode normalizers
+  };
+
+  struct PreTokenizer {
+    enum Kind { kByteLevel, kSplit, kMetaspace } kind;
+    enum Behavior { kRemoved, kIsolated, kMergedWithPrevious, kMergedWithNext, kContiguous } behavior = kIsolated;
+    std::shared_ptr<PreTokenizerDfa> pattern;  // of Split
+    bool invert = false;
+    bool use_regex = true;                     // of ByteLevel, the GPT-2 pattern
+    bool add_prefix_space = false;             // of ByteLevel
+    std::string replacement;                   // of Metaspace
+    enum PrependScheme { kAlways, kFirst, kNever } prepend_scheme = kAlways;
+    bool split = true;                         // of Metaspace
+  };
+
+  struct AddedToken {
+    bool lstrip = false;
+    bool rstrip = false;
+  };
+
+  void LoadNormalizer(const nlohmann::json& node, bool skip_unicode_normalization);
+  void LoadPreTokenizer(const nlohmann::json& node);
+  void LoadModel(const nlohmann::json& node, std::string_view json);
+  void LoadPostProcessor(const nlohmann::json& node);
+
+  std::string Normalize(std::string_view text) const;
+  void PreTokenize(std::vector<std::string>& pieces, bool first_segment) const;
+  void InitialSymbols(std::string_view word, std::vector<std::pair<int, int>>& symbols) const;
+  void EncodePiece(const std::string& piece, std::vector<int64_t>& ids, BpeCache& cache) const;
+
+  SpecialTokenMap added_tokens_;
+  std::unordered_map<int, AddedToken> added_token_flags_;
+  std::vector<Normalizer> normalizers_;
+  std::vector<PreTokenizer> pre_tokenizers_;
+  std::string model_type_;
+  bool byte_level_ = false;         // whether a pre-tokenizer is ByteLevel
+  std::unique_ptr<VocabData> bpe_;  // of BPE, of the bytes with a ByteLevel pre-tokenizer or else of the characters
+  bool ignore_merges_ = false;
+  bool byte_fallback_ = false;
+  bool fuse_unk_ = false;
+  std::array<int, 256> byte_ids_{};  // of <0x00> to <0xFF> with byte_fallback
+  TokenVocab word_level_;           // of WordLevel
+  int unk_id_ = -1;
+#ifdef ENABLE_UNIGRAM_TOKENIZER
+  std::unique_ptr<UnigramModel> unigram_;
+#endif
+  std::vector<int64_t> prefix_;     // the special tokens of the post-processor
+  std::vector<int64_t> suffix_;
+};
+
+// Tokenizes the texts by the pipeline of a tokenizer.json into input_ids, padded with 0, and the optional
+// attention_mask.
+struct KernelHfTokenizer : BaseKernel {
+  KernelHfTokenizer(const OrtApi& api, const OrtKernelInfo& info);
+  static constexpr bool kShareableAcrossSessions = true;  // with ORTX_SHARE_KERNELS=1
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               ortc::Tensor<int64_t>& tokenize_output,
+               std::optional<ortc::Tensor<int64_t>*> attention_mask) const;
+  static void InferOutputShape(const ortc::ShapeInferContext& ctx);
+
+  uint64_t CacheHits() const { return bpe_cache_.Hits(); }
+  uint64_t CacheMisses() const { return bpe_cache_.Misses(); }
+
+ private:
+  std::vector<int64_t> TokenizeText(std::string_view text, int64_t max_length) const;
+
+  int64_t padding_length_;
+  size_t num_threads_;
+  bool dedup_;  // of the rows of the same text, which are tokenized once
+  BackgroundLoad<HfTokenizerPipeline> pipeline_;
+  mutable BpeCache bpe_cache_;
+};
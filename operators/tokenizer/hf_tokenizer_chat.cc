@@ -0,0 +1,393 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "hf_tokenizer_chat.hpp"
+#include "ragged_rows.h"
+
+#include <algorithm>
+
+namespace {
+
+// The templates of the families, as HF renders them by their Jinja templates without a system message of their own.
+constexpr std::string_view kChatml =
+    "turn\t*\t<|im_start|>{role}\\n\t<|im_end|>\\n\n"
+    "generation\t<|im_start|>assistant\\n\n";
+
+constexpr std::string_view kLlama3 =
+    "bos\t<|begin_of_text|>\n"
+    "turn\t*\t<|start_header_id|>{role}<|end_header_id|>\\n\\n\t<|eot_id|>\n"
+    "generation\t<|start_header_id|>assistant<|end_header_id|>\\n\\n\n"
+    "trim_content\n";
+
+constexpr std::string_view kPhi3 =
+    "turn\tsystem\t<|system|>\\n\t<|end|>\\n\n"
+    "turn\tuser\t<|user|>\\n\t<|end|>\\n\n"
+    "turn\tassistant\t<|assistant|>\\n\t<|end|>\\n\n"
+    "generation\t<|assistant|>\\n\n"
+    "end\t<|endoftext|>\n";
+
+// Gemma has no system turn, and the turn of the assistant is the one of the model
+constexpr std::string_view kGemma =
+    "bos\t<bos>\n"
+    "turn\tuser\t<start_of_turn>user\\n\t<end_of_turn>\\n\n"
+    "turn\tassistant\t<start_of_turn>model\\n\t<end_of_turn>\\n\n"
+    "generation\t<start_of_turn>model\\n\n"
+    "trim_content\n";
+
+constexpr std::string_view kMistral =
+    "bos\t<s>\n"
+    "turn\tuser\t[INST] \t [/INST]\n"
+    "turn\tassistant\t\t</s>\n";
+
+constexpr std::string_view kRole = "{role}";
+
+std::string Unescape(std::string_view text, size_t line_number) {
+  std::string result;
+  result.reserve(text.size());
+  for (size_t i = 0; i < text.size(); ++i) {
+    if (text[i] != '\\') {
+      result.push_back(text[i]);
+      continue;
+    }
+    const char escaped = i + 1 < text.size() ? text[++i] : '\0';
+    if (escaped == 'n') {
+      result.push_back('\n');
+    } else if (escaped == 't') {
+      result.push_back('\t');
+    } else if (escaped == '\\') {
+      result.push_back('\\');
+    } else {
+      ORTX_CXX_API_THROW(MakeString("[HfChatTokenizer]: the escape in line ", line_number,
+                                    " of chat_template should be \\n, \\t or \\\\."),
+                         ORT_INVALID_ARGUMENT);
+    }
+  }
+  return result;
+}
+
+// The text without the whitespace of Python at its ends, as the trim of Jinja.
+std::string_view Trim(std::string_view text) {
+  size_t begin = text.size();
+  size_t end = 0;
+  size_t len = 0;
+  for (size_t pos = 0; pos < text.size(); pos += len) {
+    if (!IsRegexSpace(ustring::DecodeUTF8Char(text, pos, len))) {
+      begin = std::min(begin, pos);
+      end = pos + len;
+    }
+  }
+  return begin < end ? text.substr(begin, end - begin) : std::string_view{};
+}
+
+// The segments of a rendered conversation, whose texts are appended to the buffer, the adjacent ones into one text
+// as the rendered text of HF is split by its added tokens only.
+class SegmentBuilder {
+ public:
+  explicit SegmentBuilder(std::string& buffer) : buffer_(buffer) { buffer_.clear(); }
+
+  void AddText(std::string_view text) {
+    if (text.empty()) {
+      return;
+    }
+    if (spans_.empty() || spans_.back().id != -1) {
+      spans_.push_back({buffer_.size(), 0, -1});
+    }
+    buffer_.append(text);
+    spans_.back().length += text.size();
+  }
+
+  void AddToken(int id) { spans_.push_back({buffer_.size(), 0, id}); }
+
+  void Finish(std::vector<HfTokenizerPipeline::Segment>& segments) const {
+    segments.clear();
+    segments.reserve(spans_.size());
+    const std::string_view buffer = buffer_;
+    for (const Span& span : spans_) {
+      segments.emplace_back(buffer.substr(span.offset, span.length), span.id);
+    }
+  }
+
+ private:
+  // the buffer grows while the conversation is rendered, so the texts are its offsets until then
+  struct Span {
+    size_t offset;
+    size_t length;
+    int id;
+  };
+
+  std::string& buffer_;
+  std::vector<Span> spans_;
+};
+
+}  // namespace
+
+ChatTemplate ChatTemplate::Parse(std::string_view spec) {
+  if (spec == "chatml") {
+    spec = kChatml;
+  } else if (spec == "llama3") {
+    spec = kLlama3;
+  } else if (spec == "phi3") {
+    spec = kPhi3;
+  } else if (spec == "gemma") {
+    spec = kGemma;
+  } else if (spec == "mistral") {
+    spec = kMistral;
+  }
+
+  ChatTemplate chat_template;
+  size_t line_number = 0;
+  for (size_t pos = 0; pos < spec.size();) {
+    size_t end = spec.find('\n', pos);
+    if (end == std::string_view::npos) {
+      end = spec.size();
+    }
+    std::string_view line = spec.substr(pos, end - pos);
+    pos = end + 1;
+    ++line_number;
+    if (!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+    }
+    if (line.empty()) {
+      continue;
+    }
+
+    std::vector<std::string_view> fields;
+    for (size_t field = 0;;) {
+      const size_t tab = line.find('\t', field);
+      fields.push_back(line.substr(field, tab == std::string_view::npos ? std::string_view::npos : tab - field));
+      if (tab == std::string_view::npos) {
+        break;
+      }
+      field = tab + 1;
+    }
+
+    const std::string_view name = fields[0];
+    const size_t arguments = name == "turn" ? 3 : (name == "trim_content" ? 0 : 1);
+    if (fields.size() != arguments + 1) {
+      ORTX_CXX_API_THROW(MakeString("[HfChatTokenizer]: the line ", name, " of chat_template in line ", line_number,
+                                    " takes ", arguments, " texts after a tab, but has ", fields.size() - 1,
+                                    ", and chat_template should be a template or chatml, llama3, phi3, gemma or "
+                                    "mistral."),
+                         ORT_INVALID_ARGUMENT);
+    }
+
+    if (name == "bos") {
+      chat_template.bos_.source = Unescape(fields[1], line_number);
+    } else if (name == "generation") {
+      chat_template.generation_.source = Unescape(fields[1], line_number);
+    } else if (name == "end") {
+      chat_template.end_.source = Unescape(fields[1], line_number);
+    } else if (name == "trim_content") {
+      chat_template.trim_content_ = true;
+    } else if (name == "turn") {
+      Turn turn;
+      turn.prefix.source = Unescape(fields[2], line_number);
+      turn.suffix.source = Unescape(fields[3], line_number);
+      if (fields[1] == "*") {
+        chat_template.default_turn_ = std::move(turn);
+        chat_template.has_default_turn_ = true;
+      } else {
+        chat_template.turns_[std::string(fields[1])] = std::move(turn);
+      }
+    } else {
+      ORTX_CXX_API_THROW(MakeString("[HfChatTokenizer]: unknown line '", name, "' of chat_template in line ",
+                                    line_number, ", which should be bos, turn, generation, end or trim_content."),
+                         ORT_INVALID_ARGUMENT);
+    }
+  }
+
+  if (chat_template.turns_.empty() && !chat_template.has_default_turn_) {
+    ORTX_CXX_API_THROW("[HfChatTokenizer]: chat_template should have a turn.", ORT_INVALID_ARGUMENT);
+  }
+  return chat_template;
+}
+
+void ChatTemplate::Compile(const HfTokenizerPipeline& pipeline) {
+  const auto compile = [&](Text& text) {
+    text.parts.clear();
+    const std::string_view source = text.source;
+    for (size_t pos = 0; pos <= source.size();) {
+      size_t role = source.find(kRole, pos);
+      const std::string_view literal = source.substr(pos, role == std::string_view::npos ? role : role - pos);
+      for (const auto& [segment, id] : pipeline.SplitAddedTokens(literal)) {
+        if (id != -1 || !segment.empty()) {
+          text.parts.push_back({id == -1 ? std::string(segment) : std::string(), id, false});
+        }
+      }
+      if (role == std::string_view::npos) {
+        break;
+      }
+      text.parts.push_back({std::string(), -1, true});
+      pos = role + kRole.size();
+    }
+  };
+
+  compile(bos_);
+  compile(generation_);
+  compile(end_);
+  compile(default_turn_.prefix);
+  compile(default_turn_.suffix);
+  for (auto& [role, turn] : turns_) {
+    compile(turn.prefix);
+    compile(turn.suffix);
+  }
+}
+
+const ChatTemplate::Turn& ChatTemplate::TurnOf(std::string_view role) const {
+  auto it = turns_.find(std::string(role));
+  if (it != turns_.end()) {
+    return it->second;
+  }
+  if (!has_default_turn_) {
+    ORTX_CXX_API_THROW(MakeString("[HfChatTokenizer]: the chat template has no turn of the role ", role, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  return default_turn_;
+}
+
+void ChatTemplate::Render(const HfTokenizerPipeline& pipeline, const std::string_view* roles,
+                          const std::string_view* contents, size_t count, bool add_generation_prompt,
+                          bool parse_special, std::string& buffer,
+                          std::vector<HfTokenizerPipeline::Segment>& segments) const {
+  SegmentBuilder builder(buffer);
+  const auto add = [&](const Text& text, std::string_view role) {
+    for (const Part& part : text.parts) {
+      if (part.id != -1) {
+        builder.AddToken(part.id);
+      } else {
+        builder.AddText(part.role ? role : std::string_view(part.text));
+      }
+    }
+  };
+
+  add(bos_, {});
+  for (size_t i = 0; i < count; ++i) {
+    const Turn& turn = TurnOf(roles[i]);
+    add(turn.prefix, roles[i]);
+    const std::string_view content = trim_content_ ? Trim(contents[i]) : contents[i];
+    if (parse_special) {
+      for (const auto& [segment, id] : pipeline.SplitAddedTokens(content)) {
+        if (id != -1) {
+          builder.AddToken(id);
+        } else {
+          builder.AddText(segment);
+        }
+      }
+    } else {
+      builder.AddText(content);
+    }
+    add(turn.suffix, roles[i]);
+  }
+  add(add_generation_prompt ? generation_ : end_, {});
+  builder.Finish(segments);
+}
+
+KernelHfChatTokenizer::KernelHfChatTokenizer(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  ort_extensions::AssetBytes tokenizer_json = ort_extensions::GetAssetAttribute(*this, "tokenizer_json");
+  if (tokenizer_json.empty()) {
+    ORTX_CXX_API_THROW("tokenizer_json shouldn't be empty.", ORT_INVALID_ARGUMENT);
+  }
+
+  ChatTemplate chat_template =
+      ChatTemplate::Parse(TryToGetAttributeWithDefault<std::string>("chat_template", "chatml"));
+  add_generation_prompt_ = TryToGetAttributeWithDefault<int64_t>("add_generation_prompt", 1) != 0;
+  parse_special_ = TryToGetAttributeWithDefault<int64_t>("parse_special", 1) != 0;
+
+  num_threads_ = ReadNumThreadsAttribute(*this);
+
+  int64_t cache_capacity = TryToGetAttributeWithDefault<int64_t>("cache_capacity", kDefaultBpeCacheCapacity);
+  if (cache_capacity < 0) {
+    ORTX_CXX_API_THROW("cache_capacity shouldn't be negative", ORT_INVALID_ARGUMENT);
+  }
+  bpe_cache_.SetCapacity(static_cast<size_t>(cache_capacity));
+  bpe_cache_.SetStatsName("hf_tokenizer_cache");
+
+  const bool skip_unicode_normalization =
+      TryToGetAttributeWithDefault<int64_t>("skip_unicode_normalization", 0) != 0;
+
+  // the pipeline is the one of HfTokenizer of the same payload, and only the template is compiled by each kernel
+  pipeline_.Start([tokenizer_json = std::move(tokenizer_json), chat_template = std::move(chat_template),
+                   skip_unicode_normalization]() mutable {
+    std::string_view skip = skip_unicode_normalization ? "1" : "0";
+    auto pipeline = std::make_shared<HfChatPipeline>();
+    pipeline->tokenizer = SharedRegistry<HfTokenizerPipeline>::Instance().GetOrLoad({tokenizer_json, skip}, [&]() {
+      auto tokenizer = std::make_shared<HfTokenizerPipeline>();
+      tokenizer->Load(tokenizer_json, skip_unicode_normalization);
+      return tokenizer;
+    });
+    pipeline->chat_template = std::move(chat_template);
+    pipeline->chat_template.Compile(*pipeline->tokenizer);
+    return std::shared_ptr<const HfChatPipeline>(std::move(pipeline));
+  });
+}
+
+std::vector<int64_t> KernelHfChatTokenizer::TokenizeConversation(const std::string_view* roles,
+                                                                 const std::string_view* contents,
+                                                                 size_t count) const {
+  ORTX_TRACE_SCOPE("HfChatTokenizer.Tokenize");
+  const HfTokenizerPipeline& tokenizer = *pipeline_->tokenizer;
+
+  // the ill-formed sequences of the contents are the replacement characters, as a Python str would have them
+  std::vector<std::string> utf8;
+  std::vector<std::string_view> valid_contents;
+  for (size_t i = 0; i < count; ++i) {
+    if (!ustring::ValidateUTF8(contents[i])) {
+      if (utf8.empty()) {
+        utf8.reserve(count);
+        valid_contents.assign(contents, contents + count);
+      }
+      utf8.push_back(std::string(ustring(contents[i])));
+      valid_contents[i] = utf8.back();
+    }
+  }
+
+  std::string buffer;
+  std::vector<HfTokenizerPipeline::Segment> segments;
+  pipeline_->chat_template.Render(tokenizer, roles, valid_contents.empty() ? contents : valid_contents.data(),
+                                  count, add_generation_prompt_, parse_special_, buffer, segments);
+  std::vector<int64_t> ids;
+  tokenizer.EncodeSegments(segments, SIZE_MAX, ids, bpe_cache_);
+  return ids;
+}
+
+void KernelHfChatTokenizer::Compute(const ortc::Tensor<std::string_view>& roles,
+                                    const ortc::Tensor<std::string_view>& contents,
+                                    std::optional<const ortc::Tensor<int64_t>*> row_splits,
+                                    ortc::Tensor<int64_t>& input_ids,
+                                    ortc::Tensor<int64_t>& output_row_splits) const {
+  auto& role_data = roles.Data();
+  auto& content_data = contents.Data();
+  if (role_data.size() != content_data.size()) {
+    ORTX_CXX_API_THROW(MakeString("[HfChatTokenizer]: roles and contents should have the same count of messages, "
+                                  "but have ", role_data.size(), " and ", content_data.size(), "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  // the messages are one conversation without the row_splits
+  const int64_t all_messages[] = {0, static_cast<int64_t>(role_data.size())};
+  const bool has_splits = row_splits.has_value() && *row_splits != nullptr;
+  const ort_extensions::RowSplits conversations(
+      "HfChatTokenizer", has_splits ? (*row_splits)->Data() : all_messages,
+      has_splits ? static_cast<size_t>((*row_splits)->NumberOfElement()) : 2, role_data.size());
+
+  std::vector<std::vector<int64_t>> ids(conversations.Rows());
+  ParallelFor(conversations.Rows(), num_threads_, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      ids[row] = TokenizeConversation(role_data.data() + conversations.Begin(row),
+                                      content_data.data() + conversations.Begin(row), conversations.Length(row));
+    }
+  });
+
+  std::vector<int64_t> splits_dims{static_cast<int64_t>(ids.size() + 1)};
+  int64_t* splits = output_row_splits.Allocate(splits_dims);
+  splits[0] = 0;
+  for (size_t row = 0; row < ids.size(); ++row) {
+    splits[row + 1] = splits[row] + static_cast<int64_t>(ids[row].size());
+  }
+
+  std::vector<int64_t> ids_dims{splits[ids.size()]};
+  int64_t* output = input_ids.Allocate(ids_dims);
+  for (size_t row = 0; row < ids.size(); ++row) {
+    std::copy(ids[row].begin(), ids[row].end(), output + splits[row]);
+  }
+}
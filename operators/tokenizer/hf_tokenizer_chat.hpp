@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "hf_tokenizer.hpp"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// The chat template of a family of models, which a conversation of the roles and the contents of its messages is
+// rendered by: the bos at its start, the prefix and the suffix of the turn of the role around each content, and the
+// generation prompt at its end, or else the end. It's the subset of the Jinja templates of HF which most of the
+// families use, without a default system message or any other condition. A {role} in a prefix or a suffix is the
+// role of the message, and the other text of the template is split into its added tokens once when it's compiled,
+// so only the contents are looked up for the added tokens of the tokenizer, if at all.
+class ChatTemplate {
+ public:
+  // Parses the name of a preset, chatml, llama3, phi3, gemma or mistral, or the lines of a template, one of these
+  // separated by tabs each:
+  //   bos, and the text at the start of a conversation;
+  //   turn, the role, or * of any other role, the prefix and the suffix of its messages;
+  //   generation, and the text at the end of a conversation with the generation prompt;
+  //   end, and the text at the end of a conversation without it;
+  //   trim_content, of the template which trims the whitespace of the contents.
+  // \n, \t and \\ in a text are its newline, its tab and its backslash.
+  static ChatTemplate Parse(std::string_view spec);
+
+  // Splits the texts of the template into the added tokens of the pipeline and the texts between them.
+  void Compile(const HfTokenizerPipeline& pipeline);
+
+  // Renders the messages into the segments of the pipeline, whose texts are in the buffer, and which are the
+  // contents split into their added tokens with parse_special, or else the contents all as texts.
+  void Render(const HfTokenizerPipeline& pipeline, const std::string_view* roles, const std::string_view* contents,
+              size_t count, bool add_generation_prompt, bool parse_special, std::string& buffer,
+              std::vector<HfTokenizerPipeline::Segment>& segments) const;
+
+ private:
+  // a part of a text of the template, an added token, the role of the message, or a text of -1
+  struct Part {
+    std::string text;
+    int id = -1;
+    bool role = false;
+  };
+
+  struct Text {
+    std::string source;
+    std::vector<Part> parts;
+  };
+
+  struct Turn {
+    Text prefix;
+    Text suffix;
+  };
+
+  const Turn& TurnOf(std::string_view role) const;
+
+  Text bos_;
+  Text generation_;
+  Text end_;
+  std::unordered_map<std::string, Turn> turns_;
+  Turn default_turn_;
+  bool has_default_turn_ = false;
+  bool trim_content_ = false;
+};
+
+// The pipeline of a tokenizer.json, shared by the kernels of the same one, and the chat template compiled by it.
+struct HfChatPipeline {
+  std::shared_ptr<const HfTokenizerPipeline> tokenizer;
+  ChatTemplate chat_template;
+};
+
+// Renders the conversations of the roles and the contents by a chat template, and tokenizes them by the pipeline of
+// a tokenizer.json into the input_ids of all of them one after another, and their row_splits. The added tokens of
+// the template are its ids, without the text of the template going through the added tokens again, and the special
+// tokens of the post-processor aren't added, as apply_chat_template of HF doesn't add them.
+struct KernelHfChatTokenizer : BaseKernel {
+  KernelHfChatTokenizer(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string_view>& roles,
+               const ortc::Tensor<std::string_view>& contents,
+               std::optional<const ortc::Tensor<int64_t>*> row_splits,
+               ortc::Tensor<int64_t>& input_ids,
+               ortc::Tensor<int64_t>& output_row_splits) const;
+
+ private:
+  std::vector<int64_t> TokenizeConversation(const std::string_view* roles, const std::string_view* contents,
+                                            size_t count) const;
+
+  bool add_generation_prompt_;
+  bool parse_special_;
+  size_t num_threads_;
+  BackgroundLoad<HfChatPipeline> pipeline_;
+  mutable BpeCache bpe_cache_;
+};
@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "ocos.h"
+#include "string_utils.h"
+
+// The element type of the integer outputs of a tokenizer, the ids, the masks, the offsets and the mappings, by its
+// output_dtype attribute of the ONNX TensorProto types: INT64 (7), the default, or INT32 (6), which many models and
+// NPUs take without a Cast of the whole batch. A kernel of each type is registered under the op name, and ORT
+// selects the one of the outputs of the node, which InferOutputShape sets from the attribute.
+inline ONNXTensorElementDataType ToOutputDtype(int64_t dtype) {
+  if (dtype != ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64 && dtype != ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32) {
+    ORTX_CXX_API_THROW(MakeString("output_dtype should be INT64 (7) or INT32 (6), but it is ", dtype),
+                       ORT_INVALID_ARGUMENT);
+  }
+  return static_cast<ONNXTensorElementDataType>(dtype);
+}
+
+inline ONNXTensorElementDataType GetOutputDtype(const ortc::ShapeInferContext& ctx) {
+  return ToOutputDtype(ctx.GetAttributeInt("output_dtype", ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64));
+}
+
+// Checks that the outputs of the kernel of T are of its output_dtype attribute, which they aren't if the graph has
+// declared other output types than the ones the attribute gives.
+template <typename T>
+void CheckOutputDtype(const BaseKernel& kernel, const char* op_name) {
+  static_assert(std::is_same_v<T, int64_t> || std::is_same_v<T, int32_t>, "the outputs are int64 or int32");
+  constexpr ONNXTensorElementDataType type = std::is_same_v<T, int64_t> ? ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64
+                                                                        : ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32;
+  const ONNXTensorElementDataType dtype = ToOutputDtype(
+      kernel.TryToGetAttributeWithDefault<int64_t>("output_dtype", ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64));
+  if (dtype != type) {
+    ORTX_CXX_API_THROW(MakeString("[", op_name, "]: the outputs are of the type ", static_cast<int>(type),
+                                  ", but output_dtype is ", static_cast<int>(dtype), "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+}
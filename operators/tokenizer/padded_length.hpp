@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "ocos.h"
+#include "string_utils.h"
+
+// The length which the rows of a batch are padded to, by the pad_to_multiple_of and length_buckets attributes of
+// the tokenizers: the longest row is rounded up to the smallest bucket which holds it, or else to the next
+// multiple, so the models after the tokenizer are run with a few sequence lengths.
+class PaddedLength {
+ public:
+  PaddedLength() = default;
+
+  explicit PaddedLength(const BaseKernel& kernel)
+      : PaddedLength(kernel.TryToGetAttributeWithDefault<int64_t>("pad_to_multiple_of", 0),
+                     kernel.TryToGetAttributeWithDefault("length_buckets", std::vector<int64_t>{})) {}
+
+  PaddedLength(int64_t multiple, const std::vector<int64_t>& buckets) {
+    if (multiple < 0) {
+      ORTX_CXX_API_THROW("pad_to_multiple_of shouldn't be negative", ORT_INVALID_ARGUMENT);
+    }
+    multiple_ = static_cast<size_t>(multiple);
+
+    for (int64_t bucket : buckets) {
+      if (bucket <= 0) {
+        ORTX_CXX_API_THROW(MakeString("length_buckets should be positive, but it has ", bucket), ORT_INVALID_ARGUMENT);
+      }
+      buckets_.push_back(static_cast<size_t>(bucket));
+    }
+    std::sort(buckets_.begin(), buckets_.end());
+    buckets_.erase(std::unique(buckets_.begin(), buckets_.end()), buckets_.end());
+  }
+
+  bool IsSet() const { return multiple_ > 0 || !buckets_.empty(); }
+
+  size_t Round(size_t length) const {
+    auto bucket = std::lower_bound(buckets_.begin(), buckets_.end(), length);
+    if (bucket != buckets_.end()) {
+      return *bucket;
+    }
+    return multiple_ > 0 ? (length + multiple_ - 1) / multiple_ * multiple_ : length;
+  }
+
+ private:
+  size_t multiple_ = 0;  // 0 for none
+  std::vector<size_t> buckets_;
+};
+
+// Writes the stable order of the count rows by length(i) from the shortest one, by which the callers can form
+// the micro-batches of the rows of similar lengths.
+template <typename LengthFn, typename T>
+void WriteLengthOrder(size_t count, LengthFn&& length, T* order) {
+  std::iota(order, order + count, T{0});
+  std::stable_sort(order, order + count, [&length](T lhs, T rhs) {
+    return length(static_cast<size_t>(lhs)) < length(static_cast<size_t>(rhs));
+  });
+}
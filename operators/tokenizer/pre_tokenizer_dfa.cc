@@ -0,0 +1,795 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pre_tokenizer_dfa.hpp"
+
+#include <algorithm>
+#include <map>
+
+#include "ocos.h"
+#include "string_utils.h"
+#include "unicode.h"
+
+using ufal::unilib::unicode;
+
+namespace {
+
+// The ranges of this many characters are matched by the characters themselves, the wider ones by a bit of the key.
+constexpr char32_t kNarrowRange = 256;
+constexpr size_t kMaxWideRanges = 6;
+constexpr size_t kMaxStates = 8192;
+constexpr int kMaxRepeat = 1000;
+
+// The index of the general category, of the single bit ufal gives for a character.
+uint32_t CategoryIndex(unicode::category_t category) {
+  static const uint8_t kDeBruijn[32] = {0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+                                        31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9};
+  return kDeBruijn[static_cast<uint32_t>(category * 0x077CB531u) >> 27];
+}
+
+enum AssertKind {
+  kStartOfText,
+  kEndOfText,
+  kFollowedBy,
+  kNotFollowedBy,
+};
+
+// A term of a set: a category mask, \s, or a range of characters, which may be negated.
+struct Predicate {
+  enum Kind { kCategory, kSpace, kRange } kind;
+  bool negated;
+  unicode::category_t categories;
+  char32_t lo;
+  char32_t hi;
+};
+
+// The union of its predicates, or the complement of it.
+struct CharSet {
+  bool negated = false;
+  std::vector<Predicate> items;
+};
+
+struct Node {
+  enum Kind { kEmpty, kSet, kConcat, kAlt, kRepeat, kAssert } kind = kEmpty;
+  int set = -1;  // of kSet, and of the lookaheads
+  int min = 0;
+  int max = 0;  // -1 for no bound
+  bool greedy = true;
+  AssertKind assertion = kStartOfText;
+  std::vector<Node> children;
+};
+
+class Parser {
+ public:
+  Parser(std::string_view pattern, std::vector<CharSet>& sets) : pattern_(pattern), sets_(sets) {}
+
+  Node Parse() {
+    Node node = ParseAlt(false);
+    if (pos_ < pattern_.size()) {
+      Error("unbalanced )");
+    }
+    return node;
+  }
+
+ private:
+  void Error(const char* what) const {
+    ORTX_CXX_API_THROW(MakeString("[PreTokenizer]: ", what, " at ", pos_, " of the pattern ", pattern_),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  bool AtEnd() const { return pos_ >= pattern_.size(); }
+  char Peek() const { return AtEnd() ? '\0' : pattern_[pos_]; }
+
+  bool Accept(std::string_view token) {
+    if (pattern_.substr(pos_, token.size()) == token) {
+      pos_ += token.size();
+      return true;
+    }
+    return false;
+  }
+
+  char32_t NextChar() {
+    size_t len = 0;
+    char32_t ch = ustring::DecodeUTF8Char(pattern_, pos_, len);
+    pos_ += len;
+    return ch;
+  }
+
+  Node ParseAlt(bool icase) {
+    Node alt;
+    alt.kind = Node::kAlt;
+    alt.children.push_back(ParseConcat(icase));
+    while (Accept("|")) {
+      alt.children.push_back(ParseConcat(icase));
+    }
+    return alt.children.size() == 1 ? std::move(alt.children[0]) : std::move(alt);
+  }
+
+  // icase is of the group, which an inline (?i) sets for the rest of it
+  Node ParseConcat(bool& icase) {
+    Node concat;
+    concat.kind = Node::kConcat;
+    while (!AtEnd() && Peek() != '|' && Peek() != ')') {
+      concat.children.push_back(ParseRepeat(icase));
+    }
+    return concat;
+  }
+
+  Node ParseRepeat(bool& icase) {
+    Node atom = ParseAtom(icase);
+    int min = 0;
+    int max = 0;
+    if (Accept("?")) {
+      min = 0, max = 1;
+    } else if (Accept("*")) {
+      min = 0, max = -1;
+    } else if (Accept("+")) {
+      min = 1, max = -1;
+    } else if (!ParseCount(min, max)) {
+      return atom;
+    }
+
+    if (atom.kind == Node::kAssert) {
+      Error("a quantified assertion");
+    }
+    Node repeat;
+    repeat.kind = Node::kRepeat;
+    repeat.min = min;
+    repeat.max = max;
+    // a possessive quantifier is matched as the greedy one
+    repeat.greedy = !Accept("?");
+    if (repeat.greedy) {
+      Accept("+");
+    }
+    repeat.children.push_back(std::move(atom));
+    return repeat;
+  }
+
+  // {n}, {n,} or {n,m}, which leaves the position where it was if it isn't one
+  bool ParseCount(int& min, int& max) {
+    const size_t start = pos_;
+    auto number = [this](int& value) {
+      const size_t begin = pos_;
+      value = 0;
+      while (!AtEnd() && Peek() >= '0' && Peek() <= '9') {
+        value = std::min(value * 10 + (Peek() - '0'), kMaxRepeat + 1);
+        ++pos_;
+      }
+      return pos_ > begin;
+    };
+
+    if (!Accept("{") || !number(min)) {
+      pos_ = start;
+      return false;
+    }
+    max = min;
+    if (Accept(",")) {
+      if (!number(max)) {
+        max = -1;
+      }
+    }
+    if (!Accept("}")) {
+      pos_ = start;
+      return false;
+    }
+    if (min > kMaxRepeat || max > kMaxRepeat || (max != -1 && max < min)) {
+      Error("an invalid repetition count");
+    }
+    return true;
+  }
+
+  Node SetNode(CharSet set) {
+    Node node;
+    node.kind = Node::kSet;
+    node.set = static_cast<int>(sets_.size());
+    sets_.push_back(std::move(set));
+    return node;
+  }
+
+  Node AssertNode(AssertKind kind, int set = -1) {
+    Node node;
+    node.kind = Node::kAssert;
+    node.assertion = kind;
+    node.set = set;
+    return node;
+  }
+
+  Node ParseAtom(bool& icase) {
+    const char ch = Peek();
+    if (ch == '(') {
+      ++pos_;
+      return ParseGroup(icase);
+    }
+    if (ch == '[') {
+      ++pos_;
+      return SetNode(ParseSet(icase));
+    }
+    if (ch == '.') {
+      ++pos_;
+      CharSet set;
+      set.negated = true;
+      AddChar(set, U'\n', false);
+      return SetNode(std::move(set));
+    }
+    if (ch == '^') {
+      ++pos_;
+      return AssertNode(kStartOfText);
+    }
+    if (ch == '$') {
+      ++pos_;
+      return AssertNode(kEndOfText);
+    }
+    if (ch == '*' || ch == '+' || ch == '?') {
+      Error("nothing to repeat");
+    }
+    if (ch == '\\') {
+      ++pos_;
+      if (Accept("A")) {
+        return AssertNode(kStartOfText);
+      }
+      if (Accept("z")) {
+        return AssertNode(kEndOfText);
+      }
+      CharSet set;
+      ParseEscape(set, icase);
+      return SetNode(std::move(set));
+    }
+
+    CharSet set;
+    AddChar(set, NextChar(), icase);
+    return SetNode(std::move(set));
+  }
+
+  Node ParseGroup(bool& icase) {
+    bool group_icase = icase;
+    if (Accept("?")) {
+      if (Accept("=") || Accept("!")) {
+        const AssertKind kind = pattern_[pos_ - 1] == '=' ? kFollowedBy : kNotFollowedBy;
+        Node atom = ParseAtom(icase);
+        if (atom.kind != Node::kSet || !Accept(")")) {
+          Error("a lookahead of more than one character");
+        }
+        return AssertNode(kind, atom.set);
+      }
+
+      bool on = true;
+      for (;;) {
+        if (Accept("i")) {
+          group_icase = on;
+        } else if (Accept("-")) {
+          on = false;
+        } else if (Accept(":")) {
+          break;
+        } else if (Accept(")")) {
+          // the inline flags apply to the rest of the enclosing group
+          icase = group_icase;
+          return Node{};
+        } else {
+          Error("an unsupported group");
+        }
+      }
+    }
+
+    Node node = ParseAlt(group_icase);
+    if (!Accept(")")) {
+      Error("a missing )");
+    }
+    return node;
+  }
+
+  CharSet ParseSet(bool icase) {
+    CharSet set;
+    set.negated = Accept("^");
+    bool first = true;
+    while (first || Peek() != ']') {
+      if (AtEnd()) {
+        Error("a missing ]");
+      }
+      if (Peek() == '[' || pattern_.substr(pos_, 2) == "&&") {
+        Error("a nested set");
+      }
+      first = false;
+
+      char32_t lo = 0;
+      if (Accept("\\")) {
+        if (!ParseEscape(set, icase, &lo)) {
+          continue;
+        }
+      } else {
+        lo = NextChar();
+      }
+
+      if (Peek() == '-' && pos_ + 1 < pattern_.size() && pattern_[pos_ + 1] != ']') {
+        ++pos_;
+        char32_t hi = 0;
+        if (Accept("\\")) {
+          CharSet unused;
+          if (!ParseEscape(unused, icase, &hi)) {
+            Error("a range to a class");
+          }
+        } else {
+          hi = NextChar();
+        }
+        if (hi < lo) {
+          Error("an inverted range");
+        }
+        AddRange(set, lo, hi, icase);
+      } else {
+        AddChar(set, lo, icase);
+      }
+    }
+    ++pos_;
+    return set;
+  }
+
+  // Parses the escape after the backslash, a class into the set, or a character into *ch if it isn't null, or else
+  // into the set. Returns whether it was a character.
+  bool ParseEscape(CharSet& set, bool icase, char32_t* ch = nullptr) {
+    if (AtEnd()) {
+      Error("a trailing backslash");
+    }
+    const char c = pattern_[pos_++];
+    auto category = [&set](unicode::category_t categories, bool negated) {
+      set.items.push_back(Predicate{Predicate::kCategory, negated, categories, 0, 0});
+    };
+    switch (c) {
+      case 's':
+      case 'S':
+        set.items.push_back(Predicate{Predicate::kSpace, c == 'S', 0, 0, 0});
+        return false;
+      case 'd':
+      case 'D':
+        category(unicode::Nd, c == 'D');
+        return false;
+      case 'w':
+      case 'W':
+        category(unicode::L | unicode::M | unicode::Nd | unicode::Nl | unicode::Pc, c == 'W');
+        return false;
+      case 'p':
+      case 'P':
+        category(ParseCategory(), c == 'P');
+        return false;
+      default:
+        break;
+    }
+
+    char32_t value = 0;
+    switch (c) {
+      case 't': value = U'\t'; break;
+      case 'n': value = U'\n'; break;
+      case 'r': value = U'\r'; break;
+      case 'f': value = U'\f'; break;
+      case 'v': value = U'\v'; break;
+      case 'a': value = U'\a'; break;
+      case 'e': value = 0x1B; break;
+      case '0': value = 0; break;
+      case 'x':
+      case 'u':
+        value = ParseHex(c == 'x' ? 2 : 4);
+        break;
+      default:
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) {
+          --pos_;
+          Error("an unsupported escape");
+        }
+        --pos_;
+        value = NextChar();
+        break;
+    }
+
+    if (ch != nullptr) {
+      *ch = value;
+    } else {
+      AddChar(set, value, icase);
+    }
+    return true;
+  }
+
+  // \xHH, \uHHHH, or either with the braces of any number of digits
+  char32_t ParseHex(int digits) {
+    const bool braced = Accept("{");
+    char32_t value = 0;
+    int count = 0;
+    while (!AtEnd() && (braced || count < digits) && std::isxdigit(static_cast<unsigned char>(Peek()))) {
+      const char h = Peek();
+      value = value * 16 + static_cast<char32_t>(h <= '9' ? h - '0' : (h | 0x20) - 'a' + 10);
+      ++pos_;
+      ++count;
+    }
+    if (count == 0 || (!braced && count != digits) || (braced && !Accept("}")) || value > 0x10FFFF) {
+      Error("an invalid hex escape");
+    }
+    return value;
+  }
+
+  unicode::category_t ParseCategory() {
+    std::string_view name;
+    if (Accept("{")) {
+      const size_t end = pattern_.find('}', pos_);
+      if (end == std::string_view::npos) {
+        Error("a missing }");
+      }
+      name = pattern_.substr(pos_, end - pos_);
+      pos_ = end + 1;
+    } else if (!AtEnd()) {
+      name = pattern_.substr(pos_++, 1);
+    }
+
+    static const std::map<std::string_view, unicode::category_t> kCategories = {
+        {"L", unicode::L}, {"Letter", unicode::L}, {"Lu", unicode::Lu}, {"Uppercase_Letter", unicode::Lu},
+        {"Ll", unicode::Ll}, {"Lowercase_Letter", unicode::Ll}, {"Lt", unicode::Lt}, {"Lm", unicode::Lm},
+        {"Lo", unicode::Lo}, {"LC", unicode::LC}, {"L&", unicode::LC}, {"M", unicode::M}, {"Mark", unicode::M},
+        {"Mn", unicode::Mn}, {"Mc", unicode::Mc}, {"Me", unicode::Me}, {"N", unicode::N}, {"Number", unicode::N},
+        {"Nd", unicode::Nd}, {"Decimal_Number", unicode::Nd}, {"Nl", unicode::Nl}, {"No", unicode::No},
+        {"P", unicode::P}, {"Punctuation", unicode::P}, {"Pc", unicode::Pc}, {"Pd", unicode::Pd},
+        {"Ps", unicode::Ps}, {"Pe", unicode::Pe}, {"Pi", unicode::Pi}, {"Pf", unicode::Pf}, {"Po", unicode::Po},
+        {"S", unicode::S}, {"Symbol", unicode::S}, {"Sm", unicode::Sm}, {"Sc", unicode::Sc}, {"Sk", unicode::Sk},
+        {"So", unicode::So}, {"Z", unicode::Z}, {"Separator", unicode::Z}, {"Zs", unicode::Zs},
+        {"Zl", unicode::Zl}, {"Zp", unicode::Zp}, {"C", unicode::C}, {"Other", unicode::C}, {"Cc", unicode::Cc},
+        {"Cf", unicode::Cf}, {"Cs", unicode::Cs}, {"Co", unicode::Co}, {"Cn", unicode::Cn},
+    };
+    auto it = kCategories.find(name);
+    if (it == kCategories.end()) {
+      Error("an unsupported Unicode property");
+    }
+    return it->second;
+  }
+
+  static void AddChar(CharSet& set, char32_t ch, bool icase) {
+    set.items.push_back(Predicate{Predicate::kRange, false, 0, ch, ch});
+    if (!icase) {
+      return;
+    }
+    // the simple case folding, with the two characters which fold to ASCII letters
+    for (char32_t other : {unicode::lowercase(ch), unicode::uppercase(ch)}) {
+      if (other != ch) {
+        set.items.push_back(Predicate{Predicate::kRange, false, 0, other, other});
+      }
+    }
+    const char32_t lower = unicode::lowercase(ch);
+    const char32_t extra = lower == U's' ? 0x017F : lower == 0x017F ? U's' : lower == U'k' ? 0x212A : 0;
+    if (extra != 0) {
+      set.items.push_back(Predicate{Predicate::kRange, false, 0, extra, extra});
+    }
+  }
+
+  static void AddRange(CharSet& set, char32_t lo, char32_t hi, bool icase) {
+    if (!icase || hi - lo >= kNarrowRange) {
+      set.items.push_back(Predicate{Predicate::kRange, false, 0, lo, hi});
+      return;
+    }
+    for (char32_t ch = lo; ch <= hi; ++ch) {
+      AddChar(set, ch, true);
+    }
+  }
+
+  std::string_view pattern_;
+  std::vector<CharSet>& sets_;
+  size_t pos_ = 0;
+};
+
+struct NfaState {
+  enum Kind { kChar, kSplit, kAssert, kMatch } kind;
+  int set;  // of kChar, and of the lookaheads
+  int out;
+  int out2;  // the less preferred branch of kSplit
+  AssertKind assertion;
+};
+
+}  // namespace
+
+// Compiles the pattern into the classes and the transitions of the DFA, by the subset construction over the NFA of
+// the pattern. A state of the DFA is the NFA states of the threads in their priority order, where a thread stops
+// at a character, at a lookahead which waits for the next character, or at the match. When a thread reaches the
+// match, the threads after it are dropped, which makes the match the leftmost-first one.
+class PreTokenizerCompiler {
+ public:
+  PreTokenizerCompiler(std::string_view pattern, PreTokenizerDfa& dfa) : pattern_(pattern), dfa_(dfa) {}
+
+  void Compile() {
+    if (pattern_.empty()) {
+      ORTX_CXX_API_THROW("[PreTokenizer]: the pattern is empty", ORT_INVALID_ARGUMENT);
+    }
+    Node root = Parser(pattern_, sets_).Parse();
+    nfa_.push_back(NfaState{NfaState::kMatch, -1, -1, -1, kStartOfText});
+    const int start = CompileNode(root, 0);
+
+    BuildClasses();
+    BuildStates(start);
+  }
+
+ private:
+  int Add(NfaState state) {
+    nfa_.push_back(state);
+    return static_cast<int>(nfa_.size() - 1);
+  }
+
+  // Compiles the node in front of the next state, and returns its start.
+  int CompileNode(const Node& node, int next) {
+    switch (node.kind) {
+      case Node::kEmpty:
+        return next;
+      case Node::kSet:
+        return Add(NfaState{NfaState::kChar, node.set, next, -1, kStartOfText});
+      case Node::kAssert:
+        return Add(NfaState{NfaState::kAssert, node.set, next, -1, node.assertion});
+      case Node::kConcat:
+        for (auto it = node.children.rbegin(); it != node.children.rend(); ++it) {
+          next = CompileNode(*it, next);
+        }
+        return next;
+      case Node::kAlt: {
+        int start = CompileNode(node.children.back(), next);
+        for (size_t i = node.children.size() - 1; i-- > 0;) {
+          start = Add(NfaState{NfaState::kSplit, -1, CompileNode(node.children[i], next), start, kStartOfText});
+        }
+        return start;
+      }
+      case Node::kRepeat: {
+        const Node& child = node.children[0];
+        int tail = next;
+        if (node.max == -1) {
+          const int loop = Add(NfaState{NfaState::kSplit, -1, -1, -1, kStartOfText});
+          const int body = CompileNode(child, loop);
+          nfa_[loop].out = node.greedy ? body : next;
+          nfa_[loop].out2 = node.greedy ? next : body;
+          tail = loop;
+        } else {
+          // x{0,k} as (x(x(...)?)?)?
+          for (int i = node.min; i < node.max; ++i) {
+            const int body = CompileNode(child, tail);
+            tail = Add(NfaState{NfaState::kSplit, -1, node.greedy ? body : next, node.greedy ? next : body,
+                                kStartOfText});
+          }
+        }
+        for (int i = 0; i < node.min; ++i) {
+          tail = CompileNode(child, tail);
+        }
+        return tail;
+      }
+    }
+    return next;
+  }
+
+  // The classes are the sets of the characters which are in the same sets of the pattern. A character of a narrow
+  // range is classified by itself, any other one by the key of its category, whether it is a space, and the wide
+  // ranges it is in.
+  void BuildClasses() {
+    std::vector<char32_t> literals;
+    for (const auto& set : sets_) {
+      for (const auto& item : set.items) {
+        if (item.kind != Predicate::kRange) {
+          continue;
+        }
+        if (item.hi - item.lo < kNarrowRange) {
+          for (char32_t ch = item.lo; ch <= item.hi; ++ch) {
+            literals.push_back(ch);
+          }
+        } else if (std::find(dfa_.wide_ranges_.begin(), dfa_.wide_ranges_.end(), std::make_pair(item.lo, item.hi)) ==
+                   dfa_.wide_ranges_.end()) {
+          dfa_.wide_ranges_.emplace_back(item.lo, item.hi);
+        }
+      }
+    }
+    if (dfa_.wide_ranges_.size() > kMaxWideRanges) {
+      ORTX_CXX_API_THROW(MakeString("[PreTokenizer]: more than ", kMaxWideRanges, " wide ranges in the pattern ",
+                                    pattern_),
+                         ORT_INVALID_ARGUMENT);
+    }
+    std::sort(literals.begin(), literals.end());
+    literals.erase(std::unique(literals.begin(), literals.end()), literals.end());
+
+    std::map<std::vector<bool>, uint16_t> classes;
+    auto class_of = [&](std::vector<bool> signature) {
+      auto it = classes.emplace(std::move(signature), static_cast<uint16_t>(classes.size())).first;
+      return it->second;
+    };
+
+    for (char32_t ch : literals) {
+      const uint16_t cls = class_of(LiteralSignature(ch));
+      if (ch < 0x80) {
+        dfa_.ascii_classes_[ch] = cls;
+      } else {
+        dfa_.literal_classes_.emplace_back(ch, cls);
+      }
+    }
+
+    dfa_.key_classes_.resize(size_t{64} << dfa_.wide_ranges_.size());
+    for (size_t key = 0; key < dfa_.key_classes_.size(); ++key) {
+      dfa_.key_classes_[key] = class_of(KeySignature(key));
+    }
+    for (char32_t ch = 0; ch < 0x80; ++ch) {
+      if (!std::binary_search(literals.begin(), literals.end(), ch)) {
+        dfa_.ascii_classes_[ch] = dfa_.key_classes_[dfa_.KeyOf(ch)];
+      }
+    }
+
+    if (classes.size() >= PreTokenizerDfa::kEndOfText) {
+      ORTX_CXX_API_THROW(MakeString("[PreTokenizer]: too many character classes in the pattern ", pattern_),
+                         ORT_INVALID_ARGUMENT);
+    }
+    dfa_.class_count_ = classes.size();
+    membership_.assign(classes.size(), {});
+    for (const auto& [signature, cls] : classes) {
+      membership_[cls] = signature;
+    }
+  }
+
+  std::vector<bool> LiteralSignature(char32_t ch) const {
+    return Signature(unicode::category(ch), IsRegexSpace(ch), [ch](const Predicate& item) {
+      return ch >= item.lo && ch <= item.hi;
+    });
+  }
+
+  // The signature of the characters of the key, which aren't in any narrow range.
+  std::vector<bool> KeySignature(size_t key) const {
+    const auto category = static_cast<unicode::category_t>(1u << ((key & 63) >> 1));
+    return Signature(category, (key & 1) != 0, [this, key](const Predicate& item) {
+      if (item.hi - item.lo < kNarrowRange) {
+        return false;
+      }
+      const auto r = std::find(dfa_.wide_ranges_.begin(), dfa_.wide_ranges_.end(), std::make_pair(item.lo, item.hi));
+      return ((key >> 6) >> (r - dfa_.wide_ranges_.begin()) & 1) != 0;
+    });
+  }
+
+  template <typename InRange>
+  std::vector<bool> Signature(unicode::category_t category, bool space, InRange&& in_range) const {
+    std::vector<bool> signature(sets_.size());
+    for (size_t s = 0; s < sets_.size(); ++s) {
+      bool member = false;
+      for (const auto& item : sets_[s].items) {
+        bool in = item.kind == Predicate::kCategory ? (item.categories & category) != 0
+                  : item.kind == Predicate::kSpace  ? space
+                                                    : in_range(item);
+        if (in != item.negated) {
+          member = true;
+          break;
+        }
+      }
+      signature[s] = member != sets_[s].negated;
+    }
+    return signature;
+  }
+
+  bool Member(int set, uint32_t column) const {
+    return column < dfa_.class_count_ && membership_[column][set];
+  }
+
+  // Adds the threads from the NFA state to the list, up to the characters, the lookaheads and the match.
+  void Closure(int pc, bool at_start, std::vector<bool>& visited, std::vector<int>& list) const {
+    if (visited[pc]) {
+      return;
+    }
+    visited[pc] = true;
+    const NfaState& state = nfa_[pc];
+    if (state.kind == NfaState::kSplit) {
+      Closure(state.out, at_start, visited, list);
+      Closure(state.out2, at_start, visited, list);
+    } else if (state.kind == NfaState::kAssert && state.assertion == kStartOfText) {
+      if (at_start) {
+        Closure(state.out, at_start, visited, list);
+      }
+    } else {
+      list.push_back(pc);
+    }
+  }
+
+  // Runs the thread to its characters before the one of the column, and returns whether it reaches the match.
+  bool Resolve(int pc, uint32_t column, bool at_start, std::vector<bool>& visited, std::vector<int>& chars) const {
+    if (visited[pc]) {
+      return false;
+    }
+    visited[pc] = true;
+    const NfaState& state = nfa_[pc];
+    switch (state.kind) {
+      case NfaState::kMatch:
+        return true;
+      case NfaState::kChar:
+        chars.push_back(pc);
+        return false;
+      case NfaState::kSplit:
+        return Resolve(state.out, column, at_start, visited, chars) ||
+               Resolve(state.out2, column, at_start, visited, chars);
+      case NfaState::kAssert: {
+        const bool end = column == dfa_.class_count_;
+        const bool pass = state.assertion == kStartOfText ? at_start
+                          : state.assertion == kEndOfText ? end
+                          : state.assertion == kFollowedBy ? !end && Member(state.set, column)
+                                                           : end || !Member(state.set, column);
+        return pass && Resolve(state.out, column, at_start, visited, chars);
+      }
+    }
+    return false;
+  }
+
+  uint32_t Intern(std::vector<int> list, bool at_start) {
+    auto key = std::make_pair(std::move(list), at_start);
+    auto it = state_ids_.find(key);
+    if (it != state_ids_.end()) {
+      return it->second;
+    }
+    if (states_.size() >= kMaxStates || states_.size() * (dfa_.class_count_ + 1) >= (uint32_t{1} << 31)) {
+      ORTX_CXX_API_THROW(MakeString("[PreTokenizer]: the DFA of the pattern has more than ", kMaxStates,
+                                    " states: ", pattern_),
+                         ORT_INVALID_ARGUMENT);
+    }
+    const auto id = static_cast<uint32_t>(states_.size());
+    state_ids_.emplace(key, id);
+    states_.push_back(std::move(key));
+    return id;
+  }
+
+  void BuildStates(int start) {
+    const size_t width = dfa_.class_count_ + 1;
+    std::vector<bool> visited(nfa_.size());
+    Intern({}, false);  // the dead state
+    for (bool at_start : {false, true}) {
+      std::vector<int> list;
+      std::fill(visited.begin(), visited.end(), false);
+      Closure(start, at_start, visited, list);
+      dfa_.start_states_[at_start ? 1 : 0] = Intern(std::move(list), at_start) * static_cast<uint32_t>(width);
+    }
+
+    std::vector<int> chars;
+    for (size_t id = 0; id < states_.size(); ++id) {
+      dfa_.transitions_.resize((id + 1) * width);
+      // states_ grows in the loop, so the state is copied
+      const auto [list, at_start] = states_[id];
+      for (uint32_t column = 0; column < width; ++column) {
+        chars.clear();
+        std::fill(visited.begin(), visited.end(), false);
+        bool matched = false;
+        for (int pc : list) {
+          if (Resolve(pc, column, at_start, visited, chars)) {
+            matched = true;
+            break;
+          }
+        }
+
+        std::vector<int> next;
+        if (column < dfa_.class_count_) {
+          std::fill(visited.begin(), visited.end(), false);
+          for (int pc : chars) {
+            if (Member(nfa_[pc].set, column)) {
+              Closure(nfa_[pc].out, false, visited, next);
+            }
+          }
+        }
+        const uint32_t next_id = next.empty() ? 0 : Intern(std::move(next), false);
+        dfa_.transitions_[id * width + column] = next_id * static_cast<uint32_t>(width) << 1 | (matched ? 1 : 0);
+      }
+    }
+  }
+
+  std::string_view pattern_;
+  PreTokenizerDfa& dfa_;
+  std::vector<CharSet> sets_;
+  std::vector<NfaState> nfa_;                  // the match is state 0
+  std::vector<std::vector<bool>> membership_;  // of the sets by the class
+  std::map<std::pair<std::vector<int>, bool>, uint32_t> state_ids_;
+  std::vector<std::pair<std::vector<int>, bool>> states_;
+};
+
+PreTokenizerDfa::PreTokenizerDfa(std::string_view pattern) {
+  PreTokenizerCompiler(pattern, *this).Compile();
+}
+
+uint16_t PreTokenizerDfa::ClassifyNonAscii(char32_t ch) const {
+  auto it = std::lower_bound(literal_classes_.begin(), literal_classes_.end(), ch,
+                             [](const std::pair<char32_t, uint16_t>& entry, char32_t c) { return entry.first < c; });
+  if (it != literal_classes_.end() && it->first == ch) {
+    return it->second;
+  }
+  return key_classes_[KeyOf(ch)];
+}
+
+size_t PreTokenizerDfa::KeyOf(char32_t ch) const {
+  size_t key = CategoryIndex(unicode::category(ch)) * 2 + (IsRegexSpace(ch) ? 1 : 0);
+  for (size_t r = 0; r < wide_ranges_.size(); ++r) {
+    if (ch >= wide_ranges_[r].first && ch <= wide_ranges_[r].second) {
+      key |= size_t{64} << r;
+    }
+  }
+  return key;
+}
@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ustring.h"
+
+// The \s of the regex engines of the HF tokenizers and tiktoken, the White_Space property, which has neither the
+// separators 0x1C-0x1F that Python counts as spaces nor the zero-width characters.
+inline bool IsRegexSpace(char32_t ch) {
+  return (ch >= 0x09 && ch <= 0x0D) || ch == 0x20 || ch == 0x85 || ch == 0xA0 || ch == 0x1680 ||
+         (ch >= 0x2000 && ch <= 0x200A) || ch == 0x2028 || ch == 0x2029 || ch == 0x202F || ch == 0x205F ||
+         ch == 0x3000;
+}
+
+// The pre-tokenizer of a regex pattern of the HF tokenizers, like the ones of Llama-3 or Qwen2, compiled into a DFA
+// over the classes of the characters when the kernel is created. The classes are the characters of the pattern and
+// the Unicode categories it can tell apart, so a character is classified by a table lookup or one category lookup,
+// and a piece is matched in one pass over its characters instead of one per alternative.
+//
+// The supported subset is the one of the pre-tokenizers: literals and escapes, [sets], ., \p{..} / \P{..} of the
+// general categories, \s \S \d \D \w \W, the groups (...), (?:...) and (?i:...) of ASCII case folding, the
+// alternation, the greedy, lazy and possessive quantifiers, ^ and $ of the text, and the lookaheads (?=c) / (?!c) of
+// one character. A match is the leftmost-first one of the regex, so the alternatives keep their order; a possessive
+// quantifier is matched as a greedy one, which is the same for the patterns whose repeated set excludes what follows.
+class PreTokenizerDfa {
+ public:
+  // Throws ORT_INVALID_ARGUMENT for a pattern out of the subset.
+  explicit PreTokenizerDfa(std::string_view pattern);
+
+  static constexpr uint16_t kEndOfText = 0xFFFF;
+
+  uint16_t Classify(char32_t ch) const {
+    if (ch < 0x80) {
+      return ascii_classes_[ch];
+    }
+    return ClassifyNonAscii(ch);
+  }
+
+  // Returns the end of the match at pos of the text, which is pos if there is none. at_start tells whether pos is
+  // the start of the text, for ^. The UTF-8 text must be well-formed.
+  template <typename CharT>
+  size_t MatchEnd(std::basic_string_view<CharT> text, size_t pos, bool at_start) const {
+    const uint32_t* transitions = transitions_.data();
+    size_t last = pos;
+    uint32_t row = start_states_[at_start ? 1 : 0];
+    for (size_t i = pos; i < text.size();) {
+      size_t len = 1;
+      uint16_t cls = 0;
+      if (static_cast<std::make_unsigned_t<CharT>>(text[i]) < 0x80) {
+        cls = ascii_classes_[static_cast<size_t>(text[i])];
+      } else if constexpr (std::is_same_v<CharT, char>) {
+        cls = ClassifyNonAscii(ustring::DecodeUTF8Char(text, i, len));
+      } else {
+        cls = ClassifyNonAscii(text[i]);
+      }
+
+      const uint32_t transition = transitions[row + cls];
+      if (transition & 1) {
+        last = i;
+      }
+      row = transition >> 1;
+      if (row == kDeadState) {
+        return last;
+      }
+      i += len;
+    }
+    return (transitions[row + class_count_] & 1) ? text.size() : last;
+  }
+
+  size_t ClassCount() const { return class_count_; }
+  size_t StateCount() const { return transitions_.size() / (class_count_ + 1); }
+
+ private:
+  static constexpr uint32_t kDeadState = 0;
+
+  uint16_t ClassifyNonAscii(char32_t ch) const;
+  // (category index << 1 | space) | the bits of the wide ranges from bit 6
+  size_t KeyOf(char32_t ch) const;
+
+  friend class PreTokenizerCompiler;
+
+  uint16_t ascii_classes_[128] = {};
+  std::vector<std::pair<char32_t, uint16_t>> literal_classes_;        // the non-ASCII characters of the pattern
+  std::vector<std::pair<char32_t, char32_t>> wide_ranges_;            // the ranges which aren't in the literals
+  std::vector<uint16_t> key_classes_;  // by (category index, space, wide range bits) of the other characters
+  size_t class_count_ = 0;
+  uint32_t start_states_[2] = {};
+  // of [state][class, or the end of the text], the first index of the row of the next state << 1 | whether there
+  // is a match before the character
+  std::vector<uint32_t> transitions_;
+};
+
+// Splits a text into the pieces of the pattern, like the Split pre-tokenizer of HF with the Isolated behavior:
+// the matches are pieces, and so is the text between them. It has the interface of BasicTokenWithRegularExp, and
+// the same requirement of well-formed UTF-8 text.
+template <typename CharT>
+class BasicDfaPreTokenizer {
+ public:
+  using string_view = std::basic_string_view<CharT>;
+
+  explicit BasicDfaPreTokenizer(const PreTokenizerDfa& dfa) : dfa_(dfa) {}
+
+  void Set(string_view val) {
+    text_ = val;
+    pos_ = 0;
+  }
+
+  std::pair<bool, string_view> GetNextToken() {
+    if (pos_ >= text_.size()) {
+      return {false, {}};
+    }
+
+    // the characters before a match are a piece of their own
+    const size_t begin = pos_;
+    while (pos_ < text_.size()) {
+      const size_t end = dfa_.MatchEnd(text_, pos_, pos_ == 0);
+      if (end > pos_) {
+        if (pos_ == begin) {
+          pos_ = end;
+        }
+        break;
+      }
+      pos_ += CharLength();
+    }
+    return {true, text_.substr(begin, pos_ - begin)};
+  }
+
+ private:
+  size_t CharLength() const {
+    if constexpr (std::is_same_v<CharT, char>) {
+      size_t len = 0;
+      ustring::DecodeUTF8Char(text_, pos_, len);
+      return len;
+    } else {
+      return 1;
+    }
+  }
+
+  const PreTokenizerDfa& dfa_;
+  string_view text_;
+  size_t pos_ = 0;
+};
+
+using DfaPreTokenizer = BasicDfaPreTokenizer<char32_t>;
+using Utf8DfaPreTokenizer = BasicDfaPreTokenizer<char>;
@@ -0,0 +1,160 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "question_answering.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+
+#include "parallel_for.h"
+#include "string_utils.h"
+#include "ustring.h"
+
+void FindBestAnswers(const float* start_logits, const float* end_logits, const std::vector<bool>& is_context,
+                     size_t max_length, size_t n_best, std::vector<AnswerSpan>& answers) {
+  answers.clear();
+  auto better = [](const AnswerSpan& a, const AnswerSpan& b) { return a.score > b.score; };
+  auto add = [&](const AnswerSpan& answer) {
+    answers.insert(std::upper_bound(answers.begin(), answers.end(), answer, better), answer);
+    if (answers.size() > n_best) {
+      answers.pop_back();
+    }
+  };
+
+  // the starts of the window of an end, in which the start logits decrease, so the first is the running maximum
+  std::deque<size_t> window;
+  const size_t seq_len = is_context.size();
+  for (size_t end = 0; end < seq_len; ++end) {
+    if (!is_context[end]) {
+      continue;
+    }
+
+    while (!window.empty() && start_logits[window.back()] <= start_logits[end]) {
+      window.pop_back();
+    }
+    window.push_back(end);
+    const size_t first = end + 1 >= max_length ? end + 1 - max_length : 0;
+    while (window.front() < first) {
+      window.pop_front();
+    }
+
+    const float best = start_logits[window.front()] + end_logits[end];
+    if (answers.size() == n_best && best <= answers.back().score) {
+      continue;
+    }
+
+    if (n_best == 1) {
+      add(AnswerSpan{window.front(), end, best});
+      continue;
+    }
+
+    for (size_t start = first; start <= end; ++start) {
+      const float score = start_logits[start] + end_logits[end];
+      if (is_context[start] && (answers.size() < n_best || score > answers.back().score)) {
+        add(AnswerSpan{start, end, score});
+      }
+    }
+  }
+}
+
+KernelQuestionAnsweringSpans::KernelQuestionAnsweringSpans(const OrtApi& api, const OrtKernelInfo& info)
+    : BaseKernel(api, info) {
+  max_answer_length_ = TryToGetAttributeWithDefault<int64_t>("max_answer_length", 30);
+  n_best_ = TryToGetAttributeWithDefault<int64_t>("n_best", 1);
+  if (max_answer_length_ <= 0) {
+    ORTX_CXX_API_THROW(MakeString("[QuestionAnsweringSpans]: max_answer_length must be positive but is ",
+                                  max_answer_length_, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  if (n_best_ <= 0) {
+    ORTX_CXX_API_THROW(MakeString("[QuestionAnsweringSpans]: n_best must be positive but is ", n_best_, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+}
+
+void KernelQuestionAnsweringSpans::Compute(const ortc::Tensor<std::string_view>& context,
+                                           const ortc::Tensor<float>& start_logits,
+                                           const ortc::Tensor<float>& end_logits,
+                                           const ortc::Tensor<int64_t>& offset_mapping,
+                                           const ortc::Tensor<int64_t>& token_type_ids,
+                                           ortc::Tensor<std::string>& answers,
+                                           ortc::Tensor<float>& scores,
+                                           std::optional<ortc::Tensor<int64_t>*> spans) const {
+  auto& shape = start_logits.Shape();
+  if (shape.size() != 2 || end_logits.Shape() != shape) {
+    ORTX_CXX_API_THROW(MakeString("[QuestionAnsweringSpans]: start_logits ", shape, " and end_logits ",
+                                  end_logits.Shape(), " must be the same [batch, seq]."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  const size_t batch = static_cast<size_t>(shape[0]);
+  const size_t seq_len = static_cast<size_t>(shape[1]);
+  if (static_cast<size_t>(offset_mapping.NumberOfElement()) != batch * seq_len * 2 ||
+      static_cast<size_t>(token_type_ids.NumberOfElement()) != batch * seq_len) {
+    ORTX_CXX_API_THROW(MakeString("[QuestionAnsweringSpans]: offset_mapping ", offset_mapping.Shape(),
+                                  " and token_type_ids ", token_type_ids.Shape(),
+                                  " must be of the tokens of the logits ", shape, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  auto& texts = context.Data();
+  if (texts.size() != batch) {
+    ORTX_CXX_API_THROW(MakeString("[QuestionAnsweringSpans]: there are ", texts.size(), " contexts for a batch of ",
+                                  batch, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  const size_t n_best = static_cast<size_t>(n_best_);
+  const float* p_start = start_logits.Data();
+  const float* p_end = end_logits.Data();
+  const int64_t* p_offsets = offset_mapping.Data();
+  const int64_t* p_types = token_type_ids.Data();
+  std::vector<std::vector<AnswerSpan>> row_answers(batch);
+  const double cost = static_cast<double>(seq_len) * static_cast<double>(std::min<int64_t>(max_answer_length_, 8));
+  ParallelFor(Ort::Custom::ComputeContext::Current(), batch, cost, [&](size_t begin, size_t end) {
+    std::vector<bool> is_context(seq_len);
+    for (size_t b = begin; b < end; ++b) {
+      const int64_t* offsets = p_offsets + b * seq_len * 2;
+      for (size_t t = 0; t < seq_len; ++t) {
+        is_context[t] = p_types[b * seq_len + t] == 1 && offsets[2 * t] < offsets[2 * t + 1];
+      }
+      FindBestAnswers(p_start + b * seq_len, p_end + b * seq_len, is_context, static_cast<size_t>(max_answer_length_),
+                      n_best, row_answers[b]);
+    }
+  });
+
+  const std::vector<int64_t> dims{static_cast<int64_t>(batch), n_best_};
+  float* p_scores = scores.Allocate(dims);
+  int64_t* p_spans = spans.has_value() ? (*spans)->Allocate({dims[0], dims[1], 2}) : nullptr;
+  ortc::StringTensorBuilder answer_texts;
+  answer_texts.Reserve(batch * n_best, 0);
+  for (size_t b = 0; b < batch; ++b) {
+    const std::string_view text = texts[b];
+    const int64_t* offsets = p_offsets + b * seq_len * 2;
+    for (size_t i = 0; i < n_best; ++i) {
+      int64_t char_begin = 0;
+      int64_t char_end = 0;
+      if (i < row_answers[b].size()) {
+        const AnswerSpan& answer = row_answers[b][i];
+        char_begin = offsets[2 * answer.start];
+        char_end = std::max(offsets[2 * answer.end + 1], char_begin);
+        *p_scores++ = answer.score;
+        const size_t byte_begin = ustring::AdvanceUTF8Chars(text, 0, static_cast<size_t>(char_begin));
+        const size_t byte_end =
+            ustring::AdvanceUTF8Chars(text, byte_begin, static_cast<size_t>(char_end - char_begin));
+        answer_texts.Append(text.substr(byte_begin, byte_end - byte_begin));
+      } else {
+        *p_scores++ = -std::numeric_limits<float>::infinity();
+        answer_texts.Append(std::string_view{});
+      }
+
+      if (p_spans != nullptr) {
+        *p_spans++ = char_begin;
+        *p_spans++ = char_end;
+      }
+    }
+  }
+
+  answers.SetStringOutput(answer_texts, dims);
+}
@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ocos.h"
+
+// An answer of a row, the tokens [start, end] of the context, and the sum of their start and end logits.
+struct AnswerSpan {
+  size_t start;
+  size_t end;
+  float score;
+};
+
+// Finds the n_best answers of a row, in descending order of their score, of which the tokens are in the context:
+// is_context[t] is false for the tokens of the question, the special tokens and the padding. An answer has at most
+// max_length tokens, and the windows of the starts of each end are scanned only when their running maximum could
+// make one of the answers, so it's O(seq * max_length) at worst and close to O(seq) for a few answers.
+void FindBestAnswers(const float* start_logits, const float* end_logits, const std::vector<bool>& is_context,
+                     size_t max_length, size_t n_best, std::vector<AnswerSpan>& answers);
+
+// Extracts the answers of an extractive QA model like BERT, from its start and end logits, [batch, seq], and the
+// offset mapping, [batch, seq, 2], and the token type ids, [batch, seq], of HfBertTokenizer, with which the tokens
+// of type 1 and some characters are the context. The answers are the slices of the context text, [batch], as
+// strings [batch, n_best], with their scores, [batch, n_best], and their characters, [batch, n_best, 2]. The rows
+// with fewer answers are padded with empty ones, of score -inf.
+struct KernelQuestionAnsweringSpans : BaseKernel {
+  KernelQuestionAnsweringSpans(const OrtApi& api, const OrtKernelInfo& info);
+
+  void Compute(const ortc::Tensor<std::string_view>& context,
+               const ortc::Tensor<float>& start_logits,
+               const ortc::Tensor<float>& end_logits,
+               const ortc::Tensor<int64_t>& offset_mapping,
+               const ortc::Tensor<int64_t>& token_type_ids,
+               ortc::Tensor<std::string>& answers,
+               ortc::Tensor<float>& scores,
+               std::optional<ortc::Tensor<int64_t>*> spans) const;
+
+ private:
+  int64_t max_answer_length_;
+  int64_t n_best_;
+};
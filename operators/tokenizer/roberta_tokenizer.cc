@@ -5,15 +5,18 @@
 #include "roberta_tokenizer.hpp"
 #include "narrow.h"
 
-KernelRobertaBpeTokenizer::KernelRobertaBpeTokenizer(const OrtApi& api, const OrtKernelInfo& info)
+template <typename T>
+KernelRobertaBpeTokenizer<T>::KernelRobertaBpeTokenizer(const OrtApi& api, const OrtKernelInfo& info)
     : BaseKernel(api, info) {
-  std::string vocab = ort_.KernelInfoGetAttribute<std::string>(&info, "vocab");
+  CheckOutputDtype<T>(*this, "RobertaTokenizer");
+  ort_extensions::AssetBytes vocab = ort_extensions::GetAssetAttribute(*this, "vocab");
   if (vocab.empty()) {
     ORTX_CXX_API_THROW("vocabulary shouldn't be empty.", ORT_INVALID_ARGUMENT);
   }
 
-  std::string merges = ort_.KernelInfoGetAttribute<std::string>(&info, "merges");
-  if (merges.empty()) {
+  // a binary model, made by the converter, has the merges in it.
+  ort_extensions::AssetBytes merges = ort_extensions::GetAssetAttribute(*this, "merges", true);
+  if (merges.empty() && !VocabData::IsBinaryModel(vocab)) {
     ORTX_CXX_API_THROW("merges shouldn't be empty.", ORT_INVALID_ARGUMENT);
   }
 
@@ -25,17 +28,25 @@ KernelRobertaBpeTokenizer::KernelRobertaBpeTokenizer(const OrtApi& api, const Or
     ORTX_CXX_API_THROW("padding_length should be more than 0 or equal -1", ORT_INVALID_ARGUMENT);
   }
 
-  std::stringstream vocabu_stream(vocab);
-  std::stringstream merges_stream(merges);
-  bbpe_tokenizer_ = std::make_shared<VocabData>();
-  bbpe_tokenizer_->Load(vocabu_stream, merges_stream, "<unk>", "<s>\n</s>\n<pad>\n<mask>");
+  int64_t cache_capacity = TryToGetAttributeWithDefault<int64_t>("cache_capacity", kDefaultBpeCacheCapacity);
+  if (cache_capacity < 0) {
+    ORTX_CXX_API_THROW("cache_capacity shouldn't be negative", ORT_INVALID_ARGUMENT);
+  }
+  bpe_cache_.SetCapacity(static_cast<size_t>(cache_capacity));
+  bpe_cache_.SetStatsName("bpe_cache");
+
+  bbpe_tokenizer_.Start([vocab = std::move(vocab), merges = std::move(merges)]() {
+    return LoadSharedVocabData(vocab, merges, "<unk>", "<s>\n</s>\n<pad>\n<mask>");
+  });
 }
 
-std::vector<int64_t> KernelRobertaBpeTokenizer::Tokenize(ustring& input, int64_t max_length,
-                                                         bool compute_offset_mapping,
-                                                         std::list<OffsetMappingType>& offset_map) const {
+template <typename T>
+std::vector<int64_t> KernelRobertaBpeTokenizer<T>::Tokenize(ustring& input, int64_t max_length,
+                                                            bool compute_offset_mapping,
+                                                            std::list<OffsetMappingType>& offset_map) const {
+  ScratchScope scratch;
   std::vector<int64_t> res;
-  std::list<std::pair<int, int>> byte_list;
+  std::vector<std::pair<int, int>> byte_list;
 
   if (IsEmptyUString(input)) {
     return res;
@@ -55,10 +66,8 @@ std::vector<int64_t> KernelRobertaBpeTokenizer::Tokenize(ustring& input, int64_t
       continue;
     }
 
-    auto cur_input = std::move(seg_id.first);
-    // Note: keep ptr to make sure the string_view is valid in the following process
-    const char32_t* ptr = cur_input.c_str();
-    regcmp.Set(ptr);
+    // the segment is a view of the input, which outlives the following process
+    regcmp.Set(seg_id.first);
 
     size_t offset = 0;
     OffsetMappingType offset_mapping;
@@ -83,14 +92,17 @@ std::vector<int64_t> KernelRobertaBpeTokenizer::Tokenize(ustring& input, int64_t
         }
       }
 
-      // Get byte encodings prior to performing BPE
-      byte_list.clear();
-      for (char& cp : utf8_token) {
-        byte_list.emplace_back(std::make_pair(bbpe_tokenizer_->ByteEncoder()[static_cast<unsigned char>(cp)], 1));
-      }
+      if (int id = bbpe_tokenizer_->FindWholeWord(utf8_token); id >= 0) {
+        byte_list.assign(1, std::make_pair(id, static_cast<int>(utf8_token.size())));
+      } else if (!bpe_cache_.Lookup(utf8_token, byte_list)) {
+        // Get byte encodings prior to performing BPE
+        byte_list.clear();
+        bbpe_tokenizer_->AppendByteSymbols(utf8_token, byte_list);
 
-      // Perform BPE
-      bbpe_tokenizer_->bpe(byte_list);
+        // Perform BPE
+        bbpe_tokenizer_->bpe(byte_list);
+        bpe_cache_.Insert(utf8_token, byte_list);
+      }
 
       // Add output to result
       for (auto p : byte_list) {
@@ -119,12 +131,92 @@ std::vector<int64_t> KernelRobertaBpeTokenizer::Tokenize(ustring& input, int64_t
   return res;
 }
 
-void KernelRobertaBpeTokenizer::Compute(const ortc::Tensor<std::string>& input,
-                                        ortc::Tensor<int64_t>& tokenize_output,
-                                        std::optional<ortc::Tensor<int64_t>*> attention_mask,
-                                        std::optional<ortc::Tensor<int64_t>*> offset_mapping) const {
+template <typename T>
+std::vector<int64_t> KernelRobertaBpeTokenizer<T>::TokenizeSequence(std::string_view text, int64_t max_length) const {
+  // Tokenize puts the ids between the BOS and EOS tokens, and counts the BOS in its max_length
+  const int64_t bos_max_length = max_length == INT64_MAX ? INT64_MAX : max_length + 1;
+  std::list<OffsetMappingType> offset_map;
+  std::vector<int64_t> res = TokenizeByPrefixes(
+      *bbpe_tokenizer_, text, bos_max_length, bos_max_length == INT64_MAX ? INT64_MAX : bos_max_length + 1,
+      [&](std::string_view prefix) {
+        offset_map.clear();
+        ustring ustr(prefix);
+        return Tokenize(ustr, bos_max_length, false, offset_map);
+      });
+  if (!res.empty()) {
+    res.pop_back();
+    res.erase(res.begin());
+  }
+  return res;
+}
+
+template <typename T>
+void KernelRobertaBpeTokenizer<T>::ComputePairs(const ortc::Tensor<std::string_view>& input,
+                                                const std::vector<std::string_view>& pair_input,
+                                                ortc::Tensor<T>& tokenize_output,
+                                                std::optional<ortc::Tensor<T>*> attention_mask,
+                                                std::optional<ortc::Tensor<T>*> token_type_ids) const {
+  // the template of HF, <s> A </s></s> B </s>, whose type ids are all 0
+  PairTemplate pair_template;
+  const int64_t bos = bbpe_tokenizer_->GetEncoding("<s>");
+  const int64_t eos = bbpe_tokenizer_->GetEncoding("</s>");
+  pair_template.prefix = {bos};
+  pair_template.middle = {eos, eos};
+  pair_template.suffix = {eos};
+
+  auto& str_input = input.Data();
+  const auto& input_dim = input.Shape();
+  ortc::PaddedOutput<T, int64_t> tokens(tokenize_output, input_dim, padding_length_);
+  std::vector<size_t> second_begin(str_input.size());
+  // a pair is truncated across its texts, each of which is only tokenized up to the ids the pair can keep of it
+  const int64_t sequence_max_length = pair_template.MaxSequenceLength(padding_length_);
+  for (size_t i = 0; i < str_input.size(); ++i) {
+    tokens.SetRow(i, pair_template.Apply(TokenizeSequence(str_input[i], sequence_max_length),
+                                         TokenizeSequence(pair_input[i], sequence_max_length), padding_length_,
+                                         second_begin[i]));
+  }
+
+  tokens.Allocate();
+  tokens.WriteRows(0, tokens.RowCount());
+  const size_t max_length = tokens.RowLength();
+  std::vector<int64_t> output_dim = input_dim;
+  output_dim.push_back(max_length);
+  if (attention_mask.has_value()) {
+    T* mask = (*attention_mask)->Allocate(output_dim);
+    for (size_t i = 0; i < tokens.RowCount(); ++i) {
+      T* mask_row = mask + i * max_length;
+      std::fill(mask_row, mask_row + tokens.Length(i), 1);
+      std::fill(mask_row + tokens.Length(i), mask_row + max_length, 0);
+    }
+  }
+  if (token_type_ids.has_value()) {
+    T* type_ids = (*token_type_ids)->Allocate(output_dim);
+    for (size_t i = 0; i < tokens.RowCount(); ++i) {
+      pair_template.WriteTypeIds(second_begin[i], tokens.Length(i), max_length, type_ids + i * max_length);
+    }
+  }
+}
+
+template <typename T>
+void KernelRobertaBpeTokenizer<T>::Compute(const ortc::Tensor<std::string_view>& input,
+                                           std::optional<const ortc::Tensor<std::string_view>*> text_pair,
+                                           ortc::Tensor<T>& tokenize_output,
+                                           std::optional<ortc::Tensor<T>*> attention_mask,
+                                           std::optional<ortc::Tensor<T>*> offset_mapping,
+                                           std::optional<ortc::Tensor<T>*> token_type_ids) const {
+  if (text_pair.has_value() && *text_pair != nullptr) {
+    if ((*text_pair)->Shape() != input.Shape()) {
+      ORTX_CXX_API_THROW("[RobertaTokenizer]: the text_pair should have the shape of the input.", ORT_INVALID_ARGUMENT);
+    }
+    if (offset_mapping.has_value()) {
+      ORTX_CXX_API_THROW("[RobertaTokenizer]: the offset_mapping of the pairs isn't supported.", ORT_INVALID_ARGUMENT);
+    }
+    ComputePairs(input, (*text_pair)->Data(), tokenize_output, attention_mask, token_type_ids);
+    return;
+  }
+
   // Setup inputs
-  std::vector<std::string> str_input{input.Data()};
+  auto& str_input = input.Data();
   std::list<OffsetMappingType> offset_map;
   const auto& input_dim = input.Shape();
 
@@ -136,10 +228,19 @@ void KernelRobertaBpeTokenizer::Compute(const ortc::Tensor<std::string>& input,
     compute_offset_mapping = true;
   }
 
+  const int64_t row_max_length = padding_length_ < 0 ? INT64_MAX : padding_length_;
   for (auto& str : str_input) {
-    ustring ustr = ustring(str);
-    tokenize_results.emplace_back(Tokenize(ustr, padding_length_ < 0 ? INT64_MAX : padding_length_,
-                                           compute_offset_mapping, offset_map));
+    // only the prefix of a long text which gives its max_length ids is converted and tokenized, the truncated
+    // ids are max_length + 1 with the </s>.
+    std::list<OffsetMappingType> row_offset_map;
+    tokenize_results.emplace_back(TokenizeByPrefixes(
+        *bbpe_tokenizer_, std::string_view(str), row_max_length,
+        row_max_length == INT64_MAX ? INT64_MAX : row_max_length + 1, [&](std::string_view text) {
+          row_offset_map.clear();
+          ustring ustr(text);
+          return Tokenize(ustr, row_max_length, compute_offset_mapping, row_offset_map);
+        }));
+    offset_map.splice(offset_map.end(), row_offset_map);
   }
 
   size_t max_length = 0;
@@ -158,6 +259,10 @@ void KernelRobertaBpeTokenizer::Compute(const ortc::Tensor<std::string>& input,
   offset_dim.push_back(2);  // tuple of offsets for each input id
 
   auto* token = tokenize_output.Allocate(output_dim);
+  if (token_type_ids.has_value()) {
+    auto* type_ids = (*token_type_ids)->Allocate(output_dim);
+    std::fill(type_ids, type_ids + tokenize_results.size() * max_length, 0);
+  }
   if (attention_mask.has_value()) {
     auto* mask = (*attention_mask)->Allocate(output_dim);
     int idx = 0;
@@ -198,3 +303,21 @@ void KernelRobertaBpeTokenizer::Compute(const ortc::Tensor<std::string>& input,
     }
   }
 }
+
+template <typename T>
+void KernelRobertaBpeTokenizer<T>::InferOutputShape(const ortc::ShapeInferContext& ctx) {
+  // the rows of the input are padded to padding_length, or else to the longest one
+  const ONNXTensorElementDataType type = GetOutputDtype(ctx);
+  const int64_t padding_length = ctx.GetAttributeInt("padding_length", -1);
+  std::vector<int64_t> output_dims = ctx.InputShape(0);
+  output_dims.push_back(padding_length > 0 ? padding_length : -1);
+  std::vector<int64_t> offset_dims = output_dims;
+  offset_dims.push_back(2);
+  ctx.SetOutput(0, type, output_dims);
+  ctx.SetOptionalOutput(1, type, output_dims);
+  ctx.SetOptionalOutput(2, type, offset_dims);
+  ctx.SetOptionalOutput(3, type, output_dims);
+}
+
+template struct KernelRobertaBpeTokenizer<int64_t>;
+template struct KernelRobertaBpeTokenizer<int32_t>;
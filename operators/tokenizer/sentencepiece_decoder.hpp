@@ -6,20 +6,25 @@
 #include "ocos.h"
 #include "string_utils.h"
 #include "string_tensor.h"
+#include "parallel_for.h"
 #include "sentencepiece_processor.h"
 #include "sentencepiece_model.pb.h"
+#include "sentencepiece_tokenizer.hpp"
+#include "shared_registry.h"
 
 struct KernelSentencepieceDecoder : BaseKernel {
   KernelSentencepieceDecoder(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
-    std::string model_blob = ort_.KernelInfoGetAttribute<std::string>(&info, "model");
-    sentencepiece::ModelProto model_proto;
-    model_proto.ParseFromArray(model_blob.data(), static_cast<int>(model_blob.size()));
-    sentencepiece::util::Status status = tokenizer_.Load(model_proto);
-    if (!status.ok()) {
-      ORTX_CXX_API_THROW(MakeString("Failed to create SentencePieceProcessor instance. Error code is ",
-                                    (int)status.code(), ". Message is '", status.error_message(), "'."),
-                         ORT_INVALID_PROTOBUF);
-    }
+    ort_extensions::AssetBytes model_blob = ort_extensions::GetAssetAttribute(*this, "model");
+    state_.Start([model_blob = std::move(model_blob)]() {
+      return SharedRegistry<State>::Instance().GetOrLoad({model_blob}, [&]() {
+        auto state = std::make_shared<State>();
+        state->tokenizer = LoadSharedSentencePieceProcessor(model_blob, ORT_INVALID_PROTOBUF);
+        state->BuildPieceTable(model_blob);
+        return state;
+      });
+    });
+
+    num_threads_ = ReadNumThreadsAttribute(*this);
   }
 
   void Compute(const ortc::Tensor<int64_t>& ids,
@@ -27,25 +32,131 @@ struct KernelSentencepieceDecoder : BaseKernel {
     const int64_t* p_ids = ids.Data();
     auto& ids_dim = ids.Shape();
 
-    if (!((ids_dim.size() == 1) || (ids_dim.size() == 2 && ids_dim[0] == 1))) {
-      ORTX_CXX_API_THROW("[SentencePieceDecoder]: Expect ids dimension [n] or [1,n].", ORT_INVALID_GRAPH);
+    if (ids_dim.empty()) {
+      ORTX_CXX_API_THROW("[SentencePieceDecoder]: Expect ids dimension [n] or [batch,n].", ORT_INVALID_GRAPH);
     }
 
-    std::string decoded_string;
+    // every string is decoded from a row of the last dimension, and [n] is one row.
     std::vector<int64_t> output_dim = {1};
-    std::vector<int> tids;
-    std::transform(p_ids, p_ids + ids.NumberOfElement(),
-                   std::back_inserter(tids),
-                   [](auto _id) { return static_cast<int>(_id); });
-    auto status = tokenizer_.Decode(tids, &decoded_string);
-    if (!status.ok()) {
-      ORTX_CXX_API_THROW("[SentencePieceDecoder] model decoding failed.", ORT_RUNTIME_EXCEPTION);
+    if (ids_dim.size() > 1) {
+      output_dim.assign(ids_dim.begin(), ids_dim.end() - 1);
+    }
+    const size_t seq_len = static_cast<size_t>(ids_dim.back());
+    size_t batch = 1;
+    for (int64_t dim : output_dim) {
+      batch *= static_cast<size_t>(dim);
     }
 
-    std::vector<std::string> result = {decoded_string};
+    std::vector<std::string> result(batch);
+    const State& state = *state_;
+    ParallelFor(batch, num_threads_, [&](size_t begin, size_t end) {
+      for (size_t n = begin; n < end; ++n) {
+        result[n] = state.Decode(p_ids + n * seq_len, seq_len);
+      }
+    });
     output.SetStringOutput(result, output_dim);
   }
 
  private:
-  sentencepiece::SentencePieceProcessor tokenizer_;
+  // The surface of every piece, in which the whitespace marker is a space, like SentencePieceProcessor::Decode.
+  // It's only used for the models without the denormalizer and the suffix whitespaces, and the rows with
+  // the byte pieces, whose bytes have to be merged into characters, are still decoded by the processor.
+  struct Piece {
+    uint32_t offset;      // the surface in surfaces
+    uint32_t length;
+    bool leading_space;   // the surface starts with the space marker, which may be dropped at the start of the text
+    bool byte;            // a byte fallback piece
+  };
+
+  // The processor and the piece table of a model, which the kernels of the same model share.
+  struct State {
+    void BuildPieceTable(std::string_view model_blob) {
+      sentencepiece::ModelProto proto;
+      if (!proto.ParseFromArray(model_blob.data(), static_cast<int>(model_blob.size())) ||
+          !proto.denormalizer_spec().precompiled_charsmap().empty() ||
+          proto.trainer_spec().treat_whitespace_as_suffix()) {
+        return;
+      }
+      // the processor only drops the leading space for the models which add or normalize it
+      strip_leading_space = proto.normalizer_spec().add_dummy_prefix() ||
+                            proto.normalizer_spec().remove_extra_whitespaces();
+
+      constexpr std::string_view kSpaceSymbol = "\xe2\x96\x81";
+      // the surface of the unknown piece is the one of the model
+      std::string unk_surface;
+      if (tokenizer->unk_id() >= 0 && !tokenizer->Decode(std::vector<int>{tokenizer->unk_id()}, &unk_surface).ok()) {
+        return;
+      }
+
+      const int piece_size = tokenizer->GetPieceSize();
+      pieces.reserve(piece_size);
+      for (int id = 0; id < piece_size; ++id) {
+        Piece piece{static_cast<uint32_t>(surfaces.size()), 0, false, tokenizer->IsByte(id)};
+        if (tokenizer->IsControl(id) || piece.byte) {
+          // the control symbols are invisible
+        } else if (tokenizer->IsUnknown(id)) {
+          surfaces.append(unk_surface);
+        } else {
+          std::string_view str = tokenizer->IdToPiece(id);
+          piece.leading_space = str.substr(0, kSpaceSymbol.size()) == kSpaceSymbol;
+          for (size_t pos = 0; pos < str.size();) {
+            if (str.substr(pos, kSpaceSymbol.size()) == kSpaceSymbol) {
+              surfaces.push_back(' ');
+              pos += kSpaceSymbol.size();
+            } else {
+              surfaces.push_back(str[pos++]);
+            }
+          }
+        }
+        piece.length = static_cast<uint32_t>(surfaces.size()) - piece.offset;
+        pieces.push_back(piece);
+      }
+      surfaces.shrink_to_fit();
+    }
+
+    // Decodes the row from the piece table, or returns false if the processor has to decode it.
+    bool DecodeFromTable(const int64_t* ids, size_t count, std::string& text) const {
+      size_t length = 0;
+      for (size_t i = 0; i < count; ++i) {
+        if (ids[i] < 0 || static_cast<size_t>(ids[i]) >= pieces.size() || pieces[ids[i]].byte) {
+          return false;
+        }
+        length += pieces[ids[i]].length;
+      }
+
+      text.reserve(length);
+      for (size_t i = 0; i < count; ++i) {
+        const Piece& piece = pieces[ids[i]];
+        std::string_view surface(surfaces.data() + piece.offset, piece.length);
+        if (text.empty() && piece.leading_space && strip_leading_space) {
+          surface.remove_prefix(1);
+        }
+        text.append(surface);
+      }
+      return true;
+    }
+
+    std::string Decode(const int64_t* ids, size_t count) const {
+      std::string decoded_string;
+      if (DecodeFromTable(ids, count, decoded_string)) {
+        return decoded_string;
+      }
+
+      decoded_string.clear();
+      std::vector<int> tids(ids, ids + count);
+      auto status = tokenizer->Decode(tids, &decoded_string);
+      if (!status.ok()) {
+        ORTX_CXX_API_THROW("[SentencePieceDecoder] model decoding failed.", ORT_RUNTIME_EXCEPTION);
+      }
+      return decoded_string;
+    }
+
+    std::shared_ptr<const sentencepiece::SentencePieceProcessor> tokenizer;
+    std::vector<Piece> pieces;  // empty if the model can't be decoded from the table
+    std::string surfaces;
+    bool strip_leading_space = true;
+  };
+
+  BackgroundLoad<State> state_;
+  size_t num_threads_ = 1;
 };
@@ -6,74 +6,156 @@
 #include "sentencepiece_tokenizer.hpp"
 #include "string_tensor.h"
 #include "base64.h"
+#include "shared_registry.h"
+#include "parallel_for.h"
+
+std::shared_ptr<const sentencepiece::SentencePieceProcessor> LoadSharedSentencePieceProcessor(
+    std::string_view model_proto, OrtErrorCode error_code) {
+  return SharedRegistry<sentencepiece::SentencePieceProcessor>::Instance().GetOrLoad({model_proto}, [&]() {
+    sentencepiece::ModelProto proto;
+    proto.ParseFromArray(model_proto.data(), static_cast<int>(model_proto.size()));
+    auto processor = std::make_shared<sentencepiece::SentencePieceProcessor>();
+    sentencepiece::util::Status status = processor->Load(proto);
+    if (!status.ok()) {
+      ORTX_CXX_API_THROW(MakeString("Failed to create SentencePieceProcessor instance. Error code is ",
+                                    (int)status.code(), ". Message is '", status.error_message(), "'."),
+                         error_code);
+    }
+    return processor;
+  });
+}
 
 KernelSentencepieceTokenizer::KernelSentencepieceTokenizer(const OrtApi& api, const OrtKernelInfo& info)
     : BaseKernel(api, info) {
-  std::string model_as_string = ort_.KernelInfoGetAttribute<std::string>(&info, "model");
-  sentencepiece::ModelProto model_proto;
-  std::vector<uint8_t> model_as_bytes;
-  if (base64_decode(model_as_string, model_as_bytes)) {
-    model_proto.ParseFromArray(model_as_bytes.data(), static_cast<int>(model_as_bytes.size()));
-  } else {
-    model_proto.ParseFromArray(model_as_string.c_str(), static_cast<int>(model_as_string.size()));
+  ort_extensions::AssetBytes model = ort_extensions::GetAssetAttribute(*this, "model");
+  tokenizer_.Start([model = std::move(model)]() {
+    // the attribute is the ModelProto or its base64, and the file of model_path the ModelProto
+    std::vector<uint8_t> model_as_bytes;
+    if (!model.IsFile() && base64_decode(model, model_as_bytes)) {
+      return LoadSharedSentencePieceProcessor(
+          std::string_view(reinterpret_cast<const char*>(model_as_bytes.data()), model_as_bytes.size()), ORT_FAIL);
+    }
+    return LoadSharedSentencePieceProcessor(model, ORT_FAIL);
+  });
+
+  num_threads_ = ReadNumThreadsAttribute(*this);
+
+  dense_ = TryToGetAttribute<int64_t>("padding_length", padding_length_);
+  if (dense_ && padding_length_ != -1 && padding_length_ <= 0) {
+    ORTX_CXX_API_THROW("padding_length should be more than 0 or equal -1", ORT_INVALID_ARGUMENT);
+  }
+
+  padded_length_ = PaddedLength(*this);
+  if (padded_length_.IsSet() && (!dense_ || padding_length_ != -1)) {
+    ORTX_CXX_API_THROW("pad_to_multiple_of and length_buckets need the padding_length of -1", ORT_INVALID_ARGUMENT);
   }
-  sentencepiece::util::Status status = tokenizer_.Load(model_proto);
-  if (!status.ok())
-    ORTX_CXX_API_THROW(MakeString("Failed to create SentencePieceProcessor instance. Error code is ",
-                                  (int)status.code(), ". Message is '", status.error_message(), "'."),
-                       ORT_FAIL);
 }
 
 void KernelSentencepieceTokenizer::Compute(const ortc::Tensor<std::string>& input,
-                                           int64_t /*nbest_size*/,
-                                           float /*alpha*/,
+                                           int64_t nbest_size,
+                                           float alpha,
                                            bool add_bos,
                                            bool add_eos,
                                            bool add_rev,
                                            ortc::Tensor<int32_t>& output,
-                                           ortc::Tensor<int64_t>& output1) const {
-  // Update with the new API
+                                           ortc::Tensor<int64_t>& output1,
+                                           std::optional<ortc::Tensor<int64_t>*> attention_mask,
+                                           std::optional<ortc::Tensor<int64_t>*> length_order) const {
   auto& str_input = input.Data();
-  // computation
-
-  std::vector<int64_t> indices;
-  std::vector<int> content;
-  indices.reserve(str_input.size() + 1);
-  for (size_t i = 0; i < str_input.size(); ++i) {
-    std::vector<int> inloop;
-    if (!tokenizer_.Encode(str_input[i].c_str(), &inloop).ok())
-      ORTX_CXX_API_THROW(MakeString("Unable to encode string '", str_input[i], "'."), ORT_INVALID_ARGUMENT);
-    indices.push_back(content.size());
-
-    if (add_rev) {
-      if (add_eos) {
-        content.push_back(tokenizer_.eos_id());
-      }
-      content.insert(content.end(), inloop.rbegin(), inloop.rend());
-      if (add_bos) {
-        content.push_back(tokenizer_.bos_id());
-      }
-    } else {
-      if (add_bos) {
-        content.push_back(tokenizer_.bos_id());
-      }
-      content.insert(content.end(), inloop.begin(), inloop.end());
-      if (add_eos) {
-        content.push_back(tokenizer_.eos_id());
+
+  // nbest_size = {0, 1} is the deterministic segmentation, and the others sample it for the subword
+  // regularization, the same as SentencePieceProcessor::SampleEncode.
+  const bool sampling = nbest_size != 0 && nbest_size != 1;
+
+  // the rows are encoded concurrently, and each of the threads only writes the ids of its own rows.
+  std::vector<std::vector<int>> encoded(str_input.size());
+  ParallelFor(str_input.size(), num_threads_, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const char* text = str_input[i].c_str();
+      sentencepiece::util::Status status =
+          sampling ? tokenizer_->SampleEncode(text, static_cast<int>(nbest_size), alpha, &encoded[i])
+                   : tokenizer_->Encode(text, &encoded[i]);
+      if (!status.ok()) {
+        ORTX_CXX_API_THROW(MakeString("Unable to encode string '", str_input[i], "'. ", status.error_message()),
+                           ORT_INVALID_ARGUMENT);
       }
     }
+  });
+
+  const size_t extra = (add_bos ? 1 : 0) + (add_eos ? 1 : 0);
+  if (dense_ && padding_length_ > 0) {
+    // the rows are truncated to the padding length, but they keep their bos and eos
+    if (static_cast<size_t>(padding_length_) < extra) {
+      ORTX_CXX_API_THROW("padding_length is too short for the bos and the eos.", ORT_INVALID_ARGUMENT);
+    }
+    for (auto& ids : encoded) {
+      ids.resize(std::min(ids.size(), static_cast<size_t>(padding_length_) - extra));
+    }
+  }
+
+  int64_t* indices = output1.Allocate({static_cast<int64_t>(encoded.size() + 1)});
+  indices[0] = 0;
+  int64_t max_length = 0;
+  for (size_t i = 0; i < encoded.size(); ++i) {
+    int64_t length = static_cast<int64_t>(encoded[i].size() + extra);
+    indices[i + 1] = indices[i] + length;
+    max_length = std::max(max_length, length);
   }
-  indices.push_back(content.size());
 
-  // Setup output
-  std::vector<int64_t> size_content(1);
-  size_content[0] = content.size();
+  if (dense_ && padding_length_ > 0) {
+    max_length = padding_length_;
+  } else if (dense_) {
+    max_length = static_cast<int64_t>(padded_length_.Round(static_cast<size_t>(max_length)));
+  }
+  if (length_order.has_value()) {
+    WriteLengthOrder(encoded.size(), [indices](size_t i) { return indices[i + 1] - indices[i]; },
+                     (*length_order)->Allocate({static_cast<int64_t>(encoded.size())}));
+  }
+  // the dense rows start at the multiples of the padding length, instead of the ragged indices.
+  auto row_begin = [&](size_t i) { return dense_ ? static_cast<int64_t>(i) * max_length : indices[i]; };
 
-  std::vector<int64_t> size_indices(1);
-  size_indices[0] = indices.size();
+  // when reversed, the eos is the first id of the row and the bos is the last one.
+  const int first_id = add_rev ? tokenizer_->eos_id() : tokenizer_->bos_id();
+  const int last_id = add_rev ? tokenizer_->bos_id() : tokenizer_->eos_id();
+  const bool add_first = add_rev ? add_eos : add_bos;
+  const bool add_last = add_rev ? add_bos : add_eos;
+  const int pad_id = std::max(tokenizer_->pad_id(), 0);
 
-  int* ptr_content = output.Allocate(size_content);
-  memcpy(ptr_content, content.data(), content.size() * sizeof(int));
-  int64_t* ptr_indices = output1.Allocate(size_indices);
-  memcpy(ptr_indices, indices.data(), indices.size() * sizeof(int64_t));
+  int* content = nullptr;
+  int64_t* mask = nullptr;
+  if (dense_) {
+    std::vector<int64_t> output_dim{static_cast<int64_t>(encoded.size()), max_length};
+    content = output.Allocate(output_dim);
+    mask = attention_mask.has_value() ? (*attention_mask)->Allocate(output_dim) : nullptr;
+  } else {
+    if (attention_mask.has_value()) {
+      ORTX_CXX_API_THROW("attention_mask is only output with the padding_length attribute.", ORT_INVALID_ARGUMENT);
+    }
+    content = output.Allocate({indices[encoded.size()]});
+  }
+
+  ParallelFor(encoded.size(), num_threads_, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const int64_t length = indices[i + 1] - indices[i];
+      int* row = content + row_begin(i);
+      int* ids = row;
+      if (add_first) {
+        *ids++ = first_id;
+      }
+      ids = add_rev ? std::copy(encoded[i].rbegin(), encoded[i].rend(), ids)
+                    : std::copy(encoded[i].begin(), encoded[i].end(), ids);
+      if (add_last) {
+        *ids = last_id;
+      }
+
+      if (dense_) {
+        std::fill(row + length, row + max_length, pad_id);
+        if (mask != nullptr) {
+          int64_t* mask_row = mask + row_begin(i);
+          std::fill(mask_row, mask_row + length, 1);
+          std::fill(mask_row + length, mask_row + max_length, 0);
+        }
+      }
+    }
+  });
 }
@@ -5,19 +5,36 @@
 
 #include "ocos.h"
 #include "string_utils.h"
+#include "background_load.h"
+#include "asset_attribute.h"
+#include "padded_length.hpp"
 #include "sentencepiece_processor.h"
 
+#include <memory>
+
+// Loads the serialized ModelProto, or returns the processor which another kernel has loaded from the same one.
+std::shared_ptr<const sentencepiece::SentencePieceProcessor> LoadSharedSentencePieceProcessor(
+    std::string_view model_proto, OrtErrorCode error_code);
+
 struct KernelSentencepieceTokenizer : BaseKernel {
   KernelSentencepieceTokenizer(const OrtApi& api, const OrtKernelInfo& info);
+  static constexpr bool kShareableAcrossSessions = true;  // with ORTX_SHARE_KERNELS=1
   void Compute(const ortc::Tensor<std::string>& input,
-               int64_t /*nbest_size*/,
-               float /*alpha*/,
+               int64_t nbest_size,
+               float alpha,
                bool add_bos,
                bool add_eos,
                bool add_rev,
                ortc::Tensor<int32_t>& output,
-               ortc::Tensor<int64_t>& output1) const;
+               ortc::Tensor<int64_t>& output1,
+               std::optional<ortc::Tensor<int64_t>*> attention_mask,
+               std::optional<ortc::Tensor<int64_t>*> length_order) const;
 
  private:
-  sentencepiece::SentencePieceProcessor tokenizer_;
+  BackgroundLoad<sentencepiece::SentencePieceProcessor> tokenizer_;
+  size_t num_threads_{1};
+  // the output is ragged without the padding_length attribute, else -1 pads to the longest row
+  bool dense_{false};
+  int64_t padding_length_{-1};
+  PaddedLength padded_length_;  // of the rows padded to the longest one
 };
@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "tiktoken_tokenizer.hpp"
+#include "trace_scope.h"
+#include "unique_rows.h"
+
+KernelTiktokenTokenizer::KernelTiktokenTokenizer(const OrtApi& api, const OrtKernelInfo& info)
+    : BaseKernel(api, info) {
+  ort_extensions::AssetBytes vocab = ort_extensions::GetAssetAttribute(*this, "vocab");
+  if (vocab.empty()) {
+    ORTX_CXX_API_THROW("vocabulary shouldn't be empty.", ORT_INVALID_ARGUMENT);
+  }
+
+  // cl100k has a hand-written pre-tokenizer, and any other pattern, like the one of o200k, is compiled
+  std::string pattern = TryToGetAttributeWithDefault<std::string>("pattern", "cl100k");
+  if (pattern != "cl100k") {
+    pattern_ = std::make_unique<PreTokenizerDfa>(pattern);
+  }
+
+  std::string special_tokens = TryToGetAttributeWithDefault<std::string>("special_tokens", "");
+
+  padding_length_ = TryToGetAttributeWithDefault<int64_t>("padding_length", -1);
+  if (padding_length_ != -1 && padding_length_ <= 0) {
+    ORTX_CXX_API_THROW("padding_length should be more than 0 or equal -1", ORT_INVALID_ARGUMENT);
+  }
+
+  num_threads_ = ReadNumThreadsAttribute(*this);
+  dedup_ = TryToGetAttributeWithDefault<int64_t>("dedup", 0) != 0;
+
+  encoder_.Start([vocab = std::move(vocab), special_tokens = std::move(special_tokens)]() {
+    return SharedRegistry<TiktokenEncoder>::Instance().GetOrLoad({vocab, special_tokens}, [&]() {
+      auto encoder = std::make_shared<TiktokenEncoder>();
+      encoder->Load(vocab, special_tokens);
+      return encoder;
+    });
+  });
+}
+
+std::vector<int64_t> KernelTiktokenTokenizer::TokenizeText(std::string_view text, int64_t max_length) const {
+  ORTX_TRACE_SCOPE("TiktokenTokenizer.Tokenize");
+  if (ustring::ValidateUTF8(text)) {
+    return encoder_->Encode(text, max_length, pattern_.get());
+  }
+  // the ill-formed sequences are the replacement characters, as a Python str would have them
+  std::string utf8 = std::string(ustring(text));
+  return encoder_->Encode(utf8, max_length, pattern_.get());
+}
+
+void KernelTiktokenTokenizer::Compute(const ortc::Tensor<std::string_view>& input,
+                                      ortc::Tensor<int64_t>& tokenize_output,
+                                      std::optional<ortc::Tensor<int64_t>*> attention_mask) const {
+  auto& str_input = input.Data();
+  const auto& input_dim = input.Shape();
+
+  ortc::PaddedOutput<int64_t> tokens(tokenize_output, input_dim, padding_length_ < 0 ? -1 : padding_length_);
+  const int64_t row_max_length = padding_length_ < 0 ? INT64_MAX : padding_length_;
+  ort_extensions::ComputeRows(
+      str_input, dedup_, num_threads_,
+      [&](std::string_view text) { return TokenizeText(text, row_max_length); },
+      [&](size_t i, std::vector<int64_t>&& ids) { tokens.SetRow(i, std::move(ids)); });
+
+  tokens.Allocate();
+  const size_t max_length = tokens.RowLength();
+  int64_t* mask = nullptr;
+  if (attention_mask.has_value()) {
+    std::vector<int64_t> output_dim = input_dim;
+    output_dim.push_back(max_length);
+    mask = (*attention_mask)->Allocate(output_dim);
+  }
+  ParallelFor(tokens.RowCount(), num_threads_, [&](size_t begin, size_t end) {
+    ORTX_TRACE_SCOPE("TiktokenTokenizer.Pad");
+    tokens.WriteRows(begin, end);
+    for (size_t i = begin; i < end && mask != nullptr; ++i) {
+      int64_t* mask_row = mask + i * max_length;
+      std::fill(mask_row, mask_row + tokens.Length(i), 1);
+      std::fill(mask_row + tokens.Length(i), mask_row + max_length, 0);
+    }
+  });
+}
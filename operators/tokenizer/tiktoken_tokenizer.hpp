@@ -0,0 +1,339 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+#include "bpe_tokenizer.hpp"
+#include "base64.h"
+
+// The cl100k pre-tokenizer of tiktoken, the pattern
+//   '(?i:[sdmt]|ll|ve|re)|[^\r\n\p{L}\p{N}]?+\p{L}++|\p{N}{1,3}+| ?[^\s\p{L}\p{N}]++[\r\n]*+|\s++$|\s*[\r\n]|
+//   \s+(?!\S)|\s
+// matched by hand over the UTF-8 bytes, the alternatives in the same order as the regex tries them.
+class Cl100kPreTokenizer {
+ public:
+  enum : uint8_t { kLetter = 1, kNumber = 2, kSpace = 4, kNewline = 8 };
+
+  // The class of the character at pos, and its length in bytes.
+  static uint8_t Classify(std::string_view text, size_t pos, size_t& len) {
+    auto byte = static_cast<unsigned char>(text[pos]);
+    if (byte < 0x80) {
+      len = 1;
+      return AsciiClasses()[byte];
+    }
+
+    char32_t ch = ustring::DecodeUTF8Char(text, pos, len);
+    if (IsRegexSpace(ch)) {
+      return kSpace;
+    }
+    auto category = ufal::unilib::unicode::category(ch);
+    return (category & ufal::unilib::unicode::L) ? kLetter : (category & ufal::unilib::unicode::N) ? kNumber : 0;
+  }
+
+  // Returns the end of the piece which starts at pos, which is before the end of the text.
+  static size_t NextPiece(std::string_view text, size_t pos) {
+    const size_t size = text.size();
+    if (text[pos] == '\'' && pos + 1 < size) {
+      const char a = Lower(text[pos + 1]);
+      if (a == 's' || a == 'd' || a == 'm' || a == 't') {
+        return pos + 2;
+      }
+      if (text.substr(pos + 1, 2) == "\xC5\xBF") {  // U+017F, the long s, which folds to s
+        return pos + 3;
+      }
+      if (pos + 2 < size) {
+        const char b = Lower(text[pos + 2]);
+        if ((a == 'l' && b == 'l') || (a == 'v' && b == 'e') || (a == 'r' && b == 'e')) {
+          return pos + 3;
+        }
+      }
+    }
+
+    size_t len = 0;
+    const uint8_t first = Classify(text, pos, len);
+    const size_t next = pos + len;
+
+    // [^\r\n\p{L}\p{N}]?+\p{L}++
+    if (first & kLetter) {
+      return SkipWhile(text, next, kLetter);
+    }
+    if (!(first & (kNumber | kNewline)) && next < size && (Class(text, next) & kLetter)) {
+      return SkipWhile(text, next, kLetter);
+    }
+
+    // \p{N}{1,3}+
+    if (first & kNumber) {
+      size_t end = next;
+      for (int count = 1; count < 3 && end < size && (Classify(text, end, len) & kNumber); ++count) {
+        end += len;
+      }
+      return end;
+    }
+
+    // ' ?[^\s\p{L}\p{N}]++[\r\n]*+'
+    size_t other = text[pos] == ' ' ? next : pos;
+    if (other < size && IsOther(Class(text, other))) {
+      size_t end = other;
+      while (end < size && IsOther(Classify(text, end, len))) {
+        end += len;
+      }
+      while (end < size && (text[end] == '\r' || text[end] == '\n')) {
+        ++end;
+      }
+      return end;
+    }
+
+    // the rest is the whitespace run from pos, which ends at the text or at the start of the next piece.
+    size_t last_newline = SIZE_MAX;  // the start of the last \r or \n of the run
+    size_t last_start = pos;         // the start of the last character of the run
+    size_t end = pos;
+    while (end < size) {
+      const uint8_t c = Classify(text, end, len);
+      if (!(c & kSpace)) {
+        break;
+      }
+      if (c & kNewline) {
+        last_newline = end;
+      }
+      last_start = end;
+      end += len;
+    }
+
+    if (end == size) {  // \s++$
+      return end;
+    }
+    if (last_newline != SIZE_MAX) {  // \s*[\r\n]
+      return last_newline + 1;
+    }
+    if (last_start > pos) {  // \s+(?!\S), which leaves the last space for the piece after it
+      return last_start;
+    }
+    return end;  // \s
+  }
+
+ private:
+  static const std::array<uint8_t, 128>& AsciiClasses() {
+    static const std::array<uint8_t, 128> classes = []() {
+      std::array<uint8_t, 128> table{};
+      for (int ch = 0; ch < 128; ++ch) {
+        table[ch] = std::isalpha(ch) ? kLetter : std::isdigit(ch) ? kNumber : 0;
+      }
+      for (int ch : {'\t', '\v', '\f', ' '}) {
+        table[ch] = kSpace;
+      }
+      table['\r'] = table['\n'] = kSpace | kNewline;
+      return table;
+    }();
+    return classes;
+  }
+
+  static uint8_t Class(std::string_view text, size_t pos) {
+    size_t len = 0;
+    return Classify(text, pos, len);
+  }
+
+  static bool IsOther(uint8_t c) { return (c & (kLetter | kNumber | kSpace)) == 0; }
+
+  static char Lower(char ch) { return ch >= 'A' && ch <= 'Z' ? static_cast<char>(ch - 'A' + 'a') : ch; }
+
+  static size_t SkipWhile(std::string_view text, size_t pos, uint8_t mask) {
+    size_t len = 0;
+    while (pos < text.size() && (Classify(text, pos, len) & mask)) {
+      pos += len;
+    }
+    return pos;
+  }
+};
+
+// The byte-level BPE of tiktoken, whose merges are given by the ranks of the merged byte strings instead of the
+// merge pairs, and whose ranks are the ids. The text is split by the special tokens, then into the pieces of the
+// pre-tokenizer, and the adjacent parts of a piece whose concatenation has the lowest rank are merged until no
+// concatenation has a rank, the leftmost one of equal ranks first, as tiktoken does.
+class TiktokenEncoder {
+ public:
+  // The ranks are the lines of a .tiktoken file, "<base64 of the bytes> <rank>", and the special tokens are a JSON
+  // object of their ranks, e.g. {"<|endoftext|>": 100257}.
+  void Load(std::string_view ranks, std::string_view special_tokens) {
+    std::vector<uint8_t> bytes;
+    for (size_t begin = 0; begin < ranks.size();) {
+      size_t end = std::min(ranks.find('\n', begin), ranks.size());
+      std::string_view line = ranks.substr(begin, end - begin);
+      begin = end + 1;
+      if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+      }
+      if (line.empty()) {
+        continue;
+      }
+
+      const size_t space = line.find(' ');
+      int64_t rank = -1;
+      if (space == std::string_view::npos || !base64_decode(line.substr(0, space), bytes) ||
+          !ParseRank(line.substr(space + 1), rank)) {
+        ORTX_CXX_API_THROW(MakeString("[TiktokenTokenizer]: invalid line of the ranks: ", line), ORT_INVALID_ARGUMENT);
+      }
+      ranks_.Add(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()),
+                 static_cast<int32_t>(rank));
+    }
+
+    for (int byte = 0; byte < 256; ++byte) {
+      const char ch = static_cast<char>(byte);
+      if (!ranks_.Contains(std::string_view(&ch, 1))) {
+        ORTX_CXX_API_THROW(MakeString("[TiktokenTokenizer]: the ranks have no token of the byte ", byte),
+                           ORT_INVALID_ARGUMENT);
+      }
+    }
+
+    if (!special_tokens.empty()) {
+      auto special = nlohmann::json::parse(special_tokens, nullptr, false);
+      if (!special.is_object()) {
+        ORTX_CXX_API_THROW("[TiktokenTokenizer]: special_tokens should be a JSON object of the ranks.",
+                           ORT_INVALID_ARGUMENT);
+      }
+      for (auto it = special.begin(); it != special.end(); ++it) {
+        if (!it.value().is_number_integer() || it.value().get<int64_t>() < 0 ||
+            it.value().get<int64_t>() > INT32_MAX) {
+          ORTX_CXX_API_THROW(MakeString("[TiktokenTokenizer]: invalid rank of the special token ", it.key()),
+                             ORT_INVALID_ARGUMENT);
+        }
+        special_tokens_.Add(ustring(it.key()), it.value().get<int>());
+      }
+    }
+    special_tokens_.Build();
+    ranks_.ShrinkToFit();
+  }
+
+  // Encodes the UTF-8 text, which must be well-formed, into at most max_length ids, with the pieces of the compiled
+  // pattern if it isn't null, or else of cl100k.
+  std::vector<int64_t> Encode(std::string_view text, int64_t max_length = INT64_MAX,
+                              const PreTokenizerDfa* pattern = nullptr) const {
+    std::vector<int64_t> ids;
+    const size_t limit = max_length < 0 ? SIZE_MAX : static_cast<size_t>(max_length);
+    std::optional<Utf8DfaPreTokenizer> dfa_cmp;
+    if (pattern != nullptr) {
+      dfa_cmp.emplace(*pattern);
+    }
+    for (const auto& [segment, special_id] : special_tokens_.SplitBySpecialTokens(text)) {
+      if (ids.size() >= limit) {
+        break;
+      }
+      if (special_id != -1) {
+        ids.push_back(special_id);
+        continue;
+      }
+      if (dfa_cmp) {
+        dfa_cmp->Set(segment);
+        for (auto piece = dfa_cmp->GetNextToken(); piece.first && ids.size() < limit;
+             piece = dfa_cmp->GetNextToken()) {
+          EncodePiece(piece.second, ids);
+        }
+        continue;
+      }
+      for (size_t pos = 0; pos < segment.size() && ids.size() < limit;) {
+        const size_t end = Cl100kPreTokenizer::NextPiece(segment, pos);
+        EncodePiece(segment.substr(pos, end - pos), ids);
+        pos = end;
+      }
+    }
+
+    if (ids.size() > limit) {
+      ids.resize(limit);
+    }
+    return ids;
+  }
+
+  int32_t Rank(std::string_view bytes) const { return ranks_.Find(bytes); }
+
+ private:
+  static bool ParseRank(std::string_view text, int64_t& rank) {
+    rank = 0;
+    for (char ch : text) {
+      if (ch < '0' || ch > '9' || rank > INT32_MAX / 10) {
+        return false;
+      }
+      rank = rank * 10 + (ch - '0');
+    }
+    return !text.empty() && rank <= INT32_MAX;
+  }
+
+  void EncodePiece(std::string_view piece, std::vector<int64_t>& ids) const {
+    int32_t rank = ranks_.Find(piece);
+    if (rank != TokenVocab::kInvalidId) {
+      ids.push_back(rank);
+      return;
+    }
+
+    // the parts are a linked list over the byte positions, the start of a part is its index, and a merge keeps the
+    // left part. The pairs are in a min-heap of (rank, start), whose stale entries are skipped when they're popped.
+    const auto n = static_cast<uint32_t>(piece.size());
+    std::vector<uint32_t> next(n);
+    std::vector<uint32_t> prev(n);
+    for (uint32_t i = 0; i < n; ++i) {
+      next[i] = i + 1;
+      prev[i] = i == 0 ? UINT32_MAX : i - 1;
+    }
+
+    struct Pair {
+      int32_t rank;
+      uint32_t start;
+      uint32_t end;  // of the right part, which tells whether the pair is still the same
+      bool operator>(const Pair& rhs) const { return rank != rhs.rank ? rank > rhs.rank : start > rhs.start; }
+    };
+    std::vector<Pair> heap;
+    auto push = [&](uint32_t start) {
+      if (start == UINT32_MAX || next[start] >= n) {
+        return;
+      }
+      const uint32_t end = next[next[start]];
+      const int32_t pair_rank = ranks_.Find(piece.substr(start, end - start));
+      if (pair_rank != TokenVocab::kInvalidId) {
+        heap.push_back(Pair{pair_rank, start, end});
+        std::push_heap(heap.begin(), heap.end(), std::greater<Pair>());
+      }
+    };
+    for (uint32_t i = 0; i + 1 < n; ++i) {
+      push(i);
+    }
+
+    std::vector<bool> merged(n, false);  // the right parts which are gone
+    while (!heap.empty()) {
+      std::pop_heap(heap.begin(), heap.end(), std::greater<Pair>());
+      const Pair top = heap.back();
+      heap.pop_back();
+      if (merged[top.start] || next[top.start] >= n || next[next[top.start]] != top.end) {
+        continue;
+      }
+
+      const uint32_t right = next[top.start];
+      merged[right] = true;
+      next[top.start] = top.end;
+      if (top.end < n) {
+        prev[top.end] = top.start;
+      }
+      push(prev[top.start]);
+      push(top.start);
+    }
+
+    for (uint32_t i = 0; i < n; i = next[i]) {
+      ids.push_back(ranks_.Find(piece.substr(i, next[i] - i)));
+    }
+  }
+
+  TokenVocab ranks_;
+  SpecialTokenMap special_tokens_;
+};
+
+struct KernelTiktokenTokenizer : BaseKernel {
+  KernelTiktokenTokenizer(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               ortc::Tensor<int64_t>& tokenize_output,
+               std::optional<ortc::Tensor<int64_t>*> attention_mask) const;
+
+ private:
+  std::vector<int64_t> TokenizeText(std::string_view text, int64_t max_length) const;
+
+  int64_t padding_length_;
+  size_t num_threads_;
+  bool dedup_;  // of the rows of the same text, which are tokenized once
+  std::unique_ptr<PreTokenizerDfa> pattern_;  // null for cl100k
+  BackgroundLoad<TiktokenEncoder> encoder_;
+};
@@ -0,0 +1,169 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "token_classification.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "parallel_for.h"
+#include "string_utils.h"
+
+EntityLabels::EntityLabels(const std::vector<std::string>& names) {
+  label_types_.reserve(names.size());
+  label_begins_.reserve(names.size());
+  for (const auto& name : names) {
+    if (name.empty() || name == "O") {
+      label_types_.push_back(kOutside);
+      label_begins_.push_back(false);
+      continue;
+    }
+
+    std::string_view type = name;
+    const bool begins = type.size() > 2 && type[1] == '-' && type[0] == 'B';
+    if (type.size() > 2 && type[1] == '-' && (type[0] == 'B' || type[0] == 'I')) {
+      type.remove_prefix(2);
+    }
+
+    auto it = std::find(type_names_.begin(), type_names_.end(), type);
+    if (it == type_names_.end()) {
+      it = type_names_.emplace(type_names_.end(), type);
+    }
+
+    label_types_.push_back(static_cast<size_t>(it - type_names_.begin()));
+    label_begins_.push_back(begins);
+  }
+}
+
+void EntityLabels::DecodeSpans(const float* logits, const int64_t* offsets, size_t seq_len, float threshold,
+                               std::vector<EntitySpan>& spans) const {
+  const size_t num_labels = size();
+  bool open = false;
+  EntitySpan span{};
+  size_t token_count = 0;
+  auto close = [&]() {
+    if (open) {
+      span.score /= static_cast<float>(token_count);
+      if (span.score >= threshold) {
+        spans.push_back(span);
+      }
+      open = false;
+    }
+  };
+
+  for (size_t t = 0; t < seq_len; ++t) {
+    const float* x = logits + t * num_labels;
+    const int64_t begin = offsets[2 * t];
+    const int64_t end = offsets[2 * t + 1];
+    if (begin == end) {
+      close();
+      continue;
+    }
+
+    size_t label = 0;
+    for (size_t l = 1; l < num_labels; ++l) {
+      label = x[l] > x[label] ? l : label;
+    }
+
+    const size_t type = label_types_[label];
+    if (type == kOutside) {
+      close();
+      continue;
+    }
+
+    // the probability of the label is 1 / sum(exp(x - max))
+    float sum = 0;
+    for (size_t l = 0; l < num_labels; ++l) {
+      sum += std::exp(x[l] - x[label]);
+    }
+
+    if (open && span.type == type && !label_begins_[label]) {
+      span.end = end;
+      span.score += 1.0f / sum;
+      ++token_count;
+      continue;
+    }
+
+    close();
+    open = true;
+    span = EntitySpan{begin, end, type, 1.0f / sum};
+    token_count = 1;
+  }
+
+  close();
+}
+
+KernelTokenClassificationSpans::KernelTokenClassificationSpans(const OrtApi& api, const OrtKernelInfo& info)
+    : BaseKernel(api, info) {
+  std::string labels = ort_.KernelInfoGetAttribute<std::string>(&info, "labels");
+  std::vector<std::string> names;
+  for (const auto& line : SplitString(labels, "\r\n", true)) {
+    names.emplace_back(line);
+  }
+
+  if (names.empty()) {
+    ORTX_CXX_API_THROW("[TokenClassificationSpans]: the labels attribute has no label.", ORT_INVALID_ARGUMENT);
+  }
+
+  labels_ = std::make_unique<EntityLabels>(names);
+  threshold_ = TryToGetAttributeWithDefault<float>("threshold", 0.0f);
+}
+
+void KernelTokenClassificationSpans::Compute(const ortc::Tensor<float>& logits,
+                                             const ortc::Tensor<int64_t>& offset_mapping,
+                                             ortc::Tensor<int64_t>& spans,
+                                             ortc::Tensor<std::string>& types,
+                                             ortc::Tensor<float>& scores) const {
+  auto& shape = logits.Shape();
+  if (shape.size() != 2 && shape.size() != 3) {
+    ORTX_CXX_API_THROW(MakeString("[TokenClassificationSpans]: logits must be [batch, seq, labels] or "
+                                  "[seq, labels] but is ", shape, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  const size_t batch = shape.size() == 3 ? static_cast<size_t>(shape[0]) : 1;
+  const size_t seq_len = static_cast<size_t>(shape[shape.size() - 2]);
+  const size_t num_labels = static_cast<size_t>(shape.back());
+  if (num_labels != labels_->size()) {
+    ORTX_CXX_API_THROW(MakeString("[TokenClassificationSpans]: logits have ", num_labels, " labels but there are ",
+                                  labels_->size(), " in the labels attribute."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  if (static_cast<size_t>(offset_mapping.NumberOfElement()) != batch * seq_len * 2) {
+    ORTX_CXX_API_THROW(MakeString("[TokenClassificationSpans]: offset_mapping ", offset_mapping.Shape(),
+                                  " must be the [begin, end] of each token of the logits ", shape, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+
+  const float* p_logits = logits.Data();
+  const int64_t* p_offsets = offset_mapping.Data();
+  std::vector<std::vector<EntitySpan>> row_spans(batch);
+  ParallelFor(Ort::Custom::ComputeContext::Current(), batch, 4.0 * static_cast<double>(seq_len * num_labels),
+              [&](size_t begin, size_t end) {
+                for (size_t b = begin; b < end; ++b) {
+                  labels_->DecodeSpans(p_logits + b * seq_len * num_labels, p_offsets + b * seq_len * 2, seq_len,
+                                       threshold_, row_spans[b]);
+                }
+              });
+
+  size_t count = 0;
+  for (const auto& row : row_spans) {
+    count += row.size();
+  }
+
+  int64_t* p_spans = spans.Allocate({static_cast<int64_t>(count), 3});
+  float* p_scores = scores.Allocate({static_cast<int64_t>(count)});
+  ortc::StringTensorBuilder type_names;
+  type_names.Reserve(count, 0);
+  for (size_t b = 0; b < batch; ++b) {
+    for (const auto& span : row_spans[b]) {
+      *p_spans++ = static_cast<int64_t>(b);
+      *p_spans++ = span.begin;
+      *p_spans++ = span.end;
+      *p_scores++ = span.score;
+      type_names.Append(labels_->TypeName(span.type));
+    }
+  }
+
+  types.SetStringOutput(type_names, {static_cast<int64_t>(count)});
+}
@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ocos.h"
+
+// An entity of a row of the tokens, the characters [begin, end) of the text of the offsets of the tokens, and the
+// mean probability of the labels of its tokens.
+struct EntitySpan {
+  int64_t begin;
+  int64_t end;
+  size_t type;
+  float score;
+};
+
+// The labels of the tokens in the BIO scheme, like O, B-PER and I-PER, of which the entities are the spans of the
+// tokens of a type. A label without a prefix other than O continues a span, as I- does.
+class EntityLabels {
+ public:
+  explicit EntityLabels(const std::vector<std::string>& names);
+
+  // Appends the spans of the tokens of a row, of the logits [seq, size()] and the offsets [seq, 2], to spans. A
+  // token is labeled by the argmax of its logits, and the tokens without characters, like [CLS] and [SEP], end a
+  // span. The spans with a score under threshold are dropped.
+  void DecodeSpans(const float* logits, const int64_t* offsets, size_t seq_len, float threshold,
+                   std::vector<EntitySpan>& spans) const;
+
+  size_t size() const { return label_types_.size(); }
+  const std::string& TypeName(size_t type) const { return type_names_[type]; }
+
+ private:
+  static constexpr size_t kOutside = static_cast<size_t>(-1);
+
+  std::vector<size_t> label_types_;  // the type of each label, or kOutside
+  std::vector<bool> label_begins_;   // whether a label starts a span, a B- one
+  std::vector<std::string> type_names_;
+};
+
+// Merges the labels of the tokens of [batch, seq, labels] logits, and the offset mapping [batch, seq, 2] of
+// HfBertTokenizer, into the entities of the text: their rows and characters [batch, begin, end], their types and
+// their scores. The labels attribute is their names, one per line, in the order of the logits.
+struct KernelTokenClassificationSpans : BaseKernel {
+  KernelTokenClassificationSpans(const OrtApi& api, const OrtKernelInfo& info);
+
+  void Compute(const ortc::Tensor<float>& logits,
+               const ortc::Tensor<int64_t>& offset_mapping,
+               ortc::Tensor<int64_t>& spans,
+               ortc::Tensor<std::string>& types,
+               ortc::Tensor<float>& scores) const;
+
+ private:
+  std::unique_ptr<EntityLabels> labels_;
+  float threshold_;
+};
@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// The template of a pair of sequences of a model, like <s> A </s></s> B </s> of RoBERTa, with the longest_first
+// truncation of HF across the pair. The prefix, the first sequence and the middle have the type id 0, and the
+// second sequence and the suffix have second_type_id.
+struct PairTemplate {
+  std::vector<int64_t> prefix;
+  std::vector<int64_t> middle;
+  std::vector<int64_t> suffix;
+  int64_t second_type_id = 0;
+
+  size_t AddedCount() const { return prefix.size() + middle.size() + suffix.size(); }
+
+  // The ids the sequences of a pair of max_length ids, if it isn't negative, may have, at most.
+  int64_t MaxSequenceLength(int64_t max_length) const {
+    if (max_length < 0) {
+      return INT64_MAX;
+    }
+    return std::max<int64_t>(max_length - static_cast<int64_t>(AddedCount()), 0);
+  }
+
+  // Returns the ids of the pair truncated to max_length, if it isn't negative, and the start of the ids of the
+  // type second_type_id in second_begin. Like HF, the longer sequence loses its last id first, and the second one
+  // does on a tie.
+  std::vector<int64_t> Apply(const std::vector<int64_t>& ids1, const std::vector<int64_t>& ids2, int64_t max_length,
+                             size_t& second_begin) const {
+    size_t length1 = ids1.size();
+    size_t length2 = ids2.size();
+    const size_t max_ids = static_cast<size_t>(MaxSequenceLength(max_length));
+    if (length1 + length2 > max_ids) {
+      const size_t longer_half = (max_ids + 1) / 2;
+      if (length1 > longer_half) {
+        length1 = length2 <= max_ids / 2 ? max_ids - length2 : longer_half;
+      }
+      length2 = max_ids - length1;
+    }
+
+    std::vector<int64_t> res;
+    res.reserve(AddedCount() + length1 + length2);
+    res.insert(res.end(), prefix.begin(), prefix.end());
+    res.insert(res.end(), ids1.begin(), ids1.begin() + length1);
+    res.insert(res.end(), middle.begin(), middle.end());
+    second_begin = res.size();
+    res.insert(res.end(), ids2.begin(), ids2.begin() + length2);
+    res.insert(res.end(), suffix.begin(), suffix.end());
+    return res;
+  }
+
+  // Writes the type ids of a row of length ids, padded with 0 to row_length.
+  template <typename T>
+  void WriteTypeIds(size_t second_begin, size_t length, size_t row_length, T* type_ids) const {
+    second_begin = std::min(second_begin, length);
+    std::fill(type_ids, type_ids + second_begin, 0);
+    std::fill(type_ids + second_begin, type_ids + length, static_cast<T>(second_type_id));
+    std::fill(type_ids + length, type_ids + row_length, 0);
+  }
+};
@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+// The sliding windows of return_overflowing_tokens in HF over the ids of a sequence: each window has `length`
+// ids, of which the first `stride` ones are the last ones of the window before it, and the last window reaches
+// the end of the sequence. An empty sequence has one empty window.
+struct TokenWindows {
+  size_t length = 0;
+  size_t stride = 0;  // less than length
+
+  size_t Count(size_t size) const {
+    return size <= length ? 1 : 1 + (size - length + Step() - 1) / Step();
+  }
+
+  size_t Begin(size_t window) const { return window * Step(); }
+  size_t End(size_t window, size_t size) const { return std::min(Begin(window) + length, size); }
+
+ private:
+  size_t Step() const { return length - stride; }
+};
@@ -0,0 +1,262 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ortx_tokenizer.h"
+#include "ocos.h"
+#include "asset_attribute.h"
+
+#ifdef ENABLE_GPT2_TOKENIZER
+#include "bpe_tokenizer.hpp"
+#endif
+
+#ifdef ENABLE_BERT_TOKENIZER
+#include "bert_tokenizer.hpp"
+#include "bert_tokenizer_decoder.hpp"
+#endif
+
+#ifdef ENABLE_TRIE_TOKENIZER
+#include "string_utils.h"
+#include "trie_tokenizer.hpp"
+#endif
+
+using ort_extensions::AssetBytes;
+
+// The tokenizers of the C API, which encode and decode one text, the same as a row of their ops.
+struct OrtxTokenizer {
+  virtual ~OrtxTokenizer() = default;
+  virtual void Encode(std::string_view text, std::vector<int64_t>& ids) const = 0;
+  virtual void Decode(const int64_t* ids, size_t count, std::string& text) const = 0;
+};
+
+namespace {
+
+thread_local std::string last_error_message;
+
+#ifdef ENABLE_GPT2_TOKENIZER
+class Gpt2ApiTokenizer : public OrtxTokenizer {
+ public:
+  Gpt2ApiTokenizer(const AssetBytes& vocab, const AssetBytes& merges) {
+    if (vocab.empty()) {
+      ORTX_CXX_API_THROW("vocabulary shouldn't be empty.", ORT_INVALID_ARGUMENT);
+    }
+    if (merges.empty() && !VocabData::IsBinaryModel(vocab)) {
+      ORTX_CXX_API_THROW("merges shouldn't be empty.", ORT_INVALID_ARGUMENT);
+    }
+
+    vocab_ = LoadSharedVocabData(vocab, merges, "<|endoftext|>", "<|endoftext|>");
+    cache_.SetCapacity(kDefaultBpeCacheCapacity);
+    cache_.SetStatsName("bpe_cache");
+    // the prompts of a chat start with the same system prompt and template, whose ids are cached
+    prefix_cache_.SetCapacity(kDefaultBpePrefixCacheCapacity);
+    prefix_cache_.SetStatsName("bpe_prefix_cache");
+  }
+
+  void Encode(std::string_view text, std::vector<int64_t>& ids) const override {
+    if (ustring::ValidateUTF8(text)) {
+      ids = Gpt2BpeTokenize(Vocab(), cache_, text, INT64_MAX, nullptr, &prefix_cache_);
+    } else {
+      ustring utext(text);
+      ids = Gpt2BpeTokenize(Vocab(), cache_, std::u32string_view(utext), INT64_MAX, nullptr, &prefix_cache_);
+    }
+  }
+
+  void Decode(const int64_t* ids, size_t count, std::string& text) const override {
+    const VocabData& vocab = Vocab();
+    for (size_t i = 0; i < count; ++i) {
+      // the ids of the caller aren't narrowed, so an id out of the vocab fails instead of decoding another token
+      AppendBpeTokenBytes(vocab.IdToToken(ids[i]), text);
+    }
+  }
+
+ private:
+  // the copy of the NUMA node of the thread with ORTX_NUMA_REPLICAS=1
+  const VocabData& Vocab() const {
+    return ort_extensions::NumaTopology::ReplicasEnabled() ? *replicas_.Get(vocab_) : *vocab_;
+  }
+
+  std::shared_ptr<const VocabData> vocab_;
+  ort_extensions::NumaReplicas<VocabData> replicas_;
+  mutable BpeCache cache_;
+  mutable BpePrefixCache prefix_cache_;
+};
+#endif  // ENABLE_GPT2_TOKENIZER
+
+#ifdef ENABLE_BERT_TOKENIZER
+class BertApiTokenizer : public OrtxTokenizer {
+ public:
+  explicit BertApiTokenizer(const AssetBytes& vocab)
+      : tokenizer_(std::make_unique<BertTokenizer>(vocab, true, true, ustring("[UNK]"), ustring("[SEP]"),
+                                                   ustring("[PAD]"), ustring("[CLS]"), ustring("[MASK]"), true,
+                                                   false, ustring("##"), -1, "longest_first")),
+        decoder_(std::make_unique<BertTokenizerDecoder>(std::string(vocab.View()), "[UNK]", "[SEP]", "[PAD]",
+                                                        "[CLS]", "[MASK]", "##")) {}
+
+  void Encode(std::string_view text, std::vector<int64_t>& ids) const override {
+    std::vector<int64_t> encoded = tokenizer_->Encode(text, nullptr, tokenizer_->MaxEncodedLength());
+    tokenizer_->Truncate(encoded);
+    ids = tokenizer_->AddSpecialToken(encoded);
+  }
+
+  void Decode(const int64_t* ids, size_t count, std::string& text) const override {
+    text = decoder_->Decode(ids, count, false, true);
+  }
+
+ private:
+  std::unique_ptr<BertTokenizer> tokenizer_;
+  std::unique_ptr<BertTokenizerDecoder> decoder_;
+};
+#endif  // ENABLE_BERT_TOKENIZER
+
+#ifdef ENABLE_TRIE_TOKENIZER
+class TrieApiTokenizer : public OrtxTokenizer {
+ public:
+  explicit TrieApiTokenizer(const AssetBytes& vocab) : tokenizer_(vocab) {}
+
+  void Encode(std::string_view text, std::vector<int64_t>& ids) const override {
+    ids.clear();
+    tokenizer_.encodeBytes(text, ids);
+  }
+
+  void Decode(const int64_t* ids, size_t count, std::string& text) const override {
+    text = tokenizer_.decodeBytes(ids, count);
+  }
+
+ private:
+  TrieTokenizer tokenizer_;
+};
+#endif  // ENABLE_TRIE_TOKENIZER
+
+std::unique_ptr<OrtxTokenizer> CreateTokenizer(std::string_view kind, const AssetBytes& vocab,
+                                               const AssetBytes& merges) {
+#ifdef ENABLE_GPT2_TOKENIZER
+  if (kind == "GPT2Tokenizer") {
+    return std::make_unique<Gpt2ApiTokenizer>(vocab, merges);
+  }
+#endif
+#ifdef ENABLE_BERT_TOKENIZER
+  if (kind == "BertTokenizer") {
+    return std::make_unique<BertApiTokenizer>(vocab);
+  }
+#endif
+#ifdef ENABLE_TRIE_TOKENIZER
+  if (kind == "TrieTokenizer") {
+    return std::make_unique<TrieApiTokenizer>(vocab);
+  }
+#endif
+  ORTX_CXX_API_THROW(MakeString("The tokenizer ", kind, " isn't in this build of the library."),
+                     ORT_NOT_IMPLEMENTED);
+}
+
+// Runs the body of an entry point, and turns its exception into the error code and the message of the thread.
+template <typename Fn>
+int CallApi(Fn&& fn) {
+  last_error_message.clear();
+  int code = static_cast<int>(ORT_OK);
+  OCOS_TRY {
+    fn();
+  }
+  OCOS_CATCH(const OrtW::Exception& ex) {
+    OCOS_HANDLE_EXCEPTION([&]() {
+      last_error_message = ex.what();
+      code = static_cast<int>(ex.GetOrtErrorCode());
+    });
+  }
+  OCOS_CATCH(const std::exception& ex) {
+    OCOS_HANDLE_EXCEPTION([&]() {
+      last_error_message = ex.what();
+      code = static_cast<int>(ORT_FAIL);
+    });
+  }
+  return code;
+}
+
+void CheckArgument(bool condition, const char* message) {
+  if (!condition) {
+    ORTX_CXX_API_THROW(message, ORT_INVALID_ARGUMENT);
+  }
+}
+
+}  // namespace
+
+extern "C" ORTX_TOKENIZER_EXPORT int OrtxCreateTokenizer(const char* kind, OrtxStringSpan vocab,
+                                                         OrtxStringSpan merges, OrtxTokenizer** tokenizer) {
+  return CallApi([&]() {
+    CheckArgument(kind != nullptr && tokenizer != nullptr, "The kind and the tokenizer shouldn't be null.");
+    CheckArgument(vocab.data != nullptr || vocab.size == 0, "The vocab is null.");
+    CheckArgument(merges.data != nullptr || merges.size == 0, "The merges are null.");
+    *tokenizer = CreateTokenizer(kind, AssetBytes(std::string(vocab.data, vocab.size)),
+                                 AssetBytes(std::string(merges.data, merges.size)))
+                     .release();
+  });
+}
+
+extern "C" ORTX_TOKENIZER_EXPORT int OrtxCreateTokenizerFromFiles(const char* kind, const char* vocab_path,
+                                                                  const char* merges_path,
+                                                                  OrtxTokenizer** tokenizer) {
+  return CallApi([&]() {
+    CheckArgument(kind != nullptr && vocab_path != nullptr && tokenizer != nullptr,
+                  "The kind, the vocab_path and the tokenizer shouldn't be null.");
+    *tokenizer = CreateTokenizer(kind, AssetBytes::FromFile(vocab_path),
+                                 merges_path != nullptr ? AssetBytes::FromFile(merges_path) : AssetBytes())
+                     .release();
+  });
+}
+
+extern "C" ORTX_TOKENIZER_EXPORT void OrtxReleaseTokenizer(OrtxTokenizer* tokenizer) {
+  delete tokenizer;
+}
+
+extern "C" ORTX_TOKENIZER_EXPORT int OrtxEncodeBatch(const OrtxTokenizer* tokenizer, const OrtxStringSpan* texts,
+                                                     size_t count, int64_t* ids, size_t ids_capacity,
+                                                     size_t* row_offsets) {
+  return CallApi([&]() {
+    CheckArgument(tokenizer != nullptr && row_offsets != nullptr, "The tokenizer and row_offsets shouldn't be null.");
+    CheckArgument(texts != nullptr || count == 0, "The texts are null.");
+
+    // the ids of the rows are only kept until they overflow the array, then only their count is
+    std::vector<int64_t> row_ids;
+    size_t total = 0;
+    row_offsets[0] = 0;
+    for (size_t i = 0; i < count; ++i) {
+      tokenizer->Encode(std::string_view(texts[i].data, texts[i].size), row_ids);
+      if (ids != nullptr && total + row_ids.size() <= ids_capacity) {
+        std::copy(row_ids.begin(), row_ids.end(), ids + total);
+      }
+      total += row_ids.size();
+      row_offsets[i + 1] = total;
+    }
+  });
+}
+
+extern "C" ORTX_TOKENIZER_EXPORT int OrtxDecodeBatch(const OrtxTokenizer* tokenizer, const int64_t* ids,
+                                                     const size_t* id_offsets, size_t count, char* text,
+                                                     size_t text_capacity, size_t* text_offsets) {
+  return CallApi([&]() {
+    CheckArgument(tokenizer != nullptr && id_offsets != nullptr && text_offsets != nullptr,
+                  "The tokenizer, id_offsets and text_offsets shouldn't be null.");
+    CheckArgument(ids != nullptr || id_offsets[count] == 0, "The ids are null.");
+
+    std::string row_text;
+    size_t total = 0;
+    text_offsets[0] = 0;
+    for (size_t i = 0; i < count; ++i) {
+      CheckArgument(id_offsets[i] <= id_offsets[i + 1], "The id_offsets should be ascending.");
+      row_text.clear();
+      tokenizer->Decode(ids + id_offsets[i], id_offsets[i + 1] - id_offsets[i], row_text);
+      if (text != nullptr && total + row_text.size() <= text_capacity) {
+        std::memcpy(text + total, row_text.data(), row_text.size());
+      }
+      total += row_text.size();
+      text_offsets[i + 1] = total;
+    }
+  });
+}
+
+extern "C" ORTX_TOKENIZER_EXPORT const char* OrtxGetLastErrorMessage(void) {
+  return last_error_message.c_str();
+}
@@ -8,6 +8,9 @@
 #include "clip_tokenizer.hpp"
 #include "roberta_tokenizer.hpp"
 #include "bpe_decoder.hpp"
+#include "tiktoken_tokenizer.hpp"
+#include "hf_tokenizer.hpp"
+#include "hf_tokenizer_chat.hpp"
 #endif
 
 #ifdef ENABLE_SPM_TOKENIZER
@@ -15,6 +18,10 @@
 #include "sentencepiece_decoder.hpp"
 #endif
 
+#ifdef ENABLE_UNIGRAM_TOKENIZER
+#include "unigram_tokenizer.hpp"
+#endif
+
 #ifdef ENABLE_WORDPIECE_TOKENIZER
 #include "wordpiece_tokenizer.hpp"
 #endif
@@ -27,6 +34,8 @@
 #include "bert_tokenizer.hpp"
 #include "basic_tokenizer.hpp"
 #include "bert_tokenizer_decoder.hpp"
+#include "token_classification.hpp"
+#include "question_answering.hpp"
 #endif
 
 #ifdef ENABLE_TRIE_TOKENIZER
@@ -36,10 +45,17 @@
 FxLoadCustomOpFactory LoadCustomOpClasses_Tokenizer = []() -> CustomOpArray& {
   static OrtOpLoader op_loader(
 #ifdef ENABLE_GPT2_TOKENIZER
-      CustomCpuStruct("GPT2Tokenizer", KernelBpeTokenizer),
-      CustomCpuStruct("CLIPTokenizer", KernelClipBpeTokenizer),
-      CustomCpuStruct("RobertaTokenizer", KernelRobertaBpeTokenizer),
+      CustomCpuStruct("GPT2Tokenizer", KernelBpeTokenizer<int64_t>),
+      CustomCpuStruct("GPT2Tokenizer", KernelBpeTokenizer<int32_t>),
+      CustomCpuStruct("CLIPTokenizer", KernelClipBpeTokenizer<int64_t>),
+      CustomCpuStruct("CLIPTokenizer", KernelClipBpeTokenizer<int32_t>),
+      CustomCpuStruct("RobertaTokenizer", KernelRobertaBpeTokenizer<int64_t>),
+      CustomCpuStruct("RobertaTokenizer", KernelRobertaBpeTokenizer<int32_t>),
+      CustomCpuStruct("TiktokenTokenizer", KernelTiktokenTokenizer),
+      CustomCpuStruct("HfTokenizer", KernelHfTokenizer),
+      CustomCpuStruct("HfChatTokenizer", KernelHfChatTokenizer),
       CustomCpuStruct("BpeDecoder", KernelBpeDecoder),
+      CustomCpuStruct("BpeStreamingDecoder", KernelBpeStreamingDecoder),
 #endif
 
 #ifdef ENABLE_SPM_TOKENIZER
@@ -47,6 +63,10 @@ FxLoadCustomOpFactory LoadCustomOpClasses_Tokenizer = []() -> CustomOpArray& {
       CustomCpuStruct("SentencepieceDecoder", KernelSentencepieceDecoder),
 #endif
 
+#ifdef ENABLE_UNIGRAM_TOKENIZER
+      CustomCpuStruct("UnigramTokenizer", KernelUnigramTokenizer),
+#endif
+
 #ifdef ENABLE_TRIE_TOKENIZER
       CustomCpuStruct("TrieTokenizer", KernelTrieTokenizer),
       CustomCpuStruct("TrieDetokenizer", KernelTrieDetokenizer),
@@ -58,9 +78,12 @@ FxLoadCustomOpFactory LoadCustomOpClasses_Tokenizer = []() -> CustomOpArray& {
 
 #ifdef ENABLE_BERT_TOKENIZER
       CustomCpuStruct("BasicTokenizer", KernelBasicTokenizer),
-      CustomCpuStruct("BertTokenizer", KernelBertTokenizer),
+      CustomCpuStruct("BertTokenizer", KernelBertTokenizer<int64_t>),
+      CustomCpuStruct("BertTokenizer", KernelBertTokenizer<int32_t>),
       CustomCpuStruct("BertTokenizerDecoder", KernelBertTokenizerDecoder),
       CustomCpuStruct("HfBertTokenizer", KernelHfBertTokenizer),
+      CustomCpuStruct("TokenClassificationSpans", KernelTokenClassificationSpans),
+      CustomCpuStruct("QuestionAnsweringSpans", KernelQuestionAnsweringSpans),
 #endif
 
 #ifdef ENABLE_BLINGFIRE
@@ -4,9 +4,11 @@
 #include "ocos.h"
 #include "narrow.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <vector>
 #include <set>
-#include <map>
 #include <string>
 #include <memory>
 #include <sstream>
@@ -14,50 +16,84 @@
 #include <optional>
 
 #include "unescape.h"
+#include "token_vocab.h"
+#include "parallel_for.h"
+#include "background_load.h"
+#include "asset_attribute.h"
 
 // This Trie Tree is C++ implementation of
 // https://github.com/BlinkDL/ChatRWKV/blob/main/rwkv_pip_package/src/rwkv/rwkv_tokenizer.py
 // Perf optimized by leveraging C++ features, but the algorithm is the same.
+// The trie is built once from all the tokens into a flat array of the nodes, in which the children of a node
+// are contiguous, so a node is 12 bytes and the child of a byte is found by a scan of the bytes of its edges.
+// The root, which every match starts from, has a direct table of its 256 children.
 class TrieTree {
  public:
   static constexpr int kMaxTokenLength_ = 128;
 
-  TrieTree(unsigned char ch = 0) : ch_(ch), to_(256) {}
-
-  void add(const std::string& key, int idx = 0,
-           std::optional<int> value = std::optional<int>()) {
-    if (idx == key.length()) {
-      if (!value) {
-        value = key[0];
+  // The keys are the bytes of the tokens, and the last one wins if a key is added more than once.
+  void Build(std::vector<std::pair<std::string_view, int>> keys) {
+    std::stable_sort(keys.begin(), keys.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    nodes_.assign(1, Node{});
+    labels_.assign(1, 0);
+    root_children_.fill(kNone);
+
+    // the nodes are laid out breadth first, each of them covering the sorted keys with its prefix.
+    struct Range {
+      size_t begin;
+      size_t end;
+      size_t depth;
+    };
+    std::vector<Range> ranges{{0, keys.size(), 0}};
+    for (size_t node = 0; node < ranges.size(); ++node) {
+      auto [begin, end, depth] = ranges[node];
+      for (; begin < end && keys[begin].first.size() == depth; ++begin) {
+        nodes_[node].value = keys[begin].second;
+      }
+      if (depth == 0) {
+        nodes_[node].value = kNone;  // the empty token never matches
       }
-      value_ = value;
-      return;
-    }
 
-    unsigned char ch = static_cast<unsigned char>(key[idx]);
-    if (to_[ch] == nullptr) {
-      to_[ch] = std::make_unique<TrieTree>(ch);
+      nodes_[node].first_child = static_cast<uint32_t>(nodes_.size());
+      while (begin < end) {
+        unsigned char ch = static_cast<unsigned char>(keys[begin].first[depth]);
+        size_t child_end = begin + 1;
+        while (child_end < end && static_cast<unsigned char>(keys[child_end].first[depth]) == ch) {
+          ++child_end;
+        }
+        if (node == 0) {
+          root_children_[ch] = static_cast<int32_t>(nodes_.size());
+        }
+        nodes_.emplace_back();
+        labels_.push_back(ch);
+        ranges.push_back(Range{begin, child_end, depth + 1});
+        begin = child_end;
+      }
+      nodes_[node].child_count = static_cast<uint32_t>(nodes_.size()) - nodes_[node].first_child;
     }
-    to_[ch]->add(key, idx + 1, value);
   }
 
-  int find_longest(const std::string& key, size_t& idx) {
-    const TrieTree* u = this;
-    unsigned char ch = key[idx];
+  // Returns the id of the longest token at idx of the key and moves idx after it, or returns 0 and keeps
+  // idx if no token matches there.
+  int find_longest(std::string_view key, size_t& idx) const {
+    if (idx >= key.length()) {
+      return 0;
+    }
 
+    int32_t node = root_children_[static_cast<unsigned char>(key[idx])];
     int tok_id = 0;
     size_t idx_end = idx;
-    while (u->to_[ch]) {
-      u = u->to_[ch].get();
+    while (node != kNone) {
       idx += 1;
-      if (u->value_) {
-        tok_id = *u->value_;
+      if (nodes_[node].value != kNone) {
+        tok_id = nodes_[node].value;
         idx_end = idx;
       }
       if (idx == key.length()) {
         break;
       }
-      ch = key[idx];
+      node = Child(node, static_cast<unsigned char>(key[idx]));
     }
 
     idx = idx_end;
@@ -65,22 +101,41 @@ class TrieTree {
   }
 
  private:
-  std::vector<std::unique_ptr<TrieTree>> to_;
-  std::optional<int> value_;
-  unsigned char ch_;
+  static constexpr int32_t kNone = -1;
+
+  struct Node {
+    uint32_t first_child = 0;  // the children in nodes_ and labels_
+    uint32_t child_count = 0;
+    int32_t value = kNone;     // the id of the token which ends at this node
+  };
+
+  int32_t Child(int32_t node, unsigned char ch) const {
+    const unsigned char* begin = labels_.data() + nodes_[node].first_child;
+    const void* it = std::memchr(begin, ch, nodes_[node].child_count);
+    return it != nullptr ? static_cast<int32_t>(static_cast<const unsigned char*>(it) - labels_.data()) : kNone;
+  }
+
+  std::vector<Node> nodes_{1};
+  std::vector<unsigned char> labels_{0};  // the byte of the edge into every node
+  std::array<int32_t, 256> root_children_{};
 };
 
 class TrieTokenizer {
  private:
-  std::map<int, std::string> idx2token;
+  TokenVocab idx2token;
   TrieTree root;
 
  public:
-  TrieTokenizer(const std::string& text_tokens) {
-    std::istringstream file(text_tokens);
+  TrieTokenizer(std::string_view text_tokens) {
     std::string line;
+    for (size_t line_begin = 0; line_begin < text_tokens.size();) {
+      size_t line_end = text_tokens.find('\n', line_begin);
+      if (line_end == std::string_view::npos) {
+        line_end = text_tokens.size();
+      }
+      line.assign(text_tokens.substr(line_begin, line_end - line_begin));
+      line_begin = line_end + 1;
 
-    while (std::getline(file, line)) {
       auto l_ws = line.find(' ');
       auto r_ws = line.rfind(' ');
       if (l_ws == std::string::npos || r_ws == std::string::npos || l_ws == r_ws) {
@@ -103,29 +158,57 @@ class TrieTokenizer {
         ORTX_CXX_API_THROW(MakeString("[TrieTokenizer] bad len in vocab line: ", line), ORT_RUNTIME_EXCEPTION);
       }
 
-      idx2token[idx] = x;
+      idx2token.Add(x, idx);
     }
+    idx2token.ShrinkToFit();
 
-    for (const auto& kv : idx2token) {
-      root.add(kv.second, 0, kv.first);
+    std::vector<std::pair<std::string_view, int>> keys;
+    keys.reserve(idx2token.size());
+    for (size_t idx = 0; idx < idx2token.IdLimit(); ++idx) {
+      if (idx2token.HasId(idx)) {
+        keys.emplace_back(idx2token.Token(idx), static_cast<int>(idx));
+      }
     }
+    root.Build(std::move(keys));
   }
 
-  std::vector<int> encodeBytes(const std::string& src) {
-    size_t idx = 0;
+  std::vector<int> encodeBytes(const std::string& src) const {
     std::vector<int> tokens;
+    encodeBytes(src, tokens);
+    return tokens;
+  }
+
+  // Appends the ids of the bytes of src to tokens.
+  template <typename Id>
+  void encodeBytes(std::string_view src, std::vector<Id>& tokens) const {
+    size_t idx = 0;
     while (idx < src.length()) {
+      size_t begin = idx;
       auto result = root.find_longest(src, idx);
-      tokens.push_back(result);
+      if (idx == begin) {
+        int byte = static_cast<unsigned char>(src[idx]);
+        ORTX_CXX_API_THROW(MakeString("[TrieTokenizer] no token for the byte ", byte, " at ", idx), ORT_INVALID_ARGUMENT);
+      }
+      tokens.push_back(static_cast<Id>(result));
     }
+  }
 
-    return tokens;
+  std::string decodeBytes(const std::vector<int>& tokens) const {
+    return decodeBytes(tokens.data(), tokens.size());
   }
 
-  std::string decodeBytes(const std::vector<int>& tokens) {
+  // The tokens are views of the vocabulary, so the string is allocated once in its exact size.
+  template <typename Id>
+  std::string decodeBytes(const Id* tokens, size_t count) const {
+    size_t length = 0;
+    for (size_t i = 0; i < count; ++i) {
+      length += idx2token.Token(tokens[i]).size();
+    }
+
     std::string result;
-    for (const auto& i : tokens) {
-      result += idx2token[i];
+    result.reserve(length);
+    for (size_t i = 0; i < count; ++i) {
+      result.append(idx2token.Token(tokens[i]));
     }
     return result;
   }
@@ -133,61 +216,52 @@ class TrieTokenizer {
 
 struct KernelTrieTokenizer : public BaseKernel {
  private:
-  std::shared_ptr<TrieTokenizer> tokenizer;
+  BackgroundLoad<TrieTokenizer> tokenizer;
+  size_t num_threads_;
 
  public:
   KernelTrieTokenizer(const OrtApi& api, const OrtKernelInfo& info)
       : BaseKernel(api, info) {
-    std::string text_tokens = ort_.KernelInfoGetAttribute<std::string>(&info, "vocab");
-    tokenizer = std::make_shared<TrieTokenizer>(text_tokens);
+    ort_extensions::AssetBytes text_tokens = ort_extensions::GetAssetAttribute(*this, "vocab");
+    tokenizer.Start([text_tokens = std::move(text_tokens)]() {
+      return std::make_shared<const TrieTokenizer>(text_tokens);
+    });
+    num_threads_ = ReadNumThreadsAttribute(*this);
   };
 
   void Compute(const ortc::Tensor<std::string>& input,
                ortc::Tensor<int64_t>& tokenize_output) const {
-    std::vector<std::string> str_input{input.Data()};
+    const auto& str_input = input.Data();
     const auto& input_dim = input.Shape();
 
-    size_t max_length = 0;
-    std::vector<std::vector<int64_t>> tokenize_results;
-    for (auto& str : str_input) {
-      auto tokens = tokenizer->encodeBytes(str);
-      std::vector<int64_t> tokens_int64(tokens.begin(), tokens.end());
-      max_length = std::max(max_length, tokens_int64.size());
-      tokenize_results.emplace_back(tokens_int64);
-    }
-
-    std::vector<int64_t> output_dim = input_dim;
-    output_dim.push_back(max_length);
-    auto* token = tokenize_output.Allocate(output_dim);
-
-    int idx = 0;
-    for (auto& res : tokenize_results) {
-      for (int64_t id : res) {
-        token[idx] = id;
-        idx++;
-      }
-
-      for (size_t i = res.size(); i < max_length; i++) {
-        token[idx] = 0;
-        idx++;
+    // the rows are tokenized concurrently, then the longest one gives the padded shape, which is written once.
+    ortc::PaddedOutput<int64_t> tokens(tokenize_output, input_dim, -1);
+    ParallelFor(str_input.size(), num_threads_, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        std::vector<int64_t> ids;
+        tokenizer->encodeBytes(str_input[i], ids);
+        tokens.SetRow(i, std::move(ids));
       }
-    }
+    });
 
-    for (auto& result : tokenize_results) {
-      result.resize(max_length, 0);
-    }
+    tokens.Allocate();
+    ParallelFor(tokens.RowCount(), num_threads_, [&](size_t begin, size_t end) { tokens.WriteRows(begin, end); });
   }
 };
 
 struct KernelTrieDetokenizer : public BaseKernel {
  private:
-  std::shared_ptr<TrieTokenizer> tokenizer;
+  BackgroundLoad<TrieTokenizer> tokenizer;
+  size_t num_threads_;
 
  public:
   KernelTrieDetokenizer(const OrtApi& api, const OrtKernelInfo& info)
       : BaseKernel(api, info) {
-    std::string text_tokens = ort_.KernelInfoGetAttribute<std::string>(&info, "vocab");
-    tokenizer = std::make_shared<TrieTokenizer>(text_tokens);
+    ort_extensions::AssetBytes text_tokens = ort_extensions::GetAssetAttribute(*this, "vocab");
+    tokenizer.Start([text_tokens = std::move(text_tokens)]() {
+      return std::make_shared<const TrieTokenizer>(text_tokens);
+    });
+    num_threads_ = ReadNumThreadsAttribute(*this);
   };
 
   void Compute(const ortc::Tensor<int64_t>& tokens, ortc::Tensor<std::string>& text) const {
@@ -199,14 +273,18 @@ struct KernelTrieDetokenizer : public BaseKernel {
       std::copy(ids_dim.begin(), ids_dim.begin() + ids_dim.size() - 1, output_dim.begin());
     }
 
-    std::vector<std::string> output(output_dim[0]);
-    for (auto n = 0; n < output_dim[0]; n++) {
-      std::vector<int> ids;
-      for (auto i = 0; i < ids_dim[1]; i++) {
-        ids.push_back(ort_extensions::narrow<int>(p_ids[n * ids_dim[1] + i]));
-      }
-      output[n] = tokenizer->decodeBytes(ids);
+    // every row is the last dimension of the ids, and a 1-D input is one row.
+    const size_t row_length = ids_dim.empty() ? 1 : static_cast<size_t>(ids_dim.back());
+    size_t row_count = 1;
+    for (int64_t dim : output_dim) {
+      row_count *= static_cast<size_t>(dim);
     }
+    std::vector<std::string> output(row_count);
+    ParallelFor(row_count, num_threads_, [&](size_t begin, size_t end) {
+      for (size_t n = begin; n < end; ++n) {
+        output[n] = tokenizer->decodeBytes(p_ids + n * row_length, row_length);
+      }
+    });
 
     text.SetStringOutput(output, output_dim);
   }
@@ -0,0 +1,374 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "unigram_tokenizer.hpp"
+#include "nlohmann/json.hpp"
+#include "shared_registry.h"
+#include "parallel_for.h"
+#include "scratch_arena.h"
+#include "trace_scope.h"
+#include "unique_rows.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+
+// U+2581, the meta symbol of SentencePiece, which stands for the spaces
+constexpr std::string_view kMetaSymbol = "\xE2\x96\x81";
+
+// SentencePiece and HF give the unknown characters the lowest score of the pieces minus this penalty.
+constexpr float kUnkPenalty = 10.0f;
+
+size_t Utf8CharLength(char lead) {
+  auto byte = static_cast<unsigned char>(lead);
+  return byte < 0xC0 ? 1 : byte < 0xE0 ? 2 : byte < 0xF0 ? 3 : byte < 0xF8 ? 4 : 1;
+}
+
+// The SAX handler of a tokenizer.json, or of its model, which only keeps the type, the vocab, the unk_id and the
+// byte_fallback of the model, so neither the rest of the file nor the vocab is built into a DOM.
+class UnigramJsonHandler : public nlohmann::json_sax<nlohmann::json> {
+ public:
+  std::string type;
+  std::vector<std::string> pieces;
+  std::vector<float> scores;
+  int64_t unk_id = -1;
+  bool byte_fallback = false;
+
+  bool null() override { return true; }
+  bool boolean(bool value) override {
+    if (InModel() && key_ == "byte_fallback") {
+      byte_fallback = value;
+    }
+    return true;
+  }
+  bool number_integer(number_integer_t value) override { return Number(static_cast<double>(value), true); }
+  bool number_unsigned(number_unsigned_t value) override { return Number(static_cast<double>(value), true); }
+  bool number_float(number_float_t value, const string_t&) override { return Number(value, false); }
+  bool string(string_t& value) override {
+    if (InEntry()) {
+      if (entry_size_++ != 0) {
+        return Fail("a vocab entry should be [piece, score]");
+      }
+      pieces.push_back(std::move(value));
+    } else if (InModel() && key_ == "type") {
+      type = std::move(value);
+    }
+    return true;
+  }
+  bool binary(binary_t&) override { return true; }
+  bool start_object(std::size_t) override { return Open(false); }
+  bool key(string_t& value) override {
+    key_.swap(value);
+    return true;
+  }
+  bool end_object() override { return Close(); }
+  bool start_array(std::size_t) override {
+    if (InEntry()) {
+      return Fail("a vocab entry should be [piece, score]");
+    }
+    const bool entry = InVocab();
+    Open(true);
+    if (entry) {
+      entry_size_ = 0;
+    }
+    return true;
+  }
+  bool end_array() override {
+    if (InEntry() && (entry_size_ != 2 || pieces.size() != scores.size())) {
+      return Fail("a vocab entry should be [piece, score]");
+    }
+    return Close();
+  }
+  bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+    return Fail(ex.what());
+  }
+
+ private:
+  struct Container {
+    std::string key;  // the key of the container in its object
+    bool array;
+  };
+
+  // the model is the root object, or the "model" object of a tokenizer.json
+  bool IsModel(size_t level) const {
+    return !stack_[level].array && (level == 0 || (level == 1 && stack_[1].key == "model"));
+  }
+  bool InModel() const { return !stack_.empty() && stack_.size() <= 2 && IsModel(stack_.size() - 1); }
+  bool InVocab() const {
+    return stack_.size() >= 2 && stack_.size() <= 3 && stack_.back().array && stack_.back().key == "vocab" &&
+           IsModel(stack_.size() - 2);
+  }
+  bool InEntry() const {
+    return stack_.size() >= 3 && stack_.size() <= 4 && stack_.back().array && stack_[stack_.size() - 2].array &&
+           stack_[stack_.size() - 2].key == "vocab" && IsModel(stack_.size() - 3);
+  }
+
+  bool Open(bool array) {
+    // an element of an array has no key
+    stack_.push_back(Container{stack_.empty() || stack_.back().array ? std::string() : key_, array});
+    key_.clear();
+    return true;
+  }
+
+  bool Close() {
+    stack_.pop_back();
+    key_.clear();
+    return true;
+  }
+
+  bool Number(double value, bool integer) {
+    if (InEntry()) {
+      if (entry_size_++ != 1) {
+        return Fail("a vocab entry should be [piece, score]");
+      }
+      scores.push_back(static_cast<float>(value));
+    } else if (InModel() && key_ == "unk_id") {
+      if (!integer || value < 0) {
+        return Fail("the unk_id should be an id");
+      }
+      unk_id = static_cast<int64_t>(value);
+    }
+    return true;
+  }
+
+  bool Fail(std::string_view what) {
+    ORTX_CXX_API_THROW(MakeString("[UnigramTokenizer]: invalid model, ", what), ORT_INVALID_ARGUMENT);
+  }
+
+  std::vector<Container> stack_;
+  std::string key_;
+  size_t entry_size_ = 0;
+};
+
+}  // namespace
+
+void UnigramModel::Load(std::string_view json) {
+  UnigramJsonHandler handler;
+  nlohmann::json::sax_parse(json.begin(), json.end(), &handler);
+  if (!handler.type.empty() && handler.type != "Unigram") {
+    ORTX_CXX_API_THROW(MakeString("[UnigramTokenizer]: the model should be of the type Unigram, not ", handler.type),
+                       ORT_INVALID_ARGUMENT);
+  }
+  if (handler.pieces.empty()) {
+    ORTX_CXX_API_THROW("[UnigramTokenizer]: the model has no vocab.", ORT_INVALID_ARGUMENT);
+  }
+  if (handler.unk_id >= static_cast<int64_t>(handler.pieces.size())) {
+    ORTX_CXX_API_THROW("[UnigramTokenizer]: the unk_id is out of the vocab.", ORT_INVALID_ARGUMENT);
+  }
+
+  // the first piece of the duplicates is the one of the trie, as in the map of HF
+  std::vector<std::pair<std::string_view, int32_t>> keys;
+  keys.reserve(handler.pieces.size());
+  for (size_t id = 0; id < handler.pieces.size(); ++id) {
+    if (!handler.pieces[id].empty()) {
+      keys.emplace_back(handler.pieces[id], static_cast<int32_t>(id));
+    }
+  }
+  std::stable_sort(keys.begin(), keys.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+  keys.erase(std::unique(keys.begin(), keys.end(), [](const auto& a, const auto& b) { return a.first == b.first; }),
+             keys.end());
+  trie_.Build(keys);
+
+  scores_ = std::move(handler.scores);
+  unk_id_ = static_cast<int32_t>(handler.unk_id);
+  unk_score_ = *std::min_element(scores_.begin(), scores_.end()) - kUnkPenalty;
+  byte_fallback_ = handler.byte_fallback;
+  if (byte_fallback_) {
+    byte_ids_.resize(256);
+    for (int byte = 0; byte < 256; ++byte) {
+      char piece[8];
+      std::snprintf(piece, sizeof(piece), "<0x%02X>", byte);
+      byte_ids_[byte] = trie_.Find(piece);
+    }
+  }
+}
+
+void UnigramModel::Encode(std::string_view text, std::vector<int64_t>& ids) const {
+  // the best path to each byte of the text, of its score, its last piece and where the piece starts
+  struct BestPath {
+    float score;
+    int32_t id;  // -1 before the byte is reached
+    uint32_t start;
+  };
+
+  ScratchScope scratch;
+  ScratchVector<BestPath> best(text.size() + 1, BestPath{0.0f, -1, 0});
+  auto relax = [&](size_t end, float score, int32_t id, size_t start) {
+    BestPath& path = best[end];
+    if (path.id < 0 || score > path.score) {
+      path = BestPath{score, id, static_cast<uint32_t>(start)};
+    }
+  };
+
+  for (size_t pos = 0; pos < text.size(); ++pos) {
+    if (pos > 0 && best[pos].id < 0) {
+      continue;  // not the end of a piece or of a character
+    }
+
+    const float score = best[pos].score;
+    const size_t char_length = std::min(Utf8CharLength(text[pos]), text.size() - pos);
+    bool has_char_piece = false;
+    trie_.CommonPrefixSearch(text.substr(pos), [&](size_t length, int32_t id) {
+      relax(pos + length, score + scores_[id], id, pos);
+      has_char_piece |= length == char_length;
+    });
+
+    if (!has_char_piece) {
+      if (unk_id_ < 0) {
+        ORTX_CXX_API_THROW("[UnigramTokenizer]: the text has a character out of the vocab, and the model has no unk_id.",
+                           ORT_RUNTIME_EXCEPTION);
+      }
+      relax(pos + char_length, score + unk_score_, unk_id_, pos);
+    }
+  }
+
+  ScratchVector<uint32_t> ends;  // the ends of the pieces of the best path, from the last one
+  for (size_t end = text.size(); end > 0; end = best[end].start) {
+    ends.push_back(static_cast<uint32_t>(end));
+  }
+
+  bool fused = false;  // whether the last id is an unk id which the next unknown character joins
+  for (auto it = ends.rbegin(); it != ends.rend(); ++it) {
+    const BestPath& path = best[*it];
+    if (path.id != unk_id_) {
+      ids.push_back(path.id);
+      fused = false;
+      continue;
+    }
+
+    if (byte_fallback_) {
+      const std::string_view bytes = text.substr(path.start, *it - path.start);
+      if (std::all_of(bytes.begin(), bytes.end(), [&](char b) { return byte_ids_[static_cast<unsigned char>(b)] >= 0; })) {
+        for (char b : bytes) {
+          ids.push_back(byte_ids_[static_cast<unsigned char>(b)]);
+        }
+        fused = false;
+        continue;
+      }
+    }
+    if (!fused) {
+      ids.push_back(unk_id_);
+    }
+    fused = true;
+  }
+}
+
+KernelUnigramTokenizer::KernelUnigramTokenizer(const OrtApi& api, const OrtKernelInfo& info)
+    : BaseKernel(api, info) {
+  ort_extensions::AssetBytes vocab = ort_extensions::GetAssetAttribute(*this, "vocab");
+  if (vocab.empty()) {
+    ORTX_CXX_API_THROW("vocabulary shouldn't be empty.", ORT_INVALID_ARGUMENT);
+  }
+
+  padding_length_ = TryToGetAttributeWithDefault<int64_t>("padding_length", -1);
+  if (padding_length_ != -1 && padding_length_ <= 0) {
+    ORTX_CXX_API_THROW("padding_length should be more than 0 or equal -1", ORT_INVALID_ARGUMENT);
+  }
+
+  add_prefix_space_ = TryToGetAttributeWithDefault<int64_t>("add_prefix_space", 1) != 0;
+  split_ = TryToGetAttributeWithDefault<int64_t>("split", 1) != 0;
+  bos_token_ = TryToGetAttributeWithDefault<std::string>("bos_token", "");
+  eos_token_ = TryToGetAttributeWithDefault<std::string>("eos_token", "");
+
+  num_threads_ = ReadNumThreadsAttribute(*this);
+  dedup_ = TryToGetAttributeWithDefault<int64_t>("dedup", 0) != 0;
+
+  model_.Start([vocab = std::move(vocab)]() {
+    return SharedRegistry<UnigramModel>::Instance().GetOrLoad({vocab}, [&]() {
+      auto model = std::make_shared<UnigramModel>();
+      model->Load(vocab);
+      return model;
+    });
+  });
+}
+
+std::vector<int64_t> KernelUnigramTokenizer::TokenizeText(std::string_view text, int64_t max_length) const {
+  ORTX_TRACE_SCOPE("UnigramTokenizer.Tokenize");
+  auto special_id = [this](const std::string& token) {
+    const int32_t id = model_->PieceToId(token);
+    if (id < 0) {
+      ORTX_CXX_API_THROW(MakeString("[UnigramTokenizer]: the token ", token, " isn't in the vocab."),
+                         ORT_INVALID_ARGUMENT);
+    }
+    return id;
+  };
+
+  // the Metaspace pre-tokenizer of HF: the spaces are the meta symbol, which starts each word
+  std::string normalized;
+  normalized.reserve(text.size() + text.size() / 2 + kMetaSymbol.size());
+  if (add_prefix_space_ && !text.empty() && text[0] != ' ' && text.substr(0, kMetaSymbol.size()) != kMetaSymbol) {
+    normalized.append(kMetaSymbol);
+  }
+  for (char ch : text) {
+    if (ch == ' ') {
+      normalized.append(kMetaSymbol);
+    } else {
+      normalized.push_back(ch);
+    }
+  }
+
+  std::vector<int64_t> ids;
+  if (!bos_token_.empty()) {
+    ids.push_back(special_id(bos_token_));
+  }
+  // the text is only encoded until its ids reach the truncation, which keeps the special tokens
+  const size_t special_count = ids.size() + (eos_token_.empty() ? 0 : 1);
+  const size_t max_ids = max_length == INT64_MAX
+                             ? SIZE_MAX
+                             : ids.size() + static_cast<size_t>(std::max<int64_t>(max_length - static_cast<int64_t>(special_count), 0));
+  for (size_t begin = 0; begin < normalized.size() && ids.size() < max_ids;) {
+    const size_t end = split_ ? std::min(normalized.find(kMetaSymbol, begin + 1), normalized.size())
+                              : normalized.size();
+    model_->Encode(std::string_view(normalized).substr(begin, end - begin), ids);
+    begin = end;
+  }
+  if (ids.size() > max_ids) {
+    ids.resize(max_ids);
+  }
+  if (!eos_token_.empty()) {
+    ids.push_back(special_id(eos_token_));
+  }
+  return ids;
+}
+
+void KernelUnigramTokenizer::InferOutputShape(const ortc::ShapeInferContext& ctx) {
+  // the rows of the input are padded to padding_length, or else to the longest one, which is unknown until then
+  const int64_t padding_length = ctx.GetAttributeInt("padding_length", -1);
+  std::vector<int64_t> output_dims = ctx.InputShape(0);
+  output_dims.push_back(padding_length > 0 ? padding_length : -1);
+  ctx.SetOutput(0, ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64, output_dims);
+  ctx.SetOptionalOutput(1, ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64, output_dims);
+}
+
+void KernelUnigramTokenizer::Compute(const ortc::Tensor<std::string_view>& input,
+                                     ortc::Tensor<int64_t>& tokenize_output,
+                                     std::optional<ortc::Tensor<int64_t>*> attention_mask) const {
+  auto& str_input = input.Data();
+  const auto& input_dim = input.Shape();
+
+  ortc::PaddedOutput<int64_t> tokens(tokenize_output, input_dim, padding_length_);
+  const int64_t row_max_length = padding_length_ < 0 ? INT64_MAX : padding_length_;
+  ort_extensions::ComputeRows(
+      str_input, dedup_, num_threads_,
+      [&](std::string_view text) { return TokenizeText(text, row_max_length); },
+      [&](size_t i, std::vector<int64_t>&& ids) { tokens.SetRow(i, std::move(ids)); });
+
+  tokens.Allocate();
+  const size_t max_length = tokens.RowLength();
+  int64_t* mask = nullptr;
+  if (attention_mask.has_value()) {
+    std::vector<int64_t> output_dim = input_dim;
+    output_dim.push_back(max_length);
+    mask = (*attention_mask)->Allocate(output_dim);
+  }
+  ParallelFor(tokens.RowCount(), num_threads_, [&](size_t begin, size_t end) {
+    ORTX_TRACE_SCOPE("UnigramTokenizer.Pad");
+    tokens.WriteRows(begin, end);
+    for (size_t i = begin; i < end && mask != nullptr; ++i) {
+      int64_t* mask_row = mask + i * max_length;
+      std::fill(mask_row, mask_row + tokens.Length(i), 1);
+      std::fill(mask_row + tokens.Length(i), mask_row + max_length, 0);
+    }
+  });
+}
@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "string_utils.h"
+#include "background_load.h"
+#include "asset_attribute.h"
+#include "double_array_trie.hpp"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// The Unigram model of a tokenizer.json of HF, like the ones of XLM-R and T5, without the ModelProto of
+// SentencePiece: the pieces are in a double-array trie, and the Viterbi search of a text runs over a flat lattice
+// of the best path to each of its bytes, in the scratch arena of the thread.
+class UnigramModel {
+ public:
+  // Loads the "model" object of a tokenizer.json, or the object itself, whose "vocab" is [[piece, score], ...].
+  void Load(std::string_view json);
+
+  // Appends the ids of the best segmentation of the text to ids. Like HF, an unknown character is the unk id, and
+  // the consecutive ones are fused, or they're the ids of their bytes, <0x..>, with byte_fallback.
+  void Encode(std::string_view text, std::vector<int64_t>& ids) const;
+
+  // The id of the piece, or -1.
+  int32_t PieceToId(std::string_view piece) const { return trie_.Find(piece); }
+  size_t PieceCount() const { return scores_.size(); }
+
+ private:
+  DoubleArrayTrie trie_;
+  std::vector<float> scores_;
+  int32_t unk_id_ = -1;
+  float unk_score_ = 0.0f;
+  bool byte_fallback_ = false;
+  std::vector<int32_t> byte_ids_;  // the ids of <0x00> to <0xFF> with byte_fallback
+};
+
+// Tokenizes the texts by the Metaspace pre-tokenizer of HF and a UnigramModel into input_ids, padded with 0, and
+// the optional attention_mask.
+struct KernelUnigramTokenizer : BaseKernel {
+  KernelUnigramTokenizer(const OrtApi& api, const OrtKernelInfo& info);
+  void Compute(const ortc::Tensor<std::string_view>& input,
+               ortc::Tensor<int64_t>& tokenize_output,
+               std::optional<ortc::Tensor<int64_t>*> attention_mask) const;
+  static void InferOutputShape(const ortc::ShapeInferContext& ctx);
+
+ private:
+  std::vector<int64_t> TokenizeText(std::string_view text, int64_t max_length) const;
+
+  int64_t padding_length_;
+  bool add_prefix_space_;
+  bool split_;
+  std::string bos_token_;
+  std::string eos_token_;
+  size_t num_threads_;
+  bool dedup_;  // of the rows of the same text, which are tokenized once
+  BackgroundLoad<UnigramModel> model_;
+};
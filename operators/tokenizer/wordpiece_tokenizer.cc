@@ -2,26 +2,26 @@
 // Licensed under the MIT License.
 
 #include "wordpiece_tokenizer.hpp"
-#include "nlohmann/json.hpp"
+#include "json_vocab.h"
+#include "asset_attribute.h"
 
 KernelWordpieceTokenizer::KernelWordpieceTokenizer(const OrtApi& api, const OrtKernelInfo& info)
     : BaseKernel(api, info) {
   // https://github.com/tensorflow/text/blob/master/docs/api_docs/python/text/WordpieceTokenizer.md
   // https://github.com/tensorflow/text/blob/master/tensorflow_text/python/ops/bert_tokenizer.py
-  std::string vocab_as_string = ort_.KernelInfoGetAttribute<std::string>(&info, "vocab");
+  ort_extensions::AssetBytes vocab_as_string = ort_extensions::GetAssetAttribute(*this, "vocab");
   std::string suffix_indicator = ort_.KernelInfoGetAttribute<std::string>(&info, "suffix_indicator");
   std::string unk = ort_.KernelInfoGetAttribute<std::string>(&info, "unknown_token");
   max_input_chars_per_word_ = TryToGetAttributeWithDefault("max_input_chars_per_word", 200);
   suffix_indicator_ = ustring(suffix_indicator);
   unk_token_ = ustring(unk);
 
-  std::unordered_map<std::string, int32_t> vocab_map;
-  auto parsed = nlohmann::json::parse(vocab_as_string);
-  parsed.get_to(vocab_map);
-
-  for (auto it = vocab_map.begin(); it != vocab_map.end(); ++it) {
-    vocab_[ustring(it->first)] = it->second;
-  }
+  // the tokens of the vocab go directly into the trie as they're parsed
+  trie_.Clear();
+  trie_.Reserve(CountJsonVocabEntries(vocab_as_string));
+  ParseJsonVocab(vocab_as_string,
+                 [this](std::string_view token, int32_t id) { trie_.Add(token, id, suffix_indicator_); });
+  trie_.Finish();
 }
 
 void KernelWordpieceTokenizer_Split(const std::u32string& /*suffix_indicator*/,
@@ -44,7 +44,7 @@ void KernelWordpieceTokenizer_Split(const std::u32string& /*suffix_indicator*/,
   }
 }
 
-void KernelWordpieceTokenizer_Tokenizer(const std::unordered_map<std::u32string, int32_t>& vocab,
+void KernelWordpieceTokenizer_Tokenizer(const WordpieceTrie& trie,
                                         const std::u32string& suffix_indicator,
                                         const ustring& unk_token,
                                         const std::vector<ustring>& texts,
@@ -55,15 +55,11 @@ void KernelWordpieceTokenizer_Tokenizer(const std::unordered_map<std::u32string,
                                         int64_t n_existing_rows,
                                         int64_t max_input_chars_per_word) {
   std::vector<std::u32string> words;
-  bool is_bad;
+  std::vector<int32_t> pieces;
   bool no_existing_rows = n_existing_rows == 0;
-  size_t start = 0, end = 0;
-  std::u32string substr;
-  int64_t cur_substr;
   tokens.clear();
   indices.clear();
   rows.clear();
-  std::u32string token;
   int64_t row_index = 0;
   std::vector<ustring>::const_iterator it;
   int64_t text_index;
@@ -87,30 +83,13 @@ void KernelWordpieceTokenizer_Tokenizer(const std::unordered_map<std::u32string,
         tokens.push_back(unk_token);
         continue;
       }
-      is_bad = false;
-      start = 0;
-      for (; start < itk->size();) {
-        end = itk->size();
-        cur_substr = -1;
-        for (; start < end;) {
-          substr = itk->substr(start, end - start);
-          if (start > 0)
-            substr = suffix_indicator + substr;
-          auto itf = vocab.find(substr);
-          if (itf != vocab.end()) {
-            token = substr;
-            cur_substr = itf->second;
-            break;
-          }
-          end -= 1;
-        }
-        if (cur_substr == -1) {
-          is_bad = true;
-          break;
-        }
-        indices.push_back(static_cast<int32_t>(cur_substr));
-        tokens.push_back(ustring(token));
-        start = end;
+
+      pieces.clear();
+      bool is_bad = !trie.Tokenize(*itk, pieces);
+      for (int32_t piece : pieces) {
+        const auto& matched = trie.GetPiece(piece);
+        indices.push_back(matched.id);
+        tokens.push_back(ustring(matched.token));
       }
       if (is_bad) {
         indices.push_back(-1);
@@ -121,7 +100,23 @@ void KernelWordpieceTokenizer_Tokenizer(const std::unordered_map<std::u32string,
   rows.push_back(indices.size());
 }
 
-void KernelWordpieceTokenizer::Compute(const ortc::Tensor<std::string>& input,
+void KernelWordpieceTokenizer_Tokenizer(const std::unordered_map<std::u32string, int32_t>& vocab,
+                                        const std::u32string& suffix_indicator,
+                                        const ustring& unk_token,
+                                        const std::vector<ustring>& texts,
+                                        std::vector<ustring>& tokens,
+                                        std::vector<int32_t>& indices,
+                                        std::vector<int64_t>& rows,
+                                        const int64_t* existing_rows,
+                                        int64_t n_existing_rows,
+                                        int64_t max_input_chars_per_word) {
+  WordpieceTrie trie;
+  trie.Build(vocab, suffix_indicator);
+  KernelWordpieceTokenizer_Tokenizer(trie, suffix_indicator, unk_token, texts, tokens, indices, rows,
+                                     existing_rows, n_existing_rows, max_input_chars_per_word);
+}
+
+void KernelWordpieceTokenizer::Compute(const ortc::Tensor<std::string_view>& input,
                                        const ortc::Tensor<int64_t>& row_indices,
                                        ortc::Tensor<std::string>& output,
                                        ortc::Tensor<int64_t>& row_lengths,
@@ -140,17 +135,22 @@ void KernelWordpieceTokenizer::Compute(const ortc::Tensor<std::string>& input,
   std::vector<int32_t> indices;
   std::vector<int64_t> row_begins;
 
-  KernelWordpieceTokenizer_Tokenizer(vocab_, suffix_indicator_, unk_token_, str_input,
+  KernelWordpieceTokenizer_Tokenizer(trie_, suffix_indicator_, unk_token_, str_input,
                                      tokens, indices, row_begins,
                                      p_row_indices, row_indices.NumberOfElement(),
                                      max_input_chars_per_word_);
 
   std::vector<int64_t> size_content{(int64_t)indices.size()};
-  // TODO: avoid copy
-  std::vector<std::string> out_content;
-  for (auto& s : tokens)
-    out_content.emplace_back(s);
-  output.SetStringOutput(out_content, size_content);
+  // the tokens are encoded straight into the strings of the output
+  std::vector<size_t> utf8_sizes(tokens.size());
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    utf8_sizes[i] = ustring::UTF8Length(tokens[i]);
+  }
+  output.SetStringOutput(size_content, utf8_sizes, [&tokens](const std::vector<char*>& out_content) {
+    for (size_t i = 0; i < tokens.size(); ++i) {
+      ustring::EncodeUTF8(tokens[i], out_content[i]);
+    }
+  });
 
   std::vector<int64_t> size_row_lengths{(int64_t)row_begins.size()};
   int64_t* ptr_row_lengths = row_lengths.Allocate(size_row_lengths);
@@ -7,12 +7,13 @@
 #include "ustring.h"
 #include "string_utils.h"
 #include "string_tensor.h"
+#include "wordpiece_trie.hpp"
 
 #include <unordered_map>
 
 struct KernelWordpieceTokenizer : BaseKernel {
   KernelWordpieceTokenizer(const OrtApi& api, const OrtKernelInfo& info);
-  void Compute(const ortc::Tensor<std::string>& input,
+  void Compute(const ortc::Tensor<std::string_view>& input,
                const ortc::Tensor<int64_t>& row_indices,
                ortc::Tensor<std::string>& output,
                ortc::Tensor<int64_t>& row_lengths,
@@ -23,13 +24,26 @@ struct KernelWordpieceTokenizer : BaseKernel {
   int64_t max_input_chars_per_word_;
   std::u32string suffix_indicator_;
   ustring unk_token_;
-  std::unordered_map<std::u32string, int32_t> vocab_;
+  WordpieceTrie trie_;
 };
 
 void KernelWordpieceTokenizer_Split(const std::u32string& suffix_indicator,
                                     const std::u32string& text,
                                     std::vector<std::u32string>& words);
 
+// The words are matched by the trie of the vocabulary, which is built once by the kernel.
+void KernelWordpieceTokenizer_Tokenizer(const WordpieceTrie& trie,
+                                        const std::u32string& suffix_indicator,
+                                        const ustring& unk_token,
+                                        const std::vector<ustring>& texts,
+                                        std::vector<ustring>& tokens,
+                                        std::vector<int32_t>& indices,
+                                        std::vector<int64_t>& rows,
+                                        const int64_t* existing_rows = nullptr,
+                                        int64_t n_existing_rows = 0,
+                                        int64_t max_input_chars_per_word = 200);
+
+// Builds the trie of the vocabulary for the call.
 void KernelWordpieceTokenizer_Tokenizer(const std::unordered_map<std::u32string, int32_t>& vocab,
                                         const std::u32string& suffix_indicator,
                                         const ustring& unk_token,
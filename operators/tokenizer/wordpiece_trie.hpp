@@ -0,0 +1,191 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ustring.h"
+
+// The WordPiece vocabulary as a trie, which runs the greedy longest-match-first tokenization of a word
+// in one left-to-right pass without any allocation, with the failure links and the failure pops of
+// LinMaxMatch (Song et al., Fast WordPiece Tokenization, 2021).
+// The prefix root holds the tokens which start a word, and the suffix root the tokens after the suffix
+// indicator, which continue it. When the next character has no edge, the node pops the longest tokens
+// of its string, and the failure link goes to the suffix node of the rest, so no character is read twice.
+class WordpieceTrie {
+ public:
+  // The tokens which are matched by the trie, in which the suffix tokens keep their indicator.
+  struct Piece {
+    std::u32string token;
+    int32_t id;
+  };
+
+  // The vocab is a map or a list of the (token, id) pairs, in which the tokens are UTF-8 or UTF-32 strings.
+  template <typename Vocab>
+  void Build(const Vocab& vocab, std::u32string_view suffix_indicator) {
+    Clear();
+    for (const auto& [key, id] : vocab) {
+      AddPiece(ToUTF32(key), static_cast<int32_t>(id), suffix_indicator);
+    }
+    BuildFailureLinks();
+  }
+
+  // Builds the trie from the tokens which are added one by one, like the entries of a vocab as it's parsed,
+  // between Clear() and Finish().
+  void Clear() {
+    nodes_.assign(2, Node{});
+    pieces_.clear();
+    pops_.clear();
+  }
+
+  void Reserve(size_t token_count) { pieces_.reserve(token_count); }
+
+  void Add(std::string_view token, int32_t id, std::u32string_view suffix_indicator) {
+    AddPiece(ToUTF32(token), id, suffix_indicator);
+  }
+
+  void Finish() { BuildFailureLinks(); }
+
+  // Appends the indices of the pieces of the word to pieces. If no piece matches at some position of the word,
+  // it returns false after appending the pieces before the position, like the greedy search of the tokenizers.
+  bool Tokenize(std::u32string_view word, std::vector<int32_t>& pieces) const {
+    int32_t state = kPrefixRoot;
+    for (char32_t ch : word) {
+      int32_t next;
+      while ((next = Child(state, ch)) == kNone) {
+        if (!Pop(state, pieces)) {
+          return false;
+        }
+      }
+      state = next;
+    }
+
+    // the rest of the match is popped until nothing is left of the word
+    while (state != kSuffixRoot && !word.empty()) {
+      if (!Pop(state, pieces)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const Piece& GetPiece(int32_t piece) const { return pieces_[piece]; }
+  size_t PieceCount() const { return pieces_.size(); }
+
+ private:
+  static constexpr int32_t kNone = -1;
+  static constexpr int32_t kPrefixRoot = 0;
+  static constexpr int32_t kSuffixRoot = 1;
+
+  struct Node {
+    std::vector<std::pair<char32_t, int32_t>> edges;  // sorted by the character
+    int32_t piece = kNone;                            // the piece which ends at this node
+    int32_t fail = kNone;                             // the suffix node after the failure pops
+    uint32_t pops_begin = 0;                          // the failure pops in pops_
+    uint32_t pops_end = 0;
+  };
+
+  static std::u32string ToUTF32(std::string_view utf8) { return ustring(utf8); }
+  static const std::u32string& ToUTF32(const std::u32string& utf32) { return utf32; }
+
+  void AddPiece(const std::u32string& token, int32_t id, std::u32string_view suffix_indicator) {
+    if (token.empty()) {
+      return;  // the pieces are never empty
+    }
+
+    // a suffix token matches at the start of a word too, as its whole string
+    std::u32string_view key(token);
+    int32_t piece = kNone;
+    Insert(kPrefixRoot, key, token, id, piece);
+    if (!suffix_indicator.empty() && key.size() > suffix_indicator.size() &&
+        key.substr(0, suffix_indicator.size()) == suffix_indicator) {
+      Insert(kSuffixRoot, key.substr(suffix_indicator.size()), token, id, piece);
+    }
+  }
+
+  void Insert(int32_t state, std::u32string_view key, const std::u32string& token, int32_t id, int32_t& piece) {
+    for (char32_t ch : key) {
+      int32_t next = Child(state, ch);
+      if (next == kNone) {
+        next = static_cast<int32_t>(nodes_.size());
+        nodes_.emplace_back();
+        auto& edges = nodes_[state].edges;
+        edges.insert(std::lower_bound(edges.begin(), edges.end(), std::make_pair(ch, kNone)), std::make_pair(ch, next));
+      }
+      state = next;
+    }
+
+    if (nodes_[state].piece == kNone) {
+      if (piece == kNone) {
+        piece = static_cast<int32_t>(pieces_.size());
+        pieces_.push_back(Piece{token, id});
+      }
+      nodes_[state].piece = piece;
+    }
+  }
+
+  void BuildFailureLinks() {
+    // the nodes are visited in the order of their depth, so the failure links of the shorter strings,
+    // which the longer ones are derived from, are always ready.
+    std::vector<std::vector<int32_t>> pops(nodes_.size());
+    std::queue<int32_t> queue;
+    queue.push(kPrefixRoot);
+    queue.push(kSuffixRoot);
+    while (!queue.empty()) {
+      int32_t parent = queue.front();
+      queue.pop();
+      for (auto& [ch, state] : nodes_[parent].edges) {
+        queue.push(state);
+        Node& node = nodes_[state];
+        if (node.piece != kNone) {
+          // the longest match is the token of the node itself, and the rest is empty.
+          node.fail = kSuffixRoot;
+          pops[state].assign(1, node.piece);
+          continue;
+        }
+
+        std::vector<int32_t> node_pops = pops[parent];
+        int32_t fail = nodes_[parent].fail;
+        while (fail != kNone && Child(fail, ch) == kNone) {
+          node_pops.insert(node_pops.end(), pops[fail].begin(), pops[fail].end());
+          fail = nodes_[fail].fail;
+        }
+        // without a failure link, the pops are the pieces before the part of the word which isn't in the vocab
+        node.fail = fail == kNone ? kNone : Child(fail, ch);
+        pops[state] = std::move(node_pops);
+      }
+    }
+
+    for (size_t state = 0; state < nodes_.size(); ++state) {
+      nodes_[state].pops_begin = static_cast<uint32_t>(pops_.size());
+      pops_.insert(pops_.end(), pops[state].begin(), pops[state].end());
+      nodes_[state].pops_end = static_cast<uint32_t>(pops_.size());
+    }
+  }
+
+  // Appends the failure pops of the state and follows its failure link, or returns false if the match fails.
+  bool Pop(int32_t& state, std::vector<int32_t>& pieces) const {
+    const Node& node = nodes_[state];
+    pieces.insert(pieces.end(), pops_.begin() + node.pops_begin, pops_.begin() + node.pops_end);
+    state = node.fail;
+    return state != kNone;
+  }
+
+  int32_t Child(int32_t state, char32_t ch) const {
+    const auto& edges = nodes_[state].edges;
+    auto it = std::lower_bound(edges.begin(), edges.end(), std::make_pair(ch, kNone),
+                               [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    return (it != edges.end() && it->first == ch) ? it->second : kNone;
+  }
+
+  std::vector<Node> nodes_{2};
+  std::vector<Piece> pieces_;
+  std::vector<int32_t> pops_;
+};
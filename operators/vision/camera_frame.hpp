@@ -0,0 +1,120 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace ort_extensions {
+
+// The pixel formats of the raw frames of the cameras: the Y plane and the interleaved UV (NV12) or VU (NV21) plane
+// of the half size, the Y, U and V planes of I420, or the 4 bytes per pixel of BGRA and RGBA, whose alpha is ignored.
+enum class FrameFormat { kNV12, kNV21, kI420, kBGRA, kRGBA };
+
+// The conversion of YUV into RGB of BT.601 in the fixed point of 8 bits, of the limited range of the video, where Y
+// is of [16, 235], or of the full range of JPEG.
+struct YuvCoefficients {
+  int32_t y_offset;
+  int32_t y_scale;
+  int32_t r_v;
+  int32_t g_u;
+  int32_t g_v;
+  int32_t b_u;
+
+  static YuvCoefficients Bt601(bool full_range) {
+    return full_range ? YuvCoefficients{0, 256, 359, 88, 183, 454} : YuvCoefficients{16, 298, 409, 100, 208, 516};
+  }
+
+  void ToBgr(int32_t y, int32_t u, int32_t v, uint8_t* bgr) const {
+    const int32_t luma = (y - y_offset) * y_scale + 128;
+    u -= 128;
+    v -= 128;
+    bgr[0] = Clamp((luma + b_u * u) >> 8);
+    bgr[1] = Clamp((luma - g_u * u - g_v * v) >> 8);
+    bgr[2] = Clamp((luma + r_v * v) >> 8);
+  }
+
+ private:
+  static uint8_t Clamp(int32_t value) { return static_cast<uint8_t>(std::min(std::max(value, 0), 255)); }
+};
+
+// A raw frame of height x width of a camera, whose planes have their strides in bytes, and which is rotated
+// clockwise by rotation degrees, 0, 90, 180 or 270, into the upright image of Height() x Width() of the model.
+struct CameraFrame {
+  FrameFormat format{FrameFormat::kNV12};
+  std::array<const uint8_t*, 3> planes{};
+  std::array<size_t, 3> strides{};
+  int64_t height{};
+  int64_t width{};
+  int64_t rotation{};
+  YuvCoefficients coefficients{YuvCoefficients::Bt601(false)};
+
+  int64_t Height() const { return rotation % 180 == 0 ? height : width; }
+  int64_t Width() const { return rotation % 180 == 0 ? width : height; }
+
+  // The BGR pixels of the columns [first_column, first_column + count) of the row of the upright image, the
+  // RowReader of TransformImageRows. A row of the rotation of 90 or 270 degrees is a column of the frame.
+  const uint8_t* ReadRow(int64_t row, int64_t first_column, size_t count, uint8_t* bgr) const {
+    switch (rotation) {
+      case 0:
+        ReadLine(row, first_column, 0, 1, count, bgr);
+        break;
+      case 90:  // the pixel (r, c) of the image is the pixel (height - 1 - c, r) of the frame
+        ReadLine(height - 1 - first_column, row, -1, 0, count, bgr);
+        break;
+      case 180:  // (height - 1 - r, width - 1 - c)
+        ReadLine(height - 1 - row, width - 1 - first_column, 0, -1, count, bgr);
+        break;
+      default:  // 270, (c, width - 1 - r)
+        ReadLine(first_column, width - 1 - row, 1, 0, count, bgr);
+        break;
+    }
+    return bgr;
+  }
+
+ private:
+  // count pixels of the frame from (y, x) by the steps of (dy, dx), with the format out of the loop of the pixels.
+  void ReadLine(int64_t y, int64_t x, int64_t dy, int64_t dx, size_t count, uint8_t* bgr) const {
+    auto for_each_pixel = [&](auto&& convert) {
+      for (size_t i = 0; i < count; ++i, y += dy, x += dx) {
+        convert(static_cast<size_t>(y), static_cast<size_t>(x), bgr + i * 3);
+      }
+    };
+    const uint8_t* luma = planes[0];
+    const uint8_t* chroma = planes[1];
+    switch (format) {
+      case FrameFormat::kNV12:
+      case FrameFormat::kNV21: {
+        const size_t u = format == FrameFormat::kNV12 ? 0 : 1;
+        for_each_pixel([&](size_t sy, size_t sx, uint8_t* out) {
+          const uint8_t* uv = chroma + sy / 2 * strides[1] + sx / 2 * 2;
+          coefficients.ToBgr(luma[sy * strides[0] + sx], uv[u], uv[1 - u], out);
+        });
+        break;
+      }
+      case FrameFormat::kI420:
+        for_each_pixel([&](size_t sy, size_t sx, uint8_t* out) {
+          coefficients.ToBgr(luma[sy * strides[0] + sx], chroma[sy / 2 * strides[1] + sx / 2],
+                             planes[2][sy / 2 * strides[2] + sx / 2], out);
+        });
+        break;
+      case FrameFormat::kBGRA:
+        for_each_pixel([&](size_t sy, size_t sx, uint8_t* out) {
+          std::copy_n(luma + sy * strides[0] + sx * 4, 3, out);
+        });
+        break;
+      case FrameFormat::kRGBA:
+        for_each_pixel([&](size_t sy, size_t sx, uint8_t* out) {
+          const uint8_t* rgba = luma + sy * strides[0] + sx * 4;
+          out[0] = rgba[2];
+          out[1] = rgba[1];
+          out[2] = rgba[0];
+        });
+        break;
+    }
+  }
+};
+
+}  // namespace ort_extensions
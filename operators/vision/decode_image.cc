@@ -3,11 +3,76 @@
 
 #include "decode_image.hpp"
 
+#include <cstring>
+#include <utility>
 #include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include "image_codecs.h"
 #include "narrow.h"
+#include "trace_scope.h"
 
 namespace ort_extensions {
 
+int ReducedImreadFlags(int64_t scale_denominator, DecodeColorSpace color_space) {
+  const bool gray = color_space == DecodeColorSpace::kGray;
+  switch (scale_denominator) {
+    case 2:
+      return gray ? cv::IMREAD_REDUCED_GRAYSCALE_2 : cv::IMREAD_REDUCED_COLOR_2;
+    case 4:
+      return gray ? cv::IMREAD_REDUCED_GRAYSCALE_4 : cv::IMREAD_REDUCED_COLOR_4;
+    case 8:
+      return gray ? cv::IMREAD_REDUCED_GRAYSCALE_8 : cv::IMREAD_REDUCED_COLOR_8;
+    default:
+      return gray ? cv::IMREAD_GRAYSCALE : cv::IMREAD_COLOR;
+  }
+}
+
+void SwapRedBlue(uint8_t* data, int64_t height, int64_t width, size_t step) {
+  for (int64_t y = 0; y < height; ++y) {
+    uint8_t* p = data + y * step;
+    for (int64_t x = 0; x < width; ++x, p += 3) {
+      std::swap(p[0], p[2]);
+    }
+  }
+}
+
+void CopyDecodedImage(const cv::Mat& decoded_image, DecodeColorSpace color_space, uint8_t* data, size_t step) {
+  cv::Mat destination(decoded_image.rows, decoded_image.cols, decoded_image.type(), data, step);
+  if (color_space == DecodeColorSpace::kRGB) {
+    cv::cvtColor(decoded_image, destination, cv::COLOR_BGR2RGB);
+  } else {
+    decoded_image.copyTo(destination);
+  }
+}
+
+void DecodeImageInto(const cv::Mat& encoded_image, const ImageHeader& header, int64_t scale_denominator,
+                     DecodeColorSpace color_space, uint8_t* data, size_t step, const char* op_name, bool fast) {
+  ORTX_TRACE_SCOPE("DecodeImage.imdecode");
+  if (NativeDecodeImage(encoded_image.data, encoded_image.total(), header, scale_denominator,
+                        ColorChannels(color_space), color_space == DecodeColorSpace::kRGB, fast, data, step,
+                        op_name)) {
+    return;
+  }
+  const int type = color_space == DecodeColorSpace::kGray ? CV_8UC1 : CV_8UC3;
+  cv::Mat decoded_image(narrow<int>(header.height), narrow<int>(header.width), type, data, step);
+  const cv::Mat result = cv::imdecode(encoded_image, ReducedImreadFlags(scale_denominator, color_space),
+                                      &decoded_image);
+  if (result.data == nullptr) {
+    ORTX_CXX_API_THROW(MakeString(op_name, " Invalid input. Failed to decode image."), ORT_INVALID_ARGUMENT);
+  }
+  if (result.data != data) {
+    // the decoder rotated the image out of place by its EXIF orientation
+    if (result.rows != header.height || result.cols != header.width || result.type() != type) {
+      ORTX_CXX_API_THROW(MakeString(op_name, " Invalid input. The image doesn't match its header."),
+                         ORT_INVALID_ARGUMENT);
+    }
+    CopyDecodedImage(result, color_space, data, step);
+  } else if (color_space == DecodeColorSpace::kRGB) {
+    // the codecs of OpenCV 4.5 don't decode into RGB, so it's swizzled in place instead of in a copy
+    SwapRedBlue(data, header.height, header.width, step);
+  }
+}
+
 void KernelDecodeImage::Compute(const ortc::Tensor<uint8_t>& input, ortc::Tensor<uint8_t>& output) const {
   // Setup inputs
   const auto& dimensions = input.Shape();
@@ -21,7 +86,21 @@ void KernelDecodeImage::Compute(const ortc::Tensor<uint8_t>& input, ortc::Tensor
   const std::vector<int32_t> encoded_image_sizes{1, static_cast<int32_t>(encoded_image_data_len)};
   const void* encoded_image_data = input.Data();
   const cv::Mat encoded_image(encoded_image_sizes, CV_8UC1, const_cast<void*>(encoded_image_data));
-  const cv::Mat decoded_image = cv::imdecode(encoded_image, cv::IMREAD_COLOR);
+
+  // The output of the size from the header is allocated first, and the image is decoded into it.
+  ImageHeader header;
+  if (ReadImageHeader(static_cast<const uint8_t*>(encoded_image_data), narrow<size_t>(encoded_image_data_len),
+                      header)) {
+    const int64_t scale_denominator = min_side_ > 0 ? JpegScaleDenominator(header, min_side_, min_side_) : 1;
+    header = ReducedImageHeader(header, scale_denominator);
+    const int64_t channels = ColorChannels(color_space_);
+    uint8_t* decoded_image_data = output.Allocate({header.height, header.width, channels});
+    DecodeImageInto(encoded_image, header, scale_denominator, color_space_, decoded_image_data,
+                    narrow<size_t>(header.width * channels), "[DecodeImage]", fast_decode_);
+    return;
+  }
+
+  const cv::Mat decoded_image = cv::imdecode(encoded_image, ReducedImreadFlags(1, color_space_));
 
   if (decoded_image.data == nullptr) {
     ORTX_CXX_API_THROW("[DecodeImage] Invalid input. Failed to decode image.", ORT_INVALID_ARGUMENT);
@@ -31,10 +110,141 @@ void KernelDecodeImage::Compute(const ortc::Tensor<uint8_t>& input, ortc::Tensor
   const cv::Size decoded_image_size = decoded_image.size();
   const int64_t height = decoded_image_size.height;
   const int64_t width = decoded_image_size.width;
-  const int64_t colors = decoded_image.elemSize();  //  == 3 as it's BGR
+  const int64_t colors = decoded_image.elemSize();  //  == 3 as it's BGR, or 1 of GRAY
 
   const std::vector<int64_t> output_dims{height, width, colors};
   uint8_t* decoded_image_data = output.Allocate(output_dims);
-  memcpy(decoded_image_data, decoded_image.data, narrow<size_t>(height * width * colors));
+  CopyDecodedImage(decoded_image, color_space_, decoded_image_data, narrow<size_t>(width * colors));
 }
+
+void KernelDecodeImageBatch::Compute(const ortc::Tensor<uint8_t>& images,
+                                     const ortc::Tensor<int64_t>& offsets,
+                                     ortc::Tensor<uint8_t>& output,
+                                     ortc::Tensor<int64_t>& sizes) const {
+  if (images.Shape().size() != 1) {
+    ORTX_CXX_API_THROW("[DecodeImageBatch]: Expect the images of dimension [n].", ORT_INVALID_ARGUMENT);
+  }
+  if (offsets.Shape().size() != 1 || offsets.NumberOfElement() < 1) {
+    ORTX_CXX_API_THROW("[DecodeImageBatch]: Expect the offsets of dimension [batch + 1].", ORT_INVALID_ARGUMENT);
+  }
+
+  const uint8_t* p_images = images.Data();
+  const int64_t* p_offsets = offsets.Data();
+  const size_t batch = static_cast<size_t>(offsets.NumberOfElement()) - 1;
+  if (p_offsets[0] != 0 || p_offsets[batch] != images.NumberOfElement()) {
+    ORTX_CXX_API_THROW("[DecodeImageBatch]: The offsets should start at 0 and end at the size of the images.",
+                       ORT_INVALID_ARGUMENT);
+  }
+  for (size_t i = 0; i < batch; ++i) {
+    if (p_offsets[i] > p_offsets[i + 1]) {
+      ORTX_CXX_API_THROW(MakeString("[DecodeImageBatch]: The offsets are decreasing at ", i, "."),
+                         ORT_INVALID_ARGUMENT);
+    }
+  }
+
+  std::vector<EncodedImage> encoded_images(batch);
+  for (size_t i = 0; i < batch; ++i) {
+    encoded_images[i] = {p_images + p_offsets[i], static_cast<size_t>(p_offsets[i + 1] - p_offsets[i])};
+  }
+  DecodeBatch(encoded_images, output, sizes, "[DecodeImageBatch]");
+}
+
+void KernelDecodeImageBatch::DecodeBatch(const std::vector<EncodedImage>& encoded_images,
+                                         ortc::Tensor<uint8_t>& output,
+                                         ortc::Tensor<int64_t>& sizes,
+                                         const char* op_name) const {
+  const size_t batch = encoded_images.size();
+  // The sizes of the images are read from their headers, or the images without one are decoded first, so the
+  // output is allocated before the other images are decoded into it.
+  struct Image {
+    cv::Mat encoded;
+    ImageHeader header;  // the size of the encoded image
+    int64_t scale_denominator{1};
+    cv::Mat decoded;  // the image which is decoded before the output is allocated
+  };
+  const bool resize = !resize_to_.empty();
+  const int64_t min_height = resize ? resize_to_[0] : min_side_;
+  const int64_t min_width = resize ? resize_to_[1] : min_side_;
+  std::vector<Image> items(batch);
+  ParallelFor(batch, num_threads_, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const EncodedImage& encoded = encoded_images[i];
+      if (encoded.size == 0) {
+        ORTX_CXX_API_THROW(MakeString(op_name, " Invalid input. Image ", i, " is empty."), ORT_INVALID_ARGUMENT);
+      }
+      Image& item = items[i];
+      item.encoded = cv::Mat(std::vector<int32_t>{1, narrow<int32_t>(encoded.size)}, CV_8UC1,
+                             const_cast<uint8_t*>(encoded.data));
+      if (ReadImageHeader(encoded.data, encoded.size, item.header)) {
+        if (min_height > 0) {
+          item.scale_denominator = JpegScaleDenominator(item.header, min_height, min_width);
+        }
+        continue;
+      }
+      item.decoded = cv::imdecode(item.encoded, ReducedImreadFlags(1, color_space_));
+      if (item.decoded.data == nullptr) {
+        ORTX_CXX_API_THROW(MakeString(op_name, " Invalid input. Failed to decode image ", i, "."),
+                           ORT_INVALID_ARGUMENT);
+      }
+      item.header.height = item.decoded.rows;
+      item.header.width = item.decoded.cols;
+    }
+  });
+
+  int64_t height = resize ? resize_to_[0] : 0;
+  int64_t width = resize ? resize_to_[1] : 0;
+  int64_t* p_sizes = sizes.Allocate({static_cast<int64_t>(batch), 2});
+  for (size_t i = 0; i < batch; ++i) {
+    const ImageHeader header = resize ? items[i].header
+                                       : ReducedImageHeader(items[i].header, items[i].scale_denominator);
+    p_sizes[i * 2] = header.height;
+    p_sizes[i * 2 + 1] = header.width;
+    if (!resize) {
+      height = std::max(height, header.height);
+      width = std::max(width, header.width);
+    }
+  }
+
+  const int64_t channels = ColorChannels(color_space_);
+  uint8_t* data = output.Allocate({static_cast<int64_t>(batch), height, width, channels});
+  const size_t step = narrow<size_t>(width * channels);
+  const size_t image_bytes = narrow<size_t>(height) * step;
+  ParallelFor(batch, num_threads_, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      Image& item = items[i];
+      uint8_t* image = data + i * image_bytes;
+      const ImageHeader header = ReducedImageHeader(item.header, item.scale_denominator);
+      if (resize) {
+        if (item.decoded.data == nullptr) {
+          item.decoded = cv::imdecode(item.encoded, ReducedImreadFlags(item.scale_denominator, color_space_));
+          if (item.decoded.data == nullptr) {
+            ORTX_CXX_API_THROW(MakeString(op_name, " Invalid input. Failed to decode image ", i, "."),
+                               ORT_INVALID_ARGUMENT);
+          }
+        }
+        const bool shrink = item.decoded.rows >= height && item.decoded.cols >= width;
+        cv::Mat resized(narrow<int>(height), narrow<int>(width), item.decoded.type(), image, step);
+        cv::resize(item.decoded, resized, resized.size(), 0, 0, shrink ? cv::INTER_AREA : cv::INTER_LINEAR);
+        if (color_space_ == DecodeColorSpace::kRGB) {
+          SwapRedBlue(image, height, width, step);
+        }
+      } else {
+        if (item.decoded.data == nullptr) {
+          DecodeImageInto(item.encoded, header, item.scale_denominator, color_space_, image, step, op_name,
+                          fast_decode_);
+        } else {
+          CopyDecodedImage(item.decoded, color_space_, image, step);
+        }
+        // the padding at the right of the rows and below them
+        const size_t row_bytes = narrow<size_t>(header.width * channels);
+        for (int64_t y = 0; y < header.height; ++y) {
+          std::memset(image + y * step + row_bytes, 0, step - row_bytes);
+        }
+        std::memset(image + header.height * step, 0, image_bytes - header.height * step);
+      }
+      item.decoded.release();
+    }
+  });
+}
+
 }  // namespace ort_extensions
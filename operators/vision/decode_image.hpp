@@ -5,17 +5,129 @@
 
 #include "ocos.h"
 #include "string_utils.h"
+#include "image_header.h"
+#include "parallel_for.h"
 
 #include <cstdint>
 
+namespace cv {
+class Mat;
+}
+
 namespace ort_extensions {
 
 void decode_image(const ortc::Tensor<uint8_t>& input,
                   ortc::Tensor<uint8_t>& output);
 
+// The pixels of a decoded image. The codecs of OpenCV decode into BGR or gray natively, and RGB is swizzled from
+// BGR in the output, in place.
+enum class DecodeColorSpace {
+  kBGR,
+  kRGB,
+  kGray,
+};
+
+// Reads the color_space attribute of BGR, RGB or GRAY, which is BGR by default.
+inline DecodeColorSpace ReadDecodeColorSpace(const std::string& name, const char* op_name) {
+  if (name == "BGR") {
+    return DecodeColorSpace::kBGR;
+  }
+  if (name == "RGB") {
+    return DecodeColorSpace::kRGB;
+  }
+  if (name == "GRAY") {
+    return DecodeColorSpace::kGray;
+  }
+  ORTX_CXX_API_THROW(MakeString(op_name, ": Unknown color space: ", name), ORT_INVALID_ARGUMENT);
+}
+
+inline int64_t ColorChannels(DecodeColorSpace color_space) {
+  return color_space == DecodeColorSpace::kGray ? 1 : 3;
+}
+
+// The flags of cv::imdecode of the image decoded with the scaled IDCT of the denominator, 1, 2, 4 or 8 from
+// JpegScaleDenominator(), in BGR or in gray.
+int ReducedImreadFlags(int64_t scale_denominator, DecodeColorSpace color_space);
+
+// Decodes the image of the header, which is reduced by the scale denominator, into the pixels of data in the
+// rows of step bytes, by the native decoder of its format of NativeDecodeImage(), or by OpenCV. fast is the knob of
+// the native decoders, which OpenCV doesn't have.
+void DecodeImageInto(const cv::Mat& encoded_image, const ImageHeader& header, int64_t scale_denominator,
+                     DecodeColorSpace color_space, uint8_t* data, size_t step, const char* op_name,
+                     bool fast = false);
+
+// Copies the BGR or gray image decoded by cv::imdecode into data, and swizzles it into RGB in the same pass.
+void CopyDecodedImage(const cv::Mat& decoded_image, DecodeColorSpace color_space, uint8_t* data, size_t step);
+
+// Swaps the blue and the red channels of the BGR image in place.
+void SwapRedBlue(uint8_t* data, int64_t height, int64_t width, size_t step);
+
 struct KernelDecodeImage : BaseKernel {
-  KernelDecodeImage(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {}
+  KernelDecodeImage(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+    // a JPEG image is decoded at 1/2, 1/4 or 1/8 of its size if its shorter side isn't less than min_side then
+    min_side_ = TryToGetAttributeWithDefault<int64_t>("min_side", 0);
+    if (min_side_ < 0) {
+      ORTX_CXX_API_THROW("[DecodeImage]: min_side shouldn't be negative.", ORT_INVALID_ARGUMENT);
+    }
+    color_space_ = ReadDecodeColorSpace(TryToGetAttributeWithDefault<std::string>("color_space", "BGR"),
+                                        "[DecodeImage]");
+    fast_decode_ = TryToGetAttributeWithDefault<int64_t>("fast_decode", 0) != 0;
+  }
   void Compute(const ortc::Tensor<uint8_t>& input, ortc::Tensor<uint8_t>& output) const;
+
+ private:
+  int64_t min_side_{};
+  DecodeColorSpace color_space_{DecodeColorSpace::kBGR};
+  bool fast_decode_{};
+};
+
+// Decodes a batch of images in parallel. The images are concatenated into one tensor, and the offsets of
+// [batch + 1] are where they start and end, like the row splits of a ragged tensor. The output is
+// [batch, max_height, max_width, channels] of the images padded with zeros to the largest one, or
+// [batch, height, width, channels] of the images resized to resize_to, and the sizes of [batch, 2] are the height
+// and the width of every image in the padded output, or of the encoded images when they are resized.
+struct KernelDecodeImageBatch : BaseKernel {
+  KernelDecodeImageBatch(const OrtApi& api, const OrtKernelInfo& info)
+      : KernelDecodeImageBatch(api, info, "[DecodeImageBatch]") {}
+
+  void Compute(const ortc::Tensor<uint8_t>& images,
+               const ortc::Tensor<int64_t>& offsets,
+               ortc::Tensor<uint8_t>& output,
+               ortc::Tensor<int64_t>& sizes) const;
+
+ protected:
+  struct EncodedImage {
+    const uint8_t* data;
+    size_t size;
+  };
+
+  KernelDecodeImageBatch(const OrtApi& api, const OrtKernelInfo& info, const char* op_name) : BaseKernel(api, info) {
+    min_side_ = TryToGetAttributeWithDefault<int64_t>("min_side", 0);
+    if (min_side_ < 0) {
+      ORTX_CXX_API_THROW(MakeString(op_name, ": min_side shouldn't be negative."), ORT_INVALID_ARGUMENT);
+    }
+    if (TryToGetAttribute("resize_to", resize_to_) &&
+        (resize_to_.size() != 2 || resize_to_[0] <= 0 || resize_to_[1] <= 0)) {
+      ORTX_CXX_API_THROW(MakeString(op_name, ": resize_to should be [height, width]."), ORT_INVALID_ARGUMENT);
+    }
+    color_space_ = ReadDecodeColorSpace(TryToGetAttributeWithDefault<std::string>("color_space", "BGR"), op_name);
+    fast_decode_ = TryToGetAttributeWithDefault<int64_t>("fast_decode", 0) != 0;
+    num_threads_ = ReadNumThreadsAttribute(*this);
+  }
+
+  // Decodes the images into the output and the sizes of Compute().
+  void DecodeBatch(const std::vector<EncodedImage>& encoded_images,
+                   ortc::Tensor<uint8_t>& output,
+                   ortc::Tensor<int64_t>& sizes,
+                   const char* op_name) const;
+
+  size_t num_threads_{1};
+
+ private:
+  int64_t min_side_{};
+  std::vector<int64_t> resize_to_;
+  DecodeColorSpace color_space_{DecodeColorSpace::kBGR};
+  bool fast_decode_{};
 };
 
 }  // namespace ort_extensions
@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "decode_image_normalize.hpp"
+
+#include <opencv2/imgcodecs.hpp>
+#include "image_header.h"
+#include "narrow.h"
+
+namespace ort_extensions {
+
+template <typename T>
+void KernelDecodeImageNormalize::Normalize(const ortc::Tensor<uint8_t>& input, ortc::Tensor<T>& output,
+                                           std::optional<ortc::Tensor<float>*> transform) const {
+  const auto& dimensions = input.Shape();
+  if (dimensions.size() != 1ULL) {
+    ORTX_CXX_API_THROW("[DecodeImageNormalize]: Raw image bytes with 1D shape expected.", ORT_INVALID_ARGUMENT);
+  }
+
+  const std::vector<int32_t> encoded_image_sizes{1, static_cast<int32_t>(input.NumberOfElement())};
+  const cv::Mat encoded_image(encoded_image_sizes, CV_8UC1, const_cast<uint8_t*>(input.Data()));
+
+  // the size of the resize is the one of the full image, which the reduced image is resized to
+  int64_t scale_denominator = 1;
+  std::array<int64_t, 2> resized{};
+  ImageHeader header;
+  cv::Mat decoded_image;
+  if (ReadImageHeader(input.Data(), narrow<size_t>(input.NumberOfElement()), header)) {
+    if (!options_.resize_to.empty() || !options_.letterbox.empty() || options_.tile_size > 0) {
+      resized = ResizedSize(header.height, header.width);
+      scale_denominator = JpegScaleDenominator(header, resized[0], resized[1]);
+    }
+    const ImageHeader reduced = ReducedImageHeader(header, scale_denominator);
+    decoded_image.create(narrow<int>(reduced.height), narrow<int>(reduced.width), CV_8UC3);
+    DecodeImageInto(encoded_image, reduced, scale_denominator, DecodeColorSpace::kBGR, decoded_image.data,
+                    decoded_image.step[0], "[DecodeImageNormalize]", fast_decode_);
+  } else {
+    decoded_image = cv::imdecode(encoded_image, ReducedImreadFlags(1, DecodeColorSpace::kBGR));
+    if (decoded_image.data == nullptr) {
+      ORTX_CXX_API_THROW("[DecodeImageNormalize] Invalid input. Failed to decode image.", ORT_INVALID_ARGUMENT);
+    }
+  }
+
+  const int64_t height = decoded_image.rows;
+  const int64_t width = decoded_image.cols;
+  if (scale_denominator == 1) {
+    resized = ResizedSize(height, width);
+  }
+  const auto size = TransformedImageLayout(resized, options_).canvas;
+  T* data = output.Allocate(OutputShape(dimensions, size));
+  const uint8_t* pixels = decoded_image.data;
+  const size_t stride = decoded_image.step[0];
+  TransformRows(
+      [pixels, stride](int64_t row, int64_t first_column, size_t, uint8_t*) {
+        return pixels + static_cast<size_t>(row) * stride + static_cast<size_t>(first_column) * 3;
+      },
+      height, width, resized, data);
+
+  if (transform.has_value() && *transform != nullptr) {
+    // of the full image, which the reduced one stands for
+    const auto parameters = scale_denominator == 1
+                                ? ImageTransformParameters(height, width, resized, options_)
+                                : ImageTransformParameters(header.height, header.width, resized, options_);
+    WriteTransform(input.Shape(), parameters, **transform);
+  }
+}
+
+template void KernelDecodeImageNormalize::Normalize(const ortc::Tensor<uint8_t>&, ortc::Tensor<float>&,
+                                                    std::optional<ortc::Tensor<float>*>) const;
+template void KernelDecodeImageNormalize::Normalize(const ortc::Tensor<uint8_t>&, ortc::Tensor<ortc::MFloat16>&,
+                                                    std::optional<ortc::Tensor<float>*>) const;
+template void KernelDecodeImageNormalize::Normalize(const ortc::Tensor<uint8_t>&, ortc::Tensor<uint8_t>&,
+                                                    std::optional<ortc::Tensor<float>*>) const;
+template void KernelDecodeImageNormalize::Normalize(const ortc::Tensor<uint8_t>&, ortc::Tensor<int8_t>&,
+                                                    std::optional<ortc::Tensor<float>*>) const;
+
+}  // namespace ort_extensions
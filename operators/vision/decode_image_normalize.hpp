@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "string_utils.h"
+#include "decode_image.hpp"
+#include "image_normalize.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace ort_extensions {
+
+// Decodes an image and prepares it for a model in one kernel: the resize with the aspect ratio kept, the center
+// crop, the channel order, the normalization of the mean and std, and the CHW layout of the float output, which
+// are the DecodeImage, Resize, CenterCrop, ImageBytesToFloat, Normalize and ChannelsLastToChannelsFirst steps of
+// the pre/post processing tools, in one pass over the pixels of the output. A JPEG image which is larger than the
+// resized one is decoded at 1/2, 1/4 or 1/8 of its size by the scaled IDCT, the largest which isn't smaller. With
+// letterbox, the image is resized to fit into the padded output, and the optional transform output maps the boxes
+// of a detection model back to the original image.
+struct KernelDecodeImageNormalize : KernelImageNormalize {
+  KernelDecodeImageNormalize(const OrtApi& api, const OrtKernelInfo& info)
+      : KernelImageNormalize(api, info, "DecodeImageNormalize") {
+    fast_decode_ = TryToGetAttributeWithDefault<int64_t>("fast_decode", 0) != 0;
+  }
+
+  void Compute(const ortc::Tensor<uint8_t>& input, ortc::Tensor<float>& output,
+               std::optional<ortc::Tensor<float>*> transform) const {
+    Normalize(input, output, transform);
+  }
+
+  // of the outputs of float, ortc::MFloat16, uint8_t and int8_t
+  template <typename T>
+  void Normalize(const ortc::Tensor<uint8_t>& input, ortc::Tensor<T>& output,
+                 std::optional<ortc::Tensor<float>*> transform) const;
+
+ private:
+  bool fast_decode_{};
+};
+
+template <typename T>
+using KernelDecodeImageNormalizeOutput = KernelNormalizeOutput<KernelDecodeImageNormalize, T>;
+
+}  // namespace ort_extensions
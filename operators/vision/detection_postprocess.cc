@@ -0,0 +1,298 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "detection_postprocess.hpp"
+#include "parallel_for.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+
+namespace ort_extensions {
+
+namespace {
+
+constexpr size_t kBoxSize = 4;
+constexpr size_t kScoreIndex = 4;
+constexpr size_t kClassIndex = 5;
+
+float Sigmoid(float x) { return 1.0f / (1.0f + std::exp(-x)); }
+
+// The cell of an anchor in the grids of the strides, in which the rows of a stride are ordered by the anchor of the
+// cell, then the row and the column of the grid, the same as the heads of YOLOv5 and YOLOX are flattened.
+struct GridCell {
+  float x;
+  float y;
+  float stride;
+  const float* anchor;  // the (width, height) of the anchor, or nullptr if it's anchor free
+};
+
+class AnchorGrid {
+ public:
+  explicit AnchorGrid(const DetectionOptions& options) : options_(options) {
+    const size_t levels = options.strides.size();
+    anchors_per_cell_ = options.anchors.empty() ? 1 : options.anchors.size() / (2 * levels);
+    for (int64_t stride : options.strides) {
+      const size_t height = static_cast<size_t>((options.input_height + stride - 1) / stride);
+      const size_t width = static_cast<size_t>((options.input_width + stride - 1) / stride);
+      grid_sizes_.emplace_back(height, width);
+      level_ends_.push_back((level_ends_.empty() ? 0 : level_ends_.back()) + anchors_per_cell_ * height * width);
+    }
+  }
+
+  size_t NumAnchors() const { return level_ends_.empty() ? 0 : level_ends_.back(); }
+
+  GridCell Cell(size_t index) const {
+    const size_t level = static_cast<size_t>(std::upper_bound(level_ends_.begin(), level_ends_.end(), index) -
+                                             level_ends_.begin());
+    index -= level == 0 ? 0 : level_ends_[level - 1];
+    const auto [height, width] = grid_sizes_[level];
+    const size_t cells = height * width;
+    const size_t anchor = index / cells;
+    const size_t cell = index % cells;
+    const float* anchor_size =
+        options_.anchors.empty() ? nullptr : options_.anchors.data() + 2 * (level * anchors_per_cell_ + anchor);
+    return {static_cast<float>(cell % width), static_cast<float>(cell / width),
+            static_cast<float>(options_.strides[level]), anchor_size};
+  }
+
+ private:
+  const DetectionOptions& options_;
+  size_t anchors_per_cell_{1};
+  std::vector<std::pair<size_t, size_t>> grid_sizes_;
+  std::vector<size_t> level_ends_;
+};
+
+// Converts the box into XYXY, which is decoded from the grid first if there is one.
+void DecodeBox(const float* raw, const DetectionOptions& options, const AnchorGrid* grid, size_t index,
+               float* box) {
+  float a = raw[0], b = raw[1], c = raw[2], d = raw[3];
+  BoundingBoxFormat format = options.box_format;
+  if (grid != nullptr) {
+    const GridCell cell = grid->Cell(index);
+    if (cell.anchor != nullptr) {
+      // YOLOv5: the sigmoid of the offsets from the cell, and of the scales of the anchor
+      if (options.apply_sigmoid) {
+        a = Sigmoid(a), b = Sigmoid(b), c = Sigmoid(c), d = Sigmoid(d);
+      }
+      a = (a * 2.0f - 0.5f + cell.x) * cell.stride;
+      b = (b * 2.0f - 0.5f + cell.y) * cell.stride;
+      c = (c * 2.0f) * (c * 2.0f) * cell.anchor[0];
+      d = (d * 2.0f) * (d * 2.0f) * cell.anchor[1];
+    } else {
+      // YOLOX: the offsets from the cell, and the log of the size in the strides
+      a = (a + cell.x) * cell.stride;
+      b = (b + cell.y) * cell.stride;
+      c = std::exp(c) * cell.stride;
+      d = std::exp(d) * cell.stride;
+    }
+    format = BoundingBoxFormat::CENTER_XYWH;
+  }
+
+  if (format == BoundingBoxFormat::CENTER_XYWH) {
+    box[0] = a - c / 2, box[1] = b - d / 2, box[2] = a + c / 2, box[3] = b + d / 2;
+  } else if (format == BoundingBoxFormat::XYWH) {
+    box[0] = a, box[1] = b, box[2] = a + c, box[3] = b + d;
+  } else {
+    box[0] = a, box[1] = b, box[2] = c, box[3] = d;
+  }
+}
+
+float Area(const Detection& box) {
+  return std::max(box[2] - box[0], 0.0f) * std::max(box[3] - box[1], 0.0f);
+}
+
+bool Overlaps(const Detection& first, float first_area, const Detection& second, float second_area,
+              float iou_threshold) {
+  const float width = std::min(first[2], second[2]) - std::max(first[0], second[0]);
+  const float height = std::min(first[3], second[3]) - std::max(first[1], second[1]);
+  if (width <= 0 || height <= 0) {
+    return false;
+  }
+  const float intersection = width * height;
+  return intersection > iou_threshold * (first_area + second_area - intersection);
+}
+
+}  // namespace
+
+std::vector<Detection> PostProcessDetections(const float* predictions, size_t num_anchors, size_t row_size,
+                                             bool transposed, const DetectionOptions& options, size_t num_threads) {
+  const size_t first_class = kBoxSize + (options.has_objectness ? 1 : 0);
+  if (row_size <= first_class) {
+    ORTX_CXX_API_THROW(MakeString("[DetectionPostProcess]: a prediction of ", row_size,
+                                  " values has no class scores."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  std::optional<AnchorGrid> grid;
+  if (!options.strides.empty()) {
+    grid.emplace(options);
+    if (grid->NumAnchors() != num_anchors) {
+      ORTX_CXX_API_THROW(MakeString("[DetectionPostProcess]: the grids of the strides have ", grid->NumAnchors(),
+                                    " anchors, but there are ", num_anchors, " predictions."),
+                         ORT_INVALID_ARGUMENT);
+    }
+  }
+
+  // every anchor is decoded into its slot, and the ones below the threshold are marked by a NaN score
+  std::vector<Detection> decoded(num_anchors);
+  ParallelFor(num_anchors, num_threads, [&](size_t begin, size_t end) {
+    std::vector<float> row(row_size);
+    for (size_t i = begin; i < end; ++i) {
+      const float* values = predictions + i * row_size;
+      if (transposed) {
+        for (size_t j = 0; j < row_size; ++j) {
+          row[j] = predictions[j * num_anchors + i];
+        }
+        values = row.data();
+      }
+
+      Detection& detection = decoded[i];
+      detection[kScoreIndex] = std::numeric_limits<float>::quiet_NaN();
+      float objectness = 1.0f;
+      if (options.has_objectness) {
+        objectness = options.apply_sigmoid ? Sigmoid(values[kBoxSize]) : values[kBoxSize];
+        if (objectness < options.score_threshold) {
+          continue;  // the scores of the classes are probabilities, so the score can't pass the threshold either
+        }
+      }
+      const float* best = std::max_element(values + first_class, values + row_size);
+      float score = options.apply_sigmoid ? Sigmoid(*best) : *best;
+      score *= objectness;
+      if (score < options.score_threshold) {
+        continue;
+      }
+      DecodeBox(values, options, grid ? &*grid : nullptr, i, detection.data());
+      detection[kScoreIndex] = score;
+      detection[kClassIndex] = static_cast<float>(best - values - first_class);
+    }
+  });
+
+  std::vector<size_t> candidates;
+  for (size_t i = 0; i < num_anchors; ++i) {
+    if (!std::isnan(decoded[i][kScoreIndex])) {
+      candidates.push_back(i);
+    }
+  }
+  // the candidates of the same score are kept in the order of their anchors
+  std::stable_sort(candidates.begin(), candidates.end(), [&decoded](size_t first, size_t second) {
+    return decoded[first][kScoreIndex] > decoded[second][kScoreIndex];
+  });
+
+  // a candidate is kept unless it overlaps one of the kept boxes of its class, which are checked until the first
+  // overlap, and all the candidates are one class if it's class agnostic
+  const size_t max_detections = options.max_detections > 0 ? options.max_detections : candidates.size();
+  const size_t num_classes = options.class_agnostic ? 1 : row_size - first_class;
+  std::vector<std::vector<size_t>> kept_by_class(num_classes);
+  std::vector<float> areas(num_anchors);
+  std::vector<Detection> detections;
+  for (size_t i : candidates) {
+    if (detections.size() >= max_detections) {
+      break;
+    }
+    const Detection& box = decoded[i];
+    areas[i] = Area(box);
+    auto& kept = kept_by_class[options.class_agnostic ? 0 : static_cast<size_t>(box[kClassIndex])];
+    const bool suppressed = std::any_of(kept.begin(), kept.end(), [&](size_t other) {
+      return Overlaps(box, areas[i], decoded[other], areas[other], options.iou_threshold);
+    });
+    if (!suppressed) {
+      kept.push_back(i);
+      detections.push_back(box);
+    }
+  }
+  return detections;
+}
+
+DetectionPostProcess::DetectionPostProcess(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
+  auto box_format = TryToGetAttributeWithDefault<std::string>("box_format", "CENTER_XYWH");
+  if (box_format == "XYXY") {
+    options_.box_format = BoundingBoxFormat::XYXY;
+  } else if (box_format == "XYWH") {
+    options_.box_format = BoundingBoxFormat::XYWH;
+  } else if (box_format == "CENTER_XYWH") {
+    options_.box_format = BoundingBoxFormat::CENTER_XYWH;
+  } else {
+    ORTX_CXX_API_THROW("[DetectionPostProcess] box_format should be one of [XYXY, XYWH, CENTER_XYWH].",
+                       ORT_INVALID_ARGUMENT);
+  }
+  options_.has_objectness = TryToGetAttributeWithDefault<int64_t>("has_objectness", 0) != 0;
+  options_.apply_sigmoid = TryToGetAttributeWithDefault<int64_t>("apply_sigmoid", 0) != 0;
+  options_.class_agnostic = TryToGetAttributeWithDefault<int64_t>("class_agnostic", 0) != 0;
+  transposed_ = TryToGetAttributeWithDefault<int64_t>("transposed", 0) != 0;
+  options_.score_threshold = TryToGetAttributeWithDefault<float>("score_threshold", options_.score_threshold);
+  options_.iou_threshold = TryToGetAttributeWithDefault<float>("iou_threshold", options_.iou_threshold);
+  int64_t max_detections = TryToGetAttributeWithDefault<int64_t>("max_detections", 300);
+  if (max_detections < 0) {
+    ORTX_CXX_API_THROW("[DetectionPostProcess] max_detections shouldn't be negative.", ORT_INVALID_ARGUMENT);
+  }
+  options_.max_detections = static_cast<size_t>(max_detections);
+
+  TryToGetAttribute("strides", options_.strides);
+  TryToGetAttribute("anchors", options_.anchors);
+  if (!options_.strides.empty()) {
+    std::vector<int64_t> input_size;
+    TryToGetAttribute("input_size", input_size);
+    if (input_size.size() != 2 || input_size[0] <= 0 || input_size[1] <= 0) {
+      ORTX_CXX_API_THROW("[DetectionPostProcess] the grids of the strides need the input_size of [height, width].",
+                         ORT_INVALID_ARGUMENT);
+    }
+    options_.input_height = input_size[0];
+    options_.input_width = input_size[1];
+    if (std::any_of(options_.strides.begin(), options_.strides.end(), [](int64_t s) { return s <= 0; })) {
+      ORTX_CXX_API_THROW("[DetectionPostProcess] strides should be positive.", ORT_INVALID_ARGUMENT);
+    }
+    if (!options_.anchors.empty() && (options_.anchors.size() % (2 * options_.strides.size()) != 0)) {
+      ORTX_CXX_API_THROW("[DetectionPostProcess] anchors should be the same number of (width, height) per stride.",
+                         ORT_INVALID_ARGUMENT);
+    }
+  } else if (!options_.anchors.empty()) {
+    ORTX_CXX_API_THROW("[DetectionPostProcess] anchors need the strides of their grids.", ORT_INVALID_ARGUMENT);
+  }
+
+  num_threads_ = ReadNumThreadsAttribute(*this);
+}
+
+void UndoImageTransform(const std::array<float, 4>& transform, std::vector<Detection>& detections) {
+  const auto [scale_x, scale_y, offset_x, offset_y] = transform;
+  if (scale_x <= 0.0f || scale_y <= 0.0f) {
+    ORTX_CXX_API_THROW("[DetectionPostProcess] The scales of the transform should be positive.", ORT_INVALID_ARGUMENT);
+  }
+  for (auto& detection : detections) {
+    detection[0] = (detection[0] - offset_x) / scale_x;
+    detection[1] = (detection[1] - offset_y) / scale_y;
+    detection[2] = (detection[2] - offset_x) / scale_x;
+    detection[3] = (detection[3] - offset_y) / scale_y;
+  }
+}
+
+void DetectionPostProcess::Compute(const ortc::Tensor<float>& predictions,
+                                   std::optional<const ortc::Tensor<float>*> transform,
+                                   ortc::Tensor<float>& boxes) const {
+  const auto& dims = predictions.Shape();
+  if (!(dims.size() == 2 || (dims.size() == 3 && dims[0] == 1))) {
+    ORTX_CXX_API_THROW("[DetectionPostProcess] requires the predictions of [anchors, values] or [1, anchors, values].",
+                       ORT_INVALID_ARGUMENT);
+  }
+  size_t num_anchors = static_cast<size_t>(dims[dims.size() - 2]);
+  size_t row_size = static_cast<size_t>(dims.back());
+  if (transposed_) {
+    std::swap(num_anchors, row_size);
+  }
+
+  auto detections = PostProcessDetections(predictions.Data(), num_anchors, row_size, transposed_, options_,
+                                          num_threads_);
+  if (transform.has_value() && *transform != nullptr) {
+    if ((*transform)->NumberOfElement() != 4) {
+      ORTX_CXX_API_THROW("[DetectionPostProcess] requires the transform of [4] or [1, 4].", ORT_INVALID_ARGUMENT);
+    }
+    const float* values = (*transform)->Data();
+    UndoImageTransform({values[0], values[1], values[2], values[3]}, detections);
+  }
+  float* output = boxes.Allocate({static_cast<int64_t>(detections.size()), static_cast<int64_t>(6)});
+  for (const auto& detection : detections) {
+    output = std::copy(detection.begin(), detection.end(), output);
+  }
+}
+
+}  // namespace ort_extensions
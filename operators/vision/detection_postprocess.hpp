@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "draw_bounding_box.hpp"
+
+#include <array>
+#include <optional>
+#include <vector>
+
+namespace ort_extensions {
+
+// The options of DetectionPostProcess.
+struct DetectionOptions {
+  BoundingBoxFormat box_format{BoundingBoxFormat::CENTER_XYWH};
+  bool has_objectness{};
+  bool apply_sigmoid{};
+  // the strides of the grids of the heads of the model, which decode the raw boxes if it isn't empty, and the
+  // (width, height) of the anchors of every cell of the grid of each stride, which are anchor free if it's empty
+  std::vector<int64_t> strides;
+  std::vector<float> anchors;
+  int64_t input_height{};
+  int64_t input_width{};
+  float score_threshold{0.25f};
+  float iou_threshold{0.45f};
+  bool class_agnostic{};
+  size_t max_detections{300};  // all the detections if it's 0
+};
+
+// A detection of (x1, y1, x2, y2, score, class), the box of XYXY of DrawBoundingBoxes.
+using Detection = std::array<float, 6>;
+
+// Decodes the predictions of [num_anchors, row_size], or [row_size, num_anchors] if they are transposed, whose row is
+// a box, the objectness with has_objectness, and the scores of the classes, and returns the detections after the
+// non-maximum suppression, in the order of their scores. The anchors are decoded in parallel.
+std::vector<Detection> PostProcessDetections(const float* predictions, size_t num_anchors, size_t row_size,
+                                             bool transposed, const DetectionOptions& options, size_t num_threads);
+
+// Maps the boxes of the detections of the input of a model back to the image by the inverse of the
+// (scale_x, scale_y, offset_x, offset_y) of the transform output of ImageNormalize or DecodeImageNormalize.
+void UndoImageTransform(const std::array<float, 4>& transform, std::vector<Detection>& detections);
+
+// The score filtering, the box decoding and the non-maximum suppression of the output of a YOLO-style detection
+// model of [num_anchors, row_size] or [1, num_anchors, row_size], or transposed, into the boxes of [detections, 6] of
+// DrawBoundingBoxes, in the mode XYXY. With the optional transform of [4] or [1, 4] of the letterbox of the input
+// image, the boxes are in the pixels of the original image instead of the ones of the model.
+struct DetectionPostProcess : BaseKernel {
+  DetectionPostProcess(const OrtApi& api, const OrtKernelInfo& info);
+
+  void Compute(const ortc::Tensor<float>& predictions, std::optional<const ortc::Tensor<float>*> transform,
+               ortc::Tensor<float>& boxes) const;
+
+ private:
+  DetectionOptions options_;
+  bool transposed_{};
+  size_t num_threads_{1};
+};
+
+}  // namespace ort_extensions
@@ -9,9 +9,11 @@
 #include <cmath>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <gsl/narrow>
 #include <gsl/span>
 #include <gsl/span_ext>
+#include <limits>
 #include <unordered_map>
 #include <vector>
 #include "exceptions.h"
@@ -44,33 +46,48 @@ static constexpr size_t kBoxScoreIndex = 4;
 
 // To represent Boxes, [num of boxes, box_info]
 // box_info = [x1, y1, x2, y2, score, class]
+// Only the boxes of a score not less than the threshold are kept, and the top max_boxes of them by score are
+// selected before they are sorted, rather than sorting all of them.
 class BoxArray {
  private:
-  void SortBoxesByScore(gsl::span<const float> data) {
-    boxes_by_score_.reserve(NumBoxes());
-    for (size_t i = 0; i < NumBoxes(); ++i) {
-      boxes_by_score_.push_back(data.subspan(i * shape_[1], shape_[1]));
+  void SortBoxesByScore(const float* data, float score_threshold, size_t max_boxes) {
+    const size_t box_size = static_cast<size_t>(shape_[1]);
+    for (size_t i = 0; i < static_cast<size_t>(shape_[0]); ++i) {
+      const float* box = data + i * box_size;
+      // NaN scores are skipped too
+      if (box[kBoxScoreIndex] >= score_threshold) {
+        boxes_by_score_.push_back(box);
+      }
     }
 
-    std::sort(boxes_by_score_.begin(), boxes_by_score_.end(),
-              [](const gsl::span<const float>& first, const gsl::span<const float>& second) {
-                return first[kBoxScoreIndex] > second[kBoxScoreIndex];
-              });
+    // the boxes of the same score are kept in their order in the input
+    auto by_score = [](const float* first, const float* second) {
+      return first[kBoxScoreIndex] > second[kBoxScoreIndex] ||
+             (first[kBoxScoreIndex] == second[kBoxScoreIndex] && first < second);
+    };
+    if (max_boxes < boxes_by_score_.size()) {
+      std::partial_sort(boxes_by_score_.begin(), boxes_by_score_.begin() + max_boxes, boxes_by_score_.end(),
+                        by_score);
+      boxes_by_score_.resize(max_boxes);
+    } else {
+      std::sort(boxes_by_score_.begin(), boxes_by_score_.end(), by_score);
+    }
   }
 
  public:
-  BoxArray(const std::vector<int64_t>& shape, gsl::span<const float> data, BoundingBoxFormat bbox_mode)
+  BoxArray(const std::vector<int64_t>& shape, const float* data, BoundingBoxFormat bbox_mode,
+           float score_threshold, size_t max_boxes)
       : shape_(shape), bbox_mode_(bbox_mode) {
-    SortBoxesByScore(data);
+    SortBoxesByScore(data, score_threshold, max_boxes);
   }
 
   gsl::span<const float> GetBox(size_t index) const {
     assert(index < boxes_by_score_.size());
-    return boxes_by_score_[index];
+    return gsl::make_span(boxes_by_score_[index], static_cast<size_t>(shape_[1]));
   }
 
   int64_t NumBoxes() const {
-    return shape_[0];
+    return static_cast<int64_t>(boxes_by_score_.size());
   }
 
   BoundingBoxFormat BBoxMode() const {
@@ -79,41 +96,32 @@ class BoxArray {
 
  private:
   const std::vector<int64_t>& shape_;
-  std::vector<gsl::span<const float>> boxes_by_score_;
+  std::vector<const float*> boxes_by_score_;
   BoundingBoxFormat bbox_mode_;
 };
 
-// Draw a line on the image
-void DrawLineInHorizon(ImageView& image, int64_t x_start, int64_t y_start, int64_t line_length,
-                       gsl::span<const uint8_t> color, int64_t thickness) {
-  // boundary check
-  thickness = std::clamp<int64_t>(thickness, 0, image.height - y_start);
-  auto stride = image.width * image.channels;
-  auto point_start = image.data.begin() + y_start * stride + x_start * image.channels;
-  for (auto start = point_start; start < point_start + line_length * image.channels; start += image.channels) {
-    std::copy_n(color.begin(), color.size(), start);
-  }
-
-  for (int64_t i = 1; i < thickness; ++i) {
-    auto xy_point_start = point_start + i * stride;
-    auto end = xy_point_start + line_length * image.channels;
-    std::copy_n(point_start, line_length * image.channels, xy_point_start);
+// Draw the border of thickness of the box of [x_start, x_end) and [y_start, y_end) row by row. The first row is
+// painted pixel by pixel, and the other rows are copied from it, the whole row in the top and the bottom edges, and
+// the runs of the left and the right edges between them.
+void DrawBorder(ImageView& image, int64_t x_start, int64_t y_start, int64_t x_end, int64_t y_end,
+                gsl::span<const uint8_t> color, int64_t thickness) {
+  const int64_t stride = image.width * image.channels;
+  const size_t row_bytes = static_cast<size_t>((x_end - x_start) * image.channels);
+  const size_t edge_bytes = static_cast<size_t>(thickness * image.channels);
+  const size_t right_offset = static_cast<size_t>((x_end - thickness - x_start) * image.channels);
+  uint8_t* first_row = image.data.data() + y_start * stride + x_start * image.channels;
+  for (size_t i = 0; i < row_bytes; i += color.size()) {
+    std::memcpy(first_row + i, color.data(), color.size());
   }
-}
-
-void DrawLineInVertical(ImageView& image, int64_t x_start, int64_t y_start, int64_t line_length,
-                        gsl::span<const uint8_t> color, int64_t thickness) {
-  // boundary check
-  thickness = std::clamp<int64_t>(thickness, 0, image.width - x_start);
-  auto stride = image.width * image.channels;
-  auto point_start = image.data.begin() + y_start * stride + x_start * image.channels;
-  auto point_end = point_start + line_length * stride;
 
-  for (int64_t i = 0; i < thickness; ++i) {
-    std::copy_n(color.begin(), color.size(), point_start + i * image.channels);
-  }
-  for (auto xy_point_start = point_start + stride; xy_point_start < point_end; xy_point_start += stride) {
-    std::copy_n(point_start, thickness * image.channels, xy_point_start);
+  for (int64_t y = y_start + 1; y < y_end; ++y) {
+    uint8_t* row = first_row + (y - y_start) * stride;
+    if (y < y_start + thickness || y >= y_end - thickness) {
+      std::memcpy(row, first_row, row_bytes);
+    } else {
+      std::memcpy(row, first_row, edge_bytes);
+      std::memcpy(row + right_offset, first_row, edge_bytes);
+    }
   }
 }
 
@@ -169,19 +177,7 @@ void DrawBox(ImageView& image, gsl::span<const float> box, BoundingBoxFormat bbo
   x_start = std::clamp<int64_t>(x_start, 0, x_end);
   y_start = std::clamp<int64_t>(y_start, 0, y_end);
 
-  auto box_width = x_end - x_start;
-  auto box_height = y_end - y_start;
-  // line  (1) --
-  DrawLineInHorizon(image, x_start, y_start, box_width, color, thickness);
-
-  // line  (2) |--
-  DrawLineInVertical(image, x_start, y_start, box_height, color, thickness);
-
-  // line  (3) __
-  DrawLineInHorizon(image, x_start, y_end - thickness, box_width, color, thickness);
-
-  // line  (4) --|
-  DrawLineInVertical(image, x_end - thickness, y_start, box_height, color, thickness);
+  DrawBorder(image, x_start, y_start, x_end, y_end, color, thickness);
 }
 
 void DrawBoxesForNumClasses(ImageView& image, const BoxArray& boxes, int64_t thickness) {
@@ -201,7 +197,7 @@ void DrawBoxesForNumClasses(ImageView& image, const BoxArray& boxes, int64_t thi
   }
 
   // A class which has higher score will be drawn on the top of the image.
-  std::sort(box_reverse.begin(), box_reverse.end(),
+  std::stable_sort(box_reverse.begin(), box_reverse.end(),
             [](const std::pair<size_t, int64_t>& first_, const std::pair<size_t, int64_t>& second_) {
               return first_.second < second_.second;
             });
@@ -240,23 +236,35 @@ void DrawBoundingBoxes::Compute(const ortc::Tensor<uint8_t>& input_bgr,
     ORTX_CXX_API_THROW("[DrawBoundingBoxes] requires rank 2 input and the last dim should be 6.", ORT_INVALID_ARGUMENT);
   }
 
-  auto box_span = gsl::make_span(input_box.Data(), dimensions_box[0] * dimensions_box[1]);
-  BoxArray boxes(dimensions_box, box_span, bbox_mode_);
   int64_t image_size = dimensions_bgr[0] * dimensions_bgr[1] * dimensions_bgr[2];
 
   // Setup output & copy to destination
-  // can we reuse the input buffer?
+  // the input can't be aliased by the output in the custom op API, so it's copied
   const std::vector<int64_t>& output_dims = dimensions_bgr;
   auto* output_data = output.Allocate(output_dims);
   const auto* input_data = input_bgr.Data();
 
   std::copy(input_data, input_data + image_size, output_data);
-  auto data_span = gsl::make_span(output_data, image_size);
-  ImageView image_view{data_span, dimensions_bgr[0], dimensions_bgr[1], dimensions_bgr[2]};
-  if (colour_by_classes_) {
-    DrawBoxesForNumClasses(image_view, boxes, gsl::narrow<int64_t>(thickness_));
+  const BoxDrawingOptions options{bbox_mode_, thickness_, colour_by_classes_, score_threshold_, max_boxes_};
+  DrawBoxesOnImage(output_data, dimensions_bgr[0], dimensions_bgr[1], input_box.Data(), dimensions_box[0], options);
+}
+
+void DrawBoxesOnImage(uint8_t* image, int64_t height, int64_t width, const float* boxes, int64_t num_boxes,
+                      const BoxDrawingOptions& options) {
+  // only the boxes of the colors are drawn by score
+  size_t max_boxes = options.max_boxes > 0 ? static_cast<size_t>(options.max_boxes)
+                                           : std::numeric_limits<size_t>::max();
+  if (!options.colour_by_classes) {
+    max_boxes = std::min(max_boxes, KBGRColorMap.size());
+  }
+  const std::vector<int64_t> box_shape{num_boxes, 6};
+  BoxArray box_array(box_shape, boxes, options.mode, options.score_threshold, max_boxes);
+
+  ImageView image_view{gsl::make_span(image, height * width * 3), height, width, 3};
+  if (options.colour_by_classes) {
+    DrawBoxesForNumClasses(image_view, box_array, options.thickness);
   } else {
-    DrawBoxesByScore(image_view, boxes, gsl::narrow<int64_t>(thickness_));
+    DrawBoxesByScore(image_view, box_array, options.thickness);
   }
 }
 
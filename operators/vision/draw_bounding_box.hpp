@@ -6,6 +6,8 @@
 #include "ocos.h"
 #include "string_utils.h"
 
+#include <limits>
+
 namespace ort_extensions {
 
 // https://keras.io/api/keras_cv/bounding_box/formats/
@@ -16,6 +18,20 @@ enum class BoundingBoxFormat {
   CENTER_XYWH,
 };
 
+// The options of DrawBoundingBoxes.
+struct BoxDrawingOptions {
+  BoundingBoxFormat mode;
+  int64_t thickness;
+  bool colour_by_classes;
+  float score_threshold;
+  int64_t max_boxes;  // all the boxes if it's 0
+};
+
+// Draws the boxes of [num_boxes, 6] on the image of [height, width, 3] in place, the same as DrawBoundingBoxes
+// draws them on its copy of the input.
+void DrawBoxesOnImage(uint8_t* image, int64_t height, int64_t width, const float* boxes, int64_t num_boxes,
+                      const BoxDrawingOptions& options);
+
 struct DrawBoundingBoxes : BaseKernel {
   DrawBoundingBoxes(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
     thickness_ = TryToGetAttributeWithDefault<int64_t>("thickness", 4);
@@ -35,6 +51,13 @@ struct DrawBoundingBoxes : BaseKernel {
     if (thickness_ <= 0) {
       ORTX_CXX_API_THROW("[DrawBoundingBoxes] thickness of box should >= 1.", ORT_INVALID_ARGUMENT);
     }
+    // the boxes of a lower score are skipped, and at most max_boxes of the highest scores are drawn if it's > 0
+    score_threshold_ = TryToGetAttributeWithDefault<float>("score_threshold",
+                                                           -std::numeric_limits<float>::infinity());
+    max_boxes_ = TryToGetAttributeWithDefault<int64_t>("max_boxes", 0);
+    if (max_boxes_ < 0) {
+      ORTX_CXX_API_THROW("[DrawBoundingBoxes] max_boxes shouldn't be negative.", ORT_INVALID_ARGUMENT);
+    }
   }
 
   void Compute(const ortc::Tensor<uint8_t>& input_bgr,
@@ -46,6 +69,8 @@ struct DrawBoundingBoxes : BaseKernel {
   int64_t num_classes_;
   bool colour_by_classes_;
   BoundingBoxFormat bbox_mode_;
+  float score_threshold_;
+  int64_t max_boxes_;
 };
 
 }  // namespace ort_extensions
@@ -5,8 +5,19 @@
 
 #include <opencv2/imgcodecs.hpp>
 
+#include "trace_scope.h"
+
 namespace ort_extensions {
 
+void KernelEncodeImage::SetEncoderParams(const std::string& format, int64_t quality, int64_t compression_level) {
+  if (format == "jpg" && quality != -1) {
+    params_.insert(params_.end(), {cv::IMWRITE_JPEG_QUALITY, static_cast<int>(quality)});
+  }
+  if (format == "png" && compression_level != -1) {
+    params_.insert(params_.end(), {cv::IMWRITE_PNG_COMPRESSION, static_cast<int>(compression_level)});
+  }
+}
+
 void KernelEncodeImage::Compute(const ortc::Tensor<uint8_t>& input, ortc::Tensor<uint8_t>& output) const {
   // Setup inputs
   const auto dimensions_bgr = input.Shape();
@@ -27,8 +38,28 @@ void KernelEncodeImage::Compute(const ortc::Tensor<uint8_t>& input, ortc::Tensor
 
   // don't know output size ahead of time so need to encode and then copy to output
   std::vector<uint8_t> encoded_image;
-  if (!cv::imencode(extension_, bgr_image, encoded_image)) {
-    ORTX_CXX_API_THROW("[EncodeImage] Image encoding failed.", ORT_INVALID_ARGUMENT);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!buffers_.empty()) {
+      encoded_image = std::move(buffers_.back());
+      buffers_.pop_back();
+    }
+  }
+  // the buffer is given back on an error too
+  struct BufferReturn {
+    const KernelEncodeImage& kernel;
+    std::vector<uint8_t>& buffer;
+    ~BufferReturn() {
+      std::lock_guard<std::mutex> lock(kernel.mutex_);
+      kernel.buffers_.push_back(std::move(buffer));
+    }
+  } buffer_return{*this, encoded_image};
+
+  {
+    ORTX_TRACE_SCOPE("EncodeImage.imencode");
+    if (!cv::imencode(extension_, bgr_image, encoded_image, params_)) {
+      ORTX_CXX_API_THROW("[EncodeImage] Image encoding failed.", ORT_INVALID_ARGUMENT);
+    }
   }
 
   // Setup output & copy to destination
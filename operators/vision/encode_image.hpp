@@ -7,6 +7,8 @@
 #include "string_utils.h"
 
 #include <cstdint>
+#include <mutex>
+#include <vector>
 
 namespace ort_extensions {
 struct KernelEncodeImage : BaseKernel {
@@ -18,13 +20,32 @@ struct KernelEncodeImage : BaseKernel {
     }
 
     extension_ = std::string(".") + format;
+
+    // the parameters of the encoder, which are the defaults of OpenCV if they aren't set
+    int64_t quality = TryToGetAttributeWithDefault<int64_t>("quality", -1);
+    if (quality != -1 && (quality < 0 || quality > 100)) {
+      ORTX_CXX_API_THROW("[EncodeImage] quality should be in [0, 100].", ORT_INVALID_ARGUMENT);
+    }
+    int64_t compression_level = TryToGetAttributeWithDefault<int64_t>("compression_level", -1);
+    if (compression_level != -1 && (compression_level < 0 || compression_level > 9)) {
+      ORTX_CXX_API_THROW("[EncodeImage] compression_level should be in [0, 9].", ORT_INVALID_ARGUMENT);
+    }
+    SetEncoderParams(format, quality, compression_level);
   }
 
   void Compute(const ortc::Tensor<uint8_t>& input_bgr,
                ortc::Tensor<uint8_t>& output) const;
 
  private:
+  void SetEncoderParams(const std::string& format, int64_t quality, int64_t compression_level);
+
   std::string extension_;
+  std::vector<int> params_;
+
+  // The buffers the images are encoded into, which are reused by the next calls instead of growing a new one each
+  // time. A call takes one of them out, so the calls on several threads don't share one.
+  mutable std::mutex mutex_;
+  mutable std::vector<std::vector<uint8_t>> buffers_;
 };
 
 }  // namespace ort_extensions
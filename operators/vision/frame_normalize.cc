@@ -0,0 +1,173 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "frame_normalize.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace ort_extensions {
+
+namespace {
+
+// The tensor of an optional plane, or nullptr if it's absent or empty.
+const ortc::Tensor<uint8_t>* OptionalPlane(std::optional<const ortc::Tensor<uint8_t>*> plane) {
+  return plane.has_value() && *plane != nullptr && (*plane)->NumberOfElement() > 0 ? *plane : nullptr;
+}
+
+// The [rows, stride] of a plane.
+std::array<int64_t, 2> PlaneSize(const ortc::Tensor<uint8_t>& plane) {
+  const auto& dims = plane.Shape();
+  if (dims.size() != 2) {
+    ORTX_CXX_API_THROW("[FrameNormalize]: Expect the planes of [rows, stride].", ORT_INVALID_ARGUMENT);
+  }
+  return {dims[0], dims[1]};
+}
+
+}  // namespace
+
+KernelFrameNormalize::KernelFrameNormalize(const OrtApi& api, const OrtKernelInfo& info)
+    : KernelImageNormalize(api, info, "FrameNormalize") {
+  std::string format = TryToGetAttributeWithDefault<std::string>("format", "NV12");
+  if (format == "NV12") {
+    format_ = FrameFormat::kNV12;
+  } else if (format == "NV21") {
+    format_ = FrameFormat::kNV21;
+  } else if (format == "I420" || format == "YUV420") {
+    format_ = FrameFormat::kI420;
+  } else if (format == "BGRA") {
+    format_ = FrameFormat::kBGRA;
+  } else if (format == "RGBA") {
+    format_ = FrameFormat::kRGBA;
+  } else {
+    ORTX_CXX_API_THROW(MakeString("[FrameNormalize]: Unknown frame format: ", format), ORT_INVALID_ARGUMENT);
+  }
+
+  std::string yuv_range = TryToGetAttributeWithDefault<std::string>("yuv_range", "limited");
+  if (yuv_range != "limited" && yuv_range != "full") {
+    ORTX_CXX_API_THROW(MakeString("[FrameNormalize]: Unknown yuv_range: ", yuv_range), ORT_INVALID_ARGUMENT);
+  }
+  coefficients_ = YuvCoefficients::Bt601(yuv_range == "full");
+}
+
+CameraFrame KernelFrameNormalize::ReadFrame(const ortc::Tensor<uint8_t>& plane0,
+                                            std::optional<const ortc::Tensor<uint8_t>*> plane1,
+                                            std::optional<const ortc::Tensor<uint8_t>*> plane2,
+                                            std::optional<const ortc::Tensor<int64_t>*> metadata) const {
+  CameraFrame frame;
+  frame.format = format_;
+  frame.coefficients = coefficients_;
+  const auto size = PlaneSize(plane0);
+  frame.planes[0] = plane0.Data();
+  frame.strides[0] = static_cast<size_t>(size[1]);
+
+  if (metadata.has_value() && *metadata != nullptr && (*metadata)->NumberOfElement() > 0) {
+    const int64_t count = (*metadata)->NumberOfElement();
+    const int64_t* values = (*metadata)->Data();
+    if (count > 3 || std::any_of(values, values + count, [](int64_t v) { return v < 0; })) {
+      ORTX_CXX_API_THROW("[FrameNormalize]: metadata should be (width, height, rotation), not negative.",
+                         ORT_INVALID_ARGUMENT);
+    }
+    frame.width = values[0];
+    frame.height = count > 1 ? values[1] : 0;
+    frame.rotation = count > 2 ? values[2] : 0;
+  }
+  if (frame.rotation % 90 != 0 || frame.rotation >= 360) {
+    ORTX_CXX_API_THROW("[FrameNormalize]: The rotation should be 0, 90, 180 or 270.", ORT_INVALID_ARGUMENT);
+  }
+
+  const bool packed = format_ == FrameFormat::kBGRA || format_ == FrameFormat::kRGBA;
+  const int64_t pixel_size = packed ? 4 : 1;
+  if (frame.width == 0) {
+    frame.width = size[1] / pixel_size;
+  }
+  const auto* chroma = OptionalPlane(plane1);
+  const bool contiguous = !packed && chroma == nullptr;
+  if (frame.height == 0) {
+    frame.height = contiguous ? size[0] * 2 / 3 : size[0];
+  }
+  if (frame.width <= 0 || frame.height <= 0 || frame.width * pixel_size > size[1] || frame.height > size[0]) {
+    ORTX_CXX_API_THROW(MakeString("[FrameNormalize]: The frame of ", frame.width, "x", frame.height,
+                                  " is out of the plane of [", size[0], ", ", size[1], "]."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  if (packed) {
+    return frame;
+  }
+
+  // the planes of the half size of the chroma, of 2 bytes per pixel of NV12 and NV21
+  const int64_t chroma_rows = (frame.height + 1) / 2;
+  const int64_t chroma_bytes = (frame.width + 1) / 2 * (format_ == FrameFormat::kI420 ? 1 : 2);
+  auto check_plane = [&](const std::array<int64_t, 2>& plane) {
+    if (plane[0] < chroma_rows || plane[1] < chroma_bytes) {
+      ORTX_CXX_API_THROW(MakeString("[FrameNormalize]: The chroma plane of [", plane[0], ", ", plane[1],
+                                    "] is smaller than [", chroma_rows, ", ", chroma_bytes, "]."),
+                         ORT_INVALID_ARGUMENT);
+    }
+  };
+  if (contiguous) {
+    // the chroma planes after the rows of the Y plane, of its stride, or the half of it for U and V of I420
+    const size_t stride = frame.strides[0] / (format_ == FrameFormat::kI420 ? 2 : 1);
+    const int64_t rows = format_ == FrameFormat::kI420 ? 2 * chroma_rows : chroma_rows;
+    if (static_cast<int64_t>(stride) < chroma_bytes ||
+        frame.height * size[1] + rows * static_cast<int64_t>(stride) > size[0] * size[1]) {
+      ORTX_CXX_API_THROW("[FrameNormalize]: The chroma planes don't fit after the Y plane.", ORT_INVALID_ARGUMENT);
+    }
+    frame.planes[1] = frame.planes[0] + frame.height * size[1];
+    frame.planes[2] = frame.planes[1] + chroma_rows * static_cast<int64_t>(stride);
+    frame.strides[1] = frame.strides[2] = stride;
+    return frame;
+  }
+
+  const auto chroma_size = PlaneSize(*chroma);
+  check_plane(chroma_size);
+  frame.planes[1] = chroma->Data();
+  frame.strides[1] = static_cast<size_t>(chroma_size[1]);
+  if (format_ == FrameFormat::kI420) {
+    const auto* v_plane = OptionalPlane(plane2);
+    if (v_plane == nullptr) {
+      ORTX_CXX_API_THROW("[FrameNormalize]: The frame of I420 requires the V plane.", ORT_INVALID_ARGUMENT);
+    }
+    const auto v_size = PlaneSize(*v_plane);
+    check_plane(v_size);
+    frame.planes[2] = v_plane->Data();
+    frame.strides[2] = static_cast<size_t>(v_size[1]);
+  }
+  return frame;
+}
+
+template <typename T>
+void KernelFrameNormalize::Normalize(const ortc::Tensor<uint8_t>& plane0,
+                                     std::optional<const ortc::Tensor<uint8_t>*> plane1,
+                                     std::optional<const ortc::Tensor<uint8_t>*> plane2,
+                                     std::optional<const ortc::Tensor<int64_t>*> metadata, ortc::Tensor<T>& output,
+                                     std::optional<ortc::Tensor<float>*> transform) const {
+  const CameraFrame frame = ReadFrame(plane0, plane1, plane2, metadata);
+  const int64_t height = frame.Height();
+  const int64_t width = frame.Width();
+  const auto resized = ResizedSize(height, width);
+  const auto size = TransformedImageLayout(resized, options_).canvas;
+  T* data = output.Allocate(OutputShape(plane0.Shape(), size));
+  TransformRows(
+      [&frame](int64_t row, int64_t first_column, size_t count, uint8_t* scratch) {
+        return frame.ReadRow(row, first_column, count, scratch);
+      },
+      height, width, resized, data);
+
+  if (transform.has_value() && *transform != nullptr) {
+    WriteTransform(plane0.Shape(), ImageTransformParameters(height, width, resized, options_), **transform);
+  }
+}
+
+#define FRAME_NORMALIZE_OUTPUT(T)                                                                                   \
+  template void KernelFrameNormalize::Normalize(                                                                    \
+      const ortc::Tensor<uint8_t>&, std::optional<const ortc::Tensor<uint8_t>*>,                                    \
+      std::optional<const ortc::Tensor<uint8_t>*>, std::optional<const ortc::Tensor<int64_t>*>, ortc::Tensor<T>&, \
+      std::optional<ortc::Tensor<float>*>) const;
+
+FRAME_NORMALIZE_OUTPUT(float)
+FRAME_NORMALIZE_OUTPUT(ortc::MFloat16)
+FRAME_NORMALIZE_OUTPUT(uint8_t)
+FRAME_NORMALIZE_OUTPUT(int8_t)
+
+}  // namespace ort_extensions
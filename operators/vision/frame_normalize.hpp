@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "camera_frame.hpp"
+#include "image_normalize.hpp"
+
+#include <optional>
+
+namespace ort_extensions {
+
+// ImageNormalize of a raw frame of a camera, so a frame of NV12, NV21, I420 or BGRA isn't encoded into an image for
+// DecodeImage: the pixels of the rows which the resize reads are converted, rotated and filtered in the same pass
+// over the rows of the output, without an intermediate image. The planes are of [rows, stride], the Y plane or the
+// pixels of BGRA and RGBA, the UV plane or the U plane, and the V plane of I420, and the YUV planes follow each other
+// in the first one if the others are empty or absent, like the buffers of the camera of Android. The optional
+// metadata is the (width, height, rotation) of the frame, where 0 is the size of the first plane, and the rotation is
+// clockwise into the upright image, from the orientation of the device.
+struct KernelFrameNormalize : KernelImageNormalize {
+  KernelFrameNormalize(const OrtApi& api, const OrtKernelInfo& info);
+
+  void Compute(const ortc::Tensor<uint8_t>& plane0, std::optional<const ortc::Tensor<uint8_t>*> plane1,
+               std::optional<const ortc::Tensor<uint8_t>*> plane2,
+               std::optional<const ortc::Tensor<int64_t>*> metadata, ortc::Tensor<float>& output,
+               std::optional<ortc::Tensor<float>*> transform) const {
+    Normalize(plane0, plane1, plane2, metadata, output, transform);
+  }
+
+  // of the outputs of float, ortc::MFloat16, uint8_t and int8_t
+  template <typename T>
+  void Normalize(const ortc::Tensor<uint8_t>& plane0, std::optional<const ortc::Tensor<uint8_t>*> plane1,
+                 std::optional<const ortc::Tensor<uint8_t>*> plane2,
+                 std::optional<const ortc::Tensor<int64_t>*> metadata, ortc::Tensor<T>& output,
+                 std::optional<ortc::Tensor<float>*> transform) const;
+
+ private:
+  CameraFrame ReadFrame(const ortc::Tensor<uint8_t>& plane0, std::optional<const ortc::Tensor<uint8_t>*> plane1,
+                        std::optional<const ortc::Tensor<uint8_t>*> plane2,
+                        std::optional<const ortc::Tensor<int64_t>*> metadata) const;
+
+  FrameFormat format_{FrameFormat::kNV12};
+  YuvCoefficients coefficients_{YuvCoefficients::Bt601(false)};
+};
+
+template <typename T>
+struct KernelNormalizeOutput<KernelFrameNormalize, T> : KernelFrameNormalize {
+  using KernelFrameNormalize::KernelFrameNormalize;
+
+  void Compute(const ortc::Tensor<uint8_t>& plane0, std::optional<const ortc::Tensor<uint8_t>*> plane1,
+               std::optional<const ortc::Tensor<uint8_t>*> plane2,
+               std::optional<const ortc::Tensor<int64_t>*> metadata, ortc::Tensor<T>& output,
+               std::optional<ortc::Tensor<float>*> transform) const {
+    Normalize(plane0, plane1, plane2, metadata, output, transform);
+  }
+};
+
+template <typename T>
+using KernelFrameNormalizeOutput = KernelNormalizeOutput<KernelFrameNormalize, T>;
+
+}  // namespace ort_extensions
@@ -0,0 +1,275 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "image_codecs.h"
+
+#include <csetjmp>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include "ocos.h"
+#include "string_utils.h"
+
+#ifdef ENABLE_NATIVE_JPEG
+#include <jpeglib.h>
+#endif
+#ifdef ENABLE_NATIVE_PNG
+#include <png.h>
+#endif
+#ifdef ENABLE_NATIVE_WEBP
+#include <webp/decode.h>
+#endif
+
+namespace ort_extensions {
+
+namespace {
+
+[[noreturn]] void ThrowDecodeError(const char* op_name, const char* message) {
+  ORTX_CXX_API_THROW(MakeString(op_name, " Invalid input. Failed to decode image: ", message), ORT_INVALID_ARGUMENT);
+}
+
+#ifdef ENABLE_NATIVE_JPEG
+
+// The errors of libjpeg jump back to the decoder, which throws after the decompressor is destroyed.
+struct JpegErrorManager {
+  jpeg_error_mgr manager;
+  std::jmp_buf jump;
+  char message[JMSG_LENGTH_MAX];
+};
+
+void OnJpegError(j_common_ptr info) {
+  auto* error = reinterpret_cast<JpegErrorManager*>(info->err);
+  (*info->err->format_message)(info, error->message);
+  std::longjmp(error->jump, 1);
+}
+
+void OnJpegMessage(j_common_ptr) {}
+
+// Only the objects of C are between setjmp and longjmp.
+bool DecodeJpeg(const uint8_t* encoded, size_t size, const ImageHeader& header, int64_t scale_denominator,
+                int64_t channels, bool rgb, bool fast, uint8_t* data, size_t step, const char* op_name) {
+  if (header.orientation != 1) {
+    return false;  // OpenCV rotates the pixels by the EXIF orientation
+  }
+  jpeg_decompress_struct info;
+  JpegErrorManager error;
+  info.err = jpeg_std_error(&error.manager);
+  error.manager.error_exit = OnJpegError;
+  error.manager.output_message = OnJpegMessage;
+  if (setjmp(error.jump)) {
+    jpeg_destroy_decompress(&info);
+    ThrowDecodeError(op_name, error.message);
+  }
+  jpeg_create_decompress(&info);
+  jpeg_mem_src(&info, encoded, static_cast<unsigned long>(size));
+  jpeg_read_header(&info, TRUE);
+  if (info.jpeg_color_space == JCS_CMYK || info.jpeg_color_space == JCS_YCCK) {
+    jpeg_destroy_decompress(&info);
+    return false;
+  }
+
+  if (channels == 1) {
+    info.out_color_space = JCS_GRAYSCALE;
+  } else {
+#ifdef JCS_EXTENSIONS
+    info.out_color_space = rgb ? JCS_RGB : JCS_EXT_BGR;
+#else
+    info.out_color_space = JCS_RGB;
+#endif
+  }
+  info.scale_num = 1;
+  info.scale_denom = static_cast<unsigned int>(scale_denominator);
+  if (fast) {
+    info.dct_method = JDCT_IFAST;
+    info.do_fancy_upsampling = FALSE;
+  }
+  jpeg_calc_output_dimensions(&info);
+  if (static_cast<int64_t>(info.output_height) != header.height ||
+      static_cast<int64_t>(info.output_width) != header.width ||
+      static_cast<int64_t>(info.out_color_components) != channels) {
+    jpeg_destroy_decompress(&info);
+    return false;
+  }
+
+  jpeg_start_decompress(&info);
+  while (info.output_scanline < info.output_height) {
+    JSAMPROW row = data + static_cast<size_t>(info.output_scanline) * step;
+    jpeg_read_scanlines(&info, &row, 1);
+  }
+  jpeg_finish_decompress(&info);
+  jpeg_destroy_decompress(&info);
+
+#ifndef JCS_EXTENSIONS
+  if (channels == 3 && !rgb) {
+    for (int64_t y = 0; y < header.height; ++y) {
+      uint8_t* p = data + y * step;
+      for (int64_t x = 0; x < header.width; ++x, p += 3) {
+        std::swap(p[0], p[2]);
+      }
+    }
+  }
+#endif
+  return true;
+}
+
+#endif  // ENABLE_NATIVE_JPEG
+
+#ifdef ENABLE_NATIVE_PNG
+
+struct PngSource {
+  const uint8_t* data;
+  size_t size;
+  size_t offset;
+  char message[256];
+};
+
+void ReadPng(png_structp png, png_bytep out, png_size_t count) {
+  auto* source = static_cast<PngSource*>(png_get_io_ptr(png));
+  if (count > source->size - source->offset) {
+    png_error(png, "the stream is truncated");
+  }
+  std::memcpy(out, source->data + source->offset, count);
+  source->offset += count;
+}
+
+void OnPngError(png_structp png, png_const_charp message) {
+  auto* source = static_cast<PngSource*>(png_get_error_ptr(png));
+  std::snprintf(source->message, sizeof(source->message), "%s", message);
+  png_longjmp(png, 1);
+}
+
+void OnPngWarning(png_structp, png_const_charp) {}
+
+// The transforms of the PNG decoder of OpenCV, into 8 bits without the alpha.
+bool DecodePng(const uint8_t* encoded, size_t size, const ImageHeader& header, int64_t channels, bool rgb,
+               uint8_t* data, size_t step, const char* op_name) {
+  PngSource source{encoded, size, 0, {}};
+  png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, &source, OnPngError, OnPngWarning);
+  if (png == nullptr) {
+    return false;
+  }
+  png_infop info = png_create_info_struct(png);
+  if (info == nullptr || setjmp(png_jmpbuf(png))) {
+    png_destroy_read_struct(&png, &info, nullptr);
+    ThrowDecodeError(op_name, source.message);
+  }
+  png_set_read_fn(png, &source, ReadPng);
+  png_read_info(png, info);
+  const int bit_depth = png_get_bit_depth(png, info);
+  const int color_type = png_get_color_type(png, info);
+  const bool color = (color_type & PNG_COLOR_MASK_COLOR) != 0;
+  if (static_cast<int64_t>(png_get_image_height(png, info)) != header.height ||
+      static_cast<int64_t>(png_get_image_width(png, info)) != header.width || (channels == 1 && color)) {
+    // OpenCV converts the color pixels into gray by its own weights
+    png_destroy_read_struct(&png, &info, nullptr);
+    return false;
+  }
+
+  if (bit_depth == 16) {
+    png_set_strip_16(png);
+  }
+  png_set_strip_alpha(png);
+  if (color_type == PNG_COLOR_TYPE_PALETTE) {
+    png_set_palette_to_rgb(png);
+  }
+  if (!color && bit_depth < 8) {
+    png_set_expand_gray_1_2_4_to_8(png);
+  }
+  if (!color && channels == 3) {
+    png_set_gray_to_rgb(png);
+  }
+  if (channels == 3 && !rgb) {
+    png_set_bgr(png);
+  }
+  const int passes = png_set_interlace_handling(png);
+  png_read_update_info(png, info);
+  for (int pass = 0; pass < passes; ++pass) {
+    for (int64_t y = 0; y < header.height; ++y) {
+      png_read_row(png, data + static_cast<size_t>(y) * step, nullptr);
+    }
+  }
+  png_read_end(png, nullptr);
+  png_destroy_read_struct(&png, &info, nullptr);
+  return true;
+}
+
+#endif  // ENABLE_NATIVE_PNG
+
+#ifdef ENABLE_NATIVE_WEBP
+
+bool DecodeWebp(const uint8_t* encoded, size_t size, const ImageHeader& header, int64_t channels, bool rgb,
+                bool fast, uint8_t* data, size_t step, const char* op_name) {
+  WebPDecoderConfig config;
+  if (channels != 3 || !WebPInitDecoderConfig(&config) ||
+      WebPGetFeatures(encoded, size, &config.input) != VP8_STATUS_OK || config.input.has_animation ||
+      config.input.height != header.height || config.input.width != header.width) {
+    return false;
+  }
+  config.output.colorspace = rgb ? MODE_RGB : MODE_BGR;
+  config.output.is_external_memory = 1;
+  config.output.u.RGBA.rgba = data;
+  config.output.u.RGBA.stride = static_cast<int>(step);
+  config.output.u.RGBA.size = static_cast<size_t>(header.height) * step;
+  if (fast) {
+    config.options.no_fancy_upsampling = 1;
+  }
+  const VP8StatusCode status = WebPDecode(encoded, size, &config);
+  WebPFreeDecBuffer(&config.output);
+  if (status != VP8_STATUS_OK) {
+    ThrowDecodeError(op_name, MakeString("the status of libwebp ", static_cast<int>(status)).c_str());
+  }
+  return true;
+}
+
+#endif  // ENABLE_NATIVE_WEBP
+
+}  // namespace
+
+bool NativeImageCodecs::HasJpeg() {
+#ifdef ENABLE_NATIVE_JPEG
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool NativeImageCodecs::HasPng() {
+#ifdef ENABLE_NATIVE_PNG
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool NativeImageCodecs::HasWebp() {
+#ifdef ENABLE_NATIVE_WEBP
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool NativeDecodeImage(const uint8_t* encoded, size_t size, const ImageHeader& header, int64_t scale_denominator,
+                       int64_t channels, bool rgb, bool fast, uint8_t* data, size_t step, const char* op_name) {
+  switch (header.format) {
+#ifdef ENABLE_NATIVE_JPEG
+    case ImageHeader::Format::kJpeg:
+      return DecodeJpeg(encoded, size, header, scale_denominator, channels, rgb, fast, data, step, op_name);
+#endif
+#ifdef ENABLE_NATIVE_PNG
+    case ImageHeader::Format::kPng:
+      return scale_denominator == 1 && DecodePng(encoded, size, header, channels, rgb, data, step, op_name);
+#endif
+#ifdef ENABLE_NATIVE_WEBP
+    case ImageHeader::Format::kWebp:
+      return scale_denominator == 1 && DecodeWebp(encoded, size, header, channels, rgb, fast, data, step, op_name);
+#endif
+    default:
+      (void)encoded, (void)size, (void)scale_denominator, (void)channels, (void)rgb, (void)fast, (void)data,
+          (void)step, (void)op_name;
+      return false;
+  }
+}
+
+}  // namespace ort_extensions
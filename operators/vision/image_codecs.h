@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "image_header.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ort_extensions {
+
+// The decoders of the build with OCOS_ENABLE_NATIVE_IMAGE_CODECS, which link libjpeg-turbo, libpng and libwebp
+// directly, and are tried before the codecs of OpenCV for their formats.
+struct NativeImageCodecs {
+  static bool HasJpeg();
+  static bool HasPng();
+  static bool HasWebp();
+};
+
+// Decodes the image with the header of the size of the decoded image, which is reduced by the scaled IDCT of the
+// denominator, into the pixels of gray (1 channel), BGR or RGB in the rows of step bytes of data, by a native
+// decoder of its format. fast trades the accuracy for the speed, by the fast integer IDCT of JPEG and no fancy
+// upsampling of the chroma of JPEG and WebP. Returns false if no native decoder is linked for the format, or it
+// would decode the image unlike OpenCV, like an EXIF orientation, a CMYK JPEG or a color PNG in gray, in which case
+// nothing is written; an invalid stream of a native decoder throws.
+bool NativeDecodeImage(const uint8_t* encoded, size_t size, const ImageHeader& header, int64_t scale_denominator,
+                       int64_t channels, bool rgb, bool fast, uint8_t* data, size_t step, const char* op_name);
+
+}  // namespace ort_extensions
@@ -0,0 +1,273 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "string_utils.h"
+#include "image_transform.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace ort_extensions {
+
+// Prepares the decoded BGR pixels of [height, width, 3], or the images of one size of [batch, height, width, 3],
+// for a model: the TransformImage of DecodeImageNormalize without the decoding, into the float output of
+// [3, h, w] or [batch, 3, h, w]. Its attributes are the ones of DecodeImageNormalize, and it has a kernel of the
+// CUDA execution provider too, so the uint8 pixels are uploaded to the device and transformed there. The optional
+// transform output is the (scale_x, scale_y, offset_x, offset_y) of ImageTransformParameters of [4], or [batch, 4].
+// With tile_size, the image is resized into the grid of SelectTileGrid and written as its tiles, followed by the
+// thumbnail of the whole image if there's more than one, and with patch_size, every tile or the output is written as
+// its patches. The output is of float, or of float16 or of uint8 or int8 in the kernels of KernelNormalizeOutput.
+struct KernelImageNormalize : BaseKernel {
+  KernelImageNormalize(const OrtApi& api, const OrtKernelInfo& info, const char* op_name = "ImageNormalize")
+      : BaseKernel(api, info), op_name_(op_name) {
+    if (TryToGetAttribute("resize_to", options_.resize_to)) {
+      if (options_.resize_to.size() == 1) {
+        options_.resize_to.push_back(options_.resize_to[0]);
+      }
+      if (options_.resize_to.size() != 2 || options_.resize_to[0] <= 0 || options_.resize_to[1] <= 0) {
+        ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: resize_to should be a positive size or [height, width]."),
+                           ORT_INVALID_ARGUMENT);
+      }
+    }
+    std::string policy = TryToGetAttributeWithDefault<std::string>("policy", "not_smaller");
+    if (policy != "not_smaller" && policy != "not_larger") {
+      ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: Unknown resize policy: ", policy), ORT_INVALID_ARGUMENT);
+    }
+    options_.not_larger = policy == "not_larger";
+
+    std::string resample = TryToGetAttributeWithDefault<std::string>("resample", "bilinear");
+    if (resample == "bilinear") {
+      options_.filter = ResampleFilter::kBilinear;
+    } else if (resample == "bicubic") {
+      options_.filter = ResampleFilter::kBicubic;
+    } else if (resample == "lanczos") {
+      options_.filter = ResampleFilter::kLanczos;
+    } else {
+      ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: Unknown resample filter: ", resample), ORT_INVALID_ARGUMENT);
+    }
+
+    if (TryToGetAttribute("crop", options_.crop) &&
+        (options_.crop.size() != 2 || options_.crop[0] <= 0 || options_.crop[1] <= 0)) {
+      ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: crop should be [height, width]."), ORT_INVALID_ARGUMENT);
+    }
+
+    if (TryToGetAttribute("letterbox", options_.letterbox)) {
+      if (options_.letterbox.size() == 1) {
+        options_.letterbox.push_back(options_.letterbox[0]);
+      }
+      if (options_.letterbox.size() != 2 || options_.letterbox[0] <= 0 || options_.letterbox[1] <= 0) {
+        ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: letterbox should be a positive size or [height, width]."),
+                           ORT_INVALID_ARGUMENT);
+      }
+      if (!options_.resize_to.empty() || !options_.crop.empty()) {
+        ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: letterbox replaces resize_to and crop."),
+                           ORT_INVALID_ARGUMENT);
+      }
+    }
+    options_.pad_value = TryToGetAttributeWithDefault<float>("pad_value", options_.pad_value);
+
+    options_.tile_size = TryToGetAttributeWithDefault<int64_t>("tile_size", 0);
+    options_.patch_size = TryToGetAttributeWithDefault<int64_t>("patch_size", 0);
+    min_tiles_ = TryToGetAttributeWithDefault<int64_t>("min_tiles", 1);
+    max_tiles_ = TryToGetAttributeWithDefault<int64_t>("max_tiles", 12);
+    thumbnail_ = TryToGetAttributeWithDefault<int64_t>("thumbnail", 1) != 0;
+    if (options_.tile_size < 0 || options_.patch_size < 0 ||
+        (options_.tile_size > 0 && options_.patch_size > 0 && options_.tile_size % options_.patch_size != 0)) {
+      ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: tile_size and patch_size should be positive, and tile_size a "
+                                    "multiple of patch_size."),
+                         ORT_INVALID_ARGUMENT);
+    }
+    if (options_.tile_size > 0) {
+      if (!options_.resize_to.empty() || !options_.crop.empty() || !options_.letterbox.empty()) {
+        ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: tile_size replaces resize_to, crop and letterbox."),
+                           ORT_INVALID_ARGUMENT);
+      }
+      if (min_tiles_ < 1 || max_tiles_ < min_tiles_) {
+        ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: min_tiles should be positive and not more than max_tiles."),
+                           ORT_INVALID_ARGUMENT);
+      }
+    }
+
+    options_.rescale = TryToGetAttributeWithDefault<float>("rescale_factor", 1.0f / 255);
+    std::vector<float> mean;
+    std::vector<float> std;
+    TryToGetAttribute("mean", mean);
+    TryToGetAttribute("std", std);
+    if (!ReadChannelValues(mean, options_.mean) || !ReadChannelValues(std, options_.std) ||
+        std::any_of(options_.std.begin(), options_.std.end(), [](float v) { return v == 0.0f; })) {
+      ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: mean and std should have 1 or 3 values, and std no zero."),
+                         ORT_INVALID_ARGUMENT);
+    }
+
+    std::string color_space = TryToGetAttributeWithDefault<std::string>("color_space", "RGB");
+    if (color_space != "RGB" && color_space != "BGR") {
+      ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: Unknown color space: ", color_space), ORT_INVALID_ARGUMENT);
+    }
+    options_.swap_rb = color_space == "RGB";
+
+    options_.output_scale = TryToGetAttributeWithDefault<float>("output_scale", 1.0f);
+    options_.output_zero_point =
+        static_cast<int32_t>(TryToGetAttributeWithDefault<int64_t>("output_zero_point", 0));
+    if (!(options_.output_scale > 0.0f)) {
+      ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: output_scale should be positive."), ORT_INVALID_ARGUMENT);
+    }
+
+    num_threads_ = ReadNumThreadsAttribute(*this);
+  }
+
+  void Compute(const ortc::Tensor<uint8_t>& input, ortc::Tensor<float>& output,
+               std::optional<ortc::Tensor<float>*> transform) const {
+    Normalize(input, output, transform);
+  }
+
+  template <typename T>
+  void Normalize(const ortc::Tensor<uint8_t>& input, ortc::Tensor<T>& output,
+                 std::optional<ortc::Tensor<float>*> transform) const {
+    const auto& dims = input.Shape();
+    const auto image = ImageSize(dims);
+    const auto resized = ResizedSize(image[1], image[2]);
+    const auto size = TransformedImageLayout(resized, options_).canvas;
+    T* data = output.Allocate(OutputShape(dims, size));
+    const uint8_t* pixels = input.Data();
+    const size_t stride = static_cast<size_t>(image[2] * 3);
+    const size_t image_size = static_cast<size_t>(image[1]) * stride;
+    const size_t output_size = ImageOutputSize(size);
+    for (int64_t n = 0; n < image[0]; ++n) {
+      const uint8_t* bgr = pixels + n * image_size;
+      TransformRows(
+          [bgr, stride](int64_t row, int64_t first_column, size_t, uint8_t*) {
+            return bgr + static_cast<size_t>(row) * stride + static_cast<size_t>(first_column) * 3;
+          },
+          image[1], image[2], resized, data + n * output_size);
+    }
+    if (transform.has_value() && *transform != nullptr) {
+      WriteTransform(dims, ImageTransformParameters(image[1], image[2], resized, options_), **transform);
+    }
+  }
+
+ protected:
+  // {batch, height, width} of the pixels of [height, width, 3] or [batch, height, width, 3].
+  std::array<int64_t, 3> ImageSize(const std::vector<int64_t>& dims) const {
+    const size_t rank = dims.size();
+    if ((rank != 3 && rank != 4) || dims.back() != 3 || dims[rank - 3] <= 0 || dims[rank - 2] <= 0) {
+      ORTX_CXX_API_THROW(MakeString("[", op_name_, "]: Expect the BGR pixels of [height, width, 3] or "
+                                    "[batch, height, width, 3]."),
+                         ORT_INVALID_ARGUMENT);
+    }
+    return {rank == 4 ? dims[0] : 1, dims[rank - 3], dims[rank - 2]};
+  }
+
+  // The size which the image is resized to, or the grid of the tiles of tile_size.
+  std::array<int64_t, 2> ResizedSize(int64_t height, int64_t width) const {
+    if (options_.tile_size == 0) {
+      return ResizedImageSize(height, width, options_);
+    }
+    const auto grid = SelectTileGrid(height, width, options_.tile_size, min_tiles_, max_tiles_);
+    return {grid[0] * options_.tile_size, grid[1] * options_.tile_size};
+  }
+
+  // Whether the tiles of the output of size are followed by the thumbnail of the image.
+  bool HasThumbnail(const std::array<int64_t, 2>& size) const {
+    return options_.tile_size > 0 && thumbnail_ && size[0] * size[1] > options_.tile_size * options_.tile_size;
+  }
+
+  // The floats of the output of an image of the transformed size, with the thumbnail.
+  size_t ImageOutputSize(const std::array<int64_t, 2>& size) const {
+    const int64_t thumbnail = HasThumbnail(size) ? options_.tile_size * options_.tile_size : 0;
+    return static_cast<size_t>((size[0] * size[1] + thumbnail) * 3);
+  }
+
+  // [3, height, width] of the transformed size, [tiles, 3, tile_size, tile_size] of its tiles and the thumbnail, or
+  // [patches, 3 * patch_size * patch_size] of the patches of it or of every tile, with the batch of a batch input.
+  std::vector<int64_t> OutputShape(const std::vector<int64_t>& dims, const std::array<int64_t, 2>& size) const {
+    std::vector<int64_t> shape;
+    if (dims.size() == 4) {
+      shape.push_back(dims[0]);
+    }
+    const int64_t tile_size = options_.tile_size;
+    if (tile_size > 0) {
+      shape.push_back(size[0] / tile_size * (size[1] / tile_size) + (HasThumbnail(size) ? 1 : 0));
+    }
+    const int64_t height = tile_size > 0 ? tile_size : size[0];
+    const int64_t width = tile_size > 0 ? tile_size : size[1];
+    const int64_t patch_size = options_.patch_size;
+    if (patch_size > 0) {
+      shape.insert(shape.end(), {height / patch_size * (width / patch_size), 3 * patch_size * patch_size});
+    } else {
+      shape.insert(shape.end(), {3, height, width});
+    }
+    return shape;
+  }
+
+  // TransformImageRows of an image into its output of ImageOutputSize, and the thumbnail after its tiles.
+  template <typename RowReader, typename T>
+  void TransformRows(const RowReader& read_row, int64_t height, int64_t width, const std::array<int64_t, 2>& resized,
+                     T* output) const {
+    TransformImageRows(read_row, height, width, resized, options_, output, num_threads_, &filters_);
+    const auto size = TransformedImageLayout(resized, options_).canvas;
+    if (HasThumbnail(size)) {
+      TransformImageRows(read_row, height, width, {options_.tile_size, options_.tile_size}, options_,
+                         output + size[0] * size[1] * 3, num_threads_, &filters_);
+    }
+  }
+
+  // The parameters of the images of one size into [4], or [batch, 4] for a batch input.
+  static void WriteTransform(const std::vector<int64_t>& dims, const std::array<float, 4>& parameters,
+                             ortc::Tensor<float>& transform) {
+    std::vector<int64_t> shape{4};
+    if (dims.size() == 4) {
+      shape.insert(shape.begin(), dims[0]);
+    }
+    float* data = transform.Allocate(shape);
+    const int64_t batch = dims.size() == 4 ? dims[0] : 1;
+    for (int64_t n = 0; n < batch; ++n) {
+      std::copy(parameters.begin(), parameters.end(), data + n * 4);
+    }
+  }
+
+  ImageTransformOptions options_;
+  size_t num_threads_{1};
+  ResizeFilterCache filters_;
+  int64_t min_tiles_{1};
+  int64_t max_tiles_{12};
+  bool thumbnail_{true};
+
+ private:
+  static bool ReadChannelValues(const std::vector<float>& values, std::array<float, 3>& channels) {
+    if (values.size() == 1) {
+      channels.fill(values[0]);
+    } else if (values.size() == 3) {
+      std::copy(values.begin(), values.end(), channels.begin());
+    } else if (!values.empty()) {
+      return false;
+    }
+    return true;
+  }
+
+  const char* op_name_;
+};
+
+// A kernel of the normalization of the images into the output of T, the float16 of ortc::MFloat16, or uint8 or
+// int8 quantized by output_scale and output_zero_point, instead of a Cast or a QuantizeLinear which reads the float
+// output again. It's registered with the name of the float kernel, and selected by the type of the output in the
+// graph.
+template <typename Kernel, typename T>
+struct KernelNormalizeOutput : Kernel {
+  using Kernel::Kernel;
+
+  void Compute(const ortc::Tensor<uint8_t>& input, ortc::Tensor<T>& output,
+               std::optional<ortc::Tensor<float>*> transform) const {
+    Kernel::Normalize(input, output, transform);
+  }
+};
+
+template <typename T>
+using KernelImageNormalizeOutput = KernelNormalizeOutput<KernelImageNormalize, T>;
+
+}  // namespace ort_extensions
@@ -0,0 +1,689 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "ocos.h"
+#include "lru_cache.h"
+#include "parallel_for.h"
+#include "string_utils.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMAGE_USE_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define IMAGE_USE_NEON
+#include <arm_neon.h>
+#endif
+#if defined(__F16C__) || defined(__AVX2__)
+#define IMAGE_USE_F16C
+#include <immintrin.h>
+#endif
+
+namespace ort_extensions {
+
+// The kernels of the resize of PIL, Image.BILINEAR, Image.BICUBIC and Image.LANCZOS, which the image processors of
+// the Hugging Face models resize with.
+enum class ResampleFilter { kBilinear, kBicubic, kLanczos };
+
+namespace detail {
+
+// The support of the kernel of the filter, the half of its width at the scale of 1.
+inline double ResampleSupport(ResampleFilter filter) {
+  switch (filter) {
+    case ResampleFilter::kBicubic:
+      return 2.0;
+    case ResampleFilter::kLanczos:
+      return 3.0;
+    default:
+      return 1.0;
+  }
+}
+
+inline double Sinc(double x) {
+  if (x == 0.0) {
+    return 1.0;
+  }
+  x *= 3.14159265358979323846;
+  return std::sin(x) / x;
+}
+
+// The kernel of the filter at x, the cubic of a = -0.5 and the Lanczos of 3 lobes of PIL.
+inline double ResampleKernel(ResampleFilter filter, double x) {
+  x = std::abs(x);
+  switch (filter) {
+    case ResampleFilter::kBicubic: {
+      constexpr double a = -0.5;
+      if (x < 1.0) {
+        return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+      }
+      return x < 2.0 ? (((x - 5.0) * x + 8.0) * x - 4.0) * a : 0.0;
+    }
+    case ResampleFilter::kLanczos:
+      return x < 3.0 ? Sinc(x) * Sinc(x / 3.0) : 0.0;
+    default:
+      return x < 1.0 ? 1.0 - x : 0.0;
+  }
+}
+
+}  // namespace detail
+
+// The filter of a resize of one axis, the filters with antialiasing of PIL, whose bilinear one is the ONNX Resize of
+// opset 18 too: every output pixel is the weighted mean of the input pixels under the kernel of the filter, which is
+// stretched by the scale when the image is reduced, so a triangle is as wide as two output pixels, or two input pixels
+// when the image is enlarged. Only the output pixels of [first, first + count) are computed.
+class ResizeFilter {
+ public:
+  ResizeFilter(int64_t in_size, int64_t out_size, int64_t first, int64_t count,
+               ResampleFilter filter = ResampleFilter::kBilinear) {
+    const double scale = static_cast<double>(in_size) / static_cast<double>(out_size);
+    const double filter_scale = std::max(scale, 1.0);
+    const double support = detail::ResampleSupport(filter) * filter_scale;
+    taps_ = static_cast<size_t>(std::ceil(support)) * 2 + 1;
+    starts_.resize(static_cast<size_t>(count));
+    sizes_.resize(static_cast<size_t>(count));
+    weights_.assign(static_cast<size_t>(count) * taps_, 0.0f);
+
+    std::vector<double> weights(taps_);
+    for (int64_t i = 0; i < count; ++i) {
+      const double center = (static_cast<double>(first + i) + 0.5) * scale;
+      int64_t begin = std::max<int64_t>(static_cast<int64_t>(center - support + 0.5), 0);
+      int64_t end = std::min<int64_t>(static_cast<int64_t>(center + support + 0.5), in_size);
+      double sum = 0.0;
+      for (int64_t j = begin; j < end; ++j) {
+        weights[j - begin] =
+            detail::ResampleKernel(filter, (static_cast<double>(j) - center + 0.5) / filter_scale);
+        sum += weights[j - begin];
+      }
+      // the pixels of no weight at both ends aren't read
+      size_t skip = 0;
+      while (begin + 1 < end && weights[skip] == 0.0) {
+        ++begin;
+        ++skip;
+      }
+      while (end - 1 > begin && weights[end - 1 - begin + skip] == 0.0) {
+        --end;
+      }
+      starts_[i] = begin;
+      sizes_[i] = static_cast<size_t>(end - begin);
+      for (size_t k = 0; k < sizes_[i]; ++k) {
+        weights_[i * taps_ + k] = static_cast<float>(sum != 0.0 ? weights[skip + k] / sum : 1.0);
+      }
+    }
+  }
+
+  int64_t Start(size_t i) const { return starts_[i]; }
+  size_t Size(size_t i) const { return sizes_[i]; }
+  const float* Weights(size_t i) const { return weights_.data() + i * taps_; }
+  size_t Taps() const { return taps_; }
+
+  // The input pixels [Start(0), End()) which the output pixels read.
+  int64_t End() const {
+    return starts_.empty() ? 0 : starts_.back() + static_cast<int64_t>(sizes_.back());
+  }
+
+  // the bytes of the filter for the budget of its cache
+  size_t MemoryBytes() const {
+    return sizeof(*this) + starts_.capacity() * sizeof(int64_t) + sizes_.capacity() * sizeof(size_t) +
+           weights_.capacity() * sizeof(float);
+  }
+
+ private:
+  size_t taps_;
+  std::vector<int64_t> starts_;
+  std::vector<size_t> sizes_;
+  std::vector<float> weights_;
+};
+
+// The filters of the resizes of a kernel by their sizes, which are reused across the calls: the images of a model
+// are mostly of a few sizes, and the weights of a large reduction by the bicubic or the Lanczos filter are many.
+class ResizeFilterCache {
+ public:
+  static constexpr size_t kDefaultCapacity = 16;
+
+  explicit ResizeFilterCache(size_t capacity = kDefaultCapacity) : cache_(capacity) {
+    cache_.SetStatsName("resize_filter_cache");
+  }
+
+  std::shared_ptr<const ResizeFilter> Get(int64_t in_size, int64_t out_size, int64_t first, int64_t count,
+                                          ResampleFilter filter) const {
+    const Key key{in_size, out_size, first, count, static_cast<int64_t>(filter)};
+    std::shared_ptr<const ResizeFilter> resize_filter;
+    if (!cache_.Lookup(key, resize_filter)) {
+      resize_filter = std::make_shared<const ResizeFilter>(in_size, out_size, first, count, filter);
+      cache_.Insert(key, resize_filter);
+    }
+    return resize_filter;
+  }
+
+ private:
+  using Key = std::array<int64_t, 5>;
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      size_t hash = 0;
+      for (int64_t value : key) {
+        hash = hash * 1000003 ^ std::hash<int64_t>{}(value);
+      }
+      return hash;
+    }
+  };
+
+  mutable LruCache<Key, std::shared_ptr<const ResizeFilter>, KeyHash> cache_;
+};
+
+// The options of TransformImage, the steps after the decoding of a model of images: the image is resized with its
+// aspect ratio kept, cropped at the center, or letterboxed, and every channel is normalized into
+// (x * rescale - mean) / std.
+struct ImageTransformOptions {
+  // {height, width} of the resize, in which no side is smaller than the size (or larger with not_larger), or {} not
+  // to resize
+  std::vector<int64_t> resize_to;
+  bool not_larger{};
+  std::vector<int64_t> crop;  // {height, width}, or {} not to crop
+  // {height, width} of the letterbox, the output into which the image is resized to fit and placed at the center of
+  // the padding of pad_value, as the input of the YOLO detection models, or {} not to pad; it replaces resize_to
+  std::vector<int64_t> letterbox;
+  float pad_value{114.0f};  // the pixel value of the padding before the normalization
+  float rescale{1.0f / 255};
+  std::array<float, 3> mean{0.0f, 0.0f, 0.0f};  // in the order of the output channels
+  std::array<float, 3> std{1.0f, 1.0f, 1.0f};
+  bool swap_rb{};  // RGB output of the BGR input
+  ResampleFilter filter{ResampleFilter::kBilinear};
+  // the size of the square tiles of the dynamic resolution models, into which the output is split in the row-major
+  // order, each of [3, tile_size, tile_size], or 0 not to tile
+  int64_t tile_size{};
+  // the size of the square patches of the vision transformers, into which every tile or the output is split in the
+  // row-major order, each of [3, patch_size, patch_size] flattened, or 0
+  int64_t patch_size{};
+  // the quantization of the uint8 or int8 output, round(x / output_scale) + output_zero_point of the normalized x,
+  // which is folded into the normalization
+  float output_scale{1.0f};
+  int32_t output_zero_point{};
+};
+
+// The size of the resized image, which is rounded like the Resize step of the pre/post processing tools.
+inline std::array<int64_t, 2> ResizedImageSize(int64_t height, int64_t width, const ImageTransformOptions& options) {
+  const bool letterbox = !options.letterbox.empty();
+  const auto& target = letterbox ? options.letterbox : options.resize_to;
+  if (target.empty()) {
+    return {height, width};
+  }
+  const double ratio_h = static_cast<double>(target[0]) / static_cast<double>(height);
+  const double ratio_w = static_cast<double>(target[1]) / static_cast<double>(width);
+  const double ratio = letterbox || options.not_larger ? std::min(ratio_h, ratio_w) : std::max(ratio_h, ratio_w);
+  return {std::max<int64_t>(1, std::llround(static_cast<double>(height) * ratio)),
+          std::max<int64_t>(1, std::llround(static_cast<double>(width) * ratio))};
+}
+
+// The size of the crop of the resized image, the output of TransformImage.
+inline std::array<int64_t, 2> CroppedImageSize(const std::array<int64_t, 2>& resized,
+                                               const ImageTransformOptions& options) {
+  if (options.crop.empty()) {
+    return resized;
+  }
+  if (options.crop[0] > resized[0] || options.crop[1] > resized[1]) {
+    ORTX_CXX_API_THROW(MakeString("[TransformImage]: The crop of ", options.crop[0], "x", options.crop[1],
+                                  " is larger than the resized image of ", resized[0], "x", resized[1], "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  return {options.crop[0], options.crop[1]};
+}
+
+// Where the resized image is in the output of TransformImage: its crop of size from (crop_top, crop_left) is
+// written at (pad_top, pad_left) of the output of canvas, which is the letterbox or the crop.
+struct ImageLayout {
+  std::array<int64_t, 2> size;
+  std::array<int64_t, 2> canvas;
+  int64_t crop_top;
+  int64_t crop_left;
+  int64_t pad_top;
+  int64_t pad_left;
+};
+
+inline ImageLayout TransformedImageLayout(const std::array<int64_t, 2>& resized,
+                                          const ImageTransformOptions& options) {
+  ImageLayout layout{};
+  layout.size = CroppedImageSize(resized, options);
+  layout.crop_top = (resized[0] - layout.size[0]) / 2;
+  layout.crop_left = (resized[1] - layout.size[1]) / 2;
+  layout.canvas = layout.size;
+  if (!options.letterbox.empty()) {
+    layout.canvas = {options.letterbox[0], options.letterbox[1]};
+    layout.pad_top = (layout.canvas[0] - layout.size[0]) / 2;
+    layout.pad_left = (layout.canvas[1] - layout.size[1]) / 2;
+  }
+  return layout;
+}
+
+// The size of the output of TransformImage.
+inline std::array<int64_t, 2> TransformedImageSize(int64_t height, int64_t width,
+                                                   const ImageTransformOptions& options) {
+  return TransformedImageLayout(ResizedImageSize(height, width, options), options).canvas;
+}
+
+// The (scale_x, scale_y, offset_x, offset_y) of TransformImage of the image of height x width, which is resized to
+// resized: the point (x, y) of the image is the point (x * scale_x + offset_x, y * scale_y + offset_y) of the
+// output, so a box of the output is mapped back to the image by the inverse.
+inline std::array<float, 4> ImageTransformParameters(int64_t height, int64_t width,
+                                                     const std::array<int64_t, 2>& resized,
+                                                     const ImageTransformOptions& options) {
+  const auto layout = TransformedImageLayout(resized, options);
+  return {static_cast<float>(static_cast<double>(resized[1]) / static_cast<double>(width)),
+          static_cast<float>(static_cast<double>(resized[0]) / static_cast<double>(height)),
+          static_cast<float>(layout.pad_left - layout.crop_left),
+          static_cast<float>(layout.pad_top - layout.crop_top)};
+}
+
+// Where the pixels of the canvas are written in the output: the channel c of the pixel (y, x) is at
+// rows[y] + columns[x] + c * channel_stride, in the planes of [3, height, width], or in the tiles and the patches of
+// the options, so the patches of a vision transformer are written without a Reshape and a Transpose of the output.
+struct ImageOutputLayout {
+  std::vector<size_t> rows;
+  std::vector<size_t> columns;
+  size_t channel_stride;
+};
+
+inline ImageOutputLayout TransformedOutputLayout(const std::array<int64_t, 2>& canvas,
+                                                 const ImageTransformOptions& options) {
+  const int64_t tile_height = options.tile_size > 0 ? options.tile_size : canvas[0];
+  const int64_t tile_width = options.tile_size > 0 ? options.tile_size : canvas[1];
+  const int64_t patch_height = options.patch_size > 0 ? options.patch_size : tile_height;
+  const int64_t patch_width = options.patch_size > 0 ? options.patch_size : tile_width;
+  if (canvas[0] % tile_height != 0 || canvas[1] % tile_width != 0 || tile_height % patch_height != 0 ||
+      tile_width % patch_width != 0) {
+    ORTX_CXX_API_THROW(MakeString("[TransformImage]: The output of ", canvas[0], "x", canvas[1],
+                                  " isn't split into the tiles of ", options.tile_size, " and the patches of ",
+                                  options.patch_size, "."),
+                       ORT_INVALID_ARGUMENT);
+  }
+  const size_t patch_size = static_cast<size_t>(patch_height * patch_width);
+  const size_t tile_size = static_cast<size_t>(tile_height * tile_width) * 3;
+  const size_t patches_per_row = static_cast<size_t>(tile_width / patch_width);
+  const size_t tiles_per_row = static_cast<size_t>(canvas[1] / tile_width);
+
+  ImageOutputLayout layout{};
+  layout.channel_stride = patch_size;
+  layout.rows.resize(static_cast<size_t>(canvas[0]));
+  for (int64_t y = 0; y < canvas[0]; ++y) {
+    const int64_t in_tile = y % tile_height;
+    layout.rows[y] = static_cast<size_t>(y / tile_height) * tiles_per_row * tile_size +
+                     static_cast<size_t>(in_tile / patch_height) * patches_per_row * patch_size * 3 +
+                     static_cast<size_t>(in_tile % patch_height * patch_width);
+  }
+  layout.columns.resize(static_cast<size_t>(canvas[1]));
+  for (int64_t x = 0; x < canvas[1]; ++x) {
+    const int64_t in_tile = x % tile_width;
+    layout.columns[x] = static_cast<size_t>(x / tile_width) * tile_size +
+                        static_cast<size_t>(in_tile / patch_width) * patch_size * 3 +
+                        static_cast<size_t>(in_tile % patch_width);
+  }
+  return layout;
+}
+
+// The grid of {rows, columns} of the tiles of a dynamic resolution model, like InternVL, into which the image of
+// height x width is resized: the one of [min_tiles, max_tiles] tiles whose aspect ratio is the closest to the one of
+// the image, or the larger one of the same ratio if the image has more than half of its pixels.
+inline std::array<int64_t, 2> SelectTileGrid(int64_t height, int64_t width, int64_t tile_size, int64_t min_tiles,
+                                             int64_t max_tiles) {
+  const double aspect_ratio = static_cast<double>(width) / static_cast<double>(height);
+  const double area = static_cast<double>(width) * static_cast<double>(height);
+  std::array<int64_t, 2> best{1, 1};
+  double best_difference = -1.0;
+  for (int64_t count = min_tiles; count <= max_tiles; ++count) {
+    for (int64_t columns = 1; columns <= count; ++columns) {
+      if (count % columns != 0) {
+        continue;
+      }
+      const int64_t rows = count / columns;
+      const double difference = std::abs(aspect_ratio - static_cast<double>(columns) / static_cast<double>(rows));
+      if (best_difference < 0.0 || difference < best_difference) {
+        best_difference = difference;
+        best = {rows, columns};
+      } else if (difference == best_difference &&
+                 area > 0.5 * static_cast<double>(tile_size * tile_size) * static_cast<double>(count)) {
+        best = {rows, columns};
+      }
+    }
+  }
+  return best;
+}
+
+namespace detail {
+
+// The float16 of the float, rounded to the nearest even.
+inline uint16_t FloatToHalf(float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  bits &= 0x7fffffff;
+  if (bits >= 0x7f800000) {  // infinity and NaN
+    return sign | 0x7c00 | (bits > 0x7f800000 ? 0x200 : 0);
+  }
+  if (bits >= 0x477ff000) {  // from 65520, which rounds to the infinity
+    return sign | 0x7c00;
+  }
+  uint32_t half;
+  uint32_t rest;
+  uint32_t halfway;
+  if (bits >= 0x38800000) {  // normal from 2^-14
+    half = (((bits >> 23) - 112) << 10) | ((bits >> 13) & 0x3ff);
+    rest = bits & 0x1fff;
+    halfway = 0x1000;
+  } else if (bits >= 0x33000000) {  // subnormal of the units of 2^-24 from its half
+    const uint32_t shift = 126 - (bits >> 23);
+    const uint32_t mantissa = (bits & 0x7fffff) | 0x800000;
+    half = mantissa >> shift;
+    rest = mantissa & ((1u << shift) - 1);
+    halfway = 1u << (shift - 1);
+  } else {
+    return sign;
+  }
+  if (rest > halfway || (rest == halfway && (half & 1) != 0)) {
+    ++half;  // which carries into the exponent
+  }
+  return sign | static_cast<uint16_t>(half);
+}
+
+// The element of the output of T of the normalized value, of which the quantized ones are rounded and saturated.
+template <typename T>
+T FromFloat(float value) {
+  if constexpr (std::is_same_v<T, ortc::MFloat16>) {
+    return {FloatToHalf(value)};
+  } else if constexpr (std::is_integral_v<T>) {
+    const float rounded = std::nearbyint(value);
+    return static_cast<T>(std::min(std::max(rounded, static_cast<float>(std::numeric_limits<T>::min())),
+                                   static_cast<float>(std::numeric_limits<T>::max())));
+  } else {
+    return value;
+  }
+}
+
+// Writes the 3 channels of bgr, of 4 lanes, into pixel[plane[c]].
+template <typename T>
+inline void StoreChannels(const float* bgr, const std::array<size_t, 3>& plane, T* pixel) {
+  for (size_t c = 0; c < 3; ++c) {
+    pixel[plane[c]] = FromFloat<T>(bgr[c]);
+  }
+}
+
+#if defined(IMAGE_USE_F16C) || (defined(IMAGE_USE_NEON) && (defined(__aarch64__) || defined(_M_ARM64)))
+// the lanes are converted at once by the instructions of F16C or NEON
+template <>
+inline void StoreChannels(const float* bgr, const std::array<size_t, 3>& plane, ortc::MFloat16* pixel) {
+  uint16_t halves[4];
+#if defined(IMAGE_USE_F16C)
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(halves), _mm_cvtps_ph(_mm_loadu_ps(bgr), _MM_FROUND_TO_NEAREST_INT));
+#else
+  vst1_u16(halves, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(bgr))));
+#endif
+  for (size_t c = 0; c < 3; ++c) {
+    pixel[plane[c]].value = halves[c];
+  }
+}
+#endif
+
+// row[j] += w * pixels[j] for j of [0, size)
+inline void AccumulatePixels(const uint8_t* pixels, float w, float* row, size_t size) {
+  size_t j = 0;
+#if defined(IMAGE_USE_SSE)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128 wv = _mm_set1_ps(w);
+  for (; j + 16 <= size; j += 16) {
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + j));
+    __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+    __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+    __m128 p0 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero));
+    __m128 p1 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero));
+    __m128 p2 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero));
+    __m128 p3 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero));
+    _mm_storeu_ps(row + j, _mm_add_ps(_mm_loadu_ps(row + j), _mm_mul_ps(p0, wv)));
+    _mm_storeu_ps(row + j + 4, _mm_add_ps(_mm_loadu_ps(row + j + 4), _mm_mul_ps(p1, wv)));
+    _mm_storeu_ps(row + j + 8, _mm_add_ps(_mm_loadu_ps(row + j + 8), _mm_mul_ps(p2, wv)));
+    _mm_storeu_ps(row + j + 12, _mm_add_ps(_mm_loadu_ps(row + j + 12), _mm_mul_ps(p3, wv)));
+  }
+#elif defined(IMAGE_USE_NEON)
+  for (; j + 16 <= size; j += 16) {
+    uint8x16_t bytes = vld1q_u8(pixels + j);
+    uint16x8_t lo = vmovl_u8(vget_low_u8(bytes));
+    uint16x8_t hi = vmovl_u8(vget_high_u8(bytes));
+    vst1q_f32(row + j, vmlaq_n_f32(vld1q_f32(row + j), vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), w));
+    vst1q_f32(row + j + 4, vmlaq_n_f32(vld1q_f32(row + j + 4), vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), w));
+    vst1q_f32(row + j + 8, vmlaq_n_f32(vld1q_f32(row + j + 8), vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), w));
+    vst1q_f32(row + j + 12, vmlaq_n_f32(vld1q_f32(row + j + 12), vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), w));
+  }
+#endif
+  for (; j < size; ++j) {
+    row[j] += w * static_cast<float>(pixels[j]);
+  }
+}
+
+// row[j] += w * values[j] for j of [0, size)
+inline void AccumulateRow(const float* values, float w, float* row, size_t size) {
+  size_t j = 0;
+#if defined(IMAGE_USE_SSE)
+  const __m128 wv = _mm_set1_ps(w);
+  for (; j + 4 <= size; j += 4) {
+    _mm_storeu_ps(row + j, _mm_add_ps(_mm_loadu_ps(row + j), _mm_mul_ps(_mm_loadu_ps(values + j), wv)));
+  }
+#elif defined(IMAGE_USE_NEON)
+  for (; j + 4 <= size; j += 4) {
+    vst1q_f32(row + j, vmlaq_n_f32(vld1q_f32(row + j), vld1q_f32(values + j), w));
+  }
+#endif
+  for (; j < size; ++j) {
+    row[j] += w * values[j];
+  }
+}
+
+// Filters the BGR pixels of the line from first_column into the count pixels of the columns, clamped into [0, 255].
+// Both the line and the output have a lane beyond their last pixels.
+inline void FilterColumns(const float* line, const ResizeFilter& columns, int64_t first_column, size_t count,
+                          float* output) {
+  for (size_t x = 0; x < count; ++x) {
+    const float* wx = columns.Weights(x);
+    const float* src = line + static_cast<size_t>(columns.Start(x) - first_column) * 3;
+#if defined(IMAGE_USE_SSE)
+    __m128 sum = _mm_setzero_ps();
+    for (size_t k = 0; k < columns.Size(x); ++k) {
+      sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + k * 3), _mm_set1_ps(wx[k])));
+    }
+    _mm_storeu_ps(output + x * 3, _mm_min_ps(_mm_max_ps(sum, _mm_setzero_ps()), _mm_set1_ps(255.0f)));
+#elif defined(IMAGE_USE_NEON)
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    for (size_t k = 0; k < columns.Size(x); ++k) {
+      sum = vmlaq_n_f32(sum, vld1q_f32(src + k * 3), wx[k]);
+    }
+    vst1q_f32(output + x * 3, vminq_f32(vmaxq_f32(sum, vdupq_n_f32(0.0f)), vdupq_n_f32(255.0f)));
+#else
+    for (size_t c = 0; c < 3; ++c) {
+      float sum = 0.0f;
+      for (size_t k = 0; k < columns.Size(x); ++k) {
+        sum += src[k * 3 + c] * wx[k];
+      }
+      output[x * 3 + c] = std::min(std::max(sum, 0.0f), 255.0f);
+    }
+#endif
+  }
+}
+
+// Fills the padding of the letterbox around the image of the layout in the output of the output layout.
+template <typename T>
+void FillPadding(const ImageLayout& layout, const ImageOutputLayout& output_layout, const std::array<T, 3>& values,
+                 T* output) {
+  const int64_t bottom = layout.pad_top + layout.size[0];
+  const int64_t right = layout.pad_left + layout.size[1];
+  for (int64_t y = 0; y < layout.canvas[0]; ++y) {
+    const bool inside = y >= layout.pad_top && y < bottom;
+    T* row = output + output_layout.rows[y];
+    for (int64_t x = 0; x < layout.canvas[1]; ++x) {
+      if (inside && x == layout.pad_left) {
+        x = right - 1;
+        continue;
+      }
+      for (size_t c = 0; c < 3; ++c) {
+        row[output_layout.columns[x] + c * output_layout.channel_stride] = values[c];
+      }
+    }
+  }
+}
+
+}  // namespace detail
+
+// Resizes, crops or letterboxes, and normalizes the BGR image of [height, width, 3] into the output of
+// [3, out_height, out_width] from TransformedImageSize(), in one pass over the rows of the output: the columns of the
+// input rows of an output row are filtered, the filtered rows are filtered into the output row, and the row is
+// normalized and written into the planes of the channels, or into the tiles and the patches of TransformedOutputLayout.
+// The pixels of both passes are clamped into [0, 255] in the order of the resize of PIL, which the bicubic and the
+// Lanczos filters overshoot at the edges. The rows are split into num_threads tasks. The image is resized to resized,
+// which is the size from ResizedImageSize() of the image, or of the full image if it's decoded at a reduced size.
+// Only the padding of a letterbox is filled besides the image.
+//
+// The BGR pixels of the columns [first_column, first_column + count) of an input row are read_row(row, first_column,
+// count, scratch), which returns them, or writes them into the scratch of count * 3 bytes, like the conversion of a
+// camera frame. A thread reads and filters every input row once for the consecutive output rows which share it. The
+// filters of the resize are taken from filters, the cache of a kernel, if it isn't null.
+//
+// The output is of float, of the float16 of ortc::MFloat16, or of uint8 or int8, which are quantized by the
+// output_scale and the output_zero_point of the options in the same pass.
+template <typename RowReader, typename T>
+void TransformImageRows(const RowReader& read_row, int64_t height, int64_t width,
+                        const std::array<int64_t, 2>& resized, const ImageTransformOptions& options, T* output,
+                        size_t num_threads, const ResizeFilterCache* filters = nullptr) {
+  const auto layout = TransformedImageLayout(resized, options);
+  const auto& size = layout.size;
+  auto get_filter = [&](int64_t in_size, int64_t out_size, int64_t first, int64_t count) {
+    return filters != nullptr ? filters->Get(in_size, out_size, first, count, options.filter)
+                              : std::make_shared<const ResizeFilter>(in_size, out_size, first, count, options.filter);
+  };
+  const auto row_filter = get_filter(height, resized[0], layout.crop_top, size[0]);
+  const auto column_filter = get_filter(width, resized[1], layout.crop_left, size[1]);
+  const ResizeFilter& rows = *row_filter;
+  const ResizeFilter& columns = *column_filter;
+
+  // x * rescale / std - mean / std of every input channel, written into the plane of its output channel
+  std::array<float, 4> scale{};
+  std::array<float, 4> bias{};
+  std::array<size_t, 3> plane{};
+  std::array<T, 3> padding{};
+  const auto output_layout = TransformedOutputLayout(layout.canvas, options);
+  for (size_t c = 0; c < 3; ++c) {
+    size_t out_c = options.swap_rb ? 2 - c : c;
+    scale[c] = options.rescale / options.std[out_c];
+    bias[c] = -options.mean[out_c] / options.std[out_c];
+    if constexpr (std::is_integral_v<T>) {
+      scale[c] /= options.output_scale;
+      bias[c] = bias[c] / options.output_scale + static_cast<float>(options.output_zero_point);
+    }
+    plane[c] = out_c * output_layout.channel_stride;
+    padding[out_c] = detail::FromFloat<T>(options.pad_value * scale[c] + bias[c]);
+  }
+  if (!options.letterbox.empty()) {
+    detail::FillPadding(layout, output_layout, padding, output);
+  }
+  // the offsets of the columns of the image from its corner
+  const size_t* column_offsets = output_layout.columns.data() + layout.pad_left;
+
+  const int64_t first_column = columns.Start(0);
+  const size_t span = static_cast<size_t>(columns.End() - first_column) * 3;
+  const size_t out_width = static_cast<size_t>(size[1]);
+  const size_t filtered_size = out_width * 3;
+  const size_t filtered_stride = filtered_size + 1;
+  const size_t taps = rows.Taps();
+  // the weights of the bilinear filter aren't negative, so its rows are filtered first into a row of the span of
+  // the columns, whose filter is of fewer output pixels than the input rows of the reductions
+  const bool rows_first = options.filter == ResampleFilter::kBilinear;
+  ParallelFor(static_cast<size_t>(size[0]), num_threads, [&](size_t begin, size_t end) {
+    // the lanes beyond the last pixels for the vectors of 4 channels
+    std::vector<float> line(span + 1);
+    std::vector<float> row(filtered_size + 1);
+    // the input rows of the window of an output row, or the filtered ones, by the row modulo the taps, which are
+    // distinct in a window
+    std::vector<uint8_t> scratch((rows_first ? taps : 1) * span);
+    std::vector<const uint8_t*> cached_pixels(taps);
+    std::vector<float> filtered(rows_first ? 0 : taps * filtered_stride);
+    std::vector<int64_t> cached_rows(taps, -1);
+    for (size_t y = begin; y < end; ++y) {
+      const float* wy = rows.Weights(y);
+      if (rows_first) {
+        std::fill(line.begin(), line.end(), 0.0f);
+      } else {
+        std::fill(row.begin(), row.end(), 0.0f);
+      }
+      for (size_t k = 0; k < rows.Size(y); ++k) {
+        const int64_t input_row = rows.Start(y) + static_cast<int64_t>(k);
+        const size_t slot = static_cast<size_t>(input_row) % taps;
+        if (rows_first) {
+          if (cached_rows[slot] != input_row) {
+            cached_rows[slot] = input_row;
+            cached_pixels[slot] = read_row(input_row, first_column, span / 3, scratch.data() + slot * span);
+          }
+          detail::AccumulatePixels(cached_pixels[slot], wy[k], line.data(), span);
+          continue;
+        }
+        float* filtered_row = filtered.data() + slot * filtered_stride;
+        if (cached_rows[slot] != input_row) {
+          cached_rows[slot] = input_row;
+          std::fill(line.begin(), line.end(), 0.0f);
+          detail::AccumulatePixels(read_row(input_row, first_column, span / 3, scratch.data()), 1.0f, line.data(),
+                                   span);
+          detail::FilterColumns(line.data(), columns, first_column, out_width, filtered_row);
+        }
+        detail::AccumulateRow(filtered_row, wy[k], row.data(), filtered_size);
+      }
+      if (rows_first) {
+        detail::FilterColumns(line.data(), columns, first_column, out_width, row.data());
+      }
+
+      T* dst = output + output_layout.rows[y + static_cast<size_t>(layout.pad_top)];
+      for (size_t x = 0; x < out_width; ++x) {
+        const float* src = row.data() + x * 3;
+        float bgr[4];
+#if defined(IMAGE_USE_SSE)
+        __m128 sum = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src), _mm_setzero_ps()), _mm_set1_ps(255.0f));
+        _mm_storeu_ps(bgr, _mm_add_ps(_mm_mul_ps(sum, _mm_loadu_ps(scale.data())), _mm_loadu_ps(bias.data())));
+#elif defined(IMAGE_USE_NEON)
+        float32x4_t sum = vminq_f32(vmaxq_f32(vld1q_f32(src), vdupq_n_f32(0.0f)), vdupq_n_f32(255.0f));
+        vst1q_f32(bgr, vmlaq_f32(vld1q_f32(bias.data()), sum, vld1q_f32(scale.data())));
+#else
+        for (size_t c = 0; c < 3; ++c) {
+          bgr[c] = std::min(std::max(src[c], 0.0f), 255.0f) * scale[c] + bias[c];
+        }
+#endif
+        detail::StoreChannels(bgr, plane, dst + column_offsets[x]);
+      }
+    }
+  });
+}
+
+// TransformImageRows of the BGR image of [height, width, 3] with the row stride of stride bytes.
+template <typename T>
+void TransformImage(const uint8_t* image, int64_t height, int64_t width, size_t stride,
+                    const std::array<int64_t, 2>& resized, const ImageTransformOptions& options, T* output,
+                    size_t num_threads, const ResizeFilterCache* filters = nullptr) {
+  TransformImageRows(
+      [image, stride](int64_t row, int64_t first_column, size_t, uint8_t*) {
+        return image + static_cast<size_t>(row) * stride + static_cast<size_t>(first_column) * 3;
+      },
+      height, width, resized, options, output, num_threads, filters);
+}
+
+template <typename T>
+void TransformImage(const uint8_t* image, int64_t height, int64_t width, size_t stride,
+                    const ImageTransformOptions& options, T* output, size_t num_threads,
+                    const ResizeFilterCache* filters = nullptr) {
+  TransformImage(image, height, width, stride, ResizedImageSize(height, width, options), options, output,
+                 num_threads, filters);
+}
+
+}  // namespace ort_extensions
@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "read_image_batch.hpp"
+
+#include <vector>
+#include "mapped_file.h"
+
+namespace ort_extensions {
+
+void KernelReadImageBatch::Compute(const ortc::Tensor<std::string>& paths,
+                                   ortc::Tensor<uint8_t>& output,
+                                   ortc::Tensor<int64_t>& sizes) const {
+  if (paths.Shape().size() != 1) {
+    ORTX_CXX_API_THROW("[ReadImageBatch]: Expect the paths of dimension [batch].", ORT_INVALID_ARGUMENT);
+  }
+
+  const auto& image_paths = paths.Data();
+  std::vector<MappedFile> files(image_paths.size());
+  std::vector<EncodedImage> encoded_images(image_paths.size());
+  ParallelFor(image_paths.size(), num_threads_, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      if (!files[i].Open(image_paths[i])) {
+        ORTX_CXX_API_THROW(MakeString("[ReadImageBatch]: Failed to open the image file: ", image_paths[i]),
+                           ORT_INVALID_ARGUMENT);
+      }
+      files[i].Prefetch();
+      encoded_images[i] = {files[i].Data(), files[i].Size()};
+    }
+  });
+
+  DecodeBatch(encoded_images, output, sizes, "[ReadImageBatch]");
+}
+
+}  // namespace ort_extensions
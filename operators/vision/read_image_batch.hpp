@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ocos.h"
+#include "decode_image.hpp"
+
+#include <string>
+
+namespace ort_extensions {
+
+// Reads a batch of local image files and decodes them like DecodeImageBatch. The files are memory mapped, so
+// they aren't copied into buffers, and all of them are read ahead by the OS before they are decoded in parallel,
+// so the reading of the later files overlaps the decoding of the earlier ones.
+struct KernelReadImageBatch : KernelDecodeImageBatch {
+  KernelReadImageBatch(const OrtApi& api, const OrtKernelInfo& info)
+      : KernelDecodeImageBatch(api, info, "[ReadImageBatch]") {}
+
+  void Compute(const ortc::Tensor<std::string>& paths,
+               ortc::Tensor<uint8_t>& output,
+               ortc::Tensor<int64_t>& sizes) const;
+};
+
+}  // namespace ort_extensions
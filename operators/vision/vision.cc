@@ -3,13 +3,34 @@
 
 #include "ocos.h"
 #include "decode_image.hpp"
+#include "decode_image_normalize.hpp"
 #include "encode_image.hpp"
+#include "frame_normalize.hpp"
+#include "image_normalize.hpp"
 #include "draw_bounding_box.hpp"
+#include "detection_postprocess.hpp"
+#include "read_image_batch.hpp"
 
 const std::vector<const OrtCustomOp*>& VisionLoader() {
-  static OrtOpLoader op_loader(CustomCpuStruct("EncodeImage", ort_extensions::KernelEncodeImage),
-                               CustomCpuStruct("DecodeImage", ort_extensions::KernelDecodeImage),
-                               CustomCpuStruct("DrawBoundingBoxes", ort_extensions::DrawBoundingBoxes));
+  static OrtOpLoader op_loader(
+      CustomCpuStruct("EncodeImage", ort_extensions::KernelEncodeImage),
+      CustomCpuStruct("DecodeImage", ort_extensions::KernelDecodeImage),
+      CustomCpuStruct("DecodeImageBatch", ort_extensions::KernelDecodeImageBatch),
+      CustomCpuStruct("DecodeImageNormalize", ort_extensions::KernelDecodeImageNormalize),
+      CustomCpuStruct("DecodeImageNormalize", ort_extensions::KernelDecodeImageNormalizeOutput<ortc::MFloat16>),
+      CustomCpuStruct("DecodeImageNormalize", ort_extensions::KernelDecodeImageNormalizeOutput<uint8_t>),
+      CustomCpuStruct("DecodeImageNormalize", ort_extensions::KernelDecodeImageNormalizeOutput<int8_t>),
+      CustomCpuStruct("ImageNormalize", ort_extensions::KernelImageNormalize),
+      CustomCpuStruct("ImageNormalize", ort_extensions::KernelImageNormalizeOutput<ortc::MFloat16>),
+      CustomCpuStruct("ImageNormalize", ort_extensions::KernelImageNormalizeOutput<uint8_t>),
+      CustomCpuStruct("ImageNormalize", ort_extensions::KernelImageNormalizeOutput<int8_t>),
+      CustomCpuStruct("FrameNormalize", ort_extensions::KernelFrameNormalize),
+      CustomCpuStruct("FrameNormalize", ort_extensions::KernelFrameNormalizeOutput<ortc::MFloat16>),
+      CustomCpuStruct("FrameNormalize", ort_extensions::KernelFrameNormalizeOutput<uint8_t>),
+      CustomCpuStruct("FrameNormalize", ort_extensions::KernelFrameNormalizeOutput<int8_t>),
+      CustomCpuStruct("DrawBoundingBoxes", ort_extensions::DrawBoundingBoxes),
+      CustomCpuStruct("DetectionPostProcess", ort_extensions::DetectionPostProcess),
+      CustomCpuStruct("ReadImageBatch", ort_extensions::KernelReadImageBatch));
   return op_loader.GetCustomOps();
 }
 
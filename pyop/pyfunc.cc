@@ -19,6 +19,8 @@
 #include "string_utils.h"
 #include "string_tensor.h"
 #include "pykernel.h"
+#include "runtime_stats.h"
+#include "run_cancellation.h"
 
 namespace py = pybind11;
 
@@ -165,48 +167,114 @@ struct PyCustomOpDefImpl : public PyCustomOpDef {
     return c;
   }
 
-  static py::object BuildPyObjFromTensor(
-      const OrtApi& api, OrtW::CustomOpApi& ort, OrtKernelContext* context, const OrtValue* value,
-      const shape_t& shape, ONNXTensorElementDataType dtype) {
-    std::vector<npy_intp> npy_dims;
-    for (auto n : shape) {
-      npy_dims.push_back(n);
+  // The bytes of the strings of a tensor, and the offset of each of them, which are read without the GIL.
+  struct StringContent {
+    std::vector<char> chars;
+    std::vector<size_t> offsets;
+  };
+
+  static void ReadStringTensor(const OrtApi& api, const OrtValue* value, size_t count, StringContent& content) {
+    size_t data_len = 0;
+    OrtW::ThrowOnError(api, api.GetStringTensorDataLength(value, &data_len));
+    content.chars.resize(data_len);
+    content.offsets.resize(count + 1);
+    OrtW::ThrowOnError(api, api.GetStringTensorContent(value, content.chars.data(), data_len,
+                                                       content.offsets.data(), count));
+    content.offsets[count] = data_len;
+  }
+
+  // Builds the numpy array of the strings of a tensor, whose items are decoded from the content in one pass.
+  static py::object BuildPyStringArray(const shape_t& shape, const StringContent& content) {
+    std::vector<npy_intp> npy_dims(shape.begin(), shape.end());
+    PyObject* array = PyArray_SimpleNew(static_cast<int>(shape.size()), npy_dims.data(), NPY_OBJECT);
+    if (array == nullptr) {
+      throw py::error_already_set();
     }
-    const int numpy_type = to_numpy(dtype);
-    py::object obj = py::reinterpret_steal<py::object>(PyArray_SimpleNew(
-        static_cast<int>(shape.size()), npy_dims.data(), numpy_type));
-    void* out_ptr = static_cast<void*>(
-        PyArray_DATA(reinterpret_cast<PyArrayObject*>(obj.ptr())));
-
-    if (dtype == ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING) {
-      py::object* outObj = static_cast<py::object*>(out_ptr);
-      auto size = calc_size_from_shape(shape);
-      std::vector<std::string> src;
-      GetTensorMutableDataString(api, ort, context, value, src);
-      for (int i = 0; i < size; ++i) {
-        outObj[i] = py::cast(src[i]);
+
+    py::object obj = py::reinterpret_steal<py::object>(array);
+    PyObject** items = static_cast<PyObject**>(PyArray_DATA(reinterpret_cast<PyArrayObject*>(array)));
+    const size_t count = content.offsets.size() - 1;
+    for (size_t i = 0; i < count; ++i) {
+      PyObject* item = PyUnicode_DecodeUTF8(content.chars.data() + content.offsets[i],
+                                            static_cast<Py_ssize_t>(content.offsets[i + 1] - content.offsets[i]),
+                                            nullptr);
+      if (item == nullptr) {
+        throw py::error_already_set();
       }
-    } else {
-      const void* p = (const void*)ort.GetTensorData<char>(value);
-      size_t size_type = element_size(dtype);
-      memcpy(out_ptr, p, size_type * calc_size_from_shape(shape));
+
+      Py_XDECREF(items[i]);
+      items[i] = item;
     }
+
     return obj;
   }
 
-  static py::object InvokePyFunction(uint64_t id, const py::object& feed, const py::object& attrs) {
-    return (*op_invoker)(id, feed, attrs);
+  // Builds the numpy array of a numeric tensor, a view of the buffer of ORT without a copy, writable for an output.
+  // The buffer is only valid during the call, so the base of the view is a guard added to `guards`, which tells after
+  // the call whether the view was kept.
+  static py::object BuildPyArrayView(void* data, const shape_t& shape, ONNXTensorElementDataType dtype,
+                                     bool writable, std::vector<py::object>& guards) {
+    std::vector<npy_intp> npy_dims(shape.begin(), shape.end());
+    const int numpy_type = to_numpy(dtype);
+    if (data == nullptr || calc_size_from_shape(shape) == 0) {
+      // an empty tensor has no buffer to share
+      return py::reinterpret_steal<py::object>(PyArray_SimpleNew(
+          static_cast<int>(shape.size()), npy_dims.data(), numpy_type));
+    }
+
+    PyObject* array = PyArray_SimpleNewFromData(static_cast<int>(shape.size()), npy_dims.data(), numpy_type, data);
+    if (array == nullptr) {
+      throw py::error_already_set();
+    }
+
+    py::object obj = py::reinterpret_steal<py::object>(array);
+    if (!writable) {
+      PyArray_CLEARFLAGS(reinterpret_cast<PyArrayObject*>(array), NPY_ARRAY_WRITEABLE);
+    }
+
+    py::capsule guard(data);
+    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(array), guard.inc_ref().ptr()) != 0) {
+      throw py::error_already_set();
+    }
+
+    guards.push_back(std::move(guard));
+    return obj;
+  }
+
+  // Throws if the function kept an array on a buffer of ORT, or the allocator of its outputs, after its call, when
+  // the only references left to the guards are those of the kernel. The views of an array hold its guard too.
+  static void CheckViewsReleased(const std::vector<py::object>& guards, const py::object& allocator) {
+    bool released = allocator.ref_count() == 1;
+    for (const auto& guard : guards) {
+      released = released && guard.ref_count() == 1;
+    }
+
+    if (!released) {
+      throw std::runtime_error(
+          "A Python function of a custom op kept one of its input or output arrays after its call, "
+          "which are views of the tensors of the call. Keep a copy of it instead, like numpy.copy(x).");
+    }
+  }
+
+  static py::object InvokePyFunction(uint64_t id, const py::object& feed, const py::object& attrs,
+                                     const py::object& allocator) {
+    return (*op_invoker)(id, feed, attrs, allocator);
   }
 
-  using callback_t = std::function<py::object(uint64_t id, const py::object&, const py::object&)>;
+  // the hook is called with the id of the function, its inputs, its attributes, and the allocator of its outputs,
+  // allocator(index, shape), which returns a writable view of the output
+  using callback_t =
+      std::function<py::object(uint64_t id, const py::object&, const py::object&, const py::object&)>;
   static std::unique_ptr<callback_t> op_invoker;
 };
 
 std::unique_ptr<PyCustomOpDefImpl::callback_t> PyCustomOpDefImpl::op_invoker;
+// an input read before the GIL is acquired, the buffer of a numeric tensor or the content of a string one
 typedef struct {
-  const OrtValue* input_X;
   ONNXTensorElementDataType dtype;
   std::vector<int64_t> dimensions;
+  void* data;
+  PyCustomOpDefImpl::StringContent strings;
 } InputInformation;
 
 PyCustomOpKernel::PyCustomOpKernel(const OrtApi& api, const OrtKernelInfo& info,
@@ -218,29 +286,25 @@ PyCustomOpKernel::PyCustomOpKernel(const OrtApi& api, const OrtKernelInfo& info,
     std::string attr_name = it->first;
     int attr_type = it->second;
     OrtStatus* status = nullptr;
-    std::string attr_value;
+    std::variant<int64_t, float, std::string> attr_value{std::string()};
     if (attr_type == PyCustomOpDef::dt_int64) {
       int64_t value = 0;
       status = api_.KernelInfoGetAttribute_int64(&info, attr_name.c_str(), &value);
       if (status == nullptr) {
-        std::stringstream ss;
-        ss << value;
-        attr_value = ss.str();
+        attr_value = value;
       }
     } else if (attr_type == PyCustomOpDef::dt_float) {
       float value = 0.f;
       status = api_.KernelInfoGetAttribute_float(&info, attr_name.c_str(), &value);
       if (status == nullptr) {
-        std::stringstream ss;
-        ss << value;
-        attr_value = ss.str();
+        attr_value = value;
       }
     } else if (attr_type == PyCustomOpDef::dt_string) {
       size_t size = 0;
       status = api_.KernelInfoGetAttribute_string(&info, attr_name.c_str(), nullptr, &size);
       if (status == nullptr || api_.GetErrorCode(status) == ORT_INVALID_ARGUMENT) {
-        attr_value = std::string(size, ' ');
-        status = api_.KernelInfoGetAttribute_string(&info, attr_name.c_str(), attr_value.data(), &size);
+        std::string value(size, ' ');
+        status = api_.KernelInfoGetAttribute_string(&info, attr_name.c_str(), value.data(), &size);
         if ((status != nullptr) && (api_.GetErrorCode(status) != ORT_OK)) {
           api_.ReleaseStatus(status);
           throw std::runtime_error(MakeString(
@@ -250,7 +314,8 @@ PyCustomOpKernel::PyCustomOpKernel(const OrtApi& api, const OrtKernelInfo& info,
         if (status != nullptr) {
           api_.ReleaseStatus(status);
         }
-        attr_value.resize(size - 1);
+        value.resize(size - 1);
+        attr_value = std::move(value);
       }
     }
 
@@ -265,7 +330,21 @@ PyCustomOpKernel::PyCustomOpKernel(const OrtApi& api, const OrtKernelInfo& info,
       api_.ReleaseStatus(status);
     }
 
-    attrs_values_[attr_name] = attr_value;
+    attrs_values_[attr_name] = std::move(attr_value);
+  }
+}
+
+PyCustomOpKernel::~PyCustomOpKernel() {
+  if (!attrs_dict_) {
+    return;
+  }
+
+  if (Py_IsInitialized()) {
+    py::gil_scoped_acquire acquire;
+    attrs_dict_ = py::object();
+  } else {
+    // the interpreter is gone with the dict
+    attrs_dict_.release();
   }
 }
 
@@ -273,112 +352,176 @@ void PyCustomOpKernel::Compute(OrtKernelContext* context) {
   size_t n_inputs = ort_.KernelContext_GetInputCount(context);
   size_t n_outputs = ort_.KernelContext_GetOutputCount(context);
 
-  // Setup inputs
-  std::vector<InputInformation> inputs;
-  inputs.reserve(n_inputs);
+  // Setup inputs, reading all of ORT that doesn't need Python before the GIL is acquired
+  std::vector<InputInformation> inputs(n_inputs);
   for (size_t index = 0; index < n_inputs; ++index) {
     const OrtValue* input_X = ort_.KernelContext_GetInput(context, index);
-    std::vector<int64_t> i_dimensions;
     OrtTensorTypeAndShapeInfo* i_info = ort_.GetTensorTypeAndShape(input_X);
-    i_dimensions = ort_.GetTensorShape(i_info);
-    ONNXTensorElementDataType i_dtype = ort_.GetTensorElementType(i_info);
+    InputInformation& input = inputs[index];
+    input.dimensions = ort_.GetTensorShape(i_info);
+    input.dtype = ort_.GetTensorElementType(i_info);
     ort_.ReleaseTensorTypeAndShapeInfo(i_info);
-    inputs.push_back(InputInformation{input_X, i_dtype, i_dimensions});
+    if (input.dtype == ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING) {
+      input.data = nullptr;
+      PyCustomOpDefImpl::ReadStringTensor(
+          api_, input_X, static_cast<size_t>(PyCustomOpDefImpl::calc_size_from_shape(input.dimensions)),
+          input.strings);
+    } else {
+      input.data = ort_.GetTensorMutableData<char>(const_cast<OrtValue*>(input_X));
+    }
   }
 
   /* Acquire GIL before calling Python code, due to it was released in sess.run */
   py::gil_scoped_acquire acquire;
 
-  {
-    py::list pyinputs;
-    for (auto it = inputs.begin(); it != inputs.end(); ++it) {
-      py::object input0 = PyCustomOpDefImpl::BuildPyObjFromTensor(
-          api_, ort_, context, it->input_X, it->dimensions, it->dtype);
-      pyinputs.append(input0);
-    }
-
+  if (!attrs_dict_) {
     py::dict pyattrs;
-    for (auto it = attrs_values_.begin(); it != attrs_values_.end(); ++it) {
-      pyattrs[py::str(it->first)] = py::str(it->second);
+    for (const auto& [name, value] : attrs_values_) {
+      if (std::holds_alternative<int64_t>(value)) {
+        pyattrs[py::str(name)] = py::int_(std::get<int64_t>(value));
+      } else if (std::holds_alternative<float>(value)) {
+        pyattrs[py::str(name)] = py::float_(std::get<float>(value));
+      } else {
+        pyattrs[py::str(name)] = py::str(std::get<std::string>(value));
+      }
     }
 
-    // Call python function id, shape, flat coefficient.
-    py::tuple fetch = PyCustomOpDefImpl::InvokePyFunction(obj_id_, pyinputs, pyattrs);
-    int64_t rid = fetch[0].cast<int64_t>();
-    assert(rid == obj_id_);
+    attrs_dict_ = std::move(pyattrs);
+  }
 
-    // Setup output.
-    for (size_t no = 0; no < n_outputs; ++no) {
-      auto dims = fetch[1 + no * 2].cast<std::vector<int64_t>>();
-      OrtValue* output = ort_.KernelContext_GetOutput(context, no, dims.data(), dims.size());
+  {
+    std::vector<py::object> guards;
+    py::cpp_function allocator([this, context, &guards](size_t index, const std::vector<int64_t>& dims) {
+      OrtValue* output = ort_.KernelContext_GetOutput(context, index, dims.data(), dims.size());
       OrtTensorTypeAndShapeInfo* o_info = ort_.GetTensorTypeAndShape(output);
       ONNXTensorElementDataType o_dtype = ort_.GetTensorElementType(o_info);
       ort_.ReleaseTensorTypeAndShapeInfo(o_info);
-
       if (o_dtype == ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING) {
-        std::vector<std::string> retval = fetch[2 + no * 2].cast<std::vector<std::string>>();
-        FillTensorDataString(api_, ort_, context, retval, output);
-      } else {
-        const void* Y = (const void*)ort_.GetTensorData<float>(output);
-        void* out = (void*)ort_.GetTensorMutableData<float>(output);
-        py::array retval = fetch[2 + no * 2].cast<py::array>();
-        if (element_size(o_dtype) != retval.itemsize()) {
-          switch (o_dtype) {
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
-              retval = fetch[2 + no * 2].cast<py::array_t<float>>();
-              break;
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
-              retval = fetch[2 + no * 2].cast<py::array_t<uint8_t>>();
-              break;
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8:
-              retval = fetch[2 + no * 2].cast<py::array_t<int8_t>>();
-              break;
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16:
-              retval = fetch[2 + no * 2].cast<py::array_t<uint16_t>>();
-              break;
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16:
-              retval = fetch[2 + no * 2].cast<py::array_t<int16_t>>();
-              break;
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
-              retval = fetch[2 + no * 2].cast<py::array_t<int32_t>>();
-              break;
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
-              retval = fetch[2 + no * 2].cast<py::array_t<int64_t>>();
-              break;
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL:
-              retval = fetch[2 + no * 2].cast<py::array_t<bool>>();
-              break;
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
-              throw std::runtime_error(MakeString(
-                  "Type float16 not supported by python customops api"));
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE:
-              retval = fetch[2 + no * 2].cast<py::array_t<double>>();
-              break;
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32:
-              retval = fetch[2 + no * 2].cast<py::array_t<uint32_t>>();
-              break;
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64:
-              retval = fetch[2 + no * 2].cast<py::array_t<uint64_t>>();
-              break;
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_COMPLEX64:
-              retval = fetch[2 + no * 2].cast<py::array_t<std::complex<float>>>();
-              break;
-            case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_COMPLEX128:
-              retval = fetch[2 + no * 2].cast<py::array_t<std::complex<double>>>();
-              break;
-            default:
-              throw std::runtime_error(MakeString(
-                  "Type mismatch between declared output element size (",
-                  element_size(o_dtype), ") and python element size (",
-                  retval.itemsize(), ")"));
+        throw std::runtime_error("A string output can't be allocated before it's returned.");
+      }
+
+      return PyCustomOpDefImpl::BuildPyArrayView(ort_.GetTensorMutableData<char>(output), dims, o_dtype, true, guards);
+    });
+
+    // the outputs returned by the function, which are copied into ORT after the GIL is released
+    struct NumericOutput {
+      void* out;
+      py::array array;
+      size_t bytes;
+    };
+    std::vector<NumericOutput> numeric_outputs;
+    std::vector<std::pair<OrtValue*, std::vector<std::string>>> string_outputs;
+    {
+      py::list pyinputs;
+      for (auto it = inputs.begin(); it != inputs.end(); ++it) {
+        if (it->dtype == ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING) {
+          pyinputs.append(PyCustomOpDefImpl::BuildPyStringArray(it->dimensions, it->strings));
+        } else {
+          pyinputs.append(PyCustomOpDefImpl::BuildPyArrayView(it->data, it->dimensions, it->dtype, false, guards));
+        }
+      }
+
+      // Call python function id, shape, flat coefficient.
+      py::tuple fetch = PyCustomOpDefImpl::InvokePyFunction(obj_id_, pyinputs, attrs_dict_, allocator);
+      int64_t rid = fetch[0].cast<int64_t>();
+      assert(rid == obj_id_);
+
+      // Setup output.
+      for (size_t no = 0; no < n_outputs; ++no) {
+        // the function wrote the output into the view of its allocator
+        if (fetch[2 + no * 2].is_none()) {
+          continue;
+        }
+
+        auto dims = fetch[1 + no * 2].cast<std::vector<int64_t>>();
+        OrtValue* output = ort_.KernelContext_GetOutput(context, no, dims.data(), dims.size());
+        OrtTensorTypeAndShapeInfo* o_info = ort_.GetTensorTypeAndShape(output);
+        ONNXTensorElementDataType o_dtype = ort_.GetTensorElementType(o_info);
+        ort_.ReleaseTensorTypeAndShapeInfo(o_info);
+
+        if (o_dtype == ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING) {
+          string_outputs.emplace_back(output, fetch[2 + no * 2].cast<std::vector<std::string>>());
+        } else {
+          void* out = (void*)ort_.GetTensorMutableData<float>(output);
+          // a contiguous array of the type is used as is, and any other is converted
+          py::array retval = py::array::ensure(fetch[2 + no * 2], py::array::c_style);
+          if (!retval) {
+            throw py::error_already_set();
+          }
+          if (element_size(o_dtype) != retval.itemsize()) {
+            switch (o_dtype) {
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+                retval = fetch[2 + no * 2].cast<py::array_t<float>>();
+                break;
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
+                retval = fetch[2 + no * 2].cast<py::array_t<uint8_t>>();
+                break;
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8:
+                retval = fetch[2 + no * 2].cast<py::array_t<int8_t>>();
+                break;
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16:
+                retval = fetch[2 + no * 2].cast<py::array_t<uint16_t>>();
+                break;
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16:
+                retval = fetch[2 + no * 2].cast<py::array_t<int16_t>>();
+                break;
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+                retval = fetch[2 + no * 2].cast<py::array_t<int32_t>>();
+                break;
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+                retval = fetch[2 + no * 2].cast<py::array_t<int64_t>>();
+                break;
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL:
+                retval = fetch[2 + no * 2].cast<py::array_t<bool>>();
+                break;
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
+                throw std::runtime_error(MakeString(
+                    "Type float16 not supported by python customops api"));
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE:
+                retval = fetch[2 + no * 2].cast<py::array_t<double>>();
+                break;
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32:
+                retval = fetch[2 + no * 2].cast<py::array_t<uint32_t>>();
+                break;
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64:
+                retval = fetch[2 + no * 2].cast<py::array_t<uint64_t>>();
+                break;
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_COMPLEX64:
+                retval = fetch[2 + no * 2].cast<py::array_t<std::complex<float>>>();
+                break;
+              case ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_COMPLEX128:
+                retval = fetch[2 + no * 2].cast<py::array_t<std::complex<double>>>();
+                break;
+              default:
+                throw std::runtime_error(MakeString(
+                    "Type mismatch between declared output element size (",
+                    element_size(o_dtype), ") and python element size (",
+                    retval.itemsize(), ")"));
+            }
           }
+          const size_t bytes = static_cast<size_t>(retval.nbytes());
+          numeric_outputs.push_back(NumericOutput{out, std::move(retval), bytes});
         }
-        size_t size = element_size(o_dtype);
-        memcpy(out, retval.data(), size * retval.size());
       }
     }
 
-    py::gil_scoped_release release;
+    {
+      // the arrays are held by the kernel until they're copied, and one of them may be a view of an input
+      py::gil_scoped_release release;
+      for (const auto& output : numeric_outputs) {
+        if (output.out != output.array.data()) {
+          memcpy(output.out, output.array.data(), output.bytes);
+        }
+      }
+
+      for (const auto& [output, retval] : string_outputs) {
+        FillTensorDataString(api_, ort_, context, retval, output);
+      }
+    }
+
+    // the returned arrays are released first, so only what the function kept holds the views
+    numeric_outputs.clear();
+    PyCustomOpDefImpl::CheckViewsReleased(guards, allocator);
   }
 }
 
@@ -481,6 +624,24 @@ void AddGlobalMethods(pybind11::module& m) {
       "add_custom_op", [](const PyCustomOpDef& cod) { PyCustomOpDef::AddOp(&cod); }, "Add a PyOp Python object.");
   m.def(
       "default_opset_domain", [] { return std::string(c_OpDomain); }, "return the default opset domain name.");
+  m.def(
+      "runtime_statistics", [] { return ort_extensions::RuntimeStats::Instance().ToJson(); },
+      "return the runtime statistics of the caches, the allocations and the ops as JSON.");
+  m.def(
+      "begin_kernel_run",
+      [](int64_t timeout_ms) {
+        using Clock = ort_extensions::RunCancellation::Clock;
+        return ort_extensions::RunCancellation::BeginRun(
+            timeout_ms < 0 ? Clock::time_point::max() : Clock::now() + std::chrono::milliseconds(timeout_ms));
+      },
+      "begin a run of the kernels started on this thread with a deadline in milliseconds from now, or none if "
+      "negative, and return its handle.");
+  m.def(
+      "end_kernel_run", [](uint64_t run) { ort_extensions::RunCancellation::EndRun(run); },
+      "end the run of the kernels of the handle.");
+  m.def(
+      "cancel_kernel_run", [](uint64_t run) { return ort_extensions::RunCancellation::Cancel(run); },
+      "cancel the kernels of the run of the handle.");
 }
 
 void AddObjectMethods(pybind11::module& m) {
@@ -7,6 +7,9 @@
 
 #include <vector>
 #include <map>
+#include <variant>
+
+#include <pybind11/pybind11.h>
 
 struct PyCustomOpDef {
   std::string op_type;
@@ -39,13 +42,17 @@ struct PyCustomOpDef {
 
 struct PyCustomOpKernel {
   PyCustomOpKernel(const OrtApi& api, const OrtKernelInfo& info, uint64_t id, const std::map<std::string, int>& attrs);
+  ~PyCustomOpKernel();
   void Compute(OrtKernelContext* context);
 
  private:
   const OrtApi& api_;
   OrtW::CustomOpApi ort_;
   uint64_t obj_id_;
-  std::map<std::string, std::string> attrs_values_;
+  // the values of the attributes, an empty string for one which isn't set on the node
+  std::map<std::string, std::variant<int64_t, float, std::string>> attrs_values_;
+  // the dict of the attributes passed to the function, built by the first call, as they don't change
+  pybind11::object attrs_dict_;
 };
 
 struct PyCustomOpFactory : OrtW::CustomOpBase<PyCustomOpFactory, PyCustomOpKernel> {
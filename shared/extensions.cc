@@ -3,3 +3,10 @@
 
 // need a reference to a function from the static library for ld in Linux
 auto exported_func_1 = &RegisterCustomOps;
+
+#ifdef ENABLE_TOKENIZER
+#include "ortx_tokenizer.h"
+
+// the tokenizer API is in its own object of the static library, which is only linked if it's referenced
+auto exported_func_2 = &OrtxCreateTokenizer;
+#endif
@@ -3,11 +3,16 @@
 
 #include <mutex>
 #include <set>
+#include <cctype>
 #include <cstdlib>  // for std::atoi
+#include <cstring>
 #include <string>
 
 #include "onnxruntime_extensions.h"
 #include "ocos.h"
+#include "runtime_stats.h"
+#include "run_cancellation.h"
+#include "memory_budget.h"
 
 using namespace OrtW;
 
@@ -104,6 +109,99 @@ extern "C" int ORT_API_CALL GetActiveOrtAPIVersion() {
   return ver;
 }
 
+extern "C" ORTX_EXPORT size_t ORT_API_CALL GetRuntimeStatistics(char* buffer, size_t buffer_size) {
+  size_t size = 0;
+  OCOS_API_IMPL_BEGIN
+  std::string json = ort_extensions::RuntimeStats::Instance().ToJson();
+  size = json.size() + 1;
+  if (buffer != nullptr && buffer_size >= size) {
+    std::memcpy(buffer, json.c_str(), size);
+  }
+  OCOS_API_IMPL_END
+  return size;
+}
+
+extern "C" ORTX_EXPORT uint64_t ORT_API_CALL BeginKernelRun(int64_t timeout_ms) {
+  using Clock = ort_extensions::RunCancellation::Clock;
+  return ort_extensions::RunCancellation::BeginRun(
+      timeout_ms < 0 ? Clock::time_point::max() : Clock::now() + std::chrono::milliseconds(timeout_ms));
+}
+
+extern "C" ORTX_EXPORT void ORT_API_CALL EndKernelRun(uint64_t run) {
+  ort_extensions::RunCancellation::EndRun(run);
+}
+
+extern "C" ORTX_EXPORT void ORT_API_CALL CancelRunningKernels(uint64_t run) {
+  ort_extensions::RunCancellation::Cancel(run);
+}
+
+// The value of the session config entry of the key, or false if there's none or ORT doesn't have the API of them.
+static bool GetSessionConfigEntry(const OrtApi* ort_api, const OrtSessionOptions* options, const char* key,
+                                  std::string& value) {
+#if ORT_API_VERSION >= 14
+  if (GetOrtVersion() < 14) {
+    return false;
+  }
+  int has_entry = 0;
+  if (OrtStatus* status = ort_api->HasSessionConfigEntry(options, key, &has_entry); status) {
+    ort_api->ReleaseStatus(status);
+    return false;
+  }
+  if (has_entry == 0) {
+    return false;
+  }
+  char buffer[64] = {};
+  size_t size = sizeof(buffer);
+  if (OrtStatus* status = ort_api->GetSessionConfigEntry(options, key, buffer, &size); status) {
+    ort_api->ReleaseStatus(status);
+    return false;
+  }
+  value = buffer;
+  return true;
+#else
+  (void)ort_api;
+  (void)options;
+  (void)key;
+  (void)value;
+  return false;
+#endif
+}
+
+// The session config entry of the bytes of the MemoryBudget of the caches and the scratch arenas, which the kernels
+// of all the sessions of the process share, so the one of the last session registered with it is the limit. "0"
+// lifts the limit.
+constexpr const char* kMemoryBudgetConfig = "ortx.memory_budget_bytes";
+
+static OrtStatus* SetMemoryBudget(const OrtApi* ort_api, const OrtSessionOptions* options) {
+  std::string value;
+  if (!GetSessionConfigEntry(ort_api, options, kMemoryBudgetConfig, value)) {
+    return nullptr;
+  }
+
+  char* end = nullptr;
+  const unsigned long long bytes = std::strtoull(value.c_str(), &end, 10);
+  if (value.empty() || *end != '\0' || !std::isdigit(static_cast<unsigned char>(value[0]))) {
+    std::string message = std::string("The session config entry ") + kMemoryBudgetConfig + " of \"" + value +
+                          "\" isn't a number of bytes.";
+    return ort_api->CreateStatus(ORT_INVALID_ARGUMENT, message.c_str());
+  }
+
+  ort_extensions::MemoryBudget::Instance().SetLimit(static_cast<size_t>(bytes));
+  return nullptr;
+}
+
+#if defined(USE_CUDA)
+// The session config entry of "1" which registers the CPU kernels of the preprocessing for the CUDA execution
+// provider too, whose outputs are staged in the pinned memory and copied to the GPU by the async DMAs, instead of
+// the pageable outputs which ORT copies again. It has to be added before the custom ops are registered.
+constexpr const char* kCudaStagedOutputsConfig = "ortx.cuda_staged_outputs";
+
+static bool UseCudaStagedOutputs(const OrtApi* ort_api, const OrtSessionOptions* options) {
+  std::string value;
+  return GetSessionConfigEntry(ort_api, options, kCudaStagedOutputsConfig, value) && value == "1";
+}
+#endif  // USE_CUDA
+
 extern "C" ORTX_EXPORT OrtStatus* ORT_API_CALL RegisterCustomOps(OrtSessionOptions* options, const OrtApiBase* api) {
   OrtStatus* status = nullptr;
   OCOS_API_IMPL_BEGIN
@@ -111,6 +209,7 @@ extern "C" ORTX_EXPORT OrtStatus* ORT_API_CALL RegisterCustomOps(OrtSessionOptio
   OrtCustomOpDomain* domain = nullptr;
   auto ver = GetOrtVersion(api);
   const OrtApi* ortApi = api->GetApi(ver);
+  Ort::Custom::RegisteredOrtApi() = ortApi;
   std::set<std::string> pyop_nameset;
 
 #if defined(PYTHON_OP_SUPPORT)
@@ -139,6 +238,14 @@ extern "C" ORTX_EXPORT OrtStatus* ORT_API_CALL RegisterCustomOps(OrtSessionOptio
   }
 #endif
 
+  if (status = SetMemoryBudget(ortApi, options); status) {
+    return status;
+  }
+
+#if defined(USE_CUDA)
+  const bool cuda_staged_outputs = UseCudaStagedOutputs(ortApi, options);
+#endif
+
   static std::vector<FxLoadCustomOpFactory> c_factories = {
 #if defined(ENABLE_TF_STRING)
     LoadCustomOpClasses_Text,
@@ -154,11 +261,20 @@ extern "C" ORTX_EXPORT OrtStatus* ORT_API_CALL RegisterCustomOps(OrtSessionOptio
 #endif
 #if defined(ENABLE_DR_LIBS)
     LoadCustomOpClasses_Audio,
+#endif
+#if defined(USE_CUDA)
+    LoadCustomOpClasses_Cuda,
 #endif
     LoadCustomOpClasses<>
   };
 
-  for (const auto& fx : c_factories) {
+  std::vector<FxLoadCustomOpFactory> factories = c_factories;
+#if defined(USE_CUDA)
+  if (cuda_staged_outputs) {
+    factories.push_back(LoadCustomOpClasses_CudaStaged);
+  }
+#endif
+  for (const auto& fx : factories) {
     const auto& ops = fx();
     for (const OrtCustomOp* op : ops) {
       if (pyop_nameset.find(op->GetName(op)) == pyop_nameset.end()) {
@@ -188,13 +304,6 @@ extern "C" ORTX_EXPORT OrtStatus* ORT_API_CALL RegisterCustomOps(OrtSessionOptio
   // New custom ops should use the com.microsoft.extensions domain.
   //
 
-  // Create domain for ops using the new domain name.
-  if (status = ortApi->CreateCustomOpDomain(c_ComMsExtOpDomain, &domain); status) {
-    return status;
-  }
-
-  AddOrtCustomOpDomainToContainer(domain, ortApi);
-
   static std::vector<FxLoadCustomOpFactory> new_domain_factories = {
 #if defined(ENABLE_VISION)
     LoadCustomOpClasses_Vision,
@@ -204,16 +313,40 @@ extern "C" ORTX_EXPORT OrtStatus* ORT_API_CALL RegisterCustomOps(OrtSessionOptio
 #endif
 #if defined(ENABLE_AZURE)
     LoadCustomOpClasses_Azure,
+#endif
+#if defined(USE_CUDA)
+    LoadCustomOpClasses_CudaExtensions,
 #endif
     LoadCustomOpClasses<>
   };
 
-  for (const auto& fx : new_domain_factories) {
+  std::vector<FxLoadCustomOpFactory> extension_factories = new_domain_factories;
+#if defined(USE_CUDA)
+  if (cuda_staged_outputs) {
+    extension_factories.push_back(LoadCustomOpClasses_CudaStagedExtensions);
+  }
+#endif
+  std::vector<const OrtCustomOp*> new_domain_ops;
+  for (const auto& fx : extension_factories) {
     const auto& ops = fx();
-    for (const OrtCustomOp* op : ops) {
-      if (status = ortApi->CustomOpDomain_Add(domain, op); status) {
-        return status;
-      }
+    new_domain_ops.insert(new_domain_ops.end(), ops.begin(), ops.end());
+  }
+
+  // a build of the selected ops may have none of the domain.
+  if (new_domain_ops.empty()) {
+    return nullptr;
+  }
+
+  // Create domain for ops using the new domain name.
+  if (status = ortApi->CreateCustomOpDomain(c_ComMsExtOpDomain, &domain); status) {
+    return status;
+  }
+
+  AddOrtCustomOpDomainToContainer(domain, ortApi);
+
+  for (const OrtCustomOp* op : new_domain_ops) {
+    if (status = ortApi->CustomOpDomain_Add(domain, op); status) {
+      return status;
     }
   }
 
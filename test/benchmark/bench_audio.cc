@@ -0,0 +1,246 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifdef ENABLE_DR_LIBS
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+
+#include "dr_flac.h"
+#include "dr_mp3.h"
+#include "dr_wav.h"
+
+#include "ocos.h"
+#include "string_utils.h"
+#include "audio/sampling.h"
+#include "bench_utils.hpp"
+
+namespace {
+
+using namespace ocos_benchmark;
+
+// The kernel needs an ORT kernel info for its attributes, so the benchmarks run the stages of AudioDecoder on
+// the same classes: the decoding of dr_libs block by block, the mix of the channels, the lowpass filter and the
+// resampling, each of them alone and all of them in the pipeline. Every benchmark reports x_realtime, the seconds
+// of the audio per second, and peak_bytes, the peak of the memory of a call, with the allocations of dr_libs.
+constexpr size_t kBlockFrames = 1024 * 16;  // the block of AudioDecoder
+
+const drwav_allocation_callbacks kWavAllocator{
+    nullptr, [](size_t size, void*) { return TrackedMalloc(size); },
+    [](void* ptr, size_t size, void*) { return TrackedRealloc(ptr, size); }, [](void* ptr, void*) { TrackedFree(ptr); }};
+const drmp3_allocation_callbacks kMp3Allocator{
+    nullptr, [](size_t size, void*) { return TrackedMalloc(size); },
+    [](void* ptr, size_t size, void*) { return TrackedRealloc(ptr, size); }, [](void* ptr, void*) { TrackedFree(ptr); }};
+const drflac_allocation_callbacks kFlacAllocator{
+    nullptr, [](size_t size, void*) { return TrackedMalloc(size); },
+    [](void* ptr, size_t size, void*) { return TrackedRealloc(ptr, size); }, [](void* ptr, void*) { TrackedFree(ptr); }};
+
+// A stream of the encoded file, which reads the interleaved float frames.
+class AudioStream {
+ public:
+  AudioStream(const std::string& data, const std::string& format) {
+    if (format == "wav") {
+      wav_ = std::make_unique<drwav>();
+      if (!drwav_init_memory(wav_.get(), data.data(), data.size(), &kWavAllocator)) {
+        ORTX_CXX_API_THROW("Failed to open the wav stream.", ORT_INVALID_ARGUMENT);
+      }
+      sample_rate_ = wav_->sampleRate;
+      channels_ = wav_->channels;
+    } else if (format == "mp3") {
+      mp3_ = std::make_unique<drmp3>();
+      if (!drmp3_init_memory(mp3_.get(), data.data(), data.size(), &kMp3Allocator)) {
+        ORTX_CXX_API_THROW("Failed to open the mp3 stream.", ORT_INVALID_ARGUMENT);
+      }
+      sample_rate_ = mp3_->sampleRate;
+      channels_ = mp3_->channels;
+    } else {
+      flac_ = drflac_open_memory(data.data(), data.size(), &kFlacAllocator);
+      if (flac_ == nullptr) {
+        ORTX_CXX_API_THROW("Failed to open the flac stream.", ORT_INVALID_ARGUMENT);
+      }
+      sample_rate_ = flac_->sampleRate;
+      channels_ = flac_->channels;
+    }
+  }
+
+  ~AudioStream() {
+    if (wav_) {
+      drwav_uninit(wav_.get());
+    } else if (mp3_) {
+      drmp3_uninit(mp3_.get());
+    } else {
+      drflac_close(flac_);
+    }
+  }
+
+  uint32_t SampleRate() const { return sample_rate_; }
+  uint32_t Channels() const { return channels_; }
+
+  size_t Read(float* frames, size_t count) {
+    if (wav_) {
+      return static_cast<size_t>(drwav_read_pcm_frames_f32(wav_.get(), count, frames));
+    }
+    if (mp3_) {
+      return static_cast<size_t>(drmp3_read_pcm_frames_f32(mp3_.get(), count, frames));
+    }
+    return static_cast<size_t>(drflac_read_pcm_frames_f32(flac_, count, frames));
+  }
+
+ private:
+  std::unique_ptr<drwav> wav_;
+  std::unique_ptr<drmp3> mp3_;
+  drflac* flac_{};
+  uint32_t sample_rate_{};
+  uint32_t channels_{};
+};
+
+struct AudioFile {
+  std::string format;
+  std::string data;
+  uint32_t sample_rate{};
+  uint32_t channels{};
+  std::vector<float> pcm;   // the interleaved frames
+  std::vector<float> mono;  // the mix of the channels
+  double seconds{};
+};
+
+const AudioFile& LoadFile(const std::string& name) {
+  static std::map<std::string, AudioFile> files;
+  auto& file = files[name];
+  if (file.data.empty()) {
+    file.format = name.substr(name.rfind('.') + 1);
+    file.data = ReadFile(DataPath(name));
+    AudioStream stream(file.data, file.format);
+    file.sample_rate = stream.SampleRate();
+    file.channels = stream.Channels();
+    std::vector<float> block(kBlockFrames * file.channels);
+    while (size_t frames = stream.Read(block.data(), kBlockFrames)) {
+      file.pcm.insert(file.pcm.end(), block.begin(), block.begin() + frames * file.channels);
+    }
+    file.mono.resize(file.pcm.size() / file.channels);
+    ChannelMixer(file.channels).Mix(file.pcm.data(), file.mono.size(), file.mono.data());
+    file.seconds = static_cast<double>(file.mono.size()) / file.sample_rate;
+  }
+  return file;
+}
+
+// Runs the stage on the file in every iteration, and reports the counters.
+template <typename Stage>
+void RunStage(benchmark::State& state, const std::string& name, Stage&& stage) {
+  const AudioFile& file = LoadFile(name);
+  const int64_t baseline = ResetPeakBytes();
+  for (auto _ : state) {
+    stage(file);
+  }
+  state.counters["x_realtime"] = benchmark::Counter(file.seconds * static_cast<double>(state.iterations()),
+                                                    benchmark::Counter::kIsRate);
+  state.counters["peak_bytes"] = benchmark::Counter(static_cast<double>(PeakBytes() - baseline));
+}
+
+void Decode(const AudioFile& file) {
+  AudioStream stream(file.data, file.format);
+  std::vector<float> block(kBlockFrames * stream.Channels());
+  size_t frames = 0;
+  while (size_t count = stream.Read(block.data(), kBlockFrames)) {
+    frames += count;
+  }
+  benchmark::DoNotOptimize(frames);
+}
+
+void Mix(const AudioFile& file) {
+  std::vector<float> mono(file.mono.size());
+  ChannelMixer(file.channels).Mix(file.pcm.data(), mono.size(), mono.data());
+  benchmark::DoNotOptimize(mono.data());
+}
+
+void Lowpass(const AudioFile& file, int64_t rate) {
+  std::vector<float> samples(file.mono);
+  ButterworthLowpass filter(0.5 * rate, file.sample_rate);
+  for (size_t begin = 0; begin < samples.size(); begin += kBlockFrames) {
+    filter.ProcessBlock(samples.data() + begin, std::min(kBlockFrames, samples.size() - begin));
+  }
+  benchmark::DoNotOptimize(samples.data());
+}
+
+void Resample(const AudioFile& file, int64_t rate) {
+  KaiserWindowInterpolation resampler(static_cast<float>(file.sample_rate), static_cast<float>(rate));
+  std::vector<float> output;
+  output.reserve(KaiserWindowInterpolation::OutputSize(file.mono.size(), static_cast<float>(file.sample_rate),
+                                                       static_cast<float>(rate)));
+  for (size_t begin = 0; begin < file.mono.size(); begin += kBlockFrames) {
+    resampler.Push(file.mono.data() + begin, std::min(kBlockFrames, file.mono.size() - begin), output);
+  }
+  resampler.Finish(output);
+  benchmark::DoNotOptimize(output.data());
+}
+
+// The stages of AudioDecoder with stereo_to_mono=1 and the downsampling_rate, in which 0 doesn't resample.
+void Pipeline(const AudioFile& file, int64_t rate) {
+  AudioStream stream(file.data, file.format);
+  const size_t channels = stream.Channels();
+  const bool resample = rate != 0 && rate != stream.SampleRate();
+  ChannelMixer mixer(channels);
+  std::optional<ButterworthLowpass> filter;
+  std::optional<KaiserWindowInterpolation> resampler;
+  if (resample) {
+    filter.emplace(0.5 * rate, stream.SampleRate());
+    resampler.emplace(static_cast<float>(stream.SampleRate()), static_cast<float>(rate));
+  }
+
+  std::vector<float> block(kBlockFrames * channels);
+  std::vector<float> output;
+  output.reserve(resample ? KaiserWindowInterpolation::OutputSize(file.mono.size(),
+                                                                  static_cast<float>(stream.SampleRate()),
+                                                                  static_cast<float>(rate))
+                          : file.mono.size());
+  while (size_t frames = stream.Read(block.data(), kBlockFrames)) {
+    float* samples = block.data();
+    if (resample) {
+      filter->ProcessBlock([&](size_t i) { return mixer.MixFrame(samples + i * channels); }, samples, frames);
+      resampler->Push(samples, frames, output);
+    } else {
+      mixer.Mix(samples, frames, samples);
+      output.insert(output.end(), samples, samples + frames);
+    }
+  }
+  if (resample) {
+    resampler->Finish(output);
+  }
+  benchmark::DoNotOptimize(output.data());
+}
+
+void RegisterAudio() {
+  for (const char* name : {"1272-141231-0002.wav", "1272-141231-0002.mp3", "1272-141231-0002.flac", "jfk.flac"}) {
+    const std::string file(name);
+    // only the header of the stream is read here, and the file is decoded when its first benchmark runs
+    const std::string data = ReadFile(DataPath(file));
+    AudioStream probe(data, file.substr(file.rfind('.') + 1));
+    auto add = [&file](const std::string& stage, std::function<void(const AudioFile&)> run) {
+      benchmark::RegisterBenchmark(("Audio/" + stage + "/" + file).c_str(),
+                                   [file, run](benchmark::State& state) { RunStage(state, file, run); })
+          ->Unit(benchmark::kMillisecond);
+    };
+
+    add("decode", Decode);
+    if (probe.Channels() > 1) {
+      add("mix", Mix);
+    }
+    add("pipeline@0", [](const AudioFile& f) { Pipeline(f, 0); });
+    for (int64_t rate : {22050, 16000, 8000}) {
+      if (rate >= probe.SampleRate()) {
+        continue;
+      }
+      const std::string suffix = "@" + std::to_string(rate);
+      add("lowpass" + suffix, [rate](const AudioFile& f) { Lowpass(f, rate); });
+      add("resample" + suffix, [rate](const AudioFile& f) { Resample(f, rate); });
+      add("pipeline" + suffix, [rate](const AudioFile& f) { Pipeline(f, rate); });
+    }
+  }
+}
+
+const bool kAudioRegistered = RegisterSuite(RegisterAudio);
+
+}  // namespace
+
+#endif  // ENABLE_DR_LIBS
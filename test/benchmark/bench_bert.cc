@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "bench_utils.hpp"
+
+#ifdef ENABLE_BERT_TOKENIZER
+#include "bert_tokenizer.hpp"
+#endif
+#ifdef ENABLE_WORDPIECE_TOKENIZER
+#include "wordpiece_tokenizer.hpp"
+#include "nlohmann/json.hpp"
+#endif
+
+namespace {
+
+using namespace ocos_benchmark;
+
+#ifdef ENABLE_BERT_TOKENIZER
+// the steps of KernelBertTokenizer::Compute for one query, with the defaults of its attributes.
+TokenizeFn MakeBertBenchmark() {
+  auto tokenizer = std::make_shared<BertTokenizer>(
+      ReadFile(DataPath("bert_basic_cased_vocab.txt")), true, true, ustring("[UNK]"), ustring("[SEP]"),
+      ustring("[PAD]"), ustring("[CLS]"), ustring("[MASK]"), true, true, ustring("##"), -1, "longest_first");
+  return [tokenizer](const std::string& text) {
+    std::vector<int64_t> encoded = tokenizer->Encode(std::string_view(text));
+    tokenizer->Truncate(encoded);
+    std::vector<int64_t> input_ids = tokenizer->AddSpecialToken(encoded);
+    std::vector<int64_t> token_type_ids = tokenizer->GenerateTypeId(encoded);
+    return input_ids.size();
+  };
+}
+
+const bool kBertRegistered = RegisterTokenizer("BertTokenizer", MakeBertBenchmark);
+#endif  // ENABLE_BERT_TOKENIZER
+
+#ifdef ENABLE_WORDPIECE_TOKENIZER
+// WordpieceTokenizer takes the whitespace-separated words of one row, and the kernel builds the trie once.
+TokenizeFn MakeWordpieceBenchmark() {
+  std::unordered_map<std::string, int32_t> vocab_map;
+  nlohmann::json::parse(ReadFile(DataPath("bert.vocab"))).get_to(vocab_map);
+  auto trie = std::make_shared<WordpieceTrie>();
+  trie->Build(vocab_map, ustring("##"));
+
+  return [trie](const std::string& text) {
+    static const ustring kSuffix("##");
+    static const ustring kUnknown("[UNK]");
+    std::vector<ustring> texts{ustring(text)};
+    std::vector<ustring> tokens;
+    std::vector<int32_t> indices;
+    std::vector<int64_t> rows;
+    KernelWordpieceTokenizer_Tokenizer(*trie, kSuffix, kUnknown, texts, tokens, indices, rows);
+    return indices.size();
+  };
+}
+
+const bool kWordpieceRegistered = RegisterTokenizer("WordpieceTokenizer", MakeWordpieceBenchmark);
+#endif  // ENABLE_WORDPIECE_TOKENIZER
+
+}  // namespace
@@ -0,0 +1,120 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifdef ENABLE_GPT2_TOKENIZER
+#include <sstream>
+
+#include "bpe_tokenizer.hpp"
+#include "bench_utils.hpp"
+
+namespace {
+
+using namespace ocos_benchmark;
+
+// The kernels read the vocabulary from their attributes, which need an ORT kernel info, so the benchmarks
+// run the same steps on the VocabData: the special token split, the pre-tokenization, the byte-level BPE
+// with the cache of the kernels. GPT2 runs on the UTF-8 text, the Roberta and CLIP kernels on the UTF-32 one.
+enum class BpeFlavor {
+  kGpt2,
+  kRoberta,
+  kClip,
+};
+
+class BpeBenchmark {
+ public:
+  explicit BpeBenchmark(BpeFlavor flavor) : flavor_(flavor) {
+    std::istringstream vocab_stream(ReadFile(DataPath("gpt2.vocab")));
+    std::istringstream merges_stream(ReadFile(DataPath("gpt2.merges.txt")));
+    vocab_.Load(vocab_stream, merges_stream, "<|endoftext|>",
+                flavor == BpeFlavor::kClip ? "<|startoftext|>\n<|endoftext|>" : "<|endoftext|>");
+    cache_.SetCapacity(kDefaultBpeCacheCapacity);
+  }
+
+  size_t Tokenize(const std::string& text) {
+    ids_.clear();
+    if (flavor_ == BpeFlavor::kGpt2) {
+      Tokenize(std::string_view(text));
+      return ids_.size();
+    }
+
+    ustring input(text);
+    if (flavor_ == BpeFlavor::kClip) {
+      WhiteSpaceClean(input, true);
+    }
+    Tokenize(std::u32string_view(input));
+    return ids_.size();
+  }
+
+ private:
+  template <typename CharT>
+  void Tokenize(std::basic_string_view<CharT> input) {
+    ScratchScope scratch;
+    if (IsEmptyUString(input)) {
+      return;
+    }
+
+    BasicTokenWithRegularExp<CharT> regcmp;
+    for (auto& seg_id : vocab_.SplitBySpecialTokens(input)) {
+      if (seg_id.second != -1) {
+        ids_.push_back(seg_id.second);
+        continue;
+      }
+
+      regcmp.Set(seg_id.first);
+      for (;;) {
+        auto [b, tok] = regcmp.GetNextToken();
+        if (!b) break;
+
+        AssignToken(tok);
+        if (!cache_.Lookup(token_, byte_list_)) {
+          EncodeBytes();
+          vocab_.bpe(byte_list_);
+          cache_.Insert(token_, byte_list_);
+        }
+        for (auto& p : byte_list_) {
+          ids_.push_back(p.first);
+        }
+      }
+    }
+  }
+
+  void AssignToken(std::string_view tok) { token_.assign(tok.data(), tok.size()); }
+
+  void AssignToken(std::u32string_view tok) {
+    token_ = std::string(ustring(tok));
+    if (flavor_ == BpeFlavor::kClip) {
+      token_.erase(std::remove(token_.begin(), token_.end(), ' '), token_.end());
+    }
+  }
+
+  void EncodeBytes() {
+    byte_list_.clear();
+    for (size_t i = 0; i < token_.size(); ++i) {
+      if (flavor_ == BpeFlavor::kClip && i + 1 == token_.size()) {
+        // CLIP marks the end of the words, which gpt2.vocab doesn't have, so it's the unknown token here.
+        byte_list_.emplace_back(vocab_.GetEncoding(token_.substr(i) + "</w>"), 1);
+      } else {
+        byte_list_.emplace_back(vocab_.ByteEncoder()[static_cast<unsigned char>(token_[i])], 1);
+      }
+    }
+  }
+
+  BpeFlavor flavor_;
+  VocabData vocab_;
+  BpeCache cache_;
+  std::string token_;
+  std::vector<std::pair<int, int>> byte_list_;
+  std::vector<int64_t> ids_;
+};
+
+TokenizeFn MakeBpeBenchmark(BpeFlavor flavor) {
+  auto tokenizer = std::make_shared<BpeBenchmark>(flavor);
+  return [tokenizer](const std::string& text) { return tokenizer->Tokenize(text); };
+}
+
+const bool kRegistered = RegisterTokenizer("GPT2Tokenizer", []() { return MakeBpeBenchmark(BpeFlavor::kGpt2); }) &&
+                         RegisterTokenizer("RobertaTokenizer", []() { return MakeBpeBenchmark(BpeFlavor::kRoberta); }) &&
+                         RegisterTokenizer("CLIPTokenizer", []() { return MakeBpeBenchmark(BpeFlavor::kClip); });
+
+}  // namespace
+#endif  // ENABLE_GPT2_TOKENIZER
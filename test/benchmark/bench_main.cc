@@ -0,0 +1,294 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <sstream>
+
+#include "ocos.h"
+#include "string_utils.h"
+#include "bench_utils.hpp"
+
+namespace {
+std::atomic<uint64_t> g_allocation_count{0};
+std::atomic<int64_t> g_live_bytes{0};
+std::atomic<int64_t> g_peak_bytes{0};
+
+// every allocation begins with its size, so that the live bytes are known on the deletes without the size.
+constexpr size_t kHeaderSize = alignof(std::max_align_t);
+
+void AddLiveBytes(int64_t size) {
+  int64_t live = g_live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+  int64_t peak = g_peak_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !g_peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+}
+}  // namespace
+
+// the global allocations are counted to report the allocations per call of the tokenizers, and the peak of the
+// live bytes of the audio pipeline.
+void* operator new(size_t size) {
+  if (void* ptr = ocos_benchmark::TrackedMalloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return ocos_benchmark::TrackedMalloc(size);
+}
+
+void operator delete(void* ptr) noexcept { ocos_benchmark::TrackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { ocos_benchmark::TrackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { ocos_benchmark::TrackedFree(ptr); }
+
+namespace ocos_benchmark {
+
+void* TrackedMalloc(size_t size) noexcept {
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  auto* block = static_cast<char*>(std::malloc(size + kHeaderSize));
+  if (block == nullptr) {
+    return nullptr;
+  }
+  *reinterpret_cast<size_t*>(block) = size;
+  AddLiveBytes(static_cast<int64_t>(size));
+  return block + kHeaderSize;
+}
+
+void* TrackedRealloc(void* ptr, size_t size) noexcept {
+  if (ptr == nullptr) {
+    return TrackedMalloc(size);
+  }
+  char* block = static_cast<char*>(ptr) - kHeaderSize;
+  const size_t old_size = *reinterpret_cast<size_t*>(block);
+  block = static_cast<char*>(std::realloc(block, size + kHeaderSize));
+  if (block == nullptr) {
+    return nullptr;
+  }
+  *reinterpret_cast<size_t*>(block) = size;
+  AddLiveBytes(static_cast<int64_t>(size) - static_cast<int64_t>(old_size));
+  return block + kHeaderSize;
+}
+
+void TrackedFree(void* ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  char* block = static_cast<char*>(ptr) - kHeaderSize;
+  g_live_bytes.fetch_sub(static_cast<int64_t>(*reinterpret_cast<size_t*>(block)), std::memory_order_relaxed);
+  std::free(block);
+}
+
+uint64_t AllocationCount() {
+  return g_allocation_count.load(std::memory_order_relaxed);
+}
+
+int64_t ResetPeakBytes() {
+  int64_t live = g_live_bytes.load(std::memory_order_relaxed);
+  g_peak_bytes.store(live, std::memory_order_relaxed);
+  return live;
+}
+
+int64_t PeakBytes() {
+  return g_peak_bytes.load(std::memory_order_relaxed);
+}
+
+std::string DataPath(const std::string& file_name) {
+  const char* data_dir = std::getenv("OCOS_BENCHMARK_DATA_DIR");
+  std::string path = data_dir != nullptr ? data_dir : OCOS_BENCHMARK_DATA_DIR;
+  return path + "/" + file_name;
+}
+
+std::string ReadFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    ORTX_CXX_API_THROW(MakeString("Failed to open the benchmark data: ", path), ORT_INVALID_ARGUMENT);
+  }
+  std::ostringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+namespace {
+
+// a deterministic generator, so that the runs are comparable.
+class Lcg {
+ public:
+  uint32_t Next() {
+    state_ = state_ * 1103515245u + 12345u;
+    return (state_ >> 16) & 0x7FFF;
+  }
+
+ private:
+  uint32_t state_ = 42;
+};
+
+Corpus MakeCorpus(std::string name, std::vector<std::string> texts) {
+  Corpus corpus{std::move(name), std::move(texts)};
+  for (const auto& text : corpus.texts) {
+    corpus.bytes += text.size();
+  }
+  return corpus;
+}
+
+Corpus ShortQueries() {
+  return MakeCorpus("short_queries", {
+                                         "how do I reset my password",
+                                         "weather in Seattle tomorrow",
+                                         "What's the best way to learn C++?",
+                                         "cheap flights from London to New York",
+                                         "ONNX Runtime custom operators",
+                                         "is it going to rain on Friday?",
+                                         "convert 100 USD to EUR",
+                                         "Who wrote \"Pride and Prejudice\"?",
+                                         "pizza near me open now",
+                                         "python list comprehension examples",
+                                         "Café au lait vs. latte",
+                                         "東京の天気",
+                                         "translate 'good morning' to Spanish",
+                                         "I'm looking for a 4K monitor under $300",
+                                         "symptoms of the flu",
+                                         "We'll see you at 10:30 AM!",
+                                     });
+}
+
+Corpus LongDocuments() {
+  static const char* kParagraph =
+      "The quick brown fox jumps over the lazy dog, and it's been doing so since 1885. "
+      "Tokenizers split a text into the pieces a model understands: words, sub-words, bytes. "
+      "They're run on every request, so their cost shows up in the end-to-end latency (often 10-20%). "
+      "Numbers like 3.14159, dates like 2023-07-01 and URLs like https://example.com/a?b=c all need care. "
+      "Naïve implementations allocate per token; we'd rather they didn't. "
+      "Über-long paragraphs, résumés and 日本語のテキスト are common in the wild too.\n";
+  std::vector<std::string> texts;
+  for (size_t doc = 0; doc < 4; ++doc) {
+    std::string text;
+    while (text.size() < 8 * 1024) {
+      text += kParagraph;
+    }
+    texts.push_back(std::move(text));
+  }
+  return MakeCorpus("long_documents", std::move(texts));
+}
+
+Corpus NoWhitespace() {
+  // the pre-tokenizers can't split these strings, so the words are as long as the text.
+  Lcg lcg;
+  std::string letters;
+  std::string alnum;
+  std::string punct;
+  for (size_t i = 0; i < 4096; ++i) {
+    letters.push_back(static_cast<char>('a' + lcg.Next() % 26));
+    alnum.push_back("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"[lcg.Next() % 62]);
+    punct.push_back("!?.,;:-_#@$%&*"[lcg.Next() % 14]);
+  }
+  return MakeCorpus("no_whitespace", {letters, alnum, punct, std::string(4096, 'a')});
+}
+
+Corpus FromFile(const std::string& path) {
+  std::istringstream content(ReadFile(path));
+  std::vector<std::string> texts;
+  std::string line;
+  while (std::getline(content, line)) {
+    if (!line.empty()) {
+      texts.push_back(line);
+    }
+  }
+  return MakeCorpus("file", std::move(texts));
+}
+
+struct TokenizerEntry {
+  std::string name;
+  std::function<TokenizeFn()> factory;
+  std::shared_ptr<TokenizeFn> tokenize;  // created by the first benchmark of the tokenizer
+};
+
+std::vector<TokenizerEntry>& Tokenizers() {
+  static std::vector<TokenizerEntry> tokenizers;
+  return tokenizers;
+}
+
+void RunTokenizer(benchmark::State& state, TokenizerEntry& entry, const Corpus& corpus) {
+  if (!entry.tokenize) {
+    entry.tokenize = std::make_shared<TokenizeFn>(entry.factory());
+  }
+  const TokenizeFn& tokenize = *entry.tokenize;
+
+  size_t tokens = 0;
+  uint64_t allocations = AllocationCount();
+  for (auto _ : state) {
+    for (const auto& text : corpus.texts) {
+      tokens += tokenize(text);
+    }
+  }
+  allocations = AllocationCount() - allocations;
+
+  const double calls = static_cast<double>(state.iterations()) * static_cast<double>(corpus.texts.size());
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * corpus.bytes));
+  state.counters["tokens/s"] = benchmark::Counter(static_cast<double>(tokens), benchmark::Counter::kIsRate);
+  state.counters["allocs/call"] = benchmark::Counter(calls > 0 ? static_cast<double>(allocations) / calls : 0.0);
+}
+
+}  // namespace
+
+const std::vector<Corpus>& Corpora() {
+  static const std::vector<Corpus> corpora = []() {
+    std::vector<Corpus> result{ShortQueries(), LongDocuments(), NoWhitespace()};
+    if (const char* corpus_file = std::getenv("OCOS_BENCHMARK_CORPUS")) {
+      result.push_back(FromFile(corpus_file));
+    }
+    return result;
+  }();
+  return corpora;
+}
+
+namespace {
+std::vector<std::function<void()>>& Suites() {
+  static std::vector<std::function<void()>> suites;
+  return suites;
+}
+}  // namespace
+
+bool RegisterSuite(std::function<void()> registrar) {
+  Suites().push_back(std::move(registrar));
+  return true;
+}
+
+void RegisterAllSuites() {
+  for (auto& registrar : Suites()) {
+    registrar();
+  }
+}
+
+bool RegisterTokenizer(const std::string& name, std::function<TokenizeFn()> factory) {
+  Tokenizers().push_back(TokenizerEntry{name, std::move(factory), nullptr});
+  return true;
+}
+
+void RegisterAllTokenizers() {
+  for (auto& entry : Tokenizers()) {
+    for (const auto& corpus : Corpora()) {
+      benchmark::RegisterBenchmark((entry.name + "/" + corpus.name).c_str(),
+                                   [&entry, &corpus](benchmark::State& state) { RunTokenizer(state, entry, corpus); })
+          ->Unit(benchmark::kMicrosecond);
+    }
+  }
+}
+
+}  // namespace ocos_benchmark
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ocos_benchmark::RegisterAllTokenizers();
+  ocos_benchmark::RegisterAllSuites();
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
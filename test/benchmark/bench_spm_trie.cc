@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <sstream>
+
+#include "bench_utils.hpp"
+
+#ifdef ENABLE_SPM_TOKENIZER
+#include "sentencepiece_processor.h"
+#endif
+#ifdef ENABLE_TRIE_TOKENIZER
+#include "string_utils.h"
+#include "trie_tokenizer.hpp"
+#include "nlohmann/json.hpp"
+#endif
+
+namespace {
+
+using namespace ocos_benchmark;
+
+#ifdef ENABLE_SPM_TOKENIZER
+TokenizeFn MakeSentencepieceBenchmark() {
+  auto tokenizer = std::make_shared<sentencepiece::SentencePieceProcessor>();
+  auto status = tokenizer->LoadFromSerializedProto(ReadFile(DataPath("sentencepiece.bpe.model")));
+  if (!status.ok()) {
+    ORTX_CXX_API_THROW(MakeString("Failed to load sentencepiece.bpe.model: ", status.error_message()), ORT_FAIL);
+  }
+
+  return [tokenizer](const std::string& text) {
+    std::vector<int> ids;
+    if (!tokenizer->Encode(text, &ids).ok()) {
+      ORTX_CXX_API_THROW(MakeString("Unable to encode string '", text, "'."), ORT_INVALID_ARGUMENT);
+    }
+    return ids.size();
+  };
+}
+
+const bool kSentencepieceRegistered = RegisterTokenizer("SentencepieceTokenizer", MakeSentencepieceBenchmark);
+#endif  // ENABLE_SPM_TOKENIZER
+
+#ifdef ENABLE_TRIE_TOKENIZER
+// test/data has no RWKV vocabulary, so the byte strings of the GPT-2 tokens make up one in its format,
+// unless OCOS_BENCHMARK_TRIE_VOCAB names a real one.
+std::string TrieVocabFromGpt2() {
+  // the inverse of the byte-to-unicode mapping of the byte-level BPE
+  std::unordered_map<char32_t, char> byte_decoder;
+  char32_t extra = 256;
+  for (int byte = 0; byte < 256; ++byte) {
+    bool printable = (byte >= 33 && byte <= 126) || (byte >= 161 && byte <= 172) || (byte >= 174);
+    byte_decoder[printable ? static_cast<char32_t>(byte) : extra++] = static_cast<char>(byte);
+  }
+
+  std::unordered_map<std::string, int32_t> gpt2_vocab;
+  nlohmann::json::parse(ReadFile(DataPath("gpt2.vocab"))).get_to(gpt2_vocab);
+
+  std::ostringstream vocab;
+  static const char* kHex = "0123456789abcdef";
+  for (const auto& [token, id] : gpt2_vocab) {
+    std::string bytes;
+    for (char32_t ch : ustring(token)) {
+      auto it = byte_decoder.find(ch);
+      if (it == byte_decoder.end()) {
+        bytes.clear();
+        break;  // a special token
+      }
+      bytes.push_back(it->second);
+    }
+    if (bytes.empty()) {
+      continue;
+    }
+
+    // the ids of the vocabulary start from 1
+    vocab << id + 1 << " b'";
+    for (char byte : bytes) {
+      auto value = static_cast<unsigned char>(byte);
+      vocab << "\\x" << kHex[value >> 4] << kHex[value & 0xF];
+    }
+    vocab << "' " << bytes.size() << '\n';
+  }
+  return vocab.str();
+}
+
+TokenizeFn MakeTrieBenchmark() {
+  const char* vocab_file = std::getenv("OCOS_BENCHMARK_TRIE_VOCAB");
+  auto tokenizer = std::make_shared<TrieTokenizer>(vocab_file != nullptr ? ReadFile(vocab_file) : TrieVocabFromGpt2());
+  return [tokenizer](const std::string& text) { return tokenizer->encodeBytes(text).size(); };
+}
+
+const bool kTrieRegistered = RegisterTokenizer("TrieTokenizer", MakeTrieBenchmark);
+#endif  // ENABLE_TRIE_TOKENIZER
+
+}  // namespace
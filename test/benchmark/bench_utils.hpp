@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+namespace ocos_benchmark {
+
+// The texts which a tokenizer is measured on, and their total size in bytes.
+struct Corpus {
+  std::string name;
+  std::vector<std::string> texts;
+  size_t bytes = 0;
+};
+
+// The built-in corpora are the short queries, the long documents and the adversarial strings without any
+// whitespace. If OCOS_BENCHMARK_CORPUS names a file, its lines are one more corpus named "file".
+const std::vector<Corpus>& Corpora();
+
+// The path of a file in the test data directory, which OCOS_BENCHMARK_DATA_DIR overrides.
+std::string DataPath(const std::string& file_name);
+std::string ReadFile(const std::string& path);
+
+// The number of the calls to the global operator new so far.
+uint64_t AllocationCount();
+
+// The allocations which the global operator new makes too, for the libraries with their own allocation callbacks.
+void* TrackedMalloc(size_t size) noexcept;
+void* TrackedRealloc(void* ptr, size_t size) noexcept;
+void TrackedFree(void* ptr) noexcept;
+
+// Resets the peak of the bytes of the global operator new which aren't deleted yet to the current ones, and returns
+// them, so that PeakBytes() minus them is the peak memory of the code run after the reset.
+int64_t ResetPeakBytes();
+int64_t PeakBytes();
+
+// Tokenizes a text, and returns the number of the tokens.
+using TokenizeFn = std::function<size_t(const std::string&)>;
+
+// Registers a benchmark of the tokenizer on every corpus. The factory loads the vocabulary when the
+// first of these benchmarks runs, so that the filtered-out tokenizers don't cost anything.
+bool RegisterTokenizer(const std::string& name, std::function<TokenizeFn()> factory);
+
+// Registers the benchmarks of all the tokenizers, which must be called after benchmark::Initialize.
+void RegisterAllTokenizers();
+
+// Registers a function which registers the benchmarks of a suite other than the tokenizers, like the audio pipeline,
+// and RegisterAllSuites() calls all of them after benchmark::Initialize.
+bool RegisterSuite(std::function<void()> registrar);
+void RegisterAllSuites();
+
+}  // namespace ocos_benchmark
@@ -0,0 +1,313 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifdef ENABLE_VISION
+#include <cstring>
+#include <functional>
+#include <map>
+#include <random>
+#include <type_traits>
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include "ocos.h"
+#include "string_utils.h"
+#include "parallel_for.h"
+#include "vision/decode_image.hpp"
+#include "vision/draw_bounding_box.hpp"
+#include "vision/image_transform.hpp"
+#include "bench_utils.hpp"
+
+namespace {
+
+using namespace ocos_benchmark;
+using namespace ort_extensions;
+
+// The kernels need an ORT kernel info for their attributes, so the benchmarks run the functions which the vision
+// kernels are built on: the decoding, the encoding, the drawing of the boxes, the blur and the preprocessing of a
+// model, at several resolutions of test/data/pineapple.jpg and several thread counts. The models of ppp_vision run
+// in onnxruntime, which the benchmarks don't link, so their pipeline is measured as its steps here: the decoding,
+// the resize, the crop and the normalization, one by one and fused. Every benchmark reports images/s, and
+// copied_bytes, the bytes which a call copies between its buffers besides the output it produces.
+struct Resolution {
+  const char* name;
+  int height;
+  int width;
+};
+
+constexpr Resolution kResolutions[] = {{"480p", 480, 640}, {"1080p", 1080, 1920}, {"2160p", 2160, 3840}};
+
+struct VisionImage {
+  cv::Mat bgr;
+  std::vector<uint8_t> jpg;
+  std::vector<uint8_t> png;
+};
+
+const VisionImage& LoadImage(const Resolution& resolution) {
+  static std::map<std::string, VisionImage> images;
+  auto& image = images[resolution.name];
+  if (image.bgr.empty()) {
+    const std::string data = ReadFile(DataPath("pineapple.jpg"));
+    const cv::Mat encoded(1, static_cast<int>(data.size()), CV_8UC1, const_cast<char*>(data.data()));
+    const cv::Mat original = cv::imdecode(encoded, cv::IMREAD_COLOR);
+    cv::resize(original, image.bgr, cv::Size(resolution.width, resolution.height), 0, 0, cv::INTER_LINEAR);
+    cv::imencode(".jpg", image.bgr, image.jpg);
+    cv::imencode(".png", image.bgr, image.png);
+  }
+  return image;
+}
+
+void ReportImages(benchmark::State& state, size_t images_per_call, size_t copied_bytes) {
+  state.counters["images/s"] = benchmark::Counter(static_cast<double>(state.iterations() * images_per_call),
+                                                  benchmark::Counter::kIsRate);
+  state.counters["copied_bytes"] = benchmark::Counter(static_cast<double>(copied_bytes));
+}
+
+cv::Mat EncodedMat(const std::vector<uint8_t>& data) {
+  return cv::Mat(1, static_cast<int>(data.size()), CV_8UC1, const_cast<uint8_t*>(data.data()));
+}
+
+// DecodeImage before it decoded into the output: the decoding into a Mat, and the copy into the output.
+void DecodeAndCopy(benchmark::State& state, const std::vector<uint8_t>& data) {
+  const cv::Mat encoded = EncodedMat(data);
+  size_t copied = 0;
+  for (auto _ : state) {
+    const cv::Mat decoded = cv::imdecode(encoded, cv::IMREAD_COLOR);
+    std::vector<uint8_t> output(decoded.total() * decoded.elemSize());
+    std::memcpy(output.data(), decoded.data, output.size());
+    copied = output.size();
+    benchmark::DoNotOptimize(output.data());
+  }
+  ReportImages(state, 1, copied);
+}
+
+// DecodeImage: the size from the header, and the decoding into the output, at 1/scale of the size for a JPEG image.
+void DecodeIntoOutput(benchmark::State& state, const std::vector<uint8_t>& data, int64_t min_side,
+                      DecodeColorSpace color_space) {
+  const cv::Mat encoded = EncodedMat(data);
+  for (auto _ : state) {
+    ImageHeader header;
+    if (!ReadImageHeader(data.data(), data.size(), header)) {
+      state.SkipWithError("no image header");
+      return;
+    }
+    const int64_t scale_denominator = min_side > 0 ? JpegScaleDenominator(header, min_side, min_side) : 1;
+    header = ReducedImageHeader(header, scale_denominator);
+    const int64_t channels = ColorChannels(color_space);
+    std::vector<uint8_t> output(static_cast<size_t>(header.height * header.width * channels));
+    DecodeImageInto(encoded, header, scale_denominator, color_space, output.data(),
+                    static_cast<size_t>(header.width * channels), "[Benchmark]");
+    benchmark::DoNotOptimize(output.data());
+  }
+  ReportImages(state, 1, 0);
+}
+
+// EncodeImage: the encoding into a vector, and its copy into the output.
+void Encode(benchmark::State& state, const cv::Mat& bgr, const std::string& extension, std::vector<int> params) {
+  std::vector<uint8_t> buffer;
+  size_t copied = 0;
+  for (auto _ : state) {
+    if (!cv::imencode(extension, bgr, buffer, params)) {
+      state.SkipWithError("failed to encode");
+      return;
+    }
+    std::vector<uint8_t> output(buffer.size());
+    std::memcpy(output.data(), buffer.data(), buffer.size());
+    copied = buffer.size();
+    benchmark::DoNotOptimize(output.data());
+  }
+  ReportImages(state, 1, copied);
+}
+
+std::vector<float> RandomBoxes(size_t count, const Resolution& resolution) {
+  std::mt19937 rng(static_cast<uint32_t>(count));
+  std::uniform_real_distribution<float> x(0.0f, static_cast<float>(resolution.width));
+  std::uniform_real_distribution<float> y(0.0f, static_cast<float>(resolution.height));
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+  std::vector<float> boxes;
+  for (size_t i = 0; i < count; ++i) {
+    const float x1 = x(rng);
+    const float y1 = y(rng);
+    boxes.insert(boxes.end(), {x1, y1, x1 + unit(rng) * 200, y1 + unit(rng) * 200, unit(rng),
+                               static_cast<float>(i % 20)});
+  }
+  return boxes;
+}
+
+// DrawBoundingBoxes: the copy of the input into the output, and the boxes drawn on it.
+void DrawBoxes(benchmark::State& state, const Resolution& resolution, size_t count, bool colour_by_classes,
+               float score_threshold) {
+  const cv::Mat& bgr = LoadImage(resolution).bgr;
+  const std::vector<float> boxes = RandomBoxes(count, resolution);
+  const BoxDrawingOptions options{BoundingBoxFormat::XYXY, 4, colour_by_classes, score_threshold, 0};
+  const size_t image_bytes = bgr.total() * bgr.elemSize();
+  std::vector<uint8_t> output(image_bytes);
+  for (auto _ : state) {
+    std::memcpy(output.data(), bgr.data, image_bytes);
+    DrawBoxesOnImage(output.data(), bgr.rows, bgr.cols, boxes.data(), static_cast<int64_t>(count), options);
+    benchmark::DoNotOptimize(output.data());
+  }
+  ReportImages(state, 1, image_bytes);
+}
+
+// GaussianBlur: every image of the batch blurred into its slice of the output in parallel.
+template <typename T>
+void Blur(benchmark::State& state, const Resolution& resolution, size_t batch, size_t num_threads) {
+  const cv::Mat& bgr = LoadImage(resolution).bgr;
+  cv::Mat image;
+  bgr.convertTo(image, cv::DataType<T>::depth, std::is_same<T, float>::value ? 1.0 / 255 : 1.0);
+  const size_t image_size = image.total() * 3;
+  std::vector<T> input(batch * image_size);
+  for (size_t i = 0; i < batch; ++i) {
+    std::memcpy(input.data() + i * image_size, image.data, image_size * sizeof(T));
+  }
+  std::vector<T> output(input.size());
+  const int type = CV_MAKETYPE(cv::DataType<T>::depth, 3);
+  for (auto _ : state) {
+    ParallelFor(batch, num_threads, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        const cv::Mat src(image.rows, image.cols, type, input.data() + i * image_size);
+        cv::Mat dst(image.rows, image.cols, type, output.data() + i * image_size);
+        cv::GaussianBlur(src, dst, cv::Size(5, 5), 1.5, 1.5, cv::BORDER_DEFAULT);
+      }
+    });
+    benchmark::DoNotOptimize(output.data());
+  }
+  ReportImages(state, batch, 0);
+}
+
+// The preprocessing of a model of 224x224 after the decoding: the resize of the shorter side to 256, the crop at
+// the center, and the normalization into the planes of the channels.
+ImageTransformOptions ModelOptions() {
+  ImageTransformOptions options;
+  options.resize_to = {256, 256};
+  options.crop = {224, 224};
+  options.mean = {0.485f, 0.456f, 0.406f};
+  options.std = {0.229f, 0.224f, 0.225f};
+  options.swap_rb = true;
+  return options;
+}
+
+// the steps of the pre/post processing tools: Resize, CenterCrop, ImageBytesToFloat, Normalize and
+// ChannelsLastToChannelsFirst, each of them into a new image.
+void PreprocessBySteps(benchmark::State& state, const Resolution& resolution) {
+  const cv::Mat& bgr = LoadImage(resolution).bgr;
+  const ImageTransformOptions options = ModelOptions();
+  const auto resized_size = ResizedImageSize(bgr.rows, bgr.cols, options);
+  const auto size = CroppedImageSize(resized_size, options);
+  size_t copied = 0;
+  for (auto _ : state) {
+    cv::Mat resized;
+    cv::resize(bgr, resized, cv::Size(static_cast<int>(resized_size[1]), static_cast<int>(resized_size[0])), 0, 0,
+               cv::INTER_LINEAR);
+    const cv::Rect roi{static_cast<int>((resized_size[1] - size[1]) / 2),
+                       static_cast<int>((resized_size[0] - size[0]) / 2), static_cast<int>(size[1]),
+                       static_cast<int>(size[0])};
+    const cv::Mat cropped = resized(roi).clone();
+    cv::Mat rgb;
+    cv::cvtColor(cropped, rgb, cv::COLOR_BGR2RGB);
+    cv::Mat scaled;
+    rgb.convertTo(scaled, CV_32F, options.rescale);
+    const size_t plane = static_cast<size_t>(size[0] * size[1]);
+    std::vector<float> output(3 * plane);
+    const float* pixels = reinterpret_cast<const float*>(scaled.data);
+    for (size_t i = 0; i < plane; ++i) {
+      for (size_t c = 0; c < 3; ++c) {
+        output[c * plane + i] = (pixels[i * 3 + c] - options.mean[c]) / options.std[c];
+      }
+    }
+    benchmark::DoNotOptimize(output.data());
+    copied = resized.total() * 3 + cropped.total() * 3 * 2 + scaled.total() * 3 * sizeof(float);
+  }
+  ReportImages(state, 1, copied);
+}
+
+// DecodeImageNormalize after the decoding: all the steps in one pass over the output.
+void PreprocessFused(benchmark::State& state, const Resolution& resolution, size_t num_threads) {
+  const cv::Mat& bgr = LoadImage(resolution).bgr;
+  const ImageTransformOptions options = ModelOptions();
+  const auto size = TransformedImageSize(bgr.rows, bgr.cols, options);
+  std::vector<float> output(static_cast<size_t>(3 * size[0] * size[1]));
+  for (auto _ : state) {
+    TransformImage(bgr.data, bgr.rows, bgr.cols, bgr.step[0], options, output.data(), num_threads);
+    benchmark::DoNotOptimize(output.data());
+  }
+  ReportImages(state, 1, 0);
+}
+
+void RegisterVision() {
+  auto add = [](const std::string& name, std::function<void(benchmark::State&)> run) {
+    benchmark::RegisterBenchmark(("Vision/" + name).c_str(), run)->Unit(benchmark::kMillisecond)->UseRealTime();
+  };
+
+  for (const Resolution& resolution : kResolutions) {
+    const std::string res = resolution.name;
+    // the image is resized and encoded when its first benchmark runs
+    for (const char* format : {"jpg", "png"}) {
+      const std::string fmt = format;
+      auto data = [resolution, fmt]() -> const std::vector<uint8_t>& {
+        const VisionImage& image = LoadImage(resolution);
+        return fmt == "jpg" ? image.jpg : image.png;
+      };
+      add("decode_copy/" + fmt + "/" + res, [data](benchmark::State& state) { DecodeAndCopy(state, data()); });
+      add("decode_into/" + fmt + "/" + res, [data](benchmark::State& state) {
+        DecodeIntoOutput(state, data(), 0, DecodeColorSpace::kBGR);
+      });
+      add("decode_into_rgb/" + fmt + "/" + res, [data](benchmark::State& state) {
+        DecodeIntoOutput(state, data(), 0, DecodeColorSpace::kRGB);
+      });
+      add("decode_into_gray/" + fmt + "/" + res, [data](benchmark::State& state) {
+        DecodeIntoOutput(state, data(), 0, DecodeColorSpace::kGray);
+      });
+    }
+    add("decode_reduced@224/jpg/" + res, [resolution](benchmark::State& state) {
+      DecodeIntoOutput(state, LoadImage(resolution).jpg, 224, DecodeColorSpace::kBGR);
+    });
+
+    for (int quality : {95, 75}) {
+      add("encode/jpg@" + std::to_string(quality) + "/" + res, [resolution, quality](benchmark::State& state) {
+        Encode(state, LoadImage(resolution).bgr, ".jpg", {cv::IMWRITE_JPEG_QUALITY, quality});
+      });
+    }
+    for (int level : {0, 1, 3, 9}) {
+      add("encode/png@" + std::to_string(level) + "/" + res, [resolution, level](benchmark::State& state) {
+        Encode(state, LoadImage(resolution).bgr, ".png", {cv::IMWRITE_PNG_COMPRESSION, level});
+      });
+    }
+
+    for (size_t count : {10, 100, 1000}) {
+      const std::string boxes = std::to_string(count);
+      add("draw_boxes_by_score/" + boxes + "/" + res, [resolution, count](benchmark::State& state) {
+        DrawBoxes(state, resolution, count, false, -1.0f);
+      });
+      add("draw_boxes_by_class/" + boxes + "/" + res, [resolution, count](benchmark::State& state) {
+        DrawBoxes(state, resolution, count, true, -1.0f);
+      });
+      add("draw_boxes_by_class@0.5/" + boxes + "/" + res, [resolution, count](benchmark::State& state) {
+        DrawBoxes(state, resolution, count, true, 0.5f);
+      });
+    }
+
+    for (size_t num_threads : {1, 4}) {
+      const std::string threads = "/threads:" + std::to_string(num_threads);
+      add("blur_f32/batch:8/" + res + threads, [resolution, num_threads](benchmark::State& state) {
+        Blur<float>(state, resolution, 8, num_threads);
+      });
+      add("blur_u8/batch:8/" + res + threads, [resolution, num_threads](benchmark::State& state) {
+        Blur<uint8_t>(state, resolution, 8, num_threads);
+      });
+      add("preprocess_fused/" + res + threads, [resolution, num_threads](benchmark::State& state) {
+        PreprocessFused(state, resolution, num_threads);
+      });
+    }
+    add("preprocess_steps/" + res, [resolution](benchmark::State& state) { PreprocessBySteps(state, resolution); });
+  }
+}
+
+const bool kVisionRegistered = RegisterSuite(RegisterVision);
+
+}  // namespace
+
+#endif  // ENABLE_VISION
@@ -37,9 +37,12 @@ def create_model(output_file: Path, **kwargs):
     mode = kwargs.get("mode", "XYXY")
     colour_by_classes = kwargs.get("colour_by_classes", False)
     thickness = kwargs.get("thickness", 4)
+    score_threshold = kwargs.get("score_threshold", None)
+    max_boxes = kwargs.get("max_boxes", 0)
     pipeline.add_post_processing(
         [
-            DrawBoundingBoxes(mode=mode, thickness=thickness, colour_by_classes=colour_by_classes),
+            DrawBoundingBoxes(mode=mode, thickness=thickness, colour_by_classes=colour_by_classes,
+                              score_threshold=score_threshold, max_boxes=max_boxes),
             ConvertBGRToImage(image_format="png"),  # jpg or png are supported
         ]
     )
@@ -14,7 +14,7 @@ struct ExceptionalKernel1 : BaseKernel {
     ORTX_CXX_API_THROW("Throw in ctor", ORT_FAIL);
   }
 
-  void Compute(OrtKernelContext* context) {}
+  void Compute(OrtKernelContext* context) const {}
 };
 
 // throw in Compute which will be called during model execution
@@ -22,7 +22,7 @@ struct ExceptionalKernel2 : BaseKernel {
   ExceptionalKernel2(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
   }
 
-  void Compute(OrtKernelContext* context) {
+  void Compute(OrtKernelContext* context) const {
     ORTX_CXX_API_THROW("Throw in Compute", ORT_FAIL);
   }
 };
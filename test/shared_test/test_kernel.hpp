@@ -57,4 +57,12 @@ void TestInference(Ort::Env& env, const ORTCHAR_T* model_uri,
                    const char* custom_op_library_filename,
                    OutputValidator output_validator = nullptr);
 
+// Runs one session of the model from num_threads threads at once, each of which checks the outputs of
+// iterations runs, so the kernels of its nodes are computed concurrently.
+void TestConcurrentInference(Ort::Env& env, const ORTCHAR_T* model_uri,
+                             const std::vector<TestValue>& inputs,
+                             const std::vector<TestValue>& outputs,
+                             const char* custom_op_library_filename,
+                             size_t num_threads = 8, size_t iterations = 50);
+
 void GetTensorMutableDataString(const OrtApi& api, const OrtValue* value, std::vector<std::string>& output);
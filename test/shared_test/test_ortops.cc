@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #include <filesystem>
+#include <thread>
 #include "gtest/gtest.h"
 #include "ocos.h"
 #include "ustring.h"
@@ -24,7 +25,7 @@ struct KernelOne : BaseKernel {
   KernelOne(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
   }
 
-  void Compute(OrtKernelContext* context) {
+  void Compute(OrtKernelContext* context) const {
     // Setup inputs
     const OrtValue* input_X = ort_.KernelContext_GetInput(context, 0);
     const OrtValue* input_Y = ort_.KernelContext_GetInput(context, 1);
@@ -69,7 +70,7 @@ struct CustomOpOne : OrtW::CustomOpBase<CustomOpOne, KernelOne> {
 struct KernelTwo : BaseKernel {
   KernelTwo(const OrtApi& api, const OrtKernelInfo& info) : BaseKernel(api, info) {
   }
-  void Compute(OrtKernelContext* context) {
+  void Compute(OrtKernelContext* context) const {
     // Setup inputs
     const OrtValue* input_X = ort_.KernelContext_GetInput(context, 0);
     const float* X = ort_.GetTensorData<float>(input_X);
@@ -115,7 +116,7 @@ struct KernelThree : BaseKernel {
       substr_ = "";
     }
   }
-  void Compute(OrtKernelContext* context) {
+  void Compute(OrtKernelContext* context) const {
     // Setup inputs
     const OrtValue* input_val = ort_.KernelContext_GetInput(context, 0);
     std::vector<std::string> input_strs;
@@ -324,6 +325,35 @@ void TestInference(Ort::Env& env, const ORTCHAR_T* model_uri,
   RunSession(session, inputs, outputs, output_validator);
 }
 
+void TestConcurrentInference(Ort::Env& env, const ORTCHAR_T* model_uri,
+                             const std::vector<TestValue>& inputs,
+                             const std::vector<TestValue>& outputs,
+                             const char* custom_op_library_filename,
+                             size_t num_threads, size_t iterations) {
+  Ort::SessionOptions session_options;
+  void* handle = nullptr;
+  if (custom_op_library_filename) {
+    Ort::ThrowOnError(Ort::GetApi().RegisterCustomOpsLibrary((OrtSessionOptions*)session_options,
+                                                             custom_op_library_filename, &handle));
+  }
+  // the independent nodes of a run are computed at the same time too
+  session_options.SetExecutionMode(ExecutionMode::ORT_PARALLEL);
+
+  // one session, and so one kernel of every node, is run by all the threads at once
+  Ort::Session session(env, model_uri, session_options);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&]() {
+      for (size_t i = 0; i < iterations; ++i) {
+        RunSession(session, inputs, outputs);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
 static CustomOpOne op_1st;
 static CustomOpTwo op_2nd;
 
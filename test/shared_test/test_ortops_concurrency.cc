@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <filesystem>
+#include "gtest/gtest.h"
+#include "ocos.h"
+#include "test_kernel.hpp"
+
+// The kernels of a session are shared by all its concurrent Run calls, so these run the models of the other
+// tests from many threads at once, and each thread checks the outputs of every run. A data race in a Compute
+// shows up as a wrong output here, or as a report of the build with -fsanitize=thread.
+
+TEST(concurrency, test_string_lower) {
+  auto ort_env = std::make_unique<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "Default");
+
+  std::vector<TestValue> inputs(1);
+  inputs[0].name = "input_1";
+  inputs[0].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  inputs[0].dims = {3, 1};
+  inputs[0].values_string = {"Abc", "Abcé", "中文"};
+
+  std::vector<TestValue> outputs(1);
+  outputs[0].name = "customout";
+  outputs[0].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  outputs[0].dims = inputs[0].dims;
+  outputs[0].values_string = {"abc", "abcé", "中文"};
+
+  std::filesystem::path model_path = "data";
+  model_path /= "custom_op_string_lower.onnx";
+  TestConcurrentInference(*ort_env, model_path.c_str(), inputs, outputs, GetLibraryPath());
+}
+
+TEST(concurrency, test_string_ecmaregex_replace) {
+  auto ort_env = std::make_unique<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "Default");
+
+  std::vector<TestValue> inputs(3);
+  inputs[0].name = "input";
+  inputs[0].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  inputs[0].dims = {1};
+  inputs[0].values_string = {"a Test 1 2 3 ♠♣"};
+
+  inputs[1].name = "pattern";
+  inputs[1].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  inputs[1].dims = {1};
+  inputs[1].values_string = {"(\\d)"};
+
+  inputs[2].name = "rewrite";
+  inputs[2].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  inputs[2].dims = {1};
+  inputs[2].values_string = {"$010"};
+
+  std::vector<TestValue> outputs(1);
+  outputs[0].name = "output";
+  outputs[0].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  outputs[0].dims = {1};
+  outputs[0].values_string = {"a Test 10 20 30 ♠♣"};
+
+  std::filesystem::path model_path = "data";
+  model_path /= "test_string_ecmaregex_replace.onnx";
+  TestConcurrentInference(*ort_env, model_path.c_str(), inputs, outputs, GetLibraryPath());
+}
+
+TEST(concurrency, test_string_join) {
+  auto ort_env = std::make_unique<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "Default");
+
+  std::vector<TestValue> inputs(3);
+  inputs[0].name = "text";
+  inputs[0].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  inputs[0].dims = {1, 3};
+  inputs[0].values_string = {"abc", "zzz", "efg"};
+
+  inputs[1].name = "sep";
+  inputs[1].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  inputs[1].dims = {1};
+  inputs[1].values_string = {"-"};
+
+  inputs[2].name = "axis";
+  inputs[2].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64;
+  inputs[2].dims = {1};
+  inputs[2].values_int64 = {1};
+
+  std::vector<TestValue> outputs(1);
+  outputs[0].name = "out";
+  outputs[0].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  outputs[0].dims = {1};
+  outputs[0].values_string = {"abc-zzz-efg"};
+
+  std::filesystem::path model_path = "data";
+  model_path /= "custom_op_string_join.onnx";
+  TestConcurrentInference(*ort_env, model_path.c_str(), inputs, outputs, GetLibraryPath());
+}
+
+#ifdef ENABLE_RE2_REGEX
+TEST(concurrency, test_regex_split_with_offsets) {
+  auto ort_env = std::make_unique<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "Default");
+
+  std::vector<TestValue> inputs(1);
+  inputs[0].name = "input:0";
+  inputs[0].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  inputs[0].dims = {2};
+  inputs[0].values_string = {"a Test 1 2 3 ♠♣", "Hi there test test ♥♦"};
+
+  std::vector<TestValue> outputs(4);
+  outputs[0].name = "output:0";
+  outputs[0].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  outputs[0].dims = {11};
+  outputs[0].values_string = {"a", "Test", "1", "2", "3", "♠♣", "Hi", "there", "test", "test", "♥♦"};
+
+  outputs[1].name = "output1:0";
+  outputs[1].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64;
+  outputs[1].dims = {11};
+  outputs[1].values_int64 = {0, 2, 7, 9, 11, 13, 0, 3, 9, 14, 19};
+
+  outputs[2].name = "output2:0";
+  outputs[2].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64;
+  outputs[2].dims = {11};
+  outputs[2].values_int64 = {1, 6, 8, 10, 12, 19, 2, 8, 13, 18, 25};
+
+  outputs[3].name = "output3:0";
+  outputs[3].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64;
+  outputs[3].dims = {3};
+  outputs[3].values_int64 = {0, 6, 11};
+
+  std::filesystem::path model_path = "data";
+  model_path /= "test_regex_split_with_offsets.onnx";
+  TestConcurrentInference(*ort_env, model_path.c_str(), inputs, outputs, GetLibraryPath());
+}
+#endif
+
+TEST(concurrency, test_bert_tokenizer) {
+  auto ort_env = std::make_unique<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "Default");
+
+  std::vector<TestValue> inputs(1);
+  inputs[0].name = "text";
+  inputs[0].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  inputs[0].dims = {1};
+  inputs[0].values_string = {"We look forward to welcoming you to our stores. Whether you shop in a store or shop online, our Specialists can help you buy the products you love."};
+
+  std::vector<TestValue> outputs(3);
+  outputs[0].name = "input_ids";
+  outputs[0].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64;
+  outputs[0].dims = {34};
+  outputs[0].values_int64 = {101, 1284, 1440, 1977, 1106, 20028, 1128, 1106, 1412, 4822, 119, 13197, 1128, 4130, 1107, 170, 2984, 1137, 4130, 3294, 117, 1412, 25607, 1116, 1169, 1494, 1128, 4417, 1103, 2982, 1128, 1567, 119, 102};
+
+  outputs[1].name = "token_type_ids";
+  outputs[1].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64;
+  outputs[1].dims = {34};
+  outputs[1].values_int64 = std::vector<int64_t>(34, 0);
+
+  outputs[2].name = "attention_mask";
+  outputs[2].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64;
+  outputs[2].dims = {34};
+  outputs[2].values_int64 = std::vector<int64_t>(34, 1);
+
+  std::filesystem::path model_path = "data";
+  model_path /= "test_bert_tokenizer.onnx";
+  TestConcurrentInference(*ort_env, model_path.c_str(), inputs, outputs, GetLibraryPath());
+}
+
+TEST(concurrency, test_bert_tokenizer_decoder) {
+  auto ort_env = std::make_unique<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "Default");
+
+  std::vector<TestValue> inputs(2);
+  inputs[0].name = "ids";
+  inputs[0].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64;
+  inputs[0].dims = {5};
+  inputs[0].values_int64 = {101, 2774, 102, 2774, 102};
+
+  inputs[1].name = "position";
+  inputs[1].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64;
+  inputs[1].dims = {0, 2};
+  inputs[1].values_int64 = {};
+
+  std::vector<TestValue> outputs(1);
+  outputs[0].name = "str";
+  outputs[0].element_type = ONNXTensorElementDataType::ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING;
+  outputs[0].dims = {1};
+  outputs[0].values_string = {"[CLS] test [SEP] test [SEP]"};
+
+  std::filesystem::path model_path = "data";
+  model_path /= "test_bert_tokenizer_decoder_without_indices.onnx";
+  TestConcurrentInference(*ort_env, model_path.c_str(), inputs, outputs, GetLibraryPath());
+}
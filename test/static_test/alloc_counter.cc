@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cstdlib>
+#include <new>
+
+#include "alloc_counter.h"
+
+namespace {
+thread_local size_t g_thread_allocations = 0;
+
+void* CountedMalloc(size_t size) noexcept {
+  ++g_thread_allocations;
+  return std::malloc(size == 0 ? 1 : size);
+}
+}  // namespace
+
+// the global allocations of each thread are counted for the allocation budgets of the hot paths. the array forms
+// call these ones, and the libraries keep the operator new of the runtime, as only the tests link this file.
+void* operator new(size_t size) {
+  if (void* ptr = CountedMalloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return CountedMalloc(size); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+namespace ort_extensions {
+namespace test {
+
+size_t ThreadAllocations() { return g_thread_allocations; }
+
+}  // namespace test
+}  // namespace ort_extensions
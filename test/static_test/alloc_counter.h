@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace ort_extensions {
+namespace test {
+
+// The allocations of the global operator new on the calling thread so far. The operator new of the tests, which
+// alloc_counter.cc replaces, counts them, so the hot paths which should reuse their memory, like the Compute of the
+// string kernels or the encoding of the tokenizers, can be asserted to stay within a budget.
+size_t ThreadAllocations();
+
+// The most allocations of a call of fn on the calling thread in the runs after the warm-up calls, which fill the
+// caches, the scratch arenas and the capacities of the buffers a call reuses.
+template <typename Fn>
+size_t AllocationsPerCall(Fn&& fn, size_t warmup = 2, size_t runs = 3) {
+  for (size_t i = 0; i < warmup; ++i) {
+    fn();
+  }
+
+  size_t most = 0;
+  for (size_t i = 0; i < runs; ++i) {
+    const size_t before = ThreadAllocations();
+    fn();
+    most = std::max(most, ThreadAllocations() - before);
+  }
+  return most;
+}
+
+}  // namespace test
+}  // namespace ort_extensions
+
+// Expects a warmed call of fn to allocate at most budget times.
+#define EXPECT_ALLOCATIONS_AT_MOST(budget, fn) \
+  EXPECT_LE(ort_extensions::test::AllocationsPerCall(fn), static_cast<size_t>(budget))
@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "alloc_counter.h"
+#include "ortx_tokenizer.h"
+#include "text/string_multi_replace.hpp"
+#include "text/string_phrase_match.hpp"
+
+namespace {
+
+OrtxStringSpan Span(const std::string& text) { return OrtxStringSpan{text.data(), text.size()}; }
+
+// The allocations of an encoding of the texts by the tokenizer into the buffers of the caller, after the encodings
+// which warm its caches.
+size_t EncodeAllocations(const OrtxTokenizer* tokenizer, const std::vector<std::string>& texts) {
+  std::vector<OrtxStringSpan> spans;
+  for (const auto& text : texts) {
+    spans.push_back(Span(text));
+  }
+  std::vector<size_t> row_offsets(texts.size() + 1);
+  EXPECT_EQ(OrtxEncodeBatch(tokenizer, spans.data(), spans.size(), nullptr, 0, row_offsets.data()), 0);
+  std::vector<int64_t> ids(row_offsets.back());
+  return ort_extensions::test::AllocationsPerCall([&]() {
+    OrtxEncodeBatch(tokenizer, spans.data(), spans.size(), ids.data(), ids.size(), row_offsets.data());
+  });
+}
+
+}  // namespace
+
+TEST(allocations, counter) {
+  std::vector<int> values;
+  EXPECT_EQ(ort_extensions::test::AllocationsPerCall([&]() { values = std::vector<int>(100, 1); }, 0, 1), 1u);
+  // a buffer which keeps its capacity allocates nothing
+  EXPECT_ALLOCATIONS_AT_MOST(0, [&]() {
+    values.clear();
+    values.resize(100, 2);
+  });
+}
+
+TEST(allocations, string_multi_replace) {
+  MultiReplacer replacer;
+  replacer.Build({{"Mr.", "Mister"}, {"Dr.", "Doctor"}, {"&amp;", "&"}});
+  const std::string text = "Dr. Smith &amp; Mr. Jones met Dr. Who &amp; Mrs. Brown";
+  std::vector<MultiReplacer::Match> matches;
+  std::string output;
+  EXPECT_ALLOCATIONS_AT_MOST(0, [&]() {
+    output.resize(replacer.Find(text, matches));
+    replacer.Write(text, matches, output.data());
+  });
+  EXPECT_EQ(output, "Doctor Smith & Mister Jones met Doctor Who & Mrs. Brown");
+}
+
+TEST(allocations, string_phrase_match) {
+  for (bool token_level : {false, true}) {
+    PhraseMatcher matcher;
+    PhraseMatcher::Options options;
+    options.token_level = token_level;
+    options.case_insensitive = true;
+    matcher.Build({{"new york", 1}, {"new york city", 2}, {"york", 3}}, options);
+    std::vector<PhraseMatcher::Span> spans;
+    EXPECT_ALLOCATIONS_AT_MOST(0, [&]() { matcher.Find("From NEW YORK CITY to York and new york", spans); });
+    EXPECT_EQ(spans.size(), 3u);
+  }
+}
+
+// The tokenizers still allocate the containers of their stages for each text, which are the budgets of a text with
+// some room for the other standard libraries, so a change which allocates more for each text fails.
+TEST(allocations, tokenizer_api) {
+  const std::filesystem::path data_dir = std::filesystem::current_path() / "data";
+  const std::vector<std::string> texts{"Hello world", "I love you<|endoftext|>", "caf\xc3\xa9 \xe4\xb8\xad"};
+
+  OrtxTokenizer* gpt2 = nullptr;
+  ASSERT_EQ(OrtxCreateTokenizerFromFiles("GPT2Tokenizer", (data_dir / "gpt2.vocab").string().c_str(),
+                                         (data_dir / "gpt2.merges.txt").string().c_str(), &gpt2),
+            0)
+      << OrtxGetLastErrorMessage();
+  EXPECT_LE(EncodeAllocations(gpt2, texts), 8 * texts.size());
+  OrtxReleaseTokenizer(gpt2);
+
+  OrtxTokenizer* bert = nullptr;
+  ASSERT_EQ(OrtxCreateTokenizerFromFiles("BertTokenizer", (data_dir / "bert_basic_cased_vocab.txt").string().c_str(),
+                                         nullptr, &bert),
+            0)
+      << OrtxGetLastErrorMessage();
+  EXPECT_LE(EncodeAllocations(bert, texts), 10 * texts.size());
+  OrtxReleaseTokenizer(bert);
+}
@@ -0,0 +1,213 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "azure/request_batcher.hpp"
+#ifdef ENABLE_AZURE
+#include "azure/response_cache.hpp"
+#include "azure/retry_policy.hpp"
+#endif
+
+using namespace ort_extensions;
+
+namespace {
+struct TestRequest {
+  int value{};
+  int result{};
+};
+}  // namespace
+
+TEST(AzureOps, RequestBatcherErrorOfOneRequest) {
+  auto batcher = RequestBatcher<TestRequest>::Get("test_batcher_errors");
+  std::vector<size_t> batch_sizes;
+  // the request of a negative value fails on its own, and the others of its batch get their results
+  auto execute = [&batch_sizes](const std::vector<TestRequest*>& requests, std::vector<std::exception_ptr>& errors) {
+    batch_sizes.push_back(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+      if (requests[i]->value < 0) {
+        errors[i] = std::make_exception_ptr(std::invalid_argument("negative value"));
+      } else {
+        requests[i]->result = requests[i]->value * 2;
+      }
+    }
+  };
+
+  std::vector<TestRequest> requests{{1}, {-1}, {3}};
+  std::vector<int> failed(requests.size());  // not a vector<bool>, whose elements the threads share a word of
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < requests.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      try {
+        batcher->Run(requests[i], requests.size(), std::chrono::seconds(10), execute);
+      } catch (const std::invalid_argument&) {
+        failed[i] = 1;
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // the leader waits for the full batch
+  EXPECT_EQ(batch_sizes, std::vector<size_t>{3});
+  EXPECT_EQ(failed, (std::vector<int>{0, 1, 0}));
+  EXPECT_EQ(requests[0].result, 2);
+  EXPECT_EQ(requests[2].result, 6);
+
+  // an exception of the execution of the batch fails all of its requests
+  TestRequest request{1};
+  EXPECT_THROW(batcher->Run(request, 1, std::chrono::microseconds(0),
+                            [](const std::vector<TestRequest*>&, std::vector<std::exception_ptr>&) {
+                              throw std::runtime_error("failed batch");
+                            }),
+               std::runtime_error);
+}
+
+#ifdef ENABLE_AZURE
+TEST(AzureOps, ResponseCacheLookup) {
+  ResponseCache cache(1024, std::chrono::seconds(0), "");
+  const ResponseCache::Key key = ResponseCache::RequestKey("endpoint\ninputs", "token");
+  ResponseCache::Response response;
+  EXPECT_FALSE(cache.Lookup(key, response));
+
+  cache.Insert(key, {"body"});
+  ASSERT_TRUE(cache.Lookup(key, response));
+  EXPECT_EQ(response, ResponseCache::Response{"body"});
+  EXPECT_FALSE(cache.Lookup(ResponseCache::RequestKey("endpoint\nother inputs", "token"), response));
+
+  // the same request with another auth token isn't answered with the response of the first one
+  const ResponseCache::Key other_token = ResponseCache::RequestKey("endpoint\ninputs", "other token");
+  EXPECT_FALSE(other_token == key);
+  EXPECT_FALSE(cache.Lookup(other_token, response));
+  EXPECT_TRUE(ResponseCache::RequestKey("endpoint\ninputs", "token") == key);
+}
+
+TEST(AzureOps, ResponseCacheEviction) {
+  // the bound fits two responses of 100 bytes with the overhead of their part
+  ResponseCache cache(250, std::chrono::seconds(0), "");
+  auto key = [](const char* request) { return ResponseCache::RequestKey(request, "token"); };
+  const std::string body(100, 'x');
+  ResponseCache::Response response;
+  cache.Insert(key("a"), {body});
+  cache.Insert(key("b"), {body});
+  ASSERT_TRUE(cache.Lookup(key("a"), response));  // b is the least recently used one
+
+  cache.Insert(key("c"), {body});
+  EXPECT_TRUE(cache.Lookup(key("a"), response));
+  EXPECT_FALSE(cache.Lookup(key("b"), response));
+  EXPECT_TRUE(cache.Lookup(key("c"), response));
+
+  // a response over the bound isn't cached
+  cache.Insert(key("d"), {std::string(300, 'x')});
+  EXPECT_FALSE(cache.Lookup(key("d"), response));
+  EXPECT_TRUE(cache.Lookup(key("a"), response));
+}
+
+TEST(AzureOps, RetryPolicyRetryableResults) {
+  RetryPolicy policy(RetryPolicy::Options{});
+  // the transient curl errors are retried whatever the status
+  for (CURLcode result : {CURLE_COULDNT_RESOLVE_HOST, CURLE_COULDNT_CONNECT, CURLE_OPERATION_TIMEDOUT,
+                          CURLE_SSL_CONNECT_ERROR, CURLE_GOT_NOTHING, CURLE_SEND_ERROR, CURLE_RECV_ERROR,
+                          CURLE_PARTIAL_FILE, CURLE_HTTP2, CURLE_HTTP2_STREAM}) {
+    EXPECT_TRUE(policy.IsRetryable(result, 0)) << "CURLcode=" << result;
+  }
+
+  for (CURLcode result : {CURLE_URL_MALFORMAT, CURLE_UNSUPPORTED_PROTOCOL, CURLE_PEER_FAILED_VERIFICATION,
+                          CURLE_ABORTED_BY_CALLBACK, CURLE_WRITE_ERROR}) {
+    EXPECT_FALSE(policy.IsRetryable(result, 0)) << "CURLcode=" << result;
+  }
+
+  // the responses are retried by their status
+  for (long status : {429, 502, 503, 504}) {
+    EXPECT_TRUE(policy.IsRetryable(CURLE_OK, status)) << "status=" << status;
+  }
+
+  for (long status : {200, 400, 401, 404, 500}) {
+    EXPECT_FALSE(policy.IsRetryable(CURLE_OK, status)) << "status=" << status;
+  }
+
+  RetryPolicy::Options options;
+  options.status_codes = {500};
+  RetryPolicy custom(options);
+  EXPECT_TRUE(custom.IsRetryable(CURLE_OK, 500));
+  EXPECT_FALSE(custom.IsRetryable(CURLE_OK, 429));
+}
+
+TEST(AzureOps, RetryPolicyBackoff) {
+  RetryPolicy::Options options;
+  options.backoff_max_ms = 1000;
+  RetryPolicy policy(options);
+  // 200 ms doubled at each retry, and capped
+  EXPECT_EQ(policy.MaxBackoff(1).count(), 200);
+  EXPECT_EQ(policy.MaxBackoff(2).count(), 400);
+  EXPECT_EQ(policy.MaxBackoff(3).count(), 800);
+  EXPECT_EQ(policy.MaxBackoff(4).count(), 1000);
+  EXPECT_EQ(policy.MaxBackoff(100).count(), 1000);
+
+  // the jitter is within the bound of the attempt
+  for (int64_t attempt = 1; attempt <= 5; ++attempt) {
+    for (int i = 0; i < 100; ++i) {
+      auto backoff = policy.Backoff(attempt);
+      EXPECT_GE(backoff.count(), 0);
+      EXPECT_LE(backoff.count(), policy.MaxBackoff(attempt).count());
+    }
+  }
+
+  options.backoff_ms = 0;
+  RetryPolicy no_backoff(options);
+  EXPECT_EQ(no_backoff.Backoff(3).count(), 0);
+}
+
+TEST(AzureOps, RetryPolicyHedgeDelay) {
+  // the default of 0 disables hedging, and the latencies aren't kept
+  RetryPolicy disabled(RetryPolicy::Options{});
+  disabled.RecordLatency(std::chrono::milliseconds(100));
+  EXPECT_EQ(disabled.HedgeDelay().count(), 0);
+  EXPECT_EQ(disabled.LatencySamples(), 0u);
+
+  RetryPolicy::Options options;
+  options.hedge_delay_ms = 250;
+  RetryPolicy fixed(options);
+  fixed.RecordLatency(std::chrono::milliseconds(100));
+  EXPECT_EQ(fixed.HedgeDelay().count(), 250);
+  EXPECT_EQ(fixed.LatencySamples(), 0u);
+
+  // the adaptive delay isn't used until enough latencies are known
+  options.hedge_delay_ms = -1;
+  RetryPolicy adaptive(options);
+  for (int64_t i = 1; i < static_cast<int64_t>(RetryPolicy::kMinLatencySamples); ++i) {
+    adaptive.RecordLatency(std::chrono::milliseconds(i));
+  }
+
+  EXPECT_EQ(adaptive.HedgeDelay().count(), 0);
+
+  // the 95th percentile of latencies 1 to 20 ms
+  for (int64_t i = RetryPolicy::kMinLatencySamples; i <= 20; ++i) {
+    adaptive.RecordLatency(std::chrono::milliseconds(i));
+  }
+
+  EXPECT_EQ(adaptive.HedgeDelay().count(), 20);
+
+  for (int64_t i = 21; i <= 100; ++i) {
+    adaptive.RecordLatency(std::chrono::milliseconds(i));
+  }
+
+  // only the recent latencies are kept, 37 to 100 ms, and the index of their 95th percentile is 60
+  EXPECT_EQ(adaptive.LatencySamples(), RetryPolicy::kLatencySamples);
+  EXPECT_EQ(adaptive.HedgeDelay().count(), 97);
+
+  // the delay is at least 1 ms, so fast responses still hedge
+  RetryPolicy fast(options);
+  for (size_t i = 0; i < RetryPolicy::kMinLatencySamples; ++i) {
+    fast.RecordLatency(std::chrono::milliseconds(0));
+  }
+
+  EXPECT_EQ(fast.HedgeDelay().count(), 1);
+}
+#endif  // ENABLE_AZURE
@@ -51,3 +51,33 @@ TEST(base64, decode_false_wrong) {
   bool r = base64_decode(encoded, raw);
   EXPECT_EQ(r, false);
 }
+
+TEST(base64, decode_long) {
+  // the long inputs are decoded by the vectorized loops, and their tails one quantum at a time
+  std::vector<uint8_t> raw(4099);
+  for (size_t i = 0; i < raw.size(); ++i) {
+    raw[i] = static_cast<uint8_t>(i * 7 + i / 256);
+  }
+  for (size_t size : {0, 1, 2, 3, 47, 48, 49, 95, 96, 1000, 4097, 4098, 4099}) {
+    std::vector<uint8_t> input(raw.begin(), raw.begin() + size);
+    std::string encoded;
+    base64_encode(input, encoded);
+    std::vector<uint8_t> decoded;
+    EXPECT_TRUE(base64_decode(encoded, decoded));
+    EXPECT_EQ(input, decoded);
+
+    // an invalid character is found in any block
+    for (size_t pos : {size_t(0), encoded.size() / 2, encoded.size() > 4 ? encoded.size() - 5 : 0}) {
+      if (pos < encoded.size()) {
+        std::string invalid = encoded;
+        invalid[pos] = '\x80';
+        EXPECT_FALSE(base64_decode(invalid, decoded));
+        // the padding is only valid at the end of the last quantum
+        invalid[pos] = '=';
+        if (pos + 4 < encoded.size()) {
+          EXPECT_FALSE(base64_decode(invalid, decoded));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,517 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <random>
+
+#include "gtest/gtest.h"
+#include "bpe_tokenizer.hpp"
+#include "tiktoken_tokenizer.hpp"
+#include "pre_tokenizer_dfa.hpp"
+#include "token_pair.hpp"
+
+namespace {
+
+// the byte-level vocab needs the unicode form of all 256 bytes to be loaded.
+std::string ByteLevelVocab(const std::vector<std::string>& extra_tokens) {
+  json vocab;
+  int id = 0;
+  for (char32_t ch = 0; ch < 256 + 68; ++ch) {
+    if ((ch < 33) || (ch > 126 && ch < 161) || (ch == 173)) {
+      continue;  // these bytes are mapped into [256, 256 + 68)
+    }
+    vocab[ustring::EncodeUTF8Char(ch)] = id++;
+  }
+  vocab["<|endoftext|>"] = id++;
+  for (const auto& token : extra_tokens) {
+    vocab[token] = id++;
+  }
+  return vocab.dump();
+}
+
+std::vector<int> RunBpe(const VocabData& vocab_data, const std::string& word) {
+  std::vector<std::pair<int, int>> byte_list;
+  for (char ch : word) {
+    byte_list.emplace_back(vocab_data.ByteEncoder()[static_cast<unsigned char>(ch)], 1);
+  }
+  vocab_data.bpe(byte_list);
+
+  std::vector<int> ids;
+  for (auto& p : byte_list) {
+    ids.push_back(p.first);
+  }
+  return ids;
+}
+
+}  // namespace
+
+TEST(bpe_tokenizer, merge_order) {
+  std::istringstream vocab_stream(ByteLevelVocab({"aa", "aaaa", "ab", "aab"}));
+  std::istringstream merges_stream("#version: 0.2\na a\naa aa\na b\naa b\n");
+  VocabData vocab_data;
+  vocab_data.Load(vocab_stream, merges_stream, "<|endoftext|>", "<|endoftext|>");
+
+  const int a = vocab_data.TokenToID("a");
+  const int b = vocab_data.TokenToID("b");
+  const int aa = vocab_data.TokenToID("aa");
+  const int aaaa = vocab_data.TokenToID("aaaa");
+  const int aab = vocab_data.TokenToID("aab");
+
+  EXPECT_EQ(RunBpe(vocab_data, "a"), std::vector<int>({a}));
+  // the overlapping occurrences are merged from left to right.
+  EXPECT_EQ(RunBpe(vocab_data, "aaa"), std::vector<int>({aa, a}));
+  EXPECT_EQ(RunBpe(vocab_data, "aaaaa"), std::vector<int>({aaaa, a}));
+  // "a b" has a better rank than "aa b", but "a a" is merged first.
+  EXPECT_EQ(RunBpe(vocab_data, "aab"), std::vector<int>({aab}));
+  EXPECT_EQ(RunBpe(vocab_data, "ba"), std::vector<int>({b, a}));
+
+  std::string long_word(10000, 'a');
+  auto ids = RunBpe(vocab_data, long_word);
+  EXPECT_EQ(ids.size(), 10000u / 4);
+  EXPECT_TRUE(std::all_of(ids.begin(), ids.end(), [aaaa](int id) { return id == aaaa; }));
+}
+
+TEST(bpe_tokenizer, limits) {
+  std::istringstream vocab_stream(ByteLevelVocab({"aa", "aaaa", "ab", "aab"}));
+  std::istringstream merges_stream("#version: 0.2\na a\naa aa\na b\naa b\n");
+  VocabData vocab_data;
+  vocab_data.Load(vocab_stream, merges_stream, "<|endoftext|>", "<|endoftext|>");
+  const int aa = vocab_data.TokenToID("aa");
+  const int aaaa = vocab_data.TokenToID("aaaa");
+
+  // a long word is merged as its chunks
+  std::vector<std::pair<int, int>> symbols;
+  MergeBpeWord(vocab_data, std::string(20, 'a'), 6, symbols);
+  std::vector<int> ids;
+  for (auto& p : symbols) {
+    ids.push_back(p.first);
+  }
+  EXPECT_EQ(ids, std::vector<int>({aaaa, aa, aaaa, aa, aaaa, aa, aa}));
+  MergeBpeWord(vocab_data, "aab", 0, symbols);
+  ASSERT_EQ(symbols.size(), 1u);
+  EXPECT_EQ(symbols[0], std::make_pair(vocab_data.TokenToID("aab"), 3));
+  // the chunks are cut between the characters, unless one is longer than a chunk
+  for (size_t max_word_bytes : {1, 2, 4, 5}) {
+    MergeBpeWord(vocab_data, "\xe4\xb8\xad\xe4\xb8\xad" "a", max_word_bytes, symbols);
+    size_t bytes = 0;
+    for (auto& p : symbols) {
+      bytes += p.second;
+    }
+    EXPECT_EQ(bytes, 7u);
+  }
+
+  BpeCache cache(100);
+  const std::string text = " aab " + std::string(1000, 'a');
+  BpeLimits limits;
+  limits.max_word_bytes = 8;
+  std::vector<int64_t> expected;
+  for (const std::string word : {std::string(" aab"), " " + std::string(1000, 'a')}) {
+    MergeBpeWord(vocab_data, word, 8, symbols);
+    for (auto& p : symbols) {
+      expected.push_back(p.first);
+    }
+  }
+  EXPECT_EQ(Gpt2BpeTokenize(vocab_data, cache, std::string_view(text), INT64_MAX, nullptr, nullptr, limits),
+            expected);
+  EXPECT_EQ(cache.Size(), 1u);  // the long word isn't a key of the cache
+
+  limits.max_merged_bytes = 500;
+  EXPECT_THROW(Gpt2BpeTokenize(vocab_data, cache, std::string_view(text), INT64_MAX, nullptr, nullptr, limits),
+               std::exception);
+  // the words of the cache aren't merged again
+  limits.max_merged_bytes = 1;
+  const auto ids_of_cache =
+      Gpt2BpeTokenize(vocab_data, cache, std::string_view(" aab aab"), INT64_MAX, nullptr, nullptr, limits);
+  EXPECT_EQ(ids_of_cache, std::vector<int64_t>({expected[0], expected[1], expected[0], expected[1]}));
+}
+
+TEST(bpe_tokenizer, binary_model) {
+  const char* kSpecialTokens = "<|endoftext|>\n<s>";
+  std::istringstream vocab_stream(ByteLevelVocab({"aa", "aaaa", "ab", "aab"}));
+  // the duplicated merge keeps its last rank, which is saved too.
+  std::istringstream merges_stream("#version: 0.2\r\na a\r\naa aa\na b\n\naa b\na b\n");
+  VocabData vocab_data;
+  vocab_data.Load(vocab_stream, merges_stream, "<unk>", kSpecialTokens);
+
+  std::string model = vocab_data.Save("<unk>", kSpecialTokens);
+  ASSERT_TRUE(VocabData::IsBinaryModel(model));
+  EXPECT_FALSE(VocabData::IsBinaryModel(ByteLevelVocab({})));
+
+  VocabData binary_data;
+  binary_data.LoadBinary(model, "<unk>", kSpecialTokens);
+  EXPECT_EQ(binary_data.VocabSize(), vocab_data.VocabSize());
+  EXPECT_EQ(binary_data.TokenToID("<unk>"), vocab_data.TokenToID("<unk>"));
+  EXPECT_EQ(binary_data.TokenToID("<s>"), vocab_data.TokenToID("<s>"));
+  EXPECT_EQ(binary_data.GetEncoding("missing"), vocab_data.GetEncoding("missing"));
+  EXPECT_EQ(binary_data.IdToToken(vocab_data.TokenToID("aab")), "aab");
+  EXPECT_EQ(std::vector<int>(binary_data.ByteEncoder(), binary_data.ByteEncoder() + 256),
+            std::vector<int>(vocab_data.ByteEncoder(), vocab_data.ByteEncoder() + 256));
+  for (const std::string word : {"a", "aaa", "aaaaa", "aab", "ba", "abab", "aabaab"}) {
+    EXPECT_EQ(RunBpe(binary_data, word), RunBpe(vocab_data, word)) << word;
+  }
+  EXPECT_EQ(binary_data.SplitBySpecialTokens(std::string_view("x<s>y<|endoftext|>")),
+            vocab_data.SplitBySpecialTokens(std::string_view("x<s>y<|endoftext|>")));
+  EXPECT_EQ(binary_data.Save("<unk>", kSpecialTokens), model);
+
+  // the special tokens are in the vocabulary of the model, so it can't be loaded with the others.
+  VocabData mismatched;
+  EXPECT_THROW(mismatched.LoadBinary(model, "<unk>", "<|endoftext|>"), std::exception);
+  VocabData truncated;
+  EXPECT_THROW(truncated.LoadBinary(model.substr(0, model.size() - 1), "<unk>", kSpecialTokens), std::exception);
+}
+
+TEST(bpe_tokenizer, whole_words) {
+  std::istringstream vocab_stream(ByteLevelVocab({"aa", "aaaa", "ab", "aab", "ba", "aaab", "\xc4\xa0" "a"}));
+  std::istringstream merges_stream("#version: 0.2\na a\naa aa\na b\naa b\n\xc4\xa0 a\n");
+  VocabData vocab_data;
+  vocab_data.Load(vocab_stream, merges_stream, "<|endoftext|>", "<|endoftext|>");
+
+  // the words are of the bytes, so the byte of the space is the one of U+0120.
+  for (const std::string word : {"a", "b", "aa", "aaaa", "ab", "aab", " a"}) {
+    const int id = vocab_data.FindWholeWord(word);
+    EXPECT_NE(id, -1) << word;
+    EXPECT_EQ(RunBpe(vocab_data, word), std::vector<int>({id})) << word;
+  }
+  // "ba" has no merge, "aaab" is merged into "aa ab", and the others aren't tokens.
+  for (const std::string word : {"ba", "aaab", "aaa", "\xc4\xa0" "a", "<|endoftext|>", ""}) {
+    EXPECT_EQ(vocab_data.FindWholeWord(word), -1) << word;
+  }
+
+  VocabData binary_data;
+  binary_data.LoadBinary(vocab_data.Save("<|endoftext|>", "<|endoftext|>"), "<|endoftext|>", "<|endoftext|>");
+  EXPECT_EQ(binary_data.FindWholeWord("aab"), vocab_data.TokenToID("aab"));
+  EXPECT_EQ(binary_data.FindWholeWord("aaab"), -1);
+}
+
+TEST(bpe_tokenizer, byte_symbols) {
+  std::istringstream vocab_stream(ByteLevelVocab({}));
+  std::istringstream merges_stream("#version: 0.2\n");
+  VocabData vocab_data;
+  vocab_data.Load(vocab_stream, merges_stream, "<|endoftext|>", "<|endoftext|>");
+
+  // the table is the one of the vocab, and its inverse gives the bytes back
+  for (int byte = 0; byte < 256; ++byte) {
+    EXPECT_EQ(vocab_data.TokenToID(ustring::EncodeUTF8Char(kBytesToUnicode[byte])), vocab_data.ByteEncoder()[byte]);
+    EXPECT_EQ(kUnicodeToBytes[kBytesToUnicode[byte]], byte);
+    std::string bytes;
+    AppendBpeTokenBytes(ustring::EncodeUTF8Char(kBytesToUnicode[byte]), bytes);
+    EXPECT_EQ(bytes, std::string(1, static_cast<char>(byte)));
+  }
+
+  std::vector<std::pair<int, int>> symbols{{7, 2}};
+  vocab_data.AppendByteSymbols("a \xff", symbols);
+  EXPECT_EQ(symbols, (std::vector<std::pair<int, int>>{{7, 2},
+                                                       {vocab_data.ByteEncoder()['a'], 1},
+                                                       {vocab_data.ByteEncoder()[' '], 1},
+                                                       {vocab_data.ByteEncoder()[0xff], 1}}));
+}
+
+TEST(bpe_tokenizer, split_by_special_tokens) {
+  SpecialTokenMap special_tokens;
+  special_tokens.Add(ustring("<|endoftext|>"), 0);
+  special_tokens.Add(ustring("<s>"), 1);
+  special_tokens.Add(ustring("s>"), 2);
+  special_tokens.Build();
+
+  auto split = [&special_tokens](const std::string& text) {
+    ustring input(text);
+    std::vector<std::pair<std::string, int>> segments;
+    for (auto& seg : special_tokens.SplitBySpecialTokens(input)) {
+      segments.emplace_back(std::string(ustring(std::u32string(seg.first))), seg.second);
+    }
+    return segments;
+  };
+
+  using Segments = std::vector<std::pair<std::string, int>>;
+  EXPECT_EQ(split("hello world"), Segments({{"hello world", -1}}));
+  EXPECT_EQ(split("<|endoftext|>hello<s> world<|endoftext|>"),
+            Segments({{"<|endoftext|>", 0}, {"hello", -1}, {"<s>", 1}, {" world", -1}, {"<|endoftext|>", 0}}));
+  // the token added earlier wins when two tokens overlap.
+  EXPECT_EQ(split("a<s>s>"), Segments({{"a", -1}, {"<s>", 1}, {"s>", 2}}));
+  EXPECT_EQ(split("<s<s>"), Segments({{"<s", -1}, {"<s>", 1}}));
+}
+
+TEST(bpe_tokenizer, utf8_pre_tokenizer) {
+  const std::vector<std::string> inputs = {
+      "Hello world! It's a test.", "   multiple   spaces\n\nnewlines\t tabs", "we'll 've 'd 're",
+      "中文测试 日本語テスト 🧐 Test", "price: 12\xe2\x82\xac\xc2\xa0" "and\xe3\x80\x80more", "caf\xc3\xa9  ", " "};
+
+  for (const auto& input : inputs) {
+    ASSERT_TRUE(ustring::ValidateUTF8(input));
+    ustring u32_input(input);
+    TokenWithRegularExp u32_regcmp;
+    Utf8TokenWithRegularExp utf8_regcmp;
+    u32_regcmp.Set(u32_input);
+    utf8_regcmp.Set(input);
+
+    while (true) {
+      auto [u32_found, u32_token] = u32_regcmp.GetNextToken();
+      auto [utf8_found, utf8_token] = utf8_regcmp.GetNextToken();
+      ASSERT_EQ(u32_found, utf8_found) << input;
+      if (!u32_found) {
+        break;
+      }
+      EXPECT_EQ(std::string(ustring(u32_token)), std::string(utf8_token)) << input;
+    }
+  }
+
+  // the ill-formed bytes are left to the UTF-32 path
+  EXPECT_FALSE(ustring::ValidateUTF8("\x80"));
+  EXPECT_FALSE(ustring::ValidateUTF8("a\xc3"));
+  EXPECT_FALSE(ustring::ValidateUTF8("\xc0\x80"));
+  EXPECT_FALSE(ustring::ValidateUTF8("\xf4\x90\x80\x80"));
+}
+
+TEST(bpe_tokenizer, truncated_prefixes) {
+  std::istringstream vocab_stream(ByteLevelVocab({"<s>", "\u0120a", "aa", "\u0120aa"}));
+  std::istringstream merges_stream("#version: 0.2\na a\n\u0120 a\n\u0120a a\n");
+  VocabData vocab_data;
+  vocab_data.Load(vocab_stream, merges_stream, "<|endoftext|>", "<|endoftext|>\n<s>");
+  BpeCache cache(100);
+
+  std::string text;
+  for (int i = 0; i < 400; ++i) {
+    text += (i % 7 == 0) ? "  aaa, 12" : (i % 11 == 0) ? "<|endoftext|>a<s>" : " aa\xe4\xb8\xad";
+  }
+  const ustring u32_text(text);
+
+  const auto full = Gpt2BpeTokenizeText(vocab_data, cache, std::string_view(text), INT64_MAX);
+  ASSERT_GT(full.size(), 1000u);
+  for (int64_t max_length : {0, 1, 5, 17, 64, 200, 333, 1000}) {
+    // the ids of the prefixes are the first max_length ones of the whole text
+    const std::vector<int64_t> expected(full.begin(), full.begin() + max_length);
+    EXPECT_EQ(Gpt2BpeTokenize(vocab_data, cache, std::string_view(text), max_length), expected) << max_length;
+    EXPECT_EQ(Gpt2BpeTokenize(vocab_data, cache, std::u32string_view(u32_text), max_length), expected) << max_length;
+  }
+
+  // a cut is before a space which starts a word, and not right after a special token
+  const std::string_view view(text);
+  const size_t cut = vocab_data.FindPrefixCut(view, 100);
+  ASSERT_LT(cut, view.size());
+  EXPECT_EQ(view[cut], ' ');
+  EXPECT_EQ(vocab_data.FindPrefixCut(std::string_view("a b  "), 1), 1u);
+  EXPECT_EQ(vocab_data.FindPrefixCut(std::string_view("a  , \n"), 1), 6u);
+  EXPECT_EQ(vocab_data.FindPrefixCut(std::string_view("<s> b c"), 1), 7u);
+  EXPECT_EQ(vocab_data.FindPrefixCut(std::string_view("<s>" + std::string(30, 'a') + " b"), 1), 33u);
+}
+
+TEST(bpe_tokenizer, prefix_cache) {
+  std::istringstream vocab_stream(ByteLevelVocab({"<s>", "\u0120a", "aa", "\u0120aa"}));
+  std::istringstream merges_stream("#version: 0.2\na a\n\u0120 a\n\u0120a a\n");
+  VocabData vocab_data;
+  vocab_data.Load(vocab_stream, merges_stream, "<|endoftext|>", "<|endoftext|>\n<s>");
+  BpeCache cache(100);
+  BpePrefixCache prefix_cache(64);
+
+  std::string system_prompt;
+  for (int i = 0; i < 200; ++i) {
+    system_prompt += (i % 7 == 0) ? "  aaa, 12" : (i % 11 == 0) ? "<|endoftext|>a<s>" : " aa\xe4\xb8\xad";
+  }
+  const std::vector<std::string> questions{" a aa?", "<s> aaa aaaa", " aa", "\n\n aa" + system_prompt, ""};
+  for (const std::string& question : questions) {
+    const std::string text = system_prompt + question;
+    const auto expected = Gpt2BpeTokenizeText(vocab_data, cache, std::string_view(text), INT64_MAX);
+    EXPECT_EQ(Gpt2BpeTokenize(vocab_data, cache, std::string_view(text), INT64_MAX, nullptr, &prefix_cache),
+              expected);
+    const ustring u32_text(text);
+    BpePrefixCache u32_prefix_cache(64);
+    EXPECT_EQ(Gpt2BpeTokenize(vocab_data, cache, std::u32string_view(u32_text), INT64_MAX, nullptr,
+                              &u32_prefix_cache),
+              expected);
+    for (int64_t max_length : {1, 100, 500}) {
+      const std::vector<int64_t> truncated(expected.begin(), expected.begin() + max_length);
+      EXPECT_EQ(Gpt2BpeTokenize(vocab_data, cache, std::string_view(text), max_length, nullptr, &prefix_cache),
+                truncated);
+    }
+  }
+  // the segments of the system prompt are tokenized by the first text, and looked up by the others
+  EXPECT_GT(prefix_cache.Hits(), 4 * prefix_cache.Size() / 2);
+  EXPECT_LE(prefix_cache.Size(), 64u);
+
+  // a short text, or a disabled cache, tokenizes the whole text
+  BpePrefixCache disabled;
+  EXPECT_EQ(Gpt2BpeTokenize(vocab_data, cache, std::string_view(system_prompt), INT64_MAX, nullptr, &disabled),
+            Gpt2BpeTokenizeText(vocab_data, cache, std::string_view(system_prompt), INT64_MAX));
+  EXPECT_EQ(disabled.Size(), 0u);
+}
+
+static std::vector<std::string> Cl100kPieces(std::string_view text) {
+  std::vector<std::string> pieces;
+  for (size_t pos = 0; pos < text.size();) {
+    size_t end = Cl100kPreTokenizer::NextPiece(text, pos);
+    pieces.emplace_back(text.substr(pos, end - pos));
+    pos = end;
+  }
+  return pieces;
+}
+
+TEST(bpe_tokenizer, cl100k_pre_tokenizer) {
+  using Pieces = std::vector<std::string>;
+  EXPECT_EQ(Cl100kPieces("Hello world"), (Pieces{"Hello", " world"}));
+  EXPECT_EQ(Cl100kPieces("I'm 12345 OK'LL!!\n\nx"), (Pieces{"I", "'m", " ", "123", "45", " OK", "'LL", "!!\n\n", "x"}));
+  EXPECT_EQ(Cl100kPieces("a  \n  b"), (Pieces{"a", "  \n", " ", " b"}));
+  EXPECT_EQ(Cl100kPieces("x \n "), (Pieces{"x", " \n "}));
+  EXPECT_EQ(Cl100kPieces("\tHi,1.5 +=\r\n"), (Pieces{"\tHi", ",", "1", ".", "5", " +=\r\n"}));
+  EXPECT_EQ(Cl100kPieces("\xe4\xbd\xa0\xe5\xa5\xbd \xe4\xb8\x96\xe7\x95\x8c!"),
+            (Pieces{"\xe4\xbd\xa0\xe5\xa5\xbd", " \xe4\xb8\x96\xe7\x95\x8c", "!"}));
+  EXPECT_EQ(Cl100kPieces("  x"), (Pieces{" ", " x"}));
+  EXPECT_EQ(Cl100kPieces("'"), (Pieces{"'"}));
+}
+
+TEST(bpe_tokenizer, tiktoken_ranks) {
+  // the ranks of all the bytes, then the merged byte strings
+  std::string ranks;
+  std::vector<uint8_t> bytes;
+  std::string encoded;
+  auto add = [&](std::string_view token, int rank) {
+    bytes.assign(token.begin(), token.end());
+    base64_encode(bytes, encoded);
+    ranks += encoded + " " + std::to_string(rank) + "\n";
+  };
+  for (int byte = 0; byte < 256; ++byte) {
+    add(std::string(1, static_cast<char>(byte)), byte);
+  }
+  add("ab", 256);
+  add("bc", 257);
+  add("cd", 258);
+  add("aa", 259);
+  add(" hello", 260);
+
+  TiktokenEncoder encoder;
+  encoder.Load(ranks, R"({"<|endoftext|>": 1000})");
+  EXPECT_EQ(encoder.Rank("bc"), 257);
+
+  // the lowest rank is merged first, and the leftmost one of the same pair
+  EXPECT_EQ(encoder.Encode("abc"), (std::vector<int64_t>{256, 'c'}));
+  EXPECT_EQ(encoder.Encode("bcd"), (std::vector<int64_t>{257, 'd'}));
+  EXPECT_EQ(encoder.Encode("aaa"), (std::vector<int64_t>{259, 'a'}));
+  EXPECT_EQ(encoder.Encode("abcd"), (std::vector<int64_t>{256, 258}));
+  EXPECT_EQ(encoder.Encode(" hello<|endoftext|>aa"), (std::vector<int64_t>{260, 1000, 259}));
+  EXPECT_EQ(encoder.Encode(" hello<|endoftext|>aa", 2), (std::vector<int64_t>{260, 1000}));
+  EXPECT_EQ(encoder.Encode("\xe4\xb8\xad"), (std::vector<int64_t>{0xe4, 0xb8, 0xad}));
+
+  // a compiled pattern gives the pieces of the cl100k one
+  PreTokenizerDfa cl100k(R"('(?i:[sdmt]|ll|ve|re)|[^\r\n\p{L}\p{N}]?+\p{L}++|\p{N}{1,3}+| ?[^\s\p{L}\p{N}]++[\r\n]*+|\s++$|\s*[\r\n]|\s+(?!\S)|\s)");
+  EXPECT_EQ(encoder.Encode(" hello abcd<|endoftext|>aaa", INT64_MAX, &cl100k),
+            (std::vector<int64_t>{260, ' ', 256, 258, 1000, 259, 'a'}));
+
+  TiktokenEncoder missing;
+  EXPECT_THROW(missing.Load("YWI= 0\n", ""), std::exception);
+}
+
+static std::vector<std::string> DfaPieces(const PreTokenizerDfa& dfa, std::string_view text) {
+  Utf8DfaPreTokenizer pre_tokenizer(dfa);
+  pre_tokenizer.Set(text);
+  std::vector<std::string> pieces;
+  for (auto [b, tok] = pre_tokenizer.GetNextToken(); b; std::tie(b, tok) = pre_tokenizer.GetNextToken()) {
+    pieces.emplace_back(tok);
+  }
+  return pieces;
+}
+
+TEST(bpe_tokenizer, pre_tokenizer_dfa) {
+  using Pieces = std::vector<std::string>;
+  // the leftmost-first match of the alternatives and the quantifiers, and the text between the matches
+  EXPECT_EQ(DfaPieces(PreTokenizerDfa("a+?"), "aab"), (Pieces{"a", "a", "b"}));
+  EXPECT_EQ(DfaPieces(PreTokenizerDfa("a(?=b)"), "aab ab"), (Pieces{"a", "a", "b ", "a", "b"}));
+  EXPECT_EQ(DfaPieces(PreTokenizerDfa("^a|b$"), "aab"), (Pieces{"a", "a", "b"}));
+  EXPECT_EQ(DfaPieces(PreTokenizerDfa("[0-9][0-9][0-9]"), "x12345y"), (Pieces{"x", "123", "45y"}));
+  EXPECT_EQ(DfaPieces(PreTokenizerDfa("(?i)ab|c"), "ABxAbC"), (Pieces{"AB", "x", "Ab", "C"}));
+  EXPECT_EQ(DfaPieces(PreTokenizerDfa("a{2,3}"), "aaaaaaa"), (Pieces{"aaa", "aaa", "a"}));
+  EXPECT_EQ(DfaPieces(PreTokenizerDfa("[\\u4e00-\\u9fa5]+"), "ab中文cd"), (Pieces{"ab", "中文", "cd"}));
+
+  for (const char* pattern : {"\\bx", "(a", "[a", "a**", "\\p{Han}", "(?<=a)b", "a(?!bc)", ""}) {
+    EXPECT_THROW(PreTokenizerDfa{pattern}, std::exception) << pattern;
+  }
+
+  // the patterns of cl100k and GPT-2 give the pieces of their hand-written pre-tokenizers, GPT-2 on the texts
+  // without the spaces out of the Z category, which it doesn't take for \s
+  const PreTokenizerDfa cl100k(R"('(?i:[sdmt]|ll|ve|re)|[^\r\n\p{L}\p{N}]?+\p{L}++|\p{N}{1,3}+| ?[^\s\p{L}\p{N}]++[\r\n]*+|\s++$|\s*[\r\n]|\s+(?!\S)|\s)");
+  const PreTokenizerDfa gpt2(R"('s|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+)");
+  const std::vector<std::string> alphabet{"a", "B", "'", "s", "S", "t", "l", "e", "v", "r", "d", "m", " ",
+                                          "  ", "\t", "\n", "\r", "1", "9", "!", ".", "中", "é",
+                                          "\u3000", "\u00a0", "\u017f", "\u0663", "\u200b", "_"};
+  std::mt19937 rng(7);
+  for (int i = 0; i < 3000; ++i) {
+    std::string text;
+    bool z_spaces_only = true;
+    for (size_t n = rng() % 12; n > 0; --n) {
+      const std::string& ch = alphabet[rng() % alphabet.size()];
+      z_spaces_only = z_spaces_only && ch != "\t" && ch != "\n" && ch != "\r";
+      text += ch;
+    }
+
+    Pieces expected;
+    for (size_t pos = 0; pos < text.size();) {
+      size_t end = Cl100kPreTokenizer::NextPiece(text, pos);
+      expected.emplace_back(text.substr(pos, end - pos));
+      pos = end;
+    }
+    ASSERT_EQ(DfaPieces(cl100k, text), expected) << text;
+
+    if (z_spaces_only) {
+      Utf8TokenWithRegularExp regcmp;
+      regcmp.Set(text);
+      expected.clear();
+      for (auto [b, tok] = regcmp.GetNextToken(); b; std::tie(b, tok) = regcmp.GetNextToken()) {
+        expected.emplace_back(tok);
+      }
+      ASSERT_EQ(DfaPieces(gpt2, text), expected) << text;
+    }
+  }
+}
+
+TEST(bpe_tokenizer, pair_template) {
+  PairTemplate roberta;
+  roberta.prefix = {0};
+  roberta.middle = {2, 2};
+  roberta.suffix = {2};
+
+  size_t second_begin = 0;
+  EXPECT_EQ(roberta.Apply({10, 11}, {20}, -1, second_begin), (std::vector<int64_t>{0, 10, 11, 2, 2, 20, 2}));
+  EXPECT_EQ(second_begin, 5u);
+  EXPECT_EQ(roberta.Apply({}, {}, 3, second_begin), (std::vector<int64_t>{0, 2, 2, 2}));
+  EXPECT_EQ(roberta.MaxSequenceLength(3), 0);
+
+  PairTemplate gpt2;
+  gpt2.second_type_id = 1;
+  std::vector<int64_t> type_ids(6, -1);
+  gpt2.WriteTypeIds(2, 5, 6, type_ids.data());
+  EXPECT_EQ(type_ids, (std::vector<int64_t>{0, 0, 1, 1, 1, 0}));
+  std::vector<int32_t> type_ids32(6, -1);
+  gpt2.WriteTypeIds(2, 5, 6, type_ids32.data());
+  EXPECT_EQ(type_ids32, (std::vector<int32_t>{0, 0, 1, 1, 1, 0}));
+
+  // the longest_first truncation of HF, which drops the last id of the longer one, or the second one on a tie
+  for (size_t length1 = 0; length1 < 9; ++length1) {
+    for (size_t length2 = 0; length2 < 9; ++length2) {
+      for (int64_t max_length = 0; max_length < 12; ++max_length) {
+        std::vector<int64_t> ids1(length1, 1);
+        std::vector<int64_t> ids2(length2, 2);
+        size_t n1 = length1;
+        size_t n2 = length2;
+        while (n1 + n2 > static_cast<size_t>(max_length)) {
+          (n1 > n2 ? n1 : n2) -= 1;
+        }
+        std::vector<int64_t> expected(n1, 1);
+        expected.insert(expected.end(), n2, 2);
+        EXPECT_EQ(gpt2.Apply(ids1, ids2, max_length, second_begin), expected);
+        EXPECT_EQ(second_begin, n1);
+      }
+    }
+  }
+}
+
+TEST(bpe_tokenizer, clip_whitespace_clean) {
+  // the same as the replacement of the newlines, std::unique of BothSpaces, the lowercasing and IsEmptyUString
+  auto reference = [](ustring str) {
+    std::replace(str.begin(), str.end(), U'\n', U' ');
+    str.erase(std::unique(str.begin(), str.end(), BothSpaces), str.end());
+    std::transform(str.begin(), str.end(), str.begin(), [](char32_t c) { return ToLower(c); });
+    return std::make_pair(std::string(str), !IsEmptyUString(std::u32string_view(str)));
+  };
+  for (const char* text : {"", " ", "  ", "\n", "\t", "\t\t \n", "A  Photo\n\nOf a  CAT ", "\xC3\x89T\xC3\x89 \t\tx"}) {
+    ustring str(text);
+    const bool not_empty = WhiteSpaceClean(str, true);
+    EXPECT_EQ(std::make_pair(std::string(str), not_empty), reference(ustring(text))) << text;
+  }
+}
@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifdef ENABLE_VISION
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "vision/detection_postprocess.hpp"
+
+using namespace ort_extensions;
+
+namespace {
+
+// the rows of (cx, cy, w, h) and the scores of 2 classes
+const std::vector<float> kPredictions = {
+    50, 50, 20, 20, 0.9f, 0.1f,    // 0: class 0
+    52, 51, 20, 20, 0.8f, 0.1f,    // 1: overlaps 0 in class 0
+    52, 51, 20, 20, 0.1f, 0.7f,    // 2: the same box in class 1
+    150, 50, 20, 20, 0.6f, 0.2f,   // 3: class 0, apart
+    50, 150, 20, 20, 0.1f, 0.05f,  // 4: below the threshold
+};
+
+std::vector<float> Transpose(const std::vector<float>& values, size_t rows, size_t columns) {
+  std::vector<float> transposed(values.size());
+  for (size_t i = 0; i < rows; ++i) {
+    for (size_t j = 0; j < columns; ++j) {
+      transposed[j * rows + i] = values[i * columns + j];
+    }
+  }
+  return transposed;
+}
+
+}  // namespace
+
+TEST(DetectionTest, NonMaximumSuppression) {
+  DetectionOptions options;
+  auto detections = PostProcessDetections(kPredictions.data(), 5, 6, false, options, 1);
+  ASSERT_EQ(detections.size(), 3u);
+  EXPECT_EQ(detections[0], (Detection{40, 40, 60, 60, 0.9f, 0}));
+  EXPECT_EQ(detections[1], (Detection{42, 41, 62, 61, 0.7f, 1}));
+  EXPECT_EQ(detections[2], (Detection{140, 40, 160, 60, 0.6f, 0}));
+
+  // the transposed predictions of [values, anchors], in parallel
+  auto transposed = Transpose(kPredictions, 5, 6);
+  EXPECT_EQ(PostProcessDetections(transposed.data(), 5, 6, true, options, 3), detections);
+
+  options.class_agnostic = true;
+  detections = PostProcessDetections(kPredictions.data(), 5, 6, false, options, 1);
+  ASSERT_EQ(detections.size(), 2u);
+  EXPECT_EQ(detections[1][4], 0.6f);
+
+  options.class_agnostic = false;
+  options.iou_threshold = 0.9f;
+  options.max_detections = 2;
+  detections = PostProcessDetections(kPredictions.data(), 5, 6, false, options, 1);
+  ASSERT_EQ(detections.size(), 2u);
+  EXPECT_EQ(detections[1][4], 0.8f);
+
+  options.box_format = BoundingBoxFormat::XYWH;
+  detections = PostProcessDetections(kPredictions.data(), 5, 6, false, options, 1);
+  EXPECT_EQ(detections[0], (Detection{50, 50, 70, 70, 0.9f, 0}));
+
+  EXPECT_ANY_THROW(PostProcessDetections(kPredictions.data(), 5, 4, false, DetectionOptions{}, 1));  // no classes
+}
+
+TEST(DetectionTest, DecodeGrids) {
+  // YOLOv5 of the sigmoid of the raw heads with the objectness: 2 anchors of the grid of 2 x 2 of stride 8
+  DetectionOptions options;
+  options.has_objectness = true;
+  options.apply_sigmoid = true;
+  options.strides = {8};
+  options.anchors = {10, 13, 16, 30};
+  options.input_height = 16;
+  options.input_width = 16;
+  std::vector<float> predictions(8 * 7, -10.0f);
+  // the anchor 1 of the cell (x 1, y 0), where the sigmoid of 0 is 0.5
+  float* row = predictions.data() + (1 * 4 + 1) * 7;
+  std::fill(row, row + 4, 0.0f);
+  row[4] = 10.0f;
+  row[6] = 10.0f;
+  auto detections = PostProcessDetections(predictions.data(), 8, 7, false, options, 2);
+  ASSERT_EQ(detections.size(), 1u);
+  // the center (0.5 * 2 - 0.5 + 1) * 8, and the size (0.5 * 2)^2 * 16 by 30
+  EXPECT_NEAR(detections[0][0], 12 - 8, 1e-4);
+  EXPECT_NEAR(detections[0][1], 4 - 15, 1e-4);
+  EXPECT_NEAR(detections[0][2], 12 + 8, 1e-4);
+  EXPECT_NEAR(detections[0][3], 4 + 15, 1e-4);
+  EXPECT_EQ(detections[0][5], 1.0f);
+
+  // YOLOX anchor free, the grids of the strides 8 and 16 of the input of 16 x 32
+  options = DetectionOptions{};
+  options.strides = {8, 16};
+  options.input_height = 16;
+  options.input_width = 32;
+  predictions.assign((8 + 2) * 5, 0.0f);
+  row = predictions.data() + (8 + 1) * 5;  // the cell (x 1, y 0) of the stride 16
+  row[0] = 0.5f;
+  row[1] = 0.5f;
+  row[2] = std::log(2.0f);
+  row[4] = 0.9f;
+  detections = PostProcessDetections(predictions.data(), 10, 5, false, options, 1);
+  ASSERT_EQ(detections.size(), 1u);
+  EXPECT_NEAR(detections[0][0], 24 - 16, 1e-4);
+  EXPECT_NEAR(detections[0][1], 8 - 8, 1e-4);
+  EXPECT_NEAR(detections[0][2], 24 + 16, 1e-4);
+  EXPECT_NEAR(detections[0][3], 8 + 8, 1e-4);
+
+  EXPECT_ANY_THROW(PostProcessDetections(predictions.data(), 9, 5, false, options, 1));
+}
+
+TEST(DetectionTest, UndoImageTransform) {
+  // the letterbox of an image of 100 x 50 into 64 x 64, resized to 64 x 32 at the column 16
+  std::vector<Detection> detections{{16, 0, 48, 32, 0.9f, 0}};
+  UndoImageTransform({0.64f, 0.64f, 16, 0}, detections);
+  EXPECT_NEAR(detections[0][0], 0, 1e-4);
+  EXPECT_NEAR(detections[0][1], 0, 1e-4);
+  EXPECT_NEAR(detections[0][2], 50, 1e-4);
+  EXPECT_NEAR(detections[0][3], 50, 1e-4);
+  EXPECT_EQ(detections[0][4], 0.9f);
+
+  EXPECT_ANY_THROW(UndoImageTransform({0, 1, 0, 0}, detections));
+}
+
+#endif  // ENABLE_VISION
@@ -0,0 +1,179 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "audio/fft.h"
+#include "audio/log_mel.hpp"
+#include "audio/voice_activity.hpp"
+#include <vector>
+#include <cmath>
+#include <tuple>
+
+static std::vector<std::complex<double>> ReferenceDft(const std::vector<float>& x, size_t num_bins) {
+  std::vector<std::complex<double>> result(num_bins);
+  for (size_t k = 0; k < num_bins; ++k) {
+    for (size_t i = 0; i < x.size(); ++i) {
+      double angle = -2.0 * M_PI * static_cast<double>(k * i % x.size()) / static_cast<double>(x.size());
+      result[k] += static_cast<double>(x[i]) * std::complex<double>(std::cos(angle), std::sin(angle));
+    }
+  }
+  return result;
+}
+
+TEST(FftTest, RealFftTest) {
+  // the sizes of every radix, and of the primes computed by the DFT of the stage
+  for (size_t n : {1, 2, 3, 4, 5, 6, 8, 12, 30, 49, 128, 400, 401, 512, 1000}) {
+    std::vector<float> x(n);
+    for (size_t i = 0; i < n; ++i) {
+      x[i] = static_cast<float>(std::sin(i * 0.37) + 0.5 * std::cos(i * 1.3));
+    }
+
+    auto plan = RealFft::Get(n);
+    EXPECT_EQ(plan, RealFft::Get(n));
+    std::vector<RealFft::Complex> spectrum(plan->NumBins());
+    std::vector<RealFft::Complex> work(plan->WorkSize());
+    plan->Forward(x.data(), spectrum.data(), work.data());
+
+    auto expected = ReferenceDft(x, plan->NumBins());
+    for (size_t k = 0; k < expected.size(); ++k) {
+      ASSERT_NEAR(expected[k].real(), spectrum[k].real(), 1e-4 * std::sqrt(n)) << n << " at " << k;
+      ASSERT_NEAR(expected[k].imag(), spectrum[k].imag(), 1e-4 * std::sqrt(n)) << n << " at " << k;
+    }
+  }
+}
+
+TEST(FftTest, MelFilterBankTest) {
+  // the filters of onnxruntime_extensions._torch_cvt._mel_filterbank(n_fft=400, n_mels=80, sr=16000)
+  MelFilterBank bank(400, 80, 16000);
+  EXPECT_EQ(bank.NumMels(), 80u);
+  EXPECT_EQ(bank.NumBins(), 201u);
+
+  std::vector<float> power(bank.PaddedBins(), 0.0f);
+  std::vector<float> mel(bank.NumMels());
+  for (auto [bin, filter, weight] : {std::tuple<size_t, size_t, float>{1, 0, 0.024862594f},
+                                     {1, 1, 0.00199082189f}, {2, 1, 0.0228717721f}, {30, 40, 0.0f},
+                                     {190, 79, 0.00223205505f}, {200, 79, 0.0f}}) {
+    std::fill(power.begin(), power.end(), 0.0f);
+    power[bin] = 1.0f;
+    bank.Apply(power.data(), mel.data());
+    EXPECT_NEAR(mel[filter], weight, 1e-7) << bin << " of " << filter;
+  }
+}
+
+TEST(FftTest, StftStreamTest) {
+  const size_t n_fft = 400, hop = 160, n = 5000;
+  std::vector<float> signal(n);
+  for (size_t i = 0; i < n; ++i) {
+    signal[i] = static_cast<float>(std::sin(i * 0.05) * std::sin(i * 0.0007) + 0.1 * std::cos(i * 1.1));
+  }
+  auto window = PeriodicHannWindow(n_fft);
+
+  // the frames of the whole stream, against the DFT of the reflected frames
+  StftStream whole(n_fft, hop, window);
+  std::vector<std::vector<StftStream::Complex>> expected;
+  auto collect = [](std::vector<std::vector<StftStream::Complex>>& frames) {
+    return [&frames](const StftStream::Complex* bins) { frames.emplace_back(bins, bins + n_fft / 2 + 1); };
+  };
+  whole.Push(signal.data(), n, collect(expected));
+  whole.Finish(collect(expected));
+  ASSERT_EQ(expected.size(), n / hop + 1);
+  for (size_t t : {size_t(0), size_t(1), size_t(15), expected.size() - 2, expected.size() - 1}) {
+    std::vector<float> frame(n_fft);
+    for (size_t i = 0; i < n_fft; ++i) {
+      int64_t index = static_cast<int64_t>(t * hop + i) - static_cast<int64_t>(n_fft / 2);
+      index = index < 0 ? -index : index;
+      index = index >= static_cast<int64_t>(n) ? 2 * static_cast<int64_t>(n - 1) - index : index;
+      frame[i] = signal[index] * window[i];
+    }
+    auto reference = ReferenceDft(frame, n_fft / 2 + 1);
+    for (size_t k = 0; k < reference.size(); ++k) {
+      EXPECT_NEAR(expected[t][k].real(), reference[k].real(), 1e-3) << t << " " << k;
+      EXPECT_NEAR(expected[t][k].imag(), reference[k].imag(), 1e-3) << t << " " << k;
+    }
+  }
+
+  // the chunks of any size give the same frames, and the state may be saved and restored between them
+  for (size_t chunk : {1, 7, 160, 333, 2000}) {
+    StftStream stream(n_fft, hop, window);
+    std::vector<std::vector<StftStream::Complex>> frames;
+    for (size_t begin = 0; begin < n; begin += chunk) {
+      std::vector<float> state = stream.SaveState();
+      StftStream restored(n_fft, hop, window);
+      restored.Restore(state.data(), state.size());
+      size_t count = restored.Push(signal.data() + begin, std::min(chunk, n - begin), collect(frames));
+      EXPECT_LE(count, chunk / hop + 1);
+      stream = std::move(restored);
+    }
+    stream.Finish(collect(frames));
+    EXPECT_EQ(frames, expected) << chunk;
+  }
+
+  std::vector<float> state = whole.SaveState();
+  state[0] = 512;
+  EXPECT_THROW(whole.Restore(state.data(), state.size()), std::exception);
+  EXPECT_THROW(whole.Finish(collect(expected)), std::exception);  // shorter than the padding of the frames
+}
+
+TEST(FftTest, VoiceActivityTest) {
+  const size_t rate = 16000;
+  std::vector<float> signal;
+  uint32_t seed = 1;
+  auto noise = [&seed]() {
+    seed = seed * 1664525u + 1013904223u;
+    return static_cast<float>(seed >> 8) / static_cast<float>(1 << 24) - 0.5f;
+  };
+  auto append = [&](size_t samples, float tone, float hiss) {
+    for (size_t i = 0; i < samples; ++i) {
+      signal.push_back(tone * std::sin(2.0f * static_cast<float>(M_PI) * 440.0f * i / rate) + hiss * noise());
+    }
+  };
+  append(rate, 0.0f, 1e-4f);       // silence
+  append(rate / 2, 0.5f, 1e-4f);   // a vowel of 500 ms
+  append(rate / 10, 0.0f, 1e-4f);  // a pause of 100 ms, shorter than min_silence
+  append(rate / 2, 0.5f, 1e-4f);
+  append(rate / 5, 0.0f, 0.02f);   // a fricative, quiet but of a high zero-crossing rate
+  append(rate, 0.0f, 1e-4f);
+  append(rate / 10, 0.5f, 1e-4f);  // a click of 100 ms, shorter than min_speech
+  append(rate / 2, 0.0f, 1e-4f);
+
+  const auto window = PeriodicHannWindow(400);
+  const FrameStatistics stats(signal.data(), signal.size(), 160, window, 1);
+  ASSERT_EQ(stats.energy_db.size(), (signal.size() + 159) / 160);
+  EXPECT_NEAR(stats.energy_db[125], 10.0f * std::log10(0.125f), 0.1f);  // the mean square of a sine is A^2 / 2
+  EXPECT_LT(stats.energy_db[50], -80.0f);
+  EXPECT_NEAR(stats.zero_crossing_rate[125], 2.0f * 440.0f / rate, 0.01f);
+  EXPECT_GT(stats.zero_crossing_rate[375], 0.3f);
+
+  // the statistics are the same in the parallel frames
+  const FrameStatistics parallel(signal.data(), signal.size(), 160, window, 4);
+  EXPECT_EQ(parallel.energy_db, stats.energy_db);
+  EXPECT_EQ(parallel.zero_crossing_rate, stats.zero_crossing_rate);
+
+  const VoiceActivityOptions options;
+  auto segments = DetectVoiceActivity(signal.data(), signal.size(), options, window, 1);
+  ASSERT_EQ(segments.size(), 1u);
+  // the two vowels and the fricative after them, padded by 100 ms
+  EXPECT_NEAR(static_cast<double>(segments[0].first), rate - rate / 10, 400.0);
+  EXPECT_NEAR(static_cast<double>(segments[0].second), rate * 2.3 + rate / 10, 400.0);
+
+  // without the zero-crossing rate the fricative is silence
+  VoiceActivityOptions voiced = options;
+  voiced.zcr_threshold = 1.1f;
+  segments = DetectVoiceActivity(signal.data(), signal.size(), voiced, window, 1);
+  ASSERT_EQ(segments.size(), 1u);
+  EXPECT_NEAR(static_cast<double>(segments[0].second), rate * 2.1 + rate / 10, 400.0);
+
+  // a long pause splits the vowels, and a short min_speech keeps the click
+  VoiceActivityOptions fine = options;
+  fine.min_silence = rate / 20;
+  fine.min_speech = rate / 20;
+  fine.speech_pad = 0;
+  segments = DetectVoiceActivity(signal.data(), signal.size(), fine, window, 1);
+  ASSERT_EQ(segments.size(), 3u);
+  EXPECT_NEAR(static_cast<double>(segments[0].second), rate * 1.5, 400.0);
+  EXPECT_NEAR(static_cast<double>(segments[1].first), rate * 1.6, 400.0);
+  EXPECT_NEAR(static_cast<double>(segments[2].first), rate * 3.3, 400.0);
+  EXPECT_NEAR(static_cast<double>(segments[2].second), rate * 3.4, 400.0);
+
+  EXPECT_TRUE(DetectVoiceActivity(signal.data(), 0, options, window, 1).empty());
+}
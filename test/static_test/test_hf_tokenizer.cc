@@ -0,0 +1,236 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "hf_tokenizer.hpp"
+#include "hf_tokenizer_chat.hpp"
+
+#include <algorithm>
+
+namespace {
+
+// a tokenizer.json of a byte-level BPE, whose vocab has the 256 bytes at the ids of GPT-2, <|endoftext|> at 256 and
+// the extra tokens from 257.
+std::string ByteLevelTokenizerJson(const std::vector<std::string>& extra_tokens, const nlohmann::json& merges,
+                                   const nlohmann::json& post_processor, bool ignore_merges = false) {
+  nlohmann::json vocab;
+  int id = 0;
+  for (char32_t ch = 0; ch < 256 + 68; ++ch) {
+    if ((ch < 33) || (ch > 126 && ch < 161) || (ch == 173)) {
+      continue;  // these bytes are mapped into [256, 256 + 68)
+    }
+    vocab[ustring::EncodeUTF8Char(ch)] = id++;
+  }
+  vocab["<|endoftext|>"] = id++;
+  for (const auto& token : extra_tokens) {
+    vocab[token] = id++;
+  }
+
+  nlohmann::json root;
+  root["added_tokens"] = nlohmann::json::parse(R"([{"id": 256, "content": "<|endoftext|>", "special": true}])");
+  root["normalizer"] = nullptr;
+  root["pre_tokenizer"] = nlohmann::json::parse(R"({"type": "ByteLevel", "add_prefix_space": false})");
+  root["post_processor"] = post_processor;
+  root["model"] = {{"type", "BPE"}, {"vocab", vocab}, {"merges", merges}, {"ignore_merges", ignore_merges}};
+  return root.dump();
+}
+
+std::vector<int64_t> Encode(const std::string& tokenizer_json, std::string_view text, int64_t max_length = INT64_MAX,
+                            bool skip_unicode_normalization = false) {
+  HfTokenizerPipeline pipeline;
+  pipeline.Load(tokenizer_json, skip_unicode_normalization);
+  BpeCache cache;
+  return pipeline.Encode(text, max_length, cache);
+}
+
+}  // namespace
+
+TEST(hf_tokenizer, byte_level_bpe) {
+  const std::vector<std::string> extra_tokens{"Ġa", "ab", "Ġab", "abab"};
+  // the merges are lines in the older files, and pairs in the newer ones
+  const auto lines = nlohmann::json::parse(R"(["Ġ a", "a b", "Ġa b"])");
+  const auto pairs = nlohmann::json::parse(R"([["Ġ", "a"], ["a", "b"], ["Ġa", "b"]])");
+  const auto byte_level = nlohmann::json::parse(R"({"type": "ByteLevel", "trim_offsets": false})");
+  for (const auto& merges : {lines, pairs}) {
+    const std::string tokenizer_json = ByteLevelTokenizerJson(extra_tokens, merges, byte_level);
+    EXPECT_EQ(Encode(tokenizer_json, "ab ab<|endoftext|>"), (std::vector<int64_t>{258, 259, 256}));
+    EXPECT_EQ(Encode(tokenizer_json, "abab"), (std::vector<int64_t>{258, 258}));
+  }
+
+  // the whole word of the vocab is one token with ignore_merges
+  EXPECT_EQ(Encode(ByteLevelTokenizerJson(extra_tokens, lines, byte_level, true), "abab"),
+            (std::vector<int64_t>{260}));
+
+  // the template of a single sequence, whose special tokens are kept by the truncation
+  const auto bos_template = nlohmann::json::parse(R"({"type": "Sequence", "processors": [
+      {"type": "ByteLevel"},
+      {"type": "TemplateProcessing",
+       "single": [{"SpecialToken": {"id": "<|endoftext|>", "type_id": 0}}, {"Sequence": {"id": "A", "type_id": 0}}],
+       "pair": [],
+       "special_tokens": {"<|endoftext|>": {"id": "<|endoftext|>", "ids": [256], "tokens": ["<|endoftext|>"]}}}]})");
+  const std::string with_bos = ByteLevelTokenizerJson(extra_tokens, lines, bos_template);
+  EXPECT_EQ(Encode(with_bos, "ab ab"), (std::vector<int64_t>{256, 258, 259}));
+  EXPECT_EQ(Encode(with_bos, "ab ab", 2), (std::vector<int64_t>{256, 258}));
+  EXPECT_EQ(Encode(with_bos, ""), (std::vector<int64_t>{256}));
+}
+
+TEST(hf_tokenizer, byte_fallback_bpe) {
+  // the BPE of Llama-2, whose spaces are U+2581 and whose unknown characters are the <0x..> tokens of their bytes
+  nlohmann::json vocab{{"<unk>", 0}, {"<s>", 1}, {"</s>", 2}};
+  for (int byte = 0; byte < 256; ++byte) {
+    char piece[8];
+    std::snprintf(piece, sizeof(piece), "<0x%02X>", byte);
+    vocab[piece] = 3 + byte;
+  }
+  vocab["▁"] = 259;
+  vocab["h"] = 260;
+  vocab["i"] = 261;
+  vocab["▁h"] = 262;
+  vocab["▁hi"] = 263;
+
+  nlohmann::json root = nlohmann::json::parse(R"({
+    "added_tokens": [{"id": 0, "content": "<unk>"}, {"id": 1, "content": "<s>"}, {"id": 2, "content": "</s>"}],
+    "normalizer": {"type": "Sequence", "normalizers": [
+      {"type": "Prepend", "prepend": "▁"}, {"type": "Replace", "pattern": {"String": " "}, "content": "▁"}]},
+    "pre_tokenizer": null,
+    "post_processor": {"type": "TemplateProcessing",
+      "single": [{"SpecialToken": {"id": "<s>", "type_id": 0}}, {"Sequence": {"id": "A", "type_id": 0}}],
+      "special_tokens": {"<s>": {"id": "<s>", "ids": [1], "tokens": ["<s>"]}}},
+    "model": {"type": "BPE", "unk_token": "<unk>", "fuse_unk": true, "byte_fallback": true,
+              "merges": [["▁", "h"], ["▁h", "i"]]}})");
+  root["model"]["vocab"] = vocab;
+  EXPECT_EQ(Encode(root.dump(), "hi hi\xE4\xBD\xA0"),
+            (std::vector<int64_t>{1, 263, 263, 3 + 0xE4, 3 + 0xBD, 3 + 0xA0}));
+  EXPECT_EQ(Encode(root.dump(), "ih</s>"), (std::vector<int64_t>{1, 259, 261, 260, 2}));
+
+  // the consecutive unknown characters are one unk without byte_fallback
+  root["model"]["byte_fallback"] = false;
+  EXPECT_EQ(Encode(root.dump(), "\xE4\xBD\xA0\xE5\xA5\xBDhi"), (std::vector<int64_t>{1, 259, 0, 260, 261}));
+  root["model"]["fuse_unk"] = false;
+  EXPECT_EQ(Encode(root.dump(), "\xE4\xBD\xA0\xE5\xA5\xBD"), (std::vector<int64_t>{1, 259, 0, 0}));
+}
+
+TEST(hf_tokenizer, word_level) {
+  const std::string tokenizer_json = R"({
+    "added_tokens": [{"id": 1, "content": "[CLS]"}, {"id": 2, "content": "[SEP]"}],
+    "normalizer": {"type": "Sequence", "normalizers": [{"type": "Lowercase"}, {"type": "Strip"}]},
+    "pre_tokenizer": {"type": "Whitespace"},
+    "post_processor": {"type": "BertProcessing", "sep": ["[SEP]", 2], "cls": ["[CLS]", 1]},
+    "model": {"type": "WordLevel", "unk_token": "[UNK]",
+              "vocab": {"[UNK]": 0, "[CLS]": 1, "[SEP]": 2, "hello": 3, "world": 4, "!": 5}}})";
+  EXPECT_EQ(Encode(tokenizer_json, "  Hello, WORLD!"), (std::vector<int64_t>{1, 3, 0, 4, 5, 2}));
+  EXPECT_EQ(Encode(tokenizer_json, "hello world", 3), (std::vector<int64_t>{1, 3, 2}));
+}
+
+TEST(hf_tokenizer, split_behaviors) {
+  const std::string vocab = R"({"the": 0, "final": 1, "countdown": 2, "-": 3, "the-": 4, "final-": 5, "-final": 6,
+                                "-countdown": 7, "--": 8})";
+  const std::vector<std::pair<std::string, std::vector<int64_t>>> cases{
+      {"Removed", {0, 1, 2}},
+      {"Isolated", {0, 3, 1, 3, 3, 2}},
+      {"MergedWithPrevious", {4, 5, 3, 2}},
+      {"MergedWithNext", {0, 6, 3, 7}},
+      {"Contiguous", {0, 3, 1, 8, 2}}};
+  for (const auto& [behavior, ids] : cases) {
+    const std::string tokenizer_json =
+        R"({"pre_tokenizer": {"type": "Split", "pattern": {"String": "-"}, "invert": false, "behavior": ")" +
+        behavior + R"("}, "model": {"type": "WordLevel", "vocab": )" + vocab + "}}";
+    EXPECT_EQ(Encode(tokenizer_json, "the-final--countdown"), ids) << behavior;
+  }
+}
+
+TEST(hf_tokenizer, metaspace) {
+  // the Precompiled normalizer is only the identity if the normalization is skipped
+  const std::string tokenizer_json = R"({
+    "added_tokens": [{"id": 3, "content": "<mask>", "lstrip": true}],
+    "normalizer": {"type": "Sequence", "normalizers": [
+      {"type": "Precompiled", "precompiled_charsmap": "AAAA"},
+      {"type": "Replace", "pattern": {"Regex": " {2,}"}, "content": " "}]},
+    "pre_tokenizer": {"type": "Metaspace", "replacement": "▁", "prepend_scheme": "always", "split": true},
+    "model": {"type": "WordLevel", "unk_token": "<unk>",
+              "vocab": {"<unk>": 0, "▁hello": 1, "▁world": 2, "<mask>": 3}}})";
+  EXPECT_EQ(Encode(tokenizer_json, "hello   world", INT64_MAX, true), (std::vector<int64_t>{1, 2}));
+  EXPECT_EQ(Encode(tokenizer_json, "hello <mask>world", INT64_MAX, true), (std::vector<int64_t>{1, 3, 2}));
+  EXPECT_ANY_THROW(Encode(tokenizer_json, "hello"));
+}
+
+TEST(hf_tokenizer, unicode_normalizer) {
+  // the ligature and the full-width letters are the ASCII ones in NFKC, and the decomposed é is composed in NFC
+  const std::string tokenizer_json = R"({
+    "normalizer": {"type": "Sequence", "normalizers": [{"type": "NFKC"}, {"type": "Lowercase"}]},
+    "pre_tokenizer": {"type": "WhitespaceSplit"},
+    "model": {"type": "WordLevel", "unk_token": "<unk>",
+              "vocab": {"<unk>": 0, "fine": 1, "ab": 2, "café": 3}}})";
+  EXPECT_EQ(Encode(tokenizer_json, "\xEF\xAC\x81ne \xEF\xBC\xA1\xEF\xBD\x82 cafe\xCC\x81"),
+            (std::vector<int64_t>{1, 2, 3}));
+  // it's the identity if the normalization is skipped
+  EXPECT_EQ(Encode(tokenizer_json, "\xEF\xAC\x81ne cafe\xCC\x81", INT64_MAX, true), (std::vector<int64_t>{0, 0}));
+}
+
+TEST(hf_tokenizer, unsupported) {
+  EXPECT_ANY_THROW(Encode(R"({"model": {"type": "WordPiece", "vocab": {}}})", "a"));
+  // byte_fallback needs all the 256 <0x..> tokens
+  EXPECT_ANY_THROW(Encode(R"({"pre_tokenizer": null,
+                              "model": {"type": "BPE", "byte_fallback": true, "vocab": {"a": 0}, "merges": []}})", "a"));
+  EXPECT_ANY_THROW(Encode(R"({"model": {"type": "BPE", "continuing_subword_prefix": "##", "vocab": {}, "merges": []}})",
+                          "a"));
+  EXPECT_ANY_THROW(Encode(R"({"normalizer": {"type": "BertNormalizer"}, "model": {"type": "WordLevel", "vocab": {}}})",
+                          "a"));
+  EXPECT_ANY_THROW(Encode("[]", "a"));
+}
+
+#ifdef ENABLE_UNIGRAM_TOKENIZER
+TEST(hf_tokenizer, unigram) {
+  const std::string tokenizer_json = R"({
+    "added_tokens": [{"id": 1, "content": "</s>"}],
+    "pre_tokenizer": {"type": "Metaspace", "replacement": "▁", "add_prefix_space": true},
+    "post_processor": {"type": "TemplateProcessing",
+      "single": [{"Sequence": {"id": "A", "type_id": 0}}, {"SpecialToken": {"id": "</s>", "type_id": 0}}],
+      "special_tokens": {"</s>": {"id": "</s>", "ids": [1], "tokens": ["</s>"]}}},
+    "model": {"type": "Unigram", "unk_id": 0,
+              "vocab": [["<unk>", 0.0], ["</s>", 0.0], ["▁hello", -1.0], ["▁world", -1.0], ["▁", -2.0]]}})";
+  EXPECT_EQ(Encode(tokenizer_json, "hello world"), (std::vector<int64_t>{2, 3, 1}));
+  EXPECT_EQ(Encode(tokenizer_json, "hello x"), (std::vector<int64_t>{2, 4, 0, 1}));
+}
+#endif
+
+TEST(hf_tokenizer, chat_template) {
+  const auto byte_level = nlohmann::json::parse(R"({"type": "ByteLevel", "trim_offsets": false})");
+  const std::string tokenizer_json =
+      ByteLevelTokenizerJson({"Ġa", "ab", "Ġab", "abab"}, nlohmann::json::parse(R"(["Ġ a", "a b", "Ġa b"])"),
+                             byte_level);
+  HfTokenizerPipeline pipeline;
+  pipeline.Load(tokenizer_json, false);
+  BpeCache cache;
+
+  // the ids of a conversation are the ones of its rendered text, whose added tokens of the template aren't looked up
+  ChatTemplate chat_template = ChatTemplate::Parse(
+      "bos\t<|endoftext|>\n"
+      "turn\t*\t{role}:\\n\t<|endoftext|>\n"
+      "generation\tab\n");
+  chat_template.Compile(pipeline);
+  const std::string_view roles[] = {"user", "assistant"};
+  const std::string_view contents[] = {"ab ab", "a<|endoftext|>b"};
+  const auto encode = [&](bool add_generation_prompt, bool parse_special) {
+    std::string buffer;
+    std::vector<HfTokenizerPipeline::Segment> segments;
+    chat_template.Render(pipeline, roles, contents, 2, add_generation_prompt, parse_special, buffer, segments);
+    std::vector<int64_t> ids;
+    pipeline.EncodeSegments(segments, SIZE_MAX, ids, cache);
+    return ids;
+  };
+  EXPECT_EQ(encode(true, true),
+            pipeline.Encode("<|endoftext|>user:\nab ab<|endoftext|>assistant:\na<|endoftext|>b<|endoftext|>ab",
+                            INT64_MAX, cache));
+  EXPECT_EQ(encode(false, true),
+            pipeline.Encode("<|endoftext|>user:\nab ab<|endoftext|>assistant:\na<|endoftext|>b<|endoftext|>",
+                            INT64_MAX, cache));
+
+  // without parse_special, the added tokens of the contents are texts, and only the ones of the template are ids
+  const auto ids = encode(false, false);
+  EXPECT_EQ(std::count(ids.begin(), ids.end(), 256), 3);  // the bos and the suffixes
+
+  EXPECT_THROW(ChatTemplate::Parse("bos\t<s>"), std::exception);
+  EXPECT_THROW(ChatTemplate::Parse("turn\tuser\tx"), std::exception);
+  EXPECT_NO_THROW(ChatTemplate::Parse("llama3"));
+}
@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#if defined(ENABLE_VISION) && (defined(ENABLE_NATIVE_JPEG) || defined(ENABLE_NATIVE_PNG))
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "vision/image_codecs.h"
+
+using namespace ort_extensions;
+
+namespace {
+
+std::vector<uint8_t> ReadBytes(const std::filesystem::path& path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// Decodes the image of the file at the reduced size into BGR, RGB and gray, which are checked against each other.
+void CheckDecodes(const std::vector<uint8_t>& encoded, int64_t scale_denominator) {
+  ImageHeader header;
+  ASSERT_TRUE(ReadImageHeader(encoded.data(), encoded.size(), header));
+  header = ReducedImageHeader(header, scale_denominator);
+  const size_t step = static_cast<size_t>(header.width) * 3 + 4;  // rows with padding
+  const size_t pixels = static_cast<size_t>(header.height * header.width);
+  std::vector<uint8_t> bgr(header.height * step, 0xAB);
+  std::vector<uint8_t> rgb(header.height * step, 0xAB);
+  ASSERT_TRUE(NativeDecodeImage(encoded.data(), encoded.size(), header, scale_denominator, 3, false, false,
+                                bgr.data(), step, "[Test]"));
+  ASSERT_TRUE(NativeDecodeImage(encoded.data(), encoded.size(), header, scale_denominator, 3, true, false,
+                                rgb.data(), step, "[Test]"));
+  for (int64_t y = 0; y < header.height; ++y) {
+    const uint8_t* b = bgr.data() + y * step;
+    const uint8_t* r = rgb.data() + y * step;
+    for (int64_t x = 0; x < header.width; ++x) {
+      ASSERT_EQ(b[x * 3], r[x * 3 + 2]) << y << " " << x;
+      ASSERT_EQ(b[x * 3 + 1], r[x * 3 + 1]) << y << " " << x;
+      ASSERT_EQ(b[x * 3 + 2], r[x * 3]) << y << " " << x;
+    }
+    // the padding of the rows isn't written
+    ASSERT_EQ(b[header.width * 3], 0xAB);
+  }
+
+  // the fast decode is close
+  std::vector<uint8_t> fast(header.height * step);
+  ASSERT_TRUE(NativeDecodeImage(encoded.data(), encoded.size(), header, scale_denominator, 3, false, true,
+                                fast.data(), step, "[Test]"));
+  double difference = 0.0;
+  for (int64_t y = 0; y < header.height; ++y) {
+    for (int64_t x = 0; x < header.width * 3; ++x) {
+      difference += std::abs(fast[y * step + x] - bgr[y * step + x]);
+    }
+  }
+  EXPECT_LT(difference / (pixels * 3), 4.0);
+}
+
+}  // namespace
+
+TEST(ImageCodecsTest, NativeDecoders) {
+  const std::filesystem::path data_dir = std::filesystem::current_path() / "data";
+  if (NativeImageCodecs::HasJpeg()) {
+    auto jpeg = ReadBytes(data_dir / "wolves_with_fastestDet.jpg");
+    CheckDecodes(jpeg, 1);
+    CheckDecodes(jpeg, 4);
+
+    ImageHeader header;
+    ASSERT_TRUE(ReadImageHeader(jpeg.data(), jpeg.size(), header));
+    std::vector<uint8_t> gray(static_cast<size_t>(header.height * header.width));
+    EXPECT_TRUE(NativeDecodeImage(jpeg.data(), jpeg.size(), header, 1, 1, false, false, gray.data(),
+                                  static_cast<size_t>(header.width), "[Test]"));
+
+    // the truncated stream throws, and the orientation is left to OpenCV
+    std::vector<uint8_t> truncated(jpeg.begin(), jpeg.begin() + 600);
+    std::vector<uint8_t> bgr(static_cast<size_t>(header.height * header.width * 3));
+    EXPECT_ANY_THROW(NativeDecodeImage(truncated.data(), truncated.size(), header, 1, 3, false, false, bgr.data(),
+                                       static_cast<size_t>(header.width * 3), "[Test]"));
+    header.orientation = 6;
+    EXPECT_FALSE(NativeDecodeImage(jpeg.data(), jpeg.size(), header, 1, 3, false, false, bgr.data(),
+                                   static_cast<size_t>(header.width * 3), "[Test]"));
+  }
+
+  if (NativeImageCodecs::HasPng()) {
+    auto png = ReadBytes(data_dir / "pineapple.jpg");  // a PNG stream
+    CheckDecodes(png, 1);
+  }
+}
+
+#endif  // ENABLE_VISION && (ENABLE_NATIVE_JPEG || ENABLE_NATIVE_PNG)
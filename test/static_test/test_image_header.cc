@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "image_header.h"
+
+using namespace ort_extensions;
+
+namespace {
+
+std::vector<uint8_t> ReadBytes(const std::filesystem::path& path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// A JPEG header of the size, with an EXIF segment of the orientation in the byte order if it's not 0.
+std::vector<uint8_t> MakeJpegHeader(uint16_t height, uint16_t width, uint16_t orientation, bool little_endian) {
+  std::vector<uint8_t> data{0xFF, 0xD8};
+  if (orientation != 0) {
+    std::vector<uint8_t> tiff = little_endian ? std::vector<uint8_t>{'I', 'I', 42, 0, 8, 0, 0, 0, 1, 0,
+                                                                     0x12, 0x01, 3, 0, 1, 0, 0, 0,
+                                                                     static_cast<uint8_t>(orientation), 0, 0, 0}
+                                              : std::vector<uint8_t>{'M', 'M', 0, 42, 0, 0, 0, 8, 0, 1,
+                                                                     0x01, 0x12, 0, 3, 0, 0, 0, 1,
+                                                                     0, static_cast<uint8_t>(orientation), 0, 0};
+    const size_t length = 2 + 6 + tiff.size();
+    data.insert(data.end(), {0xFF, 0xE1, static_cast<uint8_t>(length >> 8), static_cast<uint8_t>(length)});
+    data.insert(data.end(), {'E', 'x', 'i', 'f', 0, 0});
+    data.insert(data.end(), tiff.begin(), tiff.end());
+  }
+  // a quantization table segment, and the start of a progressive frame
+  data.insert(data.end(), {0xFF, 0xDB, 0, 3, 0});
+  data.insert(data.end(), {0xFF, 0xC2, 0, 11, 8, static_cast<uint8_t>(height >> 8), static_cast<uint8_t>(height),
+                           static_cast<uint8_t>(width >> 8), static_cast<uint8_t>(width), 1, 1, 0x11, 0});
+  return data;
+}
+
+}  // namespace
+
+TEST(ImageHeaderTest, ReadFiles) {
+  const std::filesystem::path data_dir = std::filesystem::current_path() / "data";
+  ImageHeader header;
+
+  auto jpeg = ReadBytes(data_dir / "test_colors.jpg");  // with an EXIF segment of no rotation
+  ASSERT_TRUE(ReadImageHeader(jpeg.data(), jpeg.size(), header));
+  EXPECT_EQ(header.height, 1600);
+  EXPECT_EQ(header.width, 2560);
+
+  jpeg = ReadBytes(data_dir / "wolves_with_fastestDet.jpg");
+  ASSERT_TRUE(ReadImageHeader(jpeg.data(), jpeg.size(), header));
+  EXPECT_EQ(header.height, 334);
+  EXPECT_EQ(header.width, 500);
+
+  auto png = ReadBytes(data_dir / "pineapple.jpg");  // a PNG stream
+  ASSERT_TRUE(ReadImageHeader(png.data(), png.size(), header));
+  EXPECT_EQ(header.height, 850);
+  EXPECT_EQ(header.width, 744);
+}
+
+TEST(ImageHeaderTest, JpegOrientation) {
+  ImageHeader header;
+  for (bool little_endian : {true, false}) {
+    for (uint16_t orientation = 0; orientation <= 8; ++orientation) {
+      auto data = MakeJpegHeader(300, 400, orientation, little_endian);
+      ASSERT_TRUE(ReadImageHeader(data.data(), data.size(), header));
+      const bool rotated = orientation >= 5;
+      EXPECT_EQ(header.height, rotated ? 400 : 300) << orientation;
+      EXPECT_EQ(header.width, rotated ? 300 : 400) << orientation;
+      EXPECT_EQ(header.orientation, orientation == 0 ? 1u : orientation);  // 0 is no EXIF segment
+    }
+  }
+}
+
+TEST(ImageHeaderTest, IncompleteHeaders) {
+  ImageHeader header;
+  auto jpeg = MakeJpegHeader(300, 400, 6, true);
+  for (size_t size = 0; size < jpeg.size() - 6; ++size) {
+    EXPECT_FALSE(ReadImageHeader(jpeg.data(), size, header)) << size;
+  }
+
+  // the height of 0 is only known after the first scan
+  jpeg = MakeJpegHeader(0, 400, 0, true);
+  EXPECT_FALSE(ReadImageHeader(jpeg.data(), jpeg.size(), header));
+
+  std::vector<uint8_t> png{0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A, 0, 0, 0, 13, 'I', 'H', 'D', 'R',
+                           0, 0, 1, 0, 0, 0, 0, 2, 8, 2, 0, 0, 0, 0, 0, 0, 0};
+  EXPECT_FALSE(ReadImageHeader(png.data(), png.size(), header));  // no IDAT
+
+  std::vector<uint8_t> idat{0, 0, 0, 0, 'I', 'D', 'A', 'T', 0, 0, 0, 0};
+  std::vector<uint8_t> exif{0, 0, 0, 0, 'e', 'X', 'I', 'f', 0, 0, 0, 0};
+  auto with_idat = png;
+  with_idat.insert(with_idat.end(), idat.begin(), idat.end());
+  ASSERT_TRUE(ReadImageHeader(with_idat.data(), with_idat.size(), header));
+  EXPECT_EQ(header.height, 2);
+  EXPECT_EQ(header.width, 256);
+
+  // the orientation of a PNG image isn't read
+  png.insert(png.end(), exif.begin(), exif.end());
+  png.insert(png.end(), idat.begin(), idat.end());
+  EXPECT_FALSE(ReadImageHeader(png.data(), png.size(), header));
+
+  const char* text = "not an image";
+  EXPECT_FALSE(ReadImageHeader(reinterpret_cast<const uint8_t*>(text), 12, header));
+}
+
+TEST(ImageHeaderTest, WebpHeaders) {
+  ImageHeader header;
+  auto riff = [](const char* chunk, std::vector<uint8_t> payload) {
+    std::vector<uint8_t> data{'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'E', 'B', 'P'};
+    data.insert(data.end(), chunk, chunk + 4);
+    data.insert(data.end(), {0, 0, 0, 0});
+    payload.resize(std::max<size_t>(payload.size(), 12));
+    data.insert(data.end(), payload.begin(), payload.end());
+    return data;
+  };
+
+  // the lossy frame of 300x200, with the scale bits of the width
+  auto webp = riff("VP8 ", {0, 0, 0, 0x9D, 0x01, 0x2A, 0x2C, 0x41, 0xC8, 0x00});
+  ASSERT_TRUE(ReadImageHeader(webp.data(), webp.size(), header));
+  EXPECT_EQ(header.format, ImageHeader::Format::kWebp);
+  EXPECT_EQ(header.width, 300);
+  EXPECT_EQ(header.height, 200);
+
+  // the lossless frame of 300x200, of the sizes minus 1 in 14 bits
+  const uint32_t bits = 299 | (199u << 14);
+  webp = riff("VP8L", {0x2F, static_cast<uint8_t>(bits), static_cast<uint8_t>(bits >> 8),
+                       static_cast<uint8_t>(bits >> 16), static_cast<uint8_t>(bits >> 24)});
+  ASSERT_TRUE(ReadImageHeader(webp.data(), webp.size(), header));
+  EXPECT_EQ(header.width, 300);
+  EXPECT_EQ(header.height, 200);
+
+  // the canvas of the extended format, which isn't read if it's animated
+  webp = riff("VP8X", {0x10, 0, 0, 0, 0x2B, 0x01, 0x00, 0xC7, 0x00, 0x00});
+  ASSERT_TRUE(ReadImageHeader(webp.data(), webp.size(), header));
+  EXPECT_EQ(header.width, 300);
+  EXPECT_EQ(header.height, 200);
+  webp[20] |= 0x02;
+  EXPECT_FALSE(ReadImageHeader(webp.data(), webp.size(), header));
+}
+
+TEST(ImageHeaderTest, JpegScaleDenominator) {
+  ImageHeader header;
+  header.format = ImageHeader::Format::kJpeg;
+  header.height = 3000;
+  header.width = 4000;
+  EXPECT_EQ(JpegScaleDenominator(header, 224, 224), 8);  // 375x500
+  EXPECT_EQ(JpegScaleDenominator(header, 376, 224), 4);  // 750x1000
+  EXPECT_EQ(JpegScaleDenominator(header, 1500, 2000), 2);
+  EXPECT_EQ(JpegScaleDenominator(header, 1501, 2000), 1);
+
+  // libjpeg rounds the reduced size up
+  header.height = 1801;
+  header.width = 2405;
+  EXPECT_EQ(JpegScaleDenominator(header, 226, 301), 8);
+  auto reduced = ReducedImageHeader(header, 8);
+  EXPECT_EQ(reduced.height, 226);
+  EXPECT_EQ(reduced.width, 301);
+
+  header.format = ImageHeader::Format::kPng;
+  EXPECT_EQ(JpegScaleDenominator(header, 224, 224), 1);
+}
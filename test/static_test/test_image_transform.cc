@@ -0,0 +1,498 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "vision/camera_frame.hpp"
+#include "vision/image_transform.hpp"
+
+using namespace ort_extensions;
+
+namespace {
+
+std::vector<uint8_t> RandomImage(int64_t height, int64_t width, size_t stride) {
+  std::mt19937 rng(static_cast<uint32_t>(height * 31 + width));
+  std::uniform_int_distribution<int> pixel(0, 255);
+  std::vector<uint8_t> image(static_cast<size_t>(height) * stride);
+  for (auto& value : image) {
+    value = static_cast<uint8_t>(pixel(rng));
+  }
+  return image;
+}
+
+// The weight of the input pixel j in the output pixel i of a resize of in_size into out_size, like PIL does.
+double Weight(int64_t in_size, int64_t out_size, int64_t i, int64_t j) {
+  double scale = static_cast<double>(in_size) / out_size;
+  double support = std::max(scale, 1.0);
+  double center = (i + 0.5) * scale;
+  int64_t begin = std::max<int64_t>(static_cast<int64_t>(center - support + 0.5), 0);
+  int64_t end = std::min<int64_t>(static_cast<int64_t>(center + support + 0.5), in_size);
+  double sum = 0.0;
+  double weight = 0.0;
+  for (int64_t k = begin; k < end; ++k) {
+    double w = std::max(0.0, 1.0 - std::abs((k - center + 0.5) / support));
+    sum += w;
+    if (k == j) {
+      weight = w;
+    }
+  }
+  return weight / sum;
+}
+
+// The output of TransformImage pixel by pixel.
+std::vector<float> Reference(const std::vector<uint8_t>& image, int64_t height, int64_t width, size_t stride,
+                             const ImageTransformOptions& options) {
+  auto resized = ResizedImageSize(height, width, options);
+  auto size = TransformedImageSize(height, width, options);
+  int64_t top = (resized[0] - size[0]) / 2;
+  int64_t left = (resized[1] - size[1]) / 2;
+  std::vector<float> output(static_cast<size_t>(3 * size[0] * size[1]));
+  for (int64_t y = 0; y < size[0]; ++y) {
+    for (int64_t x = 0; x < size[1]; ++x) {
+      for (int64_t c = 0; c < 3; ++c) {
+        double sum = 0.0;
+        for (int64_t i = 0; i < height; ++i) {
+          double wy = Weight(height, resized[0], top + y, i);
+          if (wy == 0.0) {
+            continue;
+          }
+          for (int64_t j = 0; j < width; ++j) {
+            sum += wy * Weight(width, resized[1], left + x, j) * image[i * stride + j * 3 + c];
+          }
+        }
+        int64_t out_c = options.swap_rb ? 2 - c : c;
+        output[(out_c * size[0] + y) * size[1] + x] =
+            static_cast<float>((sum * options.rescale - options.mean[out_c]) / options.std[out_c]);
+      }
+    }
+  }
+  return output;
+}
+
+// The resize of PIL of the uint8 image: the columns are resized into a uint8 image first, and then its rows, with the
+// kernels of Image.BICUBIC and Image.LANCZOS computed here again.
+std::vector<uint8_t> PilResize(const std::vector<uint8_t>& image, int64_t height, int64_t width, size_t stride,
+                               int64_t out_height, int64_t out_width, ResampleFilter filter) {
+  auto kernel = [filter](double x) {
+    x = std::abs(x);
+    if (filter == ResampleFilter::kBicubic) {
+      return x < 1.0 ? (1.5 * x - 2.5) * x * x + 1.0 : x < 2.0 ? ((-0.5 * x + 2.5) * x - 4.0) * x + 2.0 : 0.0;
+    }
+    auto sinc = [](double v) {
+      const double pi_v = v * 3.14159265358979323846;
+      return v == 0.0 ? 1.0 : std::sin(pi_v) / pi_v;
+    };
+    return x < 3.0 ? sinc(x) * sinc(x / 3.0) : 0.0;
+  };
+  const double support = filter == ResampleFilter::kBicubic ? 2.0 : 3.0;
+  // the pixels of the output pixel i of a line of in_size from the pixels of pixel(j)
+  auto resize_line = [&](int64_t in_size, int64_t out_size, int64_t i, auto&& pixel) {
+    const double scale = static_cast<double>(in_size) / out_size;
+    const double filter_scale = std::max(scale, 1.0);
+    const double center = (i + 0.5) * scale;
+    int64_t begin = std::max<int64_t>(static_cast<int64_t>(center - support * filter_scale + 0.5), 0);
+    int64_t end = std::min<int64_t>(static_cast<int64_t>(center + support * filter_scale + 0.5), in_size);
+    double sum = 0.0;
+    double weights = 0.0;
+    for (int64_t j = begin; j < end; ++j) {
+      double w = kernel((j - center + 0.5) / filter_scale);
+      sum += w * pixel(j);
+      weights += w;
+    }
+    return static_cast<uint8_t>(std::lround(std::min(std::max(sum / weights, 0.0), 255.0)));
+  };
+  std::vector<uint8_t> columns(static_cast<size_t>(height * out_width * 3));
+  for (int64_t y = 0; y < height; ++y) {
+    for (int64_t x = 0; x < out_width; ++x) {
+      for (int64_t c = 0; c < 3; ++c) {
+        columns[(y * out_width + x) * 3 + c] =
+            resize_line(width, out_width, x, [&](int64_t j) { return image[y * stride + j * 3 + c]; });
+      }
+    }
+  }
+  std::vector<uint8_t> output(static_cast<size_t>(out_height * out_width * 3));
+  for (int64_t y = 0; y < out_height; ++y) {
+    for (int64_t x = 0; x < out_width; ++x) {
+      for (int64_t c = 0; c < 3; ++c) {
+        output[(y * out_width + x) * 3 + c] =
+            resize_line(height, out_height, y, [&](int64_t i) { return columns[(i * out_width + x) * 3 + c]; });
+      }
+    }
+  }
+  return output;
+}
+
+}  // namespace
+
+TEST(ImageTransformTest, Identity) {
+  const int64_t height = 7, width = 13;
+  const size_t stride = width * 3 + 5;
+  auto image = RandomImage(height, width, stride);
+  ImageTransformOptions options;
+  options.rescale = 1.0f;
+  std::vector<float> output(3 * height * width);
+  TransformImage(image.data(), height, width, stride, options, output.data(), 1);
+  for (int64_t c = 0; c < 3; ++c) {
+    for (int64_t y = 0; y < height; ++y) {
+      for (int64_t x = 0; x < width; ++x) {
+        ASSERT_EQ(output[(c * height + y) * width + x], image[y * stride + x * 3 + c]);
+      }
+    }
+  }
+}
+
+TEST(ImageTransformTest, ResizeCropNormalize) {
+  struct Case {
+    int64_t height, width;
+    std::vector<int64_t> resize_to;
+    bool not_larger;
+    std::vector<int64_t> crop;
+  };
+  const std::vector<Case> cases{
+      {120, 90, {32, 32}, false, {32, 32}},  // downscale the shorter side to 32
+      {45, 77, {20, 20}, true, {}},           // both sides at most 20
+      {17, 23, {40, 60}, false, {30, 50}},    // upscale
+      {50, 41, {}, false, {21, 40}},          // only crop
+  };
+  for (const auto& test : cases) {
+    const size_t stride = static_cast<size_t>(test.width) * 3 + 3;
+    auto image = RandomImage(test.height, test.width, stride);
+    ImageTransformOptions options;
+    options.resize_to = test.resize_to;
+    options.not_larger = test.not_larger;
+    options.crop = test.crop;
+    options.mean = {0.485f, 0.456f, 0.406f};
+    options.std = {0.229f, 0.224f, 0.225f};
+    options.swap_rb = true;
+
+    auto size = TransformedImageSize(test.height, test.width, options);
+    if (!test.crop.empty()) {
+      EXPECT_EQ(size[0], test.crop[0]);
+      EXPECT_EQ(size[1], test.crop[1]);
+    }
+    auto expected = Reference(image, test.height, test.width, stride, options);
+    for (size_t num_threads : {1, 3}) {
+      std::vector<float> output(expected.size());
+      TransformImage(image.data(), test.height, test.width, stride, options, output.data(), num_threads);
+      for (size_t i = 0; i < output.size(); ++i) {
+        ASSERT_NEAR(output[i], expected[i], 1e-4) << test.height << "x" << test.width << " at " << i;
+      }
+    }
+  }
+}
+
+TEST(ImageTransformTest, ResizedSize) {
+  ImageTransformOptions options;
+  options.resize_to = {224, 224};
+  auto size = ResizedImageSize(3000, 4000, options);
+  EXPECT_EQ(size[0], 224);
+  EXPECT_EQ(size[1], 299);
+
+  options.not_larger = true;
+  size = ResizedImageSize(3000, 4000, options);
+  EXPECT_EQ(size[0], 168);
+  EXPECT_EQ(size[1], 224);
+
+  options.crop = {200, 300};
+  EXPECT_THROW(TransformedImageSize(3000, 4000, options), std::exception);
+}
+
+TEST(ImageTransformTest, Letterbox) {
+  const int64_t height = 30, width = 47;
+  const size_t stride = static_cast<size_t>(width) * 3;
+  auto image = RandomImage(height, width, stride);
+  ImageTransformOptions resize;
+  resize.resize_to = {32, 32};
+  resize.not_larger = true;
+  resize.mean = {0.5f, 0.25f, 0.0f};
+  resize.std = {0.5f, 0.25f, 1.0f};
+  resize.swap_rb = true;
+  ImageTransformOptions options = resize;
+  options.resize_to.clear();
+  options.not_larger = false;
+  options.letterbox = {32, 32};
+
+  // the resize into 20 x 32 at the row 6 of the padding
+  auto size = TransformedImageSize(height, width, options);
+  ASSERT_EQ(size[0], 32);
+  ASSERT_EQ(size[1], 32);
+  auto resized = Reference(image, height, width, stride, resize);
+  ASSERT_EQ(resized.size(), 3u * 20 * 32);
+  for (size_t num_threads : {1, 2}) {
+    std::vector<float> output(3 * 32 * 32, -1.0f);
+    TransformImage(image.data(), height, width, stride, options, output.data(), num_threads);
+    for (size_t c = 0; c < 3; ++c) {
+      const float pad = (114.0f / 255 - resize.mean[c]) / resize.std[c];
+      for (size_t y = 0; y < 32; ++y) {
+        for (size_t x = 0; x < 32; ++x) {
+          const float value = output[(c * 32 + y) * 32 + x];
+          if (y < 6 || y >= 26) {
+            ASSERT_NEAR(value, pad, 1e-5) << c << " " << y << " " << x;
+          } else {
+            ASSERT_NEAR(value, resized[(c * 20 + y - 6) * 32 + x], 1e-4) << c << " " << y << " " << x;
+          }
+        }
+      }
+    }
+  }
+
+  auto transform = ImageTransformParameters(height, width, ResizedImageSize(height, width, options), options);
+  EXPECT_NEAR(transform[0], 32.0f / 47, 1e-6);
+  EXPECT_NEAR(transform[1], 20.0f / 30, 1e-6);
+  EXPECT_EQ(transform[2], 0.0f);
+  EXPECT_EQ(transform[3], 6.0f);
+
+  // the center crop is the negative offset
+  resize.crop = {16, 16};
+  transform = ImageTransformParameters(height, width, ResizedImageSize(height, width, resize), resize);
+  EXPECT_EQ(transform[2], -8.0f);
+  EXPECT_EQ(transform[3], -2.0f);
+}
+
+TEST(ImageTransformTest, CameraFrame) {
+  const int64_t height = 6, width = 10;
+  const size_t stride = 12;
+  auto luma = RandomImage(height, width, stride);
+  auto u = RandomImage(height / 2, width / 2, 8);
+  auto v = RandomImage(height / 2, width / 2 + 1, 8);  // another seed
+  std::vector<uint8_t> uv(static_cast<size_t>(height / 2) * stride);
+  for (size_t y = 0; y < static_cast<size_t>(height / 2); ++y) {
+    for (size_t x = 0; x < static_cast<size_t>(width / 2); ++x) {
+      uv[y * stride + 2 * x] = u[y * 8 + x];
+      uv[y * stride + 2 * x + 1] = v[y * 8 + x];
+    }
+  }
+
+  CameraFrame i420;
+  i420.format = FrameFormat::kI420;
+  i420.planes = {luma.data(), u.data(), v.data()};
+  i420.strides = {stride, 8, 8};
+  i420.height = height;
+  i420.width = width;
+  CameraFrame nv12 = i420;
+  nv12.format = FrameFormat::kNV12;
+  nv12.planes = {luma.data(), uv.data(), nullptr};
+  nv12.strides = {stride, stride, 0};
+
+  // the pixels of the frame, and the BT.601 of the limited range of a pixel
+  std::vector<uint8_t> upright(static_cast<size_t>(height * width * 3));
+  for (int64_t y = 0; y < height; ++y) {
+    i420.ReadRow(y, 0, width, upright.data() + y * width * 3);
+    std::vector<uint8_t> row(static_cast<size_t>(width * 3));
+    nv12.ReadRow(y, 0, width, row.data());
+    ASSERT_TRUE(std::equal(row.begin(), row.end(), upright.begin() + y * width * 3)) << y;
+  }
+  const size_t pixel = (3 * width + 5) * 3;
+  const double c = luma[3 * stride + 5] - 16.0, d = u[1 * 8 + 2] - 128.0, e = v[1 * 8 + 2] - 128.0;
+  auto clamp = [](double x) { return std::min(std::max(x, 0.0), 255.0); };
+  EXPECT_NEAR(upright[pixel], clamp(1.164 * c + 2.018 * d), 1.0);
+  EXPECT_NEAR(upright[pixel + 1], clamp(1.164 * c - 0.391 * d - 0.813 * e), 1.0);
+  EXPECT_NEAR(upright[pixel + 2], clamp(1.164 * c + 1.596 * e), 1.0);
+
+  // the rows of the rotations, from a column in the middle
+  for (int64_t rotation : {90, 180, 270}) {
+    CameraFrame rotated = nv12;
+    rotated.rotation = rotation;
+    ASSERT_EQ(rotated.Height(), rotation == 180 ? height : width);
+    std::vector<uint8_t> row(static_cast<size_t>(rotated.Width() - 1) * 3);
+    for (int64_t r = 0; r < rotated.Height(); ++r) {
+      rotated.ReadRow(r, 1, rotated.Width() - 1, row.data());
+      for (int64_t i = 0; i < rotated.Width() - 1; ++i) {
+        const int64_t col = i + 1;
+        const int64_t y = rotation == 90 ? height - 1 - col : rotation == 180 ? height - 1 - r : col;
+        const int64_t x = rotation == 90 ? r : rotation == 180 ? width - 1 - col : width - 1 - r;
+        for (int64_t k = 0; k < 3; ++k) {
+          ASSERT_EQ(row[i * 3 + k], upright[(y * width + x) * 3 + k]) << rotation << " " << r << " " << i;
+        }
+      }
+    }
+  }
+
+  // the fused conversion is the transform of the converted image
+  ImageTransformOptions options;
+  options.letterbox = {4, 4};
+  std::vector<float> expected(3 * 4 * 4);
+  TransformImage(upright.data(), height, width, static_cast<size_t>(width * 3), options, expected.data(), 1);
+  std::vector<float> output(expected.size());
+  TransformImageRows(
+      [&nv12](int64_t row, int64_t first_column, size_t count, uint8_t* scratch) {
+        return nv12.ReadRow(row, first_column, count, scratch);
+      },
+      height, width, ResizedImageSize(height, width, options), options, output.data(), 2);
+  EXPECT_EQ(output, expected);
+}
+
+TEST(ImageTransformTest, ResampleFilters) {
+  const int64_t height = 61, width = 45;
+  const size_t stride = static_cast<size_t>(width) * 3;
+  auto image = RandomImage(height, width, stride);
+  ImageTransformOptions options;
+  options.rescale = 1.0f;
+  ResizeFilterCache filters;
+  for (auto filter : {ResampleFilter::kBicubic, ResampleFilter::kLanczos}) {
+    options.filter = filter;
+
+    // the same pixels of the image of the size, whose weights of the integer offsets are 0 but the center
+    options.resize_to.clear();
+    std::vector<float> output(static_cast<size_t>(3 * height * width));
+    TransformImage(image.data(), height, width, stride, options, output.data(), 1, &filters);
+    for (int64_t c = 0; c < 3; ++c) {
+      for (int64_t y = 0; y < height; ++y) {
+        for (int64_t x = 0; x < width; ++x) {
+          ASSERT_NEAR(output[(c * height + y) * width + x], image[y * stride + x * 3 + c], 1e-3);
+        }
+      }
+    }
+
+    // the reduction and the enlargement of PIL, which rounds the pixels of both passes, and within [0, 255]
+    for (int64_t side : {16, 100}) {
+      options.resize_to = {side, side};
+      const auto resized = ResizedImageSize(height, width, options);
+      auto expected = PilResize(image, height, width, stride, resized[0], resized[1], filter);
+      output.assign(static_cast<size_t>(3 * resized[0] * resized[1]), 0.0f);
+      for (size_t num_threads : {1, 2}) {
+        TransformImage(image.data(), height, width, stride, options, output.data(), num_threads, &filters);
+        double total = 0.0;
+        for (int64_t c = 0; c < 3; ++c) {
+          for (int64_t i = 0; i < resized[0] * resized[1]; ++i) {
+            const float value = output[c * resized[0] * resized[1] + i];
+            ASSERT_GE(value, 0.0f);
+            ASSERT_LE(value, 255.0f);
+            ASSERT_NEAR(value, expected[i * 3 + c], 2.0) << side << " at " << i;
+            total += std::abs(value - expected[i * 3 + c]);
+          }
+        }
+        EXPECT_LT(total / static_cast<double>(output.size()), 0.5);
+      }
+    }
+  }
+  // the kernels are stretched by the scale of a reduction
+  EXPECT_EQ(filters.Get(height, 100, 0, 100, ResampleFilter::kLanczos)->Taps(), 7u);
+  EXPECT_EQ(filters.Get(width, 16, 0, 16, ResampleFilter::kBicubic)->Taps(), 2u * 6 + 1);
+}
+
+TEST(ImageTransformTest, TilesAndPatches) {
+  const int64_t height = 30, width = 47;
+  const size_t stride = static_cast<size_t>(width) * 3;
+  auto image = RandomImage(height, width, stride);
+  ImageTransformOptions options;
+  options.mean = {0.5f, 0.5f, 0.5f};
+  options.swap_rb = true;
+  // the grid of 2 x 3 tiles of 8, the planes of which are the ones of the resize into 16 x 24
+  const std::array<int64_t, 2> resized{16, 24};
+  std::vector<float> planes(3 * 16 * 24);
+  TransformImage(image.data(), height, width, stride, resized, options, planes.data(), 1);
+  auto plane = [&](int64_t c, int64_t y, int64_t x) { return planes[(c * 16 + y) * 24 + x]; };
+
+  options.tile_size = 8;
+  std::vector<float> tiles(planes.size());
+  TransformImage(image.data(), height, width, stride, resized, options, tiles.data(), 2);
+  options.patch_size = 4;
+  std::vector<float> patches(planes.size());
+  TransformImage(image.data(), height, width, stride, resized, options, patches.data(), 1);
+  for (int64_t c = 0; c < 3; ++c) {
+    for (int64_t y = 0; y < 16; ++y) {
+      for (int64_t x = 0; x < 24; ++x) {
+        const int64_t tile = y / 8 * 3 + x / 8;
+        ASSERT_EQ(tiles[((tile * 3 + c) * 8 + y % 8) * 8 + x % 8], plane(c, y, x));
+        // the patches of [4, 3 * 4 * 4] of every tile
+        const int64_t patch = tile * 4 + y % 8 / 4 * 2 + x % 8 / 4;
+        ASSERT_EQ(patches[((patch * 3 + c) * 4 + y % 4) * 4 + x % 4], plane(c, y, x));
+      }
+    }
+  }
+
+  // the patches of the letterbox without tiles, with its padding
+  options.tile_size = 0;
+  options.patch_size = 8;
+  options.letterbox = {32, 32};
+  std::vector<float> letterbox(3 * 32 * 32, -1.0f);
+  TransformImage(image.data(), height, width, stride, options, letterbox.data(), 1);
+  options.patch_size = 0;
+  std::vector<float> letterbox_planes(letterbox.size());
+  TransformImage(image.data(), height, width, stride, options, letterbox_planes.data(), 1);
+  for (int64_t c = 0; c < 3; ++c) {
+    for (int64_t y = 0; y < 32; ++y) {
+      for (int64_t x = 0; x < 32; ++x) {
+        const int64_t patch = y / 8 * 4 + x / 8;
+        ASSERT_EQ(letterbox[((patch * 3 + c) * 8 + y % 8) * 8 + x % 8], letterbox_planes[(c * 32 + y) * 32 + x]);
+      }
+    }
+  }
+
+  options.patch_size = 5;
+  EXPECT_ANY_THROW(TransformImage(image.data(), height, width, stride, options, letterbox.data(), 1));
+}
+
+TEST(ImageTransformTest, SelectTileGrid) {
+  // the closest aspect ratio of 5:4 of at most 12 tiles is 4:3
+  EXPECT_EQ(SelectTileGrid(800, 1000, 448, 1, 12), (std::array<int64_t, 2>{3, 4}));
+  EXPECT_EQ(SelectTileGrid(1000, 400, 448, 1, 12), (std::array<int64_t, 2>{5, 2}));
+  // the grids of the same ratio of a square image, the largest whose tiles have twice as few pixels as the image
+  EXPECT_EQ(SelectTileGrid(100, 100, 448, 1, 12), (std::array<int64_t, 2>{1, 1}));
+  EXPECT_EQ(SelectTileGrid(2000, 2000, 448, 1, 12), (std::array<int64_t, 2>{3, 3}));
+  // the square grid of at least 2 tiles
+  EXPECT_EQ(SelectTileGrid(100, 100, 448, 2, 12), (std::array<int64_t, 2>{2, 2}));
+}
+
+TEST(ImageTransformTest, FloatToHalf) {
+  EXPECT_EQ(detail::FloatToHalf(1.0f), 0x3c00);
+  EXPECT_EQ(detail::FloatToHalf(-2.0f), 0xc000);
+  EXPECT_EQ(detail::FloatToHalf(0.0f), 0x0000);
+  EXPECT_EQ(detail::FloatToHalf(65504.0f), 0x7bff);
+  // rounds to the infinity
+  EXPECT_EQ(detail::FloatToHalf(65520.0f), 0x7c00);
+  // the smallest subnormal, and its half, which rounds to the even 0
+  EXPECT_EQ(detail::FloatToHalf(std::ldexp(1.0f, -24)), 0x0001);
+  EXPECT_EQ(detail::FloatToHalf(std::ldexp(1.0f, -25)), 0x0000);
+  // the halfway values round to the even
+  EXPECT_EQ(detail::FloatToHalf(1.0f + std::ldexp(1.0f, -11)), 0x3c00);
+  EXPECT_EQ(detail::FloatToHalf(1.0f + 3 * std::ldexp(1.0f, -11)), 0x3c02);
+}
+
+TEST(ImageTransformTest, OutputTypes) {
+  const int64_t height = 21, width = 34;
+  const size_t stride = static_cast<size_t>(width) * 3;
+  auto image = RandomImage(height, width, stride);
+  ImageTransformOptions options;
+  options.resize_to = {16, 16};
+  options.crop = {12, 16};
+  options.mean = {0.485f, 0.456f, 0.406f};
+  options.std = {0.229f, 0.224f, 0.225f};
+  std::vector<float> expected(3 * 12 * 16);
+  TransformImage(image.data(), height, width, stride, options, expected.data(), 1);
+
+  std::vector<ortc::MFloat16> halves(expected.size());
+  TransformImage(image.data(), height, width, stride, options, halves.data(), 2);
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(halves[i].value, detail::FloatToHalf(expected[i]));
+  }
+
+  // the quantized outputs, to which the scale and the zero point are folded into the normalization
+  options.output_scale = 0.02f;
+  options.output_zero_point = 128;
+  std::vector<uint8_t> quantized(expected.size());
+  TransformImage(image.data(), height, width, stride, options, quantized.data(), 1);
+  options.output_zero_point = -3;
+  std::vector<int8_t> signed_quantized(expected.size());
+  TransformImage(image.data(), height, width, stride, options, signed_quantized.data(), 1);
+  for (size_t i = 0; i < expected.size(); ++i) {
+    const float value = expected[i] / 0.02f;
+    ASSERT_NEAR(quantized[i], std::min(std::max(std::nearbyint(value) + 128, 0.0f), 255.0f), 1);
+    ASSERT_NEAR(signed_quantized[i], std::min(std::max(std::nearbyint(value) - 3, -128.0f), 127.0f), 1);
+  }
+
+  // the uint8 pixels of the resize, unnormalized
+  options = ImageTransformOptions{};
+  options.rescale = 1.0f;
+  std::vector<uint8_t> pixels(3 * height * width);
+  TransformImage(image.data(), height, width, stride, options, pixels.data(), 1);
+  for (int64_t y = 0; y < height; ++y) {
+    for (int64_t x = 0; x < width; ++x) {
+      ASSERT_EQ(pixels[(y * width) + x], image[y * stride + x * 3]);
+    }
+  }
+}
@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "math/logits_processor.hpp"
+
+#include <cmath>
+#include <vector>
+
+TEST(LogitsProcessor, PenaltiesBeforeTheTemperature) {
+  const std::vector<float> logits = {2.0f, -2.0f, 4.0f, 1.0f};
+  LogitsProcessing options;
+  options.temperature = 2.0f;
+  options.repetition_penalty = 2.0f;
+  options.presence_penalty = 0.5f;
+  options.frequency_penalty = 0.25f;
+  LogitsProcessingScratch scratch;
+  std::vector<float> output(logits.size());
+
+  // 0 is generated twice and 1 once, and the padding and the ids out of the vocabulary are skipped
+  const std::vector<int64_t> ids = {0, -1, 1, 0, 9};
+  ProcessLogits(logits.data(), logits.size(), ids.data(), ids.size(), options, scratch, output.data());
+  EXPECT_FLOAT_EQ(output[0], (2.0f / 2 - 0.5f - 0.5f) / 2);
+  EXPECT_FLOAT_EQ(output[1], (-2.0f * 2 - 0.5f - 0.25f) / 2);
+  EXPECT_FLOAT_EQ(output[2], 2.0f);
+  EXPECT_FLOAT_EQ(output[3], 0.5f);
+
+  // in place, without any generated ids
+  std::vector<float> in_place = logits;
+  ProcessLogits(in_place.data(), in_place.size(), nullptr, 0, options, scratch, in_place.data());
+  EXPECT_EQ(in_place, (std::vector<float>{1.0f, -1.0f, 2.0f, 0.5f}));
+}
+
+TEST(LogitsProcessor, Masks) {
+  const std::vector<float> logits = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+  LogitsProcessing options;
+  options.min_length = 3;
+  options.eos_token_ids = {4};
+  options.banned_ids = {0};
+  options.bad_word_sequences = {{1, 2}, {2, 1, 3}};
+  LogitsProcessingScratch scratch;
+  std::vector<float> output(logits.size());
+
+  // the eos is masked until three ids, and 2 after a 1, but 3 isn't after the 1 of a 3
+  std::vector<int64_t> ids = {3, 1};
+  ProcessLogits(logits.data(), logits.size(), ids.data(), ids.size(), options, scratch, output.data());
+  EXPECT_EQ(output, (std::vector<float>{-INFINITY, 2.0f, -INFINITY, 4.0f, -INFINITY}));
+
+  ids = {2, -1, 1, 7};
+  ProcessLogits(logits.data(), logits.size(), ids.data(), ids.size(), options, scratch, output.data());
+  EXPECT_EQ(output, (std::vector<float>{-INFINITY, 2.0f, 3.0f, 4.0f, 5.0f}));
+
+  ids = {2, 1};
+  ProcessLogits(logits.data(), logits.size(), ids.data(), ids.size(), options, scratch, output.data());
+  EXPECT_EQ(output, (std::vector<float>{-INFINITY, 2.0f, -INFINITY, -INFINITY, -INFINITY}));
+}
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "math/logits_sampler.hpp"
+
+#include <cmath>
+#include <vector>
+
+TEST(LogitsSampler, GreedyWithRepetitionPenalty) {
+  std::vector<float> logits = {1.0f, 4.0f, 3.0f, -2.0f};
+  SamplingOptions options;
+  options.temperature = 0;
+  SamplingScratch scratch;
+  EXPECT_EQ(SampleLogits(logits.data(), logits.size(), nullptr, 0, options, 0.5, scratch), 1);
+
+  // 4 / 2 is less than 3, and a repeated id is penalized once
+  options.repetition_penalty = 2.0f;
+  std::vector<int64_t> seen = {1, 1, -1, 7};
+  EXPECT_EQ(SampleLogits(logits.data(), logits.size(), seen.data(), seen.size(), options, 0.5, scratch), 2);
+  // the bits of the seen ids don't carry over to the next row
+  EXPECT_EQ(SampleLogits(logits.data(), logits.size(), nullptr, 0, options, 0.5, scratch), 1);
+}
+
+TEST(LogitsSampler, FollowsTheSoftmax) {
+  std::vector<float> logits = {0.0f, std::log(3.0f), std::log(6.0f)};
+  SamplingOptions options;
+  SamplingScratch scratch;
+  std::vector<int> counts(3, 0);
+  const int n = 1000;
+  for (int i = 0; i < n; ++i) {
+    ++counts[SampleLogits(logits.data(), logits.size(), nullptr, 0, options, (i + 0.5) / n, scratch)];
+  }
+
+  EXPECT_EQ(counts[0], 100);
+  EXPECT_EQ(counts[1], 300);
+  EXPECT_EQ(counts[2], 600);
+}
+
+TEST(LogitsSampler, TopKAndTopP) {
+  std::vector<float> logits(1000);
+  for (size_t i = 0; i < logits.size(); ++i) {
+    logits[i] = static_cast<float>((i * 7919) % 1000) / 100.0f;
+  }
+
+  SamplingScratch scratch;
+  SamplingOptions top_k;
+  top_k.top_k = 5;
+  for (int i = 0; i < 100; ++i) {
+    const int64_t id = SampleLogits(logits.data(), logits.size(), nullptr, 0, top_k, i / 100.0, scratch);
+    EXPECT_GE(logits[id], 9.95f);
+  }
+
+  // the weights of the logits from 9.99 down by 0.01 are the powers of exp(-0.01), 200 of them holding most of
+  // the mass, which needs the sorted blocks of 64, 128 and 256
+  SamplingOptions top_p;
+  top_p.top_p = 0.86f;
+  float lowest = 100;
+  for (int i = 0; i < 1000; ++i) {
+    const int64_t id = SampleLogits(logits.data(), logits.size(), nullptr, 0, top_p, i / 1000.0, scratch);
+    lowest = std::min(lowest, logits[id]);
+  }
+
+  EXPECT_NEAR(lowest, 9.99f - 0.01f * 196, 0.015f);
+}
@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "ustring.h"
+#include "tokenizer/question_answering.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+TEST(QuestionAnswering, MatchesTheGridOfAllSpans) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> logit(-5.0f, 5.0f);
+  for (int trial = 0; trial < 50; ++trial) {
+    const size_t seq_len = 5 + trial * 3;
+    const size_t max_length = 1 + trial % 7;
+    const size_t n_best = 1 + trial % 4;
+    std::vector<float> start(seq_len), end(seq_len);
+    std::vector<bool> is_context(seq_len);
+    for (size_t t = 0; t < seq_len; ++t) {
+      start[t] = logit(rng);
+      end[t] = logit(rng);
+      is_context[t] = t > 3 && t + 1 < seq_len && rng() % 8 != 0;
+    }
+
+    std::vector<float> expected;
+    for (size_t s = 0; s < seq_len; ++s) {
+      for (size_t e = s; e < seq_len && e < s + max_length; ++e) {
+        if (is_context[s] && is_context[e]) {
+          expected.push_back(start[s] + end[e]);
+        }
+      }
+    }
+    std::sort(expected.begin(), expected.end(), std::greater<float>());
+    expected.resize(std::min(expected.size(), n_best));
+
+    std::vector<AnswerSpan> answers;
+    FindBestAnswers(start.data(), end.data(), is_context, max_length, n_best, answers);
+    ASSERT_EQ(answers.size(), expected.size());
+    for (size_t i = 0; i < answers.size(); ++i) {
+      EXPECT_EQ(answers[i].score, expected[i]);
+      EXPECT_LE(answers[i].start, answers[i].end);
+      EXPECT_LT(answers[i].end - answers[i].start, max_length);
+      EXPECT_TRUE(is_context[answers[i].start] && is_context[answers[i].end]);
+      EXPECT_EQ(answers[i].score, start[answers[i].start] + end[answers[i].end]);
+    }
+  }
+}
+
+TEST(QuestionAnswering, AdvancesByCharacters) {
+  // "the café in Zürich", of which é and ü are two bytes
+  const std::string text = "the caf\xC3\xA9 in Z\xC3\xBCrich";
+  EXPECT_EQ(ustring::AdvanceUTF8Chars(text, 0, 4), 4u);
+  EXPECT_EQ(ustring::AdvanceUTF8Chars(text, 4, 4), 9u);
+  EXPECT_EQ(text.substr(13, ustring::AdvanceUTF8Chars(text, 13, 6) - 13), "Z\xC3\xBCrich");
+  EXPECT_EQ(ustring::AdvanceUTF8Chars(text, 0, 100), text.size());
+}
@@ -5,6 +5,7 @@
 #include "audio/sampling.h"
 #include <vector>
 #include <cmath>
+#include <algorithm>
 
 // The expected test result was generated by the following Python library
 // b, a = scipy.signal.butter(4, 8000/(441000/2), btype='low', analog=False)
@@ -42,3 +43,170 @@ TEST(ButterworthLowpassTest, FilterTest) {
     EXPECT_NEAR(expected[i], actual[i], 1e-05);
   }
 }
+
+TEST(ButterworthLowpassTest, MultiChannelTest) {
+  const size_t channels = 3, frames = 5000;
+  std::vector<float> interleaved(channels * frames);
+  std::vector<std::vector<float>> planar(channels, std::vector<float>(frames));
+  for (size_t i = 0; i < frames; ++i) {
+    for (size_t c = 0; c < channels; ++c) {
+      planar[c][i] = static_cast<float>(std::sin(i * 0.01 * (c + 1)) + 0.3 * std::cos(i * 2.5 + c));
+      interleaved[i * channels + c] = planar[c][i];
+    }
+  }
+
+  // the cascade of the sections against the direct form of the polynomials of the 4th order
+  ButterworthLowpass mono(8000, 44100);
+  auto b = mono.GetCoefs_B();
+  auto a = mono.GetCoefs_A();
+  std::vector<double> x(5), y(5);
+  std::vector<float> cascade = mono.Process(planar[0]);
+  for (size_t i = 0; i < frames; ++i) {
+    std::rotate(x.rbegin(), x.rbegin() + 1, x.rend());
+    std::rotate(y.rbegin(), y.rbegin() + 1, y.rend());
+    x[0] = planar[0][i];
+    y[0] = 0.0;
+    for (size_t k = 0; k < 5; ++k) {
+      y[0] += b[k] * x[k] - (k > 0 ? a[k] * y[k] : 0.0);
+    }
+    ASSERT_NEAR(cascade[i], y[0], 1e-5) << i;
+  }
+
+  // the lanes of the channels in the blocks of any size, against every channel alone
+  ButterworthLowpass filter(8000, 44100, channels);
+  for (size_t begin = 0, block = 1; begin < frames; begin += block, block = block * 3 + 1) {
+    size_t size = std::min(block, frames - begin) * channels;
+    filter.ProcessBlock(interleaved.data() + begin * channels, size);
+  }
+  for (size_t c = 0; c < channels; ++c) {
+    std::vector<float> expected = mono.Process(planar[c]);
+    for (size_t i = 0; i < frames; ++i) {
+      ASSERT_NEAR(interleaved[i * channels + c], expected[i], 1e-6) << c << " " << i;
+    }
+  }
+}
+
+// the windowed sinc interpolation evaluated directly at every output sample
+static std::vector<float> ReferenceResample(const std::vector<float>& input, double in_rate, double out_rate) {
+  const double beta = 6.0;
+  auto bessel_i0 = [](double x) {
+    double sum = 0.0, term = 1.0;
+    for (int n = 1; term > 1e-8 * sum; ++n) {
+      sum += term;
+      term *= x * x / 4.0 / (n * n);
+    }
+    return sum;
+  };
+
+  float factor = static_cast<float>(out_rate / in_rate);
+  int range = static_cast<int>(std::ceil(beta / (2.0 * factor)));
+  std::vector<float> output(static_cast<size_t>(std::ceil(static_cast<float>(input.size()) * factor)));
+  for (size_t i = 0; i < output.size(); ++i) {
+    double index = i * in_rate / out_rate;
+    int start = std::max(0, static_cast<int>(index) - range);
+    int end = std::min(static_cast<int>(input.size()) - 1, static_cast<int>(index) + range);
+    double value = 0.0;
+    for (int j = start; j <= end; ++j) {
+      double x = end > start ? 2.0 * (j - start) / (end - start) - 1.0 : 0.0;
+      double window = bessel_i0(beta * std::sqrt(1 - x * x)) / bessel_i0(beta);
+      double distance = std::abs(j - index);
+      value += input[j] * window * (distance < 1e-6 ? 1.0 : std::sin(M_PI * distance) / (M_PI * distance));
+    }
+    output[i] = static_cast<float>(value);
+  }
+  return output;
+}
+
+TEST(KaiserWindowInterpolationTest, ResampleTest) {
+  std::vector<float> signal(4410);
+  for (size_t i = 0; i < signal.size(); ++i) {
+    signal[i] = static_cast<float>(std::sin(i * 0.05) + 0.25 * std::cos(i * 0.31));
+  }
+
+  // the polyphase filter banks, and the rates of no small ratio which are interpolated sample by sample
+  for (auto [in_rate, out_rate] : {std::pair<float, float>{44100, 16000}, {22050, 16000}, {48000, 16000}, {44100, 16001}}) {
+    std::vector<float> expected = ReferenceResample(signal, in_rate, out_rate);
+    for (int round = 0; round < 2; ++round) {  // the second round uses the cached filter bank
+      std::vector<float> actual;
+      KaiserWindowInterpolation::Process(signal, actual, in_rate, out_rate);
+      ASSERT_EQ(actual.size(), expected.size());
+      for (size_t i = 0; i < actual.size(); ++i) {
+        ASSERT_NEAR(expected[i], actual[i], 1e-5) << in_rate << " to " << out_rate << " at " << i;
+      }
+    }
+  }
+}
+
+TEST(KaiserWindowInterpolationTest, StreamTest) {
+  std::vector<float> signal(20000);
+  for (size_t i = 0; i < signal.size(); ++i) {
+    signal[i] = static_cast<float>(std::sin(i * 0.02) + 0.5 * std::sin(i * 0.7));
+  }
+
+  for (auto [in_rate, out_rate] : {std::pair<float, float>{44100, 16000}, {44100, 16001}}) {
+    ButterworthLowpass whole_filter(0.5 * out_rate, in_rate);
+    std::vector<float> expected;
+    KaiserWindowInterpolation::Process(whole_filter.Process(signal), expected, in_rate, out_rate);
+
+    // the blocks of the stream are filtered and resampled one by one, in blocks of a few sizes
+    ButterworthLowpass filter(0.5 * out_rate, in_rate);
+    KaiserWindowInterpolation resampler(in_rate, out_rate);
+    std::vector<float> actual;
+    std::vector<float> block;
+    size_t block_sizes[] = {1, 7, 100, 4096, 3};
+    for (size_t pos = 0, n = 0; pos < signal.size(); pos += block.size(), ++n) {
+      size_t size = std::min(block_sizes[n % 5], signal.size() - pos);
+      block.assign(signal.begin() + pos, signal.begin() + pos + size);
+      filter.ProcessBlock(block.data(), block.size());
+      resampler.Push(block.data(), block.size(), actual);
+    }
+    resampler.Finish(actual);
+
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+TEST(ChannelMixerTest, MixTest) {
+  for (size_t channels : {2, 6}) {
+    std::vector<float> frames(channels * 103);
+    for (size_t i = 0; i < frames.size(); ++i) {
+      frames[i] = static_cast<float>(std::sin(i * 0.3));
+    }
+
+    std::vector<float> weights(channels);
+    for (size_t c = 0; c < channels; ++c) {
+      weights[c] = 0.1f * (c + 1);
+    }
+    for (const auto& mix_weights : {std::vector<float>(channels, 1.0f / channels), weights}) {
+      ChannelMixer mixer(channels, mix_weights);
+      std::vector<float> mono(frames);
+      mixer.Mix(mono.data(), frames.size() / channels, mono.data());  // in place of the frames
+      for (size_t i = 0; i < frames.size() / channels; ++i) {
+        double expected = 0.0;
+        for (size_t c = 0; c < channels; ++c) {
+          expected += frames[i * channels + c] * mix_weights[c];
+        }
+        ASSERT_NEAR(expected, mono[i], 1e-6);
+        ASSERT_NEAR(expected, mixer.MixFrame(frames.data() + i * channels), 1e-6);
+      }
+    }
+
+    // the default weights average the channels
+    ChannelMixer average(channels);
+    ChannelMixer explicit_average(channels, std::vector<float>(channels, 1.0f / channels));
+    for (size_t i = 0; i < frames.size() / channels; ++i) {
+      ASSERT_EQ(average.MixFrame(frames.data() + i * channels), explicit_average.MixFrame(frames.data() + i * channels));
+    }
+
+    // the mix fused into the filter is the same as the filter of the mix
+    std::vector<float> mono(frames.size() / channels);
+    average.Mix(frames.data(), mono.size(), mono.data());
+    ButterworthLowpass filter(8000, 44100);
+    std::vector<float> expected = filter.Process(mono);
+    std::vector<float> fused(frames);
+    filter.Reset();
+    filter.ProcessBlock([&](size_t i) { return average.MixFrame(fused.data() + i * channels); }, fused.data(), mono.size());
+    fused.resize(mono.size());
+    EXPECT_EQ(fused, expected);
+  }
+}
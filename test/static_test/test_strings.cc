@@ -5,8 +5,11 @@
 #include "string_utils.h"
 #ifdef ENABLE_RE2_REGEX
 #include "text/re2_strings/string_regex_split_re.hpp"
+#include "text/re2_strings/re2_pattern_cache.hpp"
 #endif
 #include "text/string_ecmaregex_split.hpp"
+#include "text/string_ecmaregex_cache.hpp"
+#include "text/string_multi_replace.hpp"
 
 TEST(strings, std_regex_test) {
   std::regex regex("[\u2700-\u27bf\U0001f650-\U0001f67f\U0001f600-\U0001f64f\u2600-\u26ff"
@@ -51,8 +54,74 @@ TEST(strings, regex_split_skip) {
   EXPECT_EQ(expected_begin_offsets, begin_offsets);
   EXPECT_EQ(expected_end_offsets, end_offsets);
 }
+
+TEST(strings, re2_pattern_cache) {
+  Re2PatternCache patterns(2);
+  auto reg = patterns.Get("(\\s)");
+  EXPECT_TRUE(reg->ok());
+  EXPECT_EQ(reg.get(), patterns.Get(std::string("(\\s)")).get());
+
+  patterns.Get("a");
+  patterns.Get("b");
+  // the least recently used pattern is compiled again, and the previous object stays valid for its users.
+  auto recompiled = patterns.Get("(\\s)");
+  EXPECT_NE(reg.get(), recompiled.get());
+  EXPECT_TRUE(re2::RE2::PartialMatch("hello world", *reg));
+}
+
+TEST(strings, ecma_regex_to_re2) {
+  std::string re2_pattern;
+  EXPECT_TRUE(EcmaPatternToRe2("a.\\s[.\\s]", re2_pattern));
+  EXPECT_EQ(re2_pattern, "a[^\\n\\r][\\t\\n\\v\\f\\r ][.\\t\\n\\v\\f\\r ]");
+  EXPECT_FALSE(EcmaPatternToRe2("(a)\\1", re2_pattern));
+  EXPECT_FALSE(EcmaPatternToRe2("[^]", re2_pattern));
+
+  std::string rewrite;
+  EXPECT_TRUE(EcmaFormatToRe2Rewrite("$$[$&]$1\\", rewrite));
+  EXPECT_EQ(rewrite, "$[\\0]\\1\\\\");
+  EXPECT_FALSE(EcmaFormatToRe2Rewrite("$`", rewrite));
+
+  EcmaRe2Cache regexes;
+  ASSERT_NE(regexes.Get("b.", true), nullptr);
+  EXPECT_TRUE(re2::RE2::PartialMatch("aBc", *regexes.Get("b.", true)));
+  // std::regex and RE2 step over the empty matches differently
+  EXPECT_EQ(regexes.Get("x*", false), nullptr);
+  EXPECT_EQ(regexes.Get("(?=a)", false), nullptr);
+}
+
+TEST(strings, ecma_regex_re2_ignore_case) {
+  // RE2 would fold the Latin-1 letters, and the bytes of the UTF-8 of é are C3 A9, of which
+  // C3 (Ã) folds to E3 (ã), so only the ASCII patterns which ignore the case are on RE2.
+  EcmaRe2Cache regexes;
+  EXPECT_EQ(regexes.Get("caf\xc3\xa9", true), nullptr);
+  EXPECT_EQ(regexes.Get("\\xe9", true), nullptr);
+  EXPECT_NE(regexes.Get("caf\xc3\xa9", false), nullptr);
+  EXPECT_NE(regexes.Get("\\\\x", true), nullptr);
+
+  // both of the back ends agree on the texts with the Latin-1 and the UTF-8 bytes
+  const auto flags = std::regex_constants::ECMAScript | std::regex_constants::icase;
+  for (std::string pattern : {"caf.", "[a-z]+", "ab[^c]"}) {
+    auto re2_reg = regexes.Get(pattern, true);
+    ASSERT_NE(re2_reg, nullptr);
+    std::regex std_reg(pattern, flags);
+    for (std::string text : {"CAF\xc3\x89", "caf\xc3\xa9", "\xe3\xa9AB\xc3", "Ab\xe9", "\xc9\xe9"}) {
+      EXPECT_EQ(re2::RE2::PartialMatch(text, *re2_reg), std::regex_search(text, std_reg)) << pattern << text;
+    }
+  }
+}
+
 #endif
 
+TEST(strings, ecma_regex_cache) {
+  EcmaRegexCache regexes;
+  auto reg = regexes.Get("a+", std::regex_constants::ECMAScript);
+  EXPECT_EQ(reg, regexes.Get("a+", std::regex_constants::ECMAScript));
+  auto icase_reg = regexes.Get("a+", std::regex_constants::ECMAScript | std::regex_constants::icase);
+  EXPECT_NE(reg, icase_reg);
+  EXPECT_FALSE(std::regex_search("bAA", *reg));
+  EXPECT_TRUE(std::regex_search("bAA", *icase_reg));
+}
+
 TEST(strings, regex_split_no_matched) {
   std::string input = "helloworld";
   std::regex reg("(\\s)");
@@ -84,3 +153,46 @@ TEST(strings, regex_split_begin_end_delim) {
   EXPECT_EQ(expected_begin_offsets, begin_offsets);
   EXPECT_EQ(expected_end_offsets, end_offsets);
 }
+
+TEST(strings, multi_replace) {
+  MultiReplacer replacer;
+  replacer.Build({{"he", "HE"}, {"hello", "hi"}, {"lo", ""}, {"o w", "_"}, {"he", "He"}});
+  // the longest pattern of a begin wins, and the duplicated one has its last replacement
+  EXPECT_EQ(replacer.Replace("hello world"), "hi world");
+  EXPECT_EQ(replacer.Replace("help below"), "Help bew");
+  EXPECT_EQ(replacer.Replace("halo wall"), "ha wall");
+  EXPECT_EQ(replacer.Replace("also wall"), "als_all");
+  EXPECT_EQ(replacer.Replace(""), "");
+  EXPECT_EQ(replacer.Replace("xyz"), "xyz");
+
+  // the same as replacing the leftmost longest occurrence and going on after it
+  std::vector<std::pair<std::string, std::string>> table{{"a", "1"}, {"ab", "22"}, {"bab", ""}, {"ba", "x"}};
+  std::vector<std::pair<std::string_view, std::string_view>> views(table.begin(), table.end());
+  replacer.Build(views);
+  auto naive = [&](std::string_view text) {
+    std::string result;
+    for (size_t pos = 0; pos < text.size();) {
+      const std::pair<std::string, std::string>* best = nullptr;
+      for (const auto& entry : table) {
+        if (text.substr(pos, entry.first.size()) == entry.first &&
+            (best == nullptr || best->first.size() < entry.first.size())) {
+          best = &entry;
+        }
+      }
+      if (best == nullptr) {
+        result += text[pos++];
+      } else {
+        result += best->second;
+        pos += best->first.size();
+      }
+    }
+    return result;
+  };
+  std::string text;
+  for (unsigned seed = 1; text.size() < 200; seed = seed * 1103515245 + 12345) {
+    text += "abc"[(seed >> 16) % 3];
+    EXPECT_EQ(replacer.Replace(text), naive(text)) << text;
+  }
+
+  EXPECT_THROW(replacer.Build({{"", "x"}}), std::exception);
+}
@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "tokenizer/token_classification.hpp"
+
+#include <vector>
+
+TEST(TokenClassification, MergesBioSpans) {
+  EntityLabels labels({"O", "B-PER", "I-PER", "B-LOC", "I-LOC"});
+  ASSERT_EQ(labels.size(), 5u);
+
+  // [CLS] John Smith visited New York [SEP], and a "##s" piece of York labeled as a new location
+  const std::vector<size_t> argmax = {1, 1, 2, 0, 3, 4, 3, 0};
+  const std::vector<int64_t> offsets = {0, 0, 0, 4, 5, 10, 11, 18, 19, 22, 23, 27, 27, 28, 0, 0};
+  std::vector<float> logits(argmax.size() * 5, 0.0f);
+  for (size_t t = 0; t < argmax.size(); ++t) {
+    logits[t * 5 + argmax[t]] = 10.0f;
+  }
+
+  std::vector<EntitySpan> spans;
+  labels.DecodeSpans(logits.data(), offsets.data(), argmax.size(), 0.5f, spans);
+  ASSERT_EQ(spans.size(), 3u);
+  EXPECT_EQ(labels.TypeName(spans[0].type), "PER");
+  EXPECT_EQ(spans[0].begin, 0);
+  EXPECT_EQ(spans[0].end, 10);
+  EXPECT_NEAR(spans[0].score, 1.0f, 1e-3f);
+  EXPECT_EQ(labels.TypeName(spans[1].type), "LOC");
+  EXPECT_EQ(spans[1].begin, 19);
+  EXPECT_EQ(spans[1].end, 27);
+  EXPECT_EQ(spans[2].begin, 27);
+  EXPECT_EQ(spans[2].end, 28);
+
+  // the spans under the threshold are dropped
+  logits[6 * 5 + 3] = 0.1f;
+  spans.clear();
+  labels.DecodeSpans(logits.data(), offsets.data(), argmax.size(), 0.5f, spans);
+  ASSERT_EQ(spans.size(), 2u);
+}
+
+TEST(TokenClassification, LabelsWithoutPrefix) {
+  EntityLabels labels({"O", "PER", "B-PER"});
+  const std::vector<size_t> argmax = {1, 1, 2, 1};
+  const std::vector<int64_t> offsets = {0, 1, 2, 3, 4, 5, 6, 7};
+  std::vector<float> logits(argmax.size() * 3, 0.0f);
+  for (size_t t = 0; t < argmax.size(); ++t) {
+    logits[t * 3 + argmax[t]] = 10.0f;
+  }
+
+  std::vector<EntitySpan> spans;
+  labels.DecodeSpans(logits.data(), offsets.data(), argmax.size(), 0.0f, spans);
+  ASSERT_EQ(spans.size(), 2u);
+  EXPECT_EQ(spans[0].type, spans[1].type);
+  EXPECT_EQ(spans[0].end, 3);
+  EXPECT_EQ(spans[1].begin, 4);
+  EXPECT_EQ(spans[1].end, 7);
+}
@@ -5,6 +5,10 @@
 #include "string_utils.h"
 #include "wordpiece_tokenizer.hpp"
 #include "bert_tokenizer.hpp"
+#include "trie_tokenizer.hpp"
+#include "token_windows.hpp"
+#include "padded_length.hpp"
+#include "output_dtype.hpp"
 
 #include <clocale>
 
@@ -153,6 +157,173 @@ TEST(tokenizer, bert_wordpiece_tokenizer_rows) {
   EXPECT_EQ(rows, std::vector<int64_t>({0, 5, 7}));
 }
 
+TEST(tokenizer, wordpiece_trie) {
+  std::unordered_map<std::u32string, int32_t> vocab = {
+      {U"a", 0}, {U"ab", 1}, {U"abcd", 2}, {U"##b", 3}, {U"##bc", 4}, {U"##c", 5}, {U"##", 6}, {U"#", 7}};
+  WordpieceTrie trie;
+  trie.Build(vocab, U"##");
+
+  // the ids of the pieces, and -1 for the part of the word which isn't in the vocabulary
+  auto tokenize = [&trie](const std::u32string& word) {
+    std::vector<int32_t> pieces;
+    bool is_found = trie.Tokenize(word, pieces);
+    std::vector<int32_t> ids;
+    for (int32_t piece : pieces) {
+      ids.push_back(trie.GetPiece(piece).id);
+    }
+    if (!is_found) {
+      ids.push_back(-1);
+    }
+    return ids;
+  };
+
+  EXPECT_EQ(tokenize(U"abcd"), std::vector<int32_t>({2}));
+  // the longest match "abcd" fails, so "ab" is popped and "c" goes on from the suffix root.
+  EXPECT_EQ(tokenize(U"abc"), std::vector<int32_t>({1, 5}));
+  EXPECT_EQ(tokenize(U"abbc"), std::vector<int32_t>({1, 4}));
+  EXPECT_EQ(tokenize(U"abce"), std::vector<int32_t>({1, 5, -1}));
+  EXPECT_EQ(tokenize(U"b"), std::vector<int32_t>({-1}));
+  // a suffix token matches the start of a word as its whole string.
+  EXPECT_EQ(tokenize(U"##bc"), std::vector<int32_t>({4}));
+  EXPECT_EQ(tokenize(U"#a"), std::vector<int32_t>({7, -1}));
+  EXPECT_EQ(tokenize(U"##a"), std::vector<int32_t>({6, -1}));
+  EXPECT_EQ(tokenize(U"ab##"), std::vector<int32_t>({1, -1}));
+  EXPECT_EQ(tokenize(U""), std::vector<int32_t>());
+}
+
+TEST(tokenizer, bert_tokenizer_encode_text) {
+  std::string vocab = "[UNK]\n[CLS]\n[SEP]\n[PAD]\n[MASK]\nwant\n##want\n##ed\nwa\nun\nrunn\n##ing\n,\nlow\nlowest\n";
+  for (bool do_basic_tokenize : {true, false}) {
+    BertTokenizer tokenizer(vocab, true, do_basic_tokenize, ustring("[UNK]"), ustring("[SEP]"), ustring("[PAD]"),
+                            ustring("[CLS]"), ustring("[MASK]"), true, true, ustring("##"), -1, "longest_first");
+    for (std::string text : {"UNwant\u00E9d,running", " unwanted  lowest low,er ", "", "\u4E2D want",
+                             "RUNNING unwanted, lowest wanted low\u4E2D\u00C9running want  unwanted,lowest"}) {
+      // the text is encoded in one pass with the same ids
+      std::vector<int64_t> expected = tokenizer.Encode(tokenizer.Tokenize(ustring(text)));
+      std::vector<int64_t> offsets;
+      EXPECT_EQ(tokenizer.Encode(std::string_view(text), &offsets), expected);
+      EXPECT_EQ(offsets.size(), expected.size() * 2);
+      EXPECT_EQ(tokenizer.Encode(std::string_view(text)), expected);
+    }
+  }
+}
+
+TEST(tokenizer, bert_tokenizer_offsets) {
+  std::string vocab = "[UNK]\n[CLS]\n[SEP]\n[PAD]\n[MASK]\nwant\n##want\n##ed\nwa\nun\nrunn\n##ing\n,\nlow\nlowest\n";
+  BertTokenizer tokenizer(vocab, true, true, ustring("[UNK]"), ustring("[SEP]"), ustring("[PAD]"),
+                          ustring("[CLS]"), ustring("[MASK]"), true, true, ustring("##"), -1, "longest_first");
+
+  // the offsets are the characters of the text, before the accents are stripped
+  std::vector<int64_t> offsets;
+  EXPECT_EQ(tokenizer.Encode("UNwant\u00E9d,running", &offsets), std::vector<int64_t>({9, 6, 7, 12, 10, 11}));
+  EXPECT_EQ(offsets, std::vector<int64_t>({0, 2, 2, 6, 6, 8, 8, 9, 9, 13, 13, 16}));
+
+  // the CJK character is a word, the removed control character is skipped,
+  // and the [UNK] covers the rest of the word after the matched pieces.
+  offsets.clear();
+  EXPECT_EQ(tokenizer.Encode("\u4E2D lowest\u0001x", &offsets), std::vector<int64_t>({0, 14, 0}));
+  EXPECT_EQ(offsets, std::vector<int64_t>({0, 1, 2, 8, 9, 10}));
+
+  BertTokenizer wordpiece_only(vocab, false, false, ustring("[UNK]"), ustring("[SEP]"), ustring("[PAD]"),
+                               ustring("[CLS]"), ustring("[MASK]"), true, true, ustring("##"), -1, "longest_first");
+  offsets.clear();
+  EXPECT_EQ(wordpiece_only.Encode("unwanted running", &offsets), std::vector<int64_t>({9, 6, 7, 10, 11}));
+  EXPECT_EQ(offsets, std::vector<int64_t>({0, 2, 2, 6, 6, 8, 9, 13, 13, 16}));
+}
+
+TEST(tokenizer, bert_tokenizer_max_ids) {
+  std::string vocab = "[UNK]\n[CLS]\n[SEP]\n[PAD]\n[MASK]\nwant\n##want\n##ed\nwa\nun\nrunn\n##ing\n,\nlow\nlowest\n";
+  BertTokenizer tokenizer(vocab, true, true, ustring("[UNK]"), ustring("[SEP]"), ustring("[PAD]"),
+                          ustring("[CLS]"), ustring("[MASK]"), true, true, ustring("##"), 8, "longest_first");
+  EXPECT_EQ(tokenizer.MaxEncodedLength(), 6u);
+
+  std::string text = "RUNNING unwanted, lowest wanted low\u4E2D\u00C9running want  unwanted,lowest";
+  std::vector<int64_t> full_offsets;
+  std::vector<int64_t> full = tokenizer.Encode(std::string_view(text), &full_offsets);
+  for (size_t max_ids : {size_t(0), size_t(1), size_t(2), size_t(5), size_t(6), full.size(), full.size() + 3}) {
+    // the encoding stops at the first max_ids ids of the whole text, with their offsets
+    std::vector<int64_t> offsets;
+    std::vector<int64_t> ids = tokenizer.Encode(std::string_view(text), &offsets, max_ids);
+    const size_t count = std::min(max_ids, full.size());
+    EXPECT_EQ(ids, std::vector<int64_t>(full.begin(), full.begin() + count));
+    EXPECT_EQ(offsets, std::vector<int64_t>(full_offsets.begin(), full_offsets.begin() + 2 * count));
+  }
+
+  std::vector<int64_t> truncated = full;
+  tokenizer.Truncate(truncated);
+  EXPECT_EQ(tokenizer.Encode(std::string_view(text), nullptr, tokenizer.MaxEncodedLength()), truncated);
+}
+
+TEST(tokenizer, token_windows) {
+  const TokenWindows windows{4, 1};
+  EXPECT_EQ(windows.Count(0), 1u);
+  EXPECT_EQ(windows.Count(4), 1u);
+  EXPECT_EQ(windows.Count(5), 2u);
+  EXPECT_EQ(windows.Count(7), 2u);
+  EXPECT_EQ(windows.Count(8), 3u);
+
+  // each window starts with the last id of the one before, and the last one ends at the end
+  std::vector<std::pair<size_t, size_t>> ranges;
+  for (size_t w = 0; w < windows.Count(8); ++w) {
+    ranges.emplace_back(windows.Begin(w), windows.End(w, 8));
+  }
+  EXPECT_EQ(ranges, (std::vector<std::pair<size_t, size_t>>{{0, 4}, {3, 7}, {6, 8}}));
+}
+
+TEST(tokenizer, padded_length) {
+  EXPECT_FALSE(PaddedLength().IsSet());
+  EXPECT_EQ(PaddedLength().Round(13), 13u);
+
+  const PaddedLength multiple(8, {});
+  EXPECT_EQ(multiple.Round(0), 0u);
+  EXPECT_EQ(multiple.Round(1), 8u);
+  EXPECT_EQ(multiple.Round(16), 16u);
+  EXPECT_EQ(multiple.Round(17), 24u);
+
+  // the smallest bucket which holds the length, or the next multiple after the largest one
+  const PaddedLength buckets(64, {128, 32, 64, 32});
+  EXPECT_TRUE(buckets.IsSet());
+  EXPECT_EQ(buckets.Round(5), 32u);
+  EXPECT_EQ(buckets.Round(33), 64u);
+  EXPECT_EQ(buckets.Round(128), 128u);
+  EXPECT_EQ(buckets.Round(129), 192u);
+  EXPECT_EQ(PaddedLength(0, {16}).Round(20), 20u);
+
+  EXPECT_THROW(PaddedLength(-1, {}), std::exception);
+  EXPECT_THROW(PaddedLength(0, {16, 0}), std::exception);
+
+  // the rows of the same length keep their order
+  const std::vector<size_t> lengths{5, 2, 9, 2, 0};
+  std::vector<int64_t> order(lengths.size());
+  WriteLengthOrder(lengths.size(), [&lengths](size_t i) { return lengths[i]; }, order.data());
+  EXPECT_EQ(order, std::vector<int64_t>({4, 1, 3, 0, 2}));
+
+  // the order of the int32 outputs of output_dtype
+  std::vector<int32_t> order32(lengths.size());
+  WriteLengthOrder(lengths.size(), [&lengths](size_t i) { return lengths[i]; }, order32.data());
+  EXPECT_EQ(order32, std::vector<int32_t>({4, 1, 3, 0, 2}));
+}
+
+TEST(tokenizer, output_dtype) {
+  EXPECT_EQ(ToOutputDtype(7), ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64);
+  EXPECT_EQ(ToOutputDtype(6), ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32);
+  EXPECT_THROW(ToOutputDtype(1), std::exception);
+  EXPECT_THROW(ToOutputDtype(0), std::exception);
+}
+
+TEST(tokenizer, char_category) {
+  EXPECT_EQ(GetCharCategory(U' '), kCharSpace);
+  EXPECT_EQ(GetCharCategory(U'\u3000'), kCharSpace);
+  EXPECT_EQ(GetCharCategory(U'~'), kCharPunct);
+  EXPECT_EQ(GetCharCategory(U'\u2019'), kCharPunct);
+  EXPECT_EQ(GetCharCategory(U'\u0001'), kCharControl);
+  EXPECT_EQ(GetCharCategory(U'\u4E2D'), kCharCJK);
+  EXPECT_EQ(GetCharCategory(U'\U0002A6DF'), kCharCJK);
+  EXPECT_EQ(GetCharCategory(U'\u0301'), kCharAccent);
+  EXPECT_EQ(GetCharCategory(U'a'), 0);
+  EXPECT_EQ(GetCharCategory(U'\U0010FFFF'), 0);
+}
+
 TEST_F(LocaleBaseTest, basic_tokenizer_chinese) {
   ustring test_case = ustring("ÀÁÂÃÄÅÇÈÉÊËÌÍÎÑÒÓÔÕÖÚÜ\t䗓𨖷虴𨀐辘𧄋脟𩑢𡗶镇伢𧎼䪱轚榶𢑌㺽𤨡!#$%&(Tom@microsoft.com)*+,-./:;<=>?@[\\]^_`{|}~");
   std::vector<ustring> expect_result = ustring_vector_convertor({"aaaaaaceeeeiiinooooouu",
@@ -247,3 +418,27 @@ TEST(tokenizer, truncation_longest_first) {
   EXPECT_EQ(test_input1, std::vector<int64_t>({1, 2, 3, 4, 5}));
   EXPECT_EQ(test_input2, std::vector<int64_t>({1, 2, 3, 4, 5,  6 ,7}));
 }
+
+TEST(tokenizer, trie_tokenizer) {
+  // every line is the id, the Python literal of the token and its length in bytes.
+  std::string vocab =
+      "1 'a' 1\n"
+      "2 'b' 1\n"
+      "3 'ab' 2\n"
+      "4 'abc' 3\n"
+      "5 b'\\xe4\\xb8\\xad' 3\n"
+      "6 'c' 1\n"
+      "7 'ab' 2\n";
+  TrieTokenizer tokenizer(vocab);
+
+  // the longest match wins, and the last id of the duplicated "ab" is kept.
+  EXPECT_EQ(tokenizer.encodeBytes("abcab"), std::vector<int>({4, 7}));
+  EXPECT_EQ(tokenizer.encodeBytes("abba"), std::vector<int>({7, 2, 1}));
+  EXPECT_EQ(tokenizer.encodeBytes("c\xe4\xb8\xad"), std::vector<int>({6, 5}));
+  EXPECT_EQ(tokenizer.encodeBytes(""), std::vector<int>());
+  EXPECT_EQ(tokenizer.decodeBytes({4, 7, 5}), "abcab\xe4\xb8\xad");
+
+  // a prefix of a token only isn't a token either
+  EXPECT_THROW(tokenizer.encodeBytes("a\xe4"), std::exception);
+  EXPECT_THROW(tokenizer.encodeBytes("d"), std::exception);
+}
@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ortx_tokenizer.h"
+
+namespace {
+
+OrtxStringSpan Span(const std::string& text) { return OrtxStringSpan{text.data(), text.size()}; }
+
+std::vector<std::vector<int64_t>> EncodeBatch(const OrtxTokenizer* tokenizer, const std::vector<std::string>& texts) {
+  std::vector<OrtxStringSpan> spans;
+  for (const auto& text : texts) {
+    spans.push_back(Span(text));
+  }
+
+  // the first call only sizes the ids
+  std::vector<size_t> row_offsets(texts.size() + 1);
+  EXPECT_EQ(OrtxEncodeBatch(tokenizer, spans.data(), spans.size(), nullptr, 0, row_offsets.data()), 0);
+  std::vector<int64_t> ids(row_offsets.back());
+  EXPECT_EQ(OrtxEncodeBatch(tokenizer, spans.data(), spans.size(), ids.data(), ids.size(), row_offsets.data()), 0);
+
+  std::vector<std::vector<int64_t>> rows;
+  for (size_t i = 0; i < texts.size(); ++i) {
+    rows.emplace_back(ids.begin() + row_offsets[i], ids.begin() + row_offsets[i + 1]);
+  }
+  return rows;
+}
+
+std::vector<std::string> DecodeBatch(const OrtxTokenizer* tokenizer, const std::vector<std::vector<int64_t>>& rows) {
+  std::vector<int64_t> ids;
+  std::vector<size_t> id_offsets{0};
+  for (const auto& row : rows) {
+    ids.insert(ids.end(), row.begin(), row.end());
+    id_offsets.push_back(ids.size());
+  }
+
+  std::vector<size_t> text_offsets(rows.size() + 1);
+  EXPECT_EQ(OrtxDecodeBatch(tokenizer, ids.data(), id_offsets.data(), rows.size(), nullptr, 0, text_offsets.data()),
+            0);
+  std::string text(text_offsets.back(), '\0');
+  EXPECT_EQ(OrtxDecodeBatch(tokenizer, ids.data(), id_offsets.data(), rows.size(), text.data(), text.size(),
+                            text_offsets.data()),
+            0);
+
+  std::vector<std::string> texts;
+  for (size_t i = 0; i < rows.size(); ++i) {
+    texts.push_back(text.substr(text_offsets[i], text_offsets[i + 1] - text_offsets[i]));
+  }
+  return texts;
+}
+
+}  // namespace
+
+TEST(tokenizer_api, gpt2) {
+  const std::filesystem::path data_dir = std::filesystem::current_path() / "data";
+  OrtxTokenizer* tokenizer = nullptr;
+  ASSERT_EQ(OrtxCreateTokenizerFromFiles("GPT2Tokenizer", (data_dir / "gpt2.vocab").string().c_str(),
+                                         (data_dir / "gpt2.merges.txt").string().c_str(), &tokenizer),
+            0)
+      << OrtxGetLastErrorMessage();
+
+  const std::vector<std::string> texts{"Hello world", "", "I love you<|endoftext|>", "caf\xc3\xa9 \xe4\xb8\xad"};
+  auto rows = EncodeBatch(tokenizer, texts);
+  EXPECT_EQ(rows[0], std::vector<int64_t>({15496, 995}));
+  EXPECT_TRUE(rows[1].empty());
+  EXPECT_EQ(rows[2].back(), 50256);
+  EXPECT_EQ(DecodeBatch(tokenizer, rows), texts);
+
+  // the ids out of the vocab fail, even the ones whose low 32 bits are an id of it
+  for (int64_t id : {int64_t{-1}, int64_t{50257}, (int64_t{1} << 32) + 15496}) {
+    const size_t id_offsets[2] = {0, 1};
+    size_t text_offsets[2] = {};
+    EXPECT_NE(OrtxDecodeBatch(tokenizer, &id, id_offsets, 1, nullptr, 0, text_offsets), 0) << id;
+    EXPECT_NE(std::string(OrtxGetLastErrorMessage()).find("Invalid ID"), std::string::npos);
+  }
+
+  OrtxReleaseTokenizer(tokenizer);
+}
+
+TEST(tokenizer_api, bert) {
+  const std::filesystem::path data_dir = std::filesystem::current_path() / "data";
+  OrtxTokenizer* tokenizer = nullptr;
+  ASSERT_EQ(OrtxCreateTokenizerFromFiles("BertTokenizer", (data_dir / "bert_basic_cased_vocab.txt").string().c_str(),
+                                         nullptr, &tokenizer),
+            0)
+      << OrtxGetLastErrorMessage();
+
+  // the text is lowercased by default, as the op does
+  auto rows = EncodeBatch(tokenizer, {"We look forward to welcoming you to our stores.", "test"});
+  EXPECT_EQ(rows[0], std::vector<int64_t>({101, 1195, 1440, 1977, 1106, 20028, 1128, 1106, 1412, 4822, 119, 102}));
+  EXPECT_EQ(rows[1], std::vector<int64_t>({101, 2774, 102}));
+  EXPECT_EQ(DecodeBatch(tokenizer, {{101, 2774, 102, 2774, 102}}),
+            std::vector<std::string>({"[CLS] test [SEP] test [SEP]"}));
+
+  OrtxReleaseTokenizer(tokenizer);
+}
+
+TEST(tokenizer_api, trie) {
+  const std::string vocab =
+      "1 'a' 1\n"
+      "2 'b' 1\n"
+      "3 'ab' 2\n"
+      "4 'abc' 3\n"
+      "5 b'\\xe4\\xb8\\xad' 3\n";
+  OrtxTokenizer* tokenizer = nullptr;
+  ASSERT_EQ(OrtxCreateTokenizer("TrieTokenizer", Span(vocab), OrtxStringSpan{nullptr, 0}, &tokenizer), 0)
+      << OrtxGetLastErrorMessage();
+
+  auto rows = EncodeBatch(tokenizer, {"abcab", "\xe4\xb8\xad" "a"});
+  EXPECT_EQ(rows[0], std::vector<int64_t>({4, 3}));
+  EXPECT_EQ(rows[1], std::vector<int64_t>({5, 1}));
+  EXPECT_EQ(DecodeBatch(tokenizer, rows), std::vector<std::string>({"abcab", "\xe4\xb8\xad" "a"}));
+
+  // the ids aren't written into a smaller array, but the offsets still size it
+  const std::string text = "abcab";
+  OrtxStringSpan span = Span(text);
+  int64_t ids[1] = {-1};
+  size_t row_offsets[2] = {};
+  EXPECT_EQ(OrtxEncodeBatch(tokenizer, &span, 1, ids, 1, row_offsets), 0);
+  EXPECT_EQ(ids[0], -1);
+  EXPECT_EQ(row_offsets[1], 2u);
+
+  // a text without the tokens of its bytes fails with its message
+  const std::string invalid = "d";
+  span = Span(invalid);
+  EXPECT_NE(OrtxEncodeBatch(tokenizer, &span, 1, nullptr, 0, row_offsets), 0);
+  EXPECT_NE(std::string(OrtxGetLastErrorMessage()).find("no token"), std::string::npos);
+
+  OrtxReleaseTokenizer(tokenizer);
+}
+
+TEST(tokenizer_api, errors) {
+  OrtxTokenizer* tokenizer = nullptr;
+  const std::string vocab = "1 'a' 1\n";
+  EXPECT_NE(OrtxCreateTokenizer("NoSuchTokenizer", Span(vocab), OrtxStringSpan{nullptr, 0}, &tokenizer), 0);
+  EXPECT_EQ(tokenizer, nullptr);
+  EXPECT_NE(std::string(OrtxGetLastErrorMessage()).find("NoSuchTokenizer"), std::string::npos);
+
+  EXPECT_NE(OrtxCreateTokenizerFromFiles("GPT2Tokenizer", "no_such.vocab", nullptr, &tokenizer), 0);
+  EXPECT_EQ(tokenizer, nullptr);
+  EXPECT_NE(OrtxEncodeBatch(nullptr, nullptr, 0, nullptr, 0, nullptr), 0);
+}
@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "unigram_tokenizer.hpp"
+
+namespace {
+
+std::vector<int64_t> Encode(const UnigramModel& model, std::string_view text) {
+  std::vector<int64_t> ids;
+  model.Encode(text, ids);
+  return ids;
+}
+
+}  // namespace
+
+TEST(unigram_tokenizer, double_array_trie) {
+  std::vector<std::pair<std::string_view, int32_t>> keys{{"a", 3}, {"ab", 1}, {"abc", 0}, {"b", 2}, {"\xE2\x96\x81", 4}};
+  DoubleArrayTrie trie;
+  trie.Build(keys);
+  for (const auto& [key, value] : keys) {
+    EXPECT_EQ(trie.Find(key), value);
+  }
+  EXPECT_EQ(trie.Find(""), -1);
+  EXPECT_EQ(trie.Find("abd"), -1);
+  EXPECT_EQ(trie.Find("\xE2\x96"), -1);
+
+  std::vector<std::pair<size_t, int32_t>> prefixes;
+  trie.CommonPrefixSearch("abcd", [&](size_t length, int32_t value) { prefixes.emplace_back(length, value); });
+  EXPECT_EQ(prefixes, (std::vector<std::pair<size_t, int32_t>>{{1, 3}, {2, 1}, {3, 0}}));
+
+  DoubleArrayTrie empty;
+  empty.Build({});
+  EXPECT_EQ(empty.Find("a"), -1);
+}
+
+TEST(unigram_tokenizer, viterbi) {
+  UnigramModel model;
+  // the model of a tokenizer.json, whose other parts are skipped
+  model.Load(R"({"version": "1.0", "added_tokens": [{"id": 0, "content": "<unk>"}],
+    "normalizer": {"type": "Precompiled", "precompiled_charsmap": "AAAA"},
+    "model": {"type": "Unigram", "unk_id": 0, "vocab": [
+      ["<unk>", 0.0], ["▁", -2.0], ["▁hello", -3.0], ["hel", -4.0], ["lo", -4.0], ["h", -6.0],
+      ["e", -6.0], ["l", -6.0], ["o", -6.0], ["▁he", -5], ["▁hello", -1.0]]}})");
+  EXPECT_EQ(model.PieceCount(), 11u);
+  EXPECT_EQ(model.PieceToId("\xE2\x96\x81hello"), 2);  // the first of the duplicates
+
+  EXPECT_EQ(Encode(model, "\xE2\x96\x81hello"), (std::vector<int64_t>{2}));
+  // ▁he lo is -9, and ▁ hel o is -12
+  EXPECT_EQ(Encode(model, "\xE2\x96\x81helo"), (std::vector<int64_t>{9, 4}));
+  // the consecutive unknown characters are one unk, with the score of the lowest piece - 10
+  EXPECT_EQ(Encode(model, "xy\xE4\xBD\xA0h"), (std::vector<int64_t>{0, 5}));
+  EXPECT_EQ(Encode(model, "xhy"), (std::vector<int64_t>{0, 5, 0}));
+  EXPECT_TRUE(Encode(model, "").empty());
+}
+
+TEST(unigram_tokenizer, byte_fallback) {
+  UnigramModel model;
+  model.Load(R"({"type": "Unigram", "unk_id": 0, "byte_fallback": true, "vocab": [
+      ["<unk>", 0.0], ["a", -1.0], ["<0x78>", -5.0], ["<0xE4>", -5.0], ["<0xBD>", -5.0]]})");
+  EXPECT_EQ(Encode(model, "axa"), (std::vector<int64_t>{1, 2, 1}));
+  // the characters whose bytes aren't all in the vocab are unk
+  EXPECT_EQ(Encode(model, "\xE4\xBD\xA0y"), (std::vector<int64_t>{0}));
+
+  EXPECT_THROW(model.Load(R"({"model": {"type": "BPE", "vocab": {"a": 0}, "merges": []}})"), std::exception);
+  EXPECT_THROW(model.Load(R"({"type": "Unigram", "vocab": [["a", -1.0, 2]]})"), std::exception);
+  EXPECT_THROW(model.Load(R"({"type": "Unigram", "unk_id": 2, "vocab": [["a", -1.0]]})"), std::exception);
+
+  UnigramModel no_unk;
+  no_unk.Load(R"({"type": "Unigram", "unk_id": null, "vocab": [["a", -1.0]]})");
+  EXPECT_THROW(Encode(no_unk, "ab"), std::exception);
+}
@@ -5,8 +5,10 @@
 
 #include <cstring>
 #include <codecvt>
+#include <random>
 #include "gtest/gtest.h"
 #include "ustring.h"
+#include "unicode_normalization.h"
 
 void convert_test(const char* const_str) {
   std::string string(const_str);
@@ -67,3 +69,119 @@ TEST(ustring, operater) {
   test.append(U"用来测试");
   EXPECT_EQ(test.at(4), U'用');
 }
+
+TEST(ustring, ill_formed_utf8) {
+  // every maximal ill-formed subsequence is one replacement character
+  EXPECT_EQ(ustring("a\x80" "b"), ustring(U"a�b"));
+  EXPECT_EQ(ustring("a\xc3"), ustring(U"a�"));
+  EXPECT_EQ(ustring("\xe4\xb8"), ustring(U"�"));
+  EXPECT_EQ(ustring("\xe4\xb8" "a"), ustring(U"�a"));
+  EXPECT_EQ(ustring("\xc0\x80"), ustring(U"��"));
+  EXPECT_EQ(ustring("\xe0\x80\x80"), ustring(U"���"));
+  EXPECT_EQ(ustring("\xed\xa0\x80"), ustring(U"���"));
+  EXPECT_EQ(ustring("\xf4\x90\x80\x80"), ustring(U"����"));
+  EXPECT_EQ(ustring("\xf0\x9f\xa7"), ustring(U"�"));
+  EXPECT_EQ(ustring("\xff\xfe"), ustring(U"��"));
+
+  std::u32string decoded;
+  EXPECT_TRUE(ustring::DecodeUTF8("\xf0\x9f\xa7\x90 Test", decoded));
+  EXPECT_EQ(decoded, U"\U0001F9D0 Test");
+  EXPECT_FALSE(ustring::DecodeUTF8("\xed\xa0\x80", decoded));
+  EXPECT_FALSE(ustring::ValidateUTF8("\xed\xa0\x80"));
+  EXPECT_TRUE(ustring::ValidateUTF8("\xed\x9f\xbf\xee\x80\x80\xf4\x8f\xbf\xbf"));
+
+  // the characters are counted as they are decoded
+  for (const char* text : {"a\x80" "b", "a\xc3", "\xe4\xb8" "a", "\xc0\x80", "\xf4\x90\x80\x80", "\xff\xfe"}) {
+    EXPECT_EQ(ustring::CountUTF8Chars(text), ustring(text).size());
+  }
+
+  // the invalid code points are replaced when they are encoded
+  EXPECT_EQ(std::string(ustring(U"a\xD800" "b")), "a\xef\xbf\xbd" "b");
+  EXPECT_EQ(ustring::EncodeUTF8(std::u32string(1, 0x110000)), "\xef\xbf\xbd");
+}
+
+TEST(ustring, ascii_blocks) {
+  // the runs of ASCII characters are converted in and after the blocks of 16 characters
+  std::string ascii = "0123456789abcdefghijklmnopqrstuvwxyz0123456789ABCDEF";
+  EXPECT_EQ(ustring::CountAsciiPrefix(ascii.data(), ascii.size()), ascii.size());
+  EXPECT_EQ(ustring::CountAsciiPrefix(ascii.data(), 0), 0);
+  for (size_t pos : {0, 5, 15, 16, 17, 31, 35, 51}) {
+    std::string text = ascii.substr(0, pos) + "\xc3\xa9" + ascii.substr(pos);
+    EXPECT_EQ(ustring::CountAsciiPrefix(text.data(), text.size()), pos);
+
+    ustring decoded(text);
+    ASSERT_EQ(decoded.size(), ascii.size() + 1);
+    EXPECT_EQ(decoded[pos], U'é');
+    EXPECT_EQ(std::string(decoded), text);
+  }
+}
+
+TEST(ustring, ascii_case) {
+  // the letters are mapped in and after the blocks of 16 bytes, and the bytes around the letters are kept
+  const std::string text = "@AZ[`az{0123456789 Hello, World! \xc3\x89t\xc3\xa9 MIXED case";
+  std::string upper(text.size(), '\0');
+  ustring::UpperAscii(text.data(), text.size(), upper.data());
+  EXPECT_EQ(upper, "@AZ[`AZ{0123456789 HELLO, WORLD! \xc3\x89T\xc3\xa9 MIXED CASE");
+
+  std::string lower(text.size(), '\0');
+  const size_t ascii = ustring::LowerAsciiPrefix(text.data(), text.size(), lower.data());
+  ASSERT_EQ(ascii, text.find('\xc3'));
+  EXPECT_EQ(lower.substr(0, ascii), "@az[`az{0123456789 hello, world! ");
+}
+
+TEST(ustring, round_trip) {
+  std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> cvt;
+  std::mt19937 random(7);
+  const char32_t ranges[][2] = {{0x20, 0x7E}, {0x80, 0x7FF}, {0x800, 0xD7FF}, {0xE000, 0xFFFF}, {0x10000, 0x10FFFF}};
+  for (int round = 0; round < 200; ++round) {
+    std::u32string text;
+    // the longer strings have more than 255 blocks of 16 bytes
+    size_t length = random() % (round < 190 ? 100 : 10000);
+    for (size_t i = 0; i < length; ++i) {
+      // mostly ASCII with some other characters
+      const auto& range = ranges[random() % 8 < 5 ? 0 : random() % 5];
+      text.push_back(range[0] + random() % (range[1] - range[0] + 1));
+    }
+
+    std::string utf8 = cvt.to_bytes(text);
+    EXPECT_EQ(ustring::EncodeUTF8(text), utf8);
+    EXPECT_EQ(ustring::UTF8Length(text), utf8.size());
+    EXPECT_TRUE(ustring::ValidateUTF8(utf8));
+    EXPECT_EQ(ustring::CountUTF8Chars(utf8), text.size());
+    EXPECT_EQ(ustring(utf8), ustring(text));
+  }
+}
+
+TEST(ustring, unicode_normalization) {
+  // Å of the angstrom sign, the composed letter and the decomposed one
+  const std::string decomposed = "A\xCC\x8A";
+  EXPECT_EQ(NormalizeUtf8("\xE2\x84\xAB", NormalizationForm::kNFC), "\xC3\x85");
+  EXPECT_EQ(NormalizeUtf8(decomposed, NormalizationForm::kNFC), "\xC3\x85");
+  EXPECT_EQ(NormalizeUtf8("\xC3\x85", NormalizationForm::kNFD), decomposed);
+  // the ligature fi and the superscript two are only decomposed by the compatibility forms
+  EXPECT_EQ(NormalizeUtf8("\xEF\xAC\x81x\xC2\xB2", NormalizationForm::kNFC), "\xEF\xAC\x81x\xC2\xB2");
+  EXPECT_EQ(NormalizeUtf8("\xEF\xAC\x81x\xC2\xB2", NormalizationForm::kNFKC), "fix2");
+  // the dot below (220) is ordered before the dot above (230), and q has no composite with either of them
+  EXPECT_EQ(NormalizeUtf8("q\xCC\x87\xCC\xA3", NormalizationForm::kNFD), "q\xCC\xA3\xCC\x87");
+  EXPECT_EQ(NormalizeUtf8("\xE1\xB8\x8B\xCC\xA3", NormalizationForm::kNFC), "\xE1\xB8\x8D\xCC\x87");
+  // the Hangul syllables are decomposed into their jamo and composed back
+  EXPECT_EQ(NormalizeUtf8("\xED\x9E\xA3", NormalizationForm::kNFD), "\xE1\x84\x92\xE1\x85\xB5\xE1\x87\x82");
+  EXPECT_EQ(NormalizeUtf8("\xE1\x84\x92\xE1\x85\xB5\xE1\x87\x82", NormalizationForm::kNFC), "\xED\x9E\xA3");
+
+  // the normalized texts pass the quick check as they are, and only the rest after the last starter is normalized
+  const std::string text = "caf\xC3\xA9 ok";
+  for (auto form : {NormalizationForm::kNFC, NormalizationForm::kNFKC}) {
+    EXPECT_EQ(NormalizedPrefixLength(text, form), text.size());
+    std::string output;
+    EXPECT_FALSE(NormalizeUtf8(text, form, output));
+    EXPECT_EQ(output, text);
+  }
+  EXPECT_EQ(NormalizedPrefixLength(text, NormalizationForm::kNFD), 2u);
+  EXPECT_EQ(NormalizedPrefixLength("cafe\xCC\x81", NormalizationForm::kNFC), 3u);
+  EXPECT_EQ(NormalizedPrefixLength("\xCC\x81", NormalizationForm::kNFC), 0u);
+
+  NormalizationForm form;
+  EXPECT_TRUE(ParseNormalizationForm("NFKD", form));
+  EXPECT_EQ(form, NormalizationForm::kNFKD);
+  EXPECT_FALSE(ParseNormalizationForm("nfc", form));
+}
@@ -1,6 +1,14 @@
 ﻿// Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <numeric>
+#include <thread>
 #include "gtest/gtest.h"
 #ifdef ENABLE_RE2_REGEX
 #include "re2/re2.h"
@@ -8,6 +16,26 @@
 #include "nlohmann/json.hpp"
 #include "string_utils.h"
 #include "ustring.h"
+#include "lru_cache.h"
+#include "memory_budget.h"
+#include "numa.h"
+#include "huge_pages.h"
+#include "token_vocab.h"
+#include "shared_registry.h"
+#include "shared_kernels.h"
+#include "parallel_for.h"
+#include "scratch_arena.h"
+#include "perfect_hash.h"
+#include "runtime_stats.h"
+#include "run_cancellation.h"
+#include "background_load.h"
+#include "json_vocab.h"
+#include "asset_attribute.h"
+#include "asset_compression.h"
+#include "unique_rows.h"
+#ifdef ENABLE_ZSTD
+#include "zstd.h"
+#endif
 
 
 TEST(utils, make_string) {
@@ -67,4 +95,752 @@ TEST(utils, utf8) {
     std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
     EXPECT_EQ(lowered[i], lower);
   }
-}
\ No newline at end of file
+}
+
+TEST(utils, lru_cache) {
+  LruCache<std::string, int> cache(2);
+  int value = 0;
+  EXPECT_FALSE(cache.Lookup("a", value));
+
+  cache.Insert("a", 1);
+  cache.Insert("b", 2);
+  EXPECT_TRUE(cache.Lookup("a", value));
+  EXPECT_EQ(value, 1);
+
+  // "b" is the least recently used one.
+  cache.Insert("c", 3);
+  EXPECT_FALSE(cache.Lookup("b", value));
+  EXPECT_TRUE(cache.Lookup("c", value));
+  EXPECT_EQ(value, 3);
+  EXPECT_EQ(cache.Size(), 2);
+  EXPECT_EQ(cache.Hits(), 2);
+  EXPECT_EQ(cache.Misses(), 2);
+
+  cache.SetCapacity(0);
+  EXPECT_EQ(cache.Size(), 0);
+  cache.Insert("a", 1);
+  EXPECT_FALSE(cache.Lookup("a", value));
+}
+
+TEST(utils, memory_budget) {
+  auto& budget = ort_extensions::MemoryBudget::Instance();
+  auto& stats = ort_extensions::RuntimeStats::Instance();
+  const std::string value(1000, 'x');
+  LruCache<std::string, std::string> older(100);
+  LruCache<std::string, std::string> newer(100);
+  older.SetStatsName("test_budget_cache");
+  for (int i = 0; i < 10; ++i) {
+    older.Insert("older" + std::to_string(i), value);
+  }
+  for (int i = 0; i < 10; ++i) {
+    newer.Insert("newer" + std::to_string(i), value);
+  }
+  EXPECT_GE(older.Bytes(), 10 * value.size());
+  EXPECT_EQ(stats.Counter("test_budget_cache.bytes").Value(), static_cast<int64_t>(older.Bytes()));
+
+  // over the limit, the least recently used cache gives back its least recently used entries
+  budget.SetLimit(budget.Used() - older.Bytes() / 2);
+  EXPECT_LE(budget.Used(), budget.Limit());
+  EXPECT_LT(older.Size(), 10u);
+  EXPECT_EQ(newer.Size(), 10u);
+  std::string found;
+  EXPECT_FALSE(older.Lookup("older0", found));
+  EXPECT_TRUE(older.Lookup("older9", found));
+  EXPECT_EQ(stats.Counter("test_budget_cache.bytes").Value(), static_cast<int64_t>(older.Bytes()));
+  EXPECT_EQ(stats.Counter("memory_budget.limit").Value(), static_cast<int64_t>(budget.Limit()));
+  EXPECT_GT(stats.Counter("memory_budget.released").Value(), 0);
+
+  // an insert over the limit is reclaimed by the cache which inserts it
+  newer.Insert("large", std::string(older.Bytes() + 1000, 'y'));
+  EXPECT_LE(budget.Used(), budget.Limit());
+  EXPECT_EQ(older.Size(), 0u);
+
+  const size_t used = budget.Used();
+  newer.Clear();
+  EXPECT_EQ(newer.Bytes(), 0u);
+  EXPECT_LT(budget.Used(), used);
+
+  // the arena of a thread gives back its blocks after its next scope, instead of keeping them for the next work
+  {
+    ScratchScope scope;
+    ScratchArena::Current()->Allocate(1 << 16, 8);
+  }
+  const int64_t arena_bytes = stats.Counter("scratch_arena.bytes").Value();
+  budget.SetLimit(1);
+  { ScratchScope scope; }
+  EXPECT_LT(stats.Counter("scratch_arena.bytes").Value(), arena_bytes);
+
+  // without a limit nothing is evicted
+  budget.SetLimit(0);
+  for (int i = 0; i < 10; ++i) {
+    older.Insert("older" + std::to_string(i), value);
+  }
+  EXPECT_EQ(older.Size(), 10u);
+  EXPECT_EQ(stats.Counter("memory_budget.limit").Value(), 0);
+}
+
+TEST(utils, runtime_stats) {
+  auto& stats = ort_extensions::RuntimeStats::Instance();
+  auto& counter = stats.Counter("test.counter");
+  ParallelFor(1000, 4, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      counter.Add(2);
+    }
+  });
+  EXPECT_EQ(counter.Value(), 2000);
+  EXPECT_EQ(&stats.Counter("test.counter"), &counter);
+
+  {
+    LruCache<std::string, int> cache(2);
+    cache.SetStatsName("test_cache");
+    int value = 0;
+    cache.Insert("a", 1);
+    cache.Lookup("a", value);
+    cache.Lookup("b", value);
+    cache.Insert("b", 2);
+    cache.Insert("c", 3);
+    EXPECT_EQ(stats.Counter("test_cache.hits").Value(), 1);
+    EXPECT_EQ(stats.Counter("test_cache.misses").Value(), 1);
+    EXPECT_EQ(stats.Counter("test_cache.entries").Value(), 2);
+  }
+  // the entries of a cache are taken out when it's destroyed
+  EXPECT_EQ(stats.Counter("test_cache.entries").Value(), 0);
+
+  auto& latency = stats.Latency("TestOp");
+  latency.Record(std::chrono::microseconds(0));
+  latency.Record(std::chrono::microseconds(3));
+  latency.Record(std::chrono::microseconds(1000));
+  auto snapshot = latency.Read();
+  EXPECT_EQ(snapshot.count, 3);
+  EXPECT_EQ(snapshot.total_us, 1003);
+  EXPECT_EQ(snapshot.buckets[0], 1);
+  EXPECT_EQ(snapshot.buckets[2], 1);
+  EXPECT_EQ(snapshot.buckets[10], 1);
+
+  auto json = nlohmann::json::parse(stats.ToJson());
+  EXPECT_EQ(json["counters"]["test.counter"], 2000);
+  EXPECT_EQ(json["latencies"]["TestOp"]["count"], 3);
+  EXPECT_EQ(json["latencies"]["TestOp"]["buckets"].size(), 11);
+}
+
+TEST(utils, token_vocab) {
+  TokenVocab vocab;
+  EXPECT_EQ(vocab.Find("a"), TokenVocab::kInvalidId);
+
+  // enough tokens to rehash the table a few times
+  for (int32_t id = 0; id < 5000; ++id) {
+    vocab.Add("token" + std::to_string(id), id * 2);
+  }
+  vocab.Add("", 10001);
+  vocab.Add("token1", 3);  // the last id of a token wins
+
+  EXPECT_EQ(vocab.size(), 5001);
+  EXPECT_EQ(vocab.IdLimit(), 10002);
+  EXPECT_EQ(vocab.Find("token4999"), 9998);
+  EXPECT_EQ(vocab.Find("token1"), 3);
+  EXPECT_EQ(vocab.Find(""), 10001);
+  EXPECT_FALSE(vocab.Contains("token5000"));
+  EXPECT_EQ(vocab.Token(9998), "token4999");
+  EXPECT_EQ(vocab.Token(3), "token1");
+  EXPECT_FALSE(vocab.HasId(1));
+  EXPECT_EQ(vocab.Token(1), "");
+  EXPECT_EQ(vocab.Token(-1), "");
+
+  size_t count = 0;
+  for (const auto& [token, id] : vocab) {
+    EXPECT_EQ(vocab.Find(token), id);
+    ++count;
+  }
+  EXPECT_EQ(count, vocab.size());
+}
+
+TEST(utils, shared_registry) {
+  auto& registry = SharedRegistry<std::string>::Instance();
+  int loads = 0;
+  auto load = [&loads](std::string_view payload) {
+    return [&loads, payload]() {
+      ++loads;
+      return std::make_shared<std::string>(payload);
+    };
+  };
+
+  auto vocab1 = registry.GetOrLoad({"vocab", "merges"}, load("vocab merges"));
+  auto vocab2 = registry.GetOrLoad({"vocab", "merges"}, load("vocab merges"));
+  EXPECT_EQ(vocab1, vocab2);
+  EXPECT_EQ(loads, 1);
+
+  // the boundaries of the parts are a part of the key
+  auto vocab3 = registry.GetOrLoad({"vocabm", "erges"}, load("vocabm erges"));
+  EXPECT_NE(vocab1, vocab3);
+  EXPECT_EQ(*vocab3, "vocabm erges");
+  EXPECT_EQ(registry.Size(), 2);
+
+  // the payloads of the same size are compared by their bytes
+  auto merges = registry.GetOrLoad({"merges", "vocab"}, load("merges vocab"));
+  EXPECT_EQ(*merges, "merges vocab");
+  merges.reset();
+
+  // the instance is freed with the last holder, and loaded again after that
+  vocab1.reset();
+  vocab2.reset();
+  EXPECT_EQ(registry.Size(), 1);
+  vocab1 = registry.GetOrLoad({"vocab", "merges"}, load("vocab merges"));
+  EXPECT_EQ(loads, 4);
+}
+
+TEST(utils, kernel_attributes) {
+  using ort_extensions::KernelAttributes;
+  const auto record = [](int64_t padding_length, std::string_view vocab) {
+    KernelAttributes attributes;
+    KernelAttributes::RecordScope scope(attributes);
+    KernelAttributes::Record("vocab", KernelAttributes::Kind::kString, true, vocab.data(), vocab.size());
+    KernelAttributes::Record("padding_length", KernelAttributes::Kind::kInt64, true, &padding_length,
+                             sizeof(padding_length));
+    KernelAttributes::Record("num_threads", KernelAttributes::Kind::kInt64, false, nullptr, 0);
+    return attributes;
+  };
+  EXPECT_TRUE(record(8, "a b c") == record(8, "a b c"));
+  EXPECT_FALSE(record(8, "a b c") == record(16, "a b c"));
+  EXPECT_FALSE(record(8, "a b c") == record(8, "a b d"));
+
+  // the reads out of a scope, or of an inner scope, aren't recorded into the scope
+  KernelAttributes outer;
+  KernelAttributes::Record("vocab", KernelAttributes::Kind::kString, false, nullptr, 0);
+  {
+    KernelAttributes::RecordScope scope(outer);
+    EXPECT_TRUE(record(8, "a b c") == record(8, "a b c"));
+  }
+  EXPECT_TRUE(outer == KernelAttributes());
+
+  // the values are compared byte for byte, and the content of the file of a path too
+  const std::string path = "kernel_attributes_test.json";
+  const auto write = [&path](const char* content) {
+    std::remove(path.c_str());  // a new file, as the old one is still mapped by the records
+    std::ofstream file(path, std::ios::binary);
+    file << content;
+  };
+  const auto record_path = [&path]() {
+    KernelAttributes attributes;
+    KernelAttributes::RecordScope scope(attributes);
+    KernelAttributes::Record("vocab_path", KernelAttributes::Kind::kString, true, path.data(), path.size());
+    return attributes;
+  };
+  write("{\"a\": 0}");
+  const KernelAttributes first = record_path();
+  EXPECT_TRUE(first == record_path());
+  write("{\"b\": 0}");
+  EXPECT_FALSE(first == record_path());
+  std::remove(path.c_str());
+  EXPECT_FALSE(first == record_path());
+}
+
+TEST(utils, parallel_for) {
+  for (size_t num_threads : {1, 3, 16}) {
+    std::vector<int> visits(1000);
+    ParallelFor(visits.size(), num_threads, [&visits](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        ++visits[i];
+      }
+    });
+    EXPECT_TRUE(std::all_of(visits.begin(), visits.end(), [](int n) { return n == 1; }));
+  }
+
+  size_t calls = 0;
+  ParallelFor(0, 4, [&calls](size_t, size_t) { ++calls; });
+  EXPECT_EQ(calls, 0u);
+
+  EXPECT_THROW(ParallelFor(100, 4, [](size_t begin, size_t) {
+                 if (begin == 0) {
+                   ORTX_CXX_API_THROW("failed", ORT_FAIL);
+                 }
+               }),
+               std::exception);
+
+  // the loops may be nested, and the workers which run the outer one don't wait for each other
+  std::vector<std::atomic<int>> nested(64 * 64);
+  ParallelFor(64, 8, [&nested](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      ParallelFor(64, 8, [&nested, i](size_t inner_begin, size_t inner_end) {
+        for (size_t j = inner_begin; j < inner_end; ++j) {
+          ++nested[i * 64 + j];
+        }
+      });
+    }
+  });
+  EXPECT_TRUE(std::all_of(nested.begin(), nested.end(), [](const std::atomic<int>& n) { return n == 1; }));
+}
+
+TEST(utils, parallel_for_cost) {
+  Ort::Custom::ComputeContext context;  // without a kernel, the threads of the extensions run the loop
+
+  // a cheap loop runs on the calling thread in one block
+  size_t calls = 0;
+  ParallelFor(context, 1000, 1.0, [&calls](size_t begin, size_t end) {
+    EXPECT_EQ(begin, 0u);
+    EXPECT_EQ(end, 1000u);
+    ++calls;
+  });
+  EXPECT_EQ(calls, 1u);
+
+  std::vector<int> visits(5000);
+  ParallelFor(context, visits.size(), 1e5, [&visits](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      ++visits[i];
+    }
+  });
+  EXPECT_TRUE(std::all_of(visits.begin(), visits.end(), [](int n) { return n == 1; }));
+
+  EXPECT_THROW(ParallelFor(context, 100, 1e6, [](size_t begin, size_t) {
+                 if (begin == 0) {
+                   ORTX_CXX_API_THROW("failed", ORT_FAIL);
+                 }
+               }),
+               std::exception);
+}
+
+TEST(utils, run_cancellation) {
+  using ort_extensions::RunCancellation;
+
+  // the kernels out of a run aren't cancelled
+  {
+    RunCancellation::Scope kernel;
+    EXPECT_FALSE(RunCancellation::Cancelled());
+    EXPECT_NO_THROW(RunCancellation::ThrowIfCancelled("test"));
+  }
+
+  {
+    RunCancellation::RunScope run;
+    RunCancellation::Scope kernel;
+    EXPECT_FALSE(RunCancellation::Cancelled());
+
+    // a run of another thread, like the one of another session, doesn't cancel this one
+    std::thread([]() {
+      RunCancellation::RunScope other;
+      EXPECT_TRUE(RunCancellation::Cancel(other.handle()));
+      RunCancellation::Scope other_kernel;
+      EXPECT_TRUE(RunCancellation::Cancelled());
+    }).join();
+    EXPECT_FALSE(RunCancellation::Cancelled());
+
+    EXPECT_TRUE(RunCancellation::Cancel(run.handle()));
+    EXPECT_TRUE(RunCancellation::Cancelled());
+    EXPECT_THROW(RunCancellation::ThrowIfCancelled("test"), std::exception);
+
+    // the threads of a loop of the kernel run with its token, and stop before their next blocks
+    std::atomic<size_t> blocks{0};
+    EXPECT_THROW(ParallelFor(1000, 4, [&blocks](size_t, size_t) { ++blocks; }), std::exception);
+    EXPECT_EQ(blocks, 0u);
+  }
+
+  // the run ends with its scope, which clears it from the thread
+  {
+    RunCancellation::Scope kernel;
+    EXPECT_FALSE(RunCancellation::Cancelled());
+    std::atomic<size_t> blocks{0};
+    ParallelFor(1000, 4, [&blocks](size_t, size_t) {
+      EXPECT_FALSE(RunCancellation::Cancelled());
+      ++blocks;
+    });
+    EXPECT_GT(blocks, 0u);
+  }
+
+  // the deadline of the run is the one of the kernels started on its thread
+  RunCancellation::Handle handle = 0;
+  {
+    RunCancellation::RunScope run(RunCancellation::Clock::now() + std::chrono::milliseconds(20));
+    handle = run.handle();
+    RunCancellation::Scope kernel;
+    EXPECT_FALSE(RunCancellation::Cancelled());
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    EXPECT_TRUE(RunCancellation::Cancelled());
+    try {
+      RunCancellation::ThrowIfCancelled("test");
+      FAIL() << "expected the deadline to have passed";
+    } catch (const std::exception& e) {
+      EXPECT_NE(std::string(e.what()).find("deadline"), std::string::npos);
+    }
+  }
+  EXPECT_FALSE(RunCancellation::Cancel(handle));
+  {
+    RunCancellation::Scope kernel;
+    EXPECT_FALSE(RunCancellation::Cancelled());
+  }
+
+  // the run of the C API, which has no scope, is cleared from the thread by its end
+  handle = RunCancellation::BeginRun();
+  RunCancellation::Cancel(handle);
+  RunCancellation::EndRun(handle);
+  {
+    RunCancellation::Scope kernel;
+    EXPECT_FALSE(RunCancellation::Cancelled());
+  }
+}
+
+TEST(utils, scratch_arena) {
+  // without a scope, the containers are on the heap
+  EXPECT_EQ(ScratchArena::Current(), nullptr);
+  ScratchVector<int> heap_values(10, 1);
+
+  const int* first = nullptr;
+  for (int round = 0; round < 3; ++round) {
+    ScratchScope scope;
+    ASSERT_NE(ScratchArena::Current(), nullptr);
+    ScratchVector<int> values;
+    for (int i = 0; i < 20000; ++i) {
+      values.push_back(i);  // grows beyond the first block
+    }
+    EXPECT_EQ(values[19999], 19999);
+
+    {
+      // a nested scope gives back only its own memory
+      ScratchScope nested;
+      ScratchVector<double> temp(1000, 2.0);
+      EXPECT_EQ(reinterpret_cast<uintptr_t>(temp.data()) % alignof(double), 0u);
+    }
+
+    // the blocks are merged into one after the first round, so the memory is reused
+    ScratchVector<int> reused(16);
+    if (round == 1) {
+      first = reused.data();
+    } else if (round == 2) {
+      EXPECT_EQ(reused.data(), first);
+    }
+  }
+  EXPECT_EQ(ScratchArena::Current(), nullptr);
+  EXPECT_EQ(heap_values, ScratchVector<int>(10, 1));
+
+  // every thread has its own arena
+  std::vector<size_t> sums(4);
+  ParallelFor(sums.size(), sums.size(), [&sums](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      ScratchScope scope;
+      ScratchVector<size_t> values(1000, i);
+      sums[i] = std::accumulate(values.begin(), values.end(), size_t(0));
+    }
+  });
+  EXPECT_EQ(sums, std::vector<size_t>({0, 1000, 2000, 3000}));
+}
+
+TEST(utils, numa_replicas) {
+  using ort_extensions::NumaTopology;
+  EXPECT_EQ(NumaTopology::ParseList("0-3,8,10-11"), (std::vector<size_t>{0, 1, 2, 3, 8, 10, 11}));
+  EXPECT_TRUE(NumaTopology::ParseList("").empty());
+
+  const auto& topology = NumaTopology::Instance();
+  EXPECT_GE(topology.NodeCount(), 1u);
+  EXPECT_LT(topology.CurrentNode(), topology.NodeCount());
+
+  // the holders of the same object share its copy on the node
+  auto& copies = ort_extensions::RuntimeStats::Instance().Counter("numa_replicas");
+  const int64_t copied = copies.Value();
+  auto primary = std::make_shared<const std::vector<int>>(std::vector<int>{1, 2, 3});
+  ort_extensions::NumaReplicas<std::vector<int>> replicas;
+  ort_extensions::NumaReplicas<std::vector<int>> other;
+  const std::vector<int>* replica = replicas.Get(primary);
+  EXPECT_NE(replica, primary.get());
+  EXPECT_EQ(*replica, *primary);
+  EXPECT_EQ(replicas.Get(primary), replica);
+  EXPECT_EQ(other.Get(primary), replica);
+  EXPECT_EQ(copies.Value(), copied + 1);
+}
+
+TEST(utils, huge_pages) {
+  using ort_extensions::HugePages;
+  EXPECT_FALSE(HugePages::Backs(HugePages::kPageSize - 1));
+  EXPECT_EQ(HugePages::Backs(HugePages::kPageSize), HugePages::CurrentMode() != HugePages::Mode::kOff);
+
+  // a table of more than one huge page is mapped in whole pages, with ORTX_HUGE_PAGES only
+  auto& bytes = ort_extensions::RuntimeStats::Instance().Counter("huge_page_bytes");
+  const int64_t before = bytes.Value();
+  {
+    ort_extensions::HugePageVector<int32_t> table(HugePages::kPageSize / sizeof(int32_t) + 1, 7);
+    const ort_extensions::HugePageVector<int32_t> copy = table;
+    EXPECT_EQ(copy.back(), 7);
+    const int64_t mapped = HugePages::Backs(table.size() * sizeof(int32_t)) ? 4 * HugePages::kPageSize : 0;
+    EXPECT_EQ(bytes.Value() - before, mapped);
+  }
+  EXPECT_EQ(bytes.Value(), before);
+
+  ort_extensions::HugePageString tokens(100, 'a');
+  tokens.append(HugePages::kPageSize, 'b');
+  EXPECT_EQ(tokens.substr(99, 2), "ab");
+}
+
+TEST(utils, string_tensor_builder) {
+  ortc::StringTensorBuilder builder;
+  builder.Reserve(3, 8);
+  builder.Append("abc");
+  builder.Append("");
+  builder.Append(std::string_view("defgh", 2));
+
+  auto raw = builder.Pointers();
+  ASSERT_EQ(builder.Size(), 3u);
+  EXPECT_STREQ(raw[0], "abc");
+  EXPECT_STREQ(raw[1], "");
+  EXPECT_STREQ(raw[2], "de");
+}
+
+TEST(utils, staged_outputs) {
+  struct FakeStaging : ortc::OutputStaging {
+    void* Acquire(size_t bytes) override {
+      buffers.emplace_back(bytes);
+      return buffers.back().data();
+    }
+    void Upload(OrtKernelContext*, const std::vector<ortc::StagedOutput>& outputs) override {
+      for (const auto& output : outputs) {
+        std::memcpy(output.device, output.host, output.bytes);
+      }
+      uploaded += outputs.size();
+    }
+    void Release(const std::vector<ortc::StagedOutput>& outputs) noexcept override { released += outputs.size(); }
+
+    std::list<std::vector<char>> buffers;
+    size_t uploaded = 0;
+    size_t released = 0;
+  };
+
+  FakeStaging staging;
+  int64_t device[2] = {};
+  {
+    ortc::StagedOutputs staged(&staging);
+    auto* host = static_cast<int64_t*>(staged.Stage(device, sizeof(device)));
+    host[0] = 7;
+    host[1] = 9;
+    EXPECT_EQ(device[0], 0);
+    staged.Upload(nullptr);
+  }
+  EXPECT_EQ(device[1], 9);
+  EXPECT_EQ(staging.uploaded, 1u);
+  EXPECT_EQ(staging.released, 0u);
+
+  // the buffers of a Compute which throws are released without a copy
+  {
+    ortc::StagedOutputs staged(&staging);
+    staged.Stage(device, sizeof(device));
+    staged.Stage(device, sizeof(device));
+  }
+  EXPECT_EQ(staging.uploaded, 1u);
+  EXPECT_EQ(staging.released, 2u);
+}
+
+TEST(utils, perfect_hash) {
+  StringPerfectHash empty;
+  empty.Build({});
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.Find("a"), StringPerfectHash::kNotFound);
+
+  std::vector<std::string> strings;
+  for (int i = 0; i < 10000; ++i) {
+    strings.push_back("key" + std::to_string(i * 7));
+  }
+  std::vector<std::string_view> keys(strings.begin(), strings.end());
+
+  StringPerfectHash hash;
+  auto indices = hash.Build(keys);
+  ASSERT_EQ(hash.size(), keys.size());
+  std::vector<bool> seen(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ASSERT_LT(indices[i], keys.size());
+    EXPECT_FALSE(seen[indices[i]]);
+    seen[indices[i]] = true;
+    EXPECT_EQ(hash.Find(keys[i]), indices[i]);
+    EXPECT_EQ(hash.Key(indices[i]), keys[i]);
+  }
+
+  EXPECT_EQ(hash.Find("key1"), StringPerfectHash::kNotFound);
+  EXPECT_EQ(hash.Find(""), StringPerfectHash::kNotFound);
+  EXPECT_THROW(hash.Build({"a", "b", "a"}), std::exception);
+}
+
+TEST(utils, background_load) {
+  BackgroundLoad<std::string> now;
+  now.Start([]() { return std::make_shared<const std::string>("vocab"); }, false);
+  EXPECT_EQ(*now, "vocab");
+
+  std::promise<void> release;
+  std::atomic<bool> loaded{false};
+  BackgroundLoad<std::string> later;
+  later.Start([gate = release.get_future(), &loaded]() {
+    gate.wait();
+    loaded = true;
+    return std::make_shared<const std::string>("merges");
+  }, true);
+  EXPECT_FALSE(loaded);
+
+  release.set_value();
+  EXPECT_EQ(later->size(), 6u);
+  EXPECT_TRUE(loaded);
+  EXPECT_EQ(later.Get(), later.Get());
+
+  // the error of a background load is thrown by every Get
+  BackgroundLoad<std::string> failed;
+  failed.Start([]() -> std::shared_ptr<const std::string> {
+    ORTX_CXX_API_THROW("bad vocab", ORT_INVALID_ARGUMENT);
+  }, true);
+  EXPECT_THROW(failed.Get(), std::exception);
+  EXPECT_THROW(failed.Get(), std::exception);
+
+  // the nodes of the same payload which load at the same time share one load
+  std::promise<void> start;
+  std::shared_future<void> started = start.get_future().share();
+  std::atomic<int> loads{0};
+  std::vector<std::unique_ptr<BackgroundLoad<std::string>>> nodes;
+  for (int i = 0; i < 4; ++i) {
+    nodes.push_back(std::make_unique<BackgroundLoad<std::string>>());
+    nodes.back()->Start([started, &loads]() {
+      return SharedRegistry<std::string>::Instance().GetOrLoad({"background vocab"}, [&]() {
+        started.wait();
+        ++loads;
+        return std::make_shared<const std::string>("background vocab");
+      });
+    }, true);
+  }
+  start.set_value();
+  for (auto& node : nodes) {
+    EXPECT_EQ(node->Get(), nodes.front()->Get());
+  }
+  EXPECT_EQ(loads, 1);
+}
+
+TEST(utils, json_vocab) {
+  const std::string json = R"({"a": 0, "b\"c": 1, "d:e": 2, "\u00e9": 3, "a": 4})";
+  EXPECT_EQ(CountJsonVocabEntries(json), 5u);
+
+  std::vector<std::pair<std::string, int32_t>> entries;
+  ParseJsonVocab(json, [&](std::string_view token, int32_t id) { entries.emplace_back(token, id); });
+  const std::vector<std::pair<std::string, int32_t>> expected{
+      {"a", 0}, {"b\"c", 1}, {"d:e", 2}, {"\xc3\xa9", 3}, {"a", 4}};
+  EXPECT_EQ(entries, expected);
+
+  auto ignore = [](std::string_view, int32_t) {};
+  EXPECT_THROW(ParseJsonVocab(R"(["a", "b"])", ignore), std::exception);
+  EXPECT_THROW(ParseJsonVocab(R"({"a": 1.5})", ignore), std::exception);
+  EXPECT_THROW(ParseJsonVocab(R"({"a": {"b": 1}})", ignore), std::exception);
+  EXPECT_THROW(ParseJsonVocab(R"({"a": 4294967296})", ignore), std::exception);
+  EXPECT_THROW(ParseJsonVocab(R"({"a": 1)", ignore), std::exception);
+}
+
+TEST(utils, asset_bytes) {
+  EXPECT_EQ(ort_extensions::AssetBytes("vocab").View(), "vocab");
+  EXPECT_FALSE(ort_extensions::AssetBytes("vocab").IsFile());
+
+  const std::string path = "asset_bytes_test.txt";
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << "{\"a\": 0}";
+  }
+  auto asset = ort_extensions::AssetBytes::FromFile(path);
+  EXPECT_TRUE(asset.IsFile());
+  auto copy = asset;
+  EXPECT_EQ(copy.View(), "{\"a\": 0}");
+  EXPECT_EQ(copy.View().data(), asset.View().data());
+  std::remove(path.c_str());
+
+  EXPECT_EQ(ort_extensions::AssetBytes::ResolvePath("/models/vocab.json", nullptr), "/models/vocab.json");
+  EXPECT_THROW(ort_extensions::AssetBytes::FromFile("no/such/asset.json"), std::exception);
+}
+
+TEST(utils, asset_path_in_asset_dir) {
+  const std::string dir = "asset_dir_test";
+  std::filesystem::create_directories(dir + "/vocabs");
+  const std::filesystem::path root = std::filesystem::canonical(dir);
+  using ort_extensions::AssetBytes;
+  EXPECT_EQ(AssetBytes::ResolvePath("vocabs/vocab.json", dir.c_str()), (root / "vocabs" / "vocab.json").string());
+  EXPECT_EQ(AssetBytes::ResolvePath("vocabs/../vocab.json", (dir + "/").c_str()), (root / "vocab.json").string());
+
+  // a path of the model can't read a file out of the directory
+  EXPECT_THROW(AssetBytes::ResolvePath("../vocab.json", dir.c_str()), std::exception);
+  EXPECT_THROW(AssetBytes::ResolvePath("vocabs/../../vocab.json", dir.c_str()), std::exception);
+  EXPECT_THROW(AssetBytes::ResolvePath("/etc/passwd", dir.c_str()), std::exception);
+  EXPECT_THROW(AssetBytes::ResolvePath("", dir.c_str()), std::exception);
+  std::filesystem::remove_all(dir);
+}
+
+TEST(utils, asset_compression) {
+  std::string raw;
+  std::string error;
+  EXPECT_FALSE(ort_extensions::DecompressAsset("gzip", "data", raw, error));
+  EXPECT_NE(error.find("gzip"), std::string::npos);
+
+#ifdef ENABLE_ZSTD
+  std::string vocab;
+  for (int i = 0; i < 100000; ++i) {
+    vocab += "token" + std::to_string(i) + "\n";
+  }
+  std::string compressed(ZSTD_compressBound(vocab.size()), '\0');
+  compressed.resize(ZSTD_compress(&compressed[0], compressed.size(), vocab.data(), vocab.size(), 3));
+  ASSERT_TRUE(ort_extensions::DecompressAsset("zstd", compressed, raw, error)) << error;
+  EXPECT_EQ(raw, vocab);
+
+  // the frames of a stream have no content size, and the frames may be concatenated
+  std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx(ZSTD_createCCtx(), ZSTD_freeCCtx);
+  std::string streamed(ZSTD_compressBound(vocab.size()), '\0');
+  ZSTD_inBuffer input{vocab.data(), vocab.size(), 0};
+  ZSTD_outBuffer output{&streamed[0], streamed.size(), 0};
+  ZSTD_compressStream2(cctx.get(), &output, &input, ZSTD_e_continue);
+  while (ZSTD_compressStream2(cctx.get(), &output, &input, ZSTD_e_end) != 0) {
+  }
+  streamed.resize(output.pos);
+  EXPECT_EQ(ZSTD_getFrameContentSize(streamed.data(), streamed.size()), ZSTD_CONTENTSIZE_UNKNOWN);
+  ASSERT_TRUE(ort_extensions::DecompressAsset("zstd", streamed + compressed, raw, error)) << error;
+  EXPECT_EQ(raw, vocab + vocab);
+
+  // the decompressed size is bounded with and without the content size of the frame
+  EXPECT_TRUE(ort_extensions::DecompressAsset("zstd", compressed, raw, error, vocab.size())) << error;
+  EXPECT_FALSE(ort_extensions::DecompressAsset("zstd", compressed, raw, error, vocab.size() - 1));
+  EXPECT_NE(error.find("maximum size"), std::string::npos);
+  EXPECT_TRUE(ort_extensions::DecompressAsset("zstd", streamed, raw, error, vocab.size())) << error;
+  EXPECT_FALSE(ort_extensions::DecompressAsset("zstd", streamed, raw, error, vocab.size() - 1));
+  EXPECT_NE(error.find("maximum size"), std::string::npos);
+  EXPECT_FALSE(ort_extensions::DecompressAsset("zstd", streamed + compressed, raw, error, vocab.size() * 2 - 1));
+
+  EXPECT_FALSE(ort_extensions::DecompressAsset("zstd", compressed.substr(0, compressed.size() / 2), raw, error));
+  EXPECT_FALSE(ort_extensions::DecompressAsset("zstd", vocab, raw, error));
+#else
+  EXPECT_FALSE(ort_extensions::DecompressAsset("zstd", "data", raw, error));
+#endif
+}
+
+TEST(utils, unique_rows) {
+  const std::vector<std::string_view> rows{"b", "", "a", "b", "", "b"};
+  const ort_extensions::UniqueRows unique(rows);
+  ASSERT_EQ(unique.size(), 3u);
+  EXPECT_EQ(unique[0], "b");
+  EXPECT_EQ(unique[1], "");
+  EXPECT_EQ(unique[2], "a");
+  std::vector<size_t> indices;
+  for (size_t row = 0; row < rows.size(); ++row) {
+    indices.push_back(unique.Index(row));
+  }
+  EXPECT_EQ(indices, std::vector<size_t>({0, 1, 2, 0, 1, 0}));
+  EXPECT_EQ(unique.FirstRow(2), 2u);
+  EXPECT_EQ(unique.Count(0), 3u);
+  EXPECT_EQ(unique.Count(1), 2u);
+
+  // the table grows with the rows, and the probes go past the other strings
+  std::vector<std::string> many;
+  for (int i = 0; i < 1000; ++i) {
+    many.push_back(std::to_string(i % 300));
+  }
+  const ort_extensions::UniqueRows many_unique(std::vector<std::string_view>(many.begin(), many.end()));
+  ASSERT_EQ(many_unique.size(), 300u);
+  for (size_t row = 0; row < many.size(); ++row) {
+    ASSERT_EQ(many_unique[many_unique.Index(row)], many[row]);
+  }
+  EXPECT_EQ(many_unique.Count(many_unique.Index(0)), 4u);
+  EXPECT_EQ(many_unique.Count(many_unique.Index(299)), 3u);
+
+  for (bool dedup : {false, true}) {
+    std::atomic<size_t> computed{0};
+    std::vector<std::string> results(rows.size());
+    ort_extensions::ComputeRows(
+        rows, dedup, 2,
+        [&](std::string_view text) {
+          ++computed;
+          return std::string(text) + "!";
+        },
+        [&](size_t row, std::string&& result) { results[row] = std::move(result); });
+    EXPECT_EQ(computed, dedup ? 3u : rows.size());
+    EXPECT_EQ(results, std::vector<std::string>({"b!", "!", "a!", "b!", "!", "b!"}));
+  }
+}
@@ -1,6 +1,8 @@
 # Copyright (c) Microsoft Corporation.
 # Licensed under the MIT License.
+import io
 import unittest
+import wave
 import numpy as np
 
 from onnx import checker, helper, onnx_pb as onnx_proto
@@ -33,6 +35,33 @@ class TestAudioCodec(unittest.TestCase):
         pcm_tensor = new_decoder(np.expand_dims(np.asarray(blob), axis=(0,)), ["wav"])
         np.testing.assert_allclose(pcm_tensor, self.raw_data, rtol=1e-05, atol=1e-08)
 
+    def test_time_range_decoder(self):
+        range_onnx_model = PyOrtFunction.from_customop('AudioDecoder').onnx_model
+        range_onnx_model.graph.input.extend([
+            helper.make_tensor_value_info('format', onnx_proto.TensorProto.STRING, []),
+            helper.make_tensor_value_info('start_time', onnx_proto.TensorProto.FLOAT, []),
+            helper.make_tensor_value_info('duration', onnx_proto.TensorProto.FLOAT, [])])
+        range_onnx_model.graph.node[0].input.extend(['format', 'start_time', 'duration'])
+        checker.check_model(range_onnx_model)
+        range_decoder = PyOrtFunction.from_model(range_onnx_model)
+
+        with wave.open(self.test_wav_file, 'rb') as f:
+            rate = f.getframerate()
+        for test_file, atol in [(self.test_wav_file, 1e-08), (self.test_flac_file, 1e-03)]:
+            blob = np.expand_dims(np.asarray(bytearray(util.read_file(test_file, mode='rb'))), axis=(0,))
+            # the format is detected from an empty string
+            pcm_tensor = range_decoder(blob, [""], np.array(1.0, dtype=np.float32), np.array(0.5, dtype=np.float32))
+            np.testing.assert_allclose(pcm_tensor, self.raw_data[:, rate:rate + rate // 2], rtol=1e-05, atol=atol)
+
+            # the duration is clipped at the end of the stream, and the start beyond it is empty
+            end = self.raw_data.shape[1] / rate
+            pcm_tensor = range_decoder(blob, [""], np.array(end - (rate // 4) / rate, dtype=np.float32),
+                                       np.array(10.0, dtype=np.float32))
+            np.testing.assert_allclose(pcm_tensor, self.raw_data[:, -(rate // 4):], rtol=1e-05, atol=atol)
+            pcm_tensor = range_decoder(blob, [""], np.array(end + 1, dtype=np.float32),
+                                       np.array(1.0, dtype=np.float32))
+            self.assertEqual(pcm_tensor.shape, (1, 0))
+
     def test_flac_decoder(self):
         blob = bytearray(util.read_file(self.test_flac_file, mode='rb'))
         pcm_tensor = self.decoder(np.expand_dims(np.asarray(blob), axis=(0,)))
@@ -55,6 +84,60 @@ class TestAudioCodec(unittest.TestCase):
         pcm_tensor = decoder(np.expand_dims(np.asarray(blob), axis=(0,)))
         self.assertEqual(pcm_tensor.shape, (1, 176000))
 
+    def test_multichannel_downmix(self):
+        frames = np.arange(4000, dtype=np.int16).reshape(1000, 4) * np.asarray([1, -1, 2, 3], dtype=np.int16)
+        stream = io.BytesIO()
+        with wave.open(stream, 'wb') as w:
+            w.setnchannels(4)
+            w.setsampwidth(2)
+            w.setframerate(16000)
+            w.writeframes(frames.tobytes())
+        blob = np.frombuffer(stream.getvalue(), dtype=np.uint8)
+        pcm = frames.astype(np.float32) / 32768
+
+        decoder = PyOrtFunction.from_customop('AudioDecoder', cpu_only=True, stereo_to_mono=1)
+        pcm_tensor = decoder(np.expand_dims(blob, axis=(0,)))
+        np.testing.assert_allclose(pcm_tensor, np.expand_dims(pcm.mean(axis=1), 0), atol=1e-06)
+
+        weights = [0.1, 0.2, 0.3, 0.4]
+        decoder = PyOrtFunction.from_customop('AudioDecoder', cpu_only=True, stereo_to_mono=1,
+                                              channel_weights=weights)
+        pcm_tensor = decoder(np.expand_dims(blob, axis=(0,)))
+        np.testing.assert_allclose(pcm_tensor, np.expand_dims(pcm @ np.asarray(weights, np.float32), 0), atol=1e-06)
+
+    def test_int16_decoder(self):
+        blob = np.frombuffer(util.read_file(self.test_wav_file, mode='rb'), dtype=np.uint8)
+        decoder = PyOrtFunction.from_customop('AudioDecoderInt16', cpu_only=True)
+        pcm_tensor = decoder(np.expand_dims(blob, axis=(0,)))
+        self.assertEqual(pcm_tensor.dtype, np.int16)
+        np.testing.assert_allclose(pcm_tensor / 32768, self.raw_data, atol=1e-04)
+
+        # the resampled samples are converted from float when they are written
+        decoder = PyOrtFunction.from_customop('AudioDecoderInt16', cpu_only=True, downsampling_rate=8000,
+                                              stereo_to_mono=1)
+        expected = PyOrtFunction.from_customop('AudioDecoder', cpu_only=True, downsampling_rate=8000,
+                                               stereo_to_mono=1)(np.expand_dims(blob, axis=(0,)))
+        pcm_tensor = decoder(np.expand_dims(blob, axis=(0,)))
+        self.assertEqual(pcm_tensor.shape, expected.shape)
+        np.testing.assert_allclose(pcm_tensor / 32768, np.clip(expected, -1, 1), atol=1e-04)
+
+    def test_batch_decoder(self):
+        streams = [util.read_file(f, mode='rb') for f in
+                   [self.test_wav_file, self.test_flac_file, util.get_test_data_file('data', 'jfk.flac')]]
+        offsets = np.cumsum([0] + [len(s) for s in streams]).astype(np.int64)
+        decoder = PyOrtFunction.from_customop(
+            'AudioDecoderBatch', cpu_only=True, downsampling_rate=16000, stereo_to_mono=1, num_threads=2)
+        pcm_tensor, lengths = decoder(np.frombuffer(b''.join(streams), dtype=np.uint8), offsets)
+
+        single = PyOrtFunction.from_customop(
+            'AudioDecoder', cpu_only=True, downsampling_rate=16000, stereo_to_mono=1)
+        self.assertEqual(pcm_tensor.shape, (3, np.max(lengths)))
+        for i, stream in enumerate(streams):
+            expected = single(np.expand_dims(np.frombuffer(stream, dtype=np.uint8), axis=(0,)))
+            self.assertEqual(lengths[i], expected.shape[1])
+            np.testing.assert_array_equal(pcm_tensor[i, :lengths[i]], expected[0])
+            self.assertTrue(np.all(pcm_tensor[i, lengths[i]:] == 0))
+
 
 if __name__ == "__main__":
     unittest.main()
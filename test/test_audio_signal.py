@@ -115,6 +115,18 @@ class TestAudio(unittest.TestCase):
         actual = actual[0]
         np.testing.assert_allclose(expected[:, 1:], actual[:, 1:], rtol=1e-3, atol=1e-3)
 
+    def test_stft_norm_batch(self):
+        audio_pcm = self.test_pcm
+        batch = np.stack([audio_pcm, audio_pcm[::-1], audio_pcm * 0.5])
+        window = np.hanning(400).astype(np.float32)
+
+        ortx_stft = OrtPyFunction.from_customop("StftNorm", cpu_only=True, num_threads=2)
+        actual = ortx_stft(batch, 400, 160, window, 400)
+        self.assertEqual(actual.shape[0], 3)
+        for pcm, spec in zip(batch, actual):
+            expected = self.stft(pcm, 400, 160, window)
+            np.testing.assert_allclose(expected, spec, rtol=1e-3, atol=1e-3)
+
     @unittest.skipIf(not _is_torch_available, "PyTorch is not available")
     def test_stft_norm_torch(self):
         audio_pcm = self.test_pcm
@@ -137,6 +149,100 @@ class TestAudio(unittest.TestCase):
         actual = util.mel_filterbank(400, 80, 16000)
         np.testing.assert_allclose(expected, actual, rtol=1e-3, atol=1e-3)
 
+    def test_log_mel_spectrogram(self):
+        audio_pcm = self.test_pcm
+        window = np.hanning(401)[:-1]  # periodic
+        padded = np.pad(audio_pcm, 200, mode="reflect")
+        frames = audio_pcm.shape[0] // 160
+        power = np.stack([np.abs(np.fft.rfft(padded[t * 160:t * 160 + 400] * window)) ** 2 for t in range(frames)])
+        log_mel = np.log10(np.maximum(util.mel_filterbank(400, 80, 16000) @ power.T, 1e-10))
+        expected = (np.maximum(log_mel, log_mel.max() - 8.0) + 4.0) / 4.0
+
+        log_mel_spec = OrtPyFunction.from_customop("LogMelSpectrogram", cpu_only=True, num_threads=2)
+        actual = log_mel_spec(np.stack([audio_pcm, audio_pcm[::-1]]))
+        self.assertEqual(actual.shape, (2, 80, frames))
+        np.testing.assert_allclose(expected, actual[0], rtol=1e-3, atol=1e-3)
+
+        # a signal of [n_samples] is a batch of one
+        actual = log_mel_spec(audio_pcm)
+        np.testing.assert_allclose(expected, actual[0], rtol=1e-3, atol=1e-3)
+
+    def test_log_mel_spectrogram_streaming(self):
+        audio_pcm = self.test_pcm
+        expected = OrtPyFunction.from_customop("LogMelSpectrogram", cpu_only=True, normalize=0)(audio_pcm)
+
+        streaming = OrtPyFunction.from_customop("LogMelSpectrogramStreaming", cpu_only=True)
+        state = np.zeros((0,), dtype=np.float32)
+        chunks = np.array_split(audio_pcm, np.arange(320, audio_pcm.shape[0], 1600 - 7))
+        frames = []
+        for i, chunk in enumerate(chunks):
+            log_mel, state = streaming(chunk, state, np.array(i == len(chunks) - 1))
+            frames.append(log_mel)
+        self.assertEqual(state.shape, (0,))
+        np.testing.assert_allclose(expected, np.concatenate(frames, axis=2), rtol=1e-5, atol=1e-5)
+
+    def test_log_mel_spectrogram_streaming_flush(self):
+        audio_pcm = self.test_pcm[:1000]
+        expected = OrtPyFunction.from_customop("LogMelSpectrogram", cpu_only=True, normalize=0)(audio_pcm)
+
+        # the flush of an empty chunk has only the frames at the end of the stream
+        streaming = OrtPyFunction.from_customop("LogMelSpectrogramStreaming", cpu_only=True)
+        log_mel, state = streaming(audio_pcm, np.zeros((0,), dtype=np.float32), np.array(False))
+        last_log_mel, state = streaming(np.zeros((0,), dtype=np.float32), state, np.array(True))
+        self.assertEqual(state.shape, (0,))
+        np.testing.assert_allclose(expected, np.concatenate([log_mel, last_log_mel], axis=2), rtol=1e-5, atol=1e-5)
+
+        # a stream of one short chunk
+        short_pcm = audio_pcm[:300]
+        expected = OrtPyFunction.from_customop("LogMelSpectrogram", cpu_only=True, normalize=0)(short_pcm)
+        log_mel, state = streaming(short_pcm, np.zeros((0,), dtype=np.float32), np.array(True))
+        np.testing.assert_allclose(expected, log_mel, rtol=1e-5, atol=1e-5)
+
+        # a stream shorter than the reflection padding of the frames
+        with self.assertRaises(Exception):
+            streaming(audio_pcm[:100], np.zeros((0,), dtype=np.float32), np.array(True))
+
+    def test_audio_chunk(self):
+        pcm = np.arange(1000, dtype=np.float32)
+        chunk = OrtPyFunction.from_customop("AudioChunk", cpu_only=True, chunk_length=400, stride=300, num_threads=2)
+        chunks, lengths = chunk(pcm)
+        self.assertEqual(chunks.shape, (4, 400))
+        np.testing.assert_array_equal(lengths, [400, 400, 400, 100])
+        for i in range(3):
+            np.testing.assert_array_equal(chunks[i], pcm[i * 300:i * 300 + 400])
+        np.testing.assert_array_equal(chunks[3], np.pad(pcm[900:], (0, 300)))
+
+        reflect = OrtPyFunction.from_customop("AudioChunk", cpu_only=True, chunk_length=400, padding="reflect")
+        chunks, lengths = reflect(np.expand_dims(pcm, 0))
+        self.assertEqual(chunks.shape, (3, 400))
+        np.testing.assert_array_equal(chunks.reshape(-1), np.pad(pcm, (0, 200), mode="reflect"))
+
+        # a short signal is one chunk, like the 30 seconds of Whisper, which is the batch of LogMelSpectrogram
+        chunks, lengths = OrtPyFunction.from_customop("AudioChunk", cpu_only=True)(self.test_pcm)
+        self.assertEqual(chunks.shape, (1, 480000))
+        np.testing.assert_array_equal(lengths, [self.test_pcm.shape[0]])
+
+    def test_voice_activity_detection(self):
+        rate = 16000
+        rng = np.random.default_rng(0)
+        tone = 0.5 * np.sin(2 * np.pi * 440 * np.arange(rate // 2) / rate)
+        silence = np.zeros(rate)
+        pcm = np.concatenate([silence, tone, silence, tone, silence]).astype(np.float32)
+        pcm += (1e-4 * rng.standard_normal(pcm.shape)).astype(np.float32)
+
+        vad = OrtPyFunction.from_customop("VoiceActivityDetection", cpu_only=True, num_threads=2)
+        segments, speech = vad(pcm)
+        self.assertEqual(segments.shape, (2, 2))
+        # the tones padded by 100 ms
+        np.testing.assert_allclose(segments, [[14400, 25600], [38400, 49600]], atol=400)
+        self.assertEqual(speech.shape, (1, int((segments[:, 1] - segments[:, 0]).sum())))
+        np.testing.assert_array_equal(speech[0], np.concatenate([pcm[b:e] for b, e in segments]))
+
+        # the second of silence is a pause of the speech with a long min_silence_duration_ms
+        vad = OrtPyFunction.from_customop("VoiceActivityDetection", cpu_only=True, min_silence_duration_ms=1500)
+        segments, _ = vad(pcm)
+        self.assertEqual(segments.shape, (1, 2))
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -69,6 +69,17 @@ class TestAutoTokenizer(unittest.TestCase):
         actual_ids = ort_tok([text])[0]
         np.testing.assert_array_equal(ids, actual_ids)
 
+    def test_gpt2_binary_vocab(self):
+        tokenizer = AutoTokenizer.from_pretrained("gpt2", use_fast=False)
+        text = "The binary vocab is loaded without parsing <|endoftext|> the text."
+        ids = tokenizer.encode(text, return_tensors="np")
+
+        ort_tok = OrtPyFunction.from_model(gen_processing_models(
+            tokenizer,
+            pre_kwargs={"WITH_DEFAULT_INPUTS": True, "binary_vocab": True})[0])
+        actual_ids = ort_tok([text])[0]
+        np.testing.assert_array_equal(ids, actual_ids)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -2,7 +2,8 @@
 import unittest
 import numpy as np
 import transformers
-from onnxruntime_extensions import PyOrtFunction, BertTokenizer, util
+from onnx import helper, onnx_pb as onnx_proto
+from onnxruntime_extensions import PyOrtFunction, BertTokenizer, util, make_onnx_model
 from transformers import BertTokenizerFast
 
 
@@ -54,6 +55,30 @@ def _run_basic_with_offset_check(input, vocab_path):
     print("\n")
 
 
+def _run_windows_case(input, vocab_path, window_length, stride):
+    # the mapping is an output of the node besides those of the op class
+    with open(vocab_path, "r", encoding="utf-8") as vocab_file:
+        vocab = vocab_file.read()
+    output_names = ["input_ids", "token_type_ids", "attention_mask", "offset_mapping", "overflow_to_sample_mapping"]
+    node = helper.make_node(
+        "BertTokenizer", ["text"], output_names, vocab_file=vocab, do_lower_case=0, strip_accents=1,
+        window_length=window_length, stride=stride, domain="ai.onnx.contrib")
+    graph = helper.make_graph(
+        [node], "bert_windows", [helper.make_tensor_value_info("text", onnx_proto.TensorProto.STRING, [None])],
+        [helper.make_tensor_value_info(name, onnx_proto.TensorProto.INT64, None) for name in output_names])
+    t2stc = PyOrtFunction.from_model(make_onnx_model(graph))
+    result = t2stc(input)
+    hf_tokenizer = BertTokenizerFast(vocab_path, do_lower_case=False, strip_accents=True)
+    expect_result = hf_tokenizer(
+        *input, max_length=window_length, stride=stride, truncation="only_second" if len(input) == 2 else True,
+        padding="max_length", return_overflowing_tokens=True, return_offsets_mapping=True)
+    np.testing.assert_array_equal(result[0], expect_result["input_ids"])
+    np.testing.assert_array_equal(result[1], expect_result["token_type_ids"])
+    np.testing.assert_array_equal(result[2], expect_result["attention_mask"])
+    np.testing.assert_array_equal(result[3], expect_result["offset_mapping"])
+    np.testing.assert_array_equal(result[4], expect_result["overflow_to_sample_mapping"])
+
+
 class TestBertTokenizer(unittest.TestCase):
     def test_text_to_case1(self):
 
@@ -114,6 +139,13 @@ class TestBertTokenizer(unittest.TestCase):
 
         print("\n*** Offset mapping tests complete. ***\n")
 
+    def test_overflowing_windows(self):
+        vocab_path = util.get_test_data_file("data", "bert_basic_cased_vocab.txt")
+        context = "The quick brown fox jumps over the lazy dog, and the dog doesn't seem to mind it at all."
+        _run_windows_case([context], vocab_path, window_length=12, stride=3)
+        _run_windows_case([context], vocab_path, window_length=64, stride=8)
+        _run_windows_case(["What does the fox do?", context], vocab_path, window_length=20, stride=4)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -37,6 +37,18 @@ def _run_indices_case(input, indices, vocab_path):
     np.testing.assert_array_equal(result, expect_result, True, False)
 
 
+def _run_batch_case(inputs, vocab_path):
+    t2stc = PyOrtFunction.from_customop(BertTokenizerDecoder, vocab_file=vocab_path, skip_special_tokens=1)
+    encoded = bert_cased_tokenizer(inputs, padding=True)["input_ids"]
+    ids = np.array(encoded, dtype=np.int64)
+    position = np.array([[]], dtype=np.int64)
+
+    # the [PAD] of the shorter rows are skipped with the other special tokens
+    result = t2stc(ids, position)
+    np.testing.assert_array_equal(result, [bert_cased_tokenizer.decode(row, skip_special_tokens=True)
+                                           for row in encoded])
+
+
 class TestBertTokenizerDecoder(unittest.TestCase):
 
     def test_text_to_case1(self):
@@ -56,6 +68,10 @@ class TestBertTokenizerDecoder(unittest.TestCase):
         _run_indices_case(input="cat isnot playing toyssss", indices=[[1, 2], [3, 5]],
                           vocab_path=util.get_test_data_file('data', 'bert_basic_cased_vocab.txt'))
 
+    def test_batch(self):
+        _run_batch_case(inputs=["Input 'text' must not be empty.", "cat isnot playing toyssss", "网易云音乐"],
+                        vocab_path=util.get_test_data_file('data', 'bert_basic_cased_vocab.txt'))
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -1,7 +1,9 @@
 # coding: utf-8
 import unittest
 import numpy as np
-from onnxruntime_extensions import util
+import onnxruntime as _ort
+from onnx import helper, onnx_pb as onnx_proto
+from onnxruntime_extensions import util, make_onnx_model, get_library_path
 from onnxruntime_extensions import PyOrtFunction, BlingFireSentenceBreaker
 
 
@@ -11,6 +13,24 @@ def _run_blingfire_sentencebreaker(input, output, model_path):
     np.testing.assert_array_equal(result, output)
 
 
+def _create_test_model_sentence_breaker(model_path, **attrs):
+    with open(model_path, "rb") as model_file:
+        model_data = model_file.read()
+    node = helper.make_node(
+        "BlingFireSentenceBreaker", ["text"], ["sentences", "row_splits", "offsets"],
+        domain="ai.onnx.contrib", model=model_data, **attrs)
+    graph = helper.make_graph(
+        [node], "test0",
+        [helper.make_tensor_value_info("text", onnx_proto.TensorProto.STRING, [None])],
+        [helper.make_tensor_value_info("sentences", onnx_proto.TensorProto.STRING, [None]),
+         helper.make_tensor_value_info("row_splits", onnx_proto.TensorProto.INT64, [None]),
+         helper.make_tensor_value_info("offsets", onnx_proto.TensorProto.INT64, [None, 2])])
+    so = _ort.SessionOptions()
+    so.register_custom_ops_library(get_library_path())
+    return _ort.InferenceSession(make_onnx_model(graph).SerializeToString(), so,
+                                 providers=["CPUExecutionProvider"])
+
+
 class TestBlingFireSentenceBreaker(unittest.TestCase):
     def test_text_to_case1(self):
         inputs = np.array(
@@ -58,6 +78,33 @@ class TestBlingFireSentenceBreaker(unittest.TestCase):
             model_path=util.get_test_data_file("data", "default_sentence_break_model.bin"),
         )
 
+    def test_text_to_batch(self):
+        documents = ["I saw a girl with a telescope. Я увидел девушку с телескопом.", "", "One sentence."]
+        sess = _create_test_model_sentence_breaker(
+            util.get_test_data_file("data", "default_sentence_break_model.bin"))
+        sentences, row_splits, offsets = sess.run(None, {"text": np.array(documents)})
+        np.testing.assert_array_equal(
+            sentences, ["I saw a girl with a telescope.", "Я увидел девушку с телескопом.", "", "One sentence."])
+        np.testing.assert_array_equal(row_splits, [0, 2, 3, 4])
+        # the offsets are the [begin, end) bytes of the sentences in their documents
+        self.assertEqual(offsets.shape, (4, 2))
+        for doc, row in enumerate(documents):
+            data = row.encode("utf-8")
+            for i in range(row_splits[doc], row_splits[doc + 1]):
+                begin, end = offsets[i]
+                self.assertEqual(data[begin:end].decode("utf-8"), sentences[i])
+
+    def test_text_to_offsets_only(self):
+        documents = ["I saw a girl with a telescope. Я увидел девушку с телескопом.", "One sentence."]
+        sess = _create_test_model_sentence_breaker(
+            util.get_test_data_file("data", "default_sentence_break_model.bin"), offsets_only=1)
+        sentences, row_splits, offsets = sess.run(None, {"text": np.array(documents)})
+        self.assertEqual(sentences.shape, (0,))
+        np.testing.assert_array_equal(row_splits, [0, 2, 3])
+        np.testing.assert_array_equal(offsets[2], [0, len("One sentence.")])
+        self.assertEqual(documents[0].encode("utf-8")[offsets[1][0]:offsets[1][1]].decode("utf-8"),
+                         "Я увидел девушку с телескопом.")
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -48,6 +48,73 @@ class TestBpeTokenizer(unittest.TestCase):
         actual_str = fn_decoder(np.asarray(test_token_ids))
         self.assertEqual(actual_str[0], expected_str)
 
+    def test_batch_decoder(self):
+        fn_decoder = PyOrtFunction.from_customop(
+            "BpeDecoder",
+            cvt=self.tokenizer_cvt.bpe_decoder,
+            skip_special_tokens=True,
+            num_threads=2)
+        test_strs = ["Hey! How are you feeling?", "J'ai l'impression que 郷さん est prêt"]
+        test_token_ids = [self.hf_processor.tokenizer.encode(s) for s in test_strs]
+        # the rows are padded with the eos, which is skipped as a special token
+        max_len = max(len(ids) for ids in test_token_ids)
+        eos = self.hf_processor.tokenizer.eos_token_id
+        batch = np.asarray([ids + [eos] * (max_len - len(ids)) for ids in test_token_ids])
+        expected = [self.hf_processor.tokenizer.decode(ids, skip_special_tokens=True) for ids in test_token_ids]
+        self.assertEqual(list(fn_decoder(batch)), expected)
+
+    def test_streaming_decoder(self):
+        fn_decoder = PyOrtFunction.from_customop(
+            "BpeStreamingDecoder",
+            cvt=self.tokenizer_cvt.bpe_decoder,
+            skip_special_tokens=True)
+        test_strs = ["Hey! How are you feeling?", "J'ai l'impression que 郷さん est prêt 🧐"]
+        test_token_ids = [self.hf_processor.tokenizer.encode(s) for s in test_strs]
+        streams = np.array([7, 11], dtype=np.int64)
+        pieces = [[], []]
+        steps = max(len(ids) for ids in test_token_ids)
+        for step in range(steps):
+            # the shorter stream is fed with the eos, which is skipped
+            eos = self.hf_processor.tokenizer.eos_token_id
+            new_ids = np.array([[ids[step] if step < len(ids) else eos] for ids in test_token_ids])
+            finished = np.array([step == steps - 1] * 2)
+            texts = fn_decoder(new_ids, streams, finished)
+            for n in range(2):
+                pieces[n].append(texts[n])
+
+        for n, ids in enumerate(test_token_ids):
+            self.assertEqual(''.join(pieces[n]),
+                             self.hf_processor.tokenizer.decode(ids, skip_special_tokens=True))
+
+    def test_streaming_decoder_max_streams(self):
+        fn_decoder = PyOrtFunction.from_customop(
+            "BpeStreamingDecoder",
+            cvt=self.tokenizer_cvt.bpe_decoder,
+            max_streams=2)
+        # the bytes of the emoji are split across its tokens, and held back by the stream until the last one
+        ids = self.hf_processor.tokenizer.encode("🧐", add_special_tokens=False)
+        self.assertGreater(len(ids), 1)
+        head = np.array([ids[:-1]], dtype=np.int64)
+        tail = np.array([ids[-1:]], dtype=np.int64)
+        other = np.array([[ids[0]]], dtype=np.int64)
+
+        def run(new_ids, stream, finished=False):
+            return fn_decoder(new_ids, np.array([stream], dtype=np.int64), np.array([finished]))[0]
+
+        self.assertEqual(run(head, 1), '')
+        self.assertEqual(run(other, 2), '')
+        self.assertEqual(run(tail, 1, True), '🧐')
+
+        # a new stream evicts the least recently run one, which loses the bytes it held back
+        self.assertEqual(run(head, 1), '')
+        run(other, 2)
+        run(other, 3)
+        self.assertNotEqual(run(tail, 1, True), '🧐')
+
+        with self.assertRaises(Exception):
+            fn_decoder(np.array([[ids[0]]] * 3, dtype=np.int64), np.array([4, 5, 6], dtype=np.int64),
+                       np.array([False] * 3))
+
 
 if __name__ == "__main__":
     unittest.main()
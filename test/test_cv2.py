@@ -1,7 +1,19 @@
+import io
 import unittest
 import numpy as np
 from PIL import Image
-from onnxruntime_extensions import OrtPyFunction, ONNXRuntimeError, util
+from onnx import helper, onnx_pb as onnx_proto
+from onnxruntime_extensions import OrtPyFunction, ONNXRuntimeError, make_onnx_model, util
+
+
+def _create_gaussian_blur_model(elem_type, num_threads):
+    nodes = [helper.make_node("GaussianBlur", ["nhwc", "kernel_size", "sigma_xy"], ["gb_nhwc"],
+                              domain="ai.onnx.contrib", num_threads=num_threads)]
+    inputs = [helper.make_tensor_value_info("nhwc", elem_type, [None, None, None, None]),
+              helper.make_tensor_value_info("kernel_size", onnx_proto.TensorProto.INT64, [2]),
+              helper.make_tensor_value_info("sigma_xy", onnx_proto.TensorProto.DOUBLE, [2])]
+    outputs = [helper.make_tensor_value_info("gb_nhwc", elem_type, [None, None, None, None])]
+    return make_onnx_model(helper.make_graph(nodes, "test_gaussian_blur", inputs, outputs))
 
 
 class TestOpenCV(unittest.TestCase):
@@ -44,6 +56,34 @@ class TestOpenCV(unittest.TestCase):
         # convimg.save('temp_pineapple.jpg')
         self.assertFalse(np.allclose(np.asarray(img), np.asarray(convimg)))
 
+    def test_gaussian_blur_batch(self):
+        img_file = util.get_test_data_file('data', 'pineapple.jpg')
+        img = np.asarray(Image.open(img_file).convert('RGB'))
+        ksize = np.array([5, 5], dtype=np.int64)
+        sigma = np.array([1.5, 1.5])
+
+        gb = OrtPyFunction.from_model(_create_gaussian_blur_model(onnx_proto.TensorProto.FLOAT, 2))
+        single = OrtPyFunction.from_customop('GaussianBlur')
+        images = np.stack([img, img[::-1], img[:, ::-1]]).astype(np.float32) / 255.
+        batch = gb(images, ksize, sigma)
+        self.assertEqual(batch.shape, images.shape)
+        for i in range(len(images)):
+            np.testing.assert_allclose(batch[i], single(images[i:i + 1], ksize, sigma)[0], rtol=1e-6)
+
+        # one and four channels
+        gray = np.ascontiguousarray(images[..., :1])
+        np.testing.assert_allclose(gb(gray, ksize, sigma), batch[..., :1], rtol=1e-6)
+        rgba = np.concatenate([images, images[..., :1]], axis=-1)
+        np.testing.assert_allclose(gb(rgba, ksize, sigma)[..., :3], batch, rtol=1e-6)
+
+        # uint8 images are blurred without a conversion to float
+        gb_uint8 = OrtPyFunction.from_model(_create_gaussian_blur_model(onnx_proto.TensorProto.UINT8, 2))
+        images_uint8 = np.stack([img, img[::-1]])
+        blurred = gb_uint8(images_uint8, ksize, sigma)
+        self.assertEqual(blurred.dtype, np.uint8)
+        expected = gb(images_uint8.astype(np.float32), ksize, sigma)
+        np.testing.assert_allclose(blurred, expected, atol=1)
+
     def test_image_decoder(self):
         input_image_file = util.get_test_data_file("data", "test_colors.jpg")
 
@@ -69,6 +109,283 @@ class TestOpenCV(unittest.TestCase):
 
         self.assertTrue(np.allclose(actual, expected, atol=1))
 
+    def test_decode_image_batch(self):
+        files = [util.get_test_data_file("data", name) for name in
+                 ["test_colors.jpg", "wolves_with_fastestDet.jpg", "pineapple.jpg"]]
+        blobs = [open(f, 'rb').read() for f in files]
+        offsets = np.cumsum([0] + [len(b) for b in blobs]).astype(np.int64)
+        images = np.frombuffer(b''.join(blobs), dtype=np.uint8)
+
+        single = OrtPyFunction.from_customop("DecodeImage")
+        batch = OrtPyFunction.from_customop("DecodeImageBatch", num_threads=2)
+        bgr, sizes = batch(images, offsets)
+        self.assertEqual(sizes.tolist(), [[1600, 2560], [334, 500], [850, 744]])
+        self.assertEqual(bgr.shape, (3, 1600, 2560, 3))
+        for i, blob in enumerate(blobs):
+            expected = single(np.frombuffer(blob, dtype=np.uint8))
+            h, w = sizes[i]
+            np.testing.assert_array_equal(bgr[i, :h, :w], expected)
+            self.assertTrue(np.all(bgr[i, h:] == 0) and np.all(bgr[i, :, w:] == 0))
+
+        resized = OrtPyFunction.from_customop("DecodeImageBatch", resize_to=[224, 224], num_threads=2)
+        bgr, sizes = resized(images, offsets)
+        self.assertEqual(bgr.shape, (3, 224, 224, 3))
+        self.assertEqual(sizes.tolist(), [[1600, 2560], [334, 500], [850, 744]])
+
+    def test_read_image_batch(self):
+        files = [util.get_test_data_file("data", name) for name in
+                 ["test_colors.jpg", "wolves_with_fastestDet.jpg", "pineapple.jpg"]]
+        blobs = [open(f, 'rb').read() for f in files]
+        offsets = np.cumsum([0] + [len(b) for b in blobs]).astype(np.int64)
+        images = np.frombuffer(b''.join(blobs), dtype=np.uint8)
+
+        decoded, decoded_sizes = OrtPyFunction.from_customop("DecodeImageBatch", min_side=224)(images, offsets)
+        reader = OrtPyFunction.from_customop("ReadImageBatch", min_side=224, num_threads=2)
+        read, read_sizes = reader(np.array(files))
+        np.testing.assert_array_equal(read_sizes, decoded_sizes)
+        np.testing.assert_array_equal(read, decoded)
+
+        with self.assertRaises(ONNXRuntimeError):
+            reader(np.array([files[0], files[0] + ".missing"]))
+
+    def test_decode_image_color_space(self):
+        input_data = np.fromfile(util.get_test_data_file("data", "wolves_with_fastestDet.jpg"), dtype=np.uint8)
+        bgr = OrtPyFunction.from_customop("DecodeImage")(input_data)
+        rgb = OrtPyFunction.from_customop("DecodeImage", color_space="RGB")(input_data)
+        np.testing.assert_array_equal(rgb, bgr[:, :, ::-1])
+
+        gray = OrtPyFunction.from_customop("DecodeImage", color_space="GRAY")(input_data)
+        self.assertEqual(gray.shape, (334, 500, 1))
+        # the luma of a JPEG image is decoded directly, which is the one of the BGR pixels up to the rounding and
+        # the clipping of the color conversion
+        luma = bgr.astype(np.float32) @ np.asarray([0.114, 0.587, 0.299], np.float32)
+        self.assertLess(np.abs(gray[:, :, 0] - luma).mean(), 1.0)
+
+        batch = OrtPyFunction.from_customop("DecodeImageBatch", color_space="GRAY")
+        gray_batch, _ = batch(input_data, np.asarray([0, len(input_data)], dtype=np.int64))
+        np.testing.assert_array_equal(gray_batch[0], gray)
+
+        # an image without the header of a JPEG or a PNG is decoded before the output is allocated
+        bmp = io.BytesIO()
+        Image.open(util.get_test_data_file("data", "wolves_with_fastestDet.jpg")).save(bmp, format="BMP")
+        bmp_data = np.frombuffer(bmp.getvalue(), dtype=np.uint8)
+        bmp_bgr = OrtPyFunction.from_customop("DecodeImage")(bmp_data)
+        bmp_rgb = OrtPyFunction.from_customop("DecodeImage", color_space="RGB")(bmp_data)
+        np.testing.assert_array_equal(bmp_rgb, bmp_bgr[:, :, ::-1])
+        np.testing.assert_array_equal(bmp_rgb, np.asarray(Image.open(bmp).convert("RGB")))
+
+    def test_encode_image_params(self):
+        input_data = np.fromfile(util.get_test_data_file("data", "wolves_with_fastestDet.jpg"), dtype=np.uint8)
+        decode = OrtPyFunction.from_customop("DecodeImage")
+        bgr = decode(input_data)
+
+        fast = OrtPyFunction.from_customop("EncodeImage", format="png", compression_level=0)(bgr)
+        small = OrtPyFunction.from_customop("EncodeImage", format="png", compression_level=9)(bgr)
+        self.assertGreater(len(fast), len(small))
+        np.testing.assert_array_equal(decode(fast), bgr)
+        np.testing.assert_array_equal(decode(small), bgr)
+
+        encode = OrtPyFunction.from_customop("EncodeImage", format="jpg", quality=30)
+        low = encode(bgr)
+        high = OrtPyFunction.from_customop("EncodeImage", format="jpg", quality=95)(bgr)
+        self.assertLess(len(low), len(high))
+        # the buffer of the kernel is reused by the next call
+        np.testing.assert_array_equal(encode(bgr), low)
+
+    def test_decode_image_normalize(self):
+        input_image_file = util.get_test_data_file("data", "test_colors.jpg")
+        mean = [0.485, 0.456, 0.406]
+        std = [0.229, 0.224, 0.225]
+        model = OrtPyFunction.from_customop("DecodeImageNormalize", resize_to=[256], crop=[224, 224],
+                                            mean=mean, std=std, num_threads=2)
+        actual = model(np.fromfile(input_image_file, dtype=np.uint8))
+        self.assertEqual(actual.shape, (3, 224, 224))
+
+        # the image of 2560x1600 is resized to 410x256, and cropped at the center
+        image = Image.open(input_image_file).convert('RGB').resize((410, 256), Image.BILINEAR)
+        expected = np.asarray(image, dtype=np.float32)[16:240, 93:317] / 255
+        expected = ((expected - np.asarray(mean, np.float32)) / np.asarray(std, np.float32)).transpose(2, 0, 1)
+        # PIL rounds the resized pixels, and its JPEG decoder differs slightly from the one of OpenCV
+        np.testing.assert_allclose(actual, expected, atol=0.05)
+
+    def test_decode_image_normalize_letterbox(self):
+        input_image_file = util.get_test_data_file("data", "test_colors.jpg")
+        letterbox_model = OrtPyFunction.from_customop("DecodeImageNormalize", letterbox=[640], num_threads=2).onnx_model
+        letterbox_model.graph.output.extend([
+            helper.make_tensor_value_info('transform', onnx_proto.TensorProto.FLOAT, [4])])
+        letterbox_model.graph.node[0].output.extend(['transform'])
+        model = OrtPyFunction.from_model(letterbox_model)
+        actual, transform = model(np.fromfile(input_image_file, dtype=np.uint8))
+        self.assertEqual(actual.shape, (3, 640, 640))
+
+        # the image of 2560x1600 is resized to 640x400 at the row 120 of the padding of 114
+        np.testing.assert_allclose(transform, [0.25, 0.25, 0, 120])
+        np.testing.assert_allclose(actual[:, :120], 114 / 255, rtol=1e-6)
+        np.testing.assert_allclose(actual[:, 520:], 114 / 255, rtol=1e-6)
+        image = Image.open(input_image_file).convert('RGB').resize((640, 400), Image.BILINEAR)
+        expected = (np.asarray(image, dtype=np.float32) / 255).transpose(2, 0, 1)
+        np.testing.assert_allclose(actual[:, 120:520], expected, atol=0.05)
+
+    def test_image_normalize(self):
+        input_image_file = util.get_test_data_file("data", "test_colors.jpg")
+        mean = [0.485, 0.456, 0.406]
+        std = [0.229, 0.224, 0.225]
+        model = OrtPyFunction.from_customop("ImageNormalize", resize_to=[256], crop=[224, 224],
+                                            mean=mean, std=std, num_threads=2)
+        rgb = np.asarray(Image.open(input_image_file).convert('RGB'))
+        bgr = np.ascontiguousarray(rgb[:, :, ::-1])
+        actual = model(np.stack([bgr, bgr[::-1]]))
+        self.assertEqual(actual.shape, (2, 3, 224, 224))
+
+        image = Image.fromarray(rgb).resize((410, 256), Image.BILINEAR)
+        expected = np.asarray(image, dtype=np.float32)[16:240, 93:317] / 255
+        expected = ((expected - np.asarray(mean, np.float32)) / np.asarray(std, np.float32)).transpose(2, 0, 1)
+        # the same decoded pixels, so only the rounding of PIL differs
+        np.testing.assert_allclose(actual[0], expected, atol=0.02)
+        np.testing.assert_allclose(actual[1], expected[:, ::-1], atol=0.02)
+
+    def test_image_normalize_resample(self):
+        # the resize and the center crop of the CLIP image processor
+        input_image_file = util.get_test_data_file("data", "test_colors.jpg")
+        rgb = np.asarray(Image.open(input_image_file).convert('RGB').resize((640, 400), Image.BILINEAR))
+        bgr = np.ascontiguousarray(rgb[:, :, ::-1])
+        for resample, pil_resample in [("bicubic", Image.BICUBIC), ("lanczos", Image.LANCZOS)]:
+            model = OrtPyFunction.from_customop("ImageNormalize", resize_to=[224], crop=[224, 224],
+                                                resample=resample, rescale_factor=1.0)
+            actual = model(bgr)
+            image = Image.fromarray(rgb).resize((358, 224), pil_resample)
+            expected = np.asarray(image, dtype=np.float32)[:, 67:291].transpose(2, 0, 1)
+            # PIL rounds the pixels of both passes
+            np.testing.assert_allclose(actual, expected, atol=2.0)
+            self.assertLess(np.abs(actual - expected).mean(), 0.5)
+
+
+    def test_image_normalize_tiles(self):
+        # the tiles of 32 of a dynamic resolution model with the thumbnail, and their patches of 8
+        input_image_file = util.get_test_data_file("data", "test_colors.jpg")
+        rgb = np.asarray(Image.open(input_image_file).convert('RGB').resize((160, 100), Image.BILINEAR))
+        bgr = np.ascontiguousarray(rgb[:, :, ::-1])
+        tiles = OrtPyFunction.from_customop("ImageNormalize", tile_size=32, max_tiles=6)(bgr)
+        # the closest ratio of 8:5 of at most 6 tiles is the grid of 2 x 3
+        self.assertEqual(tiles.shape, (7, 3, 32, 32))
+        expected = np.asarray(Image.fromarray(rgb).resize((96, 64), Image.BILINEAR), dtype=np.float32) / 255
+        expected = expected.reshape(2, 32, 3, 32, 3).transpose(0, 2, 4, 1, 3).reshape(6, 3, 32, 32)
+        np.testing.assert_allclose(tiles[:6], expected, atol=0.02)
+        thumbnail = np.asarray(Image.fromarray(rgb).resize((32, 32), Image.BILINEAR), dtype=np.float32) / 255
+        np.testing.assert_allclose(tiles[6], thumbnail.transpose(2, 0, 1), atol=0.02)
+
+        patches = OrtPyFunction.from_customop("ImageNormalize", tile_size=32, max_tiles=6, patch_size=8)(bgr)
+        self.assertEqual(patches.shape, (7, 16, 3 * 8 * 8))
+        expected = tiles.reshape(7, 3, 4, 8, 4, 8).transpose(0, 2, 4, 1, 3, 5).reshape(7, 16, 3 * 8 * 8)
+        np.testing.assert_array_equal(patches, expected)
+
+        one_tile = OrtPyFunction.from_customop("ImageNormalize", tile_size=32, max_tiles=1)(bgr)
+        self.assertEqual(one_tile.shape, (1, 3, 32, 32))
+        np.testing.assert_array_equal(one_tile[0], tiles[6])
+
+    def test_image_normalize_output_types(self):
+        input_image_file = util.get_test_data_file("data", "test_colors.jpg")
+        bgr = np.ascontiguousarray(np.asarray(Image.open(input_image_file).convert('RGB'))[:, :, ::-1])
+        attributes = dict(resize_to=[64], crop=[64, 64], mean=[0.485, 0.456, 0.406], std=[0.229, 0.224, 0.225])
+        expected = OrtPyFunction.from_customop("ImageNormalize", **attributes)(bgr)
+
+        def normalize(elem_type, **kwargs):
+            model = OrtPyFunction.from_customop("ImageNormalize", **attributes, **kwargs).onnx_model
+            model.graph.output[0].type.tensor_type.elem_type = elem_type
+            return OrtPyFunction.from_model(model)(bgr)
+
+        halves = normalize(onnx_proto.TensorProto.FLOAT16)
+        self.assertEqual(halves.dtype, np.float16)
+        np.testing.assert_array_equal(halves, expected.astype(np.float16))
+
+        quantized = normalize(onnx_proto.TensorProto.UINT8, output_scale=0.02, output_zero_point=128)
+        self.assertEqual(quantized.dtype, np.uint8)
+        np.testing.assert_allclose(quantized, np.clip(np.round(expected / 0.02) + 128, 0, 255), atol=1)
+        quantized = normalize(onnx_proto.TensorProto.INT8, output_scale=0.02)
+        self.assertEqual(quantized.dtype, np.int8)
+        np.testing.assert_allclose(quantized, np.clip(np.round(expected / 0.02), -128, 127), atol=1)
+
+    def test_frame_normalize(self):
+        input_image_file = util.get_test_data_file("data", "test_colors.jpg")
+        rgb = np.asarray(Image.open(input_image_file).convert('RGB').resize((320, 200)))
+        bgr = np.ascontiguousarray(rgb[:, :, ::-1])
+        normalize = OrtPyFunction.from_customop("ImageNormalize", letterbox=[160], num_threads=2)
+
+        def frame_normalize(**kwargs):
+            frame_model = OrtPyFunction.from_customop("FrameNormalize", letterbox=[160], **kwargs).onnx_model
+            frame_model.graph.input.extend([
+                helper.make_tensor_value_info('plane1', onnx_proto.TensorProto.UINT8, [None, None]),
+                helper.make_tensor_value_info('plane2', onnx_proto.TensorProto.UINT8, [None, None]),
+                helper.make_tensor_value_info('metadata', onnx_proto.TensorProto.INT64, [None])])
+            frame_model.graph.node[0].input.extend(['plane1', 'plane2', 'metadata'])
+            return OrtPyFunction.from_model(frame_model)
+
+        # the frame of BGRA with the padding of the rows is the same as its BGR pixels
+        bgra = np.zeros((200, 1300), dtype=np.uint8)
+        bgra[:, :1280] = np.concatenate([bgr, np.full((200, 320, 1), 255, np.uint8)], axis=2).reshape(200, 1280)
+        empty = np.zeros((0, 0), dtype=np.uint8)
+        actual = frame_normalize(format="BGRA")(bgra, empty, empty, np.array([320], dtype=np.int64))
+        np.testing.assert_array_equal(actual, normalize(bgr))
+
+        # the NV21 of the full range in one buffer, like the camera of Android, which is rotated by 270 degrees
+        yuv = rgb.astype(np.float32) @ np.asarray([[0.299, -0.168736, 0.5],
+                                                   [0.587, -0.331264, -0.418688],
+                                                   [0.114, 0.5, -0.081312]], np.float32) + [0, 128, 128]
+        yuv = np.clip(np.round(yuv), 0, 255)
+        chroma = yuv[::2, ::2, 1:]  # the top left of every 2x2
+        nv21 = np.concatenate([yuv[:, :, 0], chroma[:, :, ::-1].reshape(100, 320)]).astype(np.uint8)
+        actual = frame_normalize(format="NV21", yuv_range="full")(
+            nv21, empty, empty, np.array([320, 200, 270], dtype=np.int64))
+
+        # the BGR of the frame, whose chroma is of the 2x2 pixels, turned counterclockwise
+        u, v = (chroma[:, :, i].repeat(2, axis=0).repeat(2, axis=1) - 128 for i in range(2))
+        luma = yuv[:, :, 0]
+        converted = np.stack([luma + 1.772 * u, luma - 0.344136 * u - 0.714136 * v, luma + 1.402 * v], axis=2)
+        converted = np.clip(np.round(converted), 0, 255).astype(np.uint8)
+        np.testing.assert_allclose(actual, normalize(np.ascontiguousarray(np.rot90(converted))), atol=2 / 255)
+
+    def test_detection_postprocess(self):
+        rng = np.random.default_rng(0)
+        num_anchors, num_classes = 2000, 5
+        centers = rng.uniform(0, 640, (num_anchors, 2))
+        sizes = rng.uniform(10, 80, (num_anchors, 2))
+        scores = rng.uniform(0, 1, (num_anchors, num_classes)) ** 4
+        predictions = np.concatenate([centers, sizes, scores], axis=1).astype(np.float32)
+
+        # the greedy NMS of every class over the boxes of XYXY sorted by the score
+        boxes = np.concatenate([centers - sizes / 2, centers + sizes / 2], axis=1).astype(np.float32)
+        labels = scores.argmax(axis=1)
+        best = scores.max(axis=1).astype(np.float32)
+        kept = []
+        for i in sorted(np.nonzero(best >= 0.25)[0], key=lambda i: -best[i]):
+            def iou(j):
+                w = max(0, min(boxes[i, 2], boxes[j, 2]) - max(boxes[i, 0], boxes[j, 0]))
+                h = max(0, min(boxes[i, 3], boxes[j, 3]) - max(boxes[i, 1], boxes[j, 1]))
+                area = lambda k: (boxes[k, 2] - boxes[k, 0]) * (boxes[k, 3] - boxes[k, 1])
+                return w * h / (area(i) + area(j) - w * h)
+            if all(labels[j] != labels[i] or iou(j) <= 0.45 for j in kept):
+                kept.append(i)
+        expected = np.concatenate([boxes[kept], best[kept, None], labels[kept, None]], axis=1)
+
+        model = OrtPyFunction.from_customop("DetectionPostProcess", cpu_only=True, max_detections=0, num_threads=2)
+        actual = model(predictions)
+        np.testing.assert_allclose(actual, expected, rtol=1e-5, atol=1e-3)
+
+        # the transposed output of [1, values, anchors] of YOLOv8 and the cap of the detections
+        model = OrtPyFunction.from_customop("DetectionPostProcess", cpu_only=True, transposed=1, max_detections=10)
+        actual = model(np.expand_dims(predictions.T, 0))
+        np.testing.assert_allclose(actual, expected[:10], rtol=1e-5, atol=1e-3)
+
+        # the boxes of the letterbox of 640x400 at the row 120 of an image of 1280x800
+        transform_model = OrtPyFunction.from_customop("DetectionPostProcess", max_detections=0).onnx_model
+        transform_model.graph.input.extend([
+            helper.make_tensor_value_info('transform', onnx_proto.TensorProto.FLOAT, [4])])
+        transform_model.graph.node[0].input.extend(['transform'])
+        model = OrtPyFunction.from_model(transform_model, cpu_only=True)
+        actual = model(predictions, np.array([0.5, 0.5, 0, 120], dtype=np.float32))
+        expected[:, [1, 3]] -= 120
+        expected[:, :4] *= 2
+        np.testing.assert_allclose(actual, expected, rtol=1e-5, atol=1e-3)
 
 if __name__ == "__main__":
     unittest.main()
@@ -3,7 +3,7 @@ import numpy as np
 import onnxruntime as _ort
 
 from onnx import helper, onnx_pb as onnx_proto
-from transformers import GPT2Tokenizer
+from transformers import GPT2Tokenizer, GPT2TokenizerFast
 from onnxruntime_extensions import (
     PyCustomOpDef,
     onnx_op, util,
@@ -135,6 +135,178 @@ class TestGPT2Tokenizer(unittest.TestCase):
         expect_input_ids = gpt2_out[0]
         np.testing.assert_array_equal(expect_input_ids, outputs[0])
 
+    def test_overflowing_windows(self):
+        enable_py_op(False)
+
+        input1 = helper.make_tensor_value_info('string_input', onnx_proto.TensorProto.STRING, [None])
+        outputs = [helper.make_tensor_value_info(name, onnx_proto.TensorProto.INT64, None)
+                   for name in ['input_ids', 'attention_mask', 'overflow_to_sample_mapping']]
+        node = [helper.make_node(
+            'GPT2Tokenizer', ['string_input'], [o.name for o in outputs], vocab=_get_file_content(self.tokjson),
+            merges=_get_file_content(self.merges), name='bpetok', window_length=8, stride=2,
+            domain='ai.onnx.contrib')]
+        model = make_onnx_model(helper.make_graph(node, 'test0', [input1], outputs))
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+
+        texts = ["I can feel the magic, can you? Yes I do, and the magic is all around us.", "Hey Cortana"]
+        input_ids, attention_mask, mapping = sess.run(None, {'string_input': np.array(texts)})
+
+        tokenizer = GPT2TokenizerFast(self.tokjson, self.merges)
+        tokenizer.pad_token = '!'  # padding token = 0
+        expected = tokenizer(texts, max_length=8, stride=2, truncation=True, padding="max_length",
+                             return_overflowing_tokens=True)
+        np.testing.assert_array_equal(input_ids, expected["input_ids"])
+        np.testing.assert_array_equal(attention_mask, expected["attention_mask"])
+        np.testing.assert_array_equal(mapping, expected["overflow_to_sample_mapping"])
+
+    def test_padded_length(self):
+        enable_py_op(False)
+
+        input1 = helper.make_tensor_value_info('string_input', onnx_proto.TensorProto.STRING, [None])
+        outputs = [helper.make_tensor_value_info(name, onnx_proto.TensorProto.INT64, None)
+                   for name in ['input_ids', 'attention_mask', 'overflow_to_sample_mapping', 'length_order']]
+        texts = ["I can feel the magic, can you?", "Hey Cortana", "Yes I do, and the magic is around us."]
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        for attrs, expected_length in [(dict(pad_to_multiple_of=8), 16), (dict(length_buckets=[4, 12, 32]), 12),
+                                       (dict(length_buckets=[4], pad_to_multiple_of=5), 15)]:
+            node = [helper.make_node(
+                'GPT2Tokenizer', ['string_input'], [o.name for o in outputs], vocab=_get_file_content(self.tokjson),
+                merges=_get_file_content(self.merges), name='bpetok', domain='ai.onnx.contrib', **attrs)]
+            model = make_onnx_model(helper.make_graph(node, 'test0', [input1], outputs))
+            sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+            input_ids, attention_mask, _, order = sess.run(None, {'string_input': np.array(texts)})
+
+            # the rows are the ones padded to the longest, with more padding to the rounded length
+            expect_input_ids, expect_attention_mask = self.tokenizer.tokenizer_sentence(texts, -1)
+            self.assertEqual(input_ids.shape, (3, expected_length))
+            np.testing.assert_array_equal(input_ids[:, :expect_input_ids.shape[1]], expect_input_ids)
+            np.testing.assert_array_equal(attention_mask[:, :expect_input_ids.shape[1]], expect_attention_mask)
+            np.testing.assert_array_equal(attention_mask[:, expect_input_ids.shape[1]:], 0)
+            np.testing.assert_array_equal(order, np.argsort(expect_attention_mask.sum(axis=1), kind='stable'))
+
+    def test_dedup(self):
+        enable_py_op(False)
+
+        input1 = helper.make_tensor_value_info('string_input', onnx_proto.TensorProto.STRING, [None])
+        outputs = [helper.make_tensor_value_info(name, onnx_proto.TensorProto.INT64, None)
+                   for name in ['input_ids', 'attention_mask']]
+        texts = ["Hey Cortana", "", "I can feel the magic, can you?", "Hey Cortana", "", "Hey Cortana"]
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        for padding_length in [-1, 5]:
+            node = [helper.make_node(
+                'GPT2Tokenizer', ['string_input'], [o.name for o in outputs], vocab=_get_file_content(self.tokjson),
+                merges=_get_file_content(self.merges), name='bpetok', padding_length=padding_length, dedup=1,
+                num_threads=2, domain='ai.onnx.contrib')]
+            model = make_onnx_model(helper.make_graph(node, 'test0', [input1], outputs))
+            sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+            input_ids, attention_mask = sess.run(None, {'string_input': np.array(texts)})
+
+            # the repeated texts are tokenized once, into the same rows as without the dedup
+            expect_input_ids, expect_attention_mask = self.tokenizer.tokenizer_sentence(texts, padding_length)
+            np.testing.assert_array_equal(input_ids, expect_input_ids)
+            np.testing.assert_array_equal(attention_mask, expect_attention_mask)
+
+    def test_output_dtype(self):
+        enable_py_op(False)
+
+        input1 = helper.make_tensor_value_info('string_input', onnx_proto.TensorProto.STRING, [None])
+        outputs = [helper.make_tensor_value_info(name, onnx_proto.TensorProto.INT32, None)
+                   for name in ['input_ids', 'attention_mask']]
+        texts = ["Hey Cortana", "I can feel the magic, can you?", ""]
+        node = [helper.make_node(
+            'GPT2Tokenizer', ['string_input'], [o.name for o in outputs], vocab=_get_file_content(self.tokjson),
+            merges=_get_file_content(self.merges), name='bpetok', output_dtype=onnx_proto.TensorProto.INT32,
+            domain='ai.onnx.contrib')]
+        model = make_onnx_model(helper.make_graph(node, 'test0', [input1], outputs))
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+        input_ids, attention_mask = sess.run(None, {'string_input': np.array(texts)})
+
+        # the ids of the int64 outputs, written as int32 by the tokenizer without a Cast
+        self.assertEqual(input_ids.dtype, np.int32)
+        self.assertEqual(attention_mask.dtype, np.int32)
+        expect_input_ids, expect_attention_mask = self.tokenizer.tokenizer_sentence(texts, -1)
+        np.testing.assert_array_equal(input_ids, expect_input_ids)
+        np.testing.assert_array_equal(attention_mask, expect_attention_mask)
+
+    def test_ragged(self):
+        enable_py_op(False)
+
+        input1 = helper.make_tensor_value_info('string_input', onnx_proto.TensorProto.STRING, [None])
+        outputs = [helper.make_tensor_value_info(name, onnx_proto.TensorProto.INT64, None)
+                   for name in ['input_ids', 'row_splits', 'overflow_to_sample_mapping', 'length_order']]
+        texts = ["Hey Cortana", "", "I can feel the magic, can you?", "Hey Cortana"]
+        node = [helper.make_node(
+            'GPT2Tokenizer', ['string_input'], [o.name for o in outputs], vocab=_get_file_content(self.tokjson),
+            merges=_get_file_content(self.merges), name='bpetok', ragged=1, domain='ai.onnx.contrib')]
+        model = make_onnx_model(helper.make_graph(node, 'test0', [input1], outputs))
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+        input_ids, row_splits, _, order = sess.run(None, {'string_input': np.array(texts)})
+
+        # the rows of the padded ids without their padding
+        expect_input_ids, expect_attention_mask = self.tokenizer.tokenizer_sentence(texts, -1)
+        lengths = expect_attention_mask.sum(axis=1)
+        np.testing.assert_array_equal(row_splits, np.concatenate([[0], np.cumsum(lengths)]))
+        np.testing.assert_array_equal(input_ids, expect_input_ids[expect_attention_mask == 1])
+        np.testing.assert_array_equal(order, np.argsort(lengths, kind='stable'))
+
+    def test_prefix_cache(self):
+        enable_py_op(False)
+
+        input1 = helper.make_tensor_value_info('string_input', onnx_proto.TensorProto.STRING, [None])
+        output1 = helper.make_tensor_value_info('input_ids', onnx_proto.TensorProto.INT64, None)
+        node = [helper.make_node(
+            'GPT2Tokenizer', ['string_input'], ['input_ids'], vocab=_get_file_content(self.tokjson),
+            merges=_get_file_content(self.merges), name='bpetok', prefix_cache_capacity=64, domain='ai.onnx.contrib')]
+        model = make_onnx_model(helper.make_graph(node, 'test0', [input1], [output1]))
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+
+        # the questions after the same system prompt have the ids of the whole texts
+        system_prompt = "You are a helpful assistant, who answers the questions of  the user.\n" * 20
+        for question in ["Hey Cortana", "I can feel the magic, can you?", "", "\n\n" + system_prompt]:
+            text = system_prompt + question
+            input_ids = sess.run(None, {'string_input': np.array([text])})[0]
+            expect_input_ids, _ = self.tokenizer.tokenizer_sentence([text], -1)
+            np.testing.assert_array_equal(input_ids, expect_input_ids)
+
+    def test_text_pair(self):
+        enable_py_op(False)
+
+        input1 = helper.make_tensor_value_info('string_input', onnx_proto.TensorProto.STRING, [None])
+        input2 = helper.make_tensor_value_info('text_pair', onnx_proto.TensorProto.STRING, [None])
+        outputs = [helper.make_tensor_value_info(name, onnx_proto.TensorProto.INT64, None)
+                   for name in ['input_ids', 'attention_mask', 'token_type_ids']]
+        node = [helper.make_node(
+            'GPT2Tokenizer', ['string_input', 'text_pair'], ['input_ids', 'attention_mask', '', '', 'token_type_ids'],
+            vocab=_get_file_content(self.tokjson), merges=_get_file_content(self.merges), name='bpetok',
+            padding_length=12, domain='ai.onnx.contrib')]
+        model = make_onnx_model(helper.make_graph(node, 'test0', [input1, input2], outputs))
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+
+        queries = ["I can feel the magic, can you?", "Hey Cortana"]
+        passages = ["Yes I do, and the magic is all around us.", "Hello"]
+        input_ids, attention_mask, token_type_ids = sess.run(
+            None, {'string_input': np.array(queries), 'text_pair': np.array(passages)})
+
+        tokenizer = GPT2TokenizerFast(self.tokjson, self.merges)
+        tokenizer.pad_token = '!'  # padding token = 0
+        expected = tokenizer(queries, passages, max_length=12, truncation='longest_first', padding="max_length",
+                             return_token_type_ids=True)
+        np.testing.assert_array_equal(input_ids, expected["input_ids"])
+        np.testing.assert_array_equal(attention_mask, expected["attention_mask"])
+        np.testing.assert_array_equal(token_type_ids, expected["token_type_ids"])
+
     def test_tokenizer_pyop(self):
         self._run_tokenizer(["I can feel the magic, can you?"])
         self._run_tokenizer(["Hey Cortana"])
@@ -0,0 +1,104 @@
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+import unittest
+import numpy as np
+import onnxruntime as _ort
+
+from onnx import helper, onnx_pb as onnx_proto
+from transformers import AutoTokenizer
+from onnxruntime_extensions import make_onnx_model, get_library_path as _get_library_path
+
+
+def _create_test_model(tokenizer_json, **attrs):
+    input1 = helper.make_tensor_value_info('string_input', onnx_proto.TensorProto.STRING, [None])
+    outputs = [helper.make_tensor_value_info(name, onnx_proto.TensorProto.INT64, [None, None])
+               for name in ['input_ids', 'attention_mask']]
+    node = [helper.make_node(
+        'HfTokenizer', ['string_input'], [o.name for o in outputs], tokenizer_json=tokenizer_json,
+        name='hf_tokenizer', domain='ai.onnx.contrib', **attrs)]
+    return make_onnx_model(helper.make_graph(node, 'test0', [input1], outputs))
+
+
+def _create_chat_model(tokenizer_json, **attrs):
+    inputs = [helper.make_tensor_value_info(name, onnx_proto.TensorProto.STRING, [None])
+              for name in ['roles', 'contents']]
+    inputs.append(helper.make_tensor_value_info('row_splits', onnx_proto.TensorProto.INT64, [None]))
+    outputs = [helper.make_tensor_value_info(name, onnx_proto.TensorProto.INT64, [None])
+               for name in ['input_ids', 'ids_splits']]
+    node = [helper.make_node(
+        'HfChatTokenizer', ['roles', 'contents', 'row_splits'], ['input_ids', 'ids_splits'],
+        tokenizer_json=tokenizer_json, name='hf_chat_tokenizer', domain='ai.onnx.contrib', **attrs)]
+    return make_onnx_model(helper.make_graph(node, 'test0', inputs, outputs))
+
+
+# the Jinja template of ChatML without a default system message, which the chatml preset renders
+_CHATML = ("{% for message in messages %}{{ '<|im_start|>' + message['role'] + '\\n' + message['content'] + "
+           "'<|im_end|>\\n' }}{% endfor %}{% if add_generation_prompt %}{{ '<|im_start|>assistant\\n' }}{% endif %}")
+
+
+class TestHfTokenizer(unittest.TestCase):
+    texts = ["I can feel the magic, can you?", "Hey Cortana", "", "lower newer  <mask> ok", "今天天气很好"]
+
+    def _check(self, name, texts, max_length=None, **attrs):
+        tokenizer = AutoTokenizer.from_pretrained(name, use_fast=True)
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        if max_length is not None:
+            attrs['padding_length'] = max_length
+        model = _create_test_model(tokenizer.backend_tokenizer.to_str(), **attrs)
+        sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+        input_ids, attention_mask = sess.run(None, {'string_input': np.array(texts)})
+
+        if tokenizer.pad_token is None:
+            tokenizer.pad_token = tokenizer.eos_token
+        if max_length is None:
+            expected = tokenizer(texts, padding=True)
+        else:
+            expected = tokenizer(texts, truncation=True, max_length=max_length, padding='max_length')
+        # the padding id of the kernel is 0
+        np.testing.assert_array_equal(np.array(expected['input_ids']) * attention_mask, input_ids)
+        np.testing.assert_array_equal(expected['attention_mask'], attention_mask)
+
+    def test_gpt2(self):
+        self._check("gpt2", self.texts, num_threads=2)
+
+    def test_roberta(self):
+        # RobertaProcessing adds <s> and </s>, and the <mask> of RoBERTa takes the space before it
+        self._check("roberta-base", self.texts)
+        self._check("roberta-base", self.texts, max_length=6)
+
+    def test_xlm_roberta(self):
+        # the texts have nothing for the Precompiled normalizer of XLM-R, which is skipped
+        self._check("xlm-roberta-base", self.texts, skip_unicode_normalization=1)
+        self._check("xlm-roberta-base", self.texts, max_length=6, skip_unicode_normalization=1)
+
+    def test_llama(self):
+        # the BPE of the characters with byte_fallback, whose normalizer is Prepend and Replace
+        self._check("hf-internal-testing/llama-tokenizer", self.texts + ["emoji \U0001F917 and \u2581"])
+        self._check("hf-internal-testing/llama-tokenizer", self.texts, max_length=5)
+
+    def test_chat_template(self):
+        tokenizer = AutoTokenizer.from_pretrained("Qwen/Qwen2-0.5B-Instruct", use_fast=True)
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        conversations = [
+            [{'role': 'system', 'content': 'You are terse.'}, {'role': 'user', 'content': 'Hey Cortana'}],
+            [{'role': 'user', 'content': '今天天气很好<|im_end|> ok'}],
+        ]
+        roles = [m['role'] for c in conversations for m in c]
+        contents = [m['content'] for c in conversations for m in c]
+        for add_generation_prompt in [0, 1]:
+            model = _create_chat_model(tokenizer.backend_tokenizer.to_str(), chat_template='chatml',
+                                       add_generation_prompt=add_generation_prompt)
+            sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+            input_ids, ids_splits = sess.run(None, {
+                'roles': np.array(roles), 'contents': np.array(contents),
+                'row_splits': np.array([0, 2, 3], dtype=np.int64)})
+            for i, conversation in enumerate(conversations):
+                expected = tokenizer.apply_chat_template(conversation, chat_template=_CHATML, tokenize=True,
+                                                         add_generation_prompt=bool(add_generation_prompt))
+                np.testing.assert_array_equal(expected, input_ids[ids_splits[i]:ids_splits[i + 1]])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,63 @@
+import os
+import tempfile
+import unittest
+import numpy as np
+from onnx import helper, onnx_pb as onnx_proto
+import onnxruntime as _ort
+from onnxruntime_extensions import make_onnx_model, get_library_path as _get_library_path
+
+
+def _run_int64_mapping(input, **kwargs):
+    inputs = [helper.make_tensor_value_info('input', onnx_proto.TensorProto.INT64, None)]
+    outputs = [helper.make_tensor_value_info('output', onnx_proto.TensorProto.INT64, None)]
+    node = helper.make_node('Int64Mapping', ['input'], ['output'], domain='ai.onnx.contrib', **kwargs)
+    model = make_onnx_model(helper.make_graph([node], 'int64_mapping', inputs, outputs))
+
+    so = _ort.SessionOptions()
+    so.register_custom_ops_library(_get_library_path())
+    sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+    return sess.run(None, {'input': input})[0]
+
+
+class TestInt64Mapping(unittest.TestCase):
+
+    def test_attributes(self):
+        input = np.array([[1000, 7, -3], [np.iinfo(np.int64).min, 1000, 8]], dtype=np.int64)
+        output = _run_int64_mapping(input, keys=[1000, 7, -3, np.iinfo(np.int64).min, 7],
+                                    values=[0, 1, 2, 3, 4], default_value=-1)
+        np.testing.assert_array_equal(output, [[0, 4, 2], [3, 0, -1]])
+
+    def test_map_file(self):
+        rng = np.random.default_rng(0)
+        keys = np.unique(rng.integers(-2**62, 2**62, size=100000, dtype=np.int64))
+        values = np.arange(len(keys), dtype=np.int64)
+        with tempfile.TemporaryDirectory() as temp_dir:
+            path = os.path.join(temp_dir, 'map.bin')
+            np.stack([keys, values], axis=1).astype('<i8').tofile(path)
+            input = np.concatenate([keys[::7], np.array([1, 2, 3], dtype=np.int64)])
+            output = _run_int64_mapping(input, map_path=path, default_value=-5)
+        np.testing.assert_array_equal(output[:-3], values[::7])
+        np.testing.assert_array_equal(output[-3:], [-5, -5, -5])
+
+    def test_map_file_in_asset_dir(self):
+        keys = np.array([3, 5], dtype=np.int64)
+        with tempfile.TemporaryDirectory() as temp_dir:
+            asset_dir = os.path.join(temp_dir, 'assets')
+            os.makedirs(asset_dir)
+            for path in [os.path.join(asset_dir, 'map.bin'), os.path.join(temp_dir, 'map.bin')]:
+                np.stack([keys, np.array([0, 1], dtype=np.int64)], axis=1).astype('<i8').tofile(path)
+
+            os.environ['ORTX_ASSET_DIR'] = asset_dir
+            try:
+                output = _run_int64_mapping(keys, map_path='map.bin', default_value=-1)
+                np.testing.assert_array_equal(output, [0, 1])
+                # the paths of the model can't read the files out of the directory of the assets
+                for path in ['../map.bin', os.path.join(temp_dir, 'map.bin')]:
+                    with self.assertRaises(Exception):
+                        _run_int64_mapping(keys, map_path=path, default_value=-1)
+            finally:
+                del os.environ['ORTX_ASSET_DIR']
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -1,6 +1,8 @@
 import unittest
 import numpy as np
-from onnxruntime_extensions import PyOrtFunction, MaskedFill
+import onnxruntime as _ort
+from onnx import helper, onnx_pb as onnx_proto
+from onnxruntime_extensions import PyOrtFunction, MaskedFill, make_onnx_model, get_library_path
 
 
 def read_file(path):
@@ -14,6 +16,20 @@ def run_string_remove(value, mask, output):
     np.testing.assert_array_equal(result, output)
 
 
+def run_masked_fill_axis(value, mask, axis, elem_type):
+    node = helper.make_node('MaskedFill', ['value', 'mask'], ['output'], domain='ai.onnx.contrib', axis=axis)
+    graph = helper.make_graph(
+        [node], 'test_masked_fill',
+        [helper.make_tensor_value_info('value', elem_type, [None] * value.ndim),
+         helper.make_tensor_value_info('mask', onnx_proto.TensorProto.BOOL, [None])],
+        [helper.make_tensor_value_info('output', elem_type, [None] * value.ndim)])
+    so = _ort.SessionOptions()
+    so.register_custom_ops_library(get_library_path())
+    sess = _ort.InferenceSession(make_onnx_model(graph).SerializeToString(), so, providers=['CPUExecutionProvider'])
+    result = sess.run(None, {'value': value, 'mask': mask})[0]
+    np.testing.assert_array_equal(result, np.compress(mask, value, axis=axis))
+
+
 class TestMaskedFill(unittest.TestCase):
 
     def test_string_remove_case1(self):
@@ -37,3 +53,14 @@ class TestMaskedFill(unittest.TestCase):
             value=np.array(["As", "fast", "as", "thou", "shalt", "wane", "", "so", "fast", "thou", "grow’st"]),
             mask=np.array([True, True, True, True, True, True, False, True, True, True, True], dtype=bool),
             output=np.array(["As", "fast", "as", "thou", "shalt", "wane", "so", "fast", "thou", "grow’st"]))
+
+    def test_masked_fill_axis(self):
+        mask = np.array([True, False, True, True], dtype=bool)
+        run_masked_fill_axis(np.arange(24, dtype=np.float32).reshape(2, 4, 3), mask, 1, onnx_proto.TensorProto.FLOAT)
+        run_masked_fill_axis(np.arange(8, dtype=np.int64).reshape(2, 4), mask, -1, onnx_proto.TensorProto.INT64)
+        run_masked_fill_axis(np.array([["a", "b", "c", "d"], ["e", "f", "g", "h"]]), mask, 1,
+                             onnx_proto.TensorProto.STRING)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -84,6 +84,107 @@ class TestMathOpString(unittest.TestCase):
             self.assertEqual(tfres.shape, txout[0].shape)
             self.assertEqual(tfres.numpy().tolist(), txout[0].tolist())
 
+    def test_segment_sum_double(self):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        node = helper.make_node("SegmentSum", ["data", "segment_ids"], ["z"], domain="ai.onnx.contrib")
+        graph = helper.make_graph(
+            [node], "test0",
+            [helper.make_tensor_value_info("data", onnx_proto.TensorProto.DOUBLE, [None, None]),
+             helper.make_tensor_value_info("segment_ids", onnx_proto.TensorProto.INT64, [None])],
+            [helper.make_tensor_value_info("z", onnx_proto.TensorProto.DOUBLE, [None, None])])
+        sess = _ort.InferenceSession(make_onnx_model(graph).SerializeToString(), so,
+                                     providers=['CPUExecutionProvider'])
+        data = np.random.rand(1000, 64)
+        segment_ids = np.repeat(np.arange(1, 51), 20)
+        exp = np.zeros((51, 64))
+        np.add.at(exp, segment_ids, data)
+        txout = sess.run(None, {"data": data, "segment_ids": segment_ids})
+        np.testing.assert_allclose(exp, txout[0])
+
+        with self.assertRaises(Exception):
+            sess.run(None, {"data": data[:3], "segment_ids": np.array([0, 2, 2], dtype=np.int64)})
+
+    def test_unsorted_segment_sum(self):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        node = helper.make_node("UnsortedSegmentSum", ["data", "segment_ids", "num_segments"], ["z"],
+                                domain="ai.onnx.contrib")
+        graph = helper.make_graph(
+            [node], "test0",
+            [helper.make_tensor_value_info("data", onnx_proto.TensorProto.FLOAT, [None, None]),
+             helper.make_tensor_value_info("segment_ids", onnx_proto.TensorProto.INT64, [None]),
+             helper.make_tensor_value_info("num_segments", onnx_proto.TensorProto.INT64, [])],
+            [helper.make_tensor_value_info("z", onnx_proto.TensorProto.FLOAT, [None, None])])
+        sess = _ort.InferenceSession(make_onnx_model(graph).SerializeToString(), so,
+                                     providers=['CPUExecutionProvider'])
+        data = np.array([[1, 2, 3, 4], [4, 3, 2, 1], [5, 6, 7, 8], [1, 1, 1, 1]], dtype=np.float32)
+        segment_ids = np.array([2, 0, 2, -1], dtype=np.int64)
+        exp = np.array([[4, 3, 2, 1], [0, 0, 0, 0], [6, 8, 10, 12]], dtype=np.float32)
+        txout = sess.run(None, {"data": data, "segment_ids": segment_ids,
+                                "num_segments": np.array(3, dtype=np.int64)})
+        self.assertEqual(exp.tolist(), txout[0].tolist())
+
+        with self.assertRaises(Exception):
+            sess.run(None, {"data": data, "segment_ids": segment_ids, "num_segments": np.array(2, dtype=np.int64)})
+
+    def test_logits_sampler(self):
+        logits = np.random.rand(8, 1000).astype(np.float32)
+        no_ids = np.zeros((8, 0), dtype=np.int64)
+        greedy = OrtPyFunction.from_customop('LogitsSampler', temperature=0.0)
+        np.testing.assert_array_equal(greedy(logits, no_ids), np.argmax(logits, axis=1)[:, np.newaxis])
+
+        # the most likely ids are penalized below the others
+        top = np.argmax(logits, axis=1)[:, np.newaxis]
+        penalized = OrtPyFunction.from_customop('LogitsSampler', temperature=0.0, repetition_penalty=100.0)
+        self.assertFalse(np.any(penalized(logits, top) == top))
+
+        top_k = OrtPyFunction.from_customop('LogitsSampler', top_k=3, seed=7)
+        ids = top_k(logits, no_ids)
+        self.assertEqual(ids.shape, (8, 1))
+        top3 = np.argsort(-logits, axis=1)[:, :3]
+        self.assertTrue(all(ids[b, 0] in top3[b] for b in range(8)))
+        # a seed draws the same tokens
+        self.assertEqual(ids.tolist(), OrtPyFunction.from_customop('LogitsSampler', top_k=3, seed=7)(
+            logits, no_ids).tolist())
+
+    def test_logits_processor(self):
+        logits = np.random.randn(4, 1000).astype(np.float32)
+        generated = np.array([[5, 5, 7], [9, -1, -1], [-1, -1, -1], [1, 2, 3]], dtype=np.int64)
+        processor = OrtPyFunction.from_customop(
+            'LogitsProcessor', temperature=0.5, repetition_penalty=1.5, frequency_penalty=0.1, min_length=2,
+            eos_token_ids=[0], bad_words_ids=[3, -1, 2, 3, 4])
+
+        expected = logits.copy()
+        for b, row in enumerate(generated):
+            ids, counts = np.unique(row[row >= 0], return_counts=True)
+            x = expected[b, ids]
+            expected[b, ids] = np.where(x > 0, x / 1.5, x * 1.5) - 0.1 * counts
+        expected /= 0.5
+        expected[1:3, 0] = -np.inf  # the rows of fewer than 2 ids
+        expected[:, 3] = -np.inf
+        expected[3, 4] = -np.inf  # the row which ends with 2, 3
+        np.testing.assert_allclose(processor(logits, generated), expected, rtol=1.e-6)
+
+    def test_embedding_pooling(self):
+        hidden = np.random.rand(3, 7, 16).astype(np.float32)
+        mask = np.ones((3, 7), dtype=np.int64)
+        mask[1, 4:] = 0
+        mask[2, 1:] = 0
+        valid = mask[:, :, np.newaxis] != 0
+
+        mean = OrtPyFunction.from_customop('EmbeddingPooling')
+        expected = (hidden * valid).sum(axis=1) / valid.sum(axis=1)
+        np.testing.assert_allclose(mean(hidden, mask), expected, rtol=1.e-5)
+
+        max_pool = OrtPyFunction.from_customop('EmbeddingPooling', mode='max', normalize=1)
+        expected = np.where(valid, hidden, -np.inf).max(axis=1)
+        expected /= np.linalg.norm(expected, axis=1, keepdims=True)
+        np.testing.assert_allclose(max_pool(hidden, mask), expected, rtol=1.e-5)
+
+        cls_pool = OrtPyFunction.from_customop('EmbeddingPooling', mode='cls')
+        np.testing.assert_array_equal(cls_pool(hidden, mask), hidden[:, 0, :])
+
     def test_inverse(self):
         mat = np.random.rand(5, 5).astype(np.float32)
         inv_mat = np.linalg.inv(mat)
@@ -91,6 +192,14 @@ class TestMathOpString(unittest.TestCase):
         act_mat = ort_inv(mat)
         self.assertTrue(np.allclose(inv_mat, act_mat, rtol=1.e-3))
 
+    def test_inverse_batched(self):
+        ort_inv = OrtPyFunction.from_customop('Inverse')
+        for n in (2, 3, 4, 7):
+            mat = (np.random.rand(2, 50, n, n) + np.eye(n) * n).astype(np.float32)
+            act_mat = ort_inv(mat)
+            self.assertEqual(mat.shape, act_mat.shape)
+            np.testing.assert_allclose(np.linalg.inv(mat), act_mat, rtol=1.e-3, atol=1.e-5)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -138,6 +138,28 @@ class TestPythonOp(unittest.TestCase):
             pos[x < 0] = 0
             return neg, pos
 
+        @onnx_op(op_type="PyOutNegPos",
+                 inputs=[PyCustomOpDef.dt_float],
+                 outputs=[PyCustomOpDef.dt_float, PyCustomOpDef.dt_float],
+                 output_shapes=lambda x: [x.shape, x.shape])
+        def negpos_out(x, out):
+            neg, pos = out
+            np.minimum(x, 0, out=neg)
+            np.maximum(x, 0, out=pos)
+
+        @onnx_op(op_type="PyKeepAddEpsilon",
+                 inputs=[PyCustomOpDef.dt_double],
+                 outputs=[PyCustomOpDef.dt_double])
+        def keep_add_epsilon(x):
+            TestPythonOp._kept = x
+            return x + 1e-3
+
+        @onnx_op(op_type="PyReturnInput",
+                 inputs=[PyCustomOpDef.dt_double],
+                 outputs=[PyCustomOpDef.dt_double])
+        def return_input(x):
+            return x
+
         @onnx_op(op_type="PyOpJoin",
                  inputs=[PyCustomOpDef.dt_string],
                  outputs=[PyCustomOpDef.dt_string],
@@ -182,6 +204,41 @@ class TestPythonOp(unittest.TestCase):
         diff = x - (neg + pos)
         assert_almost_equal(diff, np.zeros(diff.shape))
 
+    def test_python_negpos_out(self):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        onnx_model = _create_test_model_2outputs('PyOut')
+        sess = _ort.InferenceSession(onnx_model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+        x = np.array([[0., 1., 1.5], [7., 8., -5.5]]).astype(np.float32)
+        neg, pos = sess.run(None, {'x': x})
+        assert_almost_equal(neg, np.minimum(x, 0))
+        assert_almost_equal(pos, np.maximum(x, 0))
+
+    def test_python_input_kept(self):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        onnx_model = _create_test_model_double('PyKeep')
+        sess = _ort.InferenceSession(onnx_model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+        # the inputs are views of the tensors of the call, which a function can't keep
+        with self.assertRaises(Exception):
+            sess.run(None, {'input_1': np.array([[0., 1.]])})
+        del TestPythonOp._kept
+
+    def test_python_input_returned(self):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        node = helper.make_node('PyReturnInput', ['input_1'], ['output'], domain='ai.onnx.contrib')
+        graph = helper.make_graph(
+            [node], 'test0',
+            [helper.make_tensor_value_info('input_1', onnx_proto.TensorProto.DOUBLE, [None, None])],
+            [helper.make_tensor_value_info('output', onnx_proto.TensorProto.DOUBLE, [None, None])])
+        sess = _ort.InferenceSession(make_onnx_model(graph).SerializeToString(), so,
+                                     providers=['CPUExecutionProvider'])
+        # the returned view of the input is copied into the output before the views are checked
+        input_1 = np.array([[0., 1.], [2.5, -3.]])
+        txout = sess.run(None, {'input_1': input_1})
+        np.testing.assert_array_equal(txout[0], input_1)
+
     def test_cc_negpos(self):
         so = _ort.SessionOptions()
         so.register_custom_ops_library(_get_library_path())
@@ -193,6 +250,12 @@ class TestPythonOp(unittest.TestCase):
         diff = x - (neg + pos)
         assert_almost_equal(diff, np.zeros(diff.shape))
 
+        # large enough to be split across the threads
+        x = np.random.randn(1000, 1001).astype(np.float32)
+        neg, pos = sess.run(None, {'x': x})
+        np.testing.assert_array_equal(neg, np.where(x > 0, 0, x))
+        np.testing.assert_array_equal(pos, np.where(x > 0, x, 0))
+
     def test_check_saved_model(self):
         this = os.path.dirname(__file__)
         so = _ort.SessionOptions()
@@ -0,0 +1,105 @@
+# coding: utf-8
+import unittest
+import numpy as np
+from onnx import helper, onnx_pb as onnx_proto
+import onnxruntime as _ort
+from onnxruntime_extensions import make_onnx_model, get_library_path as _get_library_path
+
+
+def _create_ragged_pipeline_model():
+    # the sentences of the documents are split into their words, lowercased and only padded by the last node
+    nodes = [
+        helper.make_node(
+            'StringECMARegexSplitWithOffsets', ['sentences', 'pattern', 'keep_pattern', 'row_splits'],
+            ['words', 'begins', 'ends', 'word_splits'], domain='ai.onnx.contrib'),
+        helper.make_node('StringLower', ['words'], ['lower'], domain='ai.onnx.contrib'),
+        helper.make_node(
+            'StringRaggedTensorToDense', ['unused', 'lower', 'word_splits', 'default_value'], ['dense'],
+            domain='ai.onnx.contrib'),
+    ]
+    unused = helper.make_tensor('unused', onnx_proto.TensorProto.INT64, [0], [])
+    default_value = helper.make_tensor('default_value', onnx_proto.TensorProto.STRING, [1], [b'<pad>'])
+    inputs = [
+        helper.make_tensor_value_info('sentences', onnx_proto.TensorProto.STRING, [None]),
+        helper.make_tensor_value_info('pattern', onnx_proto.TensorProto.STRING, []),
+        helper.make_tensor_value_info('keep_pattern', onnx_proto.TensorProto.STRING, []),
+        helper.make_tensor_value_info('row_splits', onnx_proto.TensorProto.INT64, [None]),
+    ]
+    outputs = [
+        helper.make_tensor_value_info('dense', onnx_proto.TensorProto.STRING, [None, None]),
+        helper.make_tensor_value_info('word_splits', onnx_proto.TensorProto.INT64, [None]),
+    ]
+    graph = helper.make_graph(nodes, 'test0', inputs, outputs, [unused, default_value])
+    return make_onnx_model(graph)
+
+
+def _create_string_ragged_to_dense_model():
+    nodes = [
+        helper.make_node(
+            'StringRaggedTensorToDense', ['unused', 'values', 'row_splits', 'default_value'], ['dense'],
+            domain='ai.onnx.contrib'),
+    ]
+    unused = helper.make_tensor('unused', onnx_proto.TensorProto.INT64, [0], [])
+    inputs = [
+        helper.make_tensor_value_info('values', onnx_proto.TensorProto.STRING, [None]),
+        helper.make_tensor_value_info('row_splits', onnx_proto.TensorProto.INT64, [None]),
+        helper.make_tensor_value_info('default_value', onnx_proto.TensorProto.STRING, [None]),
+    ]
+    outputs = [helper.make_tensor_value_info('dense', onnx_proto.TensorProto.STRING, [None, None])]
+    graph = helper.make_graph(nodes, 'test1', inputs, outputs, [unused])
+    return make_onnx_model(graph)
+
+
+class TestRaggedStrings(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        cls.sess = _ort.InferenceSession(_create_ragged_pipeline_model().SerializeToString(), so,
+                                         providers=['CPUExecutionProvider'])
+
+    def _run(self, sentences, row_splits):
+        return self.sess.run(None, {
+            'sentences': np.array(sentences, dtype=object),
+            'pattern': np.array(' ', dtype=object),
+            'keep_pattern': np.array('', dtype=object),
+            'row_splits': np.array(row_splits, dtype=np.int64)})
+
+    def test_pipeline(self):
+        # two documents of two and one sentences, and an empty one
+        dense, word_splits = self._run(['Hello World', 'A b C', 'One'], [0, 2, 2, 3])
+        np.testing.assert_array_equal(word_splits, [0, 5, 5, 6])
+        np.testing.assert_array_equal(dense, [
+            ['hello', 'world', 'a', 'b', 'c'],
+            ['<pad>', '<pad>', '<pad>', '<pad>', '<pad>'],
+            ['one', '<pad>', '<pad>', '<pad>', '<pad>']])
+
+    def test_invalid_row_splits(self):
+        with self.assertRaisesRegex(Exception, 'row_splits must go from 0 to the 2 values'):
+            self._run(['a', 'b'], [0, 1])
+        with self.assertRaisesRegex(Exception, 'row_splits must be non-decreasing'):
+            self._run(['a', 'b'], [0, 2, 1, 2])
+
+    def test_string_ragged_tensor_to_dense(self):
+        # the rows are the ones of the row splits, not of the default value, which only pads them
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        sess = _ort.InferenceSession(_create_string_ragged_to_dense_model().SerializeToString(), so,
+                                     providers=['CPUExecutionProvider'])
+
+        def run(values, row_splits, default_value):
+            return sess.run(None, {
+                'values': np.array(values, dtype=object),
+                'row_splits': np.array(row_splits, dtype=np.int64),
+                'default_value': np.array(default_value, dtype=object)})[0]
+
+        dense = run(['a', 'b', 'c', 'd'], [0, 1, 1, 4], ['x'])
+        np.testing.assert_array_equal(dense, [['a', 'x', 'x'], ['x', 'x', 'x'], ['b', 'c', 'd']])
+        # without a default value, the padding is the empty string
+        dense = run(['a', 'b', 'c', 'd'], [0, 1, 1, 4], [])
+        np.testing.assert_array_equal(dense, [['a', '', ''], ['', '', ''], ['b', 'c', 'd']])
+        self.assertEqual(run([], [0], ['x']).shape, (0, 0))
+
+
+if __name__ == '__main__':
+    unittest.main()
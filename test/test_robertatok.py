@@ -146,6 +146,31 @@ class TestRobertaTokenizer(unittest.TestCase):
         np.testing.assert_array_equal(expect_input_ids, outputs1[0])
         np.testing.assert_array_equal(expect_attention_mask, outputs1[1])
 
+    def test_text_pair(self):
+        input1 = helper.make_tensor_value_info('string_input', onnx_proto.TensorProto.STRING, [None])
+        input2 = helper.make_tensor_value_info('text_pair', onnx_proto.TensorProto.STRING, [None])
+        outputs = [helper.make_tensor_value_info(name, onnx_proto.TensorProto.INT64, ["batch_size", "num_ids"])
+                   for name in ['input_ids', 'attention_mask', 'token_type_ids']]
+        node = [helper.make_node(
+            'RobertaTokenizer', ['string_input', 'text_pair'], ['input_ids', 'attention_mask', '', 'token_type_ids'],
+            vocab=_get_file_content(self.tokjson), merges=_get_file_content(self.merges), name='bpetok',
+            padding_length=16, domain='ai.onnx.contrib')]
+        model = make_onnx_model(helper.make_graph(node, 'test0', [input1, input2], outputs))
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+
+        queries = ["what is a cat?", "One Microsoft Way", ""]
+        passages = ["a photo of a cat, a photo of a dog and a photo of a mouse", "Redmond, WA", "lower newer"]
+        input_ids, attention_mask, token_type_ids = sess.run(
+            None, {'string_input': np.array(queries), 'text_pair': np.array(passages)})
+        expected = self.tokenizer(queries, passages, truncation='longest_first', max_length=16,
+                                  padding='max_length', return_token_type_ids=True)
+        # the padding id of the kernel is 0
+        np.testing.assert_array_equal(np.array(expected['input_ids']) * attention_mask, input_ids)
+        np.testing.assert_array_equal(expected['attention_mask'], attention_mask)
+        np.testing.assert_array_equal(expected['token_type_ids'], token_type_ids)
+
 
 if __name__ == "__main__":
     unittest.main()
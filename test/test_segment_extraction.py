@@ -33,6 +33,24 @@ class TestSegmentExtraction(unittest.TestCase):
         value = [1, 3]
         _run_segment_extraction(inputs, position, value)
 
+    def test_long_input(self):
+        # the runs cross the chunks which are scanned on their own, one of them through several chunks
+        rng = np.random.default_rng(0)
+        values = rng.integers(0, 4, 20000)
+        lengths = rng.integers(1, 60, 20000)
+        lengths[100] = 200000
+        inputs = np.repeat(values, lengths).astype(np.int64)
+        ends = np.cumsum(lengths)
+        starts = ends - lengths
+        # the runs of equal values next to each other are one segment
+        keep = np.concatenate([[True], values[1:] != values[:-1]])
+        merged_starts = starts[keep]
+        merged_ends = np.concatenate([merged_starts[1:], [len(inputs)]])
+        merged_values = values[keep]
+        nonzero = merged_values != 0
+        position = np.stack([merged_starts[nonzero], merged_ends[nonzero]], axis=1)
+        _run_segment_extraction(inputs[np.newaxis, :], position, merged_values[nonzero])
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -457,6 +457,79 @@ class TestOrtXSentencePiece(unittest.TestCase):
             np.array([flags & 4], dtype=np.bool_))
         self.assertEqual(tokens.tolist(), [1095, 4054, 26, 2022, 755, 99935])
 
+    def test_batch_with_threads(self):
+        fullname = util.get_test_data_file('data', 'en.wiki.bpe.vs100000.model')
+        model = open(fullname, 'rb').read()
+        single = OrtPyFunction.from_customop('SentencepieceTokenizer', model=model)
+        multi = OrtPyFunction.from_customop('SentencepieceTokenizer', model=model, num_threads=4)
+
+        texts = np.array(['best hotel in bay area.', '', 'a quick brown fox'] * 50)
+        for flags in range(0, 8):
+            args = (np.array([0], dtype=np.int64),
+                    np.array([0], dtype=np.float32),
+                    np.array([flags & 1], dtype=np.bool_),
+                    np.array([flags & 2], dtype=np.bool_),
+                    np.array([flags & 4], dtype=np.bool_))
+            expected = single(texts, *args)
+            actual = multi(texts, *args)
+            np.testing.assert_array_equal(expected[0], actual[0])
+            np.testing.assert_array_equal(expected[1], actual[1])
+
+    def test_dense_output(self):
+        fullname = util.get_test_data_file('data', 'en.wiki.bpe.vs100000.model')
+        model = open(fullname, 'rb').read()
+        ragged = OrtPyFunction.from_customop('SentencepieceTokenizer', model=model)
+        texts = np.array(['best hotel in bay area.', '', 'a quick brown fox jumps over the lazy dog'])
+        args = (np.array([0], dtype=np.int64),
+                np.array([0], dtype=np.float32),
+                np.array([True]), np.array([True]), np.array([False]))
+        tokens, indices = ragged(texts, *args)
+        rows = [tokens[indices[i]:indices[i + 1]].tolist() for i in range(len(texts))]
+
+        for padding_length in [-1, 8]:
+            graph = _create_test_model_sentencepiece('', model)
+            node = graph.graph.node[0]
+            node.attribute.append(helper.make_attribute('padding_length', padding_length))
+            node.output.append('mask')
+            del graph.graph.output[:]
+            graph.graph.output.extend([
+                helper.make_tensor_value_info('out0', onnx_proto.TensorProto.INT32, [None, None]),
+                helper.make_tensor_value_info('out1', onnx_proto.TensorProto.INT64, [None]),
+                helper.make_tensor_value_info('mask', onnx_proto.TensorProto.INT64, [None, None])])
+            dense, _, mask = OrtPyFunction.from_model(graph)(texts, *args)
+
+            length = max(len(r) for r in rows) if padding_length < 0 else padding_length
+            self.assertEqual(dense.shape, (len(texts), length))
+            for i, row in enumerate(rows):
+                # the truncated row keeps its eos
+                expected = row if len(row) <= length else row[:length - 1] + row[-1:]
+                self.assertEqual(dense[i, :len(expected)].tolist(), expected)
+                self.assertEqual(mask[i].tolist(), [1] * len(expected) + [0] * (length - len(expected)))
+
+        # the Python definition of the op has the mask output with padding_length
+        padded = OrtPyFunction.from_customop('SentencepieceTokenizer', model=model, padding_length=-1)
+        dense, _, mask = padded(texts, *args)
+        self.assertEqual(dense.shape, mask.shape)
+        self.assertEqual(mask.sum(), sum(len(r) for r in rows))
+
+    def test_sampling(self):
+        fullname = util.get_test_data_file('data', 'en.wiki.bpe.vs100000.model')
+        model = open(fullname, 'rb').read()
+        ofunc = OrtPyFunction.from_customop('SentencepieceTokenizer', model=model)
+        decoder = OrtPyFunction.from_customop('SentencepieceDecoder', model=model)
+
+        # the BPE-dropout splits the words into the smaller pieces, which still decode to the text
+        text = 'best hotel in bay area.'
+        tokens, indices = ofunc(
+            np.array([text] * 20),
+            np.array([-1], dtype=np.int64),
+            np.array([0.5], dtype=np.float32),
+            np.array([False]), np.array([False]), np.array([False]))
+        self.assertGreater(indices[-1], 20 * 6)
+        for i in range(20):
+            row = tokens[indices[i]:indices[i + 1]].astype(np.int64)
+            self.assertEqual(' '.join(decoder(row)), text)
+
 
     def test_spm_decoder(self):
         fullname = util.get_test_data_file('data', 'en.wiki.bpe.vs100000.model')
@@ -465,6 +538,42 @@ class TestOrtXSentencePiece(unittest.TestCase):
         result = ofunc(np.array([1095, 4054, 26, 2022, 755, 99935], dtype=np.int64))
         self.assertEqual(' '.join(result), 'best hotel in bay area.')
 
+    def test_spm_decoder_without_dummy_prefix(self):
+        fullname = util.get_test_data_file('data', 'en.wiki.bpe.vs100000.model')
+        # the appended normalizer_spec is merged into the model one, clearing add_dummy_prefix and
+        # remove_extra_whitespaces, and the leading space is kept like SentencePieceProcessor::Decode does
+        model = open(fullname, 'rb').read() + b'\x1a\x04\x18\x00\x20\x00'
+        ofunc = OrtPyFunction.from_customop('SentencepieceDecoder', model=model)
+
+        result = ofunc(np.array([1095, 4054, 26, 2022, 755, 99935], dtype=np.int64))
+        self.assertEqual(' '.join(result), ' best hotel in bay area.')
+
+    def test_batch_decoder(self):
+        fullname = util.get_test_data_file('data', 'en.wiki.bpe.vs100000.model')
+        model = open(fullname, 'rb').read()
+        ofunc = OrtPyFunction.from_customop('SentencepieceTokenizer', model=model)
+        decoder = OrtPyFunction.from_customop('SentencepieceDecoder', model=model)
+        batch_decoder = OrtPyFunction.from_customop('SentencepieceDecoder', model=model, num_threads=4)
+
+        texts = ['best hotel in bay area.', 'Hello world!', 'the quick brown fox jumps over the lazy dog',
+                 'unbelievably long words', '  leading spaces', 'numbers 12345 and symbols #@!']
+        tokens, indices = ofunc(
+            np.array(texts),
+            np.array([0], dtype=np.int64),
+            np.array([0], dtype=np.float32),
+            np.array([False]), np.array([False]), np.array([False]))
+        length = min(indices[i + 1] - indices[i] for i in range(len(texts)))
+        rows = [tokens[indices[i]:indices[i] + length].astype(np.int64) for i in range(len(texts))]
+
+        # every row of the last dimension is decoded like a single sequence
+        result = batch_decoder(np.stack(rows).reshape(2, 3, length))
+        self.assertEqual(result.shape, (2, 3))
+        expected = [decoder(row)[0] for row in rows]
+        self.assertEqual(result.reshape(-1).tolist(), expected)
+        self.assertEqual(decoder(np.stack(rows)).tolist(), expected)
+        self.assertEqual(decoder(np.array([[1095, 4054, 26, 2022, 755, 99935]], dtype=np.int64)).tolist(),
+                         ['best hotel in bay area.'])
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,70 @@
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+import json
+import os
+import subprocess
+import sys
+import unittest
+from pathlib import Path
+
+
+# the variable is read once by the process, so the sessions are created in another one
+_SCRIPT = r'''
+import json
+import sys
+import numpy as np
+import onnxruntime as _ort
+from onnx import helper, onnx_pb as onnx_proto
+from onnxruntime_extensions import make_onnx_model, get_library_path, get_runtime_stats
+
+
+def create_model(vocab, **attrs):
+    node = [helper.make_node('BertTokenizer', ['text'], ['input_ids', 'token_type_ids', 'attention_mask'],
+                             vocab_file=vocab, domain='ai.onnx.contrib', **attrs)]
+    inputs = [helper.make_tensor_value_info('text', onnx_proto.TensorProto.STRING, [None])]
+    outputs = [helper.make_tensor_value_info(name, onnx_proto.TensorProto.INT64, [None])
+               for name in ['input_ids', 'token_type_ids', 'attention_mask']]
+    return make_onnx_model(helper.make_graph(node, 'test0', inputs, outputs)).SerializeToString()
+
+
+def session(model):
+    so = _ort.SessionOptions()
+    so.register_custom_ops_library(get_library_path())
+    return _ort.InferenceSession(model, so, providers=['CPUExecutionProvider'])
+
+
+vocab = open(sys.argv[1], encoding='utf-8').read()
+model = create_model(vocab)
+sessions = [session(model) for _ in range(3)] + [session(create_model(vocab, do_lower_case=0))]
+text = np.array(['Hello World, I am here.'])
+ids = [s.run(None, {'text': text})[0].tolist() for s in sessions]
+counters = get_runtime_stats()['counters']
+print(json.dumps({'ids': ids, 'hits': counters.get('shared_kernels.hits', 0),
+                  'misses': counters.get('shared_kernels.misses', 0)}))
+'''
+
+
+class TestSharedKernels(unittest.TestCase):
+    def _run(self, share):
+        env = dict(os.environ)
+        env['ORTX_SHARE_KERNELS'] = share
+        vocab = Path(__file__).parent / 'data' / 'bert_basic_cased_vocab.txt'
+        out = subprocess.run([sys.executable, '-c', _SCRIPT, str(vocab)], env=env, check=True,
+                             capture_output=True, text=True).stdout
+        return json.loads(out.strip().splitlines()[-1])
+
+    def test_shared_kernels(self):
+        # the sessions of the same attributes share a kernel, and the one of another do_lower_case doesn't
+        shared = self._run('1')
+        self.assertEqual(shared['hits'], 2)
+        self.assertEqual(shared['misses'], 2)
+
+        separate = self._run('0')
+        self.assertEqual(separate['hits'], 0)
+        self.assertEqual(separate['misses'], 0)
+        self.assertEqual(shared['ids'], separate['ids'])
+        self.assertEqual(shared['ids'][0], shared['ids'][1])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -5,7 +5,7 @@ import onnxruntime as _ort
 from onnxruntime_extensions import get_library_path as _get_library_path, make_onnx_model
 
 
-def _create_test_model(input_dims, output_dims):
+def _create_test_model(input_dims, output_dims, input2_dims=None):
     nodes = []
     nodes[0:] = [helper.make_node('Identity', ['input_1'], ['left'])]
     nodes[1:] = [helper.make_node('Identity', ['input_2'], ['right'])]
@@ -15,7 +15,7 @@ def _create_test_model(input_dims, output_dims):
     input1 = helper.make_tensor_value_info(
         'input_1', onnx_proto.TensorProto.STRING, [None] * input_dims)
     input2 = helper.make_tensor_value_info(
-        'input_2', onnx_proto.TensorProto.STRING, [None] * input_dims)
+        'input_2', onnx_proto.TensorProto.STRING, [None] * (input_dims if input2_dims is None else input2_dims))
     output = helper.make_tensor_value_info(
         'output', onnx_proto.TensorProto.STRING, [None] * output_dims)
 
@@ -25,7 +25,7 @@ def _create_test_model(input_dims, output_dims):
 
 
 def _run_string_concat(input1, input2):
-    model = _create_test_model(input1.ndim, input1.ndim)
+    model = _create_test_model(input1.ndim, max(input1.ndim, input2.ndim), input2.ndim)
 
     so = _ort.SessionOptions()
     so.register_custom_ops_library(_get_library_path())
@@ -33,13 +33,7 @@ def _run_string_concat(input1, input2):
     result = sess.run(None, {'input_1': input1, 'input_2': input2})
 
     # verify
-    output = []
-    shape = input1.shape
-    input1 = input1.flatten()
-    input2 = input2.flatten()
-    for i in range(len(input1)):
-        output.append(input1[i] + input2[i])
-    output = np.array(output).reshape(shape)
+    output = input1.astype(object) + input2.astype(object)
     np.testing.assert_array_equal(result, [output])
 
 
@@ -57,6 +51,17 @@ class TestStringConcat(unittest.TestCase):
         _run_string_concat(np.array(["👾 🤖 🎃 😺 😸 😹"]), np.array(["😻 😼 😽 🙀 😿 😾"]))
         _run_string_concat(np.array(["龖"]), np.array(["龘讋"]))
 
+    def test_string_concat_broadcast(self):
+        _run_string_concat(np.array(["a", "b", "c"]), np.array(["_x"]))
+        _run_string_concat(np.array(["key:"]), np.array([["a", "b"], ["c", "d"]]))
+        _run_string_concat(np.array([["a"], ["b"], ["c"]]), np.array(["1", "2", "3", "4"]))
+        _run_string_concat(np.array([["a", "b"], ["c", "d"]]), np.array(["é", "😺"]))
+        _run_string_concat(np.array([], dtype=object).reshape(0, 2), np.array(["x", "y"]))
+
+    def test_string_concat_shape_mismatch(self):
+        with self.assertRaises(Exception):
+            _run_string_concat(np.array(["a", "b", "c"]), np.array(["x", "y"]))
+
 
 if __name__ == "__main__":
     unittest.main()
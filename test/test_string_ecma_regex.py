@@ -77,6 +77,39 @@ def _create_test_model_string_regex_split(prefix, domain="ai.onnx.contrib"):
     return model
 
 
+def _create_test_model_split_and_slice(domain="ai.onnx.contrib"):
+    # the tokens of the split are only its offsets, which the slice takes with the input
+    nodes = [
+        helper.make_node(
+            "StringECMARegexSplitWithOffsets",
+            ["input", "pattern", "keep_pattern"],
+            ["no_tokens", "begins", "ends", "row_indices"],
+            domain=domain,
+            offsets_only=1,
+        ),
+        helper.make_node(
+            "StringSliceWithOffsets",
+            ["input", "begins", "ends", "row_indices"],
+            ["tokens"],
+            domain=domain,
+        ),
+    ]
+
+    inputs = [
+        helper.make_tensor_value_info(name, onnx_proto.TensorProto.STRING, [])
+        for name in ["input", "pattern", "keep_pattern"]
+    ]
+    outputs = [
+        helper.make_tensor_value_info("no_tokens", onnx_proto.TensorProto.STRING, []),
+        helper.make_tensor_value_info("tokens", onnx_proto.TensorProto.STRING, []),
+        helper.make_tensor_value_info("begins", onnx_proto.TensorProto.INT64, []),
+    ]
+
+    graph = helper.make_graph(nodes, "test0", inputs, outputs)
+    model = make_onnx_model(graph)
+    return model
+
+
 class TestStringECMARegex(unittest.TestCase):
     def test_string_replace_cc(self):
         so = _ort.SessionOptions()
@@ -226,3 +259,17 @@ class TestStringECMARegex(unittest.TestCase):
             self.assertEqual(tf_begins.numpy().tolist(), txout[1].tolist())
             self.assertEqual(tf_ends.numpy().tolist(), txout[2].tolist())
             self.assertEqual(tf_rows.numpy().tolist(), txout[3].tolist())
+
+    def test_string_regex_split_offsets_only(self):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        onnx_model = _create_test_model_split_and_slice()
+        sess = _ort.InferenceSession(onnx_model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+        input = np.array(["hello there", "", "hello  there"])
+        txout = sess.run(
+            None, {"input": input, "pattern": np.array(["(\\s)"]), "keep_pattern": np.array(["\\s"])}
+        )
+
+        self.assertEqual([], txout[0].tolist())
+        self.assertEqual(["hello", " ", "there", "hello", " ", " ", "there"], txout[1].tolist())
+        self.assertEqual([0, 5, 6, 0, 5, 6, 7], txout[2].tolist())
@@ -0,0 +1,31 @@
+import unittest
+import numpy as np
+from onnxruntime_extensions import PyOrtFunction, StringMultiReplace
+
+
+def _run_string_multi_replace(input, output, **kwargs):
+    replace = PyOrtFunction.from_customop(StringMultiReplace, **kwargs)
+    result = replace(input)
+    np.testing.assert_array_equal(result, output)
+
+
+class TestStringMultiReplace(unittest.TestCase):
+
+    def test_multi_replace(self):
+        _run_string_multi_replace(input=np.array(["Dr. Smith &amp; Mr. Jones", "Mrs. Dr", ""]),
+                                  output=np.array(["Doctor Smith & Mister Jones", "Mrs. Dr", ""]),
+                                  map={"Mr.": "Mister", "Dr.": "Doctor", "&amp;": "&"})
+
+    def test_longest_leftmost(self):
+        _run_string_multi_replace(input=np.array([["hello world", "help below"], ["halo wall", "also wall"]]),
+                                  output=np.array([["hi world", "He bW"], ["ha wall", "als_all"]]),
+                                  map="he\tHe\nhello\thi\nlo\t\no w\t_\nlp\t\nlow\tW\n")
+
+    def test_threads(self):
+        input = np.array(["a{}b".format(i) * 10 for i in range(100)])
+        output = np.array([s.replace("a", "<").replace("b", ">") for s in input])
+        _run_string_multi_replace(input=input, output=output, map={"a": "<", "b": ">"}, num_threads=4)
+
+
+if __name__ == "__main__":
+    unittest.main()
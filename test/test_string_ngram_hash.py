@@ -0,0 +1,122 @@
+import unittest
+import numpy as np
+from onnx import helper, onnx_pb as onnx_proto
+import onnxruntime as _ort
+from onnxruntime_extensions import make_onnx_model, get_library_path as _get_library_path, hash_64
+
+NUM_BUCKETS = 1 << 20
+
+
+def _run_ngram_hash(input, row_splits=None, op_type='StringNGramHash', **kwargs):
+    inputs = [helper.make_tensor_value_info('input', onnx_proto.TensorProto.STRING, [None])]
+    feeds = {'input': input}
+    if row_splits is not None:
+        inputs.append(helper.make_tensor_value_info('row_splits', onnx_proto.TensorProto.INT64, [None]))
+        feeds['row_splits'] = row_splits
+    if op_type == 'StringNGramHash':
+        outputs = [helper.make_tensor_value_info('ids', onnx_proto.TensorProto.INT64, None),
+                   helper.make_tensor_value_info('out_row_splits', onnx_proto.TensorProto.INT64, [None])]
+    else:
+        outputs = [helper.make_tensor_value_info('indices', onnx_proto.TensorProto.INT64, [None, 2]),
+                   helper.make_tensor_value_info('values', onnx_proto.TensorProto.FLOAT, [None]),
+                   helper.make_tensor_value_info('dense_shape', onnx_proto.TensorProto.INT64, [2])]
+    node = helper.make_node(op_type, [i.name for i in inputs], [o.name for o in outputs],
+                            domain='ai.onnx.contrib', num_buckets=NUM_BUCKETS, **kwargs)
+    model = make_onnx_model(helper.make_graph([node], 'ngram_hash', inputs, outputs))
+    return _run_model(model, feeds)
+
+
+def _run_model(model, feeds):
+    so = _ort.SessionOptions()
+    so.register_custom_ops_library(_get_library_path())
+    sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+    return sess.run(None, feeds)
+
+
+class TestStringNGramHash(unittest.TestCase):
+
+    def test_word_ngrams(self):
+        ids, splits = _run_ngram_hash(np.array(["a b  a b", "", "c"]), word_ngram_max=2)
+        np.testing.assert_array_equal(splits, [0, 7, 7, 8])
+        # the unigrams, then bigrams after each word: a, a b, b, b a, a, a b, b
+        self.assertEqual(ids[0], hash_64("a", NUM_BUCKETS, True))
+        self.assertEqual(ids[2], hash_64("b", NUM_BUCKETS, True))
+        self.assertEqual(ids[7], hash_64("c", NUM_BUCKETS, True))
+        np.testing.assert_array_equal(ids[0:3], ids[4:7])
+        self.assertNotEqual(ids[1], ids[3])
+
+    def test_char_ngrams(self):
+        ids, splits = _run_ngram_hash(np.array(["ab", "xab", "été"]),
+                                      word_ngram_max=0, char_ngram_min=1, char_ngram_max=3)
+        # <a <ab a ab ab> b b>, and the chars of the UTF-8 are whole
+        np.testing.assert_array_equal(splits, [0, 7, 17, 27])
+        self.assertEqual(len(set(ids[0:7])), 7)
+        # "a", "ab" and "ab>" of xab are the ones of ab
+        for i in (12, 13, 14):
+            self.assertIn(ids[i], ids[0:7])
+
+    def test_tokens(self):
+        text_ids, text_splits = _run_ngram_hash(np.array(["the cat sat", "on the mat"]),
+                                                word_ngram_max=3, char_ngram_min=2, char_ngram_max=4)
+        ids, splits = _run_ngram_hash(np.array(["the", "cat", "sat", "on", "the", "mat"]),
+                                      row_splits=np.array([0, 3, 6], dtype=np.int64),
+                                      word_ngram_max=3, char_ngram_min=2, char_ngram_max=4)
+        np.testing.assert_array_equal(ids, text_ids)
+        np.testing.assert_array_equal(splits, text_splits)
+
+    def test_fixed_length(self):
+        ragged, _ = _run_ngram_hash(np.array(["a b c d", "e"]))
+        ids, splits = _run_ngram_hash(np.array(["a b c d", "e"]), max_length=3, padding_value=-1)
+        np.testing.assert_array_equal(ids, [ragged[0:3], [ragged[4], -1, -1]])
+        np.testing.assert_array_equal(splits, [0, 3, 4])
+
+    def test_threads(self):
+        input = np.array(["w{} x{} y{}".format(i, i % 7, i % 3) for i in range(200)])
+        expected = _run_ngram_hash(input, word_ngram_max=2, char_ngram_min=3, char_ngram_max=5)
+        result = _run_ngram_hash(input, word_ngram_max=2, char_ngram_min=3, char_ngram_max=5, num_threads=4)
+        np.testing.assert_array_equal(result[0], expected[0])
+        np.testing.assert_array_equal(result[1], expected[1])
+
+    def test_sparse(self):
+        input = np.array(["a b a b", "", "c a"])
+        kwargs = dict(word_ngram_max=2, char_ngram_min=2, char_ngram_max=3)
+        ids, splits = _run_ngram_hash(input, **kwargs)
+        indices, values, dense_shape = _run_ngram_hash(input, op_type='StringNGramHashSparse', **kwargs)
+        np.testing.assert_array_equal(dense_shape, [3, NUM_BUCKETS])
+
+        # the bag of the ids of each row, sorted by the row and then the bucket
+        expected_indices, expected_values = [], []
+        for row in range(len(input)):
+            buckets, counts = np.unique(ids[splits[row]:splits[row + 1]], return_counts=True)
+            expected_indices += [[row, bucket] for bucket in buckets]
+            expected_values += counts.tolist()
+        np.testing.assert_array_equal(indices.reshape(-1, 2), np.array(expected_indices).reshape(-1, 2))
+        np.testing.assert_array_equal(values, np.array(expected_values, dtype=np.float32))
+        self.assertEqual(values[indices[:, 0] == 0].max(), 2)
+
+        threads = _run_ngram_hash(input, op_type='StringNGramHashSparse', num_threads=4, **kwargs)
+        np.testing.assert_array_equal(threads[0], indices)
+        np.testing.assert_array_equal(threads[1], values)
+
+    def test_hash_bucket_fast_sparse(self):
+        inputs = [helper.make_tensor_value_info('input', onnx_proto.TensorProto.STRING, [None, None]),
+                  helper.make_tensor_value_info('num_buckets', onnx_proto.TensorProto.INT64, [])]
+        outputs = [helper.make_tensor_value_info('indices', onnx_proto.TensorProto.INT64, [None, 2]),
+                   helper.make_tensor_value_info('values', onnx_proto.TensorProto.FLOAT, [None]),
+                   helper.make_tensor_value_info('dense_shape', onnx_proto.TensorProto.INT64, [2])]
+        node = helper.make_node('StringToHashBucketFastSparse', ['input', 'num_buckets'],
+                                ['indices', 'values', 'dense_shape'], domain='ai.onnx.contrib')
+        model = make_onnx_model(helper.make_graph([node], 'hash_sparse', inputs, outputs))
+
+        input = np.array([["x", "y", "x"], ["z", "z", "z"]])
+        indices, values, dense_shape = _run_model(
+            model, {'input': input, 'num_buckets': np.array(NUM_BUCKETS, dtype=np.int64)})
+        x, y, z = (hash_64(s, NUM_BUCKETS, True) for s in "xyz")
+        expected = sorted([(0, x, 2.0), (0, y, 1.0), (1, z, 3.0)])
+        np.testing.assert_array_equal(indices, [[r, b] for r, b, _ in expected])
+        np.testing.assert_array_equal(values, [v for _, _, v in expected])
+        np.testing.assert_array_equal(dense_shape, [2, NUM_BUCKETS])
+
+
+if __name__ == "__main__":
+    unittest.main()
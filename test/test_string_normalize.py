@@ -0,0 +1,28 @@
+import unittest
+import unicodedata
+import numpy as np
+from onnxruntime_extensions import PyOrtFunction, StringNormalize
+
+
+class TestStringNormalize(unittest.TestCase):
+
+    texts = ["plain ascii", "", "caf\u00e9", "cafe\u0301", "\ufb01ne \uff21\uff42 x\u00b2", "\u212b",
+             "q\u0307\u0323", "\ud55c\uad6d\uc5b4", "\u1112\u1175\u11c2", "\u01fa\u0327"]
+
+    def test_forms(self):
+        for form in ["NFC", "NFD", "NFKC", "NFKD"]:
+            normalize = PyOrtFunction.from_customop(StringNormalize, form=form)
+            result = normalize(np.array(self.texts))
+            np.testing.assert_array_equal(result, np.array([unicodedata.normalize(form, t) for t in self.texts]))
+
+    def test_shape_and_threads(self):
+        texts = np.array([self.texts[:5] * 20, self.texts[5:] * 20])
+        normalize = PyOrtFunction.from_customop(StringNormalize, form="NFKC", num_threads=4)
+        result = normalize(texts)
+        self.assertEqual(result.shape, texts.shape)
+        expected = np.array([[unicodedata.normalize("NFKC", t) for t in row] for row in texts])
+        np.testing.assert_array_equal(result, expected)
+
+
+if __name__ == "__main__":
+    unittest.main()
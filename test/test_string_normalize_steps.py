@@ -0,0 +1,48 @@
+import re
+import unittest
+import unicodedata
+import numpy as np
+from onnxruntime_extensions import PyOrtFunction, StringNormalizeSteps
+
+
+def _reference(text):
+    # the chain of the nodes which the steps below replace
+    text = unicodedata.normalize("NFKC", text)
+    text = text.strip(" \t\n\v\f\r").lower()
+    text = re.sub(r"[0-9]+", "#", text)
+    return re.sub(r"\s+", " ", text)
+
+
+class TestStringNormalizeSteps(unittest.TestCase):
+
+    steps = "normalize\tNFKC\nstrip\nlower\nreplace\t[0-9]+\t#\ncollapse_spaces\n"
+
+    def test_steps(self):
+        normalize = PyOrtFunction.from_customop(StringNormalizeSteps, steps=self.steps)
+        texts = np.array(["  Call 555 1234  NOW ", "ﬁne Café", "", "   ", "plain"])
+        result = normalize(texts)
+        np.testing.assert_array_equal(result, np.array(["call # # now", "fine café", "", "", "plain"]))
+
+    def test_fused_chars(self):
+        # the case maps, the strip and the collapse of the whitespace are one pass
+        normalize = PyOrtFunction.from_customop(StringNormalizeSteps, steps="strip\ncollapse_spaces\nupper")
+        result = normalize(np.array([["　 a\t\tb  ", "é x"]]))
+        np.testing.assert_array_equal(result, np.array([["A B", "é X"]]))
+
+    def test_shape_and_threads(self):
+        texts = np.array([["  A1  b ", "X²"] * 50, ["Å", " 42 "] * 50])
+        normalize = PyOrtFunction.from_customop(StringNormalizeSteps, steps=self.steps, num_threads=4)
+        result = normalize(texts)
+        self.assertEqual(result.shape, texts.shape)
+        expected = np.array([[_reference(t) for t in row] for row in texts])
+        np.testing.assert_array_equal(result, expected)
+
+    def test_invalid_steps(self):
+        with self.assertRaises(Exception):
+            PyOrtFunction.from_customop(StringNormalizeSteps, steps="capitalize")(np.array(["a"]))
+        with self.assertRaises(Exception):
+            PyOrtFunction.from_customop(StringNormalizeSteps, steps="normalize\tNFX")(np.array(["a"]))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -79,7 +79,7 @@ def _create_test_model_string_join(prefix, domain='ai.onnx.contrib'):
 
 
 def _create_test_model_string_replace(prefix, domain='ai.onnx.contrib',
-                                      global_replace=True):
+                                      global_replace=True, **kwargs):
     nodes = []
     nodes.append(
         helper.make_node('Identity', ['text'], ['id1']))
@@ -91,13 +91,13 @@ def _create_test_model_string_replace(prefix, domain='ai.onnx.contrib',
         nodes.append(
             helper.make_node(
                 '%sStringRegexReplace' % prefix, ['id1', 'id2', 'id3'],
-                ['customout'], domain=domain))
+                ['customout'], domain=domain, **kwargs))
     else:
         nodes.append(
             helper.make_node(
                 '%sStringRegexReplace' % prefix, ['id1', 'id2', 'id3'],
                 ['customout'], domain=domain,
-                global_replace=0))
+                global_replace=0, **kwargs))
 
     input0 = helper.make_tensor_value_info(
         'text', onnx_proto.TensorProto.STRING, [None, 1])
@@ -173,12 +173,12 @@ def _create_test_model_string_equal(prefix, domain='ai.onnx.contrib'):
     return model
 
 
-def _create_test_model_string_strip(prefix, domain='ai.onnx.contrib'):
+def _create_test_model_string_strip(prefix, domain='ai.onnx.contrib', **attrs):
     nodes = []
     nodes[0:] = [helper.make_node('Identity', ['input_1'], ['identity1'])]
     nodes[1:] = [helper.make_node('%sStringStrip' % prefix,
                                   ['identity1'], ['customout'],
-                                  domain=domain)]
+                                  domain=domain, **attrs)]
 
     input0 = helper.make_tensor_value_info(
         'input_1', onnx_proto.TensorProto.STRING, [None, None])
@@ -189,7 +189,7 @@ def _create_test_model_string_strip(prefix, domain='ai.onnx.contrib'):
     model = make_onnx_model(graph)
     return model
 
-def _create_test_model_string_split(prefix, domain='ai.onnx.contrib'):
+def _create_test_model_string_split(prefix, domain='ai.onnx.contrib', **attrs):
     nodes = []
     nodes.append(helper.make_node('Identity', ['input'], ['id1']))
     nodes.append(helper.make_node('Identity', ['delimiter'], ['id2']))
@@ -197,7 +197,7 @@ def _create_test_model_string_split(prefix, domain='ai.onnx.contrib'):
     nodes.append(
         helper.make_node(
             '%sStringSplit' % prefix, ['id1', 'id2', 'id3'],
-            ['indices', 'values', 'shape'], domain=domain))
+            ['indices', 'values', 'shape'], domain=domain, **attrs))
 
     input0 = helper.make_tensor_value_info(
         'input', onnx_proto.TensorProto.STRING, [])
@@ -218,7 +218,7 @@ def _create_test_model_string_split(prefix, domain='ai.onnx.contrib'):
     return model
 
 
-def _create_test_model_string_regex_split(prefix, domain='ai.onnx.contrib'):
+def _create_test_model_string_regex_split(prefix, domain='ai.onnx.contrib', **kwargs):
     nodes = []
     nodes.append(helper.make_node('Identity', ['input'], ['id1']))
     nodes.append(helper.make_node('Identity', ['pattern'], ['id2']))
@@ -226,7 +226,7 @@ def _create_test_model_string_regex_split(prefix, domain='ai.onnx.contrib'):
     nodes.append(
         helper.make_node(
             '%sStringRegexSplitWithOffsets' % prefix, ['id1', 'id2', 'id3'],
-            ['tokens', 'begins', 'ends', 'row_indices'], domain=domain))
+            ['tokens', 'begins', 'ends', 'row_indices'], domain=domain, **kwargs))
 
     input0 = helper.make_tensor_value_info(
         'input', onnx_proto.TensorProto.STRING, [])
@@ -472,6 +472,29 @@ class TestPythonOpString(unittest.TestCase):
         txout = sess.run(None, {'input_1': input_1})
         self.assertEqual(txout[0].tolist(), np.array([[""]]).tolist())
 
+    def test_string_strip_cc_spaces(self):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        sess = _ort.InferenceSession(_create_test_model_string_strip('').SerializeToString(), so)
+        input_1 = np.array([["   ", "\t\n x \r\v\f", " " * 40 + "long" + " " * 40],
+                            ["\u00a0x\u3000", "é ", "abc"]])
+        txout = sess.run(None, {'input_1': input_1})
+        self.assertEqual(txout[0].tolist(), [["   ", "x", "long"], ["\u00a0x\u3000", "é", "abc"]])
+
+        # a big batch is stripped in parallel
+        input_1 = np.array([[" %d " % i for i in range(10000)]])
+        txout = sess.run(None, {'input_1': input_1})
+        self.assertEqual(txout[0].tolist(), [[str(i) for i in range(10000)]])
+
+    def test_string_strip_cc_unicode_spaces(self):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        onnx_model = _create_test_model_string_strip('', unicode_spaces=1)
+        sess = _ort.InferenceSession(onnx_model.SerializeToString(), so)
+        input_1 = np.array([["\u00a0x\u3000", " \u3000 ", "\u00a0a\u00a0b\u2003", "é "]])
+        txout = sess.run(None, {'input_1': input_1})
+        self.assertEqual(txout[0].tolist(), [["x", " \u3000 ", "a\u00a0b", "é"]])
+
     def test_string_upper_cc(self):
         so = _ort.SessionOptions()
         so.register_custom_ops_library(_get_library_path())
@@ -734,6 +757,20 @@ class TestPythonOpString(unittest.TestCase):
                ['static PyObject* py_dummy(void) {def dummy():']]
         self.assertEqual(exp, txout[0].tolist())
 
+    def test_string_replace_cc_threads(self):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        pattern = np.array([r'(\d+)'])
+        rewrite = np.array([r'<\1>'])
+        text = np.array([['a%d b%d c' % (i, i * 7)] for i in range(200)] + [[''], ['none']])
+        for global_replace in [True, False]:
+            onnx_model = _create_test_model_string_replace('', global_replace=global_replace, num_threads=4)
+            sess = _ort.InferenceSession(onnx_model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+            txout = sess.run(
+                None, {'text': text, 'pattern': pattern, 'rewrite': rewrite})
+            exp = [[re.sub(r'(\d+)', r'<\1>', t[0], count=0 if global_replace else 1)] for t in text.tolist()]
+            self.assertEqual(exp, txout[0].tolist())
+
     def test_string_replace_cc_x2(self):
         so = _ort.SessionOptions()
         so.register_custom_ops_library(_get_library_path())
@@ -1040,6 +1077,32 @@ class TestPythonOpString(unittest.TestCase):
                 self.assertEqual(exp_indices.tolist(), txout[0].tolist())
                 self.assertEqual(exp_shape.tolist(), txout[2].tolist())
 
+    def test_string_split_cc_substring_sep(self):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        input = np.array(["a,*b", "a*b,", "aa,*,*b,*", "", "a,**,b"] * 50)
+        delimiter = np.array([",*"])
+        for num_threads in [1, 4]:
+            onnx_model = _create_test_model_string_split('', substring_sep=1, num_threads=num_threads)
+            sess = _ort.InferenceSession(onnx_model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+            for skip in [True, False]:
+                with self.subTest(num_threads=num_threads, skip=skip):
+                    txout = sess.run(
+                        None, {'input': input, 'delimiter': delimiter,
+                               'skip_empty': np.array([skip])})
+
+                    exp_indices = []
+                    exp_text = []
+                    for row, text in enumerate(input.tolist()):
+                        if not text:
+                            continue
+                        pieces = [p for p in text.split(",*") if p or not skip]
+                        exp_indices.extend([row, col] for col in range(len(pieces)))
+                        exp_text.extend(pieces)
+                    self.assertEqual(exp_text, txout[1].tolist())
+                    self.assertEqual(exp_indices, txout[0].tolist())
+                    self.assertEqual([len(input), 2 if skip else 4], txout[2].tolist())
+
     def test_string_split_cc_sep0(self):
         so = _ort.SessionOptions()
         so.register_custom_ops_library(_get_library_path())
@@ -1081,6 +1144,41 @@ class TestPythonOpString(unittest.TestCase):
                 self.assertEqual(exp_indices.tolist(), txout[0].tolist())
                 self.assertEqual(exp_shape.tolist(), txout[2].tolist())
 
+    def test_string_regex_split_cc_threads(self):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        onnx_model = _create_test_model_string_regex_split('', num_threads=4)
+        sess = _ort.InferenceSession(onnx_model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+        input = np.array(["w%d " % i * (i % 5) for i in range(100)])
+        txout = sess.run(
+            None, {'input': input, 'pattern': np.array(["(\\s)"]), 'keep_pattern': np.array([""])})
+
+        exp_text, exp_begins, exp_ends, exp_rows = [], [], [], [0]
+        for text in input.tolist():
+            for m in re.finditer(r'\S+', text):
+                exp_text.append(m.group())
+                exp_begins.append(m.start())
+                exp_ends.append(m.end())
+            exp_rows.append(len(exp_text))
+        self.assertEqual(exp_text, txout[0].tolist())
+        self.assertEqual(exp_begins, txout[1].tolist())
+        self.assertEqual(exp_ends, txout[2].tolist())
+        self.assertEqual(exp_rows, txout[3].tolist())
+
+    def test_string_regex_split_cc_offsets_only(self):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        onnx_model = _create_test_model_string_regex_split('', offsets_only=1)
+        sess = _ort.InferenceSession(onnx_model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+        txout = sess.run(
+            None, {'input': np.array(["hello there", "hello  there"]), 'pattern': np.array(["(\\s)"]),
+                   'keep_pattern': np.array(["\\s"])})
+
+        self.assertEqual([], txout[0].tolist())
+        self.assertEqual([0, 5, 6, 0, 5, 6, 7], txout[1].tolist())
+        self.assertEqual([5, 6, 11, 5, 6, 7, 12], txout[2].tolist())
+        self.assertEqual([0, 3, 7], txout[3].tolist())
+
     def test_string_regex_split_cc(self):
         so = _ort.SessionOptions()
         so.register_custom_ops_library(_get_library_path())
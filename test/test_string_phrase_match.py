@@ -0,0 +1,58 @@
+import unittest
+import numpy as np
+from onnx import helper, onnx_pb as onnx_proto
+import onnxruntime as _ort
+from onnxruntime_extensions import make_onnx_model, get_library_path as _get_library_path
+
+
+def _run_phrase_match(input, **kwargs):
+    inputs = [helper.make_tensor_value_info('input', onnx_proto.TensorProto.STRING, None)]
+    outputs = [helper.make_tensor_value_info('spans', onnx_proto.TensorProto.INT64, [None, 3]),
+               helper.make_tensor_value_info('row_splits', onnx_proto.TensorProto.INT64, [None])]
+    node = helper.make_node('StringPhraseMatch', ['input'], ['spans', 'row_splits'],
+                            domain='ai.onnx.contrib', **kwargs)
+    model = make_onnx_model(helper.make_graph([node], 'phrase_match', inputs, outputs))
+
+    so = _ort.SessionOptions()
+    so.register_custom_ops_library(_get_library_path())
+    sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+    return sess.run(None, {'input': input})
+
+
+PHRASES = "new york\t10\nnew york city\t11\nyork\t12\n"
+
+
+class TestStringPhraseMatch(unittest.TestCase):
+
+    def test_longest(self):
+        spans, splits = _run_phrase_match(np.array(["in new york city", "york, new york", "none"]), phrases=PHRASES)
+        np.testing.assert_array_equal(spans, [[3, 16, 11], [0, 4, 12], [6, 14, 10]])
+        np.testing.assert_array_equal(splits, [0, 1, 3, 3])
+
+    def test_all(self):
+        spans, splits = _run_phrase_match(np.array(["in new york city"]), phrases=PHRASES, mode="all")
+        np.testing.assert_array_equal(spans, [[3, 11, 10], [3, 16, 11], [7, 11, 12]])
+        np.testing.assert_array_equal(splits, [0, 3])
+
+    def test_case_insensitive(self):
+        input = np.array(["NEW YORK", "\u00c9cole, New York"])
+        spans, _ = _run_phrase_match(input, phrases="\u00e9cole\nnew york", case_insensitive=1)
+        np.testing.assert_array_equal(spans, [[0, 8, 1], [0, 6, 0], [8, 16, 1]])
+
+    def test_token_level(self):
+        input = np.array(["yorkshire new  york", "newyork"])
+        chars, _ = _run_phrase_match(input, phrases=PHRASES)
+        tokens, splits = _run_phrase_match(input, phrases=PHRASES, level="token")
+        np.testing.assert_array_equal(chars, [[0, 4, 12], [15, 19, 12], [3, 7, 12]])
+        np.testing.assert_array_equal(tokens, [[10, 19, 10]])
+        np.testing.assert_array_equal(splits, [0, 1, 1])
+
+    def test_threads(self):
+        input = np.array(["row {} of new york".format(i) for i in range(100)])
+        spans, splits = _run_phrase_match(input, phrases=PHRASES, num_threads=4)
+        np.testing.assert_array_equal(splits, np.arange(101))
+        np.testing.assert_array_equal(spans[:, 2], np.full(100, 10))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,80 @@
+import unittest
+import numpy as np
+from onnx import helper, onnx_pb as onnx_proto
+import onnxruntime as _ort
+from onnxruntime_extensions import make_onnx_model, get_library_path as _get_library_path
+
+
+def _run(op_type, input, outputs, **kwargs):
+    inputs = [helper.make_tensor_value_info('input', onnx_proto.TensorProto.STRING, None)]
+    output_infos = [helper.make_tensor_value_info(name, dtype, None) for name, dtype in outputs]
+    node = helper.make_node(op_type, ['input'], [name for name, _ in outputs], domain='ai.onnx.contrib', **kwargs)
+    model = make_onnx_model(helper.make_graph([node], op_type, inputs, output_infos))
+
+    so = _ort.SessionOptions()
+    so.register_custom_ops_library(_get_library_path())
+    sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+    return sess.run(None, {'input': input})
+
+
+def _run_unique(input, **kwargs):
+    return _run('StringUnique', input, [('unique', onnx_proto.TensorProto.STRING),
+                                        ('indices', onnx_proto.TensorProto.INT64),
+                                        ('inverse_indices', onnx_proto.TensorProto.INT64),
+                                        ('counts', onnx_proto.TensorProto.INT64)], **kwargs)
+
+
+def _run_sort(input, **kwargs):
+    return _run('StringSort', input, [('output', onnx_proto.TensorProto.STRING),
+                                      ('indices', onnx_proto.TensorProto.INT64)], **kwargs)
+
+
+class TestStringUnique(unittest.TestCase):
+
+    def test_sorted(self):
+        input = np.array([["b", "a", "c"], ["a", "", "b"]])
+        unique, indices, inverse, counts = _run_unique(input)
+        expected = np.unique(input, return_index=True, return_inverse=True, return_counts=True)
+        np.testing.assert_array_equal(unique, expected[0])
+        np.testing.assert_array_equal(indices, expected[1])
+        np.testing.assert_array_equal(inverse, expected[2].ravel())
+        np.testing.assert_array_equal(counts, expected[3])
+
+    def test_first_occurrence(self):
+        unique, indices, inverse, counts = _run_unique(np.array(["b", "a", "b", "c", "a", "b"]), sorted=0)
+        np.testing.assert_array_equal(unique, ["b", "a", "c"])
+        np.testing.assert_array_equal(indices, [0, 1, 3])
+        np.testing.assert_array_equal(inverse, [0, 1, 0, 2, 1, 0])
+        np.testing.assert_array_equal(counts, [3, 2, 1])
+
+    def test_many(self):
+        input = np.array(["user{}".format(i % 257) for i in range(5000)])
+        unique, _, inverse, counts = _run_unique(input)
+        self.assertEqual(len(unique), 257)
+        np.testing.assert_array_equal(unique[inverse], input)
+        self.assertEqual(counts.sum(), 5000)
+
+
+class TestStringSort(unittest.TestCase):
+
+    def test_sort(self):
+        input = np.array([["pear", "apple", "fig", "apple"], ["b", "", "a", "é"]])
+        output, indices = _run_sort(input)
+        np.testing.assert_array_equal(indices, [[1, 3, 2, 0], [1, 2, 0, 3]])
+        np.testing.assert_array_equal(output, np.take_along_axis(input, indices, axis=-1))
+
+    def test_descending(self):
+        input = np.array(["b", "c", "a", "c"])
+        output, indices = _run_sort(input, descending=1)
+        np.testing.assert_array_equal(output, ["c", "c", "b", "a"])
+        np.testing.assert_array_equal(indices, [1, 3, 0, 2])
+
+    def test_threads(self):
+        input = np.array([["w{}".format((i * 7 + j * 13) % 101) for j in range(20)] for i in range(64)])
+        output, indices = _run_sort(input, num_threads=4)
+        np.testing.assert_array_equal(output, np.sort(input, axis=-1))
+        np.testing.assert_array_equal(output, np.take_along_axis(input, indices, axis=-1))
+
+
+if __name__ == "__main__":
+    unittest.main()
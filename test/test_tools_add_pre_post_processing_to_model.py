@@ -510,6 +510,33 @@ class TestToolsAddPrePostProcessingToModel(unittest.TestCase):
         image_ref = np.frombuffer(open(output_img, 'rb').read(), dtype=np.uint8)
         self.assertEqual((image_ref == output).all(), True)
 
+    def test_draw_box_score_threshold_and_max_boxes(self):
+        import sys
+        sys.path.append(test_data_dir)
+        import create_boxdrawing_model
+
+        output_model = (self.temp4onnx / "draw_bounding_box.onnx").resolve()
+        test_boxes = np.array([
+            [0, 0, 180.0, 150.0, 0.15, 0.0],
+            [240, 0, 140.0, 150.0, 0.25, 1.0],
+            [0, 240, 140.0, 240.0, 0.35, 2.0],
+            [12, 41, 140.0, 140.0, 0.45, 3.0],
+            [234, 23, 140.0, 140.0, 0.55, 4.0],
+            [64, 355, 140.0, 140.0, 0.65, 5.0],
+        ], dtype=np.float32)
+
+        for colour_by_classes in [False, True]:
+            create_boxdrawing_model.create_model(output_model, mode="XYWH", colour_by_classes=colour_by_classes)
+            expected = self.draw_boxes_on_image(output_model, test_boxes[4:])
+            # the boxes under the threshold, and the lower ones out of the max boxes, are skipped
+            create_boxdrawing_model.create_model(output_model, mode="XYWH", colour_by_classes=colour_by_classes,
+                                                 score_threshold=0.4)
+            self.assertTrue((self.draw_boxes_on_image(output_model, test_boxes[2:]) ==
+                             self.draw_boxes_on_image(output_model, test_boxes[3:])).all())
+            create_boxdrawing_model.create_model(output_model, mode="XYWH", colour_by_classes=colour_by_classes,
+                                                 score_threshold=0.3, max_boxes=2)
+            self.assertTrue((self.draw_boxes_on_image(output_model, test_boxes) == expected).all())
+
     # a box with higher score should be drawn over a box with lower score
 
     def test_draw_box_overlapping_with_priority(self):
@@ -0,0 +1,41 @@
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+import json
+import os
+import tempfile
+import unittest
+
+from onnxruntime_extensions import util
+from onnxruntime_extensions.tools import benchmark_pipelines
+
+
+class TestBenchmarkPipelines(unittest.TestCase):
+    def test_run_benchmarks(self):
+        model = util.get_test_data_file('data', 'custom_op_string_lower.onnx')
+        report = benchmark_pipelines.run_benchmarks([model], batch_sizes=[1, 4], intra_op_threads=[1],
+                                                    inter_op_threads=[1], isolate=False, warmup=1, iterations=5)
+        self.assertIn("onnxruntime_version", report)
+        self.assertEqual([r["batch_size"] for r in report["results"]], [1, 4])
+        for result in report["results"]:
+            latency = result["latency_ms"]
+            self.assertLessEqual(latency["min"], latency["p50"])
+            self.assertLessEqual(latency["p50"], latency["p95"])
+            self.assertLessEqual(latency["p95"], latency["p99"])
+            self.assertLessEqual(latency["p99"], latency["max"])
+            self.assertGreater(result["throughput_per_s"], 0)
+            self.assertEqual(result["iterations"], 5)
+
+    def test_main_writes_json(self):
+        model = util.get_test_data_file('data', 'custom_op_string_lower.onnx')
+        with tempfile.TemporaryDirectory() as temp_dir:
+            output = os.path.join(temp_dir, "results.json")
+            benchmark_pipelines.main([model, "--no-isolate", "--warmup", "0", "--iterations", "2",
+                                      "--output", output])
+            with open(output, encoding="utf-8") as f:
+                report = json.load(f)
+            self.assertEqual(len(report["results"]), 1)
+            self.assertIn("peak_rss_bytes", report["results"][0])
+
+
+if __name__ == "__main__":
+    unittest.main()
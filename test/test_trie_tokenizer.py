@@ -170,6 +170,22 @@ class TestTrieTokenizer(TestCase):
         for s in test_sentences:
             self.assertEqual(tokr.encode(s), list(ortx_tokr([s])[0]))
 
+    def test_batch_with_threads(self):
+        vocab_data = util.read_file(self.vocab_file, 'rb')
+        tokr = TRIE_TOKENIZER(self.vocab_file)
+        ortx_tokr = OrtPyFunction.from_customop("TrieTokenizer", vocab=vocab_data, num_threads=4)
+        ortx_detok = OrtPyFunction.from_customop("TrieDetokenizer", vocab=vocab_data, num_threads=4)
+
+        sentences = ["I am a girl", "我是个女孩", "", "that dog is so cute"] * 20
+        tokens = ortx_tokr(sentences)
+        max_length = max(len(tokr.encode(s)) for s in sentences)
+        self.assertEqual(tokens.shape, (len(sentences), max_length))
+        for s, row in zip(sentences, tokens):
+            expected = tokr.encode(s)
+            self.assertEqual(list(row), expected + [0] * (max_length - len(expected)))
+            # the padding id 0 decodes to nothing
+            self.assertEqual(ortx_detok(row[None, :])[0], s)
+
 
 if __name__ == "__main__":
     unittest_main()
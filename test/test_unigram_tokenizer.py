@@ -0,0 +1,53 @@
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+import unittest
+import numpy as np
+import onnxruntime as _ort
+
+from onnx import helper, onnx_pb as onnx_proto
+from transformers import AutoTokenizer
+from onnxruntime_extensions import make_onnx_model, get_library_path as _get_library_path
+
+
+def _create_test_model(tokenizer_json, **attrs):
+    input1 = helper.make_tensor_value_info('string_input', onnx_proto.TensorProto.STRING, [None])
+    outputs = [helper.make_tensor_value_info(name, onnx_proto.TensorProto.INT64, [None, None])
+               for name in ['input_ids', 'attention_mask']]
+    node = [helper.make_node(
+        'UnigramTokenizer', ['string_input'], [o.name for o in outputs], vocab=tokenizer_json,
+        name='unigram', domain='ai.onnx.contrib', **attrs)]
+    return make_onnx_model(helper.make_graph(node, 'test0', [input1], outputs))
+
+
+class TestUnigramTokenizer(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        cls.tokenizer = AutoTokenizer.from_pretrained("xlm-roberta-base", use_fast=True)
+        cls.tokenizer_json = cls.tokenizer.backend_tokenizer.to_str()
+
+    def _run(self, texts, **attrs):
+        so = _ort.SessionOptions()
+        so.register_custom_ops_library(_get_library_path())
+        model = _create_test_model(self.tokenizer_json, bos_token="<s>", eos_token="</s>", **attrs)
+        sess = _ort.InferenceSession(model.SerializeToString(), so, providers=['CPUExecutionProvider'])
+        return sess.run(None, {'string_input': np.array(texts)})
+
+    def test_xlm_roberta(self):
+        # the texts have nothing for the normalizer of XLM-R, which the kernel doesn't run
+        texts = ["I can feel the magic, can you?", "Hey Cortana", "ça va très bien", "今天天气很好", "", "lower newer"]
+        input_ids, attention_mask = self._run(texts, num_threads=2)
+        expected = self.tokenizer(texts, padding=True)
+        # the padding id of the kernel is 0
+        np.testing.assert_array_equal(np.array(expected['input_ids']) * attention_mask, input_ids)
+        np.testing.assert_array_equal(expected['attention_mask'], attention_mask)
+
+    def test_truncation(self):
+        texts = ["One Microsoft Way, Redmond, WA", "Hi"]
+        input_ids, attention_mask = self._run(texts, padding_length=6)
+        expected = self.tokenizer(texts, truncation=True, max_length=6, padding='max_length')
+        np.testing.assert_array_equal(np.array(expected['input_ids']) * attention_mask, input_ids)
+        np.testing.assert_array_equal(expected['attention_mask'], attention_mask)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -166,6 +166,9 @@ def _parse_arguments():
                         help="Specify path to emscripten SDK. Setup manually with: "
                              "  git clone https://github.com/emscripten-core/emsdk")
     parser.add_argument("--emsdk_version", default="3.1.26", help="Specify version of emsdk")
+    parser.add_argument("--wasm_simd", action="store_true",
+                        help="Build for WebAssembly with the SIMD128 instructions, and without exceptions. "
+                             "Implies --wasm and --disable_exceptions.")
 
     # x86 args
     parser.add_argument("--x86", action="store_true",
@@ -197,6 +200,9 @@ def _parse_arguments():
     parser.add_argument("--build_java", action="store_true", help="Build Java bindings.")
 
     args = parser.parse_args()
+    if args.wasm_simd:
+        args.wasm = True
+        args.disable_exceptions = True
 
     # validate Android args
     if args.android:
@@ -439,6 +445,8 @@ def _generate_build_tree(cmake_path: Path,
             "-DOCOS_ENABLE_CV2=OFF",
             "-DOCOS_ENABLE_VISION=OFF"
         ]
+        if args.wasm_simd:
+            cmake_args.append("-DOCOS_ENABLE_WASM_SIMD=ON")
 
     if args.disable_exceptions:
         cmake_args.append("-DOCOS_ENABLE_CPP_EXCEPTIONS=OFF")
@@ -10,28 +10,44 @@ CMAKE_FLAG_TO_OPS = {
     "OCOS_ENABLE_AZURE": [
         "AzureAudioToText",
         "AzureTextToText",
+        "AzureTritonInvoker",
         "OpenAIAudioToText"
     ],
     "OCOS_ENABLE_BERT_TOKENIZER": [
         "BasicTokenizer",
         "BertTokenizer",
         "BertTokenizerDecoder",
+        "HfBertTokenizer",
+        "QuestionAnsweringSpans",
+        "TokenClassificationSpans",
     ],
     "OCOS_ENABLE_BLINGFIRE": [
         "BlingFireSentenceBreaker",
     ],
     "OCOS_ENABLE_CV2": [
         "GaussianBlur",
+        "ImageDecoder",
         "ImageReader"
     ],
     "OCOS_ENABLE_GPT2_TOKENIZER": [
         "BpeDecoder",
+        "BpeStreamingDecoder",
         "CLIPTokenizer",
         "GPT2Tokenizer",
-        "RobertaTokenizer"
+        "HfChatTokenizer",
+        "HfTokenizer",
+        "RobertaTokenizer",
+        "TiktokenTokenizer",
     ],
     "OCOS_ENABLE_MATH": [
+        "EmbeddingPooling",
+        "Int64Mapping",
+        "LogitsProcessor",
+        "LogitsSampler",
+        "NegPos",
         "SegmentExtraction",
+        "SegmentSum",
+        "UnsortedSegmentSum",
     ],
     "OCOS_ENABLE_OPENCV_CODECS": [
         "DecodeImage",
@@ -46,8 +62,13 @@ CMAKE_FLAG_TO_OPS = {
         "SentencepieceTokenizer",
         "SentencepieceDecoder"
     ],
+    "OCOS_ENABLE_UNIGRAM_TOKENIZER": [
+        "UnigramTokenizer",
+    ],
     "OCOS_ENABLE_TF_STRING": [
         "MaskedFill",
+        "RaggedTensorToDense",
+        "RaggedTensorToSparse",
         "StringConcat",
         "StringECMARegexReplace",
         "StringECMARegexSplitWithOffsets",
@@ -56,26 +77,51 @@ CMAKE_FLAG_TO_OPS = {
         "StringLength",
         "StringLower",
         "StringMapping",
+        "StringMultiReplace",
+        "StringNGramHash",
+        "StringNGramHashSparse",
+        "StringNormalize",
+        "StringNormalizeSteps",
+        "StringPhraseMatch",
+        "StringRaggedTensorToDense",
+        "StringSliceWithOffsets",
+        "StringSort",
         "StringSplit",
+        "StringStrip",
         "StringToHashBucket",
         "StringToHashBucketFast",
+        "StringToHashBucketFastSparse",
         "StringToVector",
+        "StringUnique",
         "StringUpper",
         "VectorToString",
     ],
     "OCOS_ENABLE_VISION": [
         "DecodeImage",
+        "DecodeImageBatch",
+        "DecodeImageNormalize",
+        "DetectionPostProcess",
+        "FrameNormalize",
+        "ImageNormalize",
         "EncodeImage",
         "DrawBoundingBoxes",
+        "ReadImageBatch",
     ],
     "OCOS_ENABLE_WORDPIECE_TOKENIZER": [
         "WordpieceTokenizer",
     ],
     "OCOS_ENABLE_AUDIO": [
-        "AudioDecoder"
+        "AudioChunk",
+        "AudioDecoder",
+        "AudioDecoderInt16",
+        "AudioDecoderBatch",
+        "LogMelSpectrogram",
+        "LogMelSpectrogramStreaming",
+        "VoiceActivityDetection",
     ],
     "OCOS_ENABLE_DLIB": [
         "Inverse",
+        "STFT",
         "StftNorm"
     ],
     "OCOS_ENABLE_TRIE_TOKENIZER": [
@@ -117,6 +163,7 @@ def gen_cmake_oplist(opconfig_file):
     new_ext_domain = "com.microsoft.extensions"
     ext_domain_cnt = 0
     cmake_options = set()
+    selected_ops = set()
 
     with open(GENERATED_CMAKE_CONFIG_FILE, "w") as f:
         print("# Auto-Generated File, please do not edit!!!", file=f)
@@ -143,10 +190,14 @@ def gen_cmake_oplist(opconfig_file):
                                 "the CMAKE_FLAG_TO_OPS dictionary.".format(_op)
                             )
 
+                        selected_ops.add(_op)
                         cmake_flags_for_op = OP_TO_CMAKE_FLAGS[_op]
                         for cmake_flag in cmake_flags_for_op:
                             add_cmake_flag(cmake_flag)
 
+        # only these ops are registered, and the kernels of the other ops in the enabled groups aren't built in.
+        print('set(OCOS_SELECTED_OPS "{}" CACHE INTERNAL "")'.format(";".join(sorted(selected_ops))), file=f)
+
     if ext_domain_cnt == 0:
         print(
             "[onnxruntime-extensions] warning: lines starting with extension domains of ai.onnx.contrib or "
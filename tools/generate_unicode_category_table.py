@@ -113,40 +113,85 @@ def find_expect_category(category_func):
 
     return find_ranges(expect_category_set)
 
-def print_range(ranges):
-    single_set = []
-    pair_set = []
-    for r in ranges:
-        start, end = r
-        if start == end:
-            single_set.append(start)
-        else:
-            pair_set.append(r)
+def _is_cjk(char):
+    """Checks whether `char` is a CJK ideograph, as the ranges of IsCJK."""
+    cp = ord(char)
+    return any(start <= cp <= end for start, end in _CJK_RANGES)
 
-    output = "if ("
-    for i in range(len(single_set)):
-        if i != 0:
-            output += "||"
-        output += f"c == {single_set[i]}"
-    output += ") {\n return true;\n}\n\n"
 
-    output += "if ("
-    for i in range(len(pair_set)):
-        if i != 0:
-            output += "||"
-        start, end = pair_set[i]
-        output += f"(c >= {start} && c <= {end})"
-    output += ") {\n return true;\n}\n\nreturn false;\n"
-    print(output)
+def _is_accent(char):
+    """Checks whether `char` is a combining diacritical mark, as IsAccent."""
+    return 0x300 <= ord(char) <= 0x36F
 
 
-print("\nis_whitespace:")
-print_range(find_expect_category(_is_whitespace))
+_CJK_RANGES = [(0x4E00, 0x9FFF), (0x3400, 0x4DBF), (0x20000, 0x2A6DF), (0x2A700, 0x2B73F),
+               (0x2B740, 0x2B81F), (0x2B820, 0x2CEAF), (0xF900, 0xFAFF), (0x2F800, 0x2FA1F)]
 
-print("\nis_punctuation:")
-print_range(find_expect_category(_is_punctuation))
+# the bits of CharCategory in base/string_utils.h
+_CATEGORIES = [(_is_whitespace, 1), (_is_punctuation, 2), (_is_control, 4), (_is_cjk, 8), (_is_accent, 16)]
 
-print("\nis_control:")
-print_range(find_expect_category(_is_control))
+# the code points above the table have no category
+_TABLE_LIMIT = 0x30000
+_BLOCK_SIZE = 256
 
 
+def build_category_table():
+    flags = [0] * _TABLE_LIMIT
+    for category_func, bit in _CATEGORIES:
+        if category_func in (_is_cjk, _is_accent):
+            ranges = find_ranges(find_expect_char_in_range(category_func, 0, _TABLE_LIMIT))
+        else:
+            ranges = find_expect_category(category_func)
+        for start, end in ranges:
+            for c in range(start, end + 1):
+                flags[c] |= bit
+
+    # the two-level table shares the blocks of the same flags, which most of the code points are in.
+    blocks = []
+    block_index = []
+    for start in range(0, _TABLE_LIMIT, _BLOCK_SIZE):
+        block = flags[start:start + _BLOCK_SIZE]
+        if block not in blocks:
+            blocks.append(block)
+        block_index.append(blocks.index(block))
+    assert len(blocks) <= 256
+    return block_index, blocks
+
+
+def format_array(values, indent="    ", per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def generate_source():
+    block_index, blocks = build_category_table()
+    flat = sum(blocks, [])
+    return f"""// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Generated by tools/generate_unicode_category_table.py with Unicode {unicodedata.unidata_version}, don't edit it.
+
+#include "string_utils.h"
+
+// the block of every {_BLOCK_SIZE} code points in kCharCategoryBlocks
+const uint8_t kCharCategoryBlockIndex[{len(block_index)}] = {{
+{format_array(block_index)}
+}};
+
+// the CharCategory bits of the code points of every distinct block
+const uint8_t kCharCategoryBlocks[{len(flat)}] = {{
+{format_array(flat)}
+}};
+"""
+
+
+if __name__ == "__main__":
+    import os
+    import sys
+
+    output = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+        os.path.dirname(__file__), "..", "base", "unicode_category_table.cc")
+    with open(output, "w", newline="\n") as f:
+        f.write(generate_source())
@@ -0,0 +1,165 @@
+import unicodedata
+
+# the bits of the NormalizationInfo of base/unicode_normalization.h above the canonical combining class
+_NFD_NO = 1 << 8
+_NFKD_NO = 1 << 9
+_NFC_NO = 1 << 10
+_NFC_MAYBE = 1 << 11
+_NFKC_NO = 1 << 12
+_NFKC_MAYBE = 1 << 13
+
+_CODE_POINT_LIMIT = 0x110000
+_BLOCK_SIZE = 128
+
+# the Hangul syllables and jamo are decomposed and composed by the algorithm of the standard, not the tables
+_HANGUL_SYLLABLES = range(0xAC00, 0xD7A4)
+_HANGUL_V_AND_T = list(range(0x1161, 0x1176)) + list(range(0x11A8, 0x11C3))
+
+
+def _is_surrogate(cp):
+    return 0xD800 <= cp <= 0xDFFF
+
+
+def build_compositions():
+    """The primary composites of the pairs of code points, which are the canonical decompositions of two code points
+    which aren't excluded from the composition, i.e. the NFC of the code point is itself."""
+    compositions = {}
+    for cp in range(_CODE_POINT_LIMIT):
+        if _is_surrogate(cp) or cp in _HANGUL_SYLLABLES:
+            continue
+        decomposition = unicodedata.decomposition(chr(cp))
+        if not decomposition or decomposition.startswith("<"):
+            continue
+        parts = [int(p, 16) for p in decomposition.split()]
+        if len(parts) == 2 and unicodedata.normalize("NFC", chr(cp)) == chr(cp):
+            compositions[(parts[0], parts[1])] = cp
+    return compositions
+
+
+def build_tables():
+    compositions = build_compositions()
+    seconds = {second for _, second in compositions} | set(_HANGUL_V_AND_T)
+
+    info = [0] * _CODE_POINT_LIMIT
+    decompositions = []  # (code point, canonical, compatibility), the ones which are the code point itself empty
+    for cp in range(_CODE_POINT_LIMIT):
+        if _is_surrogate(cp):
+            continue
+        ch = chr(cp)
+        value = unicodedata.combining(ch)
+        nfd = unicodedata.normalize("NFD", ch)
+        nfkd = unicodedata.normalize("NFKD", ch)
+        if nfd != ch:
+            value |= _NFD_NO
+        if nfkd != ch:
+            value |= _NFKD_NO
+        if unicodedata.normalize("NFC", ch) != ch:
+            value |= _NFC_NO
+        elif cp in seconds:
+            value |= _NFC_MAYBE
+        if unicodedata.normalize("NFKC", ch) != ch:
+            value |= _NFKC_NO
+        elif cp in seconds:
+            value |= _NFKC_MAYBE
+        info[cp] = value
+        if (nfd != ch or nfkd != ch) and cp not in _HANGUL_SYLLABLES:
+            decompositions.append((cp, nfd if nfd != ch else "", nfkd if nfkd != ch else ""))
+
+    # the two-level table shares the blocks of the same info, which most of the code points are in.
+    blocks = []
+    block_ids = {}
+    block_index = []
+    for start in range(0, _CODE_POINT_LIMIT, _BLOCK_SIZE):
+        block = tuple(info[start:start + _BLOCK_SIZE])
+        if block not in block_ids:
+            block_ids[block] = len(blocks)
+            blocks.append(block)
+        block_index.append(block_ids[block])
+    assert len(blocks) <= 256
+
+    # the decompositions are the slices of a pool of the code points, which shares the repeated ones
+    pool = []
+    slices = {}
+
+    def slice_of(chars):
+        if not chars:
+            return 0
+        if chars not in slices:
+            slices[chars] = len(pool)
+            pool.extend(ord(c) for c in chars)
+        assert len(chars) < 256 and len(pool) < (1 << 24)
+        return (slices[chars] << 8) | len(chars)
+
+    decomposition_entries = [(cp, slice_of(nfd), slice_of(nfkd)) for cp, nfd, nfkd in decompositions]
+    composition_entries = sorted(((first << 21) | second, cp) for (first, second), cp in compositions.items())
+    return block_index, blocks, decomposition_entries, pool, composition_entries
+
+
+def format_array(values, indent="    ", per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def generate_source():
+    block_index, blocks, decompositions, pool, compositions = build_tables()
+    flat = [v for block in blocks for v in block]
+    return f"""// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Generated by tools/generate_unicode_normalization_table.py with Unicode {unicodedata.unidata_version}, don't edit it.
+
+#include "unicode_normalization.h"
+
+// the block of every {_BLOCK_SIZE} code points in kNormalizationInfoBlocks
+const uint8_t kNormalizationInfoBlockIndex[{len(block_index)}] = {{
+{format_array(block_index)}
+}};
+
+// the NormalizationInfo of the code points of every distinct block
+const uint16_t kNormalizationInfoBlocks[{len(flat)}] = {{
+{format_array(flat)}
+}};
+
+const size_t kDecompositionCount = {len(decompositions)};
+
+// the code points which are decomposed by NFD or NFKD, in their order
+const char32_t kDecompositionCodePoints[{len(decompositions)}] = {{
+{format_array([cp for cp, _, _ in decompositions])}
+}};
+
+// the (offset << 8 | length) of the NFD and the NFKD of each of them in kDecompositionPool, 0 for itself
+const uint32_t kCanonicalDecompositions[{len(decompositions)}] = {{
+{format_array([nfd for _, nfd, _ in decompositions], per_line=8)}
+}};
+
+const uint32_t kCompatibilityDecompositions[{len(decompositions)}] = {{
+{format_array([nfkd for _, _, nfkd in decompositions], per_line=8)}
+}};
+
+const char32_t kDecompositionPool[{len(pool)}] = {{
+{format_array(pool)}
+}};
+
+const size_t kCompositionCount = {len(compositions)};
+
+// the (first << 21 | second) of the pairs which are composed, in their order, and the composite of each
+const uint64_t kCompositionPairs[{len(compositions)}] = {{
+{format_array([key for key, _ in compositions], per_line=6)}
+}};
+
+const char32_t kCompositions[{len(compositions)}] = {{
+{format_array([cp for _, cp in compositions])}
+}};
+"""
+
+
+if __name__ == "__main__":
+    import os
+    import sys
+
+    output = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+        os.path.dirname(__file__), "..", "base", "unicode_normalization_table.cc")
+    with open(output, "w", newline="\n") as f:
+        f.write(generate_source())